@@ -156,6 +156,56 @@ private:
     using INHERITED = Benchmark;
 };
 
+// Measures pure key construction/hash/copy/compare cost, without a cache. At high resource
+// counts this churn is measurable in flush profiles, so it's tracked on its own.
+class GrResourceKeyChurnBench : public Benchmark {
+public:
+    GrResourceKeyChurnBench(int keyData32Count)
+        : fFullName("grresourcekey_churn")
+        , fKeyData32Count(keyData32Count) {
+        if (keyData32Count > 1) {
+            fFullName.appendf("_%d", fKeyData32Count);
+        }
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+protected:
+    const char* onGetName() override {
+        return fFullName.c_str();
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        static GrUniqueKey::Domain kDomain = GrUniqueKey::GenerateDomain();
+        uint32_t sink = 0;
+        for (int i = 0; i < loops; ++i) {
+            for (int k = 0; k < 1000; ++k) {
+                GrUniqueKey key;
+                {
+                    GrUniqueKey::Builder builder(&key, kDomain, fKeyData32Count);
+                    for (int j = 0; j < fKeyData32Count; ++j) {
+                        builder[j] = k + j;
+                    }
+                }
+                GrUniqueKey copy(key);
+                SkASSERT(copy == key);
+                sink ^= copy.hash();
+            }
+        }
+        // Defeat dead-code elimination of the loop body.
+        if (sink == 0xdeadbeef) {
+            SkDebugf("");
+        }
+    }
+
+private:
+    SkString fFullName;
+    int fKeyData32Count;
+    using INHERITED = Benchmark;
+};
+
 DEF_BENCH( return new GrResourceCacheBenchAdd(1); )
 #ifdef SK_RELEASE
 // Only on release because on debug the SkTDynamicHash validation is too slow.
@@ -170,6 +220,11 @@ DEF_BENCH( return new GrResourceCacheBenchAdd(55); )
 DEF_BENCH( return new GrResourceCacheBenchAdd(56); )
 #endif
 
+DEF_BENCH( return new GrResourceKeyChurnBench(2); )
+DEF_BENCH( return new GrResourceKeyChurnBench(5); )
+DEF_BENCH( return new GrResourceKeyChurnBench(10); )
+DEF_BENCH( return new GrResourceKeyChurnBench(26); )
+
 DEF_BENCH( return new GrResourceCacheBenchFind(1); )
 #ifdef SK_RELEASE
 DEF_BENCH( return new GrResourceCacheBenchFind(2); )
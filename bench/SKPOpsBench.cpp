@@ -0,0 +1,120 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/SKPOpsBench.h"
+
+#include "include/core/SkCanvas.h"
+#include "src/core/SkRecordDraw.h"
+#include "src/core/SkRecorder.h"
+
+namespace {
+
+// Classify each draw record; state ops fall through to the template and return
+// -1, meaning "always replay".
+static int op_class(const SkRecords::DrawRect&)     { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawRRect&)    { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawDRRect&)   { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawOval&)     { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawArc&)      { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawRegion&)   { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawPaint&)    { return (int)SKPOpsBench::OpClass::kRects; }
+static int op_class(const SkRecords::DrawEdgeAAQuad&) {
+    return (int)SKPOpsBench::OpClass::kRects;
+}
+
+static int op_class(const SkRecords::DrawPath&)     { return (int)SKPOpsBench::OpClass::kPaths; }
+
+static int op_class(const SkRecords::DrawImage&)    { return (int)SKPOpsBench::OpClass::kImages; }
+static int op_class(const SkRecords::DrawImageRect&) {
+    return (int)SKPOpsBench::OpClass::kImages;
+}
+static int op_class(const SkRecords::DrawImageLattice&) {
+    return (int)SKPOpsBench::OpClass::kImages;
+}
+static int op_class(const SkRecords::DrawAtlas&)    { return (int)SKPOpsBench::OpClass::kImages; }
+static int op_class(const SkRecords::DrawEdgeAAImageSet&) {
+    return (int)SKPOpsBench::OpClass::kImages;
+}
+
+static int op_class(const SkRecords::DrawTextBlob&) { return (int)SKPOpsBench::OpClass::kText; }
+
+static int op_class(const SkRecords::DrawPoints&)    { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawVertices&)  { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawPatch&)     { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawPicture&)   { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawDrawable&)  { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawBehind&)    { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawShadowRec&) { return (int)SKPOpsBench::OpClass::kOther; }
+static int op_class(const SkRecords::DrawAnnotation&) {
+    return (int)SKPOpsBench::OpClass::kOther;
+}
+
+template <typename T>
+static int op_class(const T&) { return -1; }
+
+// Forwards state ops and one class of draw ops to SkRecords::Draw, skipping the
+// rest.
+class ClassFilteredDraw {
+public:
+    ClassFilteredDraw(SkCanvas* canvas, int opClass)
+            : fDraw(canvas, nullptr, nullptr, 0), fClass(opClass) {}
+
+    template <typename T> void operator()(const T& op) {
+        int c = op_class(op);
+        if (c < 0 || c == fClass) {
+            fDraw(op);
+        }
+    }
+
+private:
+    SkRecords::Draw fDraw;
+    int fClass;
+};
+
+}  // namespace
+
+const char* SKPOpsBench::OpClassName(OpClass opClass) {
+    switch (opClass) {
+        case OpClass::kRects:  return "rects";
+        case OpClass::kPaths:  return "paths";
+        case OpClass::kImages: return "images";
+        case OpClass::kText:   return "text";
+        case OpClass::kOther:  return "other";
+    }
+    SkUNREACHABLE;
+}
+
+SKPOpsBench::SKPOpsBench(const char* name, const SkPicture* pic, OpClass opClass)
+        : fOpClass(opClass) {
+    fName.printf("%s_ops_%s", name, OpClassName(opClass));
+    fSize = SkIPoint::Make(SkScalarCeilToInt(pic->cullRect().width()),
+                           SkScalarCeilToInt(pic->cullRect().height()));
+    SkRecorder recorder(&fRecord, pic->cullRect());
+    pic->playback(&recorder);
+}
+
+const char* SKPOpsBench::onGetName() {
+    return fName.c_str();
+}
+
+bool SKPOpsBench::isSuitableFor(Backend backend) {
+    return backend != kNonRendering_Backend;
+}
+
+SkIPoint SKPOpsBench::onGetSize() {
+    return fSize;
+}
+
+void SKPOpsBench::onDraw(int loops, SkCanvas* canvas) {
+    for (int i = 0; i < loops; ++i) {
+        SkAutoCanvasRestore acr(canvas, true);
+        ClassFilteredDraw draw(canvas, (int)fOpClass);
+        for (int j = 0; j < fRecord.count(); ++j) {
+            fRecord.visit(j, draw);
+        }
+    }
+}
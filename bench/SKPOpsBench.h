@@ -0,0 +1,52 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SKPOpsBench_DEFINED
+#define SKPOpsBench_DEFINED
+
+#include "bench/Benchmark.h"
+#include "include/core/SkPicture.h"
+#include "src/core/SkRecord.h"
+
+/**
+ * Replays a single class of draw ops from an SkPicture via SkRecord visitation.
+ * State ops (save/restore, clip, matrix) always run so the surviving draws see
+ * their recorded clips and CTMs. Running one bench per (skp, op class) across a
+ * corpus attributes playback time to op classes, and the rows land in the
+ * regular nanobench results file for baselining.
+ */
+class SKPOpsBench : public Benchmark {
+public:
+    enum class OpClass {
+        kRects,
+        kPaths,
+        kImages,
+        kText,
+        kOther,
+    };
+    static constexpr int kOpClassCount = 5;
+
+    static const char* OpClassName(OpClass);
+
+    SKPOpsBench(const char* name, const SkPicture*, OpClass);
+
+protected:
+    const char* onGetName() override;
+    bool isSuitableFor(Backend) override;
+    SkIPoint onGetSize() override;
+    void onDraw(int loops, SkCanvas*) override;
+
+private:
+    SkString fName;
+    SkRecord fRecord;
+    SkIPoint fSize;
+    OpClass  fOpClass;
+
+    using INHERITED = Benchmark;
+};
+
+#endif  // SKPOpsBench_DEFINED
@@ -19,6 +19,7 @@
 #include "bench/ResultsWriter.h"
 #include "bench/SKPAnimationBench.h"
 #include "bench/SKPBench.h"
+#include "bench/SKPOpsBench.h"
 #include "bench/SkGlyphCacheBench.h"
 #include "bench/SkSLBench.h"
 #include "include/codec/SkAndroidCodec.h"
@@ -127,6 +128,7 @@ static DEFINE_string(zoom, "1.0,0",
                      "function that ping-pongs between 1.0 and zoomMax.");
 static DEFINE_bool(bbh, true, "Build a BBH for SKPs?");
 static DEFINE_bool(loopSKP, true, "Loop SKPs like we do for micro benches?");
+static DEFINE_bool(skpOps, false, "Also run per-op-class playback benches for each SKP?");
 static DEFINE_int(flushEvery, 10, "Flush --outResultsFile every Nth run.");
 static DEFINE_bool(gpuStats, false, "Print GPU stats after each gpu benchmark?");
 static DEFINE_bool(gpuStatsDump, false, "Dump GPU stats after each benchmark to json");
@@ -830,6 +832,28 @@ public:
             return new DeserializePictureBench(name.c_str(), std::move(data));
         }
 
+        // Optionally add one bench per (skp, op class), attributing playback time
+        // to classes of draw ops so corpus regressions can be localized.
+        if (FLAGS_skpOps) {
+            while (fCurrentOpsSKP < fSKPs.count()) {
+                const SkString& path = fSKPs[fCurrentOpsSKP];
+                sk_sp<SkPicture> pic = ReadPicture(path.c_str());
+                if (!pic) {
+                    fCurrentOpsSKP++;
+                    continue;
+                }
+                SkString name = SkOSPath::Basename(path.c_str());
+                auto opClass = static_cast<SKPOpsBench::OpClass>(fCurrentOpClass);
+                if (++fCurrentOpClass == SKPOpsBench::kOpClassCount) {
+                    fCurrentOpClass = 0;
+                    fCurrentOpsSKP++;
+                }
+                fSourceType = "skp";
+                fBenchType  = "playback-ops";
+                return new SKPOpsBench(name.c_str(), pic.get(), opClass);
+            }
+        }
+
         // Then once each for each scale as SKPBenches (playback).
         while (fCurrentScale < fScales.count()) {
             while (fCurrentSKP < fSKPs.count()) {
@@ -1152,6 +1176,8 @@ private:
     const char* fBenchType;   // How we bench it: micro, recording, playback, ...
     int fCurrentRecording = 0;
     int fCurrentDeserialPicture = 0;
+    int fCurrentOpsSKP = 0;
+    int fCurrentOpClass = 0;
     int fCurrentMSKP = 0;
     int fCurrentScale = 0;
     int fCurrentSKP = 0;
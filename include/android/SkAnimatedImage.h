@@ -110,6 +110,18 @@ public:
      */
     int getFrameCount() const { return fFrameCount; }
 
+    /**
+     *  Return the area of getCurrentFrame() changed by the most recent call
+     *  to decodeNextFrame(): the new frame's update rectangle unioned with
+     *  whatever the prior frame's disposal cleared or reverted. Callers that
+     *  keep the previous frame's pixels (or texture) can limit their copy or
+     *  upload to this area. Conservatively the full bounds whenever the frame
+     *  was recomposed from scratch (the first frame, a restarted loop, or a
+     *  non-simple image, whose scaling/cropping/post-processing makes partial
+     *  damage ill-defined), and empty when nothing changed.
+     */
+    SkIRect currentFrameDamage() const { return fCurrentFrameDamage; }
+
 protected:
     SkRect onGetBounds() override;
     void onDraw(SkCanvas*) override;
@@ -152,12 +164,14 @@ private:
     Frame                           fRestoreFrame;
     int                             fRepetitionCount;
     int                             fRepetitionsCompleted;
+    SkIRect                         fCurrentFrameDamage = SkIRect::MakeEmpty();
 
     SkAnimatedImage(std::unique_ptr<SkAndroidCodec>, const SkImageInfo& requestedInfo,
             SkIRect cropRect, sk_sp<SkPicture> postProcess);
 
     int computeNextFrame(int current, bool* animationEnded);
     double finish();
+    void updateFrameDamage(int frameToDecode, const SkIRect& frameRect);
 
     /**
      *  True if there is no crop, orientation, or post decoding scaling.
@@ -199,6 +199,20 @@ public:
          *  The default is 1, representing no downscaling.
          */
         int fSampleSize;
+
+        /**
+         *  If true and fSampleSize > 1, compute each output pixel as the box-filtered
+         *  average of the block it represents instead of a point sample, where the codec
+         *  supports it. The averaging is fused into the scanline decode: each decoded row
+         *  is accumulated and discarded, so peak memory stays bounded by a few scanlines
+         *  rather than the full image.
+         *
+         *  This is slower than point sampling because every source row is decoded.
+         *  Codecs and color types that do not support it fall back to point sampling.
+         *
+         *  The default is false.
+         */
+        bool fBoxFilter = false;
     };
 
     /**
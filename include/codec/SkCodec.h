@@ -531,6 +531,45 @@ public:
      */
     bool skipScanlines(int countLines);
 
+    /**
+     *  A stateful helper for decoding a sequence of rectangular regions from one image.
+     *
+     *  The session keeps the codec's scanline decoder alive between calls. When successive
+     *  regions use the same columns and descend through the image (as when tiling a large
+     *  image top to bottom), each decode continues from the current position in the stream
+     *  instead of restarting the entropy decode from the beginning, so it costs roughly the
+     *  size of the region rather than the size of the image. The session restarts the
+     *  decoder transparently whenever a region is above the current position or uses
+     *  different columns.
+     *
+     *  The codec must outlive the session, and no other decode calls may be made on the
+     *  codec while the session is in use.
+     */
+    class SK_API RegionDecodeSession {
+    public:
+        explicit RegionDecodeSession(SkCodec* codec) : fCodec(codec) {}
+
+        /**
+         *  Decode region (in image coordinates) into dst.
+         *
+         *  dstInfo's dimensions must match region's; its color information is used for the
+         *  entire session's scanline decodes. Only codecs whose scanline order is kTopDown
+         *  are supported.
+         *
+         *  @return kSuccess, or the failure of the underlying scanline decode.
+         */
+        Result decodeRegion(const SkImageInfo& dstInfo, void* dst, size_t rowBytes,
+                            const SkIRect& region);
+
+    private:
+        SkCodec*    fCodec;
+        SkIRect     fSubset = SkIRect::MakeEmpty();  // Columns passed to startScanlineDecode().
+                                                     // Must outlive the decode; Options stores
+                                                     // a pointer to it.
+        SkColorInfo fColorInfo;
+        bool        fActive = false;
+    };
+
     /**
      *  The order in which rows are output from the scanline decoder is not the
      *  same for all variations of all image types.  This explains the possible
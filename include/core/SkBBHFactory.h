@@ -30,6 +30,21 @@ public:
      */
     virtual void search(const SkRect& query, std::vector<int>* results) const = 0;
 
+    // A contiguous, half-open range of op indices.
+    struct OpRange {
+        int fBegin;
+        int fEnd;
+    };
+
+    /**
+     * Populate results with ascending, non-overlapping ranges of indices that cover every
+     * bounding box intersecting the query. The ranges may conservatively include indices whose
+     * boxes do not intersect (callers must tolerate a superset, as SkRecordDraw playback does),
+     * which lets implementations report a fully-visible subtree as one range without walking it.
+     * The default implementation wraps search() and only coalesces adjacent indices.
+     */
+    virtual void searchRanges(const SkRect& query, std::vector<OpRange>* results) const;
+
     /**
      * Return approximate size in memory of *this.
      */
@@ -1814,6 +1814,29 @@ public:
     void drawGlyphs(int count, const SkGlyphID glyphs[], const SkRSXform xforms[],
                     SkPoint origin, const SkFont& font, const SkPaint& paint);
 
+    /** Describes one positioned run of glyphs for drawGlyphRuns(). */
+    struct GlyphRun {
+        const SkFont*    fFont;       //!< typeface, text size and so on for this run
+        const SkGlyphID* fGlyphs;     //!< array of glyphIDs to draw
+        const SkPoint*   fPositions;  //!< where to draw each glyph relative to fOrigin
+        int              fCount;      //!< number of glyphs and positions
+        SkPoint          fOrigin;     //!< the origin of all the positions in this run
+    };
+
+    /** Draws runCount runs of glyphs, equivalent to calling drawGlyphs() once per run, in
+        order, with the run's font, glyphs, positions, and origin, all styled with paint.
+
+        All the runs are gathered into a single internal glyph-run list, so the per-draw
+        overhead - quick reject, layer setup, and glyph painter setup - is paid once for the
+        whole batch rather than once per run. Callers issuing many small runs (one per style
+        run of a text line, say) should prefer this over looping over drawGlyphs().
+
+        @param runCount  number of runs to draw
+        @param runs      the array of runs to draw
+        @param paint     blend, color, and so on, used to draw every run
+    */
+    void drawGlyphRuns(int runCount, const GlyphRun runs[], const SkPaint& paint);
+
     /** Draws SkTextBlob blob at (x, y), using clip, SkMatrix, and SkPaint paint.
 
         blob contains glyphs, their positions, and paint attributes specific to text:
@@ -2306,8 +2329,8 @@ private:
     sk_sp<SkMarkerStack> fMarkerStack;
 
     // the first N recs that can fit here mean we won't call malloc
-    static constexpr int kMCRecSize      = 96; // most recent measurement
-    static constexpr int kMCRecCount     = 32; // common depth for save/restores
+    static constexpr int kMCRecSize      = 144; // most recent measurement
+    static constexpr int kMCRecCount     = 64; // covers deep DOM-style save/restore nesting
 
     intptr_t fMCRecStorage[kMCRecSize * kMCRecCount / sizeof(intptr_t)];
 
@@ -2331,6 +2354,7 @@ private:
 
     void doSave();
     void checkForDeferredSave();
+    void checkForDeferredDeviceSave();
     void internalSetMatrix(const SkM44&);
 
     friend class SkAndroidFrameworkUtils;
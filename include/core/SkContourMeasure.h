@@ -26,6 +26,15 @@ public:
     bool SK_WARN_UNUSED_RESULT getPosTan(SkScalar distance, SkPoint* position,
                                          SkVector* tangent) const;
 
+    /** As getPosTan(), for count distances at once. Ascending distances (the common
+     *  case when sampling along the contour) are answered with a single pass over the
+     *  segment table rather than a binary search per query. position and tangent may
+     *  each be null; otherwise they receive count results. Returns false if any
+     *  distance is NaN, in which case the remaining results are unspecified.
+     */
+    bool SK_WARN_UNUSED_RESULT getPosTans(const SkScalar distances[], int count,
+                                          SkPoint position[], SkVector tangent[]) const;
+
     enum MatrixFlags {
         kGetPosition_MatrixFlag     = 0x01,
         kGetTangent_MatrixFlag      = 0x02,
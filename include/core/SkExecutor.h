@@ -22,6 +22,12 @@ public:
     static std::unique_ptr<SkExecutor> MakeLIFOThreadPool(int threads = 0,
                                                           bool allowBorrowing = true);
 
+    // Create a work-stealing thread pool: each thread owns its own queue and steals from its
+    // peers when it runs out. Scales better than the FIFO/LIFO pools under fine-grained work,
+    // and work added from a pool thread stays local to that thread until stolen.
+    static std::unique_ptr<SkExecutor> MakeWorkStealingThreadPool(int threads = 0,
+                                                                  bool allowBorrowing = true);
+
     // There is always a default SkExecutor available by calling SkExecutor::GetDefault().
     static SkExecutor& GetDefault();
     static void SetDefault(SkExecutor*);  // Does not take ownership.  Not thread safe.
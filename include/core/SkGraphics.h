@@ -9,9 +9,16 @@
 #define SkGraphics_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/private/SkMallocTag.h"
 
 class SkData;
+class SkExecutor;
+class SkFont;
 class SkImageGenerator;
+class SkMatrix;
+class SkPaint;
+class SkString;
+class SkSurfaceProps;
 class SkTraceMemoryDump;
 
 class SK_API SkGraphics {
@@ -23,6 +30,25 @@ public:
      */
     static void Init();
 
+    /**
+     *  Pre-warms Skia's lazily constructed global singletons on the given executor (e.g. during
+     *  an app splash screen) so their one-time setup cost is not paid during the first draw.
+     *  Covers Init() itself (CPU feature detection and SkOpts), the strike cache, the resource
+     *  cache, and the platform font manager. GPU-side lazy work (SkSL module compilation, GL
+     *  table generation) is tied to a GrDirectContext and is warmed by creating the context
+     *  early instead.
+     *
+     *  Each warm-up target is thread-safe and idempotent, so this is safe to call while other
+     *  threads are already using Skia. Does nothing if executor is nullptr.
+     */
+    static void InitAsync(SkExecutor* executor);
+
+    /**
+     *  Appends one line per completed InitAsync() warm-up step, with the milliseconds it took,
+     *  for attributing time-to-first-frame. Steps still running (or never scheduled) are absent.
+     */
+    static void GetInitTimings(SkString* report);
+
     // We're in the middle of cleaning this up.
     static void Term() {}
 
@@ -47,6 +73,13 @@ public:
      */
     static size_t GetFontCacheUsed();
 
+    /**
+     *  Return the number of live heap bytes allocated through sk_malloc() while the given
+     *  subsystem tag was in scope. Always returns 0 unless Skia was built with
+     *  SK_MALLOC_ACCOUNTING.
+     */
+    static size_t GetAllocationBytesForTag(SkMallocTag);
+
     /**
      *  Return the number of entries in the font cache.
      *  A cache "entry" is associated with each typeface + pointSize + matrix.
@@ -73,6 +106,14 @@ public:
      */
     static void PurgeFontCache();
 
+    /**
+     *  Attempts to purge, least-recently used first, at most bytesToPurge bytes from the font
+     *  cache, and returns the number of bytes freed. Stopping early leaves the cache in a state
+     *  the next call resumes from, so a full purge can be split into steps that each block other
+     *  users of the cache for only a bounded time.
+     */
+    static size_t PurgeFontCachePartial(size_t bytesToPurge);
+
     /**
      *  This function returns the memory used for temporary images and other resources.
      */
@@ -92,6 +133,12 @@ public:
      */
     static void PurgeResourceCache();
 
+    /**
+     *  Incremental counterpart to PurgeResourceCache(); same contract as
+     *  PurgeFontCachePartial() but for the resource cache.
+     */
+    static size_t PurgeResourceCachePartial(size_t bytesToPurge);
+
     /**
      *  When the cachable entry is very lage (e.g. a large scaled bitmap), adding it to the cache
      *  can cause most/all of the existing entries to be purged. To avoid the, the client can set
@@ -117,6 +164,30 @@ public:
      */
     static void PurgeAllCaches();
 
+    /**
+     *  Incremental version of PurgeAllCaches() for responding to memory pressure without
+     *  stalling a render thread: schedules work on executor that evicts at most bytesPerStep
+     *  bytes per step, rescheduling itself until the font and resource caches are empty. A
+     *  thread using the caches waits for at most one step, so bytesPerStep bounds the pause it
+     *  can observe. The executor must outlive the purge.
+     */
+    static void PurgeAllCachesAsync(SkExecutor* executor, size_t bytesPerStep = 1 << 20);
+
+    /**
+     *  Rasterize the images of glyphs, as they would be drawn with font and paint under
+     *  deviceMatrix onto a surface with surfaceProps, into the glyph cache using executor.
+     *  A subsequent draw of the same text then finds its strike already populated instead of
+     *  rendering the misses on the draw thread. The work is queued and this returns
+     *  immediately; the prefetch is only a hint, and glyphs are prepared at whole-pixel
+     *  positions, so subpixel-positioned draws may still render their own variants.
+     *  The executor must outlive the queued work.
+     */
+    static void PrefetchGlyphImages(const SkFont& font, const SkPaint& paint,
+                                    const SkMatrix& deviceMatrix,
+                                    const SkSurfaceProps& surfaceProps,
+                                    const SkGlyphID glyphs[], int count,
+                                    SkExecutor* executor);
+
     /**
      *  Applications with command line options may pass optional state, such
      *  as cache sizes, here, for instance:
@@ -35,6 +35,7 @@ class SkPromiseImageTexture;
 class SkSurface;
 class SkYUVAPixmaps;
 class GrBackendFormat;
+class GrBackendSemaphore;
 class GrBackendTexture;
 class GrDirectContext;
 class GrRecordingContext;
@@ -247,6 +248,26 @@ public:
                                                    int width, int height,
                                                    CompressionType type);
 
+    /** User function that transcodes compressed texture data from srcType to dstType, returning
+        the transcoded data or nullptr if it cannot perform the conversion. width and height
+        describe the base level; data may contain additional mipmap levels, which must also be
+        transcoded.
+    */
+    typedef sk_sp<SkData> (*CompressedDataTranscoder)(sk_sp<SkData> data,
+                                                      int width, int height,
+                                                      CompressionType srcType,
+                                                      CompressionType dstType);
+
+    /** Registers a process-wide transcoder that MakeTextureFromCompressed consults when the GPU
+        cannot sample the supplied compression type directly. Each compression type the GPU does
+        support is offered to the transcoder in turn; if it produces data for one, that data is
+        uploaded still-compressed instead of falling back to decompressing into an uncompressed
+        texture. Set this before creating images on multiple threads.
+
+        Returns the previous transcoder (which could be nullptr).
+    */
+    static CompressedDataTranscoder SetCompressedDataTranscoder(CompressedDataTranscoder);
+
     /** User function called when supplied texture may be deleted.
     */
     typedef void (*TextureReleaseProc)(ReleaseContext releaseContext);
@@ -418,6 +439,27 @@ public:
                                               bool limitToMaxTextureSize = false,
                                               sk_sp<SkColorSpace> imageColorSpace = nullptr);
 
+    /** Creates a planar SkImage by decoding encoded data directly to YUVA planes.
+
+        If the codec backing the encoded data can produce planar output (e.g. JPEG via
+        libjpeg-turbo) in a configuration supported by the context, the planes are decoded and
+        uploaded as individual textures with no RGBA intermediate, as if by MakeFromYUVAPixmaps.
+        Returns nullptr if the data cannot be decoded to planes; callers should then fall back
+        to MakeFromEncoded.
+
+        @param context          GPU context
+        @param encoded          data of SkImage to decode
+        @param buildMips        create internal YUVA textures as mip map if kYes. This is
+                                silently ignored if the context does not support mip maps.
+        @param imageColorSpace  range of colors of the resulting image; if nullptr the codec's
+                                color space is used
+        @return                 created SkImage, or nullptr
+    */
+    static sk_sp<SkImage> MakeFromEncodedYUVA(GrRecordingContext* context,
+                                              sk_sp<SkData> encoded,
+                                              GrMipMapped buildMips = GrMipmapped::kNo,
+                                              sk_sp<SkColorSpace> imageColorSpace = nullptr);
+
     enum class BitDepth {
         kU8,  //!< uses 8-bit unsigned int per color component
         kF16, //!< uses 16-bit float per color component
@@ -737,6 +779,29 @@ public:
     */
     void flushAndSubmit(GrDirectContext*);
 
+    /** Notifies Skia that the contents of the texture backing this SkImage were changed
+        externally, e.g. a video decoder wrote a new frame into a texture that was wrapped
+        with MakeFromTexture(). This lets one wrapped SkImage be reused across frames rather
+        than re-wrapping the texture each frame: the proxy backing the image is preserved,
+        while copies Skia derived from the previous contents (cached raster pixels and cached
+        mipmap levels) are discarded.
+
+        If waitSemaphores are supplied, the context waits on them before any work that reads
+        the new contents. The caller retains ownership of the semaphores and must keep them
+        valid until the next flush.
+
+        Returns false if the image is not a texture-backed image on context, if context is
+        abandoned, or if a semaphore wait could not be added.
+
+        @param context            the direct context the image's texture belongs to
+        @param numWaitSemaphores  number of semaphores to wait on before reading new contents
+        @param waitSemaphores     semaphores signaled by the producer of the new contents
+        @return                   true if the content update was recorded
+    */
+    bool notifyTextureContentsChanged(GrDirectContext* context,
+                                      int numWaitSemaphores = 0,
+                                      const GrBackendSemaphore* waitSemaphores = nullptr);
+
     /** Retrieves the back-end texture. If SkImage has no back-end texture, an invalid
         object is returned. Call GrBackendTexture::isValid to determine if the result
         is valid.
@@ -878,6 +943,14 @@ public:
      */
     using ReadPixelsCallback = void(ReadPixelsContext, std::unique_ptr<const AsyncReadResult>);
 
+    /**  Client-provided callback to asyncRescaleAndReadPixelsTiled() that is called once per
+         completed tile. tileRect is the tile's position within the full requested result. On
+         failure of a tile the callback receives nullptr for AsyncReadResult; other tiles may
+         still succeed.
+     */
+    using ReadPixelsTileCallback = void(ReadPixelsContext, const SkIRect& tileRect,
+                                        std::unique_ptr<const AsyncReadResult>);
+
     enum class RescaleGamma : bool { kSrc, kLinear };
 
     enum class RescaleMode {
@@ -923,6 +996,32 @@ public:
                                    ReadPixelsCallback callback,
                                    ReadPixelsContext context);
 
+    /** Like asyncRescaleAndReadPixels, but splits the read into horizontal bands of at most
+        'tileRows' rows and delivers one callback per band as its rows complete, so consumers
+        such as encoders can overlap processing with the remaining readback. Each band is read
+        independently: on the GPU backend each band gets its own transfer; raster images deliver
+        the bands synchronously in top-to-bottom order. The tileRect passed to the callback is
+        positioned within the full result described by 'info'. When rescaling is required
+        (srcRect dimensions differ from 'info') the read is delivered as a single tile, as it is
+        when 'tileRows' is not in (0, info.height()).
+
+        @param info            info of the requested pixels
+        @param srcRect         subrectangle of image to read
+        @param tileRows        maximum number of result rows delivered per callback
+        @param rescaleGamma    controls whether rescaling is done in the image's gamma or whether
+                               the source data is transformed to a linear gamma before rescaling.
+        @param rescaleMode     controls the technique (and cost) of the rescaling
+        @param callback        function to call with each completed tile
+        @param context         passed to callback
+    */
+    void asyncRescaleAndReadPixelsTiled(const SkImageInfo& info,
+                                        const SkIRect& srcRect,
+                                        int tileRows,
+                                        RescaleGamma rescaleGamma,
+                                        RescaleMode rescaleMode,
+                                        ReadPixelsTileCallback callback,
+                                        ReadPixelsContext context);
+
     /**
         Similar to asyncRescaleAndReadPixels but performs an additional conversion to YUV. The
         RGB->YUV conversion is controlled by 'yuvColorSpace'. The YUV data is returned as three
@@ -87,6 +87,26 @@ public:
         return this->getPixels(pm.info(), pm.writable_addr(), pm.rowBytes());
     }
 
+    /**
+     *  Returns true if the generator can decode the image in top-down row slices via repeated
+     *  calls to incrementalDecode(). Most generators only decode whole images and return false;
+     *  the caller then falls back to getPixels().
+     *
+     *  As with getPixels(), info describes the destination and its dimensions must match
+     *  getInfo(). The generator retains the pixel address until the decode completes, fails, or
+     *  another decode is started.
+     */
+    bool startIncrementalDecode(const SkImageInfo& info, void* pixels, size_t rowBytes);
+
+    /**
+     *  Decodes up to rowBudget further rows of the image passed to startIncrementalDecode().
+     *  On return *totalRowsDecoded holds the number of rows decoded so far; the decode is
+     *  complete when that reaches the height passed to startIncrementalDecode(). Returns false
+     *  if no decode is in progress or the input cannot be decoded further; in the latter case
+     *  the remaining rows have been filled and the decode is over.
+     */
+    bool incrementalDecode(int rowBudget, int* totalRowsDecoded);
+
     /**
      *  If decoding to YUV is supported, this returns true. Otherwise, this
      *  returns false and the caller will ignore output parameter yuvaPixmapInfo.
@@ -173,6 +193,8 @@ protected:
     virtual sk_sp<SkData> onRefEncodedData() { return nullptr; }
     struct Options {};
     virtual bool onGetPixels(const SkImageInfo&, void*, size_t, const Options&) { return false; }
+    virtual bool onStartIncrementalDecode(const SkImageInfo&, void*, size_t) { return false; }
+    virtual bool onIncrementalDecode(int, int*) { return false; }
     virtual bool onIsValid(GrRecordingContext*) const { return true; }
     virtual bool onQueryYUVAInfo(const SkYUVAPixmapInfo::SupportedDataTypes&,
                                  SkYUVAPixmapInfo*) const { return false; }
@@ -150,6 +150,12 @@ public:
     //TODO: replace with virtual const SkData* getData()
     virtual const void* getMemoryBase() { return nullptr; }
 
+    /** If the stream's unread contents are backed by refcounted memory whose lifetime is
+     *  independent of the stream (e.g. an SkMemoryStream over an mmapped SkData), returns
+     *  them as a zero-copy SkData without changing the position. Otherwise returns NULL.
+     */
+    virtual sk_sp<SkData> peekData() const { return nullptr; }
+
 private:
     virtual SkStream* onDuplicate() const { return nullptr; }
     virtual SkStream* onFork() const { return nullptr; }
@@ -431,6 +437,7 @@ public:
     size_t getLength() const override;
 
     const void* getMemoryBase() override;
+    sk_sp<SkData> peekData() const override;
 
 private:
     SkMemoryStream* onDuplicate() const override;
@@ -438,6 +445,9 @@ private:
 
     sk_sp<SkData>   fData;
     size_t          fOffset;
+    // False when fData merely wraps caller memory (copyData = false paths), in which
+    // case peekData() must not hand out a reference that could outlive that memory.
+    bool            fDataIsDurable = true;
 
     using INHERITED = SkStreamMemory;
 };
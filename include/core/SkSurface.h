@@ -613,6 +613,21 @@ public:
      */
     sk_sp<SkImage> makeImageSnapshot(const SkIRect& bounds);
 
+    /**
+     *  Like makeImageSnapshot(), but for callers that know which pixels have changed since the
+     *  previous snapshot was taken from this surface. dirtyRect promises that every other pixel
+     *  is unchanged; Skia may then patch and reuse a previous snapshot's storage rather than
+     *  copying the full surface, making the snapshot cost proportional to the damaged area.
+     *  Pixels outside dirtyRect that have in fact changed may appear stale in the returned image.
+     *
+     *  GPU surfaces keep up to two reusable snapshot textures alive to service this; other
+     *  surfaces ignore the hint and behave like makeImageSnapshot().
+     *
+     *  @param dirtyRect  bounds of the pixels modified since the previous snapshot
+     *  @return           SkImage initialized with SkSurface contents
+     */
+    sk_sp<SkImage> makeIncrementalImageSnapshot(const SkIRect& dirtyRect);
+
     /** Draws SkSurface contents to canvas, with its top-left corner at (x, y).
 
         If SkPaint paint is not nullptr, apply SkColorFilter, alpha, SkImageFilter, and SkBlendMode.
@@ -751,6 +766,13 @@ public:
      */
     using ReadPixelsCallback = void(ReadPixelsContext, std::unique_ptr<const AsyncReadResult>);
 
+    /**  Client-provided callback to asyncRescaleAndReadPixelsTiled() that is called once per
+         completed tile. tileRect is the tile's position within the full requested result. On
+         failure of a tile the callback receives nullptr for AsyncReadResult; other tiles may
+         still succeed.
+     */
+    using ReadPixelsTileCallback = SkImage::ReadPixelsTileCallback;
+
     /** Controls the gamma that rescaling occurs in for asyncRescaleAndReadPixels() and
         asyncRescaleAndReadPixelsYUV420().
      */
@@ -794,6 +816,32 @@ public:
                                    ReadPixelsCallback callback,
                                    ReadPixelsContext context);
 
+    /** Like asyncRescaleAndReadPixels, but splits the read into horizontal bands of at most
+        'tileRows' rows and delivers one callback per band as its rows complete, so consumers
+        such as encoders can overlap processing with the remaining readback. Each band is read
+        independently: on the GPU backend each band gets its own transfer; raster surfaces
+        deliver the bands synchronously in top-to-bottom order. The tileRect passed to the
+        callback is positioned within the full result described by 'info'. When rescaling is
+        required (srcRect dimensions differ from 'info') the read is delivered as a single tile,
+        as it is when 'tileRows' is not in (0, info.height()).
+
+        @param info            info of the requested pixels
+        @param srcRect         subrectangle of surface to read
+        @param tileRows        maximum number of result rows delivered per callback
+        @param rescaleGamma    controls whether rescaling is done in the surface's gamma or whether
+                               the source data is transformed to a linear gamma before rescaling.
+        @param rescaleMode     controls the technique of the rescaling
+        @param callback        function to call with each completed tile
+        @param context         passed to callback
+     */
+    void asyncRescaleAndReadPixelsTiled(const SkImageInfo& info,
+                                        const SkIRect& srcRect,
+                                        int tileRows,
+                                        RescaleGamma rescaleGamma,
+                                        RescaleMode rescaleMode,
+                                        ReadPixelsTileCallback callback,
+                                        ReadPixelsContext context);
+
     /**
         Similar to asyncRescaleAndReadPixels but performs an additional conversion to YUV. The
         RGB->YUV conversion is controlled by 'yuvColorSpace'. The YUV data is returned as three
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkSurfacePool_DEFINED
+#define SkSurfacePool_DEFINED
+
+#include "include/core/SkSurface.h"
+
+#include <vector>
+
+/** \class SkSurfacePool
+    Recycles whole SkSurface objects for callers that create short-lived offscreen surfaces
+    every frame. While GrResourceCache reuses the GPU backing stores, each SkSurface also
+    carries device and canvas allocations; the pool keeps those alive as well, keyed on
+    SkImageInfo, sample count, and SkSurfaceProps.
+
+    Recycled surfaces are handed back with a reset canvas (no saves, identity matrix, full
+    clip) and their contents discarded, so SkImages snapped from an earlier use stay valid.
+
+    The pool tracks every surface it hands out, so surfaces should be returned with recycle()
+    when the caller is done; a surface that is never recycled stays alive until the pool is
+    destroyed. SkSurfacePool is not thread safe; use one pool per thread.
+*/
+class SK_API SkSurfacePool {
+public:
+    /** Creates a pool that keeps at most maxSurfaces idle surfaces; the oldest idle surface
+        is dropped when the cap is exceeded.
+    */
+    explicit SkSurfacePool(int maxSurfaces = 8);
+    ~SkSurfacePool();
+
+    /** Returns an idle surface matching the description, or creates one.
+        With a non-null recordingContext the surface is made (and matched) on that context via
+        SkSurface::MakeRenderTarget; otherwise SkSurface::MakeRaster is used and sampleCount
+        must be 1. Returns nullptr if the surface could not be created.
+    */
+    sk_sp<SkSurface> acquire(GrRecordingContext* recordingContext,
+                             const SkImageInfo& info,
+                             int sampleCount = 1,
+                             const SkSurfaceProps* props = nullptr);
+
+    /** Returns a surface acquired from this pool, making it available to a later acquire().
+        The caller must have dropped its other refs to the surface; if refs remain (or the
+        surface did not come from this pool) the surface is released instead of recycled.
+    */
+    void recycle(sk_sp<SkSurface> surface);
+
+    /** Releases all idle surfaces. */
+    void purge();
+
+    /** Returns the number of idle surfaces held for reuse. */
+    int count() const;
+
+private:
+    struct Entry {
+        sk_sp<SkSurface> fSurface;
+        int              fSampleCount;
+        bool             fInUse;
+    };
+
+    std::vector<Entry> fEntries;  // oldest first
+    const int          fMaxSurfaces;
+};
+
+#endif  // SkSurfacePool_DEFINED
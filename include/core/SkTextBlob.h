@@ -62,6 +62,23 @@ public:
     int getIntercepts(const SkScalar bounds[2], SkScalar intervals[],
                       const SkPaint* paint = nullptr) const;
 
+    /** Replaces the glyph IDs of all runs in place, keeping fonts and positions, and
+        returns true. glyphs supplies the new IDs for every run in blob order, and count
+        must equal the total glyph count. The blob behaves as a newly built one: bounds
+        are recomputed and uniqueID() changes, so cached state keyed to the old ID is
+        dropped.
+
+        Fails (returning false, leaving the blob untouched) if the blob is not uniquely
+        referenced, or if count does not match. Intended for clients which rebuild many
+        short-lived blobs per frame with identical layout - e.g. terminal grids - to
+        avoid a round trip through SkTextBlobBuilder and its allocations.
+
+        @param glyphs  new glyph IDs, concatenated across runs
+        @param count   number of entries in glyphs
+        @return        true if the blob was updated
+    */
+    bool replaceGlyphs(const SkGlyphID glyphs[], int count);
+
     /** Creates SkTextBlob with a single run.
 
         font contains attributes used to define the run text.
@@ -256,8 +273,9 @@ private:
     friend class SkTextBlobPriv;
     friend class SkTextBlobRunIterator;
 
-    const SkRect                  fBounds;
-    const uint32_t                fUniqueID;
+    // Only mutated by replaceGlyphs(), which requires unique ownership.
+    SkRect                        fBounds;
+    uint32_t                      fUniqueID;
     mutable std::atomic<uint32_t> fCacheID;
 
     SkDEBUGCODE(size_t fStorageSize;)
@@ -485,6 +503,7 @@ private:
     static SkRect ConservativeRunBounds(const SkTextBlob::RunRecord&);
     static SkRect TightRunBounds(const SkTextBlob::RunRecord&);
 
+    friend class SkTextBlob; // for the run bounds helpers, in replaceGlyphs()
     friend class SkTextBlobPriv;
     friend class SkTextBlobBuilderPriv;
 
@@ -63,6 +63,9 @@ public:
         enum Flags {
             kArray_Flag         = 0x1,
             kSRGBUnpremul_Flag  = 0x2,
+            // The uniform is declared but never read by the program. It still occupies its slot
+            // in the uniform data block, but backends skip declaring and uploading it.
+            kUnused_Flag        = 0x4,
         };
 
         SkString  name;
@@ -72,6 +75,7 @@ public:
         uint32_t  flags;
 
         bool isArray() const { return SkToBool(this->flags & kArray_Flag); }
+        bool isUnused() const { return SkToBool(this->flags & kUnused_Flag); }
         size_t sizeInBytes() const;
     };
 
@@ -293,7 +297,11 @@ public:
                 SkDEBUGFAIL("Assigning to missing variable");
             } else if (sizeof(val) != fVar->sizeInBytes()) {
                 SkDEBUGFAIL("Incorrect value size");
-            } else {
+            } else if (0 != memcmp(SkTAddOffset<const void>(fOwner->uniformData(), fVar->offset),
+                                   &val, sizeof(val))) {
+                // Only copy (and invalidate any cached object built from the current block) when
+                // the value actually changed; per-frame animation code commonly re-assigns every
+                // uniform.
                 memcpy(SkTAddOffset<void>(fOwner->writableUniformData(), fVar->offset),
                        &val, sizeof(val));
             }
@@ -306,10 +314,15 @@ public:
             } else if (fVar->sizeInBytes() != 9 * sizeof(float)) {
                 SkDEBUGFAIL("Incorrect value size");
             } else {
-                float* data = SkTAddOffset<float>(fOwner->writableUniformData(), fVar->offset);
+                float data[9];
                 data[0] = val.get(0); data[1] = val.get(3); data[2] = val.get(6);
                 data[3] = val.get(1); data[4] = val.get(4); data[5] = val.get(7);
                 data[6] = val.get(2); data[7] = val.get(5); data[8] = val.get(8);
+                if (0 != memcmp(SkTAddOffset<const void>(fOwner->uniformData(), fVar->offset),
+                                data, sizeof(data))) {
+                    memcpy(SkTAddOffset<void>(fOwner->writableUniformData(), fVar->offset),
+                           data, sizeof(data));
+                }
             }
             return *this;
         }
@@ -323,7 +336,8 @@ public:
             } else if (sizeof(T) * count != fVar->sizeInBytes()) {
                 SkDEBUGFAIL("Incorrect value size");
                 return false;
-            } else {
+            } else if (0 != memcmp(SkTAddOffset<const void>(fOwner->uniformData(), fVar->offset),
+                                   val, sizeof(T) * count)) {
                 memcpy(SkTAddOffset<void>(fOwner->writableUniformData(), fVar->offset),
                        val, sizeof(T) * count);
             }
@@ -342,6 +356,7 @@ public:
                 SkDEBUGFAIL("Assigning to missing child");
             } else {
                 fOwner->fChildren[fChild->index] = std::forward<C>(val);
+                fOwner->fGenID++;
             }
             return *this;
         }
@@ -366,7 +381,13 @@ protected:
     explicit SkRuntimeEffectBuilder(sk_sp<SkRuntimeEffect> effect)
             : fEffect(std::move(effect))
             , fUniforms(SkData::MakeUninitialized(fEffect->uniformSize()))
-            , fChildren(fEffect->children().count()) {}
+            , fChildren(fEffect->children().count()) {
+        // Zero the uniform block so unset uniforms have deterministic values, and so assignments
+        // can compare against the current contents.
+        if (fUniforms->size()) {
+            memset(fUniforms->writable_data(), 0, fUniforms->size());
+        }
+    }
 
     SkRuntimeEffectBuilder(SkRuntimeEffectBuilder&&) = default;
     SkRuntimeEffectBuilder(const SkRuntimeEffectBuilder&) = default;
@@ -378,17 +399,25 @@ protected:
     Child* children() { return fChildren.data(); }
     size_t numChildren() { return fChildren.size(); }
 
+    // Changes every time a uniform or child is given a new value. Derived builders can compare
+    // this against the generation a cached object was built from to reuse it unchanged.
+    uint32_t genID() const { return fGenID; }
+
 private:
+    const void* uniformData() const { return fUniforms->data(); }
+
     void* writableUniformData() {
         if (!fUniforms->unique()) {
             fUniforms = SkData::MakeWithCopy(fUniforms->data(), fUniforms->size());
         }
+        fGenID++;
         return fUniforms->writable_data();
     }
 
     sk_sp<SkRuntimeEffect> fEffect;
     sk_sp<SkData>          fUniforms;
     std::vector<Child>     fChildren;
+    uint32_t               fGenID = 0;
 };
 
 /**
@@ -419,6 +448,8 @@ public:
     SkRuntimeShaderBuilder(const SkRuntimeShaderBuilder&) = default;
     ~SkRuntimeShaderBuilder();
 
+    // Returns the same SkShader as the previous call when no uniform or child has been given a
+    // new value in between, so per-frame callers only pay for the updates they actually make.
     sk_sp<SkShader> makeShader(const SkMatrix* localMatrix, bool isOpaque);
     sk_sp<SkImage> makeImage(GrRecordingContext*,
                              const SkMatrix* localMatrix,
@@ -427,6 +458,13 @@ public:
 
 private:
     using INHERITED = SkRuntimeEffectBuilder<sk_sp<SkShader>>;
+
+    // The most recently created shader and the state it was built from.
+    sk_sp<SkShader> fCachedShader;
+    SkMatrix        fCachedLocalMatrix = SkMatrix::I();
+    uint32_t        fCachedGenID = 0;
+    bool            fCachedHasLocalMatrix = false;
+    bool            fCachedIsOpaque = false;
 };
 
 /**
@@ -11,6 +11,7 @@
 #include "include/core/SkDataTable.h"
 #include "include/encode/SkEncoder.h"
 
+class SkExecutor;
 class SkPngEncoderMgr;
 class SkWStream;
 
@@ -59,6 +60,15 @@ public:
          *  and the (2i + 1)-th entry is the text for the i-th comment.
          */
         sk_sp<SkDataTable> fComments;
+
+        /**
+         *  If non-null, Encode() may split the image into independent horizontal slices and
+         *  filter and compress them in parallel on this executor.  Each slice ends with a
+         *  deflate full flush, so the output is a standard PNG that any decoder can read; the
+         *  flushes make it slightly larger than a serial encode.  Images too small to benefit
+         *  are encoded on the calling thread.  Ignored by Make().
+         */
+        SkExecutor* fExecutor = nullptr;
     };
 
     /**
@@ -34,6 +34,13 @@ namespace SkWebpEncoder {
          */
         Compression fCompression = Compression::kLossy;
         float fQuality = 100.0f;
+
+        /**
+         *  If true, request libwebp's multi-threaded encode (WebPConfig::thread_level).
+         *  This speeds up encoding large images on multi-core machines and does not affect
+         *  image quality.
+         */
+        bool fMultiThread = false;
     };
 
     /**
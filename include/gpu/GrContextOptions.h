@@ -149,6 +149,27 @@ struct SK_API GrContextOptions {
      */
     bool fDisableGpuYUVConversion = false;
 
+    /**
+     * If > 0, large codec-backed lazy images whose generator supports incremental decode are
+     * decoded in slices of this many rows, one slice per texture lock, instead of blocking the
+     * first draw on a whole-image decode. The texture's undecoded rows read as transparent
+     * until their slice arrives on a later frame.
+     */
+    int fProgressiveLazyImageDecodeRows = 0;
+
+    /**
+     * If true, ops task closing drops draws that are entirely covered by a later opaque draw
+     * within the same task. Helps UIs that repaint backgrounds underneath opaque panels.
+     */
+    bool fCullOccludedDraws = true;
+
+    /**
+     * If true (and the backend supports timestamp queries), each ops task's execution is
+     * bracketed with GPU timestamps and the resolved timings can be polled via
+     * GrDirectContext::pollGpuTaskTimings(). Cheap enough to leave on for sampled profiling.
+     */
+    bool fEnableGpuTimestampQueries = false;
+
     /**
      * The maximum size of cache textures used for Skia's Glyph cache.
      */
@@ -171,6 +192,15 @@ struct SK_API GrContextOptions {
     float fGlyphsAsPathsFontSize = 324;
 #endif
 
+    /**
+     * If true, cached text blobs drawn from the glyph atlas are reused under any pure
+     * translation with glyph positions snapped to the nearest device pixel. Masks can land up
+     * to half a pixel from their true positions, but scrolling at non-integer offsets no
+     * longer regenerates every blob. Distance field text is already translation invariant and
+     * is unaffected.
+     */
+    bool fSnapTextBlobsToPixel = false;
+
     /**
      * Can the glyph atlas use multiple textures. If allowed, the each texture's size is bound by
      * fGlypheCacheTextureMaximumBytes.
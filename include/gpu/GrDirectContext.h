@@ -10,11 +10,14 @@
 
 #include "include/gpu/GrRecordingContext.h"
 
+#include "include/core/SkString.h"
 #include "include/gpu/GrBackendSurface.h"
 
 // We shouldn't need this but currently Android is relying on this being include transitively.
 #include "include/core/SkUnPreMultiply.h"
 
+#include <vector>
+
 class GrAtlasManager;
 class GrBackendSemaphore;
 class GrClientMappedBufferManager;
@@ -37,6 +40,7 @@ class GrSwizzle;
 class GrTextureProxy;
 struct GrVkBackendContext;
 
+class SkExecutor;
 class SkImage;
 class SkString;
 class SkSurfaceCharacterization;
@@ -118,6 +122,14 @@ public:
      * be called frequently for good performance.
      * The flag bits, state, is dependent on which backend is used by the
      * context, either GL or D3D (possible in future).
+     *
+     * Clients interoperating with their own rendering code should declare only the state they
+     * actually modified rather than defaulting to kAll_GrBackendState. E.g. a GL-based engine
+     * that binds its own textures and shader program between Skia draws should pass
+     * kTextureBinding_GrGLBackendState | kProgram_GrGLBackendState. Resetting everything
+     * forces the context to re-send all state and defeats its redundant-bind filtering; the
+     * redundant_texture_binds/redundant_program_binds GPU stats can be used to gauge how much
+     * state is being resent unnecessarily.
      */
     void resetContext(uint32_t state = kAll_GrBackendState);
 
@@ -244,6 +256,98 @@ public:
      */
     void setResourceCacheLimit(size_t maxResourceBytes);
 
+    /**
+     *  Sets a watermark, in bytes of video memory, below the resource cache limit. When set,
+     *  performDeferredCleanup() additionally purges the cache (LRU) down to the watermark, so
+     *  that clients which call it between frames leave headroom for the next frame's allocations
+     *  instead of forcing the cache to free resources reactively in the middle of a flush.
+     *
+     *  @param watermarkBytes The pre-eviction target, in bytes. Zero (the default) disables
+     *                        pre-eviction and the near-budget callback.
+     */
+    void setResourceCachePurgeWatermark(size_t watermarkBytes);
+
+    /**
+     *  Registers a named budget partition in the resource cache and returns its id. Partitions
+     *  let multiple clients share one context without one client's allocation storm evicting
+     *  another's working set: resources created while a partition is selected (see
+     *  setResourceCachePartition()) count against that partition's byte quota in addition to the
+     *  global budget, and when a partition exceeds its quota only its own resources are purged
+     *  (LRU). A maxBytes of zero means the partition is tracked but has no quota. Partition 0 is
+     *  the default partition and always exists.
+     */
+    uint32_t createResourceCachePartition(const char* name, size_t maxBytes);
+
+    /**
+     *  Selects the partition that subsequently created resources are accounted against. Pass 0
+     *  to return to the default partition. Typically called before rendering each client's
+     *  content.
+     */
+    void setResourceCachePartition(uint32_t partition);
+
+    /**
+     *  Changes a partition's byte quota, purging that partition immediately if it is now over.
+     */
+    void setResourceCachePartitionLimit(uint32_t partition, size_t maxBytes);
+
+    /**
+     *  Reports a partition's current budgeted bytes and the total bytes evicted from it because
+     *  it was over quota. Either out-param may be null. Returns false for an unknown partition.
+     */
+    bool getResourceCachePartitionUsage(uint32_t partition,
+                                        size_t* budgetedBytes,
+                                        size_t* purgedBytes) const;
+
+    /**
+     *  Returns the maximum number of bytes of GPU memory the glyph atlases may use, as currently
+     *  in effect.
+     */
+    size_t getGlyphCacheTextureMaximumBytes() const;
+
+    /**
+     *  Specify the maximum number of bytes of GPU memory the glyph atlases may use, overriding
+     *  GrContextOptions::fGlyphCacheTextureMaximumBytes on a live context. Takes effect
+     *  immediately: the current atlas pages are dropped and repopulate lazily at the new sizes
+     *  as subsequent text draws flush, so no context recreation is required.
+     */
+    void setGlyphCacheTextureMaximumBytes(size_t maxBytes);
+
+    /**
+     *  Returns the buffer size in bytes above which geometry buffer updates are performed by
+     *  mapping rather than by CPU staging and updateData, as currently in effect. Reflects
+     *  GrContextOptions::fBufferMapThreshold, the backend default, or a runtime override.
+     */
+    size_t getBufferMapThreshold() const;
+
+    /**
+     *  Override the buffer-map threshold on a live context. Takes effect on the next buffer
+     *  update. Pass a negative value to restore the value chosen at context creation.
+     */
+    void setBufferMapThreshold(int threshold);
+
+    /**
+     *  Registers a callback that fires when the cache's budgeted bytes rise to the watermark set
+     *  by setResourceCachePurgeWatermark(), as an early warning that the current working set is
+     *  approaching the budget. It fires at most once per crossing, re-arming when usage drops
+     *  back below the watermark. The callback is invoked while the cache is updating, so it must
+     *  only record the signal (e.g. schedule a performDeferredCleanup()) and must not call back
+     *  into the context.
+     *
+     *  @param proc    The callback, or nullptr to remove a previously registered callback.
+     *  @param context An opaque pointer passed back to the callback.
+     */
+    using ResourceCacheNearBudgetProc = void (*)(void* context,
+                                                 size_t budgetedBytes,
+                                                 size_t budgetLimit);
+    void setResourceCacheNearBudgetProc(ResourceCacheNearBudgetProc proc, void* context);
+
+    /**
+     *  Returns the cumulative number of bytes the cache has freed because it was over budget,
+     *  i.e. reactively, typically in the middle of a flush. Sampling this once per frame and
+     *  diffing gives a per-frame measure of eviction work that contributed to frame time.
+     */
+    size_t getResourceCacheOverbudgetPurgeBytes() const;
+
     /**
      * Frees GPU created by the context. Can be called to reduce GPU memory
      * pressure.
@@ -298,6 +402,16 @@ public:
      */
     void purgeUnlockedResources(bool scratchResourcesOnly);
 
+    /**
+     * Hints that the client will issue a steady stream of async read pixels requests (e.g.
+     * SkSurface::asyncRescaleAndReadPixels for video composition) and that up to 'maxBuffers'
+     * finished GPU transfer buffers should be retained for reuse by later requests, rather than
+     * each request allocating its own buffer. With a large enough pool, steady-state readbacks
+     * perform no buffer allocation. Pass 0 (the default) to disable reuse and release any
+     * retained buffers.
+     */
+    void setAsyncReadPixelsBufferPoolSize(int maxBuffers);
+
     /**
      * Gets the maximum supported texture size.
      */
@@ -796,11 +910,33 @@ public:
     // Using cached shader blobs on a different device or driver are undefined.
     bool precompileShader(const SkData& key, const SkData& data);
 
+    // As precompileShader(), for a batch of key/data pairs. If executor is non-null, backends
+    // that support it (currently GL) run the SkSL translation stage of each compile on the
+    // executor's threads; the driver calls always stay on the calling thread, which must be the
+    // context thread. Note that the GrContextOptions::ShaderErrorHandler may then be invoked
+    // from the executor's threads. Returns the number of shaders successfully compiled.
+    int precompileShaders(const sk_sp<SkData> keys[], const sk_sp<SkData> datas[], int count,
+                          SkExecutor* executor);
+
 #ifdef SK_ENABLE_DUMP_GPU
     /** Returns a string with detailed information about the context & GPU, in JSON format. */
     SkString dump() const;
 #endif
 
+    /** GPU time measured for one ops task. See pollGpuTaskTimings(). */
+    struct GpuTaskTiming {
+        SkString fName;     // names the task's ops
+        uint64_t fGpuNanos; // GPU time between the task's bracketing timestamps
+    };
+
+    /**
+     * When GrContextOptions::fEnableGpuTimestampQueries is set (and the backend supports
+     * timestamp queries), each ops task executed during a flush is bracketed with GPU
+     * timestamps. This call appends any timings whose queries have resolved since the last call
+     * to 'results'; still-pending timings stay queued for a later poll.
+     */
+    void pollGpuTaskTimings(std::vector<GpuTaskTiming>* results);
+
     class DirectContextID {
     public:
         static GrDirectContext::DirectContextID Next();
@@ -848,6 +984,16 @@ private:
     // bool is used for this signal.
     void syncAllOutstandingGpuWork(bool shouldExecuteWhileAbandoned);
 
+    // An ops task timing whose bracketing timestamp queries haven't resolved yet.
+    struct PendingGpuTaskTiming {
+        SkString fName;
+        uint64_t fBegin;
+        uint64_t fEnd;
+    };
+
+    // Deletes the pending timings' backend queries. Requires fGpu to still be connected.
+    void deletePendingGpuTaskTimings();
+
     const DirectContextID                   fDirectContextID;
     // fTaskGroup must appear before anything that uses it (e.g. fGpu), so that it is destroyed
     // after all of its users. Clients of fTaskGroup will generally want to ensure that they call
@@ -869,8 +1015,14 @@ private:
     std::unique_ptr<GrClientMappedBufferManager> fMappedBufferManager;
     std::unique_ptr<GrAtlasManager> fAtlasManager;
 
+    // Live-tunable copies of GrContextOptions values; see the setters above.
+    size_t                                  fGlyphCacheTextureMaximumBytes = 0;
+    int                                     fBufferMapThresholdOverride = -1;
+
     std::unique_ptr<GrSmallPathAtlasMgr> fSmallPathAtlasMgr;
 
+    std::vector<PendingGpuTaskTiming> fPendingGpuTaskTimings;
+
     friend class GrDirectContextPriv;
 
     using INHERITED = GrRecordingContext;
@@ -245,6 +245,18 @@ protected:
     };
 
     DMSAAStats fDMSAAStats;
+
+    struct PathRendererStats {
+        void dumpKeyValuePairs(SkTArray<SkString>* keys, SkTArray<double>* values) const;
+        void dump() const;
+        void merge(const PathRendererStats&);
+        // Maps "<renderer name>/<shape class>" to the number of times getPathRenderer() made
+        // that selection. The chain's routing heuristics are static; this tally exposes, on
+        // real content, which classes of shapes land on which renderer when tuning them.
+        std::map<std::string, int> fSelectionCounts;
+    };
+
+    PathRendererStats fPathRendererStats;
 #endif
 
     Stats* stats() { return &fStats; }
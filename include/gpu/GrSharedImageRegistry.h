@@ -0,0 +1,61 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef GrSharedImageRegistry_DEFINED
+#define GrSharedImageRegistry_DEFINED
+
+#include "include/core/SkImage.h"
+#include "include/core/SkRefCnt.h"
+#include "include/private/SkMutex.h"
+#include "include/private/SkTHash.h"
+
+class GrDirectContext;
+struct SkPixmap;
+
+/**
+ * Deduplicates image uploads between GrDirectContexts whose backend contexts share resources
+ * (e.g. GL contexts in one share group). Clients that run one GrDirectContext per window but
+ * draw the same decoded images in several of them can register each image once under a key of
+ * their choosing; every context then wraps the single uploaded texture instead of re-uploading
+ * the pixels.
+ *
+ * Images are created with SkImage::MakeCrossContextFromPixmap, so their backing texture is
+ * refcounted across consuming contexts and is returned to the uploading context's cache for
+ * deletion once the last context is done with it. All contexts given to one registry must be in
+ * the same share group; the registry cannot verify this. Synchronization between the uploading
+ * context's flush and draws on other contexts follows the backend's share-group semantics.
+ *
+ * All methods are safe to call from multiple threads.
+ */
+class SK_API GrSharedImageRegistry : public SkRefCnt {
+public:
+    static sk_sp<GrSharedImageRegistry> Make();
+
+    /**
+     * Returns the image registered under 'key', uploading it from 'pixmap' on 'dContext' if this
+     * is the first request for that key. The pixmap is only inspected on a miss. Returns nullptr
+     * if the upload fails and nothing is registered yet.
+     */
+    sk_sp<SkImage> findOrMakeCrossContextImage(GrDirectContext* dContext, const SkPixmap& pixmap,
+                                               uint32_t key, bool buildMips);
+
+    /**
+     * Drops entries whose images are no longer referenced outside the registry, letting their
+     * textures be deleted once any outstanding GPU work completes.
+     */
+    void purgeUnreferenced();
+
+    int count() const;
+
+private:
+    GrSharedImageRegistry() = default;
+
+    mutable SkMutex fMutex;
+    SkTHashMap<uint32_t, sk_sp<SkImage>> fImages SK_GUARDED_BY(fMutex);
+};
+
+#endif
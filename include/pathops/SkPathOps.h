@@ -7,10 +7,12 @@
 #ifndef SkPathOps_DEFINED
 #define SkPathOps_DEFINED
 
+#include "include/core/SkScalar.h"
 #include "include/core/SkTypes.h"
 #include "include/private/SkTArray.h"
 #include "include/private/SkTDArray.h"
 
+class SkExecutor;
 class SkPath;
 struct SkRect;
 
@@ -45,6 +47,26 @@ enum SkPathOp {
   */
 bool SK_API Op(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result);
 
+/** Like Op(), but with bounded latency. Near-degenerate inputs can push the exact operation
+    into quadratic behavior; here the work is capped at roughly budget segment-pair
+    intersections. When the cap is hit (or the exact operation fails for any other reason),
+    the result is instead approximated by scan-converting both operands on a grid resolution
+    times finer than their coordinate space and applying a region boolean, and
+    wasApproximated (if non-null) is set to true. The approximate boundary is axis-aligned at
+    grid granularity, which is generally fine for hit testing but not for display.
+
+    @param one The first operand (for difference, the minuend)
+    @param two The second operand (for difference, the subtrahend)
+    @param op The operator to apply.
+    @param result The product of the operands. The result may be one of the inputs.
+    @param budget Cap on exact-op work; zero or negative runs Op() unbudgeted.
+    @param resolution Grid scale of the approximate fallback; must be positive.
+    @param wasApproximated If non-null, set to whether the fallback produced the result.
+    @return True if either the exact or the approximate operation succeeded.
+  */
+bool SK_API OpBudgeted(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result,
+                       int budget, SkScalar resolution, bool* wasApproximated = nullptr);
+
 /** Set this path to a set of non-overlapping contours that describe the
     same area as the original path.
     The curve order is reduced where possible so that cubics may
@@ -101,6 +123,16 @@ public:
       */
     bool resolve(SkPath* result);
 
+    /** As resolve(), but when the paths are a pure union, runs the independent
+        per-path simplification passes on executor's threads. Passing nullptr is
+        equivalent to resolve(result).
+
+        @param result The product of the operands.
+        @param executor Runs per-path work; the final combine stays on the caller.
+        @return True if the operation succeeded.
+      */
+    bool resolve(SkPath* result, SkExecutor* executor);
+
 private:
     SkTArray<SkPath> fPathRefs;
     SkTDArray<SkPathOp> fOps;
@@ -19,6 +19,47 @@
 
 uint32_t GrResourceKeyHash(const uint32_t* data, size_t size);
 
+/**
+ * Inline uint32_t capacity for resource key data (beyond the meta-data words). Keys at or under
+ * this word count never heap-allocate. bmp textures require 5 words; image and blur mask keys
+ * commonly run longer, so the default is sized to cover those too. Overridable for
+ * memory-constrained builds.
+ */
+#ifndef GR_RESOURCE_KEY_INLINE_DATA32_CNT
+#define GR_RESOURCE_KEY_INLINE_DATA32_CNT 12
+#endif
+
+/**
+ * Hashes key contents. Keys of a few words are the overwhelmingly common case, so they are mixed
+ * inline (murmur3 rounds) rather than paying the dispatch through SkOpts::hash. The two paths
+ * need not produce equal values: a key's size picks its path deterministically, so equal keys
+ * always hash alike.
+ */
+static inline uint32_t GrResourceKeyHashInline(const uint32_t* data, size_t size) {
+    SkASSERT(SkIsAlign4(size));
+    size_t count = size / sizeof(uint32_t);
+    if (count > 8) {
+        return GrResourceKeyHash(data, size);
+    }
+    uint32_t hash = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t k = data[i];
+        k *= 0xcc9e2d51;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1b873593;
+        hash ^= k;
+        hash = (hash << 13) | (hash >> 19);
+        hash = hash*5 + 0xe6546b64;
+    }
+    hash ^= SkToU32(size);
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
 /**
  * Base class for all GrGpuResource cache keys. There are two types of cache keys. Refer to the
  * comments for each key type below.
@@ -46,7 +87,7 @@ public:
                 return;
             }
             uint32_t* hash = &fKey->fKey[kHash_MetaDataIdx];
-            *hash = GrResourceKeyHash(hash + 1, fKey->internalSize() - sizeof(uint32_t));
+            *hash = GrResourceKeyHashInline(hash + 1, fKey->internalSize() - sizeof(uint32_t));
             fKey->validate();
             fKey = nullptr;
         }
@@ -152,15 +193,14 @@ private:
     void validate() const {
         SkASSERT(this->isValid());
         SkASSERT(fKey[kHash_MetaDataIdx] ==
-                 GrResourceKeyHash(&fKey[kHash_MetaDataIdx] + 1,
-                                   this->internalSize() - sizeof(uint32_t)));
+                 GrResourceKeyHashInline(&fKey[kHash_MetaDataIdx] + 1,
+                                         this->internalSize() - sizeof(uint32_t)));
         SkASSERT(SkIsAlign4(this->internalSize()));
     }
 
     friend class TestResource;  // For unit test to access kMetaDataCnt.
 
-    // bmp textures require 5 uint32_t values.
-    SkAutoSTMalloc<kMetaDataCnt + 5, uint32_t> fKey;
+    SkAutoSTMalloc<kMetaDataCnt + GR_RESOURCE_KEY_INLINE_DATA32_CNT, uint32_t> fKey;
 };
 
 /**
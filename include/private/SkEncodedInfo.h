@@ -22,11 +22,18 @@ public:
         static std::unique_ptr<ICCProfile> Make(const skcms_ICCProfile&);
 
         const skcms_ICCProfile* profile() const { return &fProfile; }
+
+        // The SkColorSpace equivalent of profile(), classified once when the profile was created
+        // and shared between all codecs decoding the same profile bytes. May be nullptr for
+        // profiles SkColorSpace cannot represent.
+        sk_sp<SkColorSpace> makeColorSpace() const { return fColorSpace; }
     private:
-        ICCProfile(const skcms_ICCProfile&, sk_sp<SkData> = nullptr);
+        ICCProfile(const skcms_ICCProfile&, sk_sp<SkData> = nullptr,
+                   sk_sp<SkColorSpace> = nullptr);
 
-        skcms_ICCProfile fProfile;
-        sk_sp<SkData>    fData;
+        skcms_ICCProfile    fProfile;
+        sk_sp<SkData>       fData;
+        sk_sp<SkColorSpace> fColorSpace;
     };
 
     enum Alpha {
@@ -165,8 +172,7 @@ public:
                                            kN32_SkColorType      ;
         auto alpha = kOpaque_Alpha == fAlpha ? kOpaque_SkAlphaType
                                              : kUnpremul_SkAlphaType;
-        sk_sp<SkColorSpace> cs = fProfile ? SkColorSpace::Make(*fProfile->profile())
-                                          : nullptr;
+        sk_sp<SkColorSpace> cs = fProfile ? fProfile->makeColorSpace() : nullptr;
         if (!cs) {
             cs = SkColorSpace::MakeSRGB();
         }
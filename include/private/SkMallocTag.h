@@ -0,0 +1,60 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkMallocTag_DEFINED
+#define SkMallocTag_DEFINED
+
+#include "include/core/SkTypes.h"
+
+/**
+ *  Subsystem tags for the optional allocation-accounting layer behind sk_malloc().
+ *
+ *  When Skia is built with SK_MALLOC_ACCOUNTING, every block returned by sk_malloc() is
+ *  attributed to the tag that was in scope on the allocating thread, and the live byte
+ *  total per tag can be queried with SkGraphics::GetAllocationBytesForTag(). Without the
+ *  define, tag scopes compile away and the query always returns zero.
+ */
+enum class SkMallocTag {
+    kUntagged,   // no subsystem scope was active at the allocation site
+    kText,       // glyph caches and scaler contexts
+    kPathOps,    // boolean path operations
+    kCodec,      // image decoding
+    kGpu,        // CPU-side bookkeeping for the GPU backend
+
+    kLast = kGpu,
+};
+static constexpr int kSkMallocTagCount = static_cast<int>(SkMallocTag::kLast) + 1;
+
+#ifdef SK_MALLOC_ACCOUNTING
+SkMallocTag sk_malloc_tag_current();
+void sk_malloc_tag_set_current(SkMallocTag);
+
+// Called by the memory port to maintain the per-tag live byte counts.
+void sk_malloc_tag_note_alloc(SkMallocTag, size_t bytes);
+void sk_malloc_tag_note_free(SkMallocTag, size_t bytes);
+size_t sk_malloc_tag_live_bytes(SkMallocTag);
+#endif
+
+/** Attributes sk_malloc() allocations made on this thread to 'tag' while in scope. */
+class SkAutoMallocTag {
+public:
+#ifdef SK_MALLOC_ACCOUNTING
+    SkAutoMallocTag(SkMallocTag tag) : fPrevious(sk_malloc_tag_current()) {
+        sk_malloc_tag_set_current(tag);
+    }
+    ~SkAutoMallocTag() {
+        sk_malloc_tag_set_current(fPrevious);
+    }
+
+private:
+    SkMallocTag fPrevious;
+#else
+    SkAutoMallocTag(SkMallocTag) {}
+#endif
+};
+
+#endif  // SkMallocTag_DEFINED
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkAsyncWStream_DEFINED
+#define SkAsyncWStream_DEFINED
+
+#include "include/core/SkStream.h"
+
+#include <memory>
+
+class SkExecutor;
+
+/**
+ *  Specialized stream that writes behind its producer on an executor, double-buffering bytes on
+ *  their way to the wrapped stream. Producers that feed slow sinks (fsync-heavy network
+ *  filesystems under an SkFILEWStream) overlap the sink's stalls with their own work — e.g. PDF
+ *  serialization via SkPDFDocument — instead of blocking on every write.
+ */
+class SK_API SkAsyncWStream {
+public:
+    /**
+     *  Creates a stream that buffers writes and hands them to 'stream' in the background.
+     *
+     *  @param stream The stream to write behind. Must not be used directly once this call
+     *      succeeds; it is written from the executor's threads and deleted with the adapter.
+     *  @param bufferSize Total buffer footprint in bytes. The producer fills one half while the
+     *      other half drains in the background, so at most bufferSize / 2 bytes are handed to
+     *      the wrapped stream at a time.
+     *  @param executor Where writes run; nullptr uses SkExecutor::GetDefault(). With the default
+     *      inline executor the adapter degrades to plain synchronous buffering, so pass (or
+     *      install) a threaded executor to actually overlap sink latency.
+     *  @return The wrapping stream, or nullptr if stream is nullptr.
+     *
+     *  flush() pushes out any buffered bytes, waits for the background write to land, and then
+     *  flushes the wrapped stream, so the usual "flush before reading the file" contract still
+     *  holds. A failed background write makes all subsequent write() calls return false.
+     */
+    static std::unique_ptr<SkWStream> Make(std::unique_ptr<SkWStream> stream,
+                                           size_t bufferSize,
+                                           SkExecutor* executor = nullptr);
+};
+
+#endif  // SkAsyncWStream_DEFINED
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkBatchRenderer_DEFINED
+#define SkBatchRenderer_DEFINED
+
+#include "include/core/SkColor.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkRefCnt.h"
+
+#include <functional>
+
+class SkExecutor;
+
+/**
+ *  Renders a batch of pictures to raster images using all available cores, the way test drivers
+ *  like DM do internally but without the hand-rolled threading every heavy client reimplements.
+ *  Jobs run on an SkExecutor and share the process-wide font and resource caches, which are
+ *  already safe for concurrent raster use; surfaces are pooled between jobs of matching
+ *  configuration so a long batch doesn't churn allocations.
+ */
+class SK_API SkBatchRenderer {
+public:
+    struct Options {
+        /** Where jobs run; nullptr uses SkExecutor::GetDefault(). With the default inline
+            executor the batch renders serially on the calling thread. */
+        SkExecutor* fExecutor = nullptr;
+
+        /** Bytes of finished surfaces kept for reuse by later jobs with the same SkImageInfo.
+            Zero disables pooling; each job then allocates its own surface. */
+        size_t fSurfacePoolBudget = 64 * 1024 * 1024;
+    };
+
+    struct Job {
+        sk_sp<SkPicture> fPicture;
+        SkImageInfo      fInfo;
+        SkMatrix         fMatrix     = SkMatrix::I();     // applied before playback
+        SkColor          fClearColor = SK_ColorTRANSPARENT;
+    };
+
+    /** Called on a worker thread as each job finishes, in no particular order; must be safe to
+        call concurrently. The image is nullptr if the job's picture was missing or its surface
+        could not be created. */
+    using ResultProc = std::function<void(int index, sk_sp<SkImage>)>;
+
+    /** Called after each job completes with (completed, total); must be safe to call
+        concurrently. Useful for progress reporting on long batches. */
+    using ProgressProc = std::function<void(int completed, int total)>;
+
+    /** Renders jobs[0..count), calling resultProc for each, and returns once all jobs (and all
+        callbacks) have finished. progressProc may be nullptr. */
+    static void Render(const Job jobs[], int count,
+                       const ResultProc& resultProc,
+                       const ProgressProc& progressProc,
+                       const Options& options);
+
+    static void Render(const Job jobs[], int count,
+                       const ResultProc& resultProc,
+                       const ProgressProc& progressProc = nullptr) {
+        Render(jobs, count, resultProc, progressProc, Options());
+    }
+};
+
+#endif  // SkBatchRenderer_DEFINED
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkReadaheadStream_DEFINED
+#define SkReadaheadStream_DEFINED
+
+#include "include/core/SkStream.h"
+
+#include <memory>
+
+class SkExecutor;
+
+/**
+ *  Specialized stream that reads ahead of its consumer on an executor, double-buffering the
+ *  wrapped stream's bytes. Sources with bursty latency (network- or NFS-backed streams) overlap
+ *  their stalls with the consumer's work — e.g. image decoding via SkCodec — instead of blocking
+ *  the consuming thread on every read.
+ */
+class SK_API SkReadaheadStream {
+public:
+    /**
+     *  Creates a stream that wraps 'stream' and reads ahead of the consumer.
+     *
+     *  @param stream The stream to read ahead of. Must not be used directly once this call
+     *      succeeds; it is read from the executor's threads and deleted with the adapter.
+     *  @param bufferSize Total buffer footprint in bytes. Half is drained by the consumer while
+     *      the other half fills in the background, so at most bufferSize / 2 bytes are requested
+     *      from the wrapped stream at a time.
+     *  @param executor Where readahead runs; nullptr uses SkExecutor::GetDefault(). With the
+     *      default inline executor the adapter degrades to plain synchronous buffering, so pass
+     *      (or install) a threaded executor to actually overlap source latency.
+     *  @return The wrapping stream, or nullptr if stream is nullptr.
+     */
+    static std::unique_ptr<SkStream> Make(std::unique_ptr<SkStream> stream,
+                                          size_t bufferSize,
+                                          SkExecutor* executor = nullptr);
+};
+
+#endif  // SkReadaheadStream_DEFINED
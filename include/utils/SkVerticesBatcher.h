@@ -0,0 +1,66 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkVerticesBatcher_DEFINED
+#define SkVerticesBatcher_DEFINED
+
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkVertices.h"
+#include "include/private/SkTArray.h"
+
+class SkCanvas;
+
+/**
+ *  Accumulates several SkVertices that share one paint into a single SkVertices, drawn with one
+ *  drawVertices call. Each append records a per-mesh transform that is baked into the positions
+ *  when the batch is built, so many small meshes (e.g. one per particle emitter) become one GPU
+ *  op instead of one op each.
+ *
+ *  Only kTriangles_VertexMode meshes can be concatenated, and every appended mesh must agree on
+ *  whether it has texCoords and colors (the first append decides). If any appended mesh is
+ *  indexed, the batch is built indexed, so its total vertex count is limited to 65536; append()
+ *  rejects anything that doesn't fit, at which point the caller should draw the batch and start
+ *  a new one.
+ */
+class SK_API SkVerticesBatcher {
+public:
+    SkVerticesBatcher() = default;
+
+    /**
+     *  Appends 'vertices', to be transformed by 'matrix' when the batch is built. Returns false
+     *  (leaving the batch unchanged) if the mesh's mode or attributes don't match the batch, or
+     *  if an indexed batch would exceed 65536 vertices.
+     */
+    bool append(sk_sp<SkVertices> vertices, const SkMatrix& matrix);
+
+    bool empty() const { return fEntries.empty(); }
+    void reset();
+
+    /**
+     *  Builds one SkVertices holding everything appended so far, and resets the batcher.
+     *  Returns nullptr if the batch is empty.
+     */
+    sk_sp<SkVertices> detach();
+
+    /** Convenience: detach() and draw the result with the given blend mode and paint. */
+    void draw(SkCanvas*, SkBlendMode, const SkPaint&);
+
+private:
+    struct Entry {
+        sk_sp<SkVertices> fVertices;
+        SkMatrix          fMatrix;
+    };
+
+    SkSTArray<8, Entry> fEntries;
+    int  fVertexCount  = 0;
+    bool fIndexed      = false;
+    bool fHasTexCoords = false;
+    bool fHasColors    = false;
+};
+
+#endif
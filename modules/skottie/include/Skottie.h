@@ -9,6 +9,7 @@
 #define Skottie_DEFINED
 
 #include "include/core/SkFontMgr.h"
+#include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkString.h"
@@ -21,7 +22,6 @@
 #include <vector>
 
 class SkCanvas;
-struct SkRect;
 class SkStream;
 
 namespace skjson { class ObjectValue; }
@@ -181,6 +181,28 @@ public:
     void render(SkCanvas* canvas, const SkRect* dst = nullptr) const;
     void render(SkCanvas* canvas, const SkRect* dst, RenderFlags) const;
 
+    /**
+     * Draws the current animation frame, restricted to |damage|, specified in intrinsic
+     * animation coordinates - e.g. currentFrameDamage().  Pixels outside the damage rect are
+     * left untouched, so incremental clients can composite only the changed region over the
+     * previously rendered frame.  An empty damage rect draws nothing.
+     *
+     * Tracked damage is reset only when |damage| covers it (it always does when passing
+     * currentFrameDamage()); otherwise the uncovered area remains pending for a later render.
+     */
+    void render(SkCanvas* canvas, const SkRect* dst, RenderFlags, const SkRect& damage) const;
+
+    /**
+     * Returns the cumulative damage rect accumulated by seek*() since the previous
+     * render() call, in intrinsic animation coordinates ([0, 0 .. size()]).
+     *
+     * The current frame content is guaranteed to differ from the previously rendered
+     * frame only within this (conservative) rect, so incremental clients can restrict
+     * clearing and repainting to its - suitably mapped - area.  The tracked damage
+     * resets on render().
+     */
+    const SkRect& currentFrameDamage() const { return fFrameDamage; }
+
     /**
      * [Deprecated: use one of the other versions.]
      *
@@ -244,6 +266,8 @@ private:
               SkString ver, const SkSize& size,
               double inPoint, double outPoint, double duration, double fps, uint32_t flags);
 
+    void render(SkCanvas*, const SkRect* dst, RenderFlags, const SkRect* damage) const;
+
     const std::unique_ptr<sksg::Scene>           fScene;
     const std::vector<sk_sp<internal::Animator>> fAnimators;
     const SkString                               fVersion;
@@ -254,6 +278,9 @@ private:
                                                  fFPS;
     const uint32_t                               fFlags;
 
+    // Damage accumulated by seek*() since the last render() - see currentFrameDamage().
+    mutable SkRect                               fFrameDamage = SkRect::MakeEmpty();
+
     using INHERITED = SkNVRefCnt<Animation>;
 };
 
@@ -509,13 +509,20 @@ sk_sp<sksg::RenderNode> LayerBuilder::buildRenderTree(const AnimationBuilder& ab
         layer = abuilder.attachOpacity(*jtransform, std::move(layer));
     }
 
+    const auto has_animators = !abuilder.fCurrentAnimatorScope->empty();
+
+    // Layers with no animating properties render identical content on every frame;
+    // draw them through a render cache, so static subtrees are not re-rasterized.
+    if (layer && !has_animators) {
+        layer = sksg::RenderCache::Make(std::move(layer));
+    }
+
     // Stash the content tree in case it is needed for later mattes.
     fContentTree = layer;
     if (ParseDefault<bool>(fJlayer["hd"], false)) {
         layer = nullptr;
     }
 
-    const auto has_animators    = !abuilder.fCurrentAnimatorScope->empty();
     const auto force_seek_count = build_info.fFlags & kForceSeek
             ? abuilder.fCurrentAnimatorScope->size()
             : fTransformAnimatorCount;
@@ -464,11 +464,26 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR) const {
 }
 
 void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags) const {
+    this->render(canvas, dstR, renderFlags, nullptr);
+}
+
+void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags,
+                       const SkRect& damageR) const {
+    this->render(canvas, dstR, renderFlags, &damageR);
+}
+
+void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags,
+                       const SkRect* damageR) const {
     TRACE_EVENT0("skottie", TRACE_FUNC);
 
     if (!fScene)
         return;
 
+    if (damageR && damageR->isEmpty()) {
+        // Nothing changed; the previously rendered frame is still current.
+        return;
+    }
+
     SkAutoCanvasRestore restore(canvas, true);
 
     const SkRect srcR = SkRect::MakeSize(this->size());
@@ -476,6 +491,10 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderF
         canvas->concat(SkMatrix::RectToRect(srcR, *dstR, SkMatrix::kCenter_ScaleToFit));
     }
 
+    if (damageR) {
+        canvas->clipRect(*damageR);
+    }
+
     if (!(renderFlags & RenderFlag::kDisableTopLevelClipping)) {
         canvas->clipRect(srcR);
     }
@@ -488,6 +507,12 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderF
     }
 
     fScene->render(canvas);
+
+    // The rendered content is now in sync with the scene within the damage clip - reset damage
+    // tracking when it is fully covered.
+    if (!damageR || damageR->contains(fFrameDamage)) {
+        fFrameDamage.setEmpty();
+    }
 }
 
 void Animation::seekFrame(double t, sksg::InvalidationController* ic) {
@@ -504,7 +529,17 @@ void Animation::seekFrame(double t, sksg::InvalidationController* ic) {
         anim->seek(comp_time);
     }
 
-    fScene->revalidate(ic);
+    // Revalidate through a local controller to track frame-to-frame damage
+    // (the client-provided |ic| is optional, and can hold unrelated state).
+    sksg::InvalidationController frame_ic;
+    fScene->revalidate(&frame_ic);
+    fFrameDamage.join(frame_ic.bounds());
+
+    if (ic) {
+        for (const auto& rect : frame_ic) {
+            ic->inval(rect);
+        }
+    }
 }
 
 void Animation::seekFrameTime(double t, sksg::InvalidationController* ic) {
@@ -7,7 +7,9 @@
 
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkMatrix.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkStream.h"
+#include "include/core/SkSurface.h"
 #include "include/core/SkTextBlob.h"
 #include "include/core/SkTypeface.h"
 #include "modules/skottie/include/Skottie.h"
@@ -864,3 +866,144 @@ DEF_TEST(Skottie_Image_Loading, reporter) {
         REPORTER_ASSERT(reporter, SkScalarNearlyEqual(multi_asset->requestedFrames()[1], 2));
     }
 }
+
+DEF_TEST(Skottie_FrameDamage, reporter) {
+    // Two solid layers: the top (red) one deactivates at frame 50,
+    // the bottom (green) one is fully static.
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 100,
+             "h": 100,
+             "fr": 10,
+             "ip": 0,
+             "op": 100,
+             "layers": [
+               {
+                 "ty": 1,
+                 "ind": 0,
+                 "ip": 0,
+                 "op": 50,
+                 "sw": 20,
+                 "sh": 20,
+                 "sc": "#ff0000",
+                 "ks": {}
+               },
+               {
+                 "ty": 1,
+                 "ind": 1,
+                 "ip": 0,
+                 "op": 100,
+                 "sw": 100,
+                 "sh": 100,
+                 "sc": "#00ff00",
+                 "ks": {}
+               }
+             ]
+           })";
+
+    auto animation = Animation::Make(json, strlen(json));
+    REPORTER_ASSERT(reporter, animation);
+
+    // The initial seek invalidates the full scene.
+    animation->seekFrame(0);
+    REPORTER_ASSERT(reporter, !animation->currentFrameDamage().isEmpty());
+
+    auto surface = SkSurface::MakeRasterN32Premul(100, 100);
+    const auto pixel = [&](int x, int y) {
+        SkPixmap pmap;
+        SkAssertResult(surface->peekPixels(&pmap));
+        return pmap.getColor(x, y);
+    };
+
+    animation->render(surface->getCanvas());
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage().isEmpty());
+    REPORTER_ASSERT(reporter, pixel(10, 10) == 0xffff0000);
+    REPORTER_ASSERT(reporter, pixel(90, 90) == 0xff00ff00);
+
+    // Nothing changes while both layers stay active.
+    animation->seekFrame(10);
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage().isEmpty());
+
+    // Deactivating the top layer damages its bounds only.
+    animation->seekFrame(60);
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage() == SkRect::MakeWH(20, 20));
+
+    animation->render(surface->getCanvas());
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage().isEmpty());
+    REPORTER_ASSERT(reporter, pixel(10, 10) == 0xff00ff00);
+    REPORTER_ASSERT(reporter, pixel(90, 90) == 0xff00ff00);
+}
+
+DEF_TEST(Skottie_RenderDamageClip, reporter) {
+    // Same structure as Skottie_FrameDamage: a red 20x20 layer deactivating at frame 50 over a
+    // static green background.
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 100,
+             "h": 100,
+             "fr": 10,
+             "ip": 0,
+             "op": 100,
+             "layers": [
+               {
+                 "ty": 1,
+                 "ind": 0,
+                 "ip": 0,
+                 "op": 50,
+                 "sw": 20,
+                 "sh": 20,
+                 "sc": "#ff0000",
+                 "ks": {}
+               },
+               {
+                 "ty": 1,
+                 "ind": 1,
+                 "ip": 0,
+                 "op": 100,
+                 "sw": 100,
+                 "sh": 100,
+                 "sc": "#00ff00",
+                 "ks": {}
+               }
+             ]
+           })";
+
+    auto animation = Animation::Make(json, strlen(json));
+    REPORTER_ASSERT(reporter, animation);
+
+    auto surface = SkSurface::MakeRasterN32Premul(100, 100);
+    const auto pixel = [&](int x, int y) {
+        SkPixmap pmap;
+        SkAssertResult(surface->peekPixels(&pmap));
+        return pmap.getColor(x, y);
+    };
+
+    animation->seekFrame(0);
+    animation->render(surface->getCanvas());
+
+    animation->seekFrame(60);
+    const auto damage = animation->currentFrameDamage();
+    REPORTER_ASSERT(reporter, damage == SkRect::MakeWH(20, 20));
+
+    // Poison the buffer to prove the damage-clipped render leaves the rest untouched.
+    surface->getCanvas()->clear(SK_ColorMAGENTA);
+
+    // A damage rect which doesn't cover the tracked damage keeps it pending.
+    animation->render(surface->getCanvas(), nullptr, 0, SkRect::MakeWH(10, 10));
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage() == damage);
+    REPORTER_ASSERT(reporter, pixel( 5,  5) == 0xff00ff00);
+    REPORTER_ASSERT(reporter, pixel(15, 15) == 0xffff00ff);
+
+    // Rendering with the full tracked damage resets it and only touches the clip.
+    animation->render(surface->getCanvas(), nullptr, 0, damage);
+    REPORTER_ASSERT(reporter, animation->currentFrameDamage().isEmpty());
+    REPORTER_ASSERT(reporter, pixel(15, 15) == 0xff00ff00);
+    REPORTER_ASSERT(reporter, pixel(50, 50) == 0xffff00ff);
+
+    // An empty damage rect draws nothing.
+    surface->getCanvas()->clear(SK_ColorMAGENTA);
+    animation->render(surface->getCanvas(), nullptr, 0, SkRect::MakeEmpty());
+    REPORTER_ASSERT(reporter, pixel(50, 50) == 0xffff00ff);
+}
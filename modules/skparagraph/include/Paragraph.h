@@ -8,6 +8,7 @@
 #include "modules/skparagraph/include/TextStyle.h"
 
 class SkCanvas;
+class SkExecutor;
 
 namespace skia {
 namespace textlayout {
@@ -37,6 +38,17 @@ public:
 
     virtual void layout(SkScalar width) = 0;
 
+    // Lays out a batch of independent paragraphs at the given width, fanning the work
+    // out to |executor| when provided (and laying out serially otherwise).
+    //
+    // The paragraphs may share one - effectively read-only - FontCollection: its
+    // internal caches are thread-safe, and shaping results are reused across the
+    // batch (and across re-layouts) via the collection's ParagraphCache.  Each
+    // paragraph must appear in the batch only once, and must not be mutated by the
+    // client until the call returns.
+    static void LayoutBatch(Paragraph* paragraphs[], size_t count, SkScalar width,
+                            SkExecutor* executor);
+
     virtual void paint(SkCanvas* canvas, SkScalar x, SkScalar y) = 0;
 
     // Returns a vector of bounding boxes that enclose all text between
@@ -17,6 +17,7 @@
 #include "modules/skparagraph/src/Run.h"
 #include "modules/skparagraph/src/TextLine.h"
 #include "modules/skparagraph/src/TextWrapper.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/utils/SkUTF.h"
 #include <math.h>
 #include <algorithm>
@@ -61,6 +62,22 @@ Paragraph::Paragraph(ParagraphStyle style, sk_sp<FontCollection> fonts)
             , fExceededMaxLines(0)
 { }
 
+void Paragraph::LayoutBatch(Paragraph* paragraphs[], size_t count, SkScalar width,
+                            SkExecutor* executor) {
+    if (!executor || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            paragraphs[i]->layout(width);
+        }
+        return;
+    }
+
+    SkTaskGroup group(*executor);
+    for (size_t i = 0; i < count; ++i) {
+        group.add([paragraph = paragraphs[i], width]() { paragraph->layout(width); });
+    }
+    group.wait();
+}
+
 ParagraphImpl::ParagraphImpl(const SkString& text,
                              ParagraphStyle style,
                              SkTArray<Block, true> blocks,
@@ -3,6 +3,7 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkEncodedImageFormat.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkFontStyle.h"
 #include "include/core/SkImageEncoder.h"
@@ -6214,3 +6215,73 @@ DEF_TEST(SkParagraph_RTLGlyphPositionsInEmptyLines, reporter) {
     auto res3 = paragraph->getGlyphPositionAtCoordinate(0, height);
     REPORTER_ASSERT(reporter, res3.position == 10 && res3.affinity == Affinity::kUpstream);
 }
+
+DEF_TEST(SkParagraph_LayoutBatch, reporter) {
+    sk_sp<ResourceFontCollection> fontCollection = sk_make_sp<ResourceFontCollection>();
+    if (!fontCollection->fontsFound()) return;
+
+    const std::vector<const char*> texts = {
+        "Hello World Text Dialog",
+        "A somewhat longer paragraph of plain text, expected to wrap over multiple lines "
+        "once it runs out of horizontal space in the test canvas.",
+        "",
+        "Short",
+        "Trailing spaces   ",
+    };
+
+    auto make_paragraphs = [&]() {
+        std::vector<std::unique_ptr<Paragraph>> paragraphs;
+
+        ParagraphStyle paragraph_style;
+        paragraph_style.turnHintingOff();
+        TextStyle text_style;
+        text_style.setFontFamilies({SkString("Roboto")});
+        text_style.setColor(SK_ColorBLACK);
+
+        for (size_t i = 0; i < 20; ++i) {
+            ParagraphBuilderImpl builder(paragraph_style, fontCollection);
+            builder.pushStyle(text_style);
+            const char* text = texts[i % texts.size()];
+            builder.addText(text, strlen(text));
+            builder.pop();
+            paragraphs.push_back(builder.Build());
+        }
+
+        return paragraphs;
+    };
+
+    // Serial reference layout.
+    auto expected = make_paragraphs();
+    for (auto& paragraph : expected) {
+        paragraph->layout(TestCanvasWidth);
+    }
+
+    // Parallel batch layout, sharing the font collection.
+    auto batched = make_paragraphs();
+    std::vector<Paragraph*> batch;
+    for (auto& paragraph : batched) {
+        batch.push_back(paragraph.get());
+    }
+
+    auto executor = SkExecutor::MakeFIFOThreadPool(4);
+    Paragraph::LayoutBatch(batch.data(), batch.size(), TestCanvasWidth, executor.get());
+
+    for (size_t i = 0; i < batched.size(); ++i) {
+        REPORTER_ASSERT(reporter, batched[i]->getHeight() == expected[i]->getHeight());
+        REPORTER_ASSERT(reporter,
+                        batched[i]->getMaxIntrinsicWidth() == expected[i]->getMaxIntrinsicWidth());
+        REPORTER_ASSERT(reporter, batched[i]->lineNumber() == expected[i]->lineNumber());
+    }
+
+    // Null executor -> serial fallback.
+    auto serial = make_paragraphs();
+    std::vector<Paragraph*> serial_batch;
+    for (auto& paragraph : serial) {
+        serial_batch.push_back(paragraph.get());
+    }
+    Paragraph::LayoutBatch(serial_batch.data(), serial_batch.size(), TestCanvasWidth, nullptr);
+
+    for (size_t i = 0; i < serial.size(); ++i) {
+        REPORTER_ASSERT(reporter, serial[i]->getHeight() == expected[i]->getHeight());
+    }
+}
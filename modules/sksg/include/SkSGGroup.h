@@ -12,6 +12,8 @@
 
 #include <vector>
 
+class SkExecutor;
+
 namespace sksg {
 
 /**
@@ -34,6 +36,14 @@ public:
     bool  empty() const { return fChildren.empty(); }
     void  clear();
 
+    /**
+     * Revalidate the child subtrees in parallel on the given executor, merging bounds and
+     * damage deterministically after all tasks complete. Only safe when the child subtrees are
+     * independent, i.e. do not share nodes. Pass nullptr (the default) for the existing serial
+     * revalidation.
+     */
+    void setRevalidationExecutor(SkExecutor* executor) { fRevalExecutor = executor; }
+
 protected:
     Group();
     explicit Group(std::vector<sk_sp<RenderNode>>);
@@ -45,7 +55,10 @@ protected:
     SkRect onRevalidate(InvalidationController*, const SkMatrix&) override;
 
 private:
+    SkRect revalidateChildrenInParallel(InvalidationController*, const SkMatrix&);
+
     std::vector<sk_sp<RenderNode>> fChildren;
+    SkExecutor*                    fRevalExecutor = nullptr;
     bool                           fRequiresIsolation = true;
 
     using INHERITED = RenderNode;
@@ -19,6 +19,7 @@
 
 // TODO: merge EffectNode.h with this header
 
+class SkImage;
 class SkImageFilter;
 class SkMaskFilter;
 class SkShader;
@@ -267,6 +268,37 @@ private:
     using INHERITED = EffectNode;
 };
 
+/**
+ * Renders the subtree through a cached image.
+ *
+ * After two consecutive renders with a clean (non-invalidated) subtree and a stable
+ * device mapping, the subtree content is rasterized into an offscreen surface, and
+ * subsequent renders just redraw the cached image.  The cache is dropped on any
+ * descendant damage or CTM change, so animating subtrees keep rendering directly.
+ */
+class RenderCache final : public EffectNode {
+public:
+    ~RenderCache() override;
+
+    static sk_sp<RenderCache> Make(sk_sp<RenderNode> child);
+
+protected:
+    void onRender(SkCanvas*, const RenderContext*) const override;
+
+    SkRect onRevalidate(InvalidationController*, const SkMatrix&) override;
+
+private:
+    explicit RenderCache(sk_sp<RenderNode>);
+
+    // Render-time state (scene rendering is single-threaded).
+    mutable sk_sp<SkImage> fImage;                      // cached content, in device space
+    mutable SkIPoint       fImageOrigin = {0, 0};       // device-space origin for fImage
+    mutable SkMatrix       fLastCTM = SkMatrix::I();    // mapping for the most recent render
+    mutable bool           fSubtreeDamaged = true;      // subtree changed since the last render
+
+    using INHERITED = EffectNode;
+};
+
 } // namespace sksg
 
 #endif // SkSGRenderEffect_DEFINED
@@ -8,6 +8,9 @@
 #include "modules/sksg/include/SkSGGroup.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/private/SkTemplates.h"
+#include "modules/sksg/include/SkSGInvalidationController.h"
+#include "src/core/SkTaskGroup.h"
 
 #include <algorithm>
 
@@ -81,6 +84,12 @@ const RenderNode* Group::onNodeAt(const SkPoint& p) const {
 SkRect Group::onRevalidate(InvalidationController* ic, const SkMatrix& ctm) {
     SkASSERT(this->hasInval());
 
+    // Wide groups with independent subtrees can opt in to parallel revalidation.
+    static constexpr size_t kMinParallelChildren = 8;
+    if (fRevalExecutor && fChildren.size() >= kMinParallelChildren) {
+        return this->revalidateChildrenInParallel(ic, ctm);
+    }
+
     SkRect bounds = SkRect::MakeEmpty();
     fRequiresIsolation = false;
 
@@ -109,4 +118,42 @@ SkRect Group::onRevalidate(InvalidationController* ic, const SkMatrix& ctm) {
     return bounds;
 }
 
+SkRect Group::revalidateChildrenInParallel(InvalidationController* ic, const SkMatrix& ctm) {
+    const auto count = fChildren.size();
+
+    // Each task revalidates one child subtree into its own slot; damage goes to a per-child
+    // controller so the shared one is never touched concurrently.
+    SkAutoTArray<SkRect>                 child_bounds(count);
+    SkAutoTArray<InvalidationController> child_ics(ic ? count : 0);
+
+    SkTaskGroup tasks(*fRevalExecutor);
+    for (size_t i = 0; i < count; ++i) {
+        tasks.add([&, i] {
+            child_bounds[i] = fChildren[i]->revalidate(ic ? &child_ics[i] : nullptr, ctm);
+        });
+    }
+    tasks.wait();
+
+    // Deterministic serial merge, matching the order of the serial path.
+    SkRect bounds = SkRect::MakeEmpty();
+    fRequiresIsolation = false;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (ic) {
+            // The child controller rects are already in |ctm| space.
+            for (const auto& rect : child_ics[i]) {
+                ic->inval(rect);
+            }
+        }
+
+        if (!fRequiresIsolation && i > 0 && child_bounds[i].intersects(bounds)) {
+            fRequiresIsolation = true;
+        }
+
+        bounds.join(child_bounds[i]);
+    }
+
+    return bounds;
+}
+
 } // namespace sksg
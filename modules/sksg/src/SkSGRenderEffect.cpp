@@ -8,8 +8,10 @@
 #include "modules/sksg/include/SkSGRenderEffect.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
 #include "include/core/SkMaskFilter.h"
 #include "include/core/SkShader.h"
+#include "include/core/SkSurface.h"
 #include "src/core/SkMaskFilterBase.h"
 
 namespace sksg {
@@ -255,4 +257,77 @@ void LayerEffect::onRender(SkCanvas* canvas, const RenderContext* ctx) const {
     this->INHERITED::onRender(canvas, nullptr);
 }
 
+sk_sp<RenderCache> RenderCache::Make(sk_sp<RenderNode> child) {
+    return child ? sk_sp<RenderCache>(new RenderCache(std::move(child)))
+                 : nullptr;
+}
+
+RenderCache::RenderCache(sk_sp<RenderNode> child)
+    : INHERITED(std::move(child)) {}
+
+RenderCache::~RenderCache() = default;
+
+SkRect RenderCache::onRevalidate(InvalidationController* ic, const SkMatrix& ctm) {
+    // Revalidation only reaches us when the subtree was invalidated.
+    fImage.reset();
+    fSubtreeDamaged = true;
+
+    return this->INHERITED::onRevalidate(ic, ctm);
+}
+
+void RenderCache::onRender(SkCanvas* canvas, const RenderContext* ctx) const {
+    const auto ctm = canvas->getTotalMatrix();
+    const auto stable = !fSubtreeDamaged && ctm == fLastCTM;
+    fSubtreeDamaged = false;
+    fLastCTM        = ctm;
+
+    if (!stable) {
+        fImage.reset();
+    } else if (!fImage) {
+        // Two consecutive clean renders with the same device mapping - the subtree
+        // looks static, so it is worth caching.
+        static constexpr int32_t kMaxCacheDim = 8192;
+
+        const auto device_bounds = ctm.mapRect(this->bounds()).roundOut();
+        if (!device_bounds.isEmpty() &&
+            device_bounds.width()  <= kMaxCacheDim &&
+            device_bounds.height() <= kMaxCacheDim) {
+            // Note: makeSurface returns nullptr for canvases which cannot spawn
+            // compatible surfaces (recording, etc.) - we keep rendering directly then.
+            auto surface =
+                    canvas->makeSurface(canvas->imageInfo().makeDimensions(device_bounds.size()));
+            if (surface) {
+                surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+                surface->getCanvas()->translate(-device_bounds.left(), -device_bounds.top());
+                surface->getCanvas()->concat(ctm);
+                this->INHERITED::onRender(surface->getCanvas(), nullptr);
+
+                fImage       = surface->makeImageSnapshot();
+                fImageOrigin = {device_bounds.left(), device_bounds.top()};
+            }
+        }
+    }
+
+    if (!fImage) {
+        this->INHERITED::onRender(canvas, ctx);
+        return;
+    }
+
+    SkPaint paint;
+
+    ScopedRenderContext local_ctx(canvas, ctx);
+    if (ctx) {
+        if (ctx->fMaskShader) {
+            // Mask shaders cannot be applied via drawImage - we need layer isolation.
+            local_ctx.setIsolation(this->bounds(), ctm, true);
+        }
+        local_ctx->modulatePaint(ctm, &paint);
+    }
+
+    // The cache is in device space - draw with the identity matrix.
+    SkAutoCanvasRestore acr(canvas, true);
+    canvas->resetMatrix();
+    canvas->drawImage(fImage, fImageOrigin.x(), fImageOrigin.y(), SkSamplingOptions(), &paint);
+}
+
 } // namespace sksg
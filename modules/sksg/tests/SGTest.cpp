@@ -9,7 +9,11 @@
 
 #if !defined(SK_BUILD_FOR_GOOGLE3)
 
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkSurface.h"
 #include "include/private/SkTo.h"
 #include "modules/sksg/include/SkSGDraw.h"
 #include "modules/sksg/include/SkSGGroup.h"
@@ -355,4 +359,94 @@ DEF_TEST(SGInvalidation, reporter) {
     inval_group_remove(reporter);
 }
 
+DEF_TEST(SGRenderCache, reporter) {
+    auto color = sksg::Color::Make(SK_ColorGREEN);
+    auto cache = sksg::RenderCache::Make(
+            sksg::Draw::Make(sksg::Rect::Make(SkRect::MakeWH(50, 50)), color));
+
+    auto surface = SkSurface::MakeRasterN32Premul(100, 100);
+
+    const auto render_and_sample = [&](int x, int y) {
+        cache->revalidate(nullptr, SkMatrix::I());
+
+        surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+        cache->render(surface->getCanvas());
+
+        SkPixmap pmap;
+        SkAssertResult(surface->peekPixels(&pmap));
+        return pmap.getColor(x, y);
+    };
+
+    // First render is uncached, the second one primes the cache.
+    REPORTER_ASSERT(reporter, render_and_sample(25, 25) == 0xff00ff00);
+    REPORTER_ASSERT(reporter, render_and_sample(25, 25) == 0xff00ff00);
+
+    // Cached renders.
+    REPORTER_ASSERT(reporter, render_and_sample(25, 25) == 0xff00ff00);
+    REPORTER_ASSERT(reporter, render_and_sample(75, 75) == 0x00000000);
+
+    // Subtree invalidation drops the cache.
+    color->setColor(SK_ColorRED);
+    REPORTER_ASSERT(reporter, render_and_sample(25, 25) == 0xffff0000);
+    REPORTER_ASSERT(reporter, render_and_sample(25, 25) == 0xffff0000);
+
+    // Device mapping changes are honored even with a primed cache.
+    surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+    surface->getCanvas()->save();
+    surface->getCanvas()->translate(40, 40);
+    cache->render(surface->getCanvas());
+    surface->getCanvas()->restore();
+
+    SkPixmap pmap;
+    SkAssertResult(surface->peekPixels(&pmap));
+    REPORTER_ASSERT(reporter, pmap.getColor(75, 75) == 0xffff0000);
+    REPORTER_ASSERT(reporter, pmap.getColor(25, 25) == 0x00000000);
+}
+
+
+DEF_TEST(SGParallelRevalidation, reporter) {
+    // A wide group revalidated on an executor must produce the same bounds and damage as the
+    // serial path.
+    static constexpr int kChildCount = 16;
+
+    auto color = sksg::Color::Make(0xff000000);
+    auto grp   = sksg::Group::Make();
+
+    std::vector<sk_sp<sksg::Rect>> rects;
+    for (int i = 0; i < kChildCount; ++i) {
+        auto rect = sksg::Rect::Make(SkRect::MakeXYWH(i * 10.f, 0, 10, 10));
+        grp->addChild(sksg::Draw::Make(rect, color));
+        rects.push_back(std::move(rect));
+    }
+
+    auto executor = SkExecutor::MakeFIFOThreadPool(4);
+    grp->setRevalidationExecutor(executor.get());
+
+    {
+        sksg::InvalidationController ic;
+        const auto bounds = grp->revalidate(&ic, SkMatrix::I());
+        REPORTER_ASSERT(reporter, bounds == SkRect::MakeWH(kChildCount * 10.f, 10));
+    }
+
+    {
+        // Localized invalidation: only the touched child generates damage.
+        sksg::InvalidationController ic;
+        rects[3]->setB(20);
+        const auto bounds = grp->revalidate(&ic, SkMatrix::I());
+        REPORTER_ASSERT(reporter, ic.bounds() == SkRect::MakeXYWH(30, 0, 10, 20));
+
+        auto expected = SkRect::MakeWH(kChildCount * 10.f, 10);
+        expected.join(SkRect::MakeXYWH(30, 0, 10, 20));
+        REPORTER_ASSERT(reporter, bounds == expected);
+    }
+
+    // Dropping the executor reverts to serial semantics.
+    grp->setRevalidationExecutor(nullptr);
+    rects[3]->setB(10);
+    sksg::InvalidationController ic;
+    const auto bounds = grp->revalidate(&ic, SkMatrix::I());
+    REPORTER_ASSERT(reporter, ic.bounds() == SkRect::MakeXYWH(30, 0, 10, 20));
+    REPORTER_ASSERT(reporter, bounds == SkRect::MakeWH(kChildCount * 10.f, 10));
+}
+
 #endif // !defined(SK_BUILD_FOR_GOOGLE3)
@@ -29,6 +29,7 @@
 #include "modules/skshaper/include/SkShaper.h"
 #include "modules/skshaper/src/SkUnicode.h"
 #include "src/core/SkLRUCache.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkTDPQueue.h"
 #include "src/utils/SkUTF.h"
 
@@ -1293,6 +1294,93 @@ static HBLockedFaceCache get_hbFace_cache() {
     return HBLockedFaceCache(gHBFaceCache, gHBFaceCacheMutex);
 }
 
+// Key for the shaped-run cache below.  The full text is hashed (not just the run
+// span), since HarfBuzz also sees the run's pre/post context.
+struct ShapedRunKey {
+    uint32_t      fTextHash;
+    uint32_t      fStart,
+                  fEnd;
+    SkFont        fFont;
+    uint8_t       fLevel;
+    SkFourByteTag fScript;
+    SkString      fLanguage;
+
+    bool operator==(const ShapedRunKey& that) const {
+        return fTextHash == that.fTextHash
+            && fStart    == that.fStart
+            && fEnd      == that.fEnd
+            && fFont     == that.fFont
+            && fLevel    == that.fLevel
+            && fScript   == that.fScript
+            && fLanguage == that.fLanguage;
+    }
+};
+
+struct ShapedRunKeyHash {
+    uint32_t operator()(const ShapedRunKey& key) const {
+        const SkFontID fontId = key.fFont.getTypefaceOrDefault()->uniqueID();
+        const SkScalar fontSize = key.fFont.getSize();
+
+        uint32_t hash = key.fTextHash;
+        hash = SkOpts::hash(&key.fStart,  sizeof(key.fStart) , hash);
+        hash = SkOpts::hash(&key.fEnd,    sizeof(key.fEnd)   , hash);
+        hash = SkOpts::hash(&fontId,      sizeof(fontId)     , hash);
+        hash = SkOpts::hash(&fontSize,    sizeof(fontSize)   , hash);
+        hash = SkOpts::hash(&key.fLevel,  sizeof(key.fLevel) , hash);
+        hash = SkOpts::hash(&key.fScript, sizeof(key.fScript), hash);
+        hash = SkOpts::hash(key.fLanguage.c_str(), key.fLanguage.size(), hash);
+        return hash;
+    }
+};
+
+static ShapedRun clone_run(const ShapedRun& that) {
+    ShapedRun run(that.fUtf8Range, that.fFont, that.fLevel,
+                  std::unique_ptr<ShapedGlyph[]>(new ShapedGlyph[that.fNumGlyphs]),
+                  that.fNumGlyphs, that.fAdvance);
+    memcpy(run.fGlyphs.get(), that.fGlyphs.get(), that.fNumGlyphs * sizeof(ShapedGlyph));
+    return run;
+}
+
+class LockedShapedRunCache {
+public:
+    LockedShapedRunCache(SkLRUCache<ShapedRunKey, ShapedRun, ShapedRunKeyHash>& lruCache,
+                         SkMutex& mutex)
+        : fLRUCache(lruCache), fMutex(mutex)
+    {
+        fMutex.acquire();
+    }
+    LockedShapedRunCache(const LockedShapedRunCache&) = delete;
+    LockedShapedRunCache& operator=(const LockedShapedRunCache&) = delete;
+    LockedShapedRunCache(LockedShapedRunCache&&) = delete;
+    LockedShapedRunCache& operator=(LockedShapedRunCache&&) = delete;
+
+    ~LockedShapedRunCache() {
+        fMutex.release();
+    }
+
+    ShapedRun* find(const ShapedRunKey& key) {
+        return fLRUCache.find(key);
+    }
+    void insert(const ShapedRunKey& key, ShapedRun run) {
+        fLRUCache.insert(key, std::move(run));
+    }
+    void reset() {
+        fLRUCache.reset();
+    }
+private:
+    SkLRUCache<ShapedRunKey, ShapedRun, ShapedRunKeyHash>& fLRUCache;
+    SkMutex& fMutex;
+};
+
+static LockedShapedRunCache get_shaped_run_cache() {
+    // Identical short runs are re-shaped constantly by text-heavy UIs, and the wrapping
+    // shapers re-shape candidate ranges while breaking lines; both hit this cache.
+    // 256 entries of mostly short runs keep the footprint in the tens of KB.
+    static SkMutex gShapedRunCacheMutex;
+    static SkLRUCache<ShapedRunKey, ShapedRun, ShapedRunKeyHash> gShapedRunCache(256);
+    return LockedShapedRunCache(gShapedRunCache, gShapedRunCacheMutex);
+}
+
 ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
                                   size_t const utf8Bytes,
                                   char const * const utf8Start,
@@ -1307,6 +1395,24 @@ ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
     ShapedRun run(RunHandler::Range(utf8Start - utf8, utf8runLength),
                   font.currentFont(), bidi.currentLevel(), nullptr, 0);
 
+    // Explicit shaping features are rare and would bloat the key - skip the cache then.
+    const bool cacheable = (featuresSize == 0);
+    ShapedRunKey key;
+    if (cacheable) {
+        key = { SkOpts::hash(utf8, utf8Bytes),
+                SkTo<uint32_t>(utf8Start - utf8),
+                SkTo<uint32_t>(utf8End   - utf8),
+                font.currentFont(),
+                bidi.currentLevel(),
+                script.currentScript(),
+                SkString(language.currentLanguage()) };
+
+        LockedShapedRunCache cache = get_shaped_run_cache();
+        if (ShapedRun* cached = cache.find(key)) {
+            return clone_run(*cached);
+        }
+    }
+
     hb_buffer_t* buffer = fBuffer.get();
     SkAutoTCallVProc<hb_buffer_t, hb_buffer_clear_contents> autoClearBuffer(buffer);
     hb_buffer_set_content_type(buffer, HB_BUFFER_CONTENT_TYPE_UNICODE);
@@ -1429,6 +1535,11 @@ ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
     }
     run.fAdvance = runAdvance;
 
+    if (cacheable) {
+        LockedShapedRunCache cache = get_shaped_run_cache();
+        cache.insert(key, clone_run(run));
+    }
+
     return run;
 }
 
@@ -1515,6 +1626,10 @@ std::unique_ptr<SkShaper> SkShaper::MakeShapeDontWrapOrReorder(sk_sp<SkFontMgr>
 }
 
 void SkShaper::PurgeHarfBuzzCache() {
+    {
+        LockedShapedRunCache runCache = get_shaped_run_cache();
+        runCache.reset();
+    }
     HBLockedFaceCache cache = get_hbFace_cache();
     cache.reset();
 }
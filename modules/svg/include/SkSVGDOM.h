@@ -11,12 +11,16 @@
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSize.h"
+#include "include/private/SkOnce.h"
 #include "include/private/SkTemplates.h"
 #include "modules/skresources/include/SkResources.h"
 #include "modules/svg/include/SkSVGIDMapper.h"
 
+#include <memory>
+
 class SkCanvas;
 class SkDOM;
+class SkPicture;
 class SkStream;
 class SkSVGNode;
 class SkSVGSVG;
@@ -49,7 +53,10 @@ public:
     /**
      * Returns the root (outermost) SVG element.
      */
-    SkSVGSVG* getRoot() const { return fRoot.get(); }
+    SkSVGSVG* getRoot() const {
+        this->realize();
+        return fRoot.get();
+    }
 
     /**
      * Specify a "container size" for the SVG dom.
@@ -81,16 +88,38 @@ public:
 
     void render(SkCanvas*) const;
 
+    /**
+     * Compiles the document into an SkPicture, backed by an R-tree for fast culled playback.
+     * Replaying the picture skips the per-frame DOM traversal, so this is the preferred way to
+     * draw a static document repeatedly. The result can be serialized with SkPicture::serialize()
+     * to cache the compiled form across sessions (the .skp format is versioned).
+     *
+     * Returns nullptr if the document is invalid or has an empty container size.
+     */
+    sk_sp<SkPicture> makePicture() const;
+
+    ~SkSVGDOM() override;
+
 private:
-    SkSVGDOM(sk_sp<SkSVGSVG>, sk_sp<SkFontMgr>, sk_sp<skresources::ResourceProvider>,
-             SkSVGIDMapper&&);
+    SkSVGDOM(std::unique_ptr<SkDOM>, sk_sp<SkFontMgr>, sk_sp<skresources::ResourceProvider>);
+
+    // Builds the SkSVGNode tree from the retained XML DOM on first access, then releases the
+    // XML DOM. Parsing thousands of documents up front (e.g. an icon set) was a measurable
+    // startup cost when most of them aren't rendered right away.
+    void realize() const;
+
+    // Retained until the node tree is realized, then freed.
+    mutable std::unique_ptr<SkDOM>             fXMLDom;
+    mutable SkOnce                             fRealizeOnce;
+    mutable sk_sp<SkSVGSVG>                    fRoot;
+    mutable SkSVGIDMapper                      fIDMapper;
 
-    const sk_sp<SkSVGSVG>                      fRoot;
     const sk_sp<SkFontMgr>                     fFontMgr;
     const sk_sp<skresources::ResourceProvider> fResourceProvider;
-    const SkSVGIDMapper                        fIDMapper;
 
-    SkSize                 fContainerSize;
+    // Lazily resolved from the root's intrinsic size unless set explicitly by the client.
+    mutable SkSize         fContainerSize = SkSize::Make(0, 0);
+    mutable bool           fContainerSizeResolved = false;
 };
 
 #endif // SkSVGDOM_DEFINED
@@ -5,8 +5,10 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkBBHFactory.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkFontMgr.h"
+#include "include/core/SkPictureRecorder.h"
 #include "include/core/SkString.h"
 #include "include/private/SkTo.h"
 #include "modules/svg/include/SkSVGAttributeParser.h"
@@ -397,16 +399,16 @@ SkSVGDOM::Builder& SkSVGDOM::Builder::setResourceProvider(sk_sp<skresources::Res
 
 sk_sp<SkSVGDOM> SkSVGDOM::Builder::make(SkStream& str) const {
     TRACE_EVENT0("skia", TRACE_FUNC);
-    SkDOM xmlDom;
-    if (!xmlDom.build(str)) {
+    auto xmlDom = std::make_unique<SkDOM>();
+    if (!xmlDom->build(str)) {
         return nullptr;
     }
 
-    SkSVGIDMapper mapper;
-    ConstructionContext ctx(&mapper);
-
-    auto root = construct_svg_node(xmlDom, ctx, xmlDom.getRootNode());
-    if (!root || root->tag() != SkSVGTag::kSvg) {
+    // Realizing the SkSVGNode tree is deferred until first access, but reject documents whose
+    // root element isn't <svg> up front, as the eager parse used to.
+    const SkDOM::Node* root = xmlDom->getRootNode();
+    if (!root || xmlDom->getType(root) != SkDOM::kElement_Type ||
+        strcmp(xmlDom->getName(root), "svg") != 0) {
         return nullptr;
     }
 
@@ -417,42 +419,78 @@ sk_sp<SkSVGDOM> SkSVGDOM::Builder::make(SkStream& str) const {
     auto resource_provider = fResourceProvider ? fResourceProvider
                                                : sk_make_sp<NullResourceProvider>();
 
-    return sk_sp<SkSVGDOM>(new SkSVGDOM(sk_sp<SkSVGSVG>(static_cast<SkSVGSVG*>(root.release())),
-                                        std::move(fFontMgr), std::move(resource_provider),
-                                        std::move(mapper)));
+    return sk_sp<SkSVGDOM>(new SkSVGDOM(std::move(xmlDom), std::move(fFontMgr),
+                                        std::move(resource_provider)));
 }
 
-SkSVGDOM::SkSVGDOM(sk_sp<SkSVGSVG> root, sk_sp<SkFontMgr> fmgr,
-                   sk_sp<skresources::ResourceProvider> rp, SkSVGIDMapper&& mapper)
-    : fRoot(std::move(root))
+SkSVGDOM::SkSVGDOM(std::unique_ptr<SkDOM> xmlDom, sk_sp<SkFontMgr> fmgr,
+                   sk_sp<skresources::ResourceProvider> rp)
+    : fXMLDom(std::move(xmlDom))
     , fFontMgr(std::move(fmgr))
     , fResourceProvider(std::move(rp))
-    , fIDMapper(std::move(mapper))
-    , fContainerSize(fRoot->intrinsicSize(SkSVGLengthContext(SkSize::Make(0, 0))))
 {
     SkASSERT(fResourceProvider);
 }
 
+SkSVGDOM::~SkSVGDOM() = default;
+
+void SkSVGDOM::realize() const {
+    fRealizeOnce([this] {
+        TRACE_EVENT0("skia", "SkSVGDOM::realize");
+        SkASSERT(fXMLDom);
+
+        ConstructionContext ctx(&fIDMapper);
+        auto root = construct_svg_node(*fXMLDom, ctx, fXMLDom->getRootNode());
+        fXMLDom.reset();
+
+        if (root && root->tag() == SkSVGTag::kSvg) {
+            fRoot = sk_sp<SkSVGSVG>(static_cast<SkSVGSVG*>(root.release()));
+        }
+    });
+}
+
 void SkSVGDOM::render(SkCanvas* canvas) const {
     TRACE_EVENT0("skia", TRACE_FUNC);
+    this->realize();
     if (fRoot) {
-        SkSVGLengthContext       lctx(fContainerSize);
+        SkSVGLengthContext       lctx(this->containerSize());
         SkSVGPresentationContext pctx;
         fRoot->render(SkSVGRenderContext(canvas, fFontMgr, fResourceProvider, fIDMapper, lctx, pctx,
                                          {nullptr, nullptr}));
     }
 }
 
+sk_sp<SkPicture> SkSVGDOM::makePicture() const {
+    TRACE_EVENT0("skia", TRACE_FUNC);
+    const SkSize size = this->containerSize();
+    if (!fRoot || size.isEmpty()) {
+        return nullptr;
+    }
+
+    SkRTreeFactory bbhFactory;
+    SkPictureRecorder recorder;
+    this->render(recorder.beginRecording(SkRect::MakeSize(size), &bbhFactory));
+    return recorder.finishRecordingAsPicture();
+}
+
 const SkSize& SkSVGDOM::containerSize() const {
+    if (!fContainerSizeResolved) {
+        this->realize();
+        fContainerSize = fRoot ? fRoot->intrinsicSize(SkSVGLengthContext(SkSize::Make(0, 0)))
+                               : SkSize::Make(0, 0);
+        fContainerSizeResolved = true;
+    }
     return fContainerSize;
 }
 
 void SkSVGDOM::setContainerSize(const SkSize& containerSize) {
     // TODO: inval
     fContainerSize = containerSize;
+    fContainerSizeResolved = true;
 }
 
 sk_sp<SkSVGNode>* SkSVGDOM::findNodeById(const char* id) {
+    this->realize();
     SkString idStr(id);
     return this->fIDMapper.find(idStr);
 }
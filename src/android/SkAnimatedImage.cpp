@@ -186,10 +186,50 @@ double SkAnimatedImage::finish() {
     return kFinished;
 }
 
+void SkAnimatedImage::updateFrameDamage(int frameToDecode, const SkIRect& frameRect) {
+    if (!this->simple()) {
+        // Scaling, cropping, orientation or a post-process picture make partial damage
+        // ill-defined in output coordinates.
+        fCurrentFrameDamage = SkIRect::MakeSize(fCropRect.size());
+        return;
+    }
+    if (SkCodec::kNoFrame == fDisplayFrame.fIndex || frameToDecode != fDisplayFrame.fIndex + 1) {
+        // The first frame, or a restarted loop: everything may have changed.
+        fCurrentFrameDamage = fDecodeInfo.bounds();
+        return;
+    }
+
+    // The new frame updates its own rectangle. The displayed frame's disposal may first clear
+    // (kRestoreBGColor) or revert (kRestorePrevious) that frame's rectangle, damaging it too.
+    SkIRect damage = frameRect;
+    if (SkCodecAnimation::DisposalMethod::kKeep != fDisplayFrame.fDisposalMethod) {
+        SkCodec::FrameInfo displayedInfo;
+        if (!fCodec->codec()->getFrameInfo(fDisplayFrame.fIndex, &displayedInfo)) {
+            fCurrentFrameDamage = fDecodeInfo.bounds();
+            return;
+        }
+        damage.join(displayedInfo.fFrameRect);
+    }
+
+    // Frame rectangles are in the codec's native coordinates; map them through any sampling.
+    const SkISize native = fCodec->codec()->dimensions();
+    if (native != fDecodeInfo.dimensions()) {
+        const float scaleX = (float) fDecodeInfo.width()  / native.width(),
+                    scaleY = (float) fDecodeInfo.height() / native.height();
+        damage = SkRect::MakeLTRB(damage.fLeft  * scaleX, damage.fTop    * scaleY,
+                                  damage.fRight * scaleX, damage.fBottom * scaleY).roundOut();
+    }
+    if (!damage.intersect(fDecodeInfo.bounds())) {
+        damage.setEmpty();
+    }
+    fCurrentFrameDamage = damage;
+}
+
 int SkAnimatedImage::decodeNextFrame() {
     if (fFinished) {
         return kFinished;
     }
+    fCurrentFrameDamage.setEmpty();
 
     bool animationEnded = false;
     const int frameToDecode = this->computeNextFrame(fDisplayFrame.fIndex, &animationEnded);
@@ -229,6 +269,7 @@ int SkAnimatedImage::decodeNextFrame() {
 
     for (Frame* frame : { &fRestoreFrame, &fDecodingFrame }) {
         if (frameToDecode == frame->fIndex) {
+            this->updateFrameDamage(frameToDecode, frameInfo.fFrameRect);
             using std::swap;
             swap(fDisplayFrame, *frame);
             if (animationEnded) {
@@ -310,6 +351,7 @@ int SkAnimatedImage::decodeNextFrame() {
     fDecodingFrame.fIndex = frameToDecode;
     fDecodingFrame.fDisposalMethod = frameInfo.fDisposalMethod;
 
+    this->updateFrameDamage(frameToDecode, frameInfo.fFrameRect);
     using std::swap;
     swap(fDecodingFrame, fDisplayFrame);
     fDisplayFrame.fBitmap.notifyPixelsChanged();
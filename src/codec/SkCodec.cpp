@@ -12,6 +12,7 @@
 #include "include/core/SkData.h"
 #include "include/core/SkImage.h"
 #include "include/private/SkHalf.h"
+#include "include/private/SkMallocTag.h"
 #include "src/codec/SkBmpCodec.h"
 #include "src/codec/SkCodecPriv.h"
 #include "src/codec/SkFrameHolder.h"
@@ -69,6 +70,7 @@ void SkCodec::Register(
 std::unique_ptr<SkCodec> SkCodec::MakeFromStream(
         std::unique_ptr<SkStream> stream, Result* outResult,
         SkPngChunkReader* chunkReader, SelectionPolicy selectionPolicy) {
+    SkAutoMallocTag autoTag(SkMallocTag::kCodec);
     Result resultStorage;
     if (!outResult) {
         outResult = &resultStorage;
@@ -374,6 +376,7 @@ SkCodec::Result SkCodec::handleFrameIndex(const SkImageInfo& info, void* pixels,
 
 SkCodec::Result SkCodec::getPixels(const SkImageInfo& info, void* pixels, size_t rowBytes,
                                    const Options* options) {
+    SkAutoMallocTag autoTag(SkMallocTag::kCodec);
     if (kUnknown_SkColorType == info.colorType()) {
         return kInvalidConversion;
     }
@@ -618,6 +621,58 @@ bool SkCodec::skipScanlines(int countLines) {
     return result;
 }
 
+SkCodec::Result SkCodec::RegionDecodeSession::decodeRegion(const SkImageInfo& dstInfo, void* dst,
+                                                           size_t rowBytes,
+                                                           const SkIRect& region) {
+    if (nullptr == dst) {
+        return kInvalidParameters;
+    }
+    if (dstInfo.dimensions() != region.size()
+            || !SkIRect::MakeSize(fCodec->dimensions()).contains(region)) {
+        return kInvalidParameters;
+    }
+
+    // Continue the running scanline decode only if this region reads the same columns with the
+    // same color conversion and does not require moving backwards in the stream.
+    const bool canContinue = fActive
+            && region.left() == fSubset.left() && region.right() == fSubset.right()
+            && dstInfo.colorInfo() == fColorInfo
+            && fCodec->getScanlineOrder() == kTopDown_SkScanlineOrder
+            && region.top() >= fCodec->nextScanline();
+    if (!canContinue) {
+        fActive = false;
+        fSubset = SkIRect::MakeLTRB(region.left(), 0, region.right(), fCodec->dimensions().height());
+        fColorInfo = dstInfo.colorInfo();
+
+        Options options;
+        options.fSubset = &fSubset;
+        const SkImageInfo fullInfo = dstInfo.makeDimensions(fCodec->dimensions());
+        const Result result = fCodec->startScanlineDecode(fullInfo, &options);
+        if (kSuccess != result) {
+            return result;
+        }
+        if (fCodec->getScanlineOrder() != kTopDown_SkScanlineOrder) {
+            return kUnimplemented;
+        }
+        fActive = true;
+    }
+
+    if (const int linesToSkip = region.top() - fCodec->nextScanline()) {
+        if (!fCodec->skipScanlines(linesToSkip)) {
+            fActive = false;
+            return kIncompleteInput;
+        }
+    }
+    const int linesDecoded = fCodec->getScanlines(dst, region.height(), rowBytes);
+    if (linesDecoded < region.height()) {
+        // getScanlines() filled the remaining rows, but the stream position is no longer
+        // trustworthy; force a restart on the next call.
+        fActive = false;
+        return kIncompleteInput;
+    }
+    return kSuccess;
+}
+
 int SkCodec::outputScanline(int inputScanline) const {
     SkASSERT(0 <= inputScanline && inputScanline < fEncodedInfo.height());
     return this->onOutputScanline(inputScanline);
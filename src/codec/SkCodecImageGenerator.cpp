@@ -7,7 +7,47 @@
 
 #include "src/codec/SkCodecImageGenerator.h"
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/private/SkTemplates.h"
+#include "src/core/SkBitmapCache.h"
 #include "src/core/SkPixmapPriv.h"
+#include "src/core/SkResourceCache.h"
+
+#include <algorithm>
+
+namespace {
+static unsigned gCodecDecodeKeyNamespaceLabel;
+
+struct CodecDecodeKey : public SkResourceCache::Key {
+    CodecDecodeKey(uint32_t genID, const SkISize& size) : fGenID(genID), fSize(size) {
+        this->init(&gCodecDecodeKeyNamespaceLabel, SkMakeResourceCacheSharedIDForBitmap(genID),
+                   sizeof(fGenID) + sizeof(fSize));
+    }
+
+    uint32_t fGenID;
+    SkISize  fSize;
+};
+
+struct CodecDecodeRec : public SkResourceCache::Rec {
+    CodecDecodeRec(const CodecDecodeKey& key, const SkBitmap& bm) : fKey(key), fBitmap(bm) {
+        fBitmap.setImmutable();
+    }
+
+    CodecDecodeKey fKey;
+    SkBitmap       fBitmap;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override { return sizeof(fKey) + fBitmap.computeByteSize(); }
+    const char* getCategory() const override { return "codec-decoded-pixels"; }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextBitmap) {
+        const CodecDecodeRec& rec = static_cast<const CodecDecodeRec&>(baseRec);
+        *static_cast<SkBitmap*>(contextBitmap) = rec.fBitmap;
+        return true;
+    }
+};
+}  // namespace
 
 std::unique_ptr<SkImageGenerator> SkCodecImageGenerator::MakeFromEncodedCodec(sk_sp<SkData> data) {
     auto codec = SkCodec::MakeFromData(data);
@@ -46,12 +86,11 @@ sk_sp<SkData> SkCodecImageGenerator::onRefEncodedData() {
     return fData;
 }
 
-bool SkCodecImageGenerator::getPixels(const SkImageInfo& info, void* pixels, size_t rowBytes, const SkCodec::Options* options) {
-    SkPixmap dst(info, pixels, rowBytes);
-
-    auto decode = [this, options](const SkPixmap& pm) {
-        SkCodec::Result result = fCodec->getPixels(pm, options);
-        switch (result) {
+bool SkCodecImageGenerator::decode(const SkPixmap& dst, const SkCodec::Options* options,
+                                   SkCodec::Result* outResult) {
+    auto decode = [this, options, outResult](const SkPixmap& pm) {
+        *outResult = fCodec->getPixels(pm, options);
+        switch (*outResult) {
             case SkCodec::kSuccess:
             case SkCodec::kIncompleteInput:
             case SkCodec::kErrorInInput:
@@ -64,9 +103,102 @@ bool SkCodecImageGenerator::getPixels(const SkImageInfo& info, void* pixels, siz
     return SkPixmapPriv::Orient(dst, fCodec->getOrigin(), decode);
 }
 
+bool SkCodecImageGenerator::getPixels(const SkImageInfo& info, void* pixels, size_t rowBytes, const SkCodec::Options* options) {
+    SkCodec::Result result;
+    return this->decode(SkPixmap(info, pixels, rowBytes), options, &result);
+}
+
+bool SkCodecImageGenerator::findCachedDecode(SkBitmap* bm) const {
+    if (fCachedDecodeSize.isEmpty()) {
+        return false;
+    }
+    CodecDecodeKey key(this->uniqueID(), fCachedDecodeSize);
+    return SkResourceCache::Find(key, CodecDecodeRec::Visitor, bm);
+}
+
+void SkCodecImageGenerator::addCachedDecode(const SkBitmap& bm) {
+    CodecDecodeKey key(this->uniqueID(), bm.dimensions());
+    SkResourceCache::Add(new CodecDecodeRec(key, bm));
+    fCachedDecodeSize = bm.dimensions();
+}
+
 bool SkCodecImageGenerator::onGetPixels(const SkImageInfo& requestInfo, void* requestPixels,
                                         size_t requestRowBytes, const Options& options) {
-    return this->getPixels(requestInfo, requestPixels, requestRowBytes, nullptr);
+    SkPixmap dst(requestInfo, requestPixels, requestRowBytes);
+
+    // Texture setup for a large photo commonly asks for the image at several scaled sizes (the
+    // base level plus a mip chain), each of which used to re-decode the stream from scratch.
+    // Keep the largest decode as a shared intermediate in SkResourceCache and satisfy any
+    // request it covers by downsampling from it.
+    SkBitmap cached;
+    if (this->findCachedDecode(&cached) &&
+        cached.width() >= requestInfo.width() && cached.height() >= requestInfo.height()) {
+        if (cached.dimensions() == requestInfo.dimensions()) {
+            return cached.readPixels(dst);
+        }
+        return cached.pixmap().scalePixels(dst, SkSamplingOptions(SkFilterMode::kLinear));
+    }
+
+    SkBitmap decoded;
+    SkCodec::Result result;
+    if (requestInfo.width() > fCachedDecodeSize.width()   ||
+        requestInfo.height() > fCachedDecodeSize.height()) {
+        if (decoded.tryAllocPixels(requestInfo) &&
+            this->decode(decoded.pixmap(), nullptr, &result)) {
+            // Incomplete frames are not retained; a later request should see the full image
+            // if more data has arrived by then.
+            if (SkCodec::kSuccess == result) {
+                this->addCachedDecode(decoded);
+            }
+            return decoded.readPixels(dst);
+        }
+        // Allocation (or the scaled decode) failed; fall through and decode straight into the
+        // caller's pixels.
+    }
+
+    return this->decode(dst, nullptr, &result);
+}
+
+bool SkCodecImageGenerator::onStartIncrementalDecode(const SkImageInfo& info, void* pixels,
+                                                     size_t rowBytes) {
+    // Scanline decoding writes rows in codec order with no reorientation, so only images that
+    // are already top-down and unrotated can be handed out slice by slice.
+    if (fCodec->getOrigin() != kTopLeft_SkEncodedOrigin) {
+        return false;
+    }
+    if (SkCodec::kSuccess != fCodec->startScanlineDecode(info)) {
+        return false;
+    }
+    if (fCodec->getScanlineOrder() != SkCodec::kTopDown_SkScanlineOrder) {
+        return false;
+    }
+    fIncrementalDst = pixels;
+    fIncrementalRowBytes = rowBytes;
+    fIncrementalRowsDecoded = 0;
+    fIncrementalHeight = info.height();
+    return true;
+}
+
+bool SkCodecImageGenerator::onIncrementalDecode(int rowBudget, int* totalRowsDecoded) {
+    if (!fIncrementalDst) {
+        return false;
+    }
+    const int request = std::min(rowBudget, fIncrementalHeight - fIncrementalRowsDecoded);
+    void* dst = SkTAddOffset<void>(fIncrementalDst,
+                                   fIncrementalRowsDecoded * fIncrementalRowBytes);
+    const int decoded = fCodec->getScanlines(dst, request, fIncrementalRowBytes);
+    fIncrementalRowsDecoded += decoded;
+    *totalRowsDecoded = fIncrementalRowsDecoded;
+    if (decoded < request) {
+        // The input ran out or is corrupt; getScanlines already filled the rows it could not
+        // decode, so report the decode as over.
+        fIncrementalDst = nullptr;
+        return false;
+    }
+    if (fIncrementalRowsDecoded == fIncrementalHeight) {
+        fIncrementalDst = nullptr;
+    }
+    return true;
 }
 
 bool SkCodecImageGenerator::onQueryYUVAInfo(
@@ -11,6 +11,8 @@
 #include "include/core/SkData.h"
 #include "include/core/SkImageGenerator.h"
 
+class SkBitmap;
+
 class SkCodecImageGenerator : public SkImageGenerator {
 public:
     /*
@@ -98,6 +100,11 @@ protected:
                      size_t rowBytes,
                      const Options& opts) override;
 
+    bool onStartIncrementalDecode(const SkImageInfo& info, void* pixels,
+                                  size_t rowBytes) override;
+
+    bool onIncrementalDecode(int rowBudget, int* totalRowsDecoded) override;
+
     bool onQueryYUVAInfo(const SkYUVAPixmapInfo::SupportedDataTypes&,
                          SkYUVAPixmapInfo*) const override;
 
@@ -109,9 +116,28 @@ private:
      */
     SkCodecImageGenerator(std::unique_ptr<SkCodec>, sk_sp<SkData>);
 
+    // Decodes the full frame into dst, applying the EXIF origin. On a true return *outResult
+    // holds the codec result, which may be kIncompleteInput.
+    bool decode(const SkPixmap& dst, const SkCodec::Options* options, SkCodec::Result* outResult);
+
+    // The largest decode so far is kept in SkResourceCache so that the several scaled sizes
+    // texture setup requests (e.g. a mip chain) share one decode and downsample from it.
+    bool findCachedDecode(SkBitmap* bm) const;
+    void addCachedDecode(const SkBitmap& bm);
+
     std::unique_ptr<SkCodec> fCodec;
     sk_sp<SkData> fData;
 
+    // Dimensions of the decode currently retained in SkResourceCache; empty until a full
+    // frame has decoded completely.
+    SkISize fCachedDecodeSize = SkISize::MakeEmpty();
+
+    // State for an incremental decode; fIncrementalDst is null when none is in progress.
+    void* fIncrementalDst = nullptr;
+    size_t fIncrementalRowBytes = 0;
+    int fIncrementalRowsDecoded = 0;
+    int fIncrementalHeight = 0;
+
     using INHERITED = SkImageGenerator;
 };
 #endif  // SkCodecImageGenerator_DEFINED
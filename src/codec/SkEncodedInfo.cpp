@@ -7,22 +7,76 @@
 
 #include "include/private/SkEncodedInfo.h"
 
+#include "include/core/SkColorSpace.h"
+#include "include/private/SkMutex.h"
+#include "src/core/SkLRUCache.h"
+#include "src/core/SkOpts.h"
+
+// Identical ICC profiles (typically a few KB, stamped by the same camera or editor) recur across
+// huge numbers of images, so parsing and SkColorSpace classification are interned process-wide,
+// keyed by a hash of the raw profile bytes.
+namespace {
+struct CachedProfile {
+    sk_sp<SkData>       fData;  // keeps fProfile's internal pointers alive
+    skcms_ICCProfile    fProfile;
+    sk_sp<SkColorSpace> fColorSpace;
+};
+}  // namespace
+
+static SkMutex gProfileCacheMutex;
+static SkLRUCache<uint32_t, std::unique_ptr<CachedProfile>>& profile_cache() {
+    static auto* cache = new SkLRUCache<uint32_t, std::unique_ptr<CachedProfile>>(32);
+    return *cache;
+}
+
 std::unique_ptr<SkEncodedInfo::ICCProfile> SkEncodedInfo::ICCProfile::Make(sk_sp<SkData> data) {
-    if (data) {
-        skcms_ICCProfile profile;
-        if (skcms_Parse(data->data(), data->size(), &profile)) {
-            return std::unique_ptr<ICCProfile>(new ICCProfile(profile, std::move(data)));
+    if (!data) {
+        return nullptr;
+    }
+
+    const uint32_t hash = SkOpts::hash(data->data(), data->size());
+    {
+        SkAutoMutexExclusive lock(gProfileCacheMutex);
+        if (std::unique_ptr<CachedProfile>* found = profile_cache().find(hash)) {
+            CachedProfile* cached = found->get();
+            // Guard against hash collisions; only byte-identical profiles share an entry.
+            if (cached->fData->size() == data->size() &&
+                0 == memcmp(cached->fData->data(), data->data(), data->size())) {
+                return std::unique_ptr<ICCProfile>(
+                        new ICCProfile(cached->fProfile, cached->fData, cached->fColorSpace));
+            }
         }
     }
-    return nullptr;
+
+    skcms_ICCProfile profile;
+    if (!skcms_Parse(data->data(), data->size(), &profile)) {
+        return nullptr;
+    }
+
+    auto cached = std::make_unique<CachedProfile>();
+    cached->fData = data;
+    cached->fProfile = profile;
+    cached->fColorSpace = SkColorSpace::Make(profile);
+
+    auto result = std::unique_ptr<ICCProfile>(
+            new ICCProfile(profile, std::move(data), cached->fColorSpace));
+
+    SkAutoMutexExclusive lock(gProfileCacheMutex);
+    profile_cache().insert_or_update(hash, std::move(cached));
+    return result;
 }
 
 std::unique_ptr<SkEncodedInfo::ICCProfile> SkEncodedInfo::ICCProfile::Make(
         const skcms_ICCProfile& profile) {
-    return std::unique_ptr<ICCProfile>(new ICCProfile(profile));
+    // These profiles are synthesized by codecs rather than parsed from bytes, so there is nothing
+    // to intern on; still classify the SkColorSpace once up front.
+    return std::unique_ptr<ICCProfile>(
+            new ICCProfile(profile, nullptr, SkColorSpace::Make(profile)));
 }
 
-SkEncodedInfo::ICCProfile::ICCProfile(const skcms_ICCProfile& profile, sk_sp<SkData> data)
+SkEncodedInfo::ICCProfile::ICCProfile(const skcms_ICCProfile& profile, sk_sp<SkData> data,
+                                      sk_sp<SkColorSpace> colorSpace)
     : fProfile(profile)
     , fData(std::move(data))
+    , fColorSpace(std::move(colorSpace))
 {}
@@ -165,6 +165,14 @@ SkCodec::Result SkSampledCodec::sampledDecode(const SkImageInfo& info, void* pix
     // We should only call this function when sampling.
     SkASSERT(options.fSampleSize > 1);
 
+    if (options.fBoxFilter) {
+        SkCodec::Result result = this->boxFilteredDecode(info, pixels, rowBytes, options);
+        if (SkCodec::kUnimplemented != result) {
+            return result;
+        }
+        // Fall back to point sampling.
+    }
+
     // FIXME: This was already called by onGetAndroidPixels. Can we reduce that?
     int sampleSize = options.fSampleSize;
     int nativeSampleSize;
@@ -347,3 +355,112 @@ SkCodec::Result SkSampledCodec::sampledDecode(const SkImageInfo& info, void* pix
             return SkCodec::kUnimplemented;
     }
 }
+
+SkCodec::Result SkSampledCodec::boxFilteredDecode(const SkImageInfo& info, void* pixels,
+        size_t rowBytes, const AndroidOptions& options) {
+    // Averaging is implemented for byte-per-channel color types only.
+    switch (info.colorType()) {
+        case kRGBA_8888_SkColorType:
+        case kBGRA_8888_SkColorType:
+        case kGray_8_SkColorType:
+            break;
+        default:
+            return SkCodec::kUnimplemented;
+    }
+
+    int sampleSize = options.fSampleSize;
+    int nativeSampleSize;
+    const SkISize nativeSize = this->accountForNativeScaling(&sampleSize, &nativeSampleSize);
+    if (sampleSize <= 1) {
+        // fCodec provides the entire scale natively; there is nothing to average.
+        return SkCodec::kUnimplemented;
+    }
+
+    // Account for subsetting the same way sampledDecode() does.
+    SkIRect subset;
+    int subsetY = 0;
+    int subsetWidth = nativeSize.width();
+    int subsetHeight = nativeSize.height();
+    AndroidOptions boxOptions = options;
+    if (options.fSubset) {
+        const SkIRect* subsetPtr = options.fSubset;
+        const int subsetX = subsetPtr->x() / nativeSampleSize;
+        subsetY = subsetPtr->y() / nativeSampleSize;
+        subsetWidth = get_scaled_dimension(subsetPtr->width(), nativeSampleSize);
+        subsetHeight = get_scaled_dimension(subsetPtr->height(), nativeSampleSize);
+        subset.setXYWH(subsetX, 0, subsetWidth, nativeSize.height());
+        boxOptions.fSubset = &subset;
+    }
+
+    const int sampleX = subsetWidth / info.width();
+    const int sampleY = subsetHeight / info.height();
+    if (sampleX < 1 || sampleY < 1) {
+        return SkCodec::kUnimplemented;
+    }
+
+    const SkImageInfo nativeInfo = info.makeDimensions(nativeSize);
+    SkCodec::Result result = this->codec()->startScanlineDecode(nativeInfo, &boxOptions);
+    if (SkCodec::kIncompleteInput == result || SkCodec::kErrorInInput == result) {
+        return SkCodec::kInvalidInput;
+    } else if (SkCodec::kSuccess != result) {
+        return result;
+    }
+    if (this->codec()->getScanlineOrder() != SkCodec::kTopDown_SkScanlineOrder) {
+        // The fallback restarts the decoder, so nothing is lost by bailing here.
+        return SkCodec::kUnimplemented;
+    }
+
+    const int dstWidth = info.width();
+    const int dstHeight = info.height();
+    const int bpp = SkColorTypeBytesPerPixel(info.colorType());
+
+    // One decoded source row plus one accumulator row bounds our peak memory.
+    SkAutoTMalloc<uint8_t> rowStorage(subsetWidth * bpp);
+    SkAutoTMalloc<uint32_t> accumulator(dstWidth * bpp);
+    uint8_t* row = rowStorage.get();
+
+    if (!this->codec()->skipScanlines(subsetY)) {
+        this->codec()->fillIncompleteImage(info, pixels, rowBytes, options.fZeroInitialized,
+                dstHeight, 0);
+        return SkCodec::kIncompleteInput;
+    }
+
+    int srcRow = 0;
+    for (int y = 0; y < dstHeight; y++) {
+        // Boxes tile the subset; the last row and column of boxes absorb the remainder.
+        const int rowEnd = (y == dstHeight - 1) ? subsetHeight : (y + 1) * sampleY;
+        const int boxRows = rowEnd - srcRow;
+        memset(accumulator.get(), 0, dstWidth * bpp * sizeof(uint32_t));
+        for (; srcRow < rowEnd; srcRow++) {
+            if (1 != this->codec()->getScanlines(row, 1, subsetWidth * bpp)) {
+                this->codec()->fillIncompleteImage(info, pixels, rowBytes,
+                        options.fZeroInitialized, dstHeight, y);
+                return SkCodec::kIncompleteInput;
+            }
+            for (int dx = 0; dx < dstWidth; dx++) {
+                const int colBegin = dx * sampleX;
+                const int colEnd = (dx == dstWidth - 1) ? subsetWidth : colBegin + sampleX;
+                uint32_t* acc = accumulator.get() + dx * bpp;
+                for (int sx = colBegin; sx < colEnd; sx++) {
+                    const uint8_t* px = row + sx * bpp;
+                    for (int c = 0; c < bpp; c++) {
+                        acc[c] += px[c];
+                    }
+                }
+            }
+        }
+
+        uint8_t* dstRow = SkTAddOffset<uint8_t>(pixels, y * rowBytes);
+        for (int dx = 0; dx < dstWidth; dx++) {
+            const int colBegin = dx * sampleX;
+            const int colEnd = (dx == dstWidth - 1) ? subsetWidth : colBegin + sampleX;
+            const uint32_t count = boxRows * (colEnd - colBegin);
+            const uint32_t* acc = accumulator.get() + dx * bpp;
+            uint8_t* px = dstRow + dx * bpp;
+            for (int c = 0; c < bpp; c++) {
+                px[c] = SkToU8((acc[c] + count / 2) / count);
+            }
+        }
+    }
+    return SkCodec::kSuccess;
+}
@@ -54,6 +54,17 @@ private:
     SkCodec::Result sampledDecode(const SkImageInfo& info, void* pixels, size_t rowBytes,
             const AndroidOptions& options);
 
+    /**
+     *  Like sampledDecode(), but computes each output pixel as the box-filtered average
+     *  of the source block it represents, accumulating scanlines as they are decoded so
+     *  peak memory stays bounded by a few rows.
+     *
+     *  Returns kUnimplemented when the color type or the codec's scanline support rules
+     *  it out; the caller then falls back to point sampling.
+     */
+    SkCodec::Result boxFilteredDecode(const SkImageInfo& info, void* pixels, size_t rowBytes,
+            const AndroidOptions& options);
+
     using INHERITED = SkAndroidCodec;
 };
 #endif // SkSampledCodec_DEFINED
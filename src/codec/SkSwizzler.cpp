@@ -47,12 +47,9 @@ static void sample2(void* dst, const uint8_t* src, int width, int bpp, int delta
 
 static void sample4(void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
         const SkPMColor ctable[]) {
-    src += offset;
-    uint32_t* dst32 = (uint32_t*) dst;
-    for (int x = 0; x < width; x++) {
-        dst32[x] = *((const uint32_t*) src);
-        src += deltaSrc;
-    }
+    // 32-bit pixels are the common sampled case (8888 subset/scaled decodes), so this one is
+    // vectorized in SkSwizzler_opts.h.
+    SkOpts::sample_u32((uint32_t*) dst, src + offset, deltaSrc, width);
 }
 
 static void sample6(void* dst, const uint8_t* src, int width, int bpp, int deltaSrc, int offset,
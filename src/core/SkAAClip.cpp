@@ -790,6 +790,17 @@ const uint8_t* SkAAClip::findRow(int y, int* lastYForRow) const {
     y -= fBounds.y();  // our yoffs values are relative to the top
 
     const YOffset* yoff = fRunHead->yoffsets();
+    // Entries are sorted by fY (the last y each one covers), so for clips with many
+    // distinct rows we binary search down to a handful before scanning.
+    const YOffset* stop = yoff + fRunHead->fRowCount;
+    while (stop - yoff > 8) {
+        const YOffset* mid = yoff + ((stop - yoff) >> 1);
+        if (mid->fY < y) {
+            yoff = mid + 1;
+        } else {
+            stop = mid + 1;
+        }
+    }
     while (yoff->fY < y) {
         yoff += 1;
         SkASSERT(yoff - fRunHead->yoffsets() < fRunHead->fRowCount);
@@ -1965,16 +1976,55 @@ void SkAAClipBlitter::blitV(int x, int y, int height, SkAlpha alpha) {
     }
 }
 
+// Returns true if the clip holds a single alpha value over [0, width) starting
+// at (row, initialCount), returning that value in *alpha.
+static bool row_is_uniform(const uint8_t* row, int initialCount, int width, SkAlpha* alpha) {
+    *alpha = row[1];
+    for (int n = initialCount; n < width; n += row[0]) {
+        row += 2;
+        if (row[1] != *alpha) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void SkAAClipBlitter::blitRect(int x, int y, int width, int height) {
     if (fAAClip->quickContains(x, y, x + width, y + height)) {
         fBlitter->blitRect(x, y, width, height);
         return;
     }
 
-    while (--height >= 0) {
-        this->blitH(x, y, width);
-        y += 1;
-    }
+    // Walk the clip one YOffset span at a time: each span is a run of identical rows,
+    // so we classify [x, x+width) once and then act on every row in the span. Fully
+    // empty spans are skipped outright, fully opaque ones pass through as native
+    // rects, and only the antialiased spans expand to runs (once per span, not once
+    // per scanline).
+    const int stopY = y + height;
+    do {
+        int lastY SK_INIT_TO_AVOID_WARNING;
+        const uint8_t* row = fAAClip->findRow(y, &lastY);
+        const int nextY = std::min(lastY + 1, stopY);
+        const int dy = nextY - y;
+
+        int initialCount;
+        row = fAAClip->findX(row, x, &initialCount);
+
+        SkAlpha alpha;
+        if (row_is_uniform(row, initialCount, width, &alpha) &&
+                (0 == alpha || 0xFF == alpha)) {
+            if (alpha) {
+                fBlitter->blitRect(x, y, width, dy);
+            }
+        } else {
+            this->ensureRunsAndAA();
+            expandToRuns(row, initialCount, width, fRuns, fAA);
+            for (int i = 0; i < dy; ++i) {
+                fBlitter->blitAntiH(x, y + i, fAA, fRuns);
+            }
+        }
+        y = nextY;
+    } while (y < stopY);
 }
 
 typedef void (*MergeAAProc)(const void* src, int width, const uint8_t* row,
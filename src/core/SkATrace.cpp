@@ -15,16 +15,23 @@
 #include <dlfcn.h>
 #endif
 
-SkATrace::SkATrace() : fBeginSection(nullptr), fEndSection(nullptr), fIsEnabled(nullptr) {
+#include <cstdio>
+#include <cstring>
+
+SkATrace::SkATrace()
+        : fBeginSection(nullptr), fEndSection(nullptr), fIsEnabled(nullptr), fSetCounter(nullptr) {
 #if defined(SK_BUILD_FOR_ANDROID_FRAMEWORK)
     fIsEnabled = []{ return static_cast<bool>(CC_UNLIKELY(ATRACE_ENABLED())); };
     fBeginSection = [](const char* name){ ATRACE_BEGIN(name); };
     fEndSection = []{ ATRACE_END(); };
+    fSetCounter = [](const char* name, int64_t value){ ATRACE_INT64(name, value); };
 #elif defined(SK_BUILD_FOR_ANDROID)
     if (void* lib = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL)) {
         fBeginSection = (decltype(fBeginSection))dlsym(lib, "ATrace_beginSection");
         fEndSection = (decltype(fEndSection))dlsym(lib, "ATrace_endSection");
         fIsEnabled = (decltype(fIsEnabled))dlsym(lib, "ATrace_isEnabled");
+        // ATrace_setCounter was added in API 29, so this may be left null.
+        fSetCounter = (decltype(fSetCounter))dlsym(lib, "ATrace_setCounter");
     }
 #endif
 
@@ -51,6 +58,20 @@ SkEventTracer::Handle SkATrace::addTraceEvent(char phase,
         if (TRACE_EVENT_PHASE_INSTANT == phase) {
             fEndSection();
         }
+
+        if (TRACE_EVENT_PHASE_COUNTER == phase && fSetCounter) {
+            if (1 == numArgs && 0 == strcmp(argNames[0], "value")) {
+                // TRACE_COUNTER1 uses the event name for its single sample.
+                fSetCounter(name, static_cast<int64_t>(argValues[0]));
+            } else {
+                // TRACE_COUNTER2 puts each sample on its own "name-argname" track.
+                for (int i = 0; i < numArgs; ++i) {
+                    char counterName[256];
+                    snprintf(counterName, sizeof(counterName), "%s-%s", name, argNames[i]);
+                    fSetCounter(counterName, static_cast<int64_t>(argValues[i]));
+                }
+            }
+        }
     }
     return 0;
 }
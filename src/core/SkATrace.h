@@ -12,7 +12,8 @@
 
 /**
  * This class is used to support ATrace in android apps. It hooks into the SkEventTracer system. It
- * currently supports the macros TRACE_EVENT*, TRACE_EVENT_INSTANT*, and TRACE_EVENT_BEGIN/END*.
+ * currently supports the macros TRACE_EVENT*, TRACE_EVENT_INSTANT*, TRACE_EVENT_BEGIN/END*, and
+ * TRACE_COUNTER* (on devices exposing ATrace_setCounter, API 29+).
  * For versions of these calls that take additoinal args and value pairs we currently just drop them
  * and report only the name. Since ATrace is a simple push and pop system (all traces are fully
  * nested), if using BEGIN and END you should also make sure your calls are properly nested (i.e. if
@@ -51,6 +52,7 @@ private:
     void (*fBeginSection)(const char*);
     void (*fEndSection)(void);
     bool (*fIsEnabled)(void);
+    void (*fSetCounter)(const char*, int64_t);
 };
 
 #endif
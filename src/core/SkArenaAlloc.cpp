@@ -6,6 +6,7 @@
  */
 
 #include "src/core/SkArenaAlloc.h"
+#include "src/core/SkSlabAlloc.h"
 #include <algorithm>
 #include <new>
 
@@ -57,17 +58,19 @@ void SkArenaAlloc::RunDtorsOnBlock(char* footerEnd) {
 }
 
 char* SkArenaAlloc::NextBlock(char* footerEnd) {
-    char* objEnd = footerEnd - (sizeof(char*) + sizeof(Footer));
+    char* objEnd = footerEnd - (sizeof(char*) + sizeof(uint32_t) + sizeof(Footer));
+    uint32_t blockSize;
+    memmove(&blockSize, objEnd, sizeof(uint32_t));
     char* next;
-    memmove(&next, objEnd, sizeof(char*));
+    memmove(&next, objEnd + sizeof(uint32_t), sizeof(char*));
     RunDtorsOnBlock(next);
-    delete [] objEnd;
+    sk_slab_free(objEnd, blockSize);
     return nullptr;
 }
 
 
 void SkArenaAlloc::ensureSpace(uint32_t size, uint32_t alignment) {
-    constexpr uint32_t headerSize = sizeof(Footer) + sizeof(ptrdiff_t);
+    constexpr uint32_t headerSize = sizeof(Footer) + sizeof(ptrdiff_t) + sizeof(uint32_t);
     constexpr uint32_t maxSize = std::numeric_limits<uint32_t>::max();
     constexpr uint32_t overhead = headerSize + sizeof(Footer);
     AssertRelease(size <= maxSize - overhead);
@@ -88,12 +91,14 @@ void SkArenaAlloc::ensureSpace(uint32_t size, uint32_t alignment) {
         allocationSize = (allocationSize + mask) & ~mask;
     }
 
-    char* newBlock = new char[allocationSize];
+    char* newBlock = static_cast<char*>(sk_slab_alloc(allocationSize));
 
     auto previousDtor = fDtorCursor;
     fCursor = newBlock;
     fDtorCursor = newBlock;
     fEnd = fCursor + allocationSize;
+    // The block records its own size so NextBlock() can return it to the slab backend.
+    this->installRaw(allocationSize);
     this->installRaw(previousDtor);
     this->installFooter(NextBlock, 0);
 }
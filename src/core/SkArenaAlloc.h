@@ -190,6 +190,13 @@ public:
         return objStart;
     }
 
+protected:
+    // True while allocation is still being served out of the given block; false once the
+    // arena has moved on to chained heap blocks.
+    bool usingBlock(const char* block, size_t blockSize) const {
+        return fEnd == block + blockSize;
+    }
+
 private:
     static void AssertRelease(bool cond) { if (!cond) { ::abort(); } }
     static uint32_t ToU32(size_t v) {
@@ -296,6 +303,12 @@ public:
     // Destroy all allocated objects, free any heap allocations.
     void reset();
 
+    // Returns true if allocations have spilled past the block supplied at construction into
+    // chained heap blocks - that is, the block was too small for the peak working set.
+    bool hasOverflowed() const {
+        return !this->usingBlock(fFirstBlock, fFirstSize);
+    }
+
 private:
     char* const    fFirstBlock;
     const uint32_t fFirstSize;
@@ -11,7 +11,9 @@
 #include "include/private/SkMacros.h"
 #include "src/core/SkArenaAlloc.h"
 #include "src/core/SkBlitter.h"
+#include "src/core/SkBlitterChooseCache.h"
 #include "src/core/SkDraw.h"
+#include "src/core/SkMatrixProvider.h"
 #include "src/core/SkRasterClip.h"
 
 class SkMatrix;
@@ -35,6 +37,25 @@ public:
         if (!matrixProvider) {
             matrixProvider = draw.fMatrixProvider;
         }
+        if (SkBlitterChooseCache* cache = draw.fBlitterChooseCache;
+            cache && !drawCoverage && !draw.fCoverage && !draw.fRC->clipShader()) {
+            const SkMatrix& ctm = matrixProvider->localToDevice();
+            if (SkBlitter* cached = cache->find(draw.fDst, ctm, paint)) {
+                return fBlitter = cached;
+            }
+            SkArenaAlloc* alloc = cache->rekey(draw.fDst, ctm, paint);
+            fBlitter = SkBlitter::Choose(draw.fDst, *matrixProvider, cache->paint(), alloc,
+                                         false, nullptr);
+            // A blitter that keeps a reference to the matrix provider (SkVMBlitter builds its
+            // blit programs lazily from it) must not outlive this draw, since providers are
+            // routinely stack-allocated. Leave the entry unpopulated so find() misses; the
+            // blitter itself remains valid for this draw because the entry's arena lives until
+            // the next rekey().
+            if (!fBlitter->retainsMatrixProvider()) {
+                cache->setBlitter(fBlitter);
+            }
+            return fBlitter;
+        }
         fBlitter = SkBlitter::Choose(draw.fDst, *matrixProvider, paint, &fAlloc, drawCoverage,
                                      draw.fRC->clipShader());
 
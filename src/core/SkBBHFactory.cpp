@@ -16,3 +16,15 @@ void SkBBoxHierarchy::insert(const SkRect rects[], const Metadata[], int N) {
     // Ignore Metadata.
     this->insert(rects, N);
 }
+
+void SkBBoxHierarchy::searchRanges(const SkRect& query, std::vector<OpRange>* results) const {
+    std::vector<int> ops;
+    this->search(query, &ops);
+    for (int op : ops) {
+        if (!results->empty() && results->back().fEnd == op) {
+            results->back().fEnd = op + 1;
+        } else {
+            results->push_back({op, op + 1});
+        }
+    }
+}
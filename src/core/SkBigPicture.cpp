@@ -10,6 +10,7 @@
 #include "src/core/SkPictureCommon.h"
 #include "src/core/SkRecord.h"
 #include "src/core/SkRecordDraw.h"
+#include "src/core/SkRecordSizeProfile.h"
 #include "src/core/SkTraceEvent.h"
 
 SkBigPicture::SkBigPicture(const SkRect& cull,
@@ -82,6 +83,10 @@ size_t SkBigPicture::approximateBytesUsed() const {
     return bytes;
 }
 
+void SkBigPicture::computeSizeProfile(SkRecordSizeProfile* profile) const {
+    SkRecordComputeSizeProfile(*fRecord, profile);
+}
+
 int SkBigPicture::drawableCount() const {
     return fDrawablePicts ? fDrawablePicts->count() : 0;
 }
@@ -18,6 +18,7 @@
 class SkBBoxHierarchy;
 class SkMatrix;
 class SkRecord;
+struct SkRecordSizeProfile;
 
 // An implementation of SkPicture supporting an arbitrary number of drawing commands.
 class SkBigPicture final : public SkPicture {
@@ -47,6 +48,9 @@ public:
     SkRect cullRect() const override;
     int approximateOpCount(bool nested) const override;
     size_t approximateBytesUsed() const override;
+
+    // Attributes this picture's in-memory size to its ops; see SkRecordSizeProfile.
+    void computeSizeProfile(SkRecordSizeProfile*) const;
     const SkBigPicture* asSkBigPicture() const override { return this; }
 
 // Used by GrLayerHoister
@@ -195,6 +195,7 @@ public:
         fMatrixProvider = dev;
         fRC = &dev->fRCStack.rc();
         fCoverage = dev->accessCoverage();
+        fBlitterChooseCache = &dev->fBlitterChooseCache;
     }
 };
 
@@ -538,6 +539,54 @@ void SkBitmapDevice::drawImageRect(const SkImage* image, const SkRect* src, cons
     this->drawRect(*dstPtr, paintWithShader);
 }
 
+void SkBitmapDevice::drawEdgeAAImageSet(const SkCanvas::ImageSetEntry images[], int count,
+                                        const SkPoint dstClips[], const SkMatrix preViewMatrices[],
+                                        const SkSamplingOptions& sampling, const SkPaint& paint,
+                                        SkCanvas::SrcRectConstraint constraint) {
+    // The base implementation draws each entry through drawImageRect, which resolves a lazy image
+    // (probing the bitmap cache, possibly decoding) every time it appears. Bulk callers commonly
+    // repeat a small set of images many times per call, so resolve each unique lazy image to
+    // raster once up front and draw from the resolved copies. Entries are not re-sorted by image:
+    // the set's draw order is visible wherever entries overlap.
+    bool anyLazy = false;
+    for (int i = 0; i < count; ++i) {
+        if (images[i].fImage && images[i].fImage->isLazyGenerated()) {
+            anyLazy = true;
+            break;
+        }
+    }
+    if (!anyLazy) {
+        this->INHERITED::drawEdgeAAImageSet(images, count, dstClips, preViewMatrices, sampling,
+                                            paint, constraint);
+        return;
+    }
+
+    SkTHashMap<const SkImage*, sk_sp<const SkImage>> resolved;
+    SkAutoTArray<SkCanvas::ImageSetEntry> entries(count);
+    for (int i = 0; i < count; ++i) {
+        entries[i] = images[i];
+        const SkImage* image = entries[i].fImage.get();
+        if (!image || !image->isLazyGenerated()) {
+            continue;
+        }
+        if (sk_sp<const SkImage>* cached = resolved.find(image)) {
+            entries[i].fImage = *cached;
+            continue;
+        }
+        SkBitmap bm;
+        if (as_IB(image)->getROPixels(nullptr, &bm)) {
+            sk_sp<const SkImage> raster = bm.asImage();
+            entries[i].fImage = raster;
+            resolved.set(image, std::move(raster));
+        } else {
+            // Leave the original image in place; drawImageRect will skip it the same way.
+            resolved.set(image, entries[i].fImage);
+        }
+    }
+    this->INHERITED::drawEdgeAAImageSet(entries.get(), count, dstClips, preViewMatrices, sampling,
+                                        paint, constraint);
+}
+
 void SkBitmapDevice::onDrawGlyphRunList(const SkGlyphRunList& glyphRunList, const SkPaint& paint) {
     SkASSERT(!glyphRunList.hasRSXForm());
     LOOP_TILER( drawGlyphRunList(glyphRunList, paint, &fGlyphPainter), nullptr )
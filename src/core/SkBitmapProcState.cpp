@@ -383,6 +383,45 @@ static void Repeat_S32_D32_nofilter_trans_shaderproc(const void* sIn,
     }
 }
 
+static void Mirror_S32_D32_nofilter_trans_shaderproc(const void* sIn,
+                                                     int x, int y,
+                                                     SkPMColor* colors,
+                                                     int count) {
+    const SkBitmapProcState& s = *static_cast<const SkBitmapProcState*>(sIn);
+    SkASSERT(s.fInvMatrix.isTranslate());
+    SkASSERT(count > 0 && colors != nullptr);
+    SkASSERT(!s.fBilerp);
+
+    const int stopX = s.fPixmap.width();
+    const int stopY = s.fPixmap.height();
+    int ix = s.fFilterOneX + x;
+    int iy = sk_int_mirror(s.fFilterOneY + y, stopY);
+    const SkPMColor* row = s.fPixmap.addr32(0, iy);
+
+    // The pattern repeats every 2*stopX: a forward copy of the row, then the row reversed.
+    ix = sk_int_mod(ix, 2 * stopX);
+    for (;;) {
+        if (ix < stopX) {
+            int n = std::min(stopX - ix, count);
+            memcpy(colors, row + ix, n * sizeof(SkPMColor));
+            colors += n;
+            count -= n;
+            ix = stopX;
+        } else {
+            int start = 2*stopX - 1 - ix;   // walks down toward 0
+            int n = std::min(start + 1, count);
+            for (int i = 0; i < n; i++) {
+                *colors++ = row[start - i];
+            }
+            count -= n;
+            ix = 0;
+        }
+        if (0 == count) {
+            return;
+        }
+    }
+}
+
 static inline void filter_32_alpha(unsigned t,
                                    SkPMColor color0,
                                    SkPMColor color1,
@@ -577,6 +616,12 @@ SkBitmapProcState::ShaderProc32 SkBitmapProcState::chooseShaderProc32() {
         }
         return DoNothing_shaderproc;
     }
+    if (SkTileMode::kMirror == tx && SkTileMode::kMirror == ty) {
+        if (this->setupForTranslate()) {
+            return Mirror_S32_D32_nofilter_trans_shaderproc;
+        }
+        return DoNothing_shaderproc;
+    }
     return nullptr;
 }
 
@@ -14,6 +14,7 @@
 #include "include/private/SkTo.h"
 #include "src/core/SkAntiRun.h"
 #include "src/core/SkArenaAlloc.h"
+#include "src/core/SkBlitterSpecializations.h"
 #include "src/core/SkMask.h"
 #include "src/core/SkMaskFilterBase.h"
 #include "src/core/SkMatrixProvider.h"
@@ -771,6 +772,15 @@ SkBlitter* SkBlitter::Choose(const SkPixmap& device,
     SkMatrix ctm = matrixProvider.localToDevice();
     // We'll end here for many interesting cases: color spaces, color filters, most color types.
     if (clipShader || !UseLegacyBlitter(device, *paint, ctm)) {
+#if !defined(SK_FORCE_RASTER_PIPELINE_BLITTER)
+        // First try the build-time specialization table: fused blitters for hot configurations
+        // (e.g. solid-color kSrc on kN32) that the legacy blitters never covered.
+        if (!clipShader && !gSkForceRasterPipelineBlitter) {
+            if (SkBlitter* specialized = SkCreateSpecializedBlitter(device, *paint, alloc)) {
+                return specialized;
+            }
+        }
+#endif
         return create_SkRP_or_SkVMBlitter();
     }
 
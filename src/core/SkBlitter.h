@@ -113,6 +113,13 @@ public:
      */
     virtual bool isNullBlitter() const;
 
+    /**
+     *  Returns true if this blitter retains a reference to state owned by the draw that created
+     *  it (e.g. its SkMatrixProvider), and so must not outlive that draw. Default impl returns
+     *  false.
+     */
+    virtual bool retainsMatrixProvider() const { return false; }
+
     /**
      * Special methods for blitters that can blit more than one row at a time.
      * This function returns the number of rows that this blitter could optimally
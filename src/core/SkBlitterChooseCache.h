@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkBlitterChooseCache_DEFINED
+#define SkBlitterChooseCache_DEFINED
+
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPixmap.h"
+#include "src/core/SkArenaAlloc.h"
+#include "src/core/SkImagePriv.h"
+
+#include <memory>
+
+class SkBlitter;
+
+/**
+ *  A single-entry memo for SkBlitter::Choose, owned by a raster device and consulted through
+ *  SkDraw. A run of draws sharing paint, matrix, and destination -- the common shape of UI
+ *  fills -- then builds its blitter (and the raster pipeline behind it) once rather than per
+ *  draw. The entry is replaced whenever any part of the key changes.
+ */
+class SkBlitterChooseCache {
+public:
+    SkBlitter* find(const SkPixmap& dst, const SkMatrix& ctm, const SkPaint& paint) const {
+        if (fBlitter &&
+            fKeyDst.addr() == dst.addr() && fKeyDst.rowBytes() == dst.rowBytes() &&
+            fKeyDst.info() == dst.info() &&
+            fKeyCTM == ctm && fKeyPaint == paint) {
+            return fBlitter;
+        }
+        return nullptr;
+    }
+
+    // Re-keys the entry and returns the allocator the new blitter (and its stage contexts)
+    // must be built in; follow up with setBlitter() if the blitter is safe to cache (see
+    // SkBlitter::retainsMatrixProvider()). Build against paint() rather than the caller's
+    // paint so nothing outlives what the blitter may reference.
+    SkArenaAlloc* rekey(const SkPixmap& dst, const SkMatrix& ctm, const SkPaint& paint) {
+        fKeyDst = dst;
+        fKeyCTM = ctm;
+        fKeyPaint = paint;
+        fBlitter = nullptr;
+        fAlloc = std::make_unique<SkArenaAlloc>(kSkBlitterContextSize);
+        return fAlloc.get();
+    }
+
+    const SkPaint& paint() const { return fKeyPaint; }
+
+    void setBlitter(SkBlitter* blitter) { fBlitter = blitter; }
+
+private:
+    SkPixmap fKeyDst;
+    SkMatrix fKeyCTM;
+    SkPaint  fKeyPaint;
+
+    std::unique_ptr<SkArenaAlloc> fAlloc;
+    SkBlitter* fBlitter = nullptr;  // owned by fAlloc; null until setBlitter()
+};
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkBlitterSpecializations_DEFINED
+#define SkBlitterSpecializations_DEFINED
+
+#include "include/core/SkBlendMode.h"
+#include "include/core/SkImageInfo.h"
+
+class SkArenaAlloc;
+class SkBlitter;
+class SkPaint;
+class SkPixmap;
+
+/**
+ * A build-time table of fully fused blitters, tried by SkBlitter::Choose ahead of the general
+ * raster-pipeline path for hot paint fingerprints the legacy blitters do not cover. Each entry
+ * names a (dst color type, blend mode, blitter class) tuple; profiles of an app can add rows for
+ * their own hot configurations. Every class listed must provide
+ *
+ *     static bool Supports(const SkPixmap& device, const SkPaint& paint);
+ *
+ * to veto paints whose remaining state (e.g. color alpha) the specialization cannot handle.
+ * The factory below has already rejected shaders, color filters, dither, unpremul and
+ * non-sRGB-like destinations, so entries only see solid-color paints with the legacy color
+ * treatment.
+ */
+#define SK_BLITTER_SPECIALIZATIONS(M) \
+    M(kN32_SkColorType, SkBlendMode::kSrc, SkARGB32_Src_Blitter)
+
+/**
+ * Returns a specialized blitter for (device, paint) from the table above, or nullptr to let the
+ * caller fall through to the general path. Never returns nullptr-blitter placeholders; a non-null
+ * result draws the paint exactly.
+ */
+SkBlitter* SkCreateSpecializedBlitter(const SkPixmap& device,
+                                      const SkPaint& paint,
+                                      SkArenaAlloc* alloc);
+
+#endif
@@ -8,7 +8,10 @@
 #include "include/core/SkShader.h"
 #include "include/private/SkColorData.h"
 #include "include/private/SkVx.h"
+#include "src/core/SkArenaAlloc.h"
+#include "src/core/SkBlitterSpecializations.h"
 #include "src/core/SkCoreBlitters.h"
+#include "src/core/SkMaskFilterBase.h"
 #include "src/core/SkUtils.h"
 #include "src/core/SkXfermodePriv.h"
 
@@ -1418,3 +1421,228 @@ void SkARGB32_Shader_Blitter::blitV(int x, int y, int height, SkAlpha alpha) {
         }
     }
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Specialized blitters from the SK_BLITTER_SPECIALIZATIONS table.
+
+SkARGB32_Src_Blitter::SkARGB32_Src_Blitter(const SkPixmap& device, const SkPaint& paint)
+        : INHERITED(device) {
+    fColor = paint.getColor();
+    fPMColor = SkPreMultiplyColor(fColor);
+}
+
+bool SkARGB32_Src_Blitter::Supports(const SkPixmap& device, const SkPaint&) {
+    SkASSERT(device.colorType() == kN32_SkColorType);
+    return true;    // any solid color, any alpha
+}
+
+const SkPixmap* SkARGB32_Src_Blitter::justAnOpaqueColor(uint32_t* value) {
+    if (0xFF == SkGetPackedA32(fPMColor)) {
+        *value = fPMColor;
+        return &fDevice;
+    }
+    return nullptr;
+}
+
+void SkARGB32_Src_Blitter::blitH(int x, int y, int width) {
+    SkASSERT(x >= 0 && y >= 0 && x + width <= fDevice.width());
+
+    // Src ignores the dst at full coverage, so every span is a memset.
+    sk_memset32(fDevice.writable_addr32(x, y), fPMColor, width);
+}
+
+void SkARGB32_Src_Blitter::blitRect(int x, int y, int width, int height) {
+    SkASSERT(x >= 0 && y >= 0 && x + width <= fDevice.width() && y + height <= fDevice.height());
+
+    SkOpts::rect_memset32(fDevice.writable_addr32(x, y), fPMColor, width,
+                          fDevice.rowBytes(), height);
+}
+
+void SkARGB32_Src_Blitter::blitAntiH(int x, int y, const SkAlpha antialias[],
+                                     const int16_t runs[]) {
+    uint32_t* device = fDevice.writable_addr32(x, y);
+
+    for (;;) {
+        int count = runs[0];
+        SkASSERT(count >= 0);
+        if (count <= 0) {
+            return;
+        }
+        unsigned aa = antialias[0];
+        if (aa == 255) {
+            sk_memset32(device, fPMColor, count);
+        } else if (aa) {
+            // Src at partial coverage lerps the dst toward the (premultiplied) src color.
+            unsigned scale = SkAlpha255To256(aa);
+            for (int i = 0; i < count; i++) {
+                device[i] = SkFourByteInterp256(fPMColor, device[i], scale);
+            }
+        }
+        runs += count;
+        antialias += count;
+        device += count;
+    }
+}
+
+void SkARGB32_Src_Blitter::blitV(int x, int y, int height, SkAlpha alpha) {
+    if (alpha == 0) {
+        return;
+    }
+
+    uint32_t* device = fDevice.writable_addr32(x, y);
+    size_t rowBytes = fDevice.rowBytes();
+
+    if (alpha == 255) {
+        while (--height >= 0) {
+            device[0] = fPMColor;
+            device = (uint32_t*)((char*)device + rowBytes);
+        }
+    } else {
+        unsigned scale = SkAlpha255To256(alpha);
+        while (--height >= 0) {
+            device[0] = SkFourByteInterp256(fPMColor, device[0], scale);
+            device = (uint32_t*)((char*)device + rowBytes);
+        }
+    }
+}
+
+void SkARGB32_Src_Blitter::blitAntiH2(int x, int y, U8CPU a0, U8CPU a1) {
+    uint32_t* device = fDevice.writable_addr32(x, y);
+    SkDEBUGCODE((void)fDevice.writable_addr32(x + 1, y);)
+
+    device[0] = SkFourByteInterp(fPMColor, device[0], a0);
+    device[1] = SkFourByteInterp(fPMColor, device[1], a1);
+}
+
+void SkARGB32_Src_Blitter::blitAntiV2(int x, int y, U8CPU a0, U8CPU a1) {
+    uint32_t* device = fDevice.writable_addr32(x, y);
+    SkDEBUGCODE((void)fDevice.writable_addr32(x, y + 1);)
+
+    device[0] = SkFourByteInterp(fPMColor, device[0], a0);
+    device = (uint32_t*)((char*)device + fDevice.rowBytes());
+    device[0] = SkFourByteInterp(fPMColor, device[0], a1);
+}
+
+// Like blend_lcd16 but for kSrc: each channel of an (assumed opaque) dst moves toward the
+// premultiplied src channel by that channel's coverage, with no extra srcA modulation.
+static inline SkPMColor blend_lcd16_src(SkPMColor src, SkPMColor dst, uint16_t mask) {
+    if (mask == 0) {
+        return dst;
+    }
+
+    int maskR = SkGetPackedR16(mask) >> (SK_R16_BITS - 5);
+    int maskG = SkGetPackedG16(mask) >> (SK_G16_BITS - 5);
+    int maskB = SkGetPackedB16(mask) >> (SK_B16_BITS - 5);
+
+    maskR = upscale_31_to_32(maskR);
+    maskG = upscale_31_to_32(maskG);
+    maskB = upscale_31_to_32(maskB);
+
+    // LCD blitting is only supported if the dst is known/required
+    // to be opaque
+    return SkPackARGB32(0xFF,
+                        blend_32(SkGetPackedR32(src), SkGetPackedR32(dst), maskR),
+                        blend_32(SkGetPackedG32(src), SkGetPackedG32(dst), maskG),
+                        blend_32(SkGetPackedB32(src), SkGetPackedB32(dst), maskB));
+}
+
+void SkARGB32_Src_Blitter::blitMask(const SkMask& mask, const SkIRect& clip) {
+    SkASSERT(mask.fBounds.contains(clip));
+
+    int x = clip.fLeft,
+        y = clip.fTop,
+        width = clip.width(),
+        height = clip.height();
+
+    if (mask.fFormat == SkMask::kA8_Format) {
+        uint32_t* dstRow = fDevice.writable_addr32(x, y);
+        const uint8_t* maskRow = mask.getAddr8(x, y);
+        while (height --> 0) {
+            for (int i = 0; i < width; i++) {
+                unsigned aa = maskRow[i];
+                if (aa == 255) {
+                    dstRow[i] = fPMColor;
+                } else if (aa) {
+                    dstRow[i] = SkFourByteInterp(fPMColor, dstRow[i], aa);
+                }
+            }
+            dstRow  = (uint32_t*)((char*)dstRow + fDevice.rowBytes());
+            maskRow += mask.fRowBytes;
+        }
+        return;
+    }
+
+    if (mask.fFormat == SkMask::kLCD16_Format) {
+        uint32_t* dstRow = fDevice.writable_addr32(x, y);
+        const uint16_t* maskRow = (const uint16_t*)mask.getAddr(x, y);
+        while (height --> 0) {
+            for (int i = 0; i < width; i++) {
+                dstRow[i] = blend_lcd16_src(fPMColor, dstRow[i], maskRow[i]);
+            }
+            dstRow  = (uint32_t*)((char*)dstRow + fDevice.rowBytes());
+            maskRow = (const uint16_t*)((const char*)maskRow + mask.fRowBytes);
+        }
+        return;
+    }
+
+    if (mask.fFormat == SkMask::kBW_Format) {
+        // Src at full coverage is just the color, same as the opaque BW blit.
+        SkARGB32_BlitBW(fDevice, mask, clip, fPMColor);
+        return;
+    }
+
+    if (mask.fFormat == SkMask::kARGB32_Format) {
+        // Color glyphs carry their own pixels: Src replaces the dst with the glyph pixel,
+        // modulated by the paint's alpha.
+        unsigned scale = SkAlpha255To256(SkColorGetA(fColor));
+        uint32_t* dstRow = fDevice.writable_addr32(x, y);
+        const SkPMColor* srcRow = reinterpret_cast<const SkPMColor*>(mask.getAddr8(x, y));
+        while (height --> 0) {
+            for (int i = 0; i < width; i++) {
+                dstRow[i] = SkAlphaMulQ(srcRow[i], scale);
+            }
+            dstRow = (uint32_t*)((char*)dstRow + fDevice.rowBytes());
+            srcRow = (const SkPMColor*)((const char*)srcRow + mask.fRowBytes);
+        }
+        return;
+    }
+
+    SK_ABORT("Mask format not handled.");
+}
+
+SkBlitter* SkCreateSpecializedBlitter(const SkPixmap& device,
+                                      const SkPaint& paint,
+                                      SkArenaAlloc* alloc) {
+    // The table entries are solid-color blitters using the legacy color treatment, so weed out
+    // everything that needs the full pipeline: shaders, color filters, dither, unpremul or
+    // non-sRGB-like dsts, 3D masks, and colors that don't fit in bytes.
+    if (paint.getShader() || paint.getColorFilter() || paint.isDither()) {
+        return nullptr;
+    }
+    if (device.alphaType() == kUnpremul_SkAlphaType) {
+        return nullptr;
+    }
+    const SkMaskFilterBase* mf = as_MFB(paint.getMaskFilter());
+    if (mf && mf->getFormat() == SkMask::k3D_Format) {
+        return nullptr;
+    }
+    const auto mode = paint.asBlendMode();
+    if (!mode) {
+        return nullptr;
+    }
+    if (auto cs = device.colorSpace()) {
+        if (!cs->isSRGB() || !paint.getColor4f().fitsInBytes()) {
+            return nullptr;
+        }
+    }
+
+#define M(ct, bm, Blitter)                                           \
+    if (device.colorType() == ct && mode.value() == bm &&            \
+        Blitter::Supports(device, paint)) {                          \
+        return alloc->make<Blitter>(device, paint);                  \
+    }
+    SK_BLITTER_SPECIALIZATIONS(M)
+#undef M
+
+    return nullptr;
+}
@@ -99,6 +99,80 @@ private:
     using INHERITED = SkSpriteBlitter;
 };
 
+// Srcover sprites of F16 or 1010102 pixels onto a same-configured dst, one SkOpts row kernel
+// per scanline. (Opaque sources and kSrc take the Memcpy blitter before we're consulted.)
+class SkSpriteBlitter_F16_srcover final : public SkSpriteBlitter {
+public:
+    SkSpriteBlitter_F16_srcover(const SkPixmap& src) : INHERITED(src) {}
+
+    void blitRect(int x, int y, int width, int height) override {
+        SkASSERT(width > 0 && height > 0);
+        uint64_t* dst = fDst.writable_addr64(x, y);
+        const uint64_t* src = fSource.addr64(x - fLeft, y - fTop);
+        const size_t dstRB = fDst.rowBytes();
+        const size_t srcRB = fSource.rowBytes();
+
+        while (height --> 0) {
+            SkOpts::blit_row_f16_srcover(dst, src, width);
+            dst = (uint64_t*)((char*)dst + dstRB);
+            src = (const uint64_t*)((const char*)src + srcRB);
+        }
+    }
+
+private:
+    using INHERITED = SkSpriteBlitter;
+};
+
+class SkSpriteBlitter_1010102_srcover final : public SkSpriteBlitter {
+public:
+    SkSpriteBlitter_1010102_srcover(const SkPixmap& src) : INHERITED(src) {}
+
+    void blitRect(int x, int y, int width, int height) override {
+        SkASSERT(width > 0 && height > 0);
+        uint32_t* dst = fDst.writable_addr32(x, y);
+        const uint32_t* src = fSource.addr32(x - fLeft, y - fTop);
+        const size_t dstRB = fDst.rowBytes();
+        const size_t srcRB = fSource.rowBytes();
+
+        while (height --> 0) {
+            SkOpts::blit_row_1010102_srcover(dst, src, width);
+            dst = (uint32_t*)((char*)dst + dstRB);
+            src = (const uint32_t*)((const char*)src + srcRB);
+        }
+    }
+
+private:
+    using INHERITED = SkSpriteBlitter;
+};
+
+SkSpriteBlitter* SkSpriteBlitter::ChooseF16(const SkPixmap& source, const SkPaint& paint,
+                                            SkArenaAlloc* allocator) {
+    SkASSERT(allocator != nullptr);
+
+    if (paint.getColorFilter() != nullptr || paint.getMaskFilter() != nullptr ||
+        paint.getAlpha() != 0xFF || !paint.isSrcOver()) {
+        return nullptr;
+    }
+    if (source.colorType() == kRGBA_F16_SkColorType) {
+        return allocator->make<SkSpriteBlitter_F16_srcover>(source);
+    }
+    return nullptr;
+}
+
+SkSpriteBlitter* SkSpriteBlitter::Choose1010102(const SkPixmap& source, const SkPaint& paint,
+                                                SkArenaAlloc* allocator) {
+    SkASSERT(allocator != nullptr);
+
+    if (paint.getColorFilter() != nullptr || paint.getMaskFilter() != nullptr ||
+        paint.getAlpha() != 0xFF || !paint.isSrcOver()) {
+        return nullptr;
+    }
+    if (source.colorType() == kRGBA_1010102_SkColorType) {
+        return allocator->make<SkSpriteBlitter_1010102_srcover>(source);
+    }
+    return nullptr;
+}
+
 class SkRasterPipelineSpriteBlitter : public SkSpriteBlitter {
 public:
     SkRasterPipelineSpriteBlitter(const SkPixmap& src, SkArenaAlloc* alloc,
@@ -135,7 +209,7 @@ public:
                                             : kPremul_SkAlphaType;
             fAlloc->make<SkColorSpaceXformSteps>(srcCS, srcAT,
                                                  dstCS, kPremul_SkAlphaType)
-                ->apply(&p);
+                ->apply(&p, fSource.colorType());
         }
         if (fPaintColor.fA != 1.0f) {
             p.append(SkRasterPipeline::scale_1_float, &fPaintColor.fA);
@@ -212,6 +286,12 @@ SkBlitter* SkBlitter::ChooseSprite(const SkPixmap& dst, const SkPaint& paint,
                 case kAlpha_8_SkColorType:
                     blitter = SkSpriteBlitter::ChooseLA8(source, paint, alloc);
                     break;
+                case kRGBA_F16_SkColorType:
+                    blitter = SkSpriteBlitter::ChooseF16(source, paint, alloc);
+                    break;
+                case kRGBA_1010102_SkColorType:
+                    blitter = SkSpriteBlitter::Choose1010102(source, paint, alloc);
+                    break;
                 default:
                     break;
             }
@@ -238,11 +238,17 @@ public:
     SkM44 fMatrix;
     int fDeferredSaveCount;
 
+    // True until this level's save has been pushed onto the top device's clip stack. The push
+    // is deferred until the first clip op at this level, so matrix-only save/restore pairs skip
+    // the device's clip bookkeeping entirely.
+    bool fDeviceSaveDeferred;
+
     MCRec(SkBaseDevice* device)
             : fLayer(nullptr)
             , fDevice(device)
             , fBackImage(nullptr)
-            , fDeferredSaveCount(0) {
+            , fDeferredSaveCount(0)
+            , fDeviceSaveDeferred(false) {
         SkASSERT(fDevice);
         fMatrix.setIdentity();
         inc_rec();
@@ -252,7 +258,10 @@ public:
             : fLayer(nullptr)
             , fDevice(prev.fDevice)
             , fMatrix(prev.fMatrix)
-            , fDeferredSaveCount(0) {
+            , fDeferredSaveCount(0)
+            , fDeviceSaveDeferred(true)
+            , fMatrix33(prev.fMatrix33)
+            , fMatrix33Valid(prev.fMatrix33Valid) {
         SkASSERT(fDevice);
         inc_rec();
     }
@@ -260,6 +269,18 @@ public:
         dec_rec();
     }
 
+    // Lazily-computed 3x3 projection of fMatrix, for hot paths that still consume SkMatrix
+    // (getTotalMatrix(), quick rejects, etc). Callers that mutate fMatrix must dirty the cache.
+    const SkMatrix& matrix33() {
+        if (!fMatrix33Valid) {
+            fMatrix33 = fMatrix.asM33();
+            fMatrix33Valid = true;
+        }
+        return fMatrix33;
+    }
+
+    void dirtyMatrix33() { fMatrix33Valid = false; }
+
     void newLayer(sk_sp<SkBaseDevice> layerDevice, sk_sp<SkImageFilter> filter,
                   const SkPaint& restorePaint) {
         SkASSERT(!fBackImage);
@@ -273,7 +294,13 @@ public:
         SkASSERT(fDeferredSaveCount == 0);
         fDevice = device;
         fMatrix.setIdentity();
+        fMatrix33Valid = false;
+        fDeviceSaveDeferred = false;
     }
+
+private:
+    SkMatrix fMatrix33;
+    bool     fMatrix33Valid = false;
 };
 
 class SkCanvas::AutoUpdateQRBounds {
@@ -352,39 +379,45 @@ public:
                             CheckForOverwrite checkOverwrite = CheckForOverwrite::kNo,
                             SkCanvas::ShaderOverrideOpacity overrideOpacity =
                                     SkCanvas::kNone_ShaderOverrideOpacity)
-            : fPaint(paint)
+            : fOrigPaint(paint)
             , fCanvas(canvas)
             , fTempLayerForImageFilter(false) {
         SkDEBUGCODE(fSaveCount = canvas->getSaveCount();)
 
         if (checkOverwrite == CheckForOverwrite::kYes) {
-            canvas->predrawNotify(rawBounds, &fPaint, overrideOpacity);
+            canvas->predrawNotify(rawBounds, &paint, overrideOpacity);
         } else {
             canvas->predrawNotify();
         }
 
-        if (fPaint.getImageFilter() && !image_to_color_filter(&fPaint)) {
-            // The draw paint has an image filter that couldn't be simplified to an equivalent
-            // color filter, so we have to inject an automatic saveLayer().
-            SkPaint restorePaint;
-            restorePaint.setImageFilter(fPaint.refImageFilter());
-            restorePaint.setBlendMode(fPaint.getBlendMode());
-
-            // Remove the restorePaint fields from our "working" paint
-            fPaint.setImageFilter(nullptr);
-            fPaint.setBlendMode(SkBlendMode::kSrcOver);
-
-            SkRect storage;
-            if (rawBounds && fPaint.canComputeFastBounds()) {
-                // Make rawBounds include all paint outsets except for those due to image filters.
-                // At this point, fPaint's image filter has been moved to 'restorePaint'.
-                SkASSERT(!fPaint.getImageFilter());
-                rawBounds = &fPaint.computeFastBounds(*rawBounds, &storage);
+        if (paint.getImageFilter()) {
+            // We only need a mutable copy of the paint when an image filter has to be resolved;
+            // every other draw uses the caller's paint directly, which skips copying (and later
+            // dropping) the refs on the paint's effects.
+            SkPaint* workingPaint = fLazyPaint.set(paint);
+            if (!image_to_color_filter(workingPaint)) {
+                // The draw paint has an image filter that couldn't be simplified to an equivalent
+                // color filter, so we have to inject an automatic saveLayer().
+                SkPaint restorePaint;
+                restorePaint.setImageFilter(workingPaint->refImageFilter());
+                restorePaint.setBlendMode(workingPaint->getBlendMode());
+
+                // Remove the restorePaint fields from our "working" paint
+                workingPaint->setImageFilter(nullptr);
+                workingPaint->setBlendMode(SkBlendMode::kSrcOver);
+
+                SkRect storage;
+                if (rawBounds && workingPaint->canComputeFastBounds()) {
+                    // Make rawBounds include all paint outsets except for those due to image
+                    // filters. At this point, the image filter has been moved to 'restorePaint'.
+                    SkASSERT(!workingPaint->getImageFilter());
+                    rawBounds = &workingPaint->computeFastBounds(*rawBounds, &storage);
+                }
+
+                (void)canvas->internalSaveLayer(SkCanvas::SaveLayerRec(rawBounds, &restorePaint),
+                                                SkCanvas::kFullLayer_SaveLayerStrategy);
+                fTempLayerForImageFilter = true;
             }
-
-            (void)canvas->internalSaveLayer(SkCanvas::SaveLayerRec(rawBounds, &restorePaint),
-                                            SkCanvas::kFullLayer_SaveLayerStrategy);
-            fTempLayerForImageFilter = true;
         }
     }
 
@@ -395,10 +428,13 @@ public:
         SkASSERT(fCanvas->getSaveCount() == fSaveCount);
     }
 
-    const SkPaint& paint() const { return fPaint; }
+    const SkPaint& paint() const {
+        return fLazyPaint.isValid() ? *fLazyPaint.get() : fOrigPaint;
+    }
 
 private:
-    SkPaint         fPaint;
+    const SkPaint&  fOrigPaint;
+    SkTLazy<SkPaint> fLazyPaint; // only set when the paint has to be modified
     SkCanvas*       fCanvas;
     bool            fTempLayerForImageFilter;
 
@@ -617,6 +653,13 @@ void SkCanvas::checkForDeferredSave() {
     }
 }
 
+void SkCanvas::checkForDeferredDeviceSave() {
+    if (fMCRec->fDeviceSaveDeferred) {
+        fMCRec->fDeviceSaveDeferred = false;
+        this->topDevice()->save();
+    }
+}
+
 int SkCanvas::getSaveCount() const {
 #ifdef SK_DEBUG
     int count = 0;
@@ -679,7 +722,8 @@ void SkCanvas::restoreToCount(int count) {
 void SkCanvas::internalSave() {
     fMCRec = new (fMCStack.push_back()) MCRec(*fMCRec);
 
-    this->topDevice()->save();
+    // The matching topDevice()->save() is deferred until the first clip op at this level
+    // (checkForDeferredDeviceSave); matrix-only levels never touch the device's clip stack.
 }
 
 int SkCanvas::saveLayer(const SkRect* bounds, const SkPaint* paint) {
@@ -709,6 +753,7 @@ int SkCanvas::only_axis_aligned_saveBehind(const SkRect* bounds) {
         bool doTheWork = this->onDoSaveBehind(bounds);
         fSaveCount += 1;
         this->internalSave();
+        this->checkForDeferredDeviceSave();
         if (doTheWork) {
             this->internalSaveBehind(bounds);
         }
@@ -1034,6 +1079,9 @@ void SkCanvas::internalSaveLayer(const SaveLayerRec& rec, SaveLayerStrategy stra
     // Do this before we create the layer. We don't call the public save() since that would invoke a
     // possibly overridden virtual.
     this->internalSave();
+    // The device save must be realized up front here: once the layer's device is pushed, a lazy
+    // save would land on the wrong device.
+    this->checkForDeferredDeviceSave();
 
     if (this->isClipEmpty()) {
         // Early out if the layer wouldn't draw anything
@@ -1193,6 +1241,7 @@ void SkCanvas::internalRestore() {
     // now detach these from fMCRec so we can pop(). Gets freed after its drawn
     std::unique_ptr<Layer> layer = std::move(fMCRec->fLayer);
     std::unique_ptr<BackImage> backImage = std::move(fMCRec->fBackImage);
+    const bool deviceSaveDeferred = fMCRec->fDeviceSaveDeferred;
 
     fMarkerStack->restore(fMCRec);
 
@@ -1206,7 +1255,13 @@ void SkCanvas::internalRestore() {
         return;
     }
 
-    this->topDevice()->restore(fMCRec->fMatrix);
+    if (deviceSaveDeferred) {
+        // This level never pushed a save onto the device's clip stack, so there is nothing to
+        // pop; just put the CTM back.
+        this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
+    } else {
+        this->topDevice()->restore(fMCRec->fMatrix);
+    }
 
     if (backImage) {
         SkPaint paint;
@@ -1323,6 +1378,7 @@ void SkCanvas::translate(SkScalar dx, SkScalar dy) {
     if (dx || dy) {
         this->checkForDeferredSave();
         fMCRec->fMatrix.preTranslate(dx, dy);
+        fMCRec->dirtyMatrix33();
 
         this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
 
@@ -1334,6 +1390,7 @@ void SkCanvas::scale(SkScalar sx, SkScalar sy) {
     if (sx != 1 || sy != 1) {
         this->checkForDeferredSave();
         fMCRec->fMatrix.preScale(sx, sy);
+        fMCRec->dirtyMatrix33();
 
         this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
 
@@ -1370,6 +1427,7 @@ void SkCanvas::internalConcat44(const SkM44& m) {
     this->checkForDeferredSave();
 
     fMCRec->fMatrix.preConcat(m);
+    fMCRec->dirtyMatrix33();
 
     this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
 }
@@ -1382,6 +1440,7 @@ void SkCanvas::concat(const SkM44& m) {
 
 void SkCanvas::internalSetMatrix(const SkM44& m) {
     fMCRec->fMatrix = m;
+    fMCRec->dirtyMatrix33();
 
     this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
 }
@@ -1428,6 +1487,7 @@ void SkCanvas::onClipRect(const SkRect& rect, SkClipOp op, ClipEdgeStyle edgeSty
     SkASSERT(rect.isSorted());
     const bool isAA = kSoft_ClipEdgeStyle == edgeStyle;
 
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->clipRect(rect, op, isAA);
 }
@@ -1440,6 +1500,7 @@ void SkCanvas::androidFramework_setDeviceClipRestriction(const SkIRect& rect) {
         this->checkForDeferredSave();
     }
 
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->androidFramework_setDeviceClipRestriction(&fClipRestrictionRect);
 }
@@ -1447,6 +1508,7 @@ void SkCanvas::androidFramework_setDeviceClipRestriction(const SkIRect& rect) {
 void SkCanvas::androidFramework_replaceClip(const SkIRect& rect) {
     this->checkForDeferredSave();
 
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->replaceClip(rect);
 }
@@ -1464,6 +1526,7 @@ void SkCanvas::clipRRect(const SkRRect& rrect, SkClipOp op, bool doAA) {
 void SkCanvas::onClipRRect(const SkRRect& rrect, SkClipOp op, ClipEdgeStyle edgeStyle) {
     bool isAA = kSoft_ClipEdgeStyle == edgeStyle;
 
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->clipRRect(rrect, op, isAA);
 }
@@ -1472,7 +1535,7 @@ void SkCanvas::clipPath(const SkPath& path, SkClipOp op, bool doAA) {
     this->checkForDeferredSave();
     ClipEdgeStyle edgeStyle = doAA ? kSoft_ClipEdgeStyle : kHard_ClipEdgeStyle;
 
-    if (!path.isInverseFillType() && fMCRec->fMatrix.asM33().rectStaysRect()) {
+    if (!path.isInverseFillType() && fMCRec->matrix33().rectStaysRect()) {
         SkRect r;
         if (path.isRect(&r)) {
             this->onClipRect(r, op, edgeStyle);
@@ -1496,6 +1559,7 @@ void SkCanvas::clipPath(const SkPath& path, SkClipOp op, bool doAA) {
 void SkCanvas::onClipPath(const SkPath& path, SkClipOp op, ClipEdgeStyle edgeStyle) {
     bool isAA = kSoft_ClipEdgeStyle == edgeStyle;
 
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->clipPath(path, op, isAA);
 }
@@ -1518,6 +1582,7 @@ void SkCanvas::clipShader(sk_sp<SkShader> sh, SkClipOp op) {
 }
 
 void SkCanvas::onClipShader(sk_sp<SkShader> sh, SkClipOp op) {
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->clipShader(sh, op);
 }
@@ -1528,6 +1593,7 @@ void SkCanvas::clipRegion(const SkRegion& rgn, SkClipOp op) {
 }
 
 void SkCanvas::onClipRegion(const SkRegion& rgn, SkClipOp op) {
+    this->checkForDeferredDeviceSave();
     AutoUpdateQRBounds aqr(this);
     this->topDevice()->clipRegion(rgn, op);
 }
@@ -1606,7 +1672,7 @@ SkRect SkCanvas::getLocalClipBounds() const {
 
     SkMatrix inverse;
     // if we can't invert the CTM, we can't return local clip bounds
-    if (!fMCRec->fMatrix.asM33().invert(&inverse)) {
+    if (!fMCRec->matrix33().invert(&inverse)) {
         return SkRect::MakeEmpty();
     }
 
@@ -1642,7 +1708,7 @@ SkRect SkCanvas::computeDeviceClipBounds(bool outsetForAA) const {
 ///////////////////////////////////////////////////////////////////////
 
 SkMatrix SkCanvas::getTotalMatrix() const {
-    return fMCRec->fMatrix.asM33();
+    return fMCRec->matrix33();
 }
 
 SkM44 SkCanvas::getLocalToDevice() const {
@@ -2212,8 +2278,25 @@ void SkCanvas::drawImageRect(const SkImage* image, const SkRect& dst,
 
 void SkCanvas::onDrawTextBlob(const SkTextBlob* blob, SkScalar x, SkScalar y,
                               const SkPaint& paint) {
-    auto glyphRunList = fScratchGlyphRunBuilder->blobToGlyphRunList(*blob, {x, y});
-    this->onDrawGlyphRunList(glyphRunList, paint);
+    const SkRect* cullRect = nullptr;
+    SkRect localCull;
+    // Use the per-run bounds cached on the blob to skip clipped-out runs before any glyph
+    // processing: map the device clip into blob space, padded by the paint's fast-bounds slop.
+    // Image filters can move pixels arbitrarily, so don't cull through them.
+    if (paint.canComputeFastBounds() && !paint.getImageFilter()) {
+        localCull = this->getLocalClipBounds();
+        if (!localCull.isEmpty()) {
+            SkRect slop = SkRect::MakeEmpty();
+            (void)paint.computeFastBounds(slop, &slop);
+            localCull.outset(slop.width(), slop.height());
+            localCull.offset(-x, -y);
+            cullRect = &localCull;
+        }
+    }
+    auto glyphRunList = fScratchGlyphRunBuilder->blobToGlyphRunList(*blob, {x, y}, cullRect);
+    if (!glyphRunList.empty()) {
+        this->onDrawGlyphRunList(glyphRunList, paint);
+    }
 }
 
 void SkCanvas::onDrawGlyphRunList(const SkGlyphRunList& glyphRunList, const SkPaint& paint) {
@@ -2304,6 +2387,23 @@ void SkCanvas::drawGlyphs(int count, const SkGlyphID glyphs[], const SkRSXform x
     this->onDrawGlyphRunList(glyphRunList, paint);
 }
 
+void SkCanvas::drawGlyphRuns(int runCount, const GlyphRun runs[], const SkPaint& paint) {
+    if (runCount <= 0) { return; }
+
+    if (runCount == 1) {
+        const GlyphRun& run = runs[0];
+        this->drawGlyphs(run.fCount, run.fGlyphs, run.fPositions, run.fOrigin, *run.fFont,
+                         paint);
+        return;
+    }
+
+    const SkGlyphRunList& glyphRunList =
+            fScratchGlyphRunBuilder->glyphRunsToGlyphRunList(runs, runCount, paint);
+    if (!glyphRunList.empty()) {
+        this->onDrawGlyphRunList(glyphRunList, paint);
+    }
+}
+
 void SkCanvas::drawTextBlob(const SkTextBlob* blob, SkScalar x, SkScalar y,
                             const SkPaint& paint) {
     TRACE_EVENT0("skia", TRACE_FUNC);
@@ -5,9 +5,12 @@
  * found in the LICENSE file.
  */
 
+#include "include/private/SkMutex.h"
 #include "include/third_party/skcms/skcms.h"
 #include "src/core/SkColorSpacePriv.h"
 #include "src/core/SkColorSpaceXformSteps.h"
+#include "src/core/SkLRUCache.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkRasterPipeline.h"
 #include "src/core/SkVM.h"
 
@@ -137,6 +140,149 @@ void SkColorSpaceXformSteps::apply(SkRasterPipeline* p) const {
     if (flags.premul)          { p->append(SkRasterPipeline::premul); }
 }
 
+// 256 samples of the sRGB EOTF at i/255, interpolated by the tf_lut stage. Every 8-bit-origin
+// input lands exactly on a sample; between samples the curve's curvature keeps linear
+// interpolation within ~2e-6, far below even 16-bit quantization.
+static const float* srgb_to_linear_table() {
+    static const float* gTable = [] {
+        float* table = new float[256];
+        for (int i = 0; i < 256; i++) {
+            table[i] = skcms_TransferFunction_eval(&SkNamedTransferFn::kSRGB, i * (1 / 255.0f));
+        }
+        return table;
+    }();
+    return gTable;
+}
+
+// True when ct's color channels carry at most 8 normalized bits, so transfer-function error well
+// under one 8-bit step cannot survive quantization at that endpoint. kAlpha_8 is excluded: its
+// r,g,b come from the paint, not the pixels.
+static bool channels_fit_in_byte(SkColorType ct) {
+    switch (ct) {
+        case kRGBA_8888_SkColorType:
+        case kRGB_888x_SkColorType:
+        case kBGRA_8888_SkColorType:
+        case kGray_8_SkColorType:
+        case kR8G8_unorm_SkColorType:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void SkColorSpaceXformSteps::apply(SkRasterPipeline* p, SkColorType srcCT) const {
+    if (!flags.linearize || !is_almost_srgb(srcTF) || !channels_fit_in_byte(srcCT)) {
+        this->apply(p);
+        return;
+    }
+    if (flags.unpremul)        { p->append(SkRasterPipeline::unpremul); }
+    p->append(SkRasterPipeline::tf_lut, srgb_to_linear_table());
+    if (flags.gamut_transform) { p->append(SkRasterPipeline::matrix_3x3, &src_to_dst_matrix); }
+    if (flags.encode)          { p->append_transfer_function(dstTFInv); }
+    if (flags.premul)          { p->append(SkRasterPipeline::premul); }
+}
+
+namespace {
+
+// A 3D table of the linearize/gamut/encode color math, interned per src/dst pair so repeated bulk
+// conversions (e.g. P3 -> sRGB photo pipelines) pay for the per-pixel transfer functions once.
+class ColorLut3D : public SkRefCnt {
+public:
+    static constexpr int kSize = 17;
+
+    // The color-only parts of the steps, in a padding-free layout we can hash and memcmp.
+    struct Key {
+        skcms_TransferFunction srcTF, dstTFInv;
+        float                  matrix[9];
+        uint32_t               mask;
+    };
+    static_assert(sizeof(Key) == (7 + 7 + 9 + 1) * 4, "Key must be dense for hashing");
+
+    static Key MakeKey(const SkColorSpaceXformSteps& steps) {
+        Key key;
+        memset(&key, 0, sizeof(Key));
+        if (steps.flags.linearize)       { key.srcTF = steps.srcTF; }
+        if (steps.flags.gamut_transform) { memcpy(key.matrix, steps.src_to_dst_matrix,
+                                                  sizeof(key.matrix)); }
+        if (steps.flags.encode)          { key.dstTFInv = steps.dstTFInv; }
+        key.mask = steps.flags.mask() & ~(1|16);  // ignore unpremul/premul; they run as stages
+        return key;
+    }
+
+    ColorLut3D(const Key& key, const SkColorSpaceXformSteps& steps) : fKey(key) {
+        SkColorSpaceXformSteps colorOnly = steps;
+        colorOnly.flags.unpremul = false;
+        colorOnly.flags.premul   = false;
+
+        float* next = fTable;
+        for (int r = 0; r < kSize; r++)
+        for (int g = 0; g < kSize; g++)
+        for (int b = 0; b < kSize; b++) {
+            float rgba[4] = { r * (1 / (kSize - 1.0f)),
+                              g * (1 / (kSize - 1.0f)),
+                              b * (1 / (kSize - 1.0f)),
+                              1.0f };
+            colorOnly.apply(rgba);
+            *next++ = rgba[0];
+            *next++ = rgba[1];
+            *next++ = rgba[2];
+        }
+        fCtx = { fTable, kSize - 1.0f };
+    }
+
+    const Key& key() const { return fKey; }
+    const SkRasterPipeline_Clut3DCtx* ctx() const { return &fCtx; }
+
+private:
+    Key                        fKey;
+    float                      fTable[kSize * kSize * kSize * 3];
+    SkRasterPipeline_Clut3DCtx fCtx;
+};
+
+// Building a LUT costs ~kSize^3 scalar transform evaluations; below this many pixels the
+// per-pixel stages win.
+constexpr size_t kLutPixelThreshold = 64 * 1024;
+
+sk_sp<ColorLut3D> intern_lut(const SkColorSpaceXformSteps& steps) {
+    static SkMutex gMutex;
+    static auto* gCache = new SkLRUCache<uint32_t, sk_sp<ColorLut3D>>(8);
+
+    ColorLut3D::Key key = ColorLut3D::MakeKey(steps);
+    const uint32_t hash = SkOpts::hash(&key, sizeof(key));
+    {
+        SkAutoMutexExclusive lock(gMutex);
+        if (sk_sp<ColorLut3D>* found = gCache->find(hash)) {
+            // Guard against hash collisions; only identical color math shares a LUT.
+            if (0 == memcmp(&(*found)->key(), &key, sizeof(key))) {
+                return *found;
+            }
+        }
+    }
+
+    auto lut = sk_make_sp<ColorLut3D>(key, steps);
+    SkAutoMutexExclusive lock(gMutex);
+    gCache->insert_or_update(hash, lut);
+    return lut;
+}
+
+}  // namespace
+
+void SkColorSpaceXformSteps::apply(SkRasterPipeline* p, size_t numPixels) const {
+    int colorStages = (flags.linearize       ? 1 : 0)
+                    + (flags.gamut_transform ? 1 : 0)
+                    + (flags.encode          ? 1 : 0);
+    if (numPixels < kLutPixelThreshold || colorStages < 2) {
+        this->apply(p);
+        return;
+    }
+
+    sk_sp<ColorLut3D> lut = intern_lut(*this);
+    if (flags.unpremul) { p->append(SkRasterPipeline::unpremul); }
+    p->append(SkRasterPipeline::clut_3d, lut->ctx());
+    if (flags.premul)   { p->append(SkRasterPipeline::premul); }
+    fLut = std::move(lut);  // the pipeline's ctx pointer stays valid as long as we do
+}
+
 skvm::Color sk_program_transfer_fn(skvm::Builder* p, skvm::Uniforms* uniforms,
                                    const skcms_TransferFunction& tf, skvm::Color c) {
     skvm::F32 G = p->uniformF(uniforms->pushF(tf.g)),
@@ -213,3 +359,75 @@ skvm::Color SkColorSpaceXformSteps::program(skvm::Builder* p, skvm::Uniforms* un
     }
     return c;
 }
+
+// Cheap fits to the sRGB curves from Skia's legacy 8-bit sRGB blitters, each within ~0.6/255 of
+// the exact curve on [0,1]: a handful of mads and sqrts instead of approx_powf's exp2/log2
+// polynomials.
+static skvm::F32 approx_srgb_to_linear(skvm::F32 v) {
+    return v*(v*(v*0.305306011f + 0.682171111f) + 0.012522878f);
+}
+
+static skvm::F32 approx_linear_to_srgb(skvm::F32 v) {
+    skvm::F32 sqrt2 = sqrt(v),
+              sqrt4 = sqrt(sqrt2);
+    return select(v < 0.0043f, v * 12.46f
+                             , 0.411192f*sqrt4 + 0.689206f*sqrt2 - 0.0988f);
+}
+
+static bool is_almost_srgb_inverse(const skcms_TransferFunction& coeffs) {
+    static const skcms_TransferFunction kSRGBInv = [] {
+        skcms_TransferFunction inv;
+        SkAssertResult(skcms_TransferFunction_invert(&SkNamedTransferFn::kSRGB, &inv));
+        return inv;
+    }();
+    return transfer_fn_almost_equal(kSRGBInv.a, coeffs.a) &&
+           transfer_fn_almost_equal(kSRGBInv.b, coeffs.b) &&
+           transfer_fn_almost_equal(kSRGBInv.c, coeffs.c) &&
+           transfer_fn_almost_equal(kSRGBInv.d, coeffs.d) &&
+           transfer_fn_almost_equal(kSRGBInv.e, coeffs.e) &&
+           transfer_fn_almost_equal(kSRGBInv.f, coeffs.f) &&
+           transfer_fn_almost_equal(kSRGBInv.g, coeffs.g);
+}
+
+skvm::Color SkColorSpaceXformSteps::program(skvm::Builder* p, skvm::Uniforms* uniforms,
+                                            skvm::Color c,
+                                            SkColorType srcCT, SkColorType dstCT) const {
+    // An approximate curve is only safe on the side whose 8-bit quantization hides its error;
+    // the other side (and any non-sRGB transfer function) still gets the exact program.
+    bool approxLinearize = flags.linearize && channels_fit_in_byte(srcCT)
+                                           && is_almost_srgb(srcTF),
+         approxEncode    = flags.encode    && channels_fit_in_byte(dstCT)
+                                           && is_almost_srgb_inverse(dstTFInv);
+    if (!approxLinearize && !approxEncode) {
+        return this->program(p, uniforms, c);
+    }
+
+    if (flags.unpremul) {
+        c = unpremul(c);
+    }
+    if (flags.linearize) {
+        c = approxLinearize ? skvm::Color{approx_srgb_to_linear(c.r),
+                                          approx_srgb_to_linear(c.g),
+                                          approx_srgb_to_linear(c.b), c.a}
+                            : sk_program_transfer_fn(p, uniforms, srcTF, c);
+    }
+    if (flags.gamut_transform) {
+        auto m = [&](int index) {
+            return p->uniformF(uniforms->pushF(src_to_dst_matrix[index]));
+        };
+        auto R = c.r * m(0) + c.g * m(3) + c.b * m(6),
+             G = c.r * m(1) + c.g * m(4) + c.b * m(7),
+             B = c.r * m(2) + c.g * m(5) + c.b * m(8);
+        c = {R, G, B, c.a};
+    }
+    if (flags.encode) {
+        c = approxEncode ? skvm::Color{approx_linear_to_srgb(c.r),
+                                       approx_linear_to_srgb(c.g),
+                                       approx_linear_to_srgb(c.b), c.a}
+                         : sk_program_transfer_fn(p, uniforms, dstTFInv, c);
+    }
+    if (flags.premul) {
+        c = premul(c);
+    }
+    return c;
+}
@@ -45,11 +45,35 @@ struct SkColorSpaceXformSteps {
     void apply(SkRasterPipeline*) const;
     skvm::Color program(skvm::Builder*, skvm::Uniforms*, skvm::Color) const;
 
+    // Like apply(SkRasterPipeline*), but for bulk conversions of known size: when numPixels is
+    // large enough to amortize one, the linearize/gamut/encode stages are replaced with a cached
+    // 3D LUT sampled by tetrahedral interpolation (unpremul/premul still run exactly). The LUT
+    // approximates the transfer curves, so only use this where the destination's quantization
+    // hides the error (e.g. byte-per-channel pixels).
+    void apply(SkRasterPipeline*, size_t numPixels) const;
+
+    // Like apply(SkRasterPipeline*), but for sources of known color type: when the source is
+    // sRGB-encoded with at most 8 bits per color channel, the linearize stage runs as a
+    // 256-entry interpolated table that is exact at every 8-bit input instead of evaluating the
+    // full parametric curve. Anything else falls through to the exact stages.
+    void apply(SkRasterPipeline*, SkColorType srcCT) const;
+
+    // Like program(), but for endpoints of known color type: sRGB transfer functions whose
+    // error is hidden by an 8-bit endpoint are emitted as short polynomial/sqrt approximations
+    // instead of the full parametric curves. Anything else falls through to the exact program.
+    skvm::Color program(skvm::Builder*, skvm::Uniforms*, skvm::Color,
+                        SkColorType srcCT, SkColorType dstCT) const;
+
     Flags flags;
 
     skcms_TransferFunction srcTF,     // Apply for linearize.
                            dstTFInv;  // Apply for encode.
     float src_to_dst_matrix[9];       // Apply this 3x3 column-major matrix for gamut_transform.
+
+private:
+    // Keeps an interned LUT chosen by apply(SkRasterPipeline*, size_t) alive for as long as the
+    // pipeline referencing it (the pipeline must already outlive this struct for &flags et al).
+    mutable sk_sp<SkRefCnt> fLut;
 };
 
 #endif//SkColorSpaceXformSteps_DEFINED
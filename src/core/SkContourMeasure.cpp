@@ -7,6 +7,7 @@
 
 #include "include/core/SkContourMeasure.h"
 #include "include/core/SkPath.h"
+#include "include/private/SkTPin.h"
 #include "src/core/SkGeometry.h"
 #include "src/core/SkPathMeasurePriv.h"
 #include "src/core/SkPathPriv.h"
@@ -601,6 +602,71 @@ bool SkContourMeasure::getPosTan(SkScalar distance, SkPoint* pos, SkVector* tang
     return true;
 }
 
+bool SkContourMeasure::getPosTans(const SkScalar distances[], int count,
+                                  SkPoint pos[], SkVector tan[]) const {
+    if (count <= 0) {
+        return true;
+    }
+
+    bool ascending = true;
+    for (int i = 1; i < count; ++i) {
+        if (!(distances[i] >= distances[i - 1])) {  // also catches NaN
+            ascending = false;
+            break;
+        }
+    }
+    if (!ascending) {
+        for (int i = 0; i < count; ++i) {
+            if (!this->getPosTan(distances[i], pos ? &pos[i] : nullptr,
+                                 tan ? &tan[i] : nullptr)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (SkScalarIsNaN(distances[0])) {
+        return false;
+    }
+
+    const SkScalar length = this->length();
+    SkASSERT(length > 0 && fSegments.count() > 0);
+
+    // Ascending queries share one forward sweep over the segment table instead of
+    // paying a binary search each.
+    const Segment* seg = fSegments.begin();
+    const Segment* stop = fSegments.end();
+    for (int i = 0; i < count; ++i) {
+        const SkScalar distance = SkTPin(distances[i], 0.0f, length);
+        while (seg + 1 < stop && seg->fDistance < distance) {
+            ++seg;
+        }
+
+        // Interpolate t within this segment, as distanceToSegment() does.
+        SkScalar startT = 0, startD = 0;
+        if (seg > fSegments.begin()) {
+            startD = seg[-1].fDistance;
+            if (seg[-1].fPtIndex == seg->fPtIndex) {
+                SkASSERT(seg[-1].fType == seg->fType);
+                startT = seg[-1].getScalarT();
+            }
+        }
+        SkASSERT(seg->getScalarT() > startT);
+        SkASSERT(seg->fDistance > startD);
+
+        const SkScalar t = startT + (seg->getScalarT() - startT) * (distance - startD)
+                                  / (seg->fDistance - startD);
+        if (SkScalarIsNaN(t)) {
+            return false;
+        }
+
+        SkASSERT((unsigned)seg->fPtIndex < (unsigned)fPts.count());
+        compute_pos_tan(&fPts[seg->fPtIndex], seg->fType, t,
+                        pos ? &pos[i] : nullptr, tan ? &tan[i] : nullptr);
+    }
+    return true;
+}
+
 bool SkContourMeasure::getMatrix(SkScalar distance, SkMatrix* matrix, MatrixFlags flags) const {
     SkPoint     position;
     SkVector    tangent;
@@ -67,6 +67,55 @@ static bool swizzle_or_premul(const SkImageInfo& dstInfo,       void* dstPixels,
     return true;
 }
 
+static bool convert_f16_or_1010102(const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRB,
+                                   const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRB,
+                                   const SkColorSpaceXformSteps& steps) {
+    // Converters for RGBA_8888 to and from same-order F16 and 1010102, usable only when no
+    // color space or alpha transformation is needed.
+    if (steps.flags.mask() != 0b00000) {
+        return false;
+    }
+    auto is_f16 = [](SkColorType ct) {
+        return ct == kRGBA_F16_SkColorType || ct == kRGBA_F16Norm_SkColorType;
+    };
+
+    if (srcInfo.colorType() == kRGBA_8888_SkColorType && is_f16(dstInfo.colorType())) {
+        for (int y = 0; y < dstInfo.height(); y++) {
+            SkOpts::RGBA_to_F16((uint64_t*)dstPixels, (const uint32_t*)srcPixels,
+                                dstInfo.width());
+            dstPixels = SkTAddOffset<void>(dstPixels, dstRB);
+            srcPixels = SkTAddOffset<const void>(srcPixels, srcRB);
+        }
+        return true;
+    }
+    if (is_f16(srcInfo.colorType()) && dstInfo.colorType() == kRGBA_8888_SkColorType) {
+        for (int y = 0; y < dstInfo.height(); y++) {
+            SkOpts::F16_to_RGBA((uint32_t*)dstPixels, (const uint64_t*)srcPixels,
+                                dstInfo.width());
+            dstPixels = SkTAddOffset<void>(dstPixels, dstRB);
+            srcPixels = SkTAddOffset<const void>(srcPixels, srcRB);
+        }
+        return true;
+    }
+
+    void (*repack)(uint32_t*, const uint32_t*, int) = nullptr;
+    if (srcInfo.colorType() == kRGBA_8888_SkColorType &&
+        dstInfo.colorType() == kRGBA_1010102_SkColorType) {
+        repack = SkOpts::RGBA_to_1010102;
+    } else if (srcInfo.colorType() == kRGBA_1010102_SkColorType &&
+               dstInfo.colorType() == kRGBA_8888_SkColorType) {
+        repack = SkOpts::RGBA_1010102_to_RGBA;
+    } else {
+        return false;
+    }
+    for (int y = 0; y < dstInfo.height(); y++) {
+        repack((uint32_t*)dstPixels, (const uint32_t*)srcPixels, dstInfo.width());
+        dstPixels = SkTAddOffset<void>(dstPixels, dstRB);
+        srcPixels = SkTAddOffset<const void>(srcPixels, srcRB);
+    }
+    return true;
+}
+
 static bool convert_to_alpha8(const SkImageInfo& dstInfo,       void* vdst, size_t dstRB,
                               const SkImageInfo& srcInfo, const void*  src, size_t srcRB,
                               const SkColorSpaceXformSteps&) {
@@ -208,9 +257,32 @@ static void convert_with_pipeline(const SkImageInfo& dstInfo, void* dstRow, int
     SkRasterPipeline_MemoryCtx src = { (void*)srcRow, srcStride },
                                dst = { (void*)dstRow, dstStride };
 
+    // The LUT path approximates the transfer curves, so only let it kick in when both ends are
+    // byte-per-channel: sources then stay within the LUT's [0,1] domain, and the destination's
+    // quantization hides the approximation error.
+    auto bytes_per_channel = [](SkColorType ct) {
+        switch (ct) {
+            case kAlpha_8_SkColorType:
+            case kRGB_565_SkColorType:
+            case kARGB_4444_SkColorType:
+            case kRGBA_8888_SkColorType:
+            case kRGB_888x_SkColorType:
+            case kBGRA_8888_SkColorType:
+            case kGray_8_SkColorType:
+            case kR8G8_unorm_SkColorType:
+                return true;
+            default:
+                return false;
+        }
+    };
+    size_t lutPixels = bytes_per_channel(srcInfo.colorType()) &&
+                       bytes_per_channel(dstInfo.colorType())
+                               ? (size_t)srcInfo.width() * srcInfo.height()
+                               : 0;
+
     SkRasterPipeline_<256> pipeline;
     pipeline.append_load(srcInfo.colorType(), &src);
-    steps.apply(&pipeline);
+    steps.apply(&pipeline, lutPixels);
 
     pipeline.append_gamut_clamp_if_normalized(dstInfo);
 
@@ -233,7 +305,7 @@ bool SkConvertPixels(const SkImageInfo& dstInfo,       void* dstPixels, size_t d
     SkColorSpaceXformSteps steps{srcInfo.colorSpace(), srcInfo.alphaType(),
                                  dstInfo.colorSpace(), dstInfo.alphaType()};
 
-    for (auto fn : {rect_memcpy, swizzle_or_premul, convert_to_alpha8}) {
+    for (auto fn : {rect_memcpy, swizzle_or_premul, convert_f16_or_1010102, convert_to_alpha8}) {
         if (fn(dstInfo, dstPixels, dstRB, srcInfo, srcPixels, srcRB, steps)) {
             return true;
         }
@@ -117,6 +117,32 @@ private:
     using INHERITED = SkARGB32_Opaque_Blitter;
 };
 
+/**
+ *  Fully fused solid-color kSrc blitter for kN32 devices, reached through the
+ *  SK_BLITTER_SPECIALIZATIONS table (see SkBlitterSpecializations.h). Unlike the SrcOver
+ *  blitters above it must keep writing when the paint alpha is zero.
+ */
+class SkARGB32_Src_Blitter : public SkRasterBlitter {
+public:
+    SkARGB32_Src_Blitter(const SkPixmap& device, const SkPaint& paint);
+    void blitH(int x, int y, int width) override;
+    void blitAntiH(int x, int y, const SkAlpha antialias[], const int16_t runs[]) override;
+    void blitV(int x, int y, int height, SkAlpha alpha) override;
+    void blitRect(int x, int y, int width, int height) override;
+    void blitMask(const SkMask&, const SkIRect&) override;
+    void blitAntiH2(int x, int y, U8CPU a0, U8CPU a1) override;
+    void blitAntiV2(int x, int y, U8CPU a0, U8CPU a1) override;
+    const SkPixmap* justAnOpaqueColor(uint32_t*) override;
+
+    static bool Supports(const SkPixmap& device, const SkPaint&);
+
+private:
+    SkColor   fColor;
+    SkPMColor fPMColor;
+
+    using INHERITED = SkRasterBlitter;
+};
+
 class SkARGB32_Shader_Blitter : public SkShaderBlitter {
 public:
     SkARGB32_Shader_Blitter(const SkPixmap& device, const SkPaint& paint,
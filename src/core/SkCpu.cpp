@@ -78,12 +78,20 @@
 
     static uint32_t read_cpu_features() {
         const uint32_t kHWCAP_CRC32   = (1<< 7),
-                       kHWCAP_ASIMDHP = (1<<10);
+                       kHWCAP_ASIMDHP = (1<<10),
+                       kHWCAP_SVE     = (1<<22);
+        const uint32_t kHWCAP2_SVE2   = (1<< 1);
 
         uint32_t features = 0;
         uint32_t hwcaps = getauxval(AT_HWCAP);
         if (hwcaps & kHWCAP_CRC32  ) { features |= SkCpu::CRC32; }
         if (hwcaps & kHWCAP_ASIMDHP) { features |= SkCpu::ASIMDHP; }
+        if (hwcaps & kHWCAP_SVE    ) {
+            features |= SkCpu::SVE;
+        #if defined(AT_HWCAP2)
+            if (getauxval(AT_HWCAP2) & kHWCAP2_SVE2) { features |= SkCpu::SVE2; }
+        #endif
+        }
 
         // The Samsung Mongoose 3 core sets the ASIMDHP bit but doesn't support it.
         for (int core = 0; features & SkCpu::ASIMDHP; core++) {
@@ -47,6 +47,8 @@ struct SkCpu {
         VFP_FP16 = 1 << 2,
         CRC32    = 1 << 3,
         ASIMDHP  = 1 << 4,
+        SVE      = 1 << 5,
+        SVE2     = 1 << 6,
     };
 
     static void CacheRuntimeFeatures();
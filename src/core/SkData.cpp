@@ -8,6 +8,9 @@
 #include "include/core/SkData.h"
 #include "include/core/SkStream.h"
 #include "include/private/SkOnce.h"
+#include "include/private/SkSpinlock.h"
+#include "src/core/SkDataPriv.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkOSFile.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
@@ -61,7 +64,83 @@ size_t SkData::copyRange(size_t offset, size_t length, void* buffer) const {
     return length;
 }
 
+namespace {
+
+// Most SkDatas made through PrivateNewWithCopy are small: serialized keys, PDF objects, codec
+// chunks. Carve their storage out of shared slabs instead of hitting malloc once per data.
+// Chunks are one fixed size covering the header plus up to kMaxPayload bytes; freed chunks go
+// on a free list for reuse. Slabs are never returned to the system, so the ownership check in
+// operator delete can scan the slab list without taking the lock.
+class SmallDataArena {
+public:
+    static constexpr size_t kMaxPayload = 64;
+    static constexpr size_t kChunkSize = (sizeof(SkData) + kMaxPayload + 15) & ~size_t{15};
+    static constexpr int kChunksPerSlab = 256;
+    static constexpr int kMaxSlabs = 64;
+
+    void* alloc() {
+        SkAutoSpinlock lock{fLock};
+        if (fFreeList) {
+            FreeChunk* chunk = fFreeList;
+            fFreeList = chunk->fNext;
+            return chunk;
+        }
+        if (fChunksUsed == kChunksPerSlab) {
+            int slabCount = fSlabCount.load(std::memory_order_relaxed);
+            if (slabCount == kMaxSlabs) {
+                // Too many small datas live at once; let malloc handle the overflow.
+                return nullptr;
+            }
+            fSlabs[slabCount] = (char*)sk_malloc_throw(kChunksPerSlab * kChunkSize);
+            fSlabCount.store(slabCount + 1, std::memory_order_release);
+            fChunksUsed = 0;
+        }
+        char* slab = fSlabs[fSlabCount.load(std::memory_order_relaxed) - 1];
+        return slab + fChunksUsed++ * kChunkSize;
+    }
+
+    void free(void* p) {
+        SkAutoSpinlock lock{fLock};
+        FreeChunk* chunk = (FreeChunk*)p;
+        chunk->fNext = fFreeList;
+        fFreeList = chunk;
+    }
+
+    bool contains(const void* p) const {
+        int n = fSlabCount.load(std::memory_order_acquire);
+        for (int i = 0; i < n; i++) {
+            if (p >= fSlabs[i] && p < fSlabs[i] + kChunksPerSlab * kChunkSize) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static SmallDataArena& Instance() {
+        static SmallDataArena* arena = new SmallDataArena;  // deliberately leaked
+        return *arena;
+    }
+
+private:
+    struct FreeChunk {
+        FreeChunk* fNext;
+    };
+
+    SkSpinlock fLock;
+    FreeChunk* fFreeList{nullptr};
+    char* fSlabs[kMaxSlabs];
+    std::atomic<int> fSlabCount{0};
+    int fChunksUsed{kChunksPerSlab};
+};
+
+}  // namespace
+
 void SkData::operator delete(void* p) {
+    SmallDataArena& arena = SmallDataArena::Instance();
+    if (arena.contains(p)) {
+        arena.free(p);
+        return;
+    }
     ::operator delete(p);
 }
 
@@ -73,7 +152,13 @@ sk_sp<SkData> SkData::PrivateNewWithCopy(const void* srcOrNull, size_t length) {
     const size_t actualLength = length + sizeof(SkData);
     SkASSERT_RELEASE(length < actualLength);  // Check for overflow.
 
-    void* storage = ::operator new (actualLength);
+    void* storage = nullptr;
+    if (actualLength <= SmallDataArena::kChunkSize) {
+        storage = SmallDataArena::Instance().alloc();
+    }
+    if (!storage) {
+        storage = ::operator new (actualLength);
+    }
     sk_sp<SkData> data(new (storage) SkData(length));
     if (srcOrNull) {
         memcpy(data->writable_data(), srcOrNull, length);
@@ -198,3 +283,34 @@ sk_sp<SkData> SkData::MakeFromStream(SkStream* stream, size_t size) {
     }
     return data;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+
+sk_sp<SkData> SkMakeInternedData(const void* data, size_t size) {
+    // Short repeated contents (PDF names, node ids, small keys) are worth sharing; anything
+    // bigger is unlikely to repeat and just copies.
+    constexpr size_t kMaxInternedSize = 64;
+    if (size == 0) {
+        return SkData::MakeEmpty();
+    }
+    if (size > kMaxInternedSize) {
+        return SkData::MakeWithCopy(data, size);
+    }
+
+    // A small direct-mapped table bounds the memory held by interning; colliding contents
+    // simply replace each other.
+    constexpr int kTableSize = 256;
+    static SkSpinlock gLock;
+    static sk_sp<SkData>* gTable;
+    static SkOnce gOnce;
+    gOnce([] { gTable = new sk_sp<SkData>[kTableSize]; });
+
+    uint32_t hash = SkOpts::hash(data, size);
+
+    SkAutoSpinlock lock{gLock};
+    sk_sp<SkData>& slot = gTable[hash & (kTableSize - 1)];
+    if (!slot || slot->size() != size || 0 != memcmp(slot->data(), data, size)) {
+        slot = SkData::MakeWithCopy(data, size);
+    }
+    return slot;
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkDataPriv_DEFINED
+#define SkDataPriv_DEFINED
+
+#include "include/core/SkData.h"
+
+// Returns an SkData with a copy of the given bytes. For small sizes the returned data may be
+// shared with other callers that passed identical bytes, so it must be treated as immutable;
+// do not call writable_data() on it. Larger sizes fall back to SkData::MakeWithCopy.
+// Useful for short strings and keys that repeat many times, e.g. PDF names and node ids.
+sk_sp<SkData> SkMakeInternedData(const void* data, size_t size);
+
+#endif  // SkDataPriv_DEFINED
@@ -29,6 +29,7 @@
 #include "src/core/SkMaskFilterBase.h"
 #include "src/core/SkMatrixUtils.h"
 #include "src/core/SkPathEffectBase.h"
+#include "src/core/SkPathMaskCache.h"
 #include "src/core/SkPathPriv.h"
 #include "src/core/SkRasterClip.h"
 #include "src/core/SkRectPriv.h"
@@ -883,6 +884,85 @@ void SkDraw::drawDevPath(const SkPath& devPath, const SkPaint& paint, bool drawC
     proc(devPath, *fRC, blitter);
 }
 
+static SkCachedData* copy_mask_to_cacheddata(SkMask* mask) {
+    const size_t size = mask->computeTotalImageSize();
+    SkCachedData* data = SkResourceCache::NewCachedData(size);
+    if (data) {
+        memcpy(data->writable_data(), mask->fImage, size);
+        SkMask::FreeImage(mask->fImage);
+        mask->fImage = (uint8_t*)data->data();
+    }
+    return data;
+}
+
+bool SkDraw::drawPathViaMaskCache(const SkPath& path, const SkPaint& paint,
+                                  const SkMatrix& ctm) const {
+    // Simple paths scan-convert faster than a mask lookup and blit; volatile paths promise not
+    // to repeat. The cache only pays off for complex paths refilled with unchanged geometry.
+    static constexpr int kMinCachedVerbCount = 10;
+    // Beyond this the mask's memory and blit traffic outweigh the scan conversion it saves.
+    static constexpr size_t kMaxCachedMaskBytes = 1 << 18;
+
+    // Inverse fills paint outside the path's bounds, so a mask limited to those bounds (and a
+    // quick reject against them) would misrender.
+    if (path.isVolatile() || path.isInverseFillType() ||
+        path.countVerbs() < kMinCachedVerbCount ||
+        paint.getMaskFilter() || !paint.isAntiAlias() ||
+        ctm.hasPerspective() || !ctm.isFinite()) {
+        return false;
+    }
+    if (SkPathPriv::TooBigForMath(ctm.mapRect(path.getBounds()))) {
+        return false;
+    }
+
+    // Whole-pixel translation just offsets the mask, so reduce the matrix to its subpixel
+    // phase; every draw of this path sharing that canonical matrix shares one mask.
+    const SkScalar ix = SkScalarFloorToScalar(ctm.getTranslateX());
+    const SkScalar iy = SkScalarFloorToScalar(ctm.getTranslateY());
+    SkMatrix canonicalMatrix = ctm;
+    canonicalMatrix.postTranslate(-ix, -iy);
+
+    const SkIRect maskBounds = canonicalMatrix.mapRect(path.getBounds()).roundOut();
+    if (maskBounds.isEmpty() ||
+        (size_t)maskBounds.width() * maskBounds.height() > kMaxCachedMaskBytes) {
+        return false;
+    }
+
+    const int ixi = SkScalarTruncToInt(ix);
+    const int iyi = SkScalarTruncToInt(iy);
+    // maskBounds came from mapping the path bounds, so it conservatively contains the mask.
+    if (fRC->quickReject(maskBounds.makeOffset(ixi, iyi))) {
+        return true;  // nothing to draw
+    }
+
+    SkMask mask;
+    SkCachedData* data = SkPathMaskCache::FindAndRef(path.getGenerationID(), path.getFillType(),
+                                                     canonicalMatrix, &mask);
+    if (nullptr == data) {
+        SkPath devPath;
+        path.transform(canonicalMatrix, &devPath);
+        if (!SkDraw::DrawToMask(devPath, nullptr, nullptr, nullptr, &mask,
+                                SkMask::kComputeBoundsAndRenderImage_CreateMode,
+                                SkStrokeRec::kFill_InitStyle)) {
+            return false;
+        }
+        data = copy_mask_to_cacheddata(&mask);
+        if (nullptr == data) {
+            mask.fBounds.offset(ixi, iyi);
+            this->drawDevMask(mask, paint);
+            SkMask::FreeImage(mask.fImage);
+            return true;
+        }
+        SkPathMaskCache::Add(path.getGenerationID(), path.getFillType(),
+                             canonicalMatrix, mask, data);
+    }
+
+    mask.fBounds.offset(ixi, iyi);
+    this->drawDevMask(mask, paint);
+    data->unref();
+    return true;
+}
+
 void SkDraw::drawPath(const SkPath& origSrcPath, const SkPaint& origPaint,
                       const SkMatrix* prePathMatrix, bool pathIsMutable,
                       bool drawCoverage, SkBlitter* customBlitter) const {
@@ -953,6 +1033,13 @@ void SkDraw::drawPath(const SkPath& origSrcPath, const SkPaint& origPaint,
         pathPtr = tmpPath;
     }
 
+    // A repeated fill of an unchanged path may have its coverage mask cached, skipping the
+    // device transform and scan conversion entirely.
+    if (doFill && !drawCoverage && nullptr == customBlitter &&
+        this->drawPathViaMaskCache(*pathPtr, *paint, matrixProvider->localToDevice())) {
+        return;
+    }
+
     // avoid possibly allocating a new path in transform if we can
     SkPath* devPathPtr = pathIsMutable ? pathPtr : tmpPath;
 
@@ -21,6 +21,7 @@ class SkBitmap;
 class SkClipStack;
 class SkBaseDevice;
 class SkBlitter;
+class SkBlitterChooseCache;
 class SkMatrix;
 class SkMatrixProvider;
 class SkPath;
@@ -143,6 +144,13 @@ private:
 
     void drawLine(const SkPoint[2], const SkPaint&) const;
 
+    /**
+     *  Fill an anti-aliased path through the coverage-mask cache, which is keyed by the path's
+     *  generation id and the matrix reduced to its subpixel translation phase. Returns true if
+     *  the fill was handled (possibly clipped out); false means the caller must scan convert.
+     */
+    bool drawPathViaMaskCache(const SkPath&, const SkPaint&, const SkMatrix& ctm) const;
+
     void drawDevPath(const SkPath& devPath,
                      const SkPaint& paint,
                      bool drawCoverage,
@@ -166,6 +174,9 @@ public:
     // optional, will be same dimensions as fDst if present
     const SkPixmap* fCoverage{nullptr};
 
+    // optional, memoizes SkBlitter::Choose across draws that share paint/matrix/dst
+    SkBlitterChooseCache* fBlitterChooseCache{nullptr};
+
 #ifdef SK_DEBUG
     void validate() const;
 #else
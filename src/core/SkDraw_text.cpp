@@ -6,6 +6,8 @@
  */
 
 #include "include/core/SkBitmap.h"
+#include "include/private/SkTArray.h"
+#include "include/private/SkTemplates.h"
 #include "src/core/SkDraw.h"
 #include "src/core/SkFontPriv.h"
 #include "src/core/SkMatrixProvider.h"
@@ -24,6 +26,103 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+// Coalesces a run of non-overlapping A8 glyph masks into one wide mask so the blitter makes a
+// single pass over the destination for the whole run instead of one entry per glyph. Pixels in
+// the merged bounds not covered by any glyph carry zero coverage, which blitMask already must
+// leave untouched (every glyph mask contains zero pixels of its own), so the merged blit writes
+// exactly what the individual blits would have.
+class A8GlyphMaskMerger {
+public:
+    A8GlyphMaskMerger(SkBlitter* blitter, const SkIRect& clipBounds)
+            : fBlitter{blitter}, fClipBounds{clipBounds} {}
+    ~A8GlyphMaskMerger() { this->flush(); }
+
+    bool canAdd(const SkMask& mask) const {
+        if (SkMask::kA8_Format != mask.fFormat) {
+            return false;
+        }
+        if (fPending.empty()) {
+            return true;
+        }
+        // Overlapping masks must compose coverage in separate passes; only coalesce masks laid
+        // out left to right, and keep the merged buffer from ballooning on outliers.
+        if (mask.fBounds.left() < fBounds.right()) {
+            return false;
+        }
+        SkIRect merged = fBounds;
+        merged.join(mask.fBounds);
+        return (size_t)merged.width() * merged.height() <= kMaxMergedBytes;
+    }
+
+    void add(const SkMask& mask) {
+        SkASSERT(this->canAdd(mask));
+        if (fPending.empty()) {
+            fBounds = mask.fBounds;
+        } else {
+            fBounds.join(mask.fBounds);
+        }
+        fPending.push_back(mask);
+    }
+
+    void flush() {
+        if (fPending.empty()) {
+            return;
+        }
+        SkIRect blitBounds;
+        if (!blitBounds.intersect(fBounds, fClipBounds)) {
+            fPending.reset();
+            return;
+        }
+        if (1 == fPending.count()) {
+            fBlitter->blitMask(fPending[0], blitBounds);
+            fPending.reset();
+            return;
+        }
+
+        const size_t rowBytes = fBounds.width();
+        const size_t size = rowBytes * fBounds.height();
+        if (size > fBufferSize) {
+            fBuffer.reset(size);
+            fBufferSize = size;
+        }
+        sk_bzero(fBuffer.get(), size);
+        for (const SkMask& mask : fPending) {
+            uint8_t* dst = fBuffer.get()
+                         + (mask.fBounds.top() - fBounds.top()) * rowBytes
+                         + (mask.fBounds.left() - fBounds.left());
+            const uint8_t* src = mask.fImage;
+            for (int y = 0; y < mask.fBounds.height(); ++y) {
+                memcpy(dst, src, mask.fBounds.width());
+                dst += rowBytes;
+                src += mask.fRowBytes;
+            }
+        }
+
+        SkMask merged;
+        merged.fImage = fBuffer.get();
+        merged.fBounds = fBounds;
+        merged.fRowBytes = SkTo<uint32_t>(rowBytes);
+        merged.fFormat = SkMask::kA8_Format;
+        fBlitter->blitMask(merged, blitBounds);
+        fPending.reset();
+    }
+
+private:
+    // Plenty for a line of small text; runs larger than this flush in pieces.
+    static constexpr size_t kMaxMergedBytes = 1 << 16;
+
+    SkBlitter* const fBlitter;
+    const SkIRect fClipBounds;
+    SkSTArray<32, SkMask> fPending;
+    SkIRect fBounds = SkIRect::MakeEmpty();
+    SkAutoTMalloc<uint8_t> fBuffer;
+    size_t fBufferSize = 0;
+};
+
+}  // namespace
+
 static bool check_glyph_position(SkPoint position) {
     // Prevent glyphs from being drawn outside of or straddling the edge of device space.
     // Comparisons written a little weirdly so that NaN coordinates are treated safely.
@@ -81,6 +180,7 @@ void SkDraw::paintMasks(SkDrawableGlyphBuffer* drawables, const SkPaint& paint)
     } else {
         SkIRect clipBounds = fRC->isBW() ? fRC->bwRgn().getBounds()
                                          : fRC->aaRgn().getBounds();
+        A8GlyphMaskMerger merger{blitter, clipBounds};
         for (auto [variant, pos] : drawables->drawable()) {
             SkGlyph* glyph = variant.glyph();
             if (check_glyph_position(pos)) {
@@ -98,12 +198,20 @@ void SkDraw::paintMasks(SkDrawableGlyphBuffer* drawables, const SkPaint& paint)
                 }
 
                 if (SkMask::kARGB32_Format == mask.fFormat) {
+                    merger.flush();
                     SkBitmap bm;
                     bm.installPixels(SkImageInfo::MakeN32Premul(mask.fBounds.size()),
                                      mask.fImage,
                                      mask.fRowBytes);
                     this->drawSprite(bm, mask.fBounds.x(), mask.fBounds.y(), paint);
+                } else if (SkMask::kA8_Format == mask.fFormat) {
+                    // A8 masks coalesce into one blit per run; the merger clips when it flushes.
+                    if (!merger.canAdd(mask)) {
+                        merger.flush();
+                    }
+                    merger.add(mask);
                 } else {
+                    merger.flush();
                     blitter->blitMask(mask, *bounds);
                 }
             }
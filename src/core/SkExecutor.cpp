@@ -10,6 +10,7 @@
 #include "include/private/SkSemaphore.h"
 #include "include/private/SkSpinlock.h"
 #include "include/private/SkTArray.h"
+#include <atomic>
 #include <deque>
 #include <thread>
 
@@ -139,6 +140,141 @@ private:
     bool                  fAllowBorrowing;
 };
 
+// An SkWorkStealingThreadPool gives each thread its own deque: threads push and pop their own
+// work at the back, and steal the oldest half of another thread's deque when theirs runs dry.
+// Fine-grained work doesn't pile every thread onto one lock the way SkThreadPool does, and
+// work add()ed from a pool thread stays on that thread's queue (and so its cache) until stolen.
+class SkWorkStealingThreadPool final : public SkExecutor {
+public:
+    SkWorkStealingThreadPool(int threads, bool allowBorrowing)
+            : fQueues(new Queue[threads])
+            , fQueueCount(threads)
+            , fAllowBorrowing(allowBorrowing) {
+        for (int i = 0; i < threads; i++) {
+            fThreads.emplace_back(&Loop, this, i);
+        }
+    }
+
+    ~SkWorkStealingThreadPool() override {
+        // Threads drain every queue they can see before honoring the shutdown flag.
+        fShutdown.store(true, std::memory_order_release);
+        fWorkAvailable.signal(fThreads.count());
+        for (int i = 0; i < fThreads.count(); i++) {
+            fThreads[i].join();
+        }
+    }
+
+    void add(std::function<void(void)> work) override {
+        SkASSERT(work);
+        int i = this->currentThreadIndex();
+        if (i < 0) {
+            // Distribute external work round-robin.
+            i = fNextQueue.fetch_add(1, std::memory_order_relaxed) % fQueueCount;
+        }
+        {
+            SkAutoMutexExclusive lock(fQueues[i].fLock);
+            fQueues[i].fWork.push_back(std::move(work));
+        }
+        fWorkAvailable.signal(1);
+    }
+
+    void borrow() override {
+        // If there is work waiting and we're allowed to borrow work, do it.
+        if (fAllowBorrowing && fWorkAvailable.try_wait()) {
+            this->do_work(this->currentThreadIndex());
+        }
+    }
+
+private:
+    struct Queue {
+        SkMutex                               fLock;
+        std::deque<std::function<void(void)>> fWork;
+    };
+
+    int currentThreadIndex() const {
+        return tl_pool == this ? tl_index : -1;
+    }
+
+    // Returns our own newest work, or failing that, the oldest work we can steal.
+    // Threads keep the rest of a stolen batch; borrowers (owner < 0) take single tasks.
+    std::function<void(void)> take(int owner) {
+        if (owner >= 0) {
+            SkAutoMutexExclusive lock(fQueues[owner].fLock);
+            if (!fQueues[owner].fWork.empty()) {
+                std::function<void(void)> work = std::move(fQueues[owner].fWork.back());
+                fQueues[owner].fWork.pop_back();
+                return work;
+            }
+        }
+        for (int offset = 0; offset < fQueueCount; offset++) {
+            int victim = (owner >= 0 ? owner + 1 + offset : offset) % fQueueCount;
+            if (victim == owner) {
+                continue;
+            }
+            std::deque<std::function<void(void)>> stolen;
+            {
+                SkAutoMutexExclusive lock(fQueues[victim].fLock);
+                size_t count = fQueues[victim].fWork.size();
+                size_t grab = owner >= 0 ? (count + 1) / 2 : std::min<size_t>(count, 1);
+                for (size_t i = 0; i < grab; i++) {
+                    stolen.push_back(std::move(fQueues[victim].fWork.front()));
+                    fQueues[victim].fWork.pop_front();
+                }
+            }
+            if (stolen.empty()) {
+                continue;
+            }
+            std::function<void(void)> work = std::move(stolen.front());
+            stolen.pop_front();
+            if (!stolen.empty()) {
+                SkAutoMutexExclusive lock(fQueues[owner].fLock);
+                for (std::function<void(void)>& w : stolen) {
+                    fQueues[owner].fWork.push_back(std::move(w));
+                }
+            }
+            return work;
+        }
+        return nullptr;
+    }
+
+    bool do_work(int owner) {
+        std::function<void(void)> work = this->take(owner);
+        if (!work) {
+            return false;
+        }
+        work();
+        return true;
+    }
+
+    static void Loop(void* ctx, int index) {
+        auto pool = (SkWorkStealingThreadPool*)ctx;
+        tl_pool = pool;
+        tl_index = index;
+        for (;;) {
+            pool->fWorkAvailable.wait();
+            // Drain everything in sight; surplus semaphore signals just mean empty scans.
+            while (pool->do_work(index)) {}
+            if (pool->fShutdown.load(std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    static thread_local const SkWorkStealingThreadPool* tl_pool;
+    static thread_local int                             tl_index;
+
+    std::unique_ptr<Queue[]>  fQueues;
+    int                       fQueueCount;
+    SkTArray<std::thread>     fThreads;
+    SkSemaphore               fWorkAvailable;
+    std::atomic<uint32_t>     fNextQueue{0};
+    std::atomic<bool>         fShutdown{false};
+    bool                      fAllowBorrowing;
+};
+
+thread_local const SkWorkStealingThreadPool* SkWorkStealingThreadPool::tl_pool = nullptr;
+thread_local int                             SkWorkStealingThreadPool::tl_index = -1;
+
 std::unique_ptr<SkExecutor> SkExecutor::MakeFIFOThreadPool(int threads, bool allowBorrowing) {
     using WorkList = std::deque<std::function<void(void)>>;
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
@@ -149,3 +285,8 @@ std::unique_ptr<SkExecutor> SkExecutor::MakeLIFOThreadPool(int threads, bool all
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
                                                     allowBorrowing);
 }
+std::unique_ptr<SkExecutor> SkExecutor::MakeWorkStealingThreadPool(int threads,
+                                                                    bool allowBorrowing) {
+    return std::make_unique<SkWorkStealingThreadPool>(threads > 0 ? threads : num_cores(),
+                                                      allowBorrowing);
+}
@@ -170,11 +170,12 @@ SkScalar SkFont::measureText(const void* text, size_t length, SkTextEncoding enc
     const SkGlyphID* glyphIDs = atg.glyphs();
 
     SkStrikeSpec strikeSpec = SkStrikeSpec::MakeCanonicalized(*this, paint);
-    SkBulkGlyphMetrics metrics{strikeSpec};
-    SkSpan<const SkGlyph*> glyphs = metrics.glyphs(SkMakeSpan(glyphIDs, glyphCount));
 
     SkScalar width = 0;
     if (bounds) {
+        SkBulkGlyphMetrics metrics{strikeSpec};
+        SkSpan<const SkGlyph*> glyphs = metrics.glyphs(SkMakeSpan(glyphIDs, glyphCount));
+
         *bounds = glyphs[0]->rect();
         width = glyphs[0]->advanceX();
         for (int i = 1; i < glyphCount; ++i) {
@@ -184,8 +185,15 @@ SkScalar SkFont::measureText(const void* text, size_t length, SkTextEncoding enc
             width += glyphs[i]->advanceX();
         }
     } else {
-        for (auto glyph : glyphs) {
-            width += glyph->advanceX();
+        // Measurement only: gather from the strike's flat advance table.
+        SkBulkGlyphAdvances bulk{strikeSpec};
+        SkScalar advances[64];
+        for (int i = 0; i < glyphCount; i += SK_ARRAY_COUNT(advances)) {
+            const int n = std::min<int>(glyphCount - i, SK_ARRAY_COUNT(advances));
+            bulk.advances(SkMakeSpan(glyphIDs + i, n), advances);
+            for (int j = 0; j < n; ++j) {
+                width += advances[j];
+            }
         }
     }
 
@@ -209,11 +217,22 @@ void SkFont::getWidthsBounds(const SkGlyphID glyphIDs[],
                              SkRect bounds[],
                              const SkPaint* paint) const {
     SkStrikeSpec strikeSpec = SkStrikeSpec::MakeCanonicalized(*this, paint);
+    SkScalar scale = strikeSpec.strikeToSourceRatio();
+
+    if (widths && !bounds) {
+        SkBulkGlyphAdvances bulk{strikeSpec};
+        bulk.advances(SkMakeSpan(glyphIDs, count), widths);
+        if (scale != 1) {
+            for (int i = 0; i < count; ++i) {
+                widths[i] *= scale;
+            }
+        }
+        return;
+    }
+
     SkBulkGlyphMetrics metrics{strikeSpec};
     SkSpan<const SkGlyph*> glyphs = metrics.glyphs(SkMakeSpan(glyphIDs, count));
 
-    SkScalar scale = strikeSpec.strikeToSourceRatio();
-
     if (bounds) {
         SkMatrix scaleMat = SkMatrix::Scale(scale, scale);
         SkRect* cursor = bounds;
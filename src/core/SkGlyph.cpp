@@ -90,6 +90,13 @@ bool SkGlyph::setImage(SkArenaAlloc* alloc, SkScalerContext* scalerContext) {
     return false;
 }
 
+size_t SkGlyph::prepareImageStorage(SkArenaAlloc* alloc) {
+    if (!this->setImageHasBeenCalled()) {
+        return this->allocImage(alloc);
+    }
+    return 0;
+}
+
 bool SkGlyph::setImage(SkArenaAlloc* alloc, const void* image) {
     if (!this->setImageHasBeenCalled()) {
         this->allocImage(alloc);
@@ -261,6 +261,11 @@ public:
     bool setImage(SkArenaAlloc* alloc, SkScalerContext* scalerContext);
     bool setImage(SkArenaAlloc* alloc, const void* image);
 
+    // Allocate the image storage without rendering into it, so a whole run of glyphs can then
+    // be rendered with one SkScalerContext::getImages call. Returns the number of bytes
+    // allocated, or 0 if the image was already set (or the glyph is empty or too large).
+    size_t prepareImageStorage(SkArenaAlloc* alloc);
+
     // Merge the from glyph into this glyph using alloc to allocate image data. Return the number
     // of bytes allocated. Copy the width, height, top, left, format, and image into this glyph
     // making a copy of the image using the alloc.
@@ -209,7 +209,7 @@ const SkGlyphRunList& SkGlyphRunBuilder::textToGlyphRunList(
 }
 
 const SkGlyphRunList& SkGlyphRunBuilder::blobToGlyphRunList(
-        const SkTextBlob& blob, SkPoint origin) {
+        const SkTextBlob& blob, SkPoint origin, const SkRect* cullRect) {
     // Pre-size all the buffers so they don't move during processing.
     this->initialize(blob);
 
@@ -222,6 +222,11 @@ const SkGlyphRunList& SkGlyphRunBuilder::blobToGlyphRunList(
             continue;
         }
 
+        if (cullRect && !it.bounds().isEmpty() && !cullRect->intersects(it.bounds())) {
+            // The run's cached bounds are entirely clipped out; skip it before glyph processing.
+            continue;
+        }
+
         const SkFont& font = it.font();
         auto glyphIDs = SkSpan<const SkGlyphID>{it.glyphs(), runSize};
 
@@ -267,6 +272,56 @@ const SkGlyphRunList& SkGlyphRunBuilder::blobToGlyphRunList(
     return this->makeGlyphRunList(&blob, blob.bounds().makeOffset(origin), origin);
 }
 
+const SkGlyphRunList& SkGlyphRunBuilder::glyphRunsToGlyphRunList(
+        const SkCanvas::GlyphRun runs[], int runCount, const SkPaint& paint) {
+    SkASSERT(runCount > 0);
+
+    // Pre-size the position buffer so the spans don't move while the runs accumulate.
+    int positionCount = 0;
+    for (int i = 0; i < runCount; ++i) {
+        if (runs[i].fCount > 0) {
+            positionCount += runs[i].fCount;
+        }
+    }
+    this->prepareBuffers(positionCount, 0);
+
+    // All positions are rebased onto the first run's origin, so the whole batch flows
+    // through the painter as one list with a single origin.
+    const SkPoint origin = runs[0].fOrigin;
+
+    SkRect bounds = SkRect::MakeEmpty();
+    SkPoint* positionCursor = fPositions;
+    for (int i = 0; i < runCount; ++i) {
+        const SkCanvas::GlyphRun& run = runs[i];
+        if (run.fCount <= 0 || !SkFontPriv::IsFinite(*run.fFont)) {
+            // If no glyphs or the font is not finite, don't add the run.
+            continue;
+        }
+
+        SkSpan<const SkPoint> positions;
+        const SkVector translate = run.fOrigin - origin;
+        if (translate.isZero()) {
+            positions = SkMakeSpan(run.fPositions, run.fCount);
+        } else {
+            SkPoint* runPositions = positionCursor;
+            for (int g = 0; g < run.fCount; ++g) {
+                *positionCursor++ = run.fPositions[g] + translate;
+            }
+            positions = SkMakeSpan(runPositions, run.fCount);
+        }
+
+        this->makeGlyphRun(*run.fFont,
+                           SkMakeSpan(run.fGlyphs, run.fCount),
+                           positions,
+                           SkSpan<const char>{},
+                           SkSpan<const uint32_t>{},
+                           SkSpan<const SkVector>{});
+        bounds.join(fGlyphRunListStorage.back().sourceBounds(paint));
+    }
+
+    return this->makeGlyphRunList(nullptr, bounds.makeOffset(origin), origin);
+}
+
 std::tuple<SkSpan<const SkPoint>, SkSpan<const SkVector>>
 SkGlyphRunBuilder::convertRSXForm(SkSpan<const SkRSXform> xforms) {
     const int count = SkCount(xforms);
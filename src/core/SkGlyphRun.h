@@ -11,6 +11,7 @@
 #include <functional>
 #include <vector>
 
+#include "include/core/SkCanvas.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPoint.h"
@@ -127,7 +128,14 @@ public:
                                              size_t byteLength,
                                              SkPoint origin,
                                              SkTextEncoding encoding = SkTextEncoding::kUTF8);
-    const SkGlyphRunList& blobToGlyphRunList(const SkTextBlob& blob, SkPoint origin);
+    // If cullRect (blob space) is provided, runs whose cached bounds miss it are dropped
+    // before any glyph processing.
+    const SkGlyphRunList& blobToGlyphRunList(const SkTextBlob& blob, SkPoint origin,
+                                             const SkRect* cullRect = nullptr);
+    // Gather runs with differing fonts and origins into one list; positions are rebased
+    // onto the first run's origin.
+    const SkGlyphRunList& glyphRunsToGlyphRunList(
+            const SkCanvas::GlyphRun runs[], int runCount, const SkPaint& paint);
     std::tuple<SkSpan<const SkPoint>, SkSpan<const SkVector>>
             convertRSXForm(SkSpan<const SkRSXform> xforms);
 
@@ -15,6 +15,7 @@
 #include "src/gpu/GrCaps.h"
 #include "src/gpu/GrRecordingContextPriv.h"
 #include "src/gpu/SkGr.h"
+#include "src/gpu/effects/GrBicubicEffect.h"
 #include "src/gpu/effects/GrGaussianConvolutionFragmentProcessor.h"
 #include "src/gpu/effects/GrMatrixConvolutionEffect.h"
 
@@ -321,9 +322,27 @@ static std::unique_ptr<GrSurfaceDrawContext> reexpand(GrRecordingContext* contex
     }
 
     GrPaint paint;
-    auto fp = GrTextureEffect::MakeSubset(std::move(srcView), srcAlphaType, SkMatrix::I(),
-                                          GrSamplerState::Filter::kLinear, srcBounds, srcBounds,
-                                          *context->priv().caps());
+    std::unique_ptr<GrFragmentProcessor> fp;
+    if (dstSize.width() > srcBounds.width() || dstSize.height() > srcBounds.height()) {
+        // When the blur was computed at a reduced resolution a bilinear upscale shows linear
+        // artifacts (star-like patterns at large scale factors), so spend a bicubic pass on it.
+        // Mitchell rather than Catmull-Rom since the latter's sharpening can ring on the smooth
+        // blurred content.
+        static constexpr auto kWM = GrSamplerState::WrapMode::kClamp;
+        fp = GrBicubicEffect::MakeSubset(std::move(srcView),
+                                         srcAlphaType,
+                                         SkMatrix::I(),
+                                         kWM,
+                                         kWM,
+                                         srcBounds,
+                                         GrBicubicEffect::gMitchell,
+                                         GrBicubicEffect::Direction::kXY,
+                                         *context->priv().caps());
+    } else {
+        fp = GrTextureEffect::MakeSubset(std::move(srcView), srcAlphaType, SkMatrix::I(),
+                                         GrSamplerState::Filter::kLinear, srcBounds, srcBounds,
+                                         *context->priv().caps());
+    }
     paint.setColorFragmentProcessor(std::move(fp));
     paint.setPorterDuffXPFactory(SkBlendMode::kSrc);
 
@@ -8,6 +8,8 @@
 #include "include/core/SkGraphics.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkFontMgr.h"
 #include "include/core/SkMath.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPath.h"
@@ -15,7 +17,9 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkStream.h"
+#include "include/core/SkString.h"
 #include "include/core/SkTime.h"
+#include "include/private/SkMutex.h"
 #include "src/core/SkBlitter.h"
 #include "src/core/SkCpu.h"
 #include "src/core/SkGeometry.h"
@@ -24,6 +28,7 @@
 #include "src/core/SkResourceCache.h"
 #include "src/core/SkScalerContext.h"
 #include "src/core/SkStrikeCache.h"
+#include "src/core/SkStrikeSpec.h"
 #include "src/core/SkTSearch.h"
 #include "src/core/SkTypefaceCache.h"
 
@@ -35,6 +40,47 @@ void SkGraphics::Init() {
     SkOpts::Init();
 }
 
+static SkMutex& init_timings_mutex() {
+    static SkMutex& mutex = *(new SkMutex);
+    return mutex;
+}
+
+static SkString& init_timings() {
+    static SkString& timings = *(new SkString);
+    return timings;
+}
+
+void SkGraphics::InitAsync(SkExecutor* executor) {
+    if (!executor) {
+        return;
+    }
+    struct WarmUp {
+        const char* fName;
+        void (*fFn)();
+    };
+    static constexpr WarmUp kWarmUps[] = {
+        {"opts",           [] { SkGraphics::Init(); }},
+        {"strike-cache",   [] { (void)SkStrikeCache::GlobalStrikeCache(); }},
+        {"resource-cache", [] { (void)SkResourceCache::GetTotalBytesUsed(); }},
+        {"font-manager",   [] { (void)SkFontMgr::RefDefault(); }},
+    };
+    for (const WarmUp& warmUp : kWarmUps) {
+        executor->add([warmUp] {
+            double startNS = SkTime::GetNSecs();
+            warmUp.fFn();
+            double ms = (SkTime::GetNSecs() - startNS) * 1e-6;
+            SkAutoMutexExclusive lock(init_timings_mutex());
+            init_timings().appendf("%s: %.3fms\n", warmUp.fName, ms);
+        });
+    }
+}
+
+void SkGraphics::GetInitTimings(SkString* report) {
+    SkASSERT(report);
+    SkAutoMutexExclusive lock(init_timings_mutex());
+    report->append(init_timings());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void SkGraphics::DumpMemoryStatistics(SkTraceMemoryDump* dump) {
@@ -48,6 +94,50 @@ void SkGraphics::PurgeAllCaches() {
     SkImageFilter_Base::PurgeCache();
 }
 
+void SkGraphics::PurgeAllCachesAsync(SkExecutor* executor, size_t bytesPerStep) {
+    if (!executor || 0 == bytesPerStep) {
+        return;
+    }
+    executor->add([executor, bytesPerStep] {
+        size_t freed = SkGraphics::PurgeFontCachePartial(bytesPerStep);
+        if (freed < bytesPerStep) {
+            freed += SkGraphics::PurgeResourceCachePartial(bytesPerStep - freed);
+        }
+        if (freed > 0) {
+            // More may remain (or have been added since); keep trickling.
+            SkGraphics::PurgeAllCachesAsync(executor, bytesPerStep);
+        } else {
+            // The LRU lists are drained; finish with the (small) image filter cache.
+            SkImageFilter_Base::PurgeCache();
+        }
+    });
+}
+
+void SkGraphics::PrefetchGlyphImages(const SkFont& font, const SkPaint& paint,
+                                     const SkMatrix& deviceMatrix,
+                                     const SkSurfaceProps& surfaceProps,
+                                     const SkGlyphID glyphs[], int count,
+                                     SkExecutor* executor) {
+    if (!executor || count <= 0) {
+        return;
+    }
+
+    SkStrikeSpec strikeSpec = SkStrikeSpec::MakeMask(
+            font, paint, surfaceProps,
+            SkScalerContextFlags::kFakeGammaAndBoostContrast, deviceMatrix);
+    std::vector<SkPackedGlyphID> packedIDs;
+    packedIDs.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        packedIDs.emplace_back(glyphs[i]);
+    }
+
+    executor->add([strikeSpec = std::move(strikeSpec), packedIDs = std::move(packedIDs)] {
+        sk_sp<SkStrike> strike = strikeSpec.findOrCreateStrike();
+        SkAutoTArray<const SkGlyph*> results{SkToInt(packedIDs.size())};
+        strike->prepareImages(SkMakeSpan(packedIDs.data(), packedIDs.size()), results.get());
+    });
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 static const char kFontCacheLimitStr[] = "font-cache-limit";
@@ -108,6 +198,14 @@ size_t SkGraphics::GetFontCacheUsed() {
     return SkStrikeCache::GlobalStrikeCache()->getTotalMemoryUsed();
 }
 
+size_t SkGraphics::GetAllocationBytesForTag(SkMallocTag tag) {
+#ifdef SK_MALLOC_ACCOUNTING
+    return sk_malloc_tag_live_bytes(tag);
+#else
+    return 0;
+#endif
+}
+
 int SkGraphics::GetFontCacheCountLimit() {
     return SkStrikeCache::GlobalStrikeCache()->getCacheCountLimit();
 }
@@ -125,6 +223,10 @@ void SkGraphics::PurgeFontCache() {
     SkTypefaceCache::PurgeAll();
 }
 
+size_t SkGraphics::PurgeFontCachePartial(size_t bytesToPurge) {
+    return SkStrikeCache::GlobalStrikeCache()->purgePartial(bytesToPurge);
+}
+
 extern bool gSkVMAllowJIT;
 
 void SkGraphics::AllowJIT() {
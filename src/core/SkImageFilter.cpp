@@ -8,16 +8,21 @@
 #include "include/core/SkImageFilter.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkData.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkSerialProcs.h"
 #include "include/private/SkSafe32.h"
+#include "src/core/SkAutoMalloc.h"
 #include "src/core/SkFuzzLogging.h"
 #include "src/core/SkImageFilterCache.h"
 #include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkLocalMatrixImageFilter.h"
 #include "src/core/SkMatrixImageFilter.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkSpecialImage.h"
 #include "src/core/SkSpecialSurface.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkValidationUtils.h"
 #include "src/core/SkWriteBuffer.h"
 #if SK_SUPPORT_GPU
@@ -217,6 +222,61 @@ void SkImageFilter_Base::flatten(SkWriteBuffer& buffer) const {
     buffer.writeUInt(fCropRect.flags());
 }
 
+void SkImageFilter_Base::filterAllInputs(const Context& ctx, sk_sp<SkSpecialImage> inputs[],
+                                         SkIPoint offsets[]) const {
+    const int inputCount = this->countInputs();
+    for (int i = 0; i < inputCount; ++i) {
+        offsets[i] = SkIPoint::Make(0, 0);
+    }
+
+    if (!ctx.gpuBacked() && inputCount > 1) {
+        // Independent branches of the DAG can be evaluated concurrently; a recording context
+        // is not thread safe, so the GPU path stays serial. With the default inline executor
+        // this degenerates to the serial loop below.
+        SkTaskGroup taskGroup;
+        for (int i = 0; i < inputCount; ++i) {
+            taskGroup.add([this, &ctx, inputs, offsets, i] {
+                inputs[i] = this->filterInput(i, ctx, &offsets[i]);
+            });
+        }
+        taskGroup.wait();
+    } else {
+        for (int i = 0; i < inputCount; ++i) {
+            inputs[i] = this->filterInput(i, ctx, &offsets[i]);
+        }
+    }
+}
+
+uint32_t SkImageFilter_Base::stableKey() const {
+    this->ensureStableKey();
+    return fStableKey;
+}
+
+const sk_sp<SkData>& SkImageFilter_Base::stableKeyData() const {
+    this->ensureStableKey();
+    return fStableKeyData;
+}
+
+void SkImageFilter_Base::ensureStableKey() const {
+    fStableKeyOnce([this] {
+        SkBinaryWriteBuffer buffer;
+        // Fingerprint any embedded images by identity rather than by content: the default
+        // writeImage path encodes the image's pixels (typically a PNG encode), far too
+        // expensive for a key that is recomputed whenever the DAG is rebuilt. An image's
+        // uniqueID is stable for its lifetime, matching how the cache key already treats the
+        // source image's generation ID.
+        SkSerialProcs procs;
+        procs.fImageProc = [](SkImage* image, void*) -> sk_sp<SkData> {
+            uint32_t id = image->uniqueID();
+            return SkData::MakeWithCopy(&id, sizeof(id));
+        };
+        buffer.setSerialProcs(procs);
+        buffer.writeFlattenable(this);
+        fStableKeyData = buffer.snapshotAsData();
+        fStableKey = SkOpts::hash(fStableKeyData->data(), fStableKeyData->size());
+    });
+}
+
 skif::FilterResult<For::kOutput> SkImageFilter_Base::filterImage(const skif::Context& context) const {
     // TODO (michaelludwig) - Old filters have an implicit assumption that the source image
     // (originally passed separately) has an origin of (0, 0). SkComposeImageFilter makes an effort
@@ -229,13 +289,26 @@ skif::FilterResult<For::kOutput> SkImageFilter_Base::filterImage(const skif::Con
         return result;
     }
 
+    // Computing the fingerprint serializes the filter, so don't pay for it (or the key) when
+    // there is no cache to consult.
+    if (!context.cache()) {
+        result = this->onFilterImage(context);
+        if (context.gpuBacked()) {
+            SkASSERT(!result.image() || result.image()->isTextureBacked());
+        }
+        return result;
+    }
+
     uint32_t srcGenID = fUsesSrcInput ? context.sourceImage()->uniqueID() : 0;
     const SkIRect srcSubset = fUsesSrcInput ? context.sourceImage()->subset()
                                             : SkIRect::MakeWH(0, 0);
 
-    SkImageFilterCacheKey key(fUniqueID, context.mapping().layerMatrix(), context.clipBounds(),
-                              srcGenID, srcSubset);
-    if (context.cache() && context.cache()->get(key, &result)) {
+    // Key on the stable fingerprint rather than fUniqueID so that a filter DAG that is rebuilt
+    // with identical parameters each frame (e.g. a re-recorded drop shadow) still hits the cache.
+    // The fingerprint bytes ride along so the cache can reject hash collisions.
+    SkImageFilterCacheKey key(this->stableKey(), context.mapping().layerMatrix(),
+                              context.clipBounds(), srcGenID, srcSubset);
+    if (context.cache()->get(key, this->stableKeyData().get(), &result)) {
         return result;
     }
 
@@ -245,9 +318,7 @@ skif::FilterResult<For::kOutput> SkImageFilter_Base::filterImage(const skif::Con
         SkASSERT(!result.image() || result.image()->isTextureBacked());
     }
 
-    if (context.cache()) {
-        context.cache()->set(key, this, result);
-    }
+    context.cache()->set(key, this, this->stableKeyData(), result);
 
     return result;
 }
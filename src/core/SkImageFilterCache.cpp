@@ -9,6 +9,7 @@
 
 #include <vector>
 
+#include "include/core/SkData.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkRefCnt.h"
 #include "include/private/SkMutex.h"
@@ -36,12 +37,13 @@ public:
     }
     struct Value {
         Value(const Key& key, const skif::FilterResult<For::kOutput>& image,
-              const SkImageFilter* filter)
-            : fKey(key), fImage(image), fFilter(filter) {}
+              const SkImageFilter* filter, sk_sp<SkData> fingerprint)
+            : fKey(key), fImage(image), fFilter(filter), fFingerprint(std::move(fingerprint)) {}
 
         Key fKey;
         skif::FilterResult<For::kOutput> fImage;
         const SkImageFilter* fFilter;
+        sk_sp<SkData> fFingerprint;
         static const Key& GetKey(const Value& v) {
             return v.fKey;
         }
@@ -51,11 +53,17 @@ public:
         SK_DECLARE_INTERNAL_LLIST_INTERFACE(Value);
     };
 
-    bool get(const Key& key, skif::FilterResult<For::kOutput>* result) const override {
+    bool get(const Key& key, const SkData* fingerprint,
+             skif::FilterResult<For::kOutput>* result) const override {
         SkASSERT(result);
 
         SkAutoMutexExclusive mutex(fMutex);
         if (Value* v = fLookup.find(key)) {
+            // The key's stable key is only a hash of the filter's serialized form; verify the
+            // bytes so two DAGs that collide on it cannot return each other's results.
+            if (fingerprint && v->fFingerprint && !v->fFingerprint->equals(fingerprint)) {
+                return false;
+            }
             if (v != fLRU.head()) {
                 fLRU.remove(v);
                 fLRU.addToHead(v);
@@ -67,13 +75,13 @@ public:
         return false;
     }
 
-    void set(const Key& key, const SkImageFilter* filter,
+    void set(const Key& key, const SkImageFilter* filter, sk_sp<SkData> fingerprint,
              const skif::FilterResult<For::kOutput>& result) override {
         SkAutoMutexExclusive mutex(fMutex);
         if (Value* v = fLookup.find(key)) {
             this->removeInternal(v);
         }
-        Value* v = new Value(key, result, filter);
+        Value* v = new Value(key, result, filter, std::move(fingerprint));
         fLookup.add(v);
         fLRU.addToHead(v);
         fCurrentBytes += result.image() ? result.image()->getSize() : 0;
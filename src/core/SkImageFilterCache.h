@@ -13,6 +13,7 @@
 #include "src/core/SkImageFilterTypes.h"
 
 struct SkIPoint;
+class SkData;
 class SkImageFilter;
 
 struct SkImageFilterCacheKey {
@@ -46,9 +47,12 @@ struct SkImageFilterCacheKey {
     }
 };
 
-// This cache maps from (filter's unique ID + CTM + clipBounds + src bitmap generation ID) to result
-// NOTE: this is the _specific_ unique ID of the image filter, so refiltering the same image with a
-// copy of the image filter (with exactly the same parameters) will not yield a cache hit.
+// This cache maps from (filter's stable key + CTM + clipBounds + src bitmap generation ID) to
+// result. The stable key is a fingerprint of the filter's serialized parameters and inputs
+// (see SkImageFilter_Base::stableKey()), so refiltering the same image with a copy of the image
+// filter (with exactly the same parameters) will yield a cache hit. Since the stable key is a
+// 32-bit hash, the serialized fingerprint bytes are stored with each entry and compared on a
+// hit so that colliding DAGs cannot return each other's results.
 class SkImageFilterCache : public SkRefCnt {
 public:
     SK_USE_FLUENT_IMAGE_FILTER_TYPES_IN_CLASS
@@ -60,12 +64,15 @@ public:
     static SkImageFilterCache* Get();
 
     // Returns true on cache hit and updates 'result' to be the cached result. Returns false when
-    // not in the cache, in which case 'result' is not modified.
-    virtual bool get(const SkImageFilterCacheKey& key,
+    // not in the cache, in which case 'result' is not modified. 'fingerprint' (may be null) is
+    // the querying filter's serialized bytes; a hit whose stored fingerprint differs is treated
+    // as a miss so stable-key hash collisions cannot return the wrong image.
+    virtual bool get(const SkImageFilterCacheKey& key, const SkData* fingerprint,
                      skif::FilterResult<For::kOutput>* result) const = 0;
     // 'filter' is included in the caching to allow the purging of all of an image filter's cached
-    // results when it is destroyed.
+    // results when it is destroyed. 'fingerprint' (may be null) is stored for collision checks.
     virtual void set(const SkImageFilterCacheKey& key, const SkImageFilter* filter,
+                     sk_sp<SkData> fingerprint,
                      const skif::FilterResult<For::kOutput>& result) = 0;
     virtual void purge() = 0;
     virtual void purgeByImageFilter(const SkImageFilter*) = 0;
@@ -9,13 +9,17 @@
 #define SkImageFilter_Base_DEFINED
 
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkData.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkImageInfo.h"
+#include "include/private/SkOnce.h"
 #include "include/private/SkTArray.h"
 #include "include/private/SkTemplates.h"
 
 #include "src/core/SkImageFilterTypes.h"
 
+#include <atomic>
+
 class GrFragmentProcessor;
 class GrRecordingContext;
 
@@ -121,6 +125,21 @@ public:
 
     uint32_t uniqueID() const { return fUniqueID; }
 
+    /**
+     *  A fingerprint of this filter's type, parameters, and inputs, computed by hashing the
+     *  filter's serialized form. Unlike uniqueID(), structurally identical filter DAGs share a
+     *  stable key, so a filter that is destroyed and rebuilt with the same parameters each frame
+     *  can still hit the image filter result cache. Computed lazily on first use. Embedded
+     *  images are fingerprinted by their uniqueID rather than their encoded contents.
+     */
+    uint32_t stableKey() const;
+
+    /**
+     *  The serialized bytes that stableKey() hashes. The result cache compares these on a hit
+     *  so that two distinct DAGs whose hashes collide cannot return each other's results.
+     */
+    const sk_sp<SkData>& stableKeyData() const;
+
     static SkFlattenable::Type GetFlattenableType() {
         return kSkImageFilter_Type;
     }
@@ -222,6 +241,16 @@ protected:
         return this->getInputFilteredImage(index, ctx).imageAndOffset(offset);
     }
 
+    /**
+     *  Evaluates every input of this filter, storing the results and their offsets in the given
+     *  arrays, which must have countInputs() entries. When the context is CPU backed and a
+     *  threaded SkExecutor has been installed with SkExecutor::SetDefault(), independent inputs
+     *  are evaluated in parallel; otherwise this is equivalent to calling filterInput() serially
+     *  in index order.
+     */
+    void filterAllInputs(const Context& ctx, sk_sp<SkSpecialImage> inputs[],
+                         SkIPoint offsets[]) const;
+
     // Helper function to visit each of this filter's child filters and call their
     // onGetInputLayerBounds with the provided 'desiredOutput' and 'contentBounds'. Automatically
     // handles null input filters. Returns the union of all of the children's input bounds.
@@ -451,6 +480,14 @@ private:
     CropRect fCropRect;
     uint32_t fUniqueID; // Globally unique
 
+    void ensureStableKey() const;
+
+    // Lazily computed by ensureStableKey(). SkOnce guarded since const filters can be evaluated
+    // from multiple threads at once.
+    mutable SkOnce fStableKeyOnce;
+    mutable sk_sp<SkData> fStableKeyData;
+    mutable uint32_t fStableKey = 0;
+
     using INHERITED = SkImageFilter;
 };
 
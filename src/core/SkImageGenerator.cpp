@@ -30,6 +30,30 @@ bool SkImageGenerator::getPixels(const SkImageInfo& info, void* pixels, size_t r
     return this->onGetPixels(info, pixels, rowBytes, defaultOpts);
 }
 
+bool SkImageGenerator::startIncrementalDecode(const SkImageInfo& info, void* pixels,
+                                              size_t rowBytes) {
+    if (kUnknown_SkColorType == info.colorType()) {
+        return false;
+    }
+    if (nullptr == pixels) {
+        return false;
+    }
+    if (rowBytes < info.minRowBytes()) {
+        return false;
+    }
+
+    return this->onStartIncrementalDecode(info, pixels, rowBytes);
+}
+
+bool SkImageGenerator::incrementalDecode(int rowBudget, int* totalRowsDecoded) {
+    SkASSERT(totalRowsDecoded);
+    if (rowBudget <= 0) {
+        return false;
+    }
+
+    return this->onIncrementalDecode(rowBudget, totalRowsDecoded);
+}
+
 bool SkImageGenerator::queryYUVAInfo(const SkYUVAPixmapInfo::SupportedDataTypes& supportedDataTypes,
                                      SkYUVAPixmapInfo* yuvaPixmapInfo) const {
     SkASSERT(yuvaPixmapInfo);
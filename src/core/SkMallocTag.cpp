@@ -0,0 +1,38 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/private/SkMallocTag.h"
+
+#ifdef SK_MALLOC_ACCOUNTING
+
+#include <atomic>
+
+static thread_local SkMallocTag tls_current_tag = SkMallocTag::kUntagged;
+
+static std::atomic<size_t> gLiveBytes[kSkMallocTagCount] = {};
+
+SkMallocTag sk_malloc_tag_current() {
+    return tls_current_tag;
+}
+
+void sk_malloc_tag_set_current(SkMallocTag tag) {
+    tls_current_tag = tag;
+}
+
+void sk_malloc_tag_note_alloc(SkMallocTag tag, size_t bytes) {
+    gLiveBytes[static_cast<int>(tag)].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void sk_malloc_tag_note_free(SkMallocTag tag, size_t bytes) {
+    gLiveBytes[static_cast<int>(tag)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+size_t sk_malloc_tag_live_bytes(SkMallocTag tag) {
+    return gLiveBytes[static_cast<int>(tag)].load(std::memory_order_relaxed);
+}
+
+#endif  // SK_MALLOC_ACCOUNTING
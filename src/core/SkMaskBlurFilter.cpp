@@ -13,6 +13,7 @@
 #include "include/private/SkTPin.h"
 #include "include/private/SkTemplates.h"
 #include "include/private/SkTo.h"
+#include "include/private/SkVx.h"
 #include "src/core/SkArenaAlloc.h"
 #include "src/core/SkGaussFilter.h"
 
@@ -195,6 +196,124 @@ public:
             }
         }
 
+        // The same calculation as blur() above, but run on eight adjacent rows at once with one
+        // vector lane per row. Since the output of a scan is written transposed, the eight
+        // results of each step land in adjacent bytes of the destination; batching rows this way
+        // turns the scattered single-byte stores of the scalar scan into one contiguous eight
+        // byte store. Only handles a plain A8 source; callers fall back to blur() for other
+        // formats and for the trailing rows of a mask.
+        void blurStrip(const uint8_t* src, size_t srcRB, int srcW,
+                       uint8_t* dst, int dstStride, uint8_t* dstEnd,
+                       skvx::Vec<8, uint32_t>* buffer) const {
+            using V8x32 = skvx::Vec<8, uint32_t>;
+
+            V8x32* buffer0    = buffer;
+            V8x32* buffer0End = buffer0 + (fBuffer0End - fBuffer0);
+            V8x32* buffer1    = buffer0End;
+            V8x32* buffer1End = buffer1 + (fBuffer1End - fBuffer1);
+            V8x32* buffer2    = buffer1End;
+            V8x32* buffer2End = buffer2 + (fBuffer2End - fBuffer2);
+
+            V8x32* buffer0Cursor = buffer0;
+            V8x32* buffer1Cursor = buffer1;
+            V8x32* buffer2Cursor = buffer2;
+
+            // Lane i reads row i of the strip.
+            auto loadStrip = [&](int x) {
+                V8x32 v;
+                for (int i = 0; i < 8; i++) {
+                    v[i] = src[i * srcRB + x];
+                }
+                return v;
+            };
+
+            // The eight outputs are adjacent bytes in the transposed destination.
+            auto storeStrip = [&](uint8_t* d, const V8x32& sum2) {
+                for (int i = 0; i < 8; i++) {
+                    d[i] = this->finalScale(sum2[i]);
+                }
+            };
+
+            std::memset(buffer0, 0x00, (buffer2End - buffer0) * sizeof(*buffer0));
+
+            V8x32 sum0 = 0;
+            V8x32 sum1 = 0;
+            V8x32 sum2 = 0;
+
+            // Consume the source generating pixels.
+            for (int x = 0; x < srcW; ++x, dst += dstStride) {
+                V8x32 leadingEdge = loadStrip(x);
+                sum0 += leadingEdge;
+                sum1 += sum0;
+                sum2 += sum1;
+
+                storeStrip(dst, sum2);
+
+                sum2 -= *buffer2Cursor;
+                *buffer2Cursor = sum1;
+                buffer2Cursor = (buffer2Cursor + 1) < buffer2End ? buffer2Cursor + 1 : buffer2;
+
+                sum1 -= *buffer1Cursor;
+                *buffer1Cursor = sum0;
+                buffer1Cursor = (buffer1Cursor + 1) < buffer1End ? buffer1Cursor + 1 : buffer1;
+
+                sum0 -= *buffer0Cursor;
+                *buffer0Cursor = leadingEdge;
+                buffer0Cursor = (buffer0Cursor + 1) < buffer0End ? buffer0Cursor + 1 : buffer0;
+            }
+
+            // The leading edge is off the right side of the mask.
+            for (int i = 0; i < fNoChangeCount; i++) {
+                sum1 += sum0;
+                sum2 += sum1;
+
+                storeStrip(dst, sum2);
+
+                sum2 -= *buffer2Cursor;
+                *buffer2Cursor = sum1;
+                buffer2Cursor = (buffer2Cursor + 1) < buffer2End ? buffer2Cursor + 1 : buffer2;
+
+                sum1 -= *buffer1Cursor;
+                *buffer1Cursor = sum0;
+                buffer1Cursor = (buffer1Cursor + 1) < buffer1End ? buffer1Cursor + 1 : buffer1;
+
+                sum0 -= *buffer0Cursor;
+                *buffer0Cursor = 0;
+                buffer0Cursor = (buffer0Cursor + 1) < buffer0End ? buffer0Cursor + 1 : buffer0;
+
+                dst += dstStride;
+            }
+
+            // Starting from the right, fill in the rest of the buffer.
+            std::memset(buffer0, 0, (buffer2End - buffer0) * sizeof(*buffer0));
+
+            sum0 = sum1 = sum2 = 0;
+
+            uint8_t* dstCursor = dstEnd;
+            int x = srcW;
+            while (dstCursor > dst) {
+                dstCursor -= dstStride;
+                V8x32 leadingEdge = loadStrip(--x);
+                sum0 += leadingEdge;
+                sum1 += sum0;
+                sum2 += sum1;
+
+                storeStrip(dstCursor, sum2);
+
+                sum2 -= *buffer2Cursor;
+                *buffer2Cursor = sum1;
+                buffer2Cursor = (buffer2Cursor + 1) < buffer2End ? buffer2Cursor + 1 : buffer2;
+
+                sum1 -= *buffer1Cursor;
+                *buffer1Cursor = sum0;
+                buffer1Cursor = (buffer1Cursor + 1) < buffer1End ? buffer1Cursor + 1 : buffer1;
+
+                sum0 -= *buffer0Cursor;
+                *buffer0Cursor = leadingEdge;
+                buffer0Cursor = (buffer0Cursor + 1) < buffer0End ? buffer0Cursor + 1 : buffer0;
+            }
+        }
+
     private:
         static constexpr uint64_t kHalf = static_cast<uint64_t>(1) << 31;
 
@@ -987,6 +1106,7 @@ SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
 
     auto bufferSize = std::max(planW.bufferSize(), planH.bufferSize());
     auto buffer = alloc.makeArrayDefault<uint32_t>(bufferSize);
+    auto stripBuffer = alloc.makeArrayDefault<skvx::Vec<8, uint32_t>>(bufferSize);
 
     // Blur both directions.
     int tmpW = srcH,
@@ -1011,10 +1131,18 @@ SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
             }
         } break;
         case SkMask::kA8_Format: {
-            const uint8_t* a8Start = src.fImage;
+            // Scan eight rows at a time; each step of a strip stores its eight transposed
+            // outputs contiguously instead of scattering single bytes across tmp.
+            int y = 0;
+            for (; y + 8 <= srcH; y += 8) {
+                auto tmpStart = &tmp[y];
+                scanW.blurStrip(&src.fImage[y * src.fRowBytes], src.fRowBytes, srcW,
+                                tmpStart, tmpW, tmpStart + tmpW * tmpH, stripBuffer);
+            }
+            const uint8_t* a8Start = &src.fImage[y * src.fRowBytes];
             auto start = SkMask::AlphaIter<SkMask::kA8_Format>(a8Start);
             auto end = SkMask::AlphaIter<SkMask::kA8_Format>(a8Start + srcW);
-            for (int y = 0; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
+            for (; y < srcH; ++y, start >>= src.fRowBytes, end >>= src.fRowBytes) {
                 auto tmpStart = &tmp[y];
                 scanW.blur(start, end, tmpStart, tmpW, tmpStart + tmpW * tmpH);
             }
@@ -1044,7 +1172,15 @@ SkIPoint SkMaskBlurFilter::blur(const SkMask& src, SkMask* dst) const {
     // Blur vertically (scan in memory order because of the transposition),
     // and transpose back to the original orientation.
     const PlanGauss::Scan& scanH = planH.makeBlurScan(tmpW, buffer);
-    for (int y = 0; y < tmpH; y++) {
+    int y = 0;
+    for (; y + 8 <= tmpH; y += 8) {
+        auto tmpStart = &tmp[y * tmpW];
+        auto dstStart = &dst->fImage[y];
+
+        scanH.blurStrip(tmpStart, tmpW, tmpW,
+                        dstStart, dst->fRowBytes, dstStart + dst->fRowBytes * dstH, stripBuffer);
+    }
+    for (; y < tmpH; y++) {
         auto tmpStart = &tmp[y * tmpW];
         auto dstStart = &dst->fImage[y];
 
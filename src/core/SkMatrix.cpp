@@ -16,6 +16,7 @@
 #include "include/private/SkTo.h"
 #include "src/core/SkMathPriv.h"
 #include "src/core/SkMatrixPriv.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkPathPriv.h"
 
 #include <cstddef>
@@ -1071,6 +1072,50 @@ void SkMatrixPriv::MapHomogeneousPointsWithStride(const SkMatrix& mx, SkPoint3 d
     }
 }
 
+void SkMatrixPriv::MapPointsSoA(const SkMatrix& mx, float dstX[], float dstY[],
+                                const float srcX[], const float srcY[], int count) {
+    SkASSERT((dstX && dstY && srcX && srcY && count > 0) || 0 == count);
+    if (count <= 0) {
+        return;
+    }
+    if (!mx.hasPerspective()) {
+        const float affine[6] = { mx.getScaleX(), mx.getSkewX(),  mx.getTranslateX(),
+                                  mx.getSkewY(),  mx.getScaleY(), mx.getTranslateY() };
+        SkOpts::matrix_map_points_soa(affine, dstX, dstY, srcX, srcY, count);
+        return;
+    }
+
+    SkMatrix::MapXYProc proc = GetMapXYProc(mx);
+    for (int i = 0; i < count; ++i) {
+        SkPoint mapped;
+        proc(mx, srcX[i], srcY[i], &mapped);
+        dstX[i] = mapped.fX;
+        dstY[i] = mapped.fY;
+    }
+}
+
+SkRect SkMatrixPriv::MapPointsAndBounds(const SkMatrix& mx, SkPoint dst[], const SkPoint src[],
+                                        int count) {
+    SkASSERT((dst && src && count > 0) || 0 == count);
+    if (count <= 0) {
+        return SkRect::MakeEmpty();
+    }
+    if (!mx.hasPerspective()) {
+        const float affine[6] = { mx.getScaleX(), mx.getSkewX(),  mx.getTranslateX(),
+                                  mx.getSkewY(),  mx.getScaleY(), mx.getTranslateY() };
+        float ltrb[4];
+        if (SkOpts::matrix_map_points_bounds(affine, dst, src, count, ltrb)) {
+            return SkRect::MakeLTRB(ltrb[0], ltrb[1], ltrb[2], ltrb[3]);
+        }
+        return SkRect::MakeEmpty();
+    }
+
+    mx.mapPoints(dst, src, count);
+    SkRect bounds;
+    bounds.setBounds(dst, count);
+    return bounds;
+}
+
 void SkMatrix::mapHomogeneousPoints(SkPoint3 dst[], const SkPoint3 src[], int count) const {
     SkMatrixPriv::MapHomogeneousPointsWithStride(*this, dst, sizeof(SkPoint3), src,
                                                  sizeof(SkPoint3), count);
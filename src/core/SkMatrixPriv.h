@@ -147,6 +147,34 @@ public:
     static void MapHomogeneousPointsWithStride(const SkMatrix& mx, SkPoint3 dst[], size_t dstStride,
                                                const SkPoint3 src[], size_t srcStride, int count);
 
+    /** Maps count points given as parallel x/y arrays (struct-of-arrays) to parallel dst
+        arrays. Keeping the lanes split lets non-perspective matrices map eight points per
+        SIMD iteration with no interleave shuffles, which matters when culling large point
+        sets. src and dst may alias exactly or not at all.
+
+        @param mx     matrix used to map the points
+        @param dstX   storage for mapped x coordinates
+        @param dstY   storage for mapped y coordinates
+        @param srcX   x coordinates to transform
+        @param srcY   y coordinates to transform
+        @param count  number of points to transform
+    */
+    static void MapPointsSoA(const SkMatrix& mx, float dstX[], float dstY[],
+                             const float srcX[], const float srcY[], int count);
+
+    /** Maps src SkPoint array of length count to dst SkPoint array, as SkMatrix::mapPoints
+        does, and returns the bounds of the mapped points. The bounds are accumulated in the
+        same pass as the mapping so the dst array is never re-read. Returns the empty rect if
+        count is 0 or any mapped coordinate is non-finite.
+
+        @param mx     matrix used to map the points
+        @param dst    storage for mapped points
+        @param src    points to transform
+        @param count  number of points to transform
+    */
+    static SkRect MapPointsAndBounds(const SkMatrix& mx, SkPoint dst[], const SkPoint src[],
+                                     int count);
+
     static bool PostIDiv(SkMatrix* matrix, int divx, int divy) {
         return matrix->postIDiv(divx, divy);
     }
@@ -8,15 +8,16 @@
 #ifndef SkMessageBus_DEFINED
 #define SkMessageBus_DEFINED
 
+#include <atomic>
 #include <type_traits>
 
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypes.h"
-#include "include/private/SkMutex.h"
 #include "include/private/SkNoncopyable.h"
 #include "include/private/SkOnce.h"
 #include "include/private/SkTArray.h"
 #include "include/private/SkTDArray.h"
+#include "src/core/SkSharedMutex.h"
 
 /**
  * The following method must have a specialization for type 'Message':
@@ -53,9 +54,16 @@ public:
         void poll(SkTArray<Message>* out);
 
     private:
-        SkTArray<Message> fMessages;
-        SkMutex           fMessagesMutex;
-        const IDType      fUniqueID;
+        // Messages are kept on a lock-free list so invalidation storms never contend with the
+        // thread polling this inbox: receive() pushes with a compare-exchange and poll()
+        // detaches the whole list with one exchange, then reverses it back to arrival order.
+        struct Node {
+            Message fMessage;
+            Node*   fNext;
+        };
+
+        std::atomic<Node*> fTop{nullptr};
+        const IDType       fUniqueID;
 
         friend class SkMessageBus;
         void receive(Message m);  // SkMessageBus is a friend only to call this.
@@ -66,7 +74,7 @@ private:
     static SkMessageBus* Get();
 
     SkTDArray<Inbox*> fInboxes;
-    SkMutex           fInboxesMutex;
+    SkSharedMutex     fInboxesMutex;
 };
 
 // This must go in a single .cpp file, not some .h, or we risk creating more than one global
@@ -88,7 +96,7 @@ SkMessageBus<Message, IDType, AllowCopyableMessage>::Inbox::Inbox(IDType uniqueI
         : fUniqueID(uniqueID) {
     // Register ourselves with the corresponding message bus.
     auto* bus = SkMessageBus<Message, IDType, AllowCopyableMessage>::Get();
-    SkAutoMutexExclusive lock(bus->fInboxesMutex);
+    SkAutoSharedMutexExclusive lock(bus->fInboxesMutex);
     bus->fInboxes.push_back(this);
 }
 
@@ -96,28 +104,51 @@ template <typename Message, typename IDType, bool AllowCopyableMessage>
 SkMessageBus<Message, IDType, AllowCopyableMessage>::Inbox::~Inbox() {
     // Remove ourselves from the corresponding message bus.
     auto* bus = SkMessageBus<Message, IDType, AllowCopyableMessage>::Get();
-    SkAutoMutexExclusive lock(bus->fInboxesMutex);
-    // This is a cheaper fInboxes.remove(fInboxes.find(this)) when order doesn't matter.
-    for (int i = 0; i < bus->fInboxes.count(); i++) {
-        if (this == bus->fInboxes[i]) {
-            bus->fInboxes.removeShuffle(i);
-            break;
+    {
+        SkAutoSharedMutexExclusive lock(bus->fInboxesMutex);
+        // This is a cheaper fInboxes.remove(fInboxes.find(this)) when order doesn't matter.
+        for (int i = 0; i < bus->fInboxes.count(); i++) {
+            if (this == bus->fInboxes[i]) {
+                bus->fInboxes.removeShuffle(i);
+                break;
+            }
         }
     }
+    // No more receive() calls can be in flight; free anything never polled.
+    Node* node = fTop.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        Node* next = node->fNext;
+        delete node;
+        node = next;
+    }
 }
 
 template <typename Message, typename IDType, bool AllowCopyableMessage>
 void SkMessageBus<Message, IDType, AllowCopyableMessage>::Inbox::receive(Message m) {
-    SkAutoMutexExclusive lock(fMessagesMutex);
-    fMessages.push_back(std::move(m));
+    Node* node = new Node{std::move(m), fTop.load(std::memory_order_relaxed)};
+    while (!fTop.compare_exchange_weak(node->fNext, node,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {}
 }
 
 template <typename Message, typename IDType, bool AllowCopyableMessage>
 void SkMessageBus<Message, IDType, AllowCopyableMessage>::Inbox::poll(SkTArray<Message>* messages) {
     SkASSERT(messages);
     messages->reset();
-    SkAutoMutexExclusive lock(fMessagesMutex);
-    fMessages.swap(*messages);
+    Node* node = fTop.exchange(nullptr, std::memory_order_acquire);
+    Node* ordered = nullptr;
+    while (node) {
+        Node* next = node->fNext;
+        node->fNext = ordered;
+        ordered = node;
+        node = next;
+    }
+    while (ordered) {
+        messages->push_back(std::move(ordered->fMessage));
+        Node* used = ordered;
+        ordered = ordered->fNext;
+        delete used;
+    }
 }
 
 //   ----------------------- Implementation of SkMessageBus -----------------------
@@ -128,7 +159,9 @@ SkMessageBus<Message, IDType, AllowCopyableMessage>::SkMessageBus() = default;
 template <typename Message, typename IDType, bool AllowCopyableMessage>
 /*static*/ void SkMessageBus<Message, IDType, AllowCopyableMessage>::Post(Message m) {
     auto* bus = SkMessageBus<Message, IDType, AllowCopyableMessage>::Get();
-    SkAutoMutexExclusive lock(bus->fInboxesMutex);
+    // Inboxes are lock-free, so concurrent posters only share this lock with
+    // inbox construction and destruction.
+    SkAutoSharedMutexShared lock(bus->fInboxesMutex);
     for (int i = 0; i < bus->fInboxes.count(); i++) {
         if (SkShouldPostMessageToBus(m, bus->fInboxes[i]->fUniqueID)) {
             if constexpr (AllowCopyableMessage) {
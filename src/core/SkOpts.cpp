@@ -43,11 +43,14 @@
 #include "src/opts/SkBlitMask_opts.h"
 #include "src/opts/SkBlitRow_opts.h"
 #include "src/opts/SkChecksum_opts.h"
+#include "src/opts/SkHalf_opts.h"
+#include "src/opts/SkMatrix_opts.h"
 #include "src/opts/SkRasterPipeline_opts.h"
 #include "src/opts/SkSwizzler_opts.h"
 #include "src/opts/SkUtils_opts.h"
 #include "src/opts/SkVM_opts.h"
 #include "src/opts/SkXfermode_opts.h"
+#include "src/opts/SkYUVtoRGBA_opts.h"
 
 namespace SkOpts {
     // Define default function pointer values here...
@@ -61,6 +64,8 @@ namespace SkOpts {
 
     DEFINE_DEFAULT(blit_row_color32);
     DEFINE_DEFAULT(blit_row_s32a_opaque);
+    DEFINE_DEFAULT(blit_row_f16_srcover);
+    DEFINE_DEFAULT(blit_row_1010102_srcover);
 
     DEFINE_DEFAULT(RGBA_to_BGRA);
     DEFINE_DEFAULT(RGBA_to_rgbA);
@@ -72,6 +77,14 @@ namespace SkOpts {
     DEFINE_DEFAULT(grayA_to_rgbA);
     DEFINE_DEFAULT(inverted_CMYK_to_RGB1);
     DEFINE_DEFAULT(inverted_CMYK_to_BGR1);
+    DEFINE_DEFAULT(RGBA_to_F16);
+    DEFINE_DEFAULT(F16_to_RGBA);
+    DEFINE_DEFAULT(RGBA_to_1010102);
+    DEFINE_DEFAULT(RGBA_1010102_to_RGBA);
+
+    DEFINE_DEFAULT(yuv_to_rgba_row);
+
+    DEFINE_DEFAULT(sample_u32);
 
     DEFINE_DEFAULT(memset16);
     DEFINE_DEFAULT(memset32);
@@ -83,6 +96,12 @@ namespace SkOpts {
 
     DEFINE_DEFAULT(cubic_solver);
 
+    DEFINE_DEFAULT(halfs_to_floats);
+    DEFINE_DEFAULT(floats_to_halfs);
+
+    DEFINE_DEFAULT(matrix_map_points_soa);
+    DEFINE_DEFAULT(matrix_map_points_bounds);
+
     DEFINE_DEFAULT(hash_fn);
 
     DEFINE_DEFAULT(S32_alpha_D32_filter_DX);
@@ -113,6 +132,7 @@ namespace SkOpts {
     void Init_skx();
     void Init_erms();
     void Init_crc32();
+    void Init_sve();
 
     static void init() {
     #if defined(SK_CPU_X86)
@@ -137,6 +157,7 @@ namespace SkOpts {
 
     #elif defined(SK_CPU_ARM64)
         if (SkCpu::Supports(SkCpu::CRC32)) { Init_crc32(); }
+        if (SkCpu::Supports(SkCpu::SVE2))  { Init_sve();   }
 
     #endif
     }
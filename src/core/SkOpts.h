@@ -14,6 +14,8 @@
 #include "src/core/SkXfermodePriv.h"
 
 struct SkBitmapProcState;
+struct SkPoint;
+struct SkYUVtoRGBACoeffs;
 namespace skvm { struct InterpreterInstruction; }
 
 namespace SkOpts {
@@ -30,6 +32,8 @@ namespace SkOpts {
     extern void (*blit_mask_d32_a8)(SkPMColor*, size_t, const SkAlpha*, size_t, SkColor, int, int);
     extern void (*blit_row_color32)(SkPMColor*, const SkPMColor*, int, SkPMColor);
     extern void (*blit_row_s32a_opaque)(SkPMColor*, const SkPMColor*, int, U8CPU);
+    extern void (*blit_row_f16_srcover)(uint64_t*, const uint64_t*, int);
+    extern void (*blit_row_1010102_srcover)(uint32_t*, const uint32_t*, int);
 
     // Swizzle input into some sort of 8888 pixel, {premul,unpremul} x {rgba,bgra}.
     typedef void (*Swizzle_8888_u32)(uint32_t*, const uint32_t*, int);
@@ -39,6 +43,22 @@ namespace SkOpts {
                             inverted_CMYK_to_RGB1, // i.e. convert color space
                             inverted_CMYK_to_BGR1; // i.e. convert color space
 
+    // Convert between swizzle-free 8888 and F16 / 1010102 pixels, for SkConvertPixels.
+    extern void (*RGBA_to_F16)(uint64_t*, const uint32_t*, int);  // i.e. widen unorm8 to half
+    extern void (*F16_to_RGBA)(uint32_t*, const uint64_t*, int);  // i.e. clamp and narrow
+    extern Swizzle_8888_u32 RGBA_to_1010102,      // i.e. repack 8-bit channels as 10/10/10/2
+                            RGBA_1010102_to_RGBA; // i.e. narrow 10/10/10/2 channels to 8888
+
+    // Fused 8-bit 4:2:0 YUV -> premul opaque RGBA_8888 row conversion for planar (I420,
+    // chromaStep 1) or interleaved (NV12, chromaStep 2) chroma; see SkYUVtoRGBACoeffs.
+    extern void (*yuv_to_rgba_row)(uint32_t* dst, const uint8_t* y, const uint8_t* u,
+                                   const uint8_t* v, int chromaStep, int width,
+                                   const SkYUVtoRGBACoeffs&);
+
+    // Strided 32-bit pixel copy (one pixel every deltaSrc bytes) for SkSwizzler's sampled
+    // subset/scaled decodes.
+    extern void (*sample_u32)(uint32_t* dst, const uint8_t* src, int deltaSrc, int count);
+
     typedef void (*Swizzle_8888_u8)(uint32_t*, const uint8_t*, int);
     extern Swizzle_8888_u8 RGB_to_RGB1,     // i.e. insert an opaque alpha
                            RGB_to_BGR1,     // i.e. swap RB and insert an opaque alpha
@@ -56,6 +76,18 @@ namespace SkOpts {
 
     extern float (*cubic_solver)(float, float, float, float);
 
+    // Bulk SkHalf <-> float conversion. Values are assumed finite; inputs that would be denormal
+    // half floats may flush to zero (matching the Sk4h helpers in SkHalf.h).
+    extern void (*halfs_to_floats)(float dst[], const uint16_t src[], int count);
+    extern void (*floats_to_halfs)(uint16_t dst[], const float src[], int count);
+
+    // Bulk SkMatrix point mapping (see SkMatrixPriv::MapPointsSoA and MapPointsAndBounds).
+    // 'mat' holds the six affine coefficients { scaleX, skewX, transX, skewY, scaleY, transY }.
+    extern void (*matrix_map_points_soa)(const float mat[6], float dstX[], float dstY[],
+                                         const float srcX[], const float srcY[], int count);
+    extern bool (*matrix_map_points_bounds)(const float mat[6], SkPoint dst[],
+                                            const SkPoint src[], int count, float boundsLTRB[4]);
+
     static inline uint32_t hash(const void* data, size_t bytes, uint32_t seed=0) {
         return hash_fn(data, bytes, seed);
     }
@@ -14,6 +14,7 @@
 #include "include/private/SkMacros.h"
 #include "include/private/SkPathRef.h"
 #include "include/private/SkTo.h"
+#include "include/private/SkVx.h"
 #include "src/core/SkBuffer.h"
 #include "src/core/SkCubicClipper.h"
 #include "src/core/SkGeometry.h"
@@ -2095,37 +2096,79 @@ struct Convexicator {
             return SkPathConvexity::kConvex;
         }
 
-        const SkPoint* last = points + count;
-        SkPoint currPt = *points++;
-        SkPoint firstPt = currPt;
         int dxes = 0;
         int dyes = 0;
         int lastSx = kValueNeverReturnedBySign;
         int lastSy = kValueNeverReturnedBySign;
-        for (int outerLoop = 0; outerLoop < 2; ++outerLoop ) {
-            while (points != last) {
-                SkVector vec = *points - currPt;
-                if (!vec.isZero()) {
-                    // give up if vector construction failed
-                    if (!vec.isFinite()) {
-                        return SkPathConvexity::kUnknown;
-                    }
-                    int sx = sign(vec.fX);
-                    int sy = sign(vec.fY);
-                    dxes += (sx != lastSx);
-                    dyes += (sy != lastSy);
-                    if (dxes > 3 || dyes > 3) {
-                        return SkPathConvexity::kConcave;
+
+        bool unknown = false;
+        auto accumulate = [&](SkVector vec) {   // returns false once the answer is decided
+            if (vec.isZero()) {
+                return true;
+            }
+            // give up if vector construction failed
+            if (!vec.isFinite()) {
+                unknown = true;
+                return false;
+            }
+            int sx = sign(vec.fX);
+            int sy = sign(vec.fY);
+            dxes += (sx != lastSx);
+            dyes += (sy != lastSy);
+            if (dxes > 3 || dyes > 3) {
+                return false;
+            }
+            lastSx = sx;
+            lastSy = sy;
+            return true;
+        };
+
+        int i = 0;
+        // Process 8 edge vectors per pass: compare each component's sign against its
+        // predecessor's and accumulate the transition counts branchlessly. Blocks containing
+        // degenerate (zero) or non-finite vectors take the scalar path, so the skip and
+        // give-up semantics match the one-at-a-time loop exactly.
+        while (i + 8 < count) {
+            auto a = skvx::Vec<16, float>::Load(&points[i]);
+            auto b = skvx::Vec<16, float>::Load(&points[i + 1]);
+            auto d = b - a;
+            auto dx = skvx::shuffle<0,2,4,6,8,10,12,14>(d);
+            auto dy = skvx::shuffle<1,3,5,7,9,11,13,15>(d);
+            auto zero   = (dx == 0) & (dy == 0);
+            auto finite = ((dx * 0) == 0) & ((dy * 0) == 0);  // x*0 != 0 for inf/NaN
+            if (any(zero) || !all(finite)) {
+                for (int j = i; j < i + 8; ++j) {
+                    if (!accumulate(points[j + 1] - points[j])) {
+                        return unknown ? SkPathConvexity::kUnknown : SkPathConvexity::kConcave;
                     }
-                    lastSx = sx;
-                    lastSy = sy;
                 }
-                currPt = *points++;
-                if (outerLoop) {
-                    break;
+            } else {
+                auto sx = (dx < 0) & 1;
+                auto sy = (dy < 0) & 1;
+                auto chx = sx ^ skvx::shuffle<0,0,1,2,3,4,5,6>(sx);  // lane 0 is always 0
+                auto chy = sy ^ skvx::shuffle<0,0,1,2,3,4,5,6>(sy);
+                dxes += (sx[0] != lastSx);
+                dyes += (sy[0] != lastSy);
+                for (int lane = 1; lane < 8; ++lane) {
+                    dxes += chx[lane];
+                    dyes += chy[lane];
+                }
+                if (dxes > 3 || dyes > 3) {
+                    return SkPathConvexity::kConcave;
                 }
+                lastSx = sx[7];
+                lastSy = sy[7];
             }
-            points = &firstPt;
+            i += 8;
+        }
+        for (; i < count - 1; ++i) {
+            if (!accumulate(points[i + 1] - points[i])) {
+                return unknown ? SkPathConvexity::kUnknown : SkPathConvexity::kConcave;
+            }
+        }
+        // ... and the implicit closing vector back to the start.
+        if (!accumulate(points[0] - points[count - 1])) {
+            return unknown ? SkPathConvexity::kUnknown : SkPathConvexity::kConcave;
         }
         return SkPathConvexity::kConvex;  // that is, it may be convex, don't know yet
     }
@@ -52,6 +52,7 @@ SkPathBuilder& SkPathBuilder::reset() {
 SkPathBuilder& SkPathBuilder::operator=(const SkPath& src) {
     this->reset().setFillType(src.getFillType());
 
+    this->incReserve(src.countPoints(), src.countVerbs());
     for (auto [verb, pts, w] : SkPathPriv::Iterate(src)) {
         switch (verb) {
             case SkPathVerb::kMove:  this->moveTo(pts[0]); break;
@@ -747,6 +748,9 @@ SkPathBuilder& SkPathBuilder::addPolygon(const SkPoint pts[], int count, bool is
         return *this;
     }
 
+    // move + (count - 1) lines, and possibly a close
+    this->incReserve(count, count + isClosed);
+
     this->moveTo(pts[0]);
     this->polylineTo(&pts[1], count - 1);
     if (isClosed) {
@@ -777,6 +781,8 @@ SkPathBuilder& SkPathBuilder::offset(SkScalar dx, SkScalar dy) {
 }
 
 SkPathBuilder& SkPathBuilder::addPath(const SkPath& src) {
+    this->incReserve(src.countPoints(), src.countVerbs());
+
     SkPath::RawIter iter(src);
     SkPoint pts[4];
     SkPath::Verb verb;
@@ -797,6 +803,7 @@ SkPathBuilder& SkPathBuilder::addPath(const SkPath& src) {
 }
 
 SkPathBuilder& SkPathBuilder::privateReverseAddPath(const SkPath& src) {
+    this->incReserve(src.countPoints(), src.countVerbs());
 
     const uint8_t* verbsBegin = src.fPathRef->verbsBegin();
     const uint8_t* verbs = src.fPathRef->verbsEnd();
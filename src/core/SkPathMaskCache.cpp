@@ -0,0 +1,102 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkPathMaskCache.h"
+
+#define CHECK_LOCAL(localCache, localName, globalName, ...) \
+    ((localCache) ? localCache->localName(__VA_ARGS__) : SkResourceCache::globalName(__VA_ARGS__))
+
+struct MaskValue {
+    SkMask          fMask;
+    SkCachedData*   fData;
+};
+
+namespace {
+static unsigned gPathMaskKeyNamespaceLabel;
+
+struct PathMaskKey : public SkResourceCache::Key {
+public:
+    PathMaskKey(uint32_t pathGenID, SkPathFillType fillType, const SkMatrix& canonicalMatrix)
+        : fGenID(pathGenID)
+        , fFillType(SkToS32((int)fillType))
+    {
+        // The translation has already been reduced to its subpixel phase, so these six values
+        // describe every matrix that rasterizes the path to the same coverage.
+        fMatrix[0] = canonicalMatrix.getScaleX();
+        fMatrix[1] = canonicalMatrix.getSkewX();
+        fMatrix[2] = canonicalMatrix.getTranslateX();
+        fMatrix[3] = canonicalMatrix.getSkewY();
+        fMatrix[4] = canonicalMatrix.getScaleY();
+        fMatrix[5] = canonicalMatrix.getTranslateY();
+
+        this->init(&gPathMaskKeyNamespaceLabel, 0,
+                   sizeof(fGenID) + sizeof(fFillType) + sizeof(fMatrix));
+    }
+
+    uint32_t    fGenID;
+    int32_t     fFillType;
+    SkScalar    fMatrix[6];
+};
+
+struct PathMaskRec : public SkResourceCache::Rec {
+    PathMaskRec(PathMaskKey key, const SkMask& mask, SkCachedData* data)
+        : fKey(key)
+    {
+        fValue.fMask = mask;
+        fValue.fData = data;
+        fValue.fData->attachToCacheAndRef();
+    }
+    ~PathMaskRec() override {
+        fValue.fData->detachFromCacheAndUnref();
+    }
+
+    PathMaskKey    fKey;
+    MaskValue      fValue;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override { return sizeof(*this) + fValue.fData->size(); }
+    const char* getCategory() const override { return "path-mask"; }
+    SkDiscardableMemory* diagnostic_only_getDiscardable() const override {
+        return fValue.fData->diagnostic_only_getDiscardable();
+    }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextData) {
+        const PathMaskRec& rec = static_cast<const PathMaskRec&>(baseRec);
+        MaskValue* result = static_cast<MaskValue*>(contextData);
+
+        SkCachedData* tmpData = rec.fValue.fData;
+        tmpData->ref();
+        if (nullptr == tmpData->data()) {
+            tmpData->unref();
+            return false;
+        }
+        *result = rec.fValue;
+        return true;
+    }
+};
+} // namespace
+
+SkCachedData* SkPathMaskCache::FindAndRef(uint32_t pathGenID, SkPathFillType fillType,
+                                          const SkMatrix& canonicalMatrix, SkMask* mask,
+                                          SkResourceCache* localCache) {
+    MaskValue result;
+    PathMaskKey key(pathGenID, fillType, canonicalMatrix);
+    if (!CHECK_LOCAL(localCache, find, Find, key, PathMaskRec::Visitor, &result)) {
+        return nullptr;
+    }
+
+    *mask = result.fMask;
+    mask->fImage = (uint8_t*)(result.fData->data());
+    return result.fData;
+}
+
+void SkPathMaskCache::Add(uint32_t pathGenID, SkPathFillType fillType,
+                          const SkMatrix& canonicalMatrix, const SkMask& mask, SkCachedData* data,
+                          SkResourceCache* localCache) {
+    PathMaskKey key(pathGenID, fillType, canonicalMatrix);
+    return CHECK_LOCAL(localCache, add, Add, new PathMaskRec(key, mask, data));
+}
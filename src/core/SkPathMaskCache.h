@@ -0,0 +1,43 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkPathMaskCache_DEFINED
+#define SkPathMaskCache_DEFINED
+
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPathTypes.h"
+#include "src/core/SkCachedData.h"
+#include "src/core/SkMask.h"
+#include "src/core/SkResourceCache.h"
+
+/**
+ *  Caches the anti-aliased coverage mask of a filled path, keyed by the path's generation id,
+ *  its fill type, and the device matrix with the translation reduced to its subpixel phase.
+ *  Repeated fills of an unchanged path under matrices that differ only by whole-pixel
+ *  translation reuse one mask instead of rescanning the path.
+ */
+class SkPathMaskCache {
+public:
+    /**
+     * On success, return a ref to the SkCachedData that holds the pixels, and have mask
+     * already point to that memory.
+     *
+     * On failure, return nullptr.
+     */
+    static SkCachedData* FindAndRef(uint32_t pathGenID, SkPathFillType fillType,
+                                    const SkMatrix& canonicalMatrix, SkMask* mask,
+                                    SkResourceCache* localCache = nullptr);
+
+    /**
+     * Add a mask and its pixel-data to the cache.
+     */
+    static void Add(uint32_t pathGenID, SkPathFillType fillType,
+                    const SkMatrix& canonicalMatrix, const SkMask& mask, SkCachedData* data,
+                    SkResourceCache* localCache = nullptr);
+};
+
+#endif
@@ -20,11 +20,20 @@
 enum SerializationOffsets {
     kType_SerializationShift = 28,       // requires 4 bits
     kDirection_SerializationShift = 26,  // requires 2 bits
+    kConvexity_SerializationShift = 24,  // requires 2 bits
     kFillType_SerializationShift = 8,    // requires 8 bits
     // low-8-bits are version
     kVersion_SerializationMask = 0xFF,
 };
 
+// Convexity is stored biased by 1 so that 0 (what pre-hint writers put in these bits)
+// means "not recorded".
+enum SerializationConvexity {
+    kUnrecorded_SerializationConvexity = 0,
+    kConvex_SerializationConvexity = 1,
+    kConcave_SerializationConvexity = 2,
+};
+
 enum SerializationVersions {
     // kPathPrivFirstDirection_Version = 1,
     // kPathPrivLastMoveToIndex_Version = 2,
@@ -53,6 +62,22 @@ static SerializationType extract_serializationtype(uint32_t packed) {
     return static_cast<SerializationType>((packed >> kType_SerializationShift) & 0xF);
 }
 
+static uint32_t pack_convexity(SkPathConvexity convexity) {
+    switch (convexity) {
+        case SkPathConvexity::kConvex:  return kConvex_SerializationConvexity;
+        case SkPathConvexity::kConcave: return kConcave_SerializationConvexity;
+        default:                        return kUnrecorded_SerializationConvexity;
+    }
+}
+
+static SkPathConvexity extract_convexity(uint32_t packed) {
+    switch ((packed >> kConvexity_SerializationShift) & 0x3) {
+        case kConvex_SerializationConvexity:  return SkPathConvexity::kConvex;
+        case kConcave_SerializationConvexity: return SkPathConvexity::kConcave;
+        default:                              return SkPathConvexity::kUnknown;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 size_t SkPath::writeToMemoryAsRRect(void* storage) const {
@@ -96,7 +121,12 @@ size_t SkPath::writeToMemory(void* storage) const {
         return bytes;
     }
 
+    // Record the convexity when it has already been computed, so replay can skip the
+    // analysis. The bits were always written as zero before the hint existed, which reads
+    // back as "not recorded".
     int32_t packed = (fFillType << kFillType_SerializationShift) |
+                     (pack_convexity(this->getConvexityOrUnknown())
+                             << kConvexity_SerializationShift) |
                      (SerializationType::kGeneral << kType_SerializationShift) |
                      kCurrent_Version;
 
@@ -288,6 +318,15 @@ size_t SkPath::readFromMemory_EQ4Or5(const void* storage, size_t length) {
         return 0;   // leftover points and/or conics
     }
 
+    // Adopt the writer's convexity, if it was recorded. The rebuilt path is geometrically
+    // identical to the one serialized, so this is equivalent to recomputing it. Mislabeled
+    // data (which could only come from a hostile stream) affects rendering quality, not
+    // safety, just as mislabeled convexity on a mutated path would.
+    SkPathConvexity convexity = extract_convexity(packed);
+    if (convexity != SkPathConvexity::kUnknown) {
+        tmp.setConvexity(convexity);
+    }
+
     *this = std::move(tmp);
     return buffer.pos();
 }
@@ -289,7 +289,17 @@ bool SkPictureData::parseStreamTag(SkStream* stream,
     switch (tag) {
         case SK_PICT_READER_TAG:
             SkASSERT(nullptr == fOpData);
-            fOpData = SkData::MakeFromStream(stream, size);
+            // When the stream is backed by durable refcounted memory (e.g. an mmapped
+            // SkData), alias the op bytes rather than copying them out.
+            if (sk_sp<SkData> unread = stream->peekData()) {
+                if (unread->size() < size) {
+                    return false;
+                }
+                fOpData = SkData::MakeSubset(unread.get(), 0, size);
+                stream->skip(size);
+            } else {
+                fOpData = SkData::MakeFromStream(stream, size);
+            }
             if (!fOpData) {
                 return false;
             }
@@ -34,6 +34,7 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
             Node* n = this->allocateNodeAtLevel(0);
             n->fNumChildren = 1;
             n->fChildren[0] = branches[0];
+            n->fMinOpIndex = n->fMaxOpIndex = branches[0].fOpIndex;
             fRoot.fSubtree = n;
             fRoot.fBounds  = branches[0].fBounds;
         } else {
@@ -138,6 +139,15 @@ SkRTree::Branch SkRTree::bulkLoad(std::vector<Branch>* branches, int level) {
             ++n->fNumChildren;
             ++currentBranch;
         }
+        // Branches are consumed in insertion order, so the node's op range is just the span from
+        // its first child to its last.
+        if (0 == level) {
+            n->fMinOpIndex = n->fChildren[0].fOpIndex;
+            n->fMaxOpIndex = n->fChildren[n->fNumChildren - 1].fOpIndex;
+        } else {
+            n->fMinOpIndex = n->fChildren[0].fSubtree->fMinOpIndex;
+            n->fMaxOpIndex = n->fChildren[n->fNumChildren - 1].fSubtree->fMaxOpIndex;
+        }
         (*branches)[newBranches] = b;
         ++newBranches;
     }
@@ -163,6 +173,44 @@ void SkRTree::search(Node* node, const SkRect& query, std::vector<int>* results)
     }
 }
 
+static void append_range(std::vector<SkBBoxHierarchy::OpRange>* results, int begin, int end) {
+    // Ranges are emitted in ascending order, so only the last one can be extended.
+    if (!results->empty() && results->back().fEnd >= begin) {
+        results->back().fEnd = std::max(results->back().fEnd, end);
+    } else {
+        results->push_back({begin, end});
+    }
+}
+
+void SkRTree::searchRanges(const SkRect& query, std::vector<OpRange>* results) const {
+    if (fCount > 0 && SkRect::Intersects(fRoot.fBounds, query)) {
+        if (query.contains(fRoot.fBounds)) {
+            append_range(results, fRoot.fSubtree->fMinOpIndex, fRoot.fSubtree->fMaxOpIndex + 1);
+        } else {
+            this->searchRanges(fRoot.fSubtree, query, results);
+        }
+    }
+}
+
+void SkRTree::searchRanges(Node* node, const SkRect& query, std::vector<OpRange>* results) const {
+    for (int i = 0; i < node->fNumChildren; ++i) {
+        const Branch& child = node->fChildren[i];
+        if (!SkRect::Intersects(child.fBounds, query)) {
+            continue;
+        }
+        if (0 == node->fLevel) {
+            append_range(results, child.fOpIndex, child.fOpIndex + 1);
+        } else if (query.contains(child.fBounds)) {
+            // Every op in this subtree is visible, so report its whole contiguous range without
+            // descending. The range may include ops that were skipped at insert() for having
+            // empty bounds; callers of searchRanges() accept a superset.
+            append_range(results, child.fSubtree->fMinOpIndex, child.fSubtree->fMaxOpIndex + 1);
+        } else {
+            this->searchRanges(child.fSubtree, query, results);
+        }
+    }
+}
+
 size_t SkRTree::bytesUsed() const {
     size_t byteCount = sizeof(SkRTree);
 
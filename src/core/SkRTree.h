@@ -33,6 +33,7 @@ public:
 
     void insert(const SkRect[], int N) override;
     void search(const SkRect& query, std::vector<int>* results) const override;
+    void searchRanges(const SkRect& query, std::vector<OpRange>* results) const override;
     size_t bytesUsed() const override;
 
     // Methods and constants below here are only public for tests.
@@ -60,10 +61,15 @@ private:
     struct Node {
         uint16_t fNumChildren;
         uint16_t fLevel;
+        // Inclusive range of op indices contained in this subtree. Because bulkLoad() consumes
+        // branches in insertion order, every subtree covers a contiguous, ascending run of ops.
+        int fMinOpIndex;
+        int fMaxOpIndex;
         Branch fChildren[kMaxChildren];
     };
 
     void search(Node* root, const SkRect& query, std::vector<int>* results) const;
+    void searchRanges(Node* root, const SkRect& query, std::vector<OpRange>* results) const;
 
     // Consumes the input array.
     Branch bulkLoad(std::vector<Branch>* branches, int level = 0);
@@ -9,9 +9,11 @@
 #define SkRasterClipStack_DEFINED
 
 #include "include/core/SkClipOp.h"
+#include "include/core/SkPath.h"
 #include "include/private/SkDeque.h"
 #include "src/core/SkRasterClip.h"
 #include <new>
+#include <utility>
 
 template <typename T> class SkTStack {
 public:
@@ -70,6 +72,7 @@ public:
         Rec& rec = fStack.push();
         rec.fRC.setRect(fRootBounds);
         rec.fDeferredCount = 0;
+        rec.fGenID = kRootGenID;
         SkASSERT(fStack.count() == 1);
     }
 
@@ -80,6 +83,11 @@ public:
         Rec& rec = fStack.top();
         SkASSERT(rec.fDeferredCount == 0);
         rec.fRC.setRect(fRootBounds);
+        rec.fGenID = kRootGenID;
+        // The memoized clips were materialized against the old root bounds.
+        for (ClipMemo& memo : fMemo) {
+            memo = ClipMemo();
+        }
     }
 
     const SkRasterClip& rc() const { return fStack.top().fRC; }
@@ -102,29 +110,48 @@ public:
     void clipRect(const SkMatrix& ctm, const SkRect& rect, SkClipOp op, bool aa) {
         this->writable_rc().op(rect, ctm, fRootBounds, (SkRegion::Op)op, aa);
         this->trimIfExpanding(op);
+        this->bumpGenID();
         this->validate();
     }
 
     void clipRRect(const SkMatrix& ctm, const SkRRect& rrect, SkClipOp op, bool aa) {
         this->writable_rc().op(rrect, ctm, fRootBounds, (SkRegion::Op)op, aa);
         this->trimIfExpanding(op);
+        this->bumpGenID();
         this->validate();
     }
 
     void clipPath(const SkMatrix& ctm, const SkPath& path, SkClipOp op, bool aa) {
+        const uint32_t parentGenID = fStack.top().fGenID;
+        for (int i = 0; i < kMemoCount; ++i) {
+            ClipMemo& memo = fMemo[i];
+            if (memo.fParentGenID == parentGenID
+                    && memo.fPathGenID == path.getGenerationID()
+                    && memo.fOp == op && memo.fAA == aa && memo.fCTM == ctm) {
+                this->writable_rc() = memo.fResult;
+                fStack.top().fGenID = memo.fResultGenID;
+                this->moveMemoToFront(i);
+                this->validate();
+                return;
+            }
+        }
         this->writable_rc().op(path, ctm, fRootBounds, (SkRegion::Op)op, aa);
         this->trimIfExpanding(op);
+        this->bumpGenID();
+        this->insertMemo(parentGenID, path.getGenerationID(), ctm, op, aa);
         this->validate();
     }
 
     void clipShader(sk_sp<SkShader> sh) {
         this->writable_rc().op(std::move(sh));
+        this->bumpGenID();
         this->validate();
     }
 
     void clipRegion(const SkRegion& rgn, SkClipOp op) {
         this->writable_rc().op(rgn, (SkRegion::Op)op);
         this->trimIfExpanding(op);
+        this->bumpGenID();
         this->validate();
     }
 
@@ -135,10 +162,12 @@ public:
         } else {
             this->writable_rc().setRect(devRect);
         }
+        this->bumpGenID();
     }
 
     void setDeviceClipRestriction(SkIRect* mutableClipRestriction) {
         this->writable_rc().setDeviceClipRestriction(mutableClipRestriction);
+        this->bumpGenID();
     }
 
     void validate() const {
@@ -156,15 +185,37 @@ private:
     struct Rec {
         SkRasterClip    fRC;
         int             fDeferredCount; // 0 for a "normal" entry
+        uint32_t        fGenID;         // identifies fRC's state for the clip memo
+    };
+
+    // A recently materialized path clip, keyed by the incoming clip state and the op
+    // arguments. Replays that alternate among a few clip states (restore, then re-apply an
+    // identical AA path clip) copy the materialized clip instead of re-rasterizing it.
+    // Since a hit re-assigns the memoized result's gen ID, repeating a whole clip sequence
+    // converges on the same IDs and chained clips also hit.
+    struct ClipMemo {
+        uint32_t        fParentGenID = kInvalidGenID;
+        uint32_t        fPathGenID;
+        SkMatrix        fCTM;
+        SkClipOp        fOp;
+        bool            fAA;
+        uint32_t        fResultGenID;
+        SkRasterClip    fResult;
     };
 
     enum {
         ELEM_COUNT = 16,
         PTR_COUNT = ELEM_COUNT * sizeof(Rec) / sizeof(void*)
     };
+    static constexpr uint32_t kInvalidGenID = 0;
+    static constexpr uint32_t kRootGenID = 1;
+    static constexpr int kMemoCount = 8;
+
     void*           fStorage[PTR_COUNT];
     SkTStack<Rec>   fStack;
     SkIRect         fRootBounds;
+    ClipMemo        fMemo[kMemoCount];  // LRU, most recent first
+    uint32_t        fNextGenID = kRootGenID + 1;
 
     SkRasterClip& writable_rc() {
         SkASSERT(fStack.top().fDeferredCount >= 0);
@@ -176,6 +227,30 @@ private:
         return fStack.top().fRC;
     }
 
+    void bumpGenID() {
+        fStack.top().fGenID = fNextGenID++;
+    }
+
+    void moveMemoToFront(int i) {
+        for (; i > 0; --i) {
+            std::swap(fMemo[i], fMemo[i - 1]);
+        }
+    }
+
+    void insertMemo(uint32_t parentGenID, uint32_t pathGenID, const SkMatrix& ctm,
+                    SkClipOp op, bool aa) {
+        for (int i = kMemoCount - 1; i > 0; --i) {
+            fMemo[i] = fMemo[i - 1];
+        }
+        fMemo[0].fParentGenID = parentGenID;
+        fMemo[0].fPathGenID = pathGenID;
+        fMemo[0].fCTM = ctm;
+        fMemo[0].fOp = op;
+        fMemo[0].fAA = aa;
+        fMemo[0].fResultGenID = fStack.top().fGenID;
+        fMemo[0].fResult = this->rc();
+    }
+
     void trimIfExpanding(SkClipOp op) {
         if ((int)op > (int)SkClipOp::kIntersect) {
             Rec& rec = fStack.top();
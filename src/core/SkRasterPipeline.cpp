@@ -12,6 +12,16 @@
 #include "src/core/SkOpts.h"
 #include "src/core/SkRasterPipeline.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#if defined(SK_CPU_X86)
+    #if defined(SK_BUILD_FOR_WIN)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
 
 SkRasterPipeline::SkRasterPipeline(SkArenaAlloc* alloc) : fAlloc(alloc) {
     this->reset();
@@ -33,6 +43,7 @@ void SkRasterPipeline::append(StockStage stage, void* ctx) {
     SkASSERT(stage !=                   PQish);  // Please use append_transfer_function().
     SkASSERT(stage !=                  HLGish);  // Please use append_transfer_function().
     SkASSERT(stage !=               HLGinvish);  // Please use append_transfer_function().
+    SkASSERT(stage !=            stamp_cycles);  // Only interleaved by build_stamped_pipeline().
     this->unchecked_append(stage, ctx);
 }
 void SkRasterPipeline::unchecked_append(StockStage stage, void* ctx) {
@@ -334,6 +345,89 @@ void SkRasterPipeline::append_gamut_clamp_if_normalized(const SkImageInfo& info)
     }
 }
 
+// ~~~ Sampled stage tracing ~~~
+
+#define M(st) +1
+static constexpr int kNumRasterPipelineStages = SK_RASTER_PIPELINE_STAGES(M);
+#undef M
+
+static std::atomic<uint64_t> gStageTraceTicks  [kNumRasterPipelineStages];
+static std::atomic<uint64_t> gStageTraceSamples[kNumRasterPipelineStages];
+static std::atomic<int>      gStageTraceRate{0};
+static std::atomic<uint32_t> gStageTraceCounter{0};
+static std::atomic<bool>     gStageTraceBusy{false};
+
+static uint64_t now_ticks() {
+#if defined(SK_CPU_X86)
+    return __rdtsc();
+#elif defined(SK_CPU_ARM64) && defined(__GNUC__)
+    uint64_t t;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#else
+    return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+void SkRasterPipelineStamp(SkRasterPipeline_StampCtx* ctx) {
+    uint64_t now = now_ticks();
+    if (ctx->stage >= 0) {
+        gStageTraceTicks  [ctx->stage].fetch_add(now - *ctx->last, std::memory_order_relaxed);
+        gStageTraceSamples[ctx->stage].fetch_add(1,                std::memory_order_relaxed);
+    }
+    *ctx->last = now;
+}
+
+// True when this execution should run stamped. Claims a process-wide busy flag so
+// only one stamped execution is in flight at a time, keeping the shared *last
+// scratch race-free; contenders just run the plain program.
+static bool should_sample_stage_trace() {
+    int rate = gStageTraceRate.load(std::memory_order_relaxed);
+    if (rate <= 0 || gStageTraceCounter.fetch_add(1, std::memory_order_relaxed) % rate != 0) {
+        return false;
+    }
+    bool busy = false;
+    return gStageTraceBusy.compare_exchange_strong(busy, true, std::memory_order_acquire);
+}
+
+static void finish_stage_trace() {
+    gStageTraceBusy.store(false, std::memory_order_release);
+}
+
+void SkRasterPipeline::SetStageTraceRate(int rate) {
+    gStageTraceRate.store(rate, std::memory_order_relaxed);
+}
+
+void SkRasterPipeline::ResetStageTraceStats() {
+    for (int i = 0; i < kNumRasterPipelineStages; i++) {
+        gStageTraceTicks  [i].store(0, std::memory_order_relaxed);
+        gStageTraceSamples[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+int SkRasterPipeline::GetStageTraceStats(StageTraceStats stats[], int count) {
+    static const char* gNames[] = {
+    #define M(st) #st,
+        SK_RASTER_PIPELINE_STAGES(M)
+    #undef M
+    };
+
+    StageTraceStats all[kNumRasterPipelineStages];
+    int n = 0;
+    for (int i = 0; i < kNumRasterPipelineStages; i++) {
+        if (uint64_t samples = gStageTraceSamples[i].load(std::memory_order_relaxed)) {
+            all[n++] = { gNames[i], samples, gStageTraceTicks[i].load(std::memory_order_relaxed) };
+        }
+    }
+    std::sort(all, all + n, [](const StageTraceStats& a, const StageTraceStats& b) {
+        return a.ticks > b.ticks;
+    });
+
+    n = std::min(n, count);
+    std::copy(all, all + n, stats);
+    return n;
+}
+
 SkRasterPipeline::StartPipelineFn SkRasterPipeline::build_pipeline(void** ip) const {
     // We'll try to build a lowp pipeline, but if that fails fallback to a highp float pipeline.
     void** reset_point = ip;
@@ -365,11 +459,73 @@ SkRasterPipeline::StartPipelineFn SkRasterPipeline::build_pipeline(void** ip) co
     return SkOpts::start_pipeline_highp;
 }
 
+// Like build_pipeline(), but interleaves a stamp_cycles stage after every stage so
+// elapsed ticks can be charged to the stage that just ran. The leading stamp only
+// primes *last. ctxs[] must hold fNumStages+1 entries.
+SkRasterPipeline::StartPipelineFn
+SkRasterPipeline::build_stamped_pipeline(void** ip, SkRasterPipeline_StampCtx* ctxs,
+                                         uint64_t* last) const {
+    int used = 0;
+    auto stamp_ctx = [&](int stage) -> void* {
+        ctxs[used] = { last, stage };
+        return &ctxs[used++];
+    };
+
+    void** reset_point = ip;
+
+    *--ip = (void*)SkOpts::just_return_lowp;
+    bool lowp = SkOpts::stages_lowp[stamp_cycles] != nullptr;
+    for (const StageList* st = fStages; lowp && st; st = st->prev) {
+        if (auto fn = SkOpts::stages_lowp[st->stage]) {
+            *--ip = stamp_ctx(st->stage);
+            *--ip = (void*)SkOpts::stages_lowp[stamp_cycles];
+            if (st->ctx) {
+                *--ip = st->ctx;
+            }
+            *--ip = (void*)fn;
+        } else {
+            lowp = false;
+        }
+    }
+    if (lowp) {
+        *--ip = stamp_ctx(-1);
+        *--ip = (void*)SkOpts::stages_lowp[stamp_cycles];
+        return SkOpts::start_pipeline_lowp;
+    }
+    ip = reset_point;
+    used = 0;
+
+    *--ip = (void*)SkOpts::just_return_highp;
+    for (const StageList* st = fStages; st; st = st->prev) {
+        *--ip = stamp_ctx(st->stage);
+        *--ip = (void*)SkOpts::stages_highp[stamp_cycles];
+        if (st->ctx) {
+            *--ip = st->ctx;
+        }
+        *--ip = (void*)SkOpts::stages_highp[st->stage];
+    }
+    *--ip = stamp_ctx(-1);
+    *--ip = (void*)SkOpts::stages_highp[stamp_cycles];
+    return SkOpts::start_pipeline_highp;
+}
+
 void SkRasterPipeline::run(size_t x, size_t y, size_t w, size_t h) const {
     if (this->empty()) {
         return;
     }
 
+    if (should_sample_stage_trace()) {
+        SkAutoSTMalloc<96, void*> program(this->slots_with_stamps());
+        SkAutoSTMalloc<16, SkRasterPipeline_StampCtx> ctxs(fNumStages + 1);
+        uint64_t last = 0;
+
+        auto start_pipeline = this->build_stamped_pipeline(
+                program.get() + this->slots_with_stamps(), ctxs.get(), &last);
+        start_pipeline(x,y,x+w,y+h, program.get());
+        finish_stage_trace();
+        return;
+    }
+
     // Best to not use fAlloc here... we can't bound how often run() will be called.
     SkAutoSTMalloc<64, void*> program(fSlotsNeeded);
 
@@ -385,6 +541,26 @@ std::function<void(size_t, size_t, size_t, size_t)> SkRasterPipeline::compile()
     void** program = fAlloc->makeArray<void*>(fSlotsNeeded);
 
     auto start_pipeline = this->build_pipeline(program + fSlotsNeeded);
+
+    if (gStageTraceRate.load(std::memory_order_relaxed) > 0) {
+        // Tracing is on, so build a stamped twin of the program; the thunk samples
+        // between the two per call.
+        void** stamped = fAlloc->makeArray<void*>(this->slots_with_stamps());
+        auto*  ctxs    = fAlloc->makeArrayDefault<SkRasterPipeline_StampCtx>(fNumStages + 1);
+        auto*  last    = fAlloc->make<uint64_t>(0);
+
+        auto start_stamped = this->build_stamped_pipeline(
+                stamped + this->slots_with_stamps(), ctxs, last);
+        return [=](size_t x, size_t y, size_t w, size_t h) {
+            if (should_sample_stage_trace()) {
+                start_stamped(x,y,x+w,y+h, stamped);
+                finish_stage_trace();
+            } else {
+                start_pipeline(x,y,x+w,y+h, program);
+            }
+        };
+    }
+
     return [=](size_t x, size_t y, size_t w, size_t h) {
         start_pipeline(x,y,x+w,y+h, program);
     };
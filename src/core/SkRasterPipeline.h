@@ -73,11 +73,12 @@ class SkData;
     M(colorburn) M(colordodge) M(darken) M(difference)             \
     M(exclusion) M(hardlight) M(lighten) M(overlay) M(softlight)   \
     M(hue) M(saturation) M(color) M(luminosity)                    \
-    M(srcover_rgba_8888)                                           \
+    M(srcover_rgba_8888) M(srcover_rgba_f16)                       \
     M(matrix_translate) M(matrix_scale_translate)                  \
     M(matrix_2x3) M(matrix_3x3) M(matrix_3x4) M(matrix_4x5) M(matrix_4x3) \
     M(matrix_perspective)                                          \
-    M(parametric) M(gamma_) M(PQish) M(HLGish) M(HLGinvish)        \
+    M(parametric) M(gamma_) M(tf_lut) M(PQish) M(HLGish) M(HLGinvish) \
+    M(clut_3d)                                                     \
     M(mirror_x)   M(repeat_x)                                      \
     M(mirror_y)   M(repeat_y)                                      \
     M(decal_x)    M(decal_y)   M(decal_x_and_y)                    \
@@ -107,7 +108,8 @@ class SkData;
     M(rgb_to_hsl) M(hsl_to_rgb)                                    \
     M(gauss_a_to_rgba)                                             \
     M(emboss)                                                      \
-    M(swizzle)
+    M(swizzle)                                                     \
+    M(stamp_cycles)
 
 // The largest number of pixels we handle at a time.
 static const int SkRasterPipeline_kMaxStride = 16;
@@ -119,6 +121,12 @@ struct SkRasterPipeline_MemoryCtx {
     int   stride;
 };
 
+struct SkRasterPipeline_Clut3DCtx {
+    // size^3 RGB triples, red-major: the triple for (r,g,b) starts at ((r*size + g)*size + b)*3.
+    const float* table;
+    float        scale;  // size - 1; inputs in [0,1] scale to grid coordinates.
+};
+
 struct SkRasterPipeline_GatherCtx {
     const void* pixels;
     int         stride;
@@ -162,6 +170,17 @@ struct SkRasterPipeline_CallbackCtx {
     float* read_from = rgba;
 };
 
+struct SkRasterPipeline_StampCtx {
+    // Stamps interleaved through one program all share *last, the timestamp-counter
+    // value read by the previous stamp in the chain.
+    uint64_t* last;
+    int32_t   stage;  // SkRasterPipeline::StockStage charged for the elapsed ticks, or -1.
+};
+
+// Called by the stamp_cycles stage: reads the cycle counter and charges the ticks
+// elapsed since the previous stamp to ctx->stage in the stage trace registry.
+void SkRasterPipelineStamp(SkRasterPipeline_StampCtx* ctx);
+
 struct SkRasterPipeline_GradientCtx {
     size_t stopCount;
     float* fs[4];
@@ -253,6 +272,24 @@ public:
 
     bool empty() const { return fStages == nullptr; }
 
+    // ~~~ Opt-in sampled stage tracing ~~~
+    //
+    // When a rate N > 0 is set, roughly one in N pipeline executions runs with a
+    // cycle stamp between each stage, charging the elapsed timestamp-counter ticks
+    // to a process-wide per-stage registry. Each stage's ticks include the cost of
+    // one stamp, so treat small totals as noise. Cheap enough to leave enabled in
+    // production at low rates (e.g. 1000).
+    struct StageTraceStats {
+        const char* name;     // stage name, as printed by dump()
+        uint64_t    samples;  // instrumented executions of the stage
+        uint64_t    ticks;    // total timestamp-counter ticks charged to the stage
+    };
+    static void SetStageTraceRate(int rate);   // 0 (the default) disables tracing.
+    // Fills stats[] with the stages sampled so far, most ticks first, and returns
+    // the number of entries written (never more than count).
+    static int  GetStageTraceStats(StageTraceStats stats[], int count);
+    static void ResetStageTraceStats();
+
 private:
     struct StageList {
         StageList* prev;
@@ -262,6 +299,10 @@ private:
 
     using StartPipelineFn = void(*)(size_t,size_t,size_t,size_t, void** program);
     StartPipelineFn build_pipeline(void**) const;
+    StartPipelineFn build_stamped_pipeline(void**, SkRasterPipeline_StampCtx*, uint64_t* last) const;
+
+    // A stamped program carries one extra (fn,ctx) pair per stage, plus a leading stamp.
+    int slots_with_stamps() const { return fSlotsNeeded + 2*(fNumStages + 1); }
 
     void unchecked_append(StockStage, void*);
 
@@ -345,6 +345,16 @@ void SkRasterPipelineBlitter::blitRect(int x, int y, int w, int h) {
             }
             this->append_clip_scale(&p);
             p.append(SkRasterPipeline::srcover_rgba_8888, &fDstPtr);
+        } else if (fBlend == SkBlendMode::kSrcOver
+                && (fDst.info().colorType() == kRGBA_F16_SkColorType ||
+                    fDst.info().colorType() == kRGBA_F16Norm_SkColorType)
+                && fDst.info().alphaType() != kUnpremul_SkAlphaType
+                && fDitherRate == 0.0f) {
+            // Like the 8888 case above, but loading, blending, and storing in half floats.
+            // The color pipeline has already converted to the dst color space, so this is
+            // exactly the blend the general load_dst/srcover/store path would do.
+            this->append_clip_scale(&p);
+            p.append(SkRasterPipeline::srcover_rgba_f16, &fDstPtr);
         } else {
             if (fBlend != SkBlendMode::kSrc) {
                 this->append_load_dst(&p);
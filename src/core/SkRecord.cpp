@@ -27,6 +27,36 @@ size_t SkRecord::bytesUsed() const {
     return bytes;
 }
 
+bool SkRecord::appendRange(sk_sp<const SkRecord> src, int begin, int end) {
+    SkASSERT(src);
+    SkASSERT(0 <= begin && begin <= end && end <= src->count());
+
+    // Preflight: every command in the range must be shallow-copyable. Commands like
+    // SaveLayer hold Optional<> members that own their pointees, so they can't be
+    // shared; incremental recorders splice the ranges between such boundaries and
+    // re-record the rest.
+    for (int i = begin; i < end; i++) {
+        bool copyable = src->visit(i, [](const auto& op) {
+            return std::is_copy_constructible<std::decay_t<decltype(op)>>::value;
+        });
+        if (!copyable) {
+            return false;
+        }
+    }
+
+    for (int i = begin; i < end; i++) {
+        src->visit(i, [&](const auto& op) {
+            using Op = std::decay_t<decltype(op)>;
+            if constexpr (std::is_copy_constructible<Op>::value) {
+                new (this->append<Op>()) Op(op);
+            }
+        });
+    }
+    // The copies above are shallow: any arrays they reference still live in src's arena.
+    fRetained.push_back(std::move(src));
+    return true;
+}
+
 void SkRecord::defrag() {
     // Remove all the NoOps, preserving the order of other ops, e.g.
     //      Save, ClipRect, NoOp, DrawRect, NoOp, NoOp, Restore
@@ -93,6 +93,14 @@ public:
     // May change count() and the indices of ops, but preserves their order.
     void defrag();
 
+    // Append shallow copies of src's commands [begin, end) to this record. The copies
+    // share arena-backed arrays with src, so this record retains a ref on src. This lets
+    // an incremental recorder splice unchanged op ranges from a previous recording
+    // rather than re-recording them. Returns false (appending nothing) if the range
+    // contains commands that own their pointees (e.g. SaveLayer) and so can't be shared;
+    // splice the ranges between those boundaries instead.
+    bool appendRange(sk_sp<const SkRecord> src, int begin, int end);
+
 private:
     // An SkRecord is structured as an array of pointers into a big chunk of memory where
     // records representing each canvas draw call are stored:
@@ -176,6 +184,9 @@ private:
     // chunks, returning a stable handle to that data for later retrieval.
     SkArenaAlloc fAlloc{256};
     size_t       fApproxBytesAllocated{0};
+
+    // Records whose arena-backed arrays our spliced commands point into (see appendRange).
+    SkTArray<sk_sp<const SkRecord>> fRetained;
 };
 
 #endif//SkRecord_DEFINED
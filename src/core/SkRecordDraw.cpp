@@ -28,18 +28,23 @@ void SkRecordDraw(const SkRecord& record,
         // lets us query the BBH.
         SkRect query = canvas->getLocalClipBounds();
 
-        std::vector<int> ops;
-        bbh->search(query, &ops);
+        // Ranges keep the BBH from walking (and us from revisiting) every op in a fully-visible
+        // subtree one index at a time. A range may conservatively include ops the query would
+        // have culled; playing them is correct, just clipped out.
+        std::vector<SkBBoxHierarchy::OpRange> ranges;
+        bbh->searchRanges(query, &ranges);
 
         SkRecords::Draw draw(canvas, drawablePicts, drawables, drawableCount);
-        for (int i = 0; i < (int)ops.size(); i++) {
-            if (callback && callback->abort()) {
-                return;
+        for (const auto& range : ranges) {
+            for (int i = range.fBegin; i < range.fEnd; i++) {
+                if (callback && callback->abort()) {
+                    return;
+                }
+                // This visit call uses the SkRecords::Draw::operator() to call
+                // methods on the |canvas|, wrapped by methods defined with the
+                // DRAW() macro.
+                record.visit(i, draw);
             }
-            // This visit call uses the SkRecords::Draw::operator() to call
-            // methods on the |canvas|, wrapped by methods defined with the
-            // DRAW() macro.
-            record.visit(ops[i], draw);
         }
     } else {
         // Draw all ops.
@@ -7,6 +7,7 @@
 
 #include "src/core/SkRecordOpts.h"
 
+#include "include/private/SkTArray.h"
 #include "include/private/SkTDArray.h"
 #include "src/core/SkCanvasPriv.h"
 #include "src/core/SkRecordPattern.h"
@@ -280,6 +281,293 @@ void SkRecordMergeSvgOpacityAndFilterLayers(SkRecord* record) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+// True for a layer paint that composites its contents unchanged: src-over, opaque, no effects.
+static bool is_passthrough_layer_paint(const SkPaint* paint) {
+    if (nullptr == paint) {
+        return true;
+    }
+    return paint->isSrcOver()            &&
+           0xFF == paint->getAlpha()     &&
+           !paint->getPathEffect()       &&
+           !paint->getShader()           &&
+           !paint->getMaskFilter()       &&
+           !paint->getColorFilter()      &&
+           !paint->getImageFilter();
+}
+
+// Tests a single command: true if it is a NoOp or a draw that composites src-over, so a span of
+// such commands produces identical results drawn directly or drawn into a transparent layer that
+// is then composited src-over. DrawPicture/DrawDrawable are excluded because their interior
+// commands may blend against whatever is beneath them.
+struct IsSrcOverDrawOrNoOp {
+    bool operator()(DrawPicture*) { return false; }
+    bool operator()(DrawDrawable*) { return false; }
+
+    template <typename T>
+    std::enable_if_t<(T::kTags & kDrawWithPaint_Tag) == kDrawWithPaint_Tag, bool>
+    operator()(T* draw) {
+        const SkPaint* paint = AsPtr(draw->paint);
+        return !paint || paint->isSrcOver();
+    }
+
+    template <typename T>
+    std::enable_if_t<(T::kTags & kDrawWithPaint_Tag) == kDraw_Tag, bool> operator()(T*) {
+        return true;  // Draws without a paint field composite src-over.
+    }
+
+    template <typename T>
+    std::enable_if_t<!(T::kTags & kDraw_Tag), bool> operator()(T*) {
+        return std::is_same<T, NoOp>::value;
+    }
+
+    template <typename T> static T* AsPtr(SkRecords::Optional<T>& x) { return x; }
+    template <typename T> static T* AsPtr(T& x) { return &x; }
+};
+
+// Turns SaveLayer-[src-over draws]-Restore into direct draws when the layer paint composites its
+// contents unchanged (an opaque transparency group). Src-over is associative, so drawing the span
+// directly produces the same pixels without the offscreen allocation.
+struct PassthroughSaveLayerNooper {
+    typedef Pattern<Is<SaveLayer>, Greedy<Or<Is<NoOp>, IsDraw>>, Is<Restore>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        SaveLayer* layer = match->first<SaveLayer>();
+        if (layer->backdrop || layer->saveLayerFlags != 0 ||
+            !is_passthrough_layer_paint(layer->paint)) {
+            return false;
+        }
+        IsSrcOverDrawOrNoOp isSrcOverDraw;
+        for (int i = begin + 1; i < end - 1; i++) {
+            if (!record->mutate(i, isSrcOverDraw)) {
+                return false;
+            }
+        }
+        record->replace<NoOp>(begin);    // SaveLayer
+        record->replace<NoOp>(end - 1);  // Restore
+        return true;
+    }
+};
+
+void SkRecordNoopPassthroughSaveLayers(SkRecord* record) {
+    PassthroughSaveLayerNooper pass;
+    apply(&pass, record);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collapses directly nested SaveLayers into one. When an outer layer contains nothing but an
+// inner layer, compositing is (content * aInner) * aOuter == content * (aInner * aOuter), so the
+// outer layer's alpha can fold into the inner paint and its offscreen is never allocated. Bounds
+// hints are intersected so the surviving layer allocates the smaller backing store.
+struct NestedSaveLayerMergePass {
+    typedef Pattern<Is<SaveLayer>, Greedy<Is<NoOp>>, Is<SaveLayer>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        SaveLayer* outer = match->first<SaveLayer>();
+        SaveLayer* inner = match->third<SaveLayer>();
+
+        // An inner backdrop or init-with-previous flag samples what is beneath the inner layer,
+        // which would change from the outer layer's transparent contents to the real canvas.
+        if (outer->backdrop || outer->saveLayerFlags != 0 ||
+            inner->backdrop || inner->saveLayerFlags != 0) {
+            return false;
+        }
+
+        // Find the inner layer's Restore by balancing save depth.
+        Is<Save> isSave;
+        Is<SaveLayer> isSaveLayer;
+        Is<SaveBehind> isSaveBehind;
+        Is<Restore> isRestore;
+        Is<NoOp> isNoOp;
+        int depth = 1;
+        int innerRestore = -1;
+        for (int i = end; i < record->count(); i++) {
+            if (record->mutate(i, isSave) || record->mutate(i, isSaveLayer) ||
+                record->mutate(i, isSaveBehind)) {
+                depth++;
+            } else if (record->mutate(i, isRestore)) {
+                if (0 == --depth) {
+                    innerRestore = i;
+                    break;
+                }
+            }
+        }
+        if (innerRestore < 0) {
+            return false;
+        }
+
+        // The outer layer must contain nothing but the inner one: its own Restore has to follow
+        // immediately (modulo NoOps).
+        int outerRestore = innerRestore + 1;
+        while (outerRestore < record->count() && record->mutate(outerRestore, isNoOp)) {
+            outerRestore++;
+        }
+        if (outerRestore >= record->count() || !record->mutate(outerRestore, isRestore)) {
+            return false;
+        }
+
+        if (outer->paint) {
+            // Fold the outer layer's alpha into the inner layer's paint.
+            if (!inner->paint ||
+                !fold_opacity_layer_color_to_paint(outer->paint, true /*isSaveLayer*/,
+                                                   inner->paint)) {
+                return false;
+            }
+        }
+
+        // Both hints are in the same coordinate space since only NoOps separate the layers.
+        if (outer->bounds && inner->bounds) {
+            if (!inner->bounds->intersect(*outer->bounds)) {
+                *inner->bounds = SkRect::MakeEmpty();
+            }
+        }
+
+        record->replace<NoOp>(begin);         // outer SaveLayer
+        record->replace<NoOp>(outerRestore);  // outer Restore
+        return true;
+    }
+};
+
+void SkRecordMergeNestedSaveLayers(SkRecord* record) {
+    NestedSaveLayerMergePass pass;
+    // Each merge may expose another directly nested pair; run until fixed point.
+    while (apply(&pass, record)) {}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collapses runs of matrix concats into one. canvas->concat(A) followed by concat(B) produces
+// CTM * A * B, which is what a single concat(A*B) produces. The combined matrix is written into
+// the later command so newly exposed runs keep collapsing as apply() re-scans.
+struct ConcatCollapsePass {
+    typedef Pattern<Is<Concat>, Greedy<Is<NoOp>>, Is<Concat>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        Concat* a = match->first<Concat>();
+        Concat* b = match->third<Concat>();
+        b->matrix = TypedMatrix(SkMatrix::Concat(a->matrix, b->matrix));
+        record->replace<NoOp>(begin);
+        return true;
+    }
+};
+
+struct Concat44CollapsePass {
+    typedef Pattern<Is<Concat44>, Greedy<Is<NoOp>>, Is<Concat44>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        Concat44* a = match->first<Concat44>();
+        Concat44* b = match->third<Concat44>();
+        b->matrix = a->matrix * b->matrix;
+        record->replace<NoOp>(begin);
+        return true;
+    }
+};
+
+struct TranslateCollapsePass {
+    typedef Pattern<Is<Translate>, Greedy<Is<NoOp>>, Is<Translate>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        Translate* a = match->first<Translate>();
+        Translate* b = match->third<Translate>();
+        b->dx += a->dx;
+        b->dy += a->dy;
+        record->replace<NoOp>(begin);
+        return true;
+    }
+};
+
+void SkRecordCollapseMatrixConcats(SkRecord* record) {
+    ConcatCollapsePass concats;
+    Concat44CollapsePass concat44s;
+    TranslateCollapsePass translates;
+    // Each collapse may bring another pair together; run until fixed point.
+    while (apply(&concats, record) || apply(&concat44s, record) || apply(&translates, record)) {}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Merges back-to-back intersect clipRects into one. With only NoOps between them the two clips
+// share a CTM, so clip(A) + clip(B) == clip(A ∩ B). Mixed AA settings are left alone since the
+// merged edge coverage could differ.
+struct ClipRectIntersectPass {
+    typedef Pattern<Is<ClipRect>, Greedy<Is<NoOp>>, Is<ClipRect>> Match;
+
+    bool onMatch(SkRecord* record, Match* match, int begin, int end) {
+        ClipRect* a = match->first<ClipRect>();
+        ClipRect* b = match->third<ClipRect>();
+        if (a->opAA.op() != SkClipOp::kIntersect || b->opAA.op() != SkClipOp::kIntersect ||
+            a->opAA.aa() != b->opAA.aa()) {
+            return false;
+        }
+        if (!b->rect.intersect(a->rect)) {
+            b->rect = SkRect::MakeEmpty();
+        }
+        record->replace<NoOp>(begin);
+        return true;
+    }
+};
+
+void SkRecordMergeClipIntersections(SkRecord* record) {
+    ClipRectIntersectPass pass;
+    while (apply(&pass, record)) {}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Fuses runs of paintless drawImage commands with identical sampling into one DrawEdgeAAImageSet,
+// which the GPU backend batches through its bulk texture-op path. Each fused draw becomes an
+// entry rendering the whole image at its original position with no edge AA, exactly matching a
+// paintless drawImage.
+struct DrawImageRunFusionPass {
+    typedef Pattern<Is<DrawImage>, Is<DrawImage>, Greedy<Is<DrawImage>>> Match;
+
+    bool onMatch(SkRecord* record, Match*, int begin, int end) {
+        SkSTArray<16, DrawImage*> draws;
+        for (int i = begin; i < end; i++) {
+            Is<DrawImage> isDrawImage;
+            SkAssertResult(record->mutate(i, isDrawImage));
+            draws.push_back(isDrawImage.get());
+        }
+        if (draws[0]->paint) {
+            return false;
+        }
+        // Take the longest leading run that stays paintless with uniform sampling.
+        int n = 1;
+        while (n < draws.count() && !draws[n]->paint && draws[n]->sampling == draws[0]->sampling) {
+            n++;
+        }
+        if (n < 2) {
+            return false;
+        }
+
+        SkSamplingOptions sampling = draws[0]->sampling;
+        SkAutoTArray<SkCanvas::ImageSetEntry> set(n);
+        for (int i = 0; i < n; i++) {
+            DrawImage* draw = draws[i];
+            set[i].fImage = draw->image;
+            set[i].fSrcRect = SkRect::Make(draw->image->bounds());
+            set[i].fDstRect = SkRect::MakeXYWH(draw->left, draw->top,
+                                               draw->image->width(), draw->image->height());
+            set[i].fAAFlags = SkCanvas::kNone_QuadAAFlags;
+        }
+        for (int i = begin + 1; i < begin + n; i++) {
+            record->replace<NoOp>(i);
+        }
+        new (record->replace<DrawEdgeAAImageSet>(begin))
+                DrawEdgeAAImageSet{Optional<SkPaint>(), std::move(set), n,
+                                   PODArray<SkPoint>(nullptr), PODArray<SkMatrix>(nullptr),
+                                   sampling, SkCanvas::kFast_SrcRectConstraint};
+        return true;
+    }
+};
+
+void SkRecordFuseDrawImageRuns(SkRecord* record) {
+    DrawImageRunFusionPass pass;
+    apply(&pass, record);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 void SkRecordOptimize(SkRecord* record) {
     // This might be useful  as a first pass in the future if we want to weed
     // out junk for other optimization passes.  Right now, nothing needs it,
@@ -295,9 +583,17 @@ void SkRecordOptimize(SkRecord* record) {
     // android.uirendering.cts.testclasses.LayerTests#testSaveLayerClippedWithAlpha
 #ifndef SK_BUILD_FOR_ANDROID_FRAMEWORK
     SkRecordNoopSaveLayerDrawRestores(record);
+    // Like the pass above, these treat the SaveLayer bounds field as an ignorable hint, which
+    // the Android framework relies on for clipping.
+    SkRecordMergeNestedSaveLayers(record);
+    SkRecordNoopPassthroughSaveLayers(record);
 #endif
     SkRecordMergeSvgOpacityAndFilterLayers(record);
 
+    SkRecordCollapseMatrixConcats(record);
+    SkRecordMergeClipIntersections(record);
+    SkRecordFuseDrawImageRuns(record);
+
     record->defrag();
 }
 
@@ -26,6 +26,25 @@ void SkRecordNoopSaveLayerDrawRestores(SkRecord*);
 // the alpha of the first SaveLayer to the second SaveLayer.
 void SkRecordMergeSvgOpacityAndFilterLayers(SkRecord*);
 
+// Collapses a SaveLayer that contains nothing but another SaveLayer into the inner layer,
+// folding the outer alpha into the inner paint and intersecting the bounds hints.
+void SkRecordMergeNestedSaveLayers(SkRecord*);
+
+// Turns SaveLayer-[src-over draws]-Restore into direct draws when the layer paint composites
+// its contents unchanged, so no offscreen is allocated.
+void SkRecordNoopPassthroughSaveLayers(SkRecord*);
+
+// Collapses runs of Concat/Concat44/Translate commands into a single equivalent command.
+void SkRecordCollapseMatrixConcats(SkRecord*);
+
+// Merges back-to-back intersecting clipRects (with matching AA) into one clip of the
+// intersection.
+void SkRecordMergeClipIntersections(SkRecord*);
+
+// Fuses runs of paintless drawImage commands with identical sampling into a single
+// DrawEdgeAAImageSet, which the GPU backend batches through its bulk texture path.
+void SkRecordFuseDrawImageRuns(SkRecord*);
+
 // Experimental optimizers
 void SkRecordOptimize2(SkRecord*);
 
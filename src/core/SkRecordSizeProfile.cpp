@@ -0,0 +1,153 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkRecordSizeProfile.h"
+
+#include "include/core/SkImage.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkTextBlob.h"
+#include "include/private/SkTHash.h"
+#include "src/core/SkRecord.h"
+#include "src/core/SkRecords.h"
+
+namespace {
+
+#define NAME(T) #T,
+static const char* gRecordTypeNames[] = { SK_RECORD_TYPES(NAME) };
+#undef NAME
+
+struct SizeProfiler {
+    SkRecordSizeProfile* fProfile;
+
+    SkTHashSet<uint32_t>    fPathIDs;
+    SkTHashSet<uint32_t>    fImageIDs;
+    SkTHashSet<const void*> fPictures;
+    SkTHashSet<const void*> fTextBlobs;
+
+    void account(SkRecords::Type type, size_t bytes) {
+        SkRecordSizeProfile::OpStats& stats = fProfile->fOps[type];
+        stats.fCount += 1;
+        stats.fBytes += bytes;
+    }
+
+    // Each of these charges a shared resource's bytes to the first op that references it.
+
+    size_t pathBytes(const SkPath& path) {
+        fProfile->fPathRefs += 1;
+        if (fPathIDs.contains(path.getGenerationID())) {
+            return 0;
+        }
+        fPathIDs.add(path.getGenerationID());
+        fProfile->fUniquePaths += 1;
+        size_t bytes = path.approximateBytesUsed();
+        fProfile->fUniquePathBytes += bytes;
+        return bytes;
+    }
+
+    size_t imageBytes(const SkImage* image) {
+        if (!image) {
+            return 0;
+        }
+        fProfile->fImageRefs += 1;
+        if (fImageIDs.contains(image->uniqueID())) {
+            return 0;
+        }
+        fImageIDs.add(image->uniqueID());
+        fProfile->fUniqueImages += 1;
+        size_t bytes = image->imageInfo().computeMinByteSize();
+        fProfile->fUniqueImageBytes += bytes;
+        return bytes;
+    }
+
+    size_t pictureBytes(const SkPicture* picture) {
+        if (!picture) {
+            return 0;
+        }
+        fProfile->fPictureRefs += 1;
+        if (fPictures.contains(picture)) {
+            return 0;
+        }
+        fPictures.add(picture);
+        fProfile->fUniquePictures += 1;
+        size_t bytes = picture->approximateBytesUsed();
+        fProfile->fUniquePictureBytes += bytes;
+        return bytes;
+    }
+
+    void countTextBlob(const SkTextBlob* blob) {
+        if (!blob) {
+            return;
+        }
+        fProfile->fTextBlobRefs += 1;
+        if (!fTextBlobs.contains(blob)) {
+            fTextBlobs.add(blob);
+            fProfile->fUniqueTextBlobs += 1;
+        }
+    }
+
+    template <typename T> void operator()(const T& op) {
+        this->account(T::kType, sizeof(op));
+    }
+
+    void operator()(const SkRecords::ClipPath& op) {
+        this->account(SkRecords::ClipPath_Type, sizeof(op) + this->pathBytes(op.path));
+    }
+    void operator()(const SkRecords::DrawPath& op) {
+        this->account(SkRecords::DrawPath_Type, sizeof(op) + this->pathBytes(op.path));
+    }
+    void operator()(const SkRecords::DrawImage& op) {
+        this->account(SkRecords::DrawImage_Type, sizeof(op) + this->imageBytes(op.image.get()));
+    }
+    void operator()(const SkRecords::DrawImageRect& op) {
+        this->account(SkRecords::DrawImageRect_Type,
+                      sizeof(op) + this->imageBytes(op.image.get()));
+    }
+    void operator()(const SkRecords::DrawImageLattice& op) {
+        size_t arrays = op.xCount * sizeof(int) + op.yCount * sizeof(int)
+                      + op.flagCount * (sizeof(SkCanvas::Lattice::RectType) + sizeof(SkColor));
+        this->account(SkRecords::DrawImageLattice_Type,
+                      sizeof(op) + arrays + this->imageBytes(op.image.get()));
+    }
+    void operator()(const SkRecords::DrawAtlas& op) {
+        size_t arrays = op.count * (sizeof(SkRSXform) + sizeof(SkRect))
+                      + (op.colors ? op.count * sizeof(SkColor) : 0);
+        this->account(SkRecords::DrawAtlas_Type,
+                      sizeof(op) + arrays + this->imageBytes(op.atlas.get()));
+    }
+    void operator()(const SkRecords::DrawPoints& op) {
+        this->account(SkRecords::DrawPoints_Type, sizeof(op) + op.count * sizeof(SkPoint));
+    }
+    void operator()(const SkRecords::DrawPicture& op) {
+        this->account(SkRecords::DrawPicture_Type,
+                      sizeof(op) + this->pictureBytes(op.picture.get()));
+    }
+    void operator()(const SkRecords::DrawTextBlob& op) {
+        this->countTextBlob(op.blob.get());
+        this->account(SkRecords::DrawTextBlob_Type, sizeof(op));
+    }
+};
+
+}  // namespace
+
+void SkRecordComputeSizeProfile(const SkRecord& record, SkRecordSizeProfile* profile) {
+    *profile = SkRecordSizeProfile();
+    profile->fOps.resize(SK_ARRAY_COUNT(gRecordTypeNames));
+    for (size_t i = 0; i < SK_ARRAY_COUNT(gRecordTypeNames); ++i) {
+        profile->fOps[i].fName = gRecordTypeNames[i];
+    }
+
+    SizeProfiler profiler{profile, {}, {}, {}, {}};
+    for (int i = 0; i < record.count(); ++i) {
+        record.visit(i, profiler);
+    }
+
+    for (const SkRecordSizeProfile::OpStats& stats : profile->fOps) {
+        profile->fTotalOps   += stats.fCount;
+        profile->fTotalBytes += stats.fBytes;
+    }
+}
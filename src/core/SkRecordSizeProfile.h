@@ -0,0 +1,57 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkRecordSizeProfile_DEFINED
+#define SkRecordSizeProfile_DEFINED
+
+#include "include/core/SkTypes.h"
+
+#include <cstddef>
+#include <vector>
+
+class SkRecord;
+
+/**
+ *  Per-op memory attribution for an SkRecord, for finding which ops bloat a display list.
+ *  Unlike measuring serialized output, this counts in-memory costs -- including SkPathRef
+ *  slack -- and distinguishes resources referenced by several ops from ones used once.
+ */
+struct SkRecordSizeProfile {
+    struct OpStats {
+        const char* fName  = nullptr;  // record type name from SK_RECORD_TYPES
+        int         fCount = 0;
+        size_t      fBytes = 0;        // record struct plus heap payloads it references
+    };
+
+    // Indexed by SkRecords::Type; entries the record never uses keep a zero count.
+    std::vector<OpStats> fOps;
+
+    int    fTotalOps   = 0;
+    size_t fTotalBytes = 0;  // sum over fOps
+
+    // Interned resources. The refs count every op that points at the resource; the unique
+    // counts and bytes cover each distinct object once, so refs > unique means sharing.
+    int    fPathRefs        = 0;
+    int    fUniquePaths     = 0;
+    size_t fUniquePathBytes = 0;  // SkPath::approximateBytesUsed, including SkPathRef slack
+
+    int    fImageRefs        = 0;
+    int    fUniqueImages     = 0;
+    size_t fUniqueImageBytes = 0;  // full-decode pixel bytes
+
+    int    fPictureRefs        = 0;
+    int    fUniquePictures     = 0;
+    size_t fUniquePictureBytes = 0;  // SkPicture::approximateBytesUsed
+
+    // Text blobs have no cheap in-memory size query, so only sharing is reported.
+    int    fTextBlobRefs    = 0;
+    int    fUniqueTextBlobs = 0;
+};
+
+void SkRecordComputeSizeProfile(const SkRecord&, SkRecordSizeProfile*);
+
+#endif  // SkRecordSizeProfile_DEFINED
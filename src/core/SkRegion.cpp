@@ -320,7 +320,13 @@ bool SkRegion::setRuns(RunType runs[], int count) {
 
     //  if we get here, we need to become a complex region
 
-    if (!this->isComplex() || fRunHead->fRunCount != count) {
+    // Keep our existing block when we're its only owner and it has room: small
+    // results share one capacity bucket, so repeated ops on the same destination
+    // (e.g. damage accumulation) don't reallocate. A shared block would have to
+    // be copied by ensureWritable() only to be overwritten, so realloc instead.
+    if (this->isComplex() && fRunHead->fRefCnt == 1 && fRunHead->capacity() >= count) {
+        fRunHead->fRunCount = count;
+    } else {
         this->freeRuns();
         this->allocateRuns(count);
         SkASSERT(this->isComplex());
@@ -80,17 +80,32 @@ public:
         return fIntervalCount;
     }
 
+    /**
+     *  Number of runs the allocation can hold, which may exceed fRunCount:
+     *  small allocations are rounded up to one bucket so that repeated ops
+     *  producing small results (e.g. damage regions of a few rects) can reuse
+     *  the same block via SkRegion::setRuns() instead of reallocating.
+     */
+    int capacity() const {
+        return fCapacity;
+    }
+
     static RunHead* Alloc(int count) {
         if (count < SkRegion::kRectRegionRuns) {
             return nullptr;
         }
 
-        const int64_t size = sk_64_mul(count, sizeof(RunType)) + sizeof(RunHead);
+        // Enough for roughly four single-interval y-spans, i.e. a handful of rects.
+        static constexpr int kSmallRunCapacity = 32;
+        const int capacity = count < kSmallRunCapacity ? kSmallRunCapacity : count;
+
+        const int64_t size = sk_64_mul(capacity, sizeof(RunType)) + sizeof(RunHead);
         if (count < 0 || !SkTFitsIn<int32_t>(size)) { SK_ABORT("Invalid Size"); }
 
         RunHead* head = (RunHead*)sk_malloc_throw(size);
         head->fRefCnt = 1;
         head->fRunCount = count;
+        head->fCapacity = capacity;
         // these must be filled in later, otherwise we will be invalid
         head->fYSpanCount = 0;
         head->fIntervalCount = 0;
@@ -252,6 +267,7 @@ public:
     }
 
 private:
+    int32_t fCapacity;
     int32_t fYSpanCount;
     int32_t fIntervalCount;
 };
@@ -19,6 +19,7 @@
 #include "include/core/SkTypeface.h"
 #include "include/private/SkChecksum.h"
 #include "include/private/SkTHash.h"
+#include "src/core/SkAutoMalloc.h"
 #include "src/core/SkDevice.h"
 #include "src/core/SkDraw.h"
 #include "src/core/SkEnumerate.h"
@@ -186,6 +187,82 @@ bool SkFuzzDeserializeSkDescriptor(sk_sp<SkData> bytes, SkAutoDescriptor* ad) {
 // Paths use a SkWriter32 which requires 4 byte alignment.
 static const size_t kPathAlignment  = 4u;
 
+// -- Mask compression -----------------------------------------------------------------------------
+// Glyph mask payloads compress well: after subtracting each row from the one above, the mostly
+// vertically-coherent coverage data collapses into long runs of zero, which a PackBits-style RLE
+// then packs tightly. The format is only produced and consumed when both endpoints opt in (see
+// SkStrikeServer::setCompressGlyphMasks); each payload is prefixed with its encoded size, with
+// zero meaning the mask is stored raw because encoding did not shrink it.
+
+static void rle_pack(const uint8_t* src, size_t size, std::vector<uint8_t>* dst) {
+    size_t i = 0;
+    while (i < size) {
+        // Measure the run of identical bytes starting at i.
+        size_t run = 1;
+        while (run < 130 && i + run < size && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            dst->push_back(SkTo<uint8_t>(128 + (run - 3)));
+            dst->push_back(src[i]);
+            i += run;
+            continue;
+        }
+        // Gather literals until the next run of three or the literal limit.
+        size_t literalStart = i;
+        size_t literals = 0;
+        while (i < size && literals < 128) {
+            if (i + 2 < size && src[i] == src[i + 1] && src[i] == src[i + 2]) break;
+            i++;
+            literals++;
+        }
+        dst->push_back(SkTo<uint8_t>(literals - 1));
+        dst->insert(dst->end(), src + literalStart, src + literalStart + literals);
+    }
+}
+
+static void compress_mask(const uint8_t* image, size_t imageSize, size_t rowBytes,
+                          std::vector<uint8_t>* dst) {
+    SkASSERT(rowBytes > 0 && imageSize % rowBytes == 0);
+    std::vector<uint8_t> delta(image, image + imageSize);
+    for (size_t i = imageSize; i-- > rowBytes;) {
+        delta[i] -= delta[i - rowBytes];
+    }
+    rle_pack(delta.data(), delta.size(), dst);
+}
+
+// Reads untrusted data; returns false unless the encoding expands to exactly dstSize bytes.
+static bool expand_compressed_mask(const volatile uint8_t* src, size_t srcSize,
+                                   uint8_t* dst, size_t dstSize, size_t rowBytes) {
+    if (rowBytes == 0 || dstSize % rowBytes != 0) return false;
+    size_t inPos = 0;
+    size_t outPos = 0;
+    while (inPos < srcSize) {
+        const uint8_t control = src[inPos++];
+        if (control < 128) {
+            const size_t literals = control + 1;
+            if (literals > srcSize - inPos || literals > dstSize - outPos) return false;
+            for (size_t i = 0; i < literals; i++) {
+                dst[outPos + i] = src[inPos + i];
+            }
+            inPos += literals;
+            outPos += literals;
+        } else {
+            const size_t run = control - 125u;  // 3..130
+            if (inPos >= srcSize || run > dstSize - outPos) return false;
+            memset(dst + outPos, src[inPos++], run);
+            outPos += run;
+        }
+    }
+    if (outPos != dstSize) return false;
+
+    // Undo the row delta.
+    for (size_t i = rowBytes; i < dstSize; i++) {
+        dst[i] += dst[i - rowBytes];
+    }
+    return true;
+}
+
 // -- StrikeSpec -----------------------------------------------------------------------------------
 struct StrikeSpec {
     StrikeSpec() = default;
@@ -249,7 +326,7 @@ public:
                  SkDiscardableHandleId discardableHandleId);
     ~RemoteStrike() override = default;
 
-    void writePendingGlyphs(Serializer* serializer);
+    void writePendingGlyphs(Serializer* serializer, bool compressMasks);
     SkDiscardableHandleId discardableHandleId() const { return fDiscardableHandleId; }
 
     const SkDescriptor& getDescriptor() const override {
@@ -325,6 +402,7 @@ private:
         }
     };
 
+    void writeCompressedGlyphImage(SkGlyph& glyph, Serializer* serializer);
     void writeGlyphPath(const SkGlyph& glyph, Serializer* serializer) const;
     void ensureScalerContext();
 
@@ -386,7 +464,7 @@ static void writeGlyph(const SkGlyph& glyph, Serializer* serializer) {
     serializer->write<uint8_t>(glyph.maskFormat());
 }
 
-void RemoteStrike::writePendingGlyphs(Serializer* serializer) {
+void RemoteStrike::writePendingGlyphs(Serializer* serializer, bool compressMasks) {
     SkASSERT(this->hasPendingGlyphs());
 
     // Write the desc.
@@ -410,8 +488,12 @@ void RemoteStrike::writePendingGlyphs(Serializer* serializer) {
         writeGlyph(glyph, serializer);
         auto imageSize = glyph.imageSize();
         if (imageSize > 0 && FitsInAtlas(glyph)) {
-            glyph.fImage = serializer->allocate(imageSize, glyph.formatAlignment());
-            fContext->getImage(glyph);
+            if (compressMasks) {
+                this->writeCompressedGlyphImage(glyph, serializer);
+            } else {
+                glyph.fImage = serializer->allocate(imageSize, glyph.formatAlignment());
+                fContext->getImage(glyph);
+            }
         }
     }
     fMasksToSend.clear();
@@ -445,6 +527,24 @@ void RemoteStrike::setTypefaceAndEffects(
     fEffects = effects;
 }
 
+void RemoteStrike::writeCompressedGlyphImage(SkGlyph& glyph, Serializer* serializer) {
+    const size_t imageSize = glyph.imageSize();
+    SkAutoSMalloc<1024> image{imageSize};
+    glyph.fImage = image.get();
+    fContext->getImage(glyph);
+
+    std::vector<uint8_t> encoded;
+    compress_mask(static_cast<const uint8_t*>(image.get()), imageSize, glyph.rowBytes(), &encoded);
+    if (encoded.size() < imageSize) {
+        serializer->write<uint32_t>(SkTo<uint32_t>(encoded.size()));
+        memcpy(serializer->allocate(encoded.size(), 1), encoded.data(), encoded.size());
+    } else {
+        // Encoding did not help; store the mask raw behind a zero encoded size.
+        serializer->write<uint32_t>(0u);
+        memcpy(serializer->allocate(imageSize, glyph.formatAlignment()), image.get(), imageSize);
+    }
+}
+
 void RemoteStrike::writeGlyphPath(
         const SkGlyph& glyph, Serializer* serializer) const {
     if (glyph.isColor() || glyph.isEmpty()) {
@@ -585,6 +685,7 @@ public:
     // SkStrikeServer API methods
     sk_sp<SkData> serializeTypeface(SkTypeface*);
     void writeStrikeData(std::vector<uint8_t>* memory);
+    void setCompressGlyphMasks(bool compress);
 
     // Methods for SkStrikeForGPUCacheInterface
     RemoteStrike* getOrCreateCache(const SkPaint&,
@@ -619,6 +720,7 @@ private:
     SkStrikeServer::DiscardableHandleManager* const fDiscardableHandleManager;
     SkTHashSet<SkFontID> fCachedTypefaces;
     size_t fMaxEntriesInDescriptorMap = kMaxEntriesInDescriptorMap;
+    bool fCompressGlyphMasks = false;
 
     // Cached serialized typefaces.
     SkTHashMap<SkFontID, sk_sp<SkData>> fSerializedTypefaces;
@@ -633,6 +735,10 @@ SkStrikeServerImpl::SkStrikeServerImpl(SkStrikeServer::DiscardableHandleManager*
     SkASSERT(fDiscardableHandleManager);
 }
 
+void SkStrikeServerImpl::setCompressGlyphMasks(bool compress) {
+    fCompressGlyphMasks = compress;
+}
+
 void SkStrikeServerImpl::setMaxEntriesInDescriptorMapForTesting(size_t count) {
     fMaxEntriesInDescriptorMap = count;
 }
@@ -684,7 +790,7 @@ void SkStrikeServerImpl::writeStrikeData(std::vector<uint8_t>* memory) {
 #ifdef SK_DEBUG
             [&](RemoteStrike* strike) {
                 if (strike->hasPendingGlyphs()) {
-                    strike->writePendingGlyphs(&serializer);
+                    strike->writePendingGlyphs(&serializer, fCompressGlyphMasks);
                     strike->resetScalerContext();
                 }
                 auto it = fDescToRemoteStrike.find(&strike->getDescriptor());
@@ -696,9 +802,9 @@ void SkStrikeServerImpl::writeStrikeData(std::vector<uint8_t>* memory) {
             }
 
 #else
-            [&serializer](RemoteStrike* strike) {
+            [&](RemoteStrike* strike) {
                 if (strike->hasPendingGlyphs()) {
-                    strike->writePendingGlyphs(&serializer);
+                    strike->writePendingGlyphs(&serializer, fCompressGlyphMasks);
                     strike->resetScalerContext();
                 }
                 #if defined(SK_TRACE_GLYPH_RUN_PROCESS)
@@ -882,6 +988,10 @@ void SkStrikeServer::writeStrikeData(std::vector<uint8_t>* memory) {
     fImpl->writeStrikeData(memory);
 }
 
+void SkStrikeServer::setCompressGlyphMasks(bool compress) {
+    fImpl->setCompressGlyphMasks(compress);
+}
+
 SkStrikeServerImpl* SkStrikeServer::impl() { return fImpl.get(); }
 
 void SkStrikeServer::setMaxEntriesInDescriptorMapForTesting(size_t count) {
@@ -917,6 +1027,8 @@ public:
 
     bool readStrikeData(const volatile void* memory, size_t memorySize);
 
+    void setReadCompressedGlyphMasks(bool compressed);
+
 private:
     static bool ReadGlyph(SkTLazy<SkGlyph>& glyph, Deserializer* deserializer);
     sk_sp<SkTypeface> addTypeface(const WireTypeface& wire);
@@ -925,6 +1037,7 @@ private:
     sk_sp<SkStrikeClient::DiscardableHandleManager> fDiscardableHandleManager;
     SkStrikeCache* const fStrikeCache;
     const bool fIsLogging;
+    bool fReadCompressedGlyphMasks = false;
 };
 
 SkStrikeClientImpl::SkStrikeClientImpl(
@@ -975,6 +1088,9 @@ bool SkStrikeClientImpl::readStrikeData(const volatile void* memory, size_t memo
     uint64_t glyphImagesCount = 0;
     uint64_t glyphPathsCount = 0;
 
+    // Scratch for expanding compressed masks; mergeGlyphAndImage copies the image out.
+    std::vector<uint8_t> maskStorage;
+
     if (!deserializer.read<uint64_t>(&typefaceSize)) READ_FAILURE
     for (size_t i = 0; i < typefaceSize; ++i) {
         WireTypeface wire;
@@ -1048,10 +1164,26 @@ bool SkStrikeClientImpl::readStrikeData(const volatile void* memory, size_t memo
             if (!ReadGlyph(glyph, &deserializer)) READ_FAILURE
 
             if (!glyph->isEmpty() && SkStrikeForGPU::FitsInAtlas(*glyph)) {
-                const volatile void* image =
-                        deserializer.read(glyph->imageSize(), glyph->formatAlignment());
-                if (!image) READ_FAILURE
-                glyph->fImage = (void*)image;
+                uint32_t encodedSize = 0;
+                if (fReadCompressedGlyphMasks && !deserializer.read<uint32_t>(&encodedSize)) {
+                    READ_FAILURE
+                }
+                if (encodedSize > 0) {
+                    auto* encoded = static_cast<const volatile uint8_t*>(
+                            deserializer.read(encodedSize, 1));
+                    if (!encoded) READ_FAILURE
+                    maskStorage.resize(glyph->imageSize());
+                    if (!expand_compressed_mask(encoded, encodedSize, maskStorage.data(),
+                                                maskStorage.size(), glyph->rowBytes())) {
+                        READ_FAILURE
+                    }
+                    glyph->fImage = maskStorage.data();
+                } else {
+                    const volatile void* image =
+                            deserializer.read(glyph->imageSize(), glyph->formatAlignment());
+                    if (!image) READ_FAILURE
+                    glyph->fImage = (void*)image;
+                }
             }
 
             strike->mergeGlyphAndImage(glyph->getPackedID(), *glyph);
@@ -1088,6 +1220,10 @@ bool SkStrikeClientImpl::readStrikeData(const volatile void* memory, size_t memo
     return true;
 }
 
+void SkStrikeClientImpl::setReadCompressedGlyphMasks(bool compressed) {
+    fReadCompressedGlyphMasks = compressed;
+}
+
 sk_sp<SkTypeface> SkStrikeClientImpl::deserializeTypeface(const void* buf, size_t len) {
     WireTypeface wire;
     if (len != sizeof(wire)) return nullptr;
@@ -1118,6 +1254,10 @@ bool SkStrikeClient::readStrikeData(const volatile void* memory, size_t memorySi
     return fImpl->readStrikeData(memory, memorySize);
 }
 
+void SkStrikeClient::setReadCompressedGlyphMasks(bool compressed) {
+    fImpl->setReadCompressedGlyphMasks(compressed);
+}
+
 sk_sp<SkTypeface> SkStrikeClient::deserializeTypeface(const void* buf, size_t len) {
     return fImpl->deserializeTypeface(buf, len);
 }
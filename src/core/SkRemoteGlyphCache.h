@@ -74,6 +74,11 @@ public:
     // unlocked after this call.
     SK_SPI void writeStrikeData(std::vector<uint8_t>* memory);
 
+    // Compress glyph mask payloads emitted by writeStrikeData. The compressed wire format is not
+    // readable by older clients, so only enable this once the embedder has confirmed that the
+    // remote client calls SkStrikeClient::setReadCompressedGlyphMasks(true).
+    SK_SPI void setCompressGlyphMasks(bool compress);
+
     // Testing helpers
     void setMaxEntriesInDescriptorMapForTesting(size_t count);
     size_t remoteStrikeMapSizeForTesting() const;
@@ -144,6 +149,10 @@ public:
     // Returns false if the data is invalid.
     SK_SPI bool readStrikeData(const volatile void* memory, size_t memorySize);
 
+    // Interpret glyph mask payloads in readStrikeData as compressed. Must match the server's
+    // SkStrikeServer::setCompressGlyphMasks setting, as negotiated by the embedder.
+    SK_SPI void setReadCompressedGlyphMasks(bool compressed);
+
 private:
     std::unique_ptr<SkStrikeClientImpl> fImpl;
 };
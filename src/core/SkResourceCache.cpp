@@ -15,7 +15,9 @@
 #include "src/core/SkMessageBus.h"
 #include "src/core/SkMipmap.h"
 #include "src/core/SkOpts.h"
+#include "src/core/SkTraceEvent.h"
 
+#include <atomic>
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -187,6 +189,7 @@ void SkResourceCache::remove(Rec* rec) {
 
     fTotalBytesUsed -= used;
     fCount -= 1;
+    TRACE_COUNTER1("skia.cache", "skia resource cache", fTotalBytesUsed);
 
     //SkDebugf("-RC count [%3d] bytes %d\n", fCount, fTotalBytesUsed);
 
@@ -227,6 +230,22 @@ void SkResourceCache::purgeAsNeeded(bool forcePurge) {
     }
 }
 
+size_t SkResourceCache::purgePartial(size_t bytesToPurge) {
+    size_t origBytesUsed = fTotalBytesUsed;
+
+    // Evict from the tail like purgeAsNeeded; stopping early leaves the LRU list in a state the
+    // next call picks up from.
+    Rec* rec = fTail;
+    while (rec && origBytesUsed - fTotalBytesUsed < bytesToPurge) {
+        Rec* prev = rec->fPrev;
+        if (rec->canBePurged()) {
+            this->remove(rec);
+        }
+        rec = prev;
+    }
+    return origBytesUsed - fTotalBytesUsed;
+}
+
 //#define SK_TRACK_PURGE_SHAREDID_HITRATE
 
 #ifdef SK_TRACK_PURGE_SHAREDID_HITRATE
@@ -358,6 +377,7 @@ void SkResourceCache::addToHead(Rec* rec) {
     }
     fTotalBytesUsed += rec->bytesUsed();
     fCount += 1;
+    TRACE_COUNTER1("skia.cache", "skia resource cache", fTotalBytesUsed);
 
     this->validate();
 }
@@ -452,94 +472,184 @@ void SkResourceCache::checkMessages() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static SkResourceCache* gResourceCache = nullptr;
-static SkMutex& resource_cache_mutex() {
-    static SkMutex& mutex = *(new SkMutex);
-    return mutex;
+/**
+ *  The global cache is split into shards, selected by the low bits of the key's hash, so that
+ *  threads probing for different keys rarely contend on the same mutex. Each shard is a complete
+ *  SkResourceCache with its own LRU list and an equal slice of the total budget.
+ */
+static constexpr int kCacheShardCount = 8;
+static_assert(0 == (kCacheShardCount & (kCacheShardCount - 1)), "must be a power of two");
+
+namespace {
+struct CacheShard {
+    SkMutex               fMutex;
+    SkResourceCache*      fCache = nullptr;
+    std::atomic<uint32_t> fLocks{0};
+    std::atomic<uint32_t> fContentions{0};
+};
+
+class SkAutoShardLock {
+public:
+    SkAutoShardLock(CacheShard& shard) : fShard(shard) {
+        fShard.fLocks.fetch_add(1, std::memory_order_relaxed);
+        if (!fShard.fMutex.tryAcquire()) {
+            fShard.fContentions.fetch_add(1, std::memory_order_relaxed);
+            fShard.fMutex.acquire();
+        }
+    }
+    ~SkAutoShardLock() { fShard.fMutex.release(); }
+
+private:
+    CacheShard& fShard;
+};
+}  // namespace
+
+static CacheShard* cache_shards() {
+    static CacheShard* shards = new CacheShard[kCacheShardCount];
+    return shards;
 }
 
-/** Must hold resource_cache_mutex() when calling. */
-static SkResourceCache* get_cache() {
-    // resource_cache_mutex() is always held when this is called, so we don't need to be fancy in here.
-    resource_cache_mutex().assertHeld();
-    if (nullptr == gResourceCache) {
+/** Must hold the shard's mutex when calling. */
+static SkResourceCache* get_cache(CacheShard& shard) {
+    shard.fMutex.assertHeld();
+    if (nullptr == shard.fCache) {
 #ifdef SK_USE_DISCARDABLE_SCALEDIMAGECACHE
-        gResourceCache = new SkResourceCache(SkDiscardableMemory::Create);
+        shard.fCache = new SkResourceCache(SkDiscardableMemory::Create);
 #else
-        gResourceCache = new SkResourceCache(SK_DEFAULT_IMAGE_CACHE_LIMIT);
+        shard.fCache = new SkResourceCache(SK_DEFAULT_IMAGE_CACHE_LIMIT / kCacheShardCount);
 #endif
     }
-    return gResourceCache;
+    return shard.fCache;
+}
+
+static CacheShard& shard_for_key(const SkResourceCache::Key& key) {
+    return cache_shards()[key.hash() & (kCacheShardCount - 1)];
 }
 
 size_t SkResourceCache::GetTotalBytesUsed() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getTotalBytesUsed();
+    size_t total = 0;
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        total += get_cache(cache_shards()[i])->getTotalBytesUsed();
+    }
+    return total;
 }
 
 size_t SkResourceCache::GetTotalByteLimit() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getTotalByteLimit();
+    size_t total = 0;
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        total += get_cache(cache_shards()[i])->getTotalByteLimit();
+    }
+    return total;
 }
 
 size_t SkResourceCache::SetTotalByteLimit(size_t newLimit) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->setTotalByteLimit(newLimit);
+    // Distribute the budget evenly; any remainder goes to the first shard.
+    size_t perShard = newLimit / kCacheShardCount;
+    size_t prevTotal = 0;
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        size_t limit = perShard + (0 == i ? newLimit % kCacheShardCount : 0);
+        SkAutoShardLock am(cache_shards()[i]);
+        prevTotal += get_cache(cache_shards()[i])->setTotalByteLimit(limit);
+    }
+    return prevTotal;
 }
 
 SkResourceCache::DiscardableFactory SkResourceCache::GetDiscardableFactory() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->discardableFactory();
+    // All shards are constructed identically, so the first can answer for the rest.
+    SkAutoShardLock am(cache_shards()[0]);
+    return get_cache(cache_shards()[0])->discardableFactory();
 }
 
 SkCachedData* SkResourceCache::NewCachedData(size_t bytes) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->newCachedData(bytes);
+    SkAutoShardLock am(cache_shards()[0]);
+    return get_cache(cache_shards()[0])->newCachedData(bytes);
 }
 
 void SkResourceCache::Dump() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->dump();
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        get_cache(cache_shards()[i])->dump();
+    }
 }
 
 size_t SkResourceCache::SetSingleAllocationByteLimit(size_t size) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->setSingleAllocationByteLimit(size);
+    size_t prev = 0;
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        size_t shardPrev = get_cache(cache_shards()[i])->setSingleAllocationByteLimit(size);
+        if (0 == i) {
+            prev = shardPrev;
+        }
+    }
+    return prev;
 }
 
 size_t SkResourceCache::GetSingleAllocationByteLimit() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getSingleAllocationByteLimit();
+    SkAutoShardLock am(cache_shards()[0]);
+    return get_cache(cache_shards()[0])->getSingleAllocationByteLimit();
 }
 
 size_t SkResourceCache::GetEffectiveSingleAllocationByteLimit() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getEffectiveSingleAllocationByteLimit();
+    SkAutoShardLock am(cache_shards()[0]);
+    return get_cache(cache_shards()[0])->getEffectiveSingleAllocationByteLimit();
 }
 
 void SkResourceCache::PurgeAll() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->purgeAll();
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        get_cache(cache_shards()[i])->purgeAll();
+    }
+}
+
+size_t SkResourceCache::PurgePartial(size_t bytesToPurge) {
+    // Rotate the starting shard between calls so repeated small purges spread evictions across
+    // shards instead of always draining shard 0 first.
+    static std::atomic<uint32_t> gShardCursor{0};
+    uint32_t start = gShardCursor.fetch_add(1, std::memory_order_relaxed);
+
+    size_t freed = 0;
+    for (int i = 0; i < kCacheShardCount && freed < bytesToPurge; ++i) {
+        CacheShard& shard = cache_shards()[(start + i) & (kCacheShardCount - 1)];
+        SkAutoShardLock am(shard);
+        freed += get_cache(shard)->purgePartial(bytesToPurge - freed);
+    }
+    return freed;
 }
 
 void SkResourceCache::CheckMessages() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->checkMessages();
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        get_cache(cache_shards()[i])->checkMessages();
+    }
 }
 
 bool SkResourceCache::Find(const Key& key, FindVisitor visitor, void* context) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->find(key, visitor, context);
+    CacheShard& shard = shard_for_key(key);
+    SkAutoShardLock am(shard);
+    return get_cache(shard)->find(key, visitor, context);
 }
 
 void SkResourceCache::Add(Rec* rec, void* payload) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->add(rec, payload);
+    CacheShard& shard = shard_for_key(rec->getKey());
+    SkAutoShardLock am(shard);
+    get_cache(shard)->add(rec, payload);
 }
 
 void SkResourceCache::VisitAll(Visitor visitor, void* context) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->visitAll(visitor, context);
+    for (int i = 0; i < kCacheShardCount; ++i) {
+        SkAutoShardLock am(cache_shards()[i]);
+        get_cache(cache_shards()[i])->visitAll(visitor, context);
+    }
+}
+
+int SkResourceCache::GetShardStats(ShardStats stats[], int count) {
+    for (int i = 0; i < count && i < kCacheShardCount; ++i) {
+        stats[i].fLocks = cache_shards()[i].fLocks.load(std::memory_order_relaxed);
+        stats[i].fContentions = cache_shards()[i].fContentions.load(std::memory_order_relaxed);
+    }
+    return kCacheShardCount;
 }
 
 void SkResourceCache::PostPurgeSharedID(uint64_t sharedID) {
@@ -578,6 +688,10 @@ void SkGraphics::PurgeResourceCache() {
     return SkResourceCache::PurgeAll();
 }
 
+size_t SkGraphics::PurgeResourceCachePartial(size_t bytesToPurge) {
+    return SkResourceCache::PurgePartial(bytesToPurge);
+}
+
 /////////////
 
 static void dump_visitor(const SkResourceCache::Rec& rec, void*) {
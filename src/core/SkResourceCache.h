@@ -165,6 +165,15 @@ public:
     static size_t GetEffectiveSingleAllocationByteLimit();
 
     static void PurgeAll();
+
+    /**
+     *  Purges, least-recently used first, at most bytesToPurge bytes from the global cache and
+     *  returns the number of bytes freed. Each shard's mutex is held only while that shard's
+     *  slice is evicted, so a full purge can be split into bounded-latency steps. Successive
+     *  calls rotate the starting shard so repeated small purges spread evictions evenly.
+     */
+    static size_t PurgePartial(size_t bytesToPurge);
+
     static void CheckMessages();
 
     static void TestDumpMemoryStatistics();
@@ -188,6 +197,21 @@ public:
      */
     static void Dump();
 
+    /**
+     *  The global cache is sharded by Key hash, each shard guarded by its own mutex. These
+     *  counters record, per shard, how often the mutex was taken and how many of those
+     *  acquisitions found it already held by another thread.
+     */
+    struct ShardStats {
+        uint32_t fLocks;        // times the shard's mutex was acquired
+        uint32_t fContentions;  // acquisitions that had to wait for another thread
+    };
+
+    /**
+     *  Copies stats for at most 'count' shards into 'stats' and returns the shard count.
+     */
+    static int GetShardStats(ShardStats stats[], int count);
+
     ///////////////////////////////////////////////////////////////////////////
 
     /**
@@ -248,6 +272,12 @@ public:
         this->purgeAsNeeded(true);
     }
 
+    /**
+     *  Purges, least-recently used first, at most bytesToPurge bytes and returns the number of
+     *  bytes freed. Stopping early leaves the LRU list in a state the next call resumes from.
+     */
+    size_t purgePartial(size_t bytesToPurge);
+
     DiscardableFactory discardableFactory() const { return fDiscardableFactory; }
 
     SkCachedData* newCachedData(size_t bytes);
@@ -45,20 +45,23 @@
 #include <algorithm>
 
 namespace SkSL {
+// A pool of compilers, so that concurrent runtime-effect compilation isn't serialized on one
+// shared instance. Each SharedCompiler checks a compiler out of the free list, creating a new one
+// only when every pooled compiler is already in use on another thread, and returns it when
+// destroyed. A pooled compiler loads its builtin modules once and then reuses them for every
+// program it compiles. (The Context and symbol tables are mutated during compilation, so the
+// modules can't be a single set shared across compilers; the pool keeps the total number of
+// copies at the peak compilation concurrency.)
 class SharedCompiler {
 public:
-    SharedCompiler() : fLock(compiler_mutex()) {
-        if (!gImpl) {
-            gImpl = new Impl();
-        }
-    }
+    SharedCompiler() : fImpl(Acquire()) {}
 
-    SkSL::Compiler* operator->() const { return gImpl->fCompiler; }
+    ~SharedCompiler() { Release(fImpl); }
 
-private:
-    SkAutoMutexExclusive fLock;
+    SkSL::Compiler* operator->() const { return fImpl->fCompiler; }
 
-    static SkMutex& compiler_mutex() {
+private:
+    static SkMutex& pool_mutex() {
         static SkMutex& mutex = *(new SkMutex);
         return mutex;
     }
@@ -90,12 +93,34 @@ private:
 
         SkSL::ShaderCapsPointer fCaps;
         SkSL::Compiler*         fCompiler;
+        Impl*                   fNext = nullptr;
     };
 
-    static Impl* gImpl;
+    static Impl* Acquire() {
+        {
+            SkAutoMutexExclusive lock(pool_mutex());
+            if (gFreeList) {
+                Impl* impl = gFreeList;
+                gFreeList = impl->fNext;
+                return impl;
+            }
+        }
+        // Don't hold the lock while the new compiler loads its builtin modules.
+        return new Impl();
+    }
+
+    static void Release(Impl* impl) {
+        SkAutoMutexExclusive lock(pool_mutex());
+        impl->fNext = gFreeList;
+        gFreeList = impl;
+    }
+
+    Impl* fImpl;
+
+    static Impl* gFreeList;
 };
 
-SharedCompiler::Impl* SharedCompiler::gImpl = nullptr;
+SharedCompiler::Impl* SharedCompiler::gFreeList = nullptr;
 
 }  // namespace SkSL
 
@@ -142,9 +167,8 @@ SkRuntimeEffect::Result SkRuntimeEffect::Make(SkString sksl, const Options& opti
                                               SkSL::ProgramKind kind) {
     std::unique_ptr<SkSL::Program> program;
     {
-        // We keep this SharedCompiler in a separate scope to make sure it's destroyed before
-        // calling the Make overload at the end, which creates its own (non-reentrant)
-        // SharedCompiler instance
+        // We keep this SharedCompiler in a separate scope so it's returned to the pool before
+        // calling the Make overload at the end, which checks out its own instance
         SkSL::SharedCompiler compiler;
         SkSL::Program::Settings settings;
         settings.fInlineThreshold = 0;
@@ -265,6 +289,13 @@ SkRuntimeEffect::Result SkRuntimeEffect::Make(std::unique_ptr<SkSL::Program> pro
                     uni.flags |= Uniform::kSRGBUnpremul_Flag;
                 }
 
+                // Dead uniforms keep their slot in the (public) uniform data layout, but flagging
+                // them lets the backends avoid declaring and uploading them.
+                const SkSL::ProgramUsage::VariableCounts counts = program->usage()->get(var);
+                if (!counts.fRead && !counts.fWrite) {
+                    uni.flags |= Uniform::kUnused_Flag;
+                }
+
                 uni.offset = offset;
                 offset += uni.sizeInBytes();
                 SkASSERT(SkIsAlign4(offset));
@@ -1312,11 +1343,24 @@ sk_sp<SkImage> SkRuntimeShaderBuilder::makeImage(GrRecordingContext* recordingCo
 }
 
 sk_sp<SkShader> SkRuntimeShaderBuilder::makeShader(const SkMatrix* localMatrix, bool isOpaque) {
-    return this->effect()->makeShader(this->uniforms(),
-                                      this->children(),
-                                      this->numChildren(),
-                                      localMatrix,
-                                      isOpaque);
+    bool hasLocalMatrix = SkToBool(localMatrix);
+    if (fCachedShader && fCachedGenID == this->genID() && fCachedIsOpaque == isOpaque &&
+        fCachedHasLocalMatrix == hasLocalMatrix &&
+        (!hasLocalMatrix || fCachedLocalMatrix == *localMatrix)) {
+        // Shaders are immutable, so handing out the previous one again is indistinguishable from
+        // building an identical copy.
+        return fCachedShader;
+    }
+    fCachedShader = this->effect()->makeShader(this->uniforms(),
+                                               this->children(),
+                                               this->numChildren(),
+                                               localMatrix,
+                                               isOpaque);
+    fCachedGenID = this->genID();
+    fCachedIsOpaque = isOpaque;
+    fCachedHasLocalMatrix = hasLocalMatrix;
+    fCachedLocalMatrix = hasLocalMatrix ? *localMatrix : SkMatrix::I();
+    return fCachedShader;
 }
 
 SkRuntimeBlendBuilder::SkRuntimeBlendBuilder(sk_sp<SkRuntimeEffect> effect)
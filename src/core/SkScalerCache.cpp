@@ -88,11 +88,40 @@ int SkScalerCache::countCachedGlyphs() const {
 
 std::tuple<SkSpan<const SkGlyph*>, size_t> SkScalerCache::internalPrepare(
         SkSpan<const SkGlyphID> glyphIDs, PathDetail pathDetail, const SkGlyph** results) {
-    const SkGlyph** cursor = results;
     size_t delta = 0;
+
+    // Collect the IDs not yet in the cache, and make all of their glyphs with a single
+    // call into the scaler context. Runs are short, so a linear scan suffices to keep
+    // repeated IDs from being made twice.
+    SkSTArray<64, SkGlyph*> missing;
+    for (auto glyphID : glyphIDs) {
+        SkPackedGlyphID packedID{glyphID};
+        if (fDigestForPackedGlyphID.find(packedID) == nullptr) {
+            bool alreadyPending = false;
+            for (const SkGlyph* pending : missing) {
+                if (pending->getPackedID() == packedID) {
+                    alreadyPending = true;
+                    break;
+                }
+            }
+            if (!alreadyPending) {
+                missing.push_back(fAlloc.make<SkGlyph>(packedID));
+            }
+        }
+    }
+    if (!missing.empty()) {
+        fScalerContext->makeGlyphs(SkMakeSpan(missing.begin(), missing.size()));
+        for (SkGlyph* glyph : missing) {
+            this->addGlyph(glyph);
+            delta += sizeof(SkGlyph);
+        }
+    }
+
+    const SkGlyph** cursor = results;
     for (auto glyphID : glyphIDs) {
-        auto [glyph, size] = this->glyph(SkPackedGlyphID{glyphID});
-        delta += size;
+        SkGlyphDigest* digest = fDigestForPackedGlyphID.find(SkPackedGlyphID{glyphID});
+        SkASSERT(digest != nullptr);
+        SkGlyph* glyph = fGlyphForIndex[digest->index()];
         if (pathDetail == kMetricsAndPath) {
             auto [_, pathSize] = this->preparePath(glyph);
             delta += pathSize;
@@ -137,6 +166,36 @@ std::tuple<SkSpan<const SkGlyph*>, size_t> SkScalerCache::metrics(
     return {glyphs, delta};
 }
 
+size_t SkScalerCache::getAdvances(SkSpan<const SkGlyphID> glyphIDs, SkScalar advances[]) {
+    SkAutoMutexExclusive lock{fMu};
+    size_t delta = 0;
+
+    if (fAdvanceForGlyphID.empty()) {
+        const int glyphCount = std::max(fScalerContext->getTypeface()->countGlyphs(), 1);
+        fAdvanceForGlyphID.assign(glyphCount, SK_ScalarNaN);
+        delta += glyphCount * sizeof(SkScalar);
+    }
+
+    for (auto glyphID : glyphIDs) {
+        if (glyphID >= fAdvanceForGlyphID.size()) {
+            // Out-of-range IDs resolve to the generator's empty glyph; don't table them.
+            auto [glyph, size] = this->glyph(SkPackedGlyphID{glyphID});
+            delta += size;
+            *advances++ = glyph->advanceX();
+            continue;
+        }
+        SkScalar advance = fAdvanceForGlyphID[glyphID];
+        if (SkScalarIsNaN(advance)) {
+            auto [glyph, size] = this->glyph(SkPackedGlyphID{glyphID});
+            delta += size;
+            advance = fAdvanceForGlyphID[glyphID] = glyph->advanceX();
+        }
+        *advances++ = advance;
+    }
+
+    return delta;
+}
+
 std::tuple<SkSpan<const SkGlyph*>, size_t> SkScalerCache::preparePaths(
         SkSpan<const SkGlyphID> glyphIDs, const SkGlyph* results[]) {
     SkAutoMutexExclusive lock{fMu};
@@ -149,12 +208,21 @@ std::tuple<SkSpan<const SkGlyph*>, size_t> SkScalerCache::prepareImages(
     const SkGlyph** cursor = results;
     SkAutoMutexExclusive lock{fMu};
     size_t delta = 0;
+    // Allocate storage for every missing image up front, then render them all with a single
+    // call so ports can rasterize the whole run in one backend batch.
+    SkSTArray<64, const SkGlyph*> needImages;
     for (auto glyphID : glyphIDs) {
         auto[glyph, glyphSize] = this->glyph(glyphID);
-        auto[_, imageSize] = this->prepareImage(glyph);
+        size_t imageSize = glyph->prepareImageStorage(&fAlloc);
+        if (imageSize > 0) {
+            needImages.push_back(glyph);
+        }
         delta += glyphSize + imageSize;
         *cursor++ = glyph;
     }
+    if (!needImages.empty()) {
+        fScalerContext->getImages(SkMakeSpan(needImages.begin(), needImages.size()));
+    }
 
     return {{results, glyphIDs.size()}, delta};
 }
@@ -83,6 +83,11 @@ public:
     std::tuple<SkSpan<const SkGlyph*>, size_t> metrics(
             SkSpan<const SkGlyphID> glyphIDs, const SkGlyph* results[]) SK_EXCLUDES(fMu);
 
+    // Fill advances with each glyph's x-advance. Advances are served from a flat table indexed
+    // by glyph ID, so warm measurement is an array gather instead of a hash probe per glyph.
+    // Glyphs not yet in the table are created (and cached as usual) on first use.
+    size_t getAdvances(SkSpan<const SkGlyphID> glyphIDs, SkScalar advances[]) SK_EXCLUDES(fMu);
+
     std::tuple<SkSpan<const SkGlyph*>, size_t> preparePaths(
             SkSpan<const SkGlyphID> glyphIDs, const SkGlyph* results[]) SK_EXCLUDES(fMu);
 
@@ -155,6 +160,11 @@ private:
     SkTHashMap<SkPackedGlyphID, SkGlyphDigest> fDigestForPackedGlyphID SK_GUARDED_BY(fMu);
     std::vector<SkGlyph*> fGlyphForIndex SK_GUARDED_BY(fMu);
 
+    // Flat x-advance per glyph ID for getAdvances(), sized to the typeface's glyph count when
+    // first needed. NaN marks entries not computed yet. Strikes are immutable once created, so
+    // the table never needs invalidating.
+    std::vector<SkScalar> fAdvanceForGlyphID SK_GUARDED_BY(fMu);
+
     // so we don't grow our arrays a lot
     static constexpr size_t kMinGlyphCount = 8;
     static constexpr size_t kMinGlyphImageSize = 16 /* height */ * 8 /* width */;
@@ -34,6 +34,11 @@
 #include "src/utils/SkMatrix22.h"
 #include <new>
 
+#if SK_SUPPORT_GPU
+#include "src/core/SkDistanceFieldGen.h"
+#include "src/gpu/GrDistanceFieldGenFromVector.h"
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 #ifdef SK_DEBUG
@@ -181,6 +186,12 @@ SkGlyph SkScalerContext::makeGlyph(SkPackedGlyphID packedID) {
     return internalMakeGlyph(packedID, fRec.fMaskFormat);
 }
 
+void SkScalerContext::makeGlyphs(SkSpan<SkGlyph*> glyphs) {
+    for (SkGlyph* glyph : glyphs) {
+        *glyph = internalMakeGlyph(glyph->getPackedID(), fRec.fMaskFormat);
+    }
+}
+
 SkGlyph SkScalerContext::internalMakeGlyph(SkPackedGlyphID packedID, SkMask::Format format) {
     SkGlyph glyph{packedID};
     glyph.fMaskFormat = format;
@@ -548,6 +559,38 @@ static void generateMask(const SkMask& mask, const SkPath& path,
     }
 }
 
+#if SK_SUPPORT_GPU
+bool SkScalerContext::internalGetSDFFromPath(const SkGlyph& unfilteredGlyph,
+                                             const SkGlyph& origGlyph) {
+    // With a frame or path effect the raster pipeline applies paint styling that the distance
+    // field generator knows nothing about.
+    if (fGenerateImageFromPath) {
+        return false;
+    }
+    // The SDF mask filter pads the unfiltered bounds by SK_DistanceFieldPad on every side;
+    // any other relationship means more than a distance field is being generated.
+    if (origGlyph.iRect() != unfilteredGlyph.iRect().makeOutset(SK_DistanceFieldPad,
+                                                                SK_DistanceFieldPad)) {
+        return false;
+    }
+    SkPath devPath;
+    if (!this->internalGetPath(origGlyph.getPackedID(), &devPath)) {
+        return false;
+    }
+    // The scaler's metrics can disagree with the path bounds by a fraction of a pixel; fall
+    // back to the raster pipeline rather than clip the field.
+    if (!unfilteredGlyph.iRect().contains(devPath.getBounds().roundOut())) {
+        return false;
+    }
+    const SkMatrix drawMatrix =
+            SkMatrix::Translate(-unfilteredGlyph.fLeft, -unfilteredGlyph.fTop);
+    return GrGenerateDistanceFieldFromPath(static_cast<unsigned char*>(origGlyph.fImage),
+                                           devPath, drawMatrix,
+                                           origGlyph.fWidth, origGlyph.fHeight,
+                                           origGlyph.rowBytes());
+}
+#endif
+
 void SkScalerContext::getImage(const SkGlyph& origGlyph) {
     const SkGlyph* unfilteredGlyph = &origGlyph;
     // in case we need to call generateImage on a mask-format that is different
@@ -560,6 +603,15 @@ void SkScalerContext::getImage(const SkGlyph& origGlyph) {
         tmpGlyph = this->internalMakeGlyph(origGlyph.getPackedID(), fRec.fMaskFormat);
         fMaskFilter = std::move(mf);
 
+#if SK_SUPPORT_GPU
+        // Distance-field glyphs can skip the A8 rasterization and the A8-to-SDF conversion
+        // when the field can be generated straight from the outline.
+        if (origGlyph.fMaskFormat == SkMask::kSDF_Format &&
+            this->internalGetSDFFromPath(tmpGlyph, origGlyph)) {
+            return;
+        }
+#endif
+
         // Use the origGlyph storage for the temporary unfiltered mask if it will fit.
         if (tmpGlyph.fMaskFormat == origGlyph.fMaskFormat &&
             tmpGlyph.imageSize() <= origGlyph.imageSize())
@@ -690,6 +742,24 @@ void SkScalerContext::getImage(const SkGlyph& origGlyph) {
     }
 }
 
+void SkScalerContext::getImages(SkSpan<const SkGlyph*> glyphs) {
+    // Mask filters and path styling need the full per-glyph pipeline; only hand ports a run of
+    // plain mask glyphs to rasterize in one backend batch.
+    if (fMaskFilter != nullptr || fGenerateImageFromPath) {
+        for (const SkGlyph* glyph : glyphs) {
+            this->getImage(*glyph);
+        }
+        return;
+    }
+    this->generateImages(glyphs);
+}
+
+void SkScalerContext::generateImages(SkSpan<const SkGlyph*> glyphs) {
+    for (const SkGlyph* glyph : glyphs) {
+        this->generateImage(*glyph);
+    }
+}
+
 bool SkScalerContext::getPath(SkPackedGlyphID glyphID, SkPath* path) {
     return this->internalGetPath(glyphID, path);
 }
@@ -15,6 +15,7 @@
 #include "include/core/SkMaskFilter.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkSpan.h"
 #include "include/core/SkTypeface.h"
 #include "include/private/SkMacros.h"
 #include "src/core/SkGlyph.h"
@@ -285,7 +286,19 @@ public:
     bool isVertical() const { return false; }
 
     SkGlyph     makeGlyph(SkPackedGlyphID);
+
+    // Make every glyph in the span, each already constructed with the packed ID to
+    // produce. Equivalent to makeGlyph on each, but lets a whole run cross the
+    // virtual-call boundary at once so ports can batch their backend work beneath it.
+    void        makeGlyphs(SkSpan<SkGlyph*>);
+
     void        getImage(const SkGlyph&);
+
+    // Fill the images of every glyph in the span, each already measured and holding allocated
+    // image storage. Equivalent to getImage on each, but lets a whole run cross the virtual-call
+    // boundary at once so ports can rasterize it with a single backend request.
+    void        getImages(SkSpan<const SkGlyph*>);
+
     bool SK_WARN_UNUSED_RESULT getPath(SkPackedGlyphID, SkPath*);
     void        getFontMetrics(SkFontMetrics*);
 
@@ -383,6 +396,13 @@ protected:
      */
     virtual void generateImage(const SkGlyph& glyph) = 0;
 
+    /** Generates the contents of every glyph image in the span, under the same contract as
+     *  generateImage. The default implementation renders each glyph individually; ports whose
+     *  backend can rasterize a whole run more cheaply than its glyphs one at a time may
+     *  override. Only called for plain mask glyphs (no mask filter or path styling applied).
+     */
+    virtual void generateImages(SkSpan<const SkGlyph*> glyphs);
+
     /** Sets the passed path to the glyph outline.
      *  If this cannot be done the path is set to empty;
      *  @return false if this glyph does not have any path.
@@ -416,6 +436,12 @@ private:
     /** Returns false if the glyph has no path at all. */
     bool internalGetPath(SkPackedGlyphID id, SkPath* devPath);
     SkGlyph internalMakeGlyph(SkPackedGlyphID packedID, SkMask::Format format);
+#if SK_SUPPORT_GPU
+    /** Generates origGlyph's distance field directly from the glyph outline, bypassing the
+        A8 rasterization the SDF mask filter would otherwise start from. Returns false if the
+        glyph has no usable path; the caller then falls back to the raster pipeline. */
+    bool internalGetSDFFromPath(const SkGlyph& unfilteredGlyph, const SkGlyph& origGlyph);
+#endif
 
     // SkMaskGamma::PreBlend converts linear masks to gamma correcting masks.
 protected:
@@ -5,6 +5,7 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkData.h"
 #include "include/core/SkPath.h"
 #include "include/core/SkRegion.h"
 #include "include/private/SkMacros.h"
@@ -17,6 +18,7 @@
 #include "src/core/SkQuadClipper.h"
 #include "src/core/SkRasterClip.h"
 #include "src/core/SkRectPriv.h"
+#include "src/core/SkResourceCache.h"
 #include "src/core/SkScanPriv.h"
 #include "src/core/SkTSort.h"
 
@@ -391,6 +393,80 @@ static SkEdge* sort_edges(SkEdge* list[], int count, SkEdge** last) {
     return list[0];
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+static unsigned gCachedEdgesNamespaceLabel;
+
+// Only complex paths amortize the cost of snapshotting and copying the edge
+// list; simple ones rebuild about as fast as they copy.
+static constexpr int kMinVerbsForCachedEdges = 16;
+
+static size_t edge_size(const SkEdge* edge) {
+    if (edge->fCurveCount > 0) {
+        return sizeof(SkQuadraticEdge);
+    }
+    if (edge->fCurveCount < 0) {
+        return sizeof(SkCubicEdge);
+    }
+    return sizeof(SkEdge);
+}
+
+struct CachedEdgesKey : public SkResourceCache::Key {
+    CachedEdgesKey(uint32_t genID, int32_t shift) : fGenID(genID), fShift(shift) {
+        this->init(&gCachedEdgesNamespaceLabel, 0, sizeof(fGenID) + sizeof(fShift));
+    }
+    uint32_t fGenID;
+    int32_t  fShift;
+};
+
+struct CachedEdgesRec : public SkResourceCache::Rec {
+    CachedEdgesRec(const CachedEdgesKey& key, sk_sp<SkData> edges, int count)
+        : fKey(key), fEdges(std::move(edges)), fCount(count) {}
+
+    const CachedEdgesKey fKey;
+    const sk_sp<SkData>  fEdges;
+    const int            fCount;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override { return sizeof(*this) + fEdges->size(); }
+    const char* getCategory() const override { return "path-edges"; }
+
+    struct HitData {
+        sk_sp<SkData> fEdges;
+        int           fCount;
+    };
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextData) {
+        const CachedEdgesRec& rec = static_cast<const CachedEdgesRec&>(baseRec);
+        HitData* result = static_cast<HitData*>(contextData);
+        result->fEdges = rec.fEdges;
+        result->fCount = rec.fCount;
+        return true;
+    }
+};
+
+}  // namespace
+
+// Snapshot the built (unsorted, unwalked) edges into one contiguous blob. The
+// walkers mutate edges in place, so a cache hit copies the blob back out into
+// scratch storage rather than walking the cached edges directly.
+static sk_sp<SkData> snapshot_edges(SkEdge* const list[], int count) {
+    size_t size = 0;
+    for (int i = 0; i < count; ++i) {
+        size += edge_size(list[i]);
+    }
+    sk_sp<SkData> data = SkData::MakeUninitialized(size);
+    char* p = static_cast<char*>(data->writable_data());
+    for (int i = 0; i < count; ++i) {
+        const size_t bytes = edge_size(list[i]);
+        memcpy(p, list[i], bytes);
+        p += bytes;
+    }
+    return data;
+}
+
 // clipRect has not been shifted up
 void sk_fill_path(const SkPath& path, const SkIRect& clipRect, SkBlitter* blitter,
                   int start_y, int stop_y, int shiftEdgesUp, bool pathContainedInClip) {
@@ -403,8 +479,38 @@ void sk_fill_path(const SkPath& path, const SkIRect& clipRect, SkBlitter* blitte
     shiftedClip.fBottom = SkLeftShift(shiftedClip.fBottom, shiftEdgesUp);
 
     SkBasicEdgeBuilder builder(shiftEdgesUp);
-    int count = builder.buildEdges(path, pathContainedInClip ? nullptr : &shiftedClip);
-    SkEdge** list = builder.edgeList();
+    int count;
+    SkEdge** list;
+    SkAutoTMalloc<char>    hitStorage;
+    SkAutoTMalloc<SkEdge*> hitList;
+
+    // Edges built against the clip depend on it and can't be reused. Callers
+    // opt paths out of the cache by marking them volatile, mirroring the other
+    // genID-keyed caches.
+    const bool cacheable = pathContainedInClip && !path.isVolatile() &&
+                           path.countVerbs() >= kMinVerbsForCachedEdges;
+    CachedEdgesRec::HitData hit;
+    if (cacheable && SkResourceCache::Find(CachedEdgesKey(path.getGenerationID(), shiftEdgesUp),
+                                           CachedEdgesRec::Visitor, &hit)) {
+        count = hit.fCount;
+        hitStorage.reset(hit.fEdges->size());
+        memcpy(hitStorage.get(), hit.fEdges->data(), hit.fEdges->size());
+        hitList.reset(count);
+        char* p = hitStorage.get();
+        for (int i = 0; i < count; ++i) {
+            hitList[i] = reinterpret_cast<SkEdge*>(p);
+            p += edge_size(hitList[i]);
+        }
+        list = hitList.get();
+    } else {
+        count = builder.buildEdges(path, pathContainedInClip ? nullptr : &shiftedClip);
+        list = builder.edgeList();
+        if (cacheable && count > 0) {
+            SkResourceCache::Add(new CachedEdgesRec(
+                    CachedEdgesKey(path.getGenerationID(), shiftEdgesUp),
+                    snapshot_edges(list, count), count));
+        }
+    }
 
     if (0 == count) {
         if (path.isInverseFillType()) {
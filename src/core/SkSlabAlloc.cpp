@@ -0,0 +1,151 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkSlabAlloc.h"
+
+#include "include/private/SkSpinlock.h"
+#include "include/private/SkTo.h"
+#include "src/core/SkMathPriv.h"
+
+#include <atomic>
+#include <new>
+
+static std::atomic<SkSlabAllocBackend*> gBackend{nullptr};
+
+static std::atomic<size_t> gSlabsInUse{0};
+static std::atomic<size_t> gBytesInUse{0};
+
+// The pool threads free lists through the slab storage itself, bucketed by log2(size). Within a
+// bucket only exact-size matches are served, so every slab is eventually released to the backend
+// with the same size it was allocated with.
+namespace {
+struct PooledSlab {
+    PooledSlab* fNext;
+    size_t      fSize;
+};
+}  // namespace
+
+static constexpr int kPoolBuckets = 32;
+
+static SkSpinlock  gPoolLock;
+static PooledSlab* gPool[kPoolBuckets] SK_GUARDED_BY(gPoolLock) = {};
+static size_t      gPooledBytes        SK_GUARDED_BY(gPoolLock) = 0;
+static size_t      gPooledSlabs        SK_GUARDED_BY(gPoolLock) = 0;
+
+// Read without the lock on the hot paths; 0 cheaply disables pooling entirely.
+static std::atomic<size_t> gPoolBudget{0};
+
+static bool pool_eligible(size_t size) {
+    return size >= sizeof(PooledSlab) && SkTFitsIn<uint32_t>(size);
+}
+
+static void* pool_take(size_t size) {
+    if (gPoolBudget.load(std::memory_order_relaxed) == 0 || !pool_eligible(size)) {
+        return nullptr;
+    }
+    SkAutoSpinlock lock{gPoolLock};
+    for (PooledSlab** link = &gPool[SkPrevLog2(SkTo<uint32_t>(size))]; *link;
+         link = &(*link)->fNext) {
+        if ((*link)->fSize == size) {
+            PooledSlab* slab = *link;
+            *link = slab->fNext;
+            gPooledBytes -= size;
+            gPooledSlabs -= 1;
+            return slab;
+        }
+    }
+    return nullptr;
+}
+
+static bool pool_put(void* slab, size_t size) {
+    const size_t budget = gPoolBudget.load(std::memory_order_relaxed);
+    if (budget == 0 || !pool_eligible(size)) {
+        return false;
+    }
+    SkAutoSpinlock lock{gPoolLock};
+    if (gPooledBytes + size > budget) {
+        return false;
+    }
+    PooledSlab* node = static_cast<PooledSlab*>(slab);
+    node->fSize = size;
+    int bucket = SkPrevLog2(SkTo<uint32_t>(size));
+    node->fNext = gPool[bucket];
+    gPool[bucket] = node;
+    gPooledBytes += size;
+    gPooledSlabs += 1;
+    return true;
+}
+
+static void free_to_backend(void* slab, size_t size) {
+    if (SkSlabAllocBackend* backend = gBackend.load(std::memory_order_acquire)) {
+        backend->freeSlab(slab, size);
+    } else {
+        operator delete(slab);
+    }
+}
+
+void SkSetSlabPoolBudget(size_t bytes) {
+    gPoolBudget.store(bytes, std::memory_order_relaxed);
+
+    // Trim anything already pooled beyond the new budget, releasing the biggest slabs first.
+    // Freeing happens outside the lock so a slow backend doesn't stall concurrent allocators.
+    PooledSlab* purged = nullptr;
+    {
+        SkAutoSpinlock lock{gPoolLock};
+        for (int bucket = kPoolBuckets - 1; bucket >= 0 && gPooledBytes > bytes; --bucket) {
+            while (PooledSlab* slab = gPool[bucket]) {
+                gPool[bucket] = slab->fNext;
+                gPooledBytes -= slab->fSize;
+                gPooledSlabs -= 1;
+                slab->fNext = purged;
+                purged = slab;
+                if (gPooledBytes <= bytes) {
+                    break;
+                }
+            }
+        }
+    }
+    while (purged) {
+        PooledSlab* next = purged->fNext;
+        free_to_backend(purged, purged->fSize);
+        purged = next;
+    }
+}
+
+SkSlabAllocBackend* SkSetSlabAllocBackend(SkSlabAllocBackend* backend) {
+    return gBackend.exchange(backend, std::memory_order_acq_rel);
+}
+
+void SkGetSlabAllocStats(SkSlabAllocStats* stats) {
+    stats->fSlabsInUse = gSlabsInUse.load(std::memory_order_relaxed);
+    stats->fBytesInUse = gBytesInUse.load(std::memory_order_relaxed);
+    SkAutoSpinlock lock{gPoolLock};
+    stats->fPooledSlabs = gPooledSlabs;
+    stats->fPooledBytes = gPooledBytes;
+}
+
+void* sk_slab_alloc(size_t size) {
+    void* slab = pool_take(size);
+    if (!slab) {
+        if (SkSlabAllocBackend* backend = gBackend.load(std::memory_order_acquire)) {
+            slab = backend->allocSlab(size);
+        } else {
+            slab = operator new(size);
+        }
+    }
+    gSlabsInUse.fetch_add(1, std::memory_order_relaxed);
+    gBytesInUse.fetch_add(size, std::memory_order_relaxed);
+    return slab;
+}
+
+void sk_slab_free(void* slab, size_t size) {
+    gSlabsInUse.fetch_sub(1, std::memory_order_relaxed);
+    gBytesInUse.fetch_sub(size, std::memory_order_relaxed);
+    if (!pool_put(slab, size)) {
+        free_to_backend(slab, size);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkSlabAlloc_DEFINED
+#define SkSlabAlloc_DEFINED
+
+#include "include/core/SkTypes.h"
+
+/**
+ *  Backend interface for the slab-style blocks backing SkArenaAlloc and GrBlockAllocator.
+ *
+ *  By default slabs come from the global operator new. Embedders can install a custom backend to
+ *  serve them from special memory instead — e.g. 2MB huge-page mappings to cut TLB pressure, or
+ *  NUMA-pinned regions on multi-socket servers. allocSlab() is always invoked on the thread that
+ *  needs the slab, so a backend can pin to the calling thread's NUMA node.
+ *
+ *  Install the backend once at startup, before any Skia objects are created: slabs are freed
+ *  through whichever backend is current, so swapping backends with slabs outstanding will
+ *  mismatch alloc/free pairs.
+ */
+class SkSlabAllocBackend {
+public:
+    virtual ~SkSlabAllocBackend() = default;
+
+    // Must return storage suitably aligned for any object, like operator new. 'size' is the same
+    // value later passed to freeSlab() for this slab.
+    virtual void* allocSlab(size_t size) = 0;
+    virtual void freeSlab(void* slab, size_t size) = 0;
+};
+
+// Installs the process-wide backend; nullptr restores the default. Returns the previous backend.
+// Purge the slab pool (budget 0) before swapping backends with slabs pooled, for the same
+// alloc/free pairing reason as above.
+SkSlabAllocBackend* SkSetSlabAllocBackend(SkSlabAllocBackend*);
+
+/**
+ *  Sets the byte budget of the process-wide slab pool (default 0, disabled).
+ *
+ *  With a non-zero budget, sk_slab_free() donates slabs to size-bucketed free lists instead of
+ *  returning them to the backend, and sk_slab_alloc() serves same-sized requests from those lists.
+ *  The pool is shared by every allocator that draws from this file — in particular the
+ *  GrBlockAllocator and GrSubRunAllocator instances behind each GrRecordingContext — so the block
+ *  chains torn down when one recording finishes are recycled wholesale into the next one, rather
+ *  than round-tripping through the heap. Shrinking the budget (including to zero) frees pooled
+ *  slabs back to the backend immediately.
+ */
+void SkSetSlabPoolBudget(size_t bytes);
+
+struct SkSlabAllocStats {
+    size_t fSlabsInUse;
+    size_t fBytesInUse;
+    size_t fPooledSlabs;
+    size_t fPooledBytes;
+};
+
+// Reports the slabs (and bytes) currently outstanding across all arenas and pools, regardless of
+// which backend produced them.
+void SkGetSlabAllocStats(SkSlabAllocStats*);
+
+// Internal entry points used by the allocators; all slab traffic must go through these so the
+// stats and the installed backend stay consistent.
+void* sk_slab_alloc(size_t size);
+void sk_slab_free(void* slab, size_t size);
+
+#endif  // SkSlabAlloc_DEFINED
@@ -287,6 +287,7 @@ SkMemoryStream::SkMemoryStream(size_t size) {
 SkMemoryStream::SkMemoryStream(const void* src, size_t size, bool copyData) {
     fData = newFromParams(src, size, copyData);
     fOffset = 0;
+    fDataIsDurable = copyData;
 }
 
 SkMemoryStream::SkMemoryStream(sk_sp<SkData> data) : fData(std::move(data)) {
@@ -311,11 +312,13 @@ std::unique_ptr<SkMemoryStream> SkMemoryStream::Make(sk_sp<SkData> data) {
 void SkMemoryStream::setMemoryOwned(const void* src, size_t size) {
     fData = SkData::MakeFromMalloc(src, size);
     fOffset = 0;
+    fDataIsDurable = true;
 }
 
 void SkMemoryStream::setMemory(const void* src, size_t size, bool copyData) {
     fData = newFromParams(src, size, copyData);
     fOffset = 0;
+    fDataIsDurable = copyData;
 }
 
 void SkMemoryStream::setData(sk_sp<SkData> data) {
@@ -325,6 +328,7 @@ void SkMemoryStream::setData(sk_sp<SkData> data) {
         fData = data;
     }
     fOffset = 0;
+    fDataIsDurable = true;
 }
 
 void SkMemoryStream::skipToAlign4() {
@@ -397,6 +401,16 @@ const void* SkMemoryStream::getMemoryBase() {
     return fData->data();
 }
 
+sk_sp<SkData> SkMemoryStream::peekData() const {
+    if (!fDataIsDurable) {
+        return nullptr;
+    }
+    if (fOffset == 0) {
+        return fData;
+    }
+    return SkData::MakeSubset(fData.get(), fOffset, fData->size() - fOffset);
+}
+
 const void* SkMemoryStream::getAtPos() {
     return fData->bytes() + fOffset;
 }
@@ -13,10 +13,12 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTraceMemoryDump.h"
 #include "include/core/SkTypeface.h"
+#include "include/private/SkMallocTag.h"
 #include "include/private/SkMutex.h"
 #include "include/private/SkTemplates.h"
 #include "src/core/SkGlyphRunPainter.h"
 #include "src/core/SkScalerCache.h"
+#include "src/core/SkTraceEvent.h"
 
 bool gSkUseThreadLocalStrikeCaches_IAcknowledgeThisIsIncrediblyExperimental = false;
 
@@ -34,10 +36,24 @@ SkStrikeCache* SkStrikeCache::GlobalStrikeCache() {
 auto SkStrikeCache::findOrCreateStrike(const SkDescriptor& desc,
                                        const SkScalerContextEffects& effects,
                                        const SkTypeface& typeface) -> sk_sp<Strike> {
+    SkAutoMallocTag autoTag(SkMallocTag::kText);
+    // The hit path holds fLock only for the hash lookup and LRU bump; nothing grew, so
+    // there is no need to run the purge check while other lookups wait on the lock.
+    {
+        SkAutoMutexExclusive ac(fLock);
+        if (sk_sp<Strike> strike = this->internalFindStrikeOrNull(desc)) {
+            return strike;
+        }
+    }
+
+    // Creating the scaler context calls into the font backend and can be slow; keep it
+    // outside fLock so it doesn't serialize concurrent lookups of unrelated strikes.
+    std::unique_ptr<SkScalerContext> scaler = typeface.createScalerContext(effects, &desc);
+
     SkAutoMutexExclusive ac(fLock);
+    // Another thread may have created this strike while the lock was dropped.
     sk_sp<Strike> strike = this->internalFindStrikeOrNull(desc);
     if (strike == nullptr) {
-        auto scaler = typeface.createScalerContext(effects, &desc);
         strike = this->internalCreateStrike(desc, std::move(scaler));
     }
     this->internalPurge();
@@ -177,6 +193,11 @@ void SkStrikeCache::purgeAll() {
     this->internalPurge(fTotalMemoryUsed);
 }
 
+size_t SkStrikeCache::purgePartial(size_t bytesToPurge) {
+    SkAutoMutexExclusive ac(fLock);
+    return this->internalPurgePartial(bytesToPurge);
+}
+
 size_t SkStrikeCache::getTotalMemoryUsed() const {
     SkAutoMutexExclusive ac(fLock);
     return fTotalMemoryUsed;
@@ -282,6 +303,28 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded) {
     return bytesFreed;
 }
 
+size_t SkStrikeCache::internalPurgePartial(size_t bytesToPurge) {
+    size_t  bytesFreed = 0;
+
+    // The list is in LRU order with unimportant entries at the tail, so stopping early leaves
+    // it in a state the next call picks up from.
+    Strike* strike = fTail;
+    while (strike != nullptr && bytesFreed < bytesToPurge) {
+        Strike* prev = strike->fPrev;
+
+        // Only delete if the strike is not pinned.
+        if (strike->fPinner == nullptr || strike->fPinner->canDelete()) {
+            bytesFreed += strike->fMemoryUsed;
+            this->internalRemoveStrike(strike);
+        }
+        strike = prev;
+    }
+
+    this->validate();
+
+    return bytesFreed;
+}
+
 void SkStrikeCache::internalAttachToHead(sk_sp<Strike> strike) {
     SkASSERT(fStrikeLookup.find(strike->getDescriptor()) == nullptr);
     Strike* strikePtr = strike.get();
@@ -290,6 +333,7 @@ void SkStrikeCache::internalAttachToHead(sk_sp<Strike> strike) {
 
     fCacheCount += 1;
     fTotalMemoryUsed += strikePtr->fMemoryUsed;
+    TRACE_COUNTER1("skia.cache", "skia strike cache", fTotalMemoryUsed);
 
     if (fHead != nullptr) {
         fHead->fPrev = strikePtr;
@@ -307,6 +351,7 @@ void SkStrikeCache::internalRemoveStrike(Strike* strike) {
     SkASSERT(fCacheCount > 0);
     fCacheCount -= 1;
     fTotalMemoryUsed -= strike->fMemoryUsed;
+    TRACE_COUNTER1("skia.cache", "skia strike cache", fTotalMemoryUsed);
 
     if (strike->fPrev) {
         strike->fPrev->fNext = strike->fNext;
@@ -354,6 +399,7 @@ void SkStrikeCache::Strike::updateDelta(size_t increase) {
         fMemoryUsed += increase;
         if (!fRemoved) {
             fStrikeCache->fTotalMemoryUsed += increase;
+            TRACE_COUNTER1("skia.cache", "skia strike cache", fStrikeCache->fTotalMemoryUsed);
         }
     }
 }
@@ -81,6 +81,11 @@ public:
             return glyphs;
         }
 
+        void getAdvances(SkSpan<const SkGlyphID> glyphIDs, SkScalar advances[]) {
+            size_t increase = fScalerCache.getAdvances(glyphIDs, advances);
+            this->updateDelta(increase);
+        }
+
         SkSpan<const SkGlyph*> preparePaths(SkSpan<const SkGlyphID> glyphIDs,
                                             const SkGlyph* results[]) {
             auto [glyphs, increase] = fScalerCache.preparePaths(glyphIDs, results);
@@ -170,6 +175,11 @@ public:
 
     void purgeAll() SK_EXCLUDES(fLock); // does not change budget
 
+    // Evicts, least-recently used first, at most bytesToPurge bytes and returns the number of
+    // bytes freed. Stopping early leaves the LRU list in a state the next call resumes from, so
+    // a full purge can be split into steps with bounded lock hold times. Does not change budget.
+    size_t purgePartial(size_t bytesToPurge) SK_EXCLUDES(fLock);
+
     int getCacheCountLimit() const SK_EXCLUDES(fLock);
     int setCacheCountLimit(int limit) SK_EXCLUDES(fLock);
     int getCacheCountUsed() const SK_EXCLUDES(fLock);
@@ -194,6 +204,7 @@ private:
     // and attempt to purge caches to match.
     // Returns number of bytes freed.
     size_t internalPurge(size_t minBytesNeeded = 0) SK_REQUIRES(fLock);
+    size_t internalPurgePartial(size_t bytesToPurge) SK_REQUIRES(fLock);
 
     // A simple accounting of what each glyph cache reports and the strike cache total.
     void validate() const SK_REQUIRES(fLock);
@@ -231,6 +231,13 @@ const SkGlyph* SkBulkGlyphMetrics::glyph(SkGlyphID glyphID) {
     return this->glyphs(SkSpan<const SkGlyphID>{&glyphID, 1})[0];
 }
 
+SkBulkGlyphAdvances::SkBulkGlyphAdvances(const SkStrikeSpec& spec)
+    : fStrike{spec.findOrCreateStrike()} { }
+
+void SkBulkGlyphAdvances::advances(SkSpan<const SkGlyphID> glyphIDs, SkScalar advances[]) {
+    fStrike->getAdvances(glyphIDs, advances);
+}
+
 SkBulkGlyphMetricsAndPaths::SkBulkGlyphMetricsAndPaths(const SkStrikeSpec& spec)
     : fStrike{spec.findOrCreateStrike()} { }
 
@@ -119,6 +119,17 @@ private:
     sk_sp<SkStrike> fStrike;
 };
 
+// Advance-only lookups served from the strike's flat advance table; cheaper than full metrics
+// when only measurement is needed.
+class SkBulkGlyphAdvances {
+public:
+    explicit SkBulkGlyphAdvances(const SkStrikeSpec& spec);
+    void advances(SkSpan<const SkGlyphID> glyphIDs, SkScalar advances[]);
+
+private:
+    sk_sp<SkStrike> fStrike;
+};
+
 class SkBulkGlyphMetricsAndPaths {
 public:
     explicit SkBulkGlyphMetricsAndPaths(const SkStrikeSpec& spec);
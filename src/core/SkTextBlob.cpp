@@ -72,6 +72,7 @@ namespace {
 struct RunRecordStorageEquivalent {
     SkFont   fFont;
     SkPoint  fOffset;
+    SkRect   fBounds;
     uint32_t fCount;
     uint32_t fFlags;
     SkDEBUGCODE(unsigned fMagic;)
@@ -207,6 +208,47 @@ void* SkTextBlob::operator new(size_t, void* p) {
     return p;
 }
 
+bool SkTextBlob::replaceGlyphs(const SkGlyphID glyphs[], int count) {
+    // Mutation is only sound when no one else can observe it.
+    if (!this->unique()) {
+        return false;
+    }
+
+    int total = 0;
+    for (const auto* run = RunRecord::First(this); run; run = RunRecord::Next(run)) {
+        total += run->glyphCount();
+    }
+    if (total != count) {
+        return false;
+    }
+
+    SkRect bounds = SkRect::MakeEmpty();
+    for (const auto* run = RunRecord::First(this); run; run = RunRecord::Next(run)) {
+        memcpy(run->glyphBuffer(), glyphs, run->glyphCount() * sizeof(SkGlyphID));
+        glyphs += run->glyphCount();
+
+        // Same per-run bounds policy as SkTextBlobBuilder::updateDeferredBounds().
+        SkRect runBounds = kDefault_Positioning == run->positioning()
+                                   ? SkTextBlobBuilder::TightRunBounds(*run)
+                                   : SkTextBlobBuilder::ConservativeRunBounds(*run);
+        const_cast<RunRecord*>(run)->setBounds(runBounds);
+        bounds.join(runBounds);
+    }
+    fBounds = bounds;
+
+    // The content changed, so this is logically a new blob: issue a fresh uniqueID and
+    // drop any cache entries keyed to the old one.
+#if SK_SUPPORT_GPU
+    if (SK_InvalidUniqueID != fCacheID.load()) {
+        GrTextBlobCache::PostPurgeBlobMessage(fUniqueID, fCacheID);
+        fCacheID.store(SK_InvalidUniqueID);
+    }
+#endif
+    fUniqueID = next_id();
+
+    return true;
+}
+
 SkTextBlobRunIterator::SkTextBlobRunIterator(const SkTextBlob* blob)
     : fCurrentRun(SkTextBlob::RunRecord::First(blob)) {
     SkDEBUGCODE(fStorageTop = (uint8_t*)blob + blob->fStorageSize;)
@@ -384,6 +426,7 @@ void SkTextBlobBuilder::updateDeferredBounds() {
     // FIXME: we should also use conservative bounds for kDefault_Positioning.
     SkRect runBounds = SkTextBlob::kDefault_Positioning == run->positioning() ?
                        TightRunBounds(*run) : ConservativeRunBounds(*run);
+    run->joinBounds(runBounds);
     fBounds.join(runBounds);
     fDeferredBounds = false;
 }
@@ -516,6 +559,10 @@ void SkTextBlobBuilder::allocInternal(const SkFont& font,
     if (!fDeferredBounds) {
         if (bounds) {
             fBounds.join(*bounds);
+            SkASSERT(fLastRun >= SkAlignPtr(sizeof(SkTextBlob)));
+            SkTextBlob::RunRecord* run =
+                    reinterpret_cast<SkTextBlob::RunRecord*>(fStorage.get() + fLastRun);
+            run->joinBounds(*bounds);
         } else {
             fDeferredBounds = true;
         }
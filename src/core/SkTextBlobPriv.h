@@ -67,6 +67,7 @@ public:
             : fFont(font)
             , fCount(count)
             , fOffset(offset)
+            , fBounds(SkRect::MakeEmpty())
             , fFlags(pos) {
         SkASSERT(static_cast<unsigned>(pos) <= Flags::kPositioning_Mask);
 
@@ -85,6 +86,12 @@ public:
         return fOffset;
     }
 
+    // Conservative bounds of this run in blob space, cached by SkTextBlobBuilder so draws
+    // can cull clipped-out runs before any glyph processing.
+    const SkRect& bounds() const {
+        return fBounds;
+    }
+
     const SkFont& font() const {
         return fFont;
     }
@@ -144,6 +151,7 @@ public:
     void validate(const uint8_t* storageTop) const;
 
 private:
+    friend class SkTextBlob;        // for replaceGlyphs() to refresh fBounds
     friend class SkTextBlobBuilder;
 
     enum Flags {
@@ -166,9 +174,18 @@ private:
         return fFlags & kExtended_Flag;
     }
 
+    void joinBounds(const SkRect& bounds) {
+        fBounds.join(bounds);
+    }
+
+    void setBounds(const SkRect& bounds) {
+        fBounds = bounds;
+    }
+
     SkFont           fFont;
     uint32_t         fCount;
     SkPoint          fOffset;
+    SkRect           fBounds;
     uint32_t         fFlags;
 
     SkDEBUGCODE(unsigned fMagic;)
@@ -220,6 +237,10 @@ public:
         SkASSERT(!this->done());
         return fCurrentRun->offset();
     }
+    const SkRect& bounds() const {
+        SkASSERT(!this->done());
+        return fCurrentRun->bounds();
+    }
     const SkFont& font() const {
         SkASSERT(!this->done());
         return fCurrentRun->font();
@@ -282,10 +282,14 @@ namespace skvm {
             case Op::sub_i32: write(o, V{id}, "=", op, V{x}, V{y}); break;
             case Op::mul_i32: write(o, V{id}, "=", op, V{x}, V{y}); break;
 
+            case Op::mul_hi_u32: write(o, V{id}, "=", op, V{x}, V{y}); break;
+
             case Op::shl_i32: write(o, V{id}, "=", op, V{x}, Shift{immA}); break;
             case Op::shr_i32: write(o, V{id}, "=", op, V{x}, Shift{immA}); break;
             case Op::sra_i32: write(o, V{id}, "=", op, V{x}, Shift{immA}); break;
 
+            case Op::rotr_i32: write(o, V{id}, "=", op, V{x}, Shift{immA}); break;
+
             case Op::eq_i32: write(o, V{id}, "=", op, V{x}, V{y}); break;
             case Op::gt_i32: write(o, V{id}, "=", op, V{x}, V{y}); break;
 
@@ -394,10 +398,14 @@ namespace skvm {
                 case Op::sub_i32: write(o, R{d}, "=", op, R{x}, R{y}); break;
                 case Op::mul_i32: write(o, R{d}, "=", op, R{x}, R{y}); break;
 
+                case Op::mul_hi_u32: write(o, R{d}, "=", op, R{x}, R{y}); break;
+
                 case Op::shl_i32: write(o, R{d}, "=", op, R{x}, Shift{immA}); break;
                 case Op::shr_i32: write(o, R{d}, "=", op, R{x}, Shift{immA}); break;
                 case Op::sra_i32: write(o, R{d}, "=", op, R{x}, Shift{immA}); break;
 
+                case Op::rotr_i32: write(o, R{d}, "=", op, R{x}, Shift{immA}); break;
+
                 case Op::eq_i32: write(o, R{d}, "=", op, R{x}, R{y}); break;
                 case Op::gt_i32: write(o, R{d}, "=", op, R{x}, R{y}); break;
 
@@ -531,6 +539,67 @@ namespace skvm {
         return (uint64_t)lo | (uint64_t)hi << 32;
     }
 
+    // 's' 'k' 'v' 'm' followed by a version byte we bump on any layout change.
+    static const uint32_t kBuilderMagic = 0x736b766d,
+                          kBuilderVersion = 1;
+
+    static constexpr int kNumOps = 0
+    #define M(op) +1
+        SKVM_OPS(M)
+    #undef M
+    ;
+
+    void Builder::serialize(SkWStream* stream) const {
+        stream->write32(kBuilderMagic);
+        stream->write32(kBuilderVersion);
+        stream->write32(SkToU32(fStrides.size()));
+        stream->write32(SkToU32(fProgram.size()));
+        stream->write(fStrides.data(), fStrides.size() * sizeof(int));
+        stream->write(fProgram.data(), fProgram.size() * sizeof(Instruction));
+    }
+
+    bool Builder::Deserialize(SkStream* stream, Builder* dst) {
+        SkASSERT(dst && dst->fProgram.empty() && dst->fStrides.empty());
+
+        uint32_t magic, version, nstrides, ninsts;
+        if (!stream->readU32(&magic)   || magic   != kBuilderMagic
+         || !stream->readU32(&version) || version != kBuilderVersion
+         || !stream->readU32(&nstrides)
+         || !stream->readU32(&ninsts)) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < nstrides; i++) {
+            int32_t stride;
+            if (!stream->readS32(&stride)) {
+                return false;
+            }
+            (void)dst->arg(stride);
+        }
+
+        for (uint32_t i = 0; i < ninsts; i++) {
+            Instruction inst;
+            if (stream->read(&inst, sizeof(inst)) != sizeof(inst)) {
+                return false;
+            }
+            // Serialized streams are already CSE'd, so each push() appends,
+            // preserving instruction IDs; still, sanity-check the references.
+            const Val next = (Val)i;
+            if ((int)inst.op < 0 || (int)inst.op >= kNumOps) {
+                return false;
+            }
+            for (Val argument : {inst.x, inst.y, inst.z, inst.w}) {
+                if (argument != NA && (argument < 0 || argument >= next)) {
+                    return false;
+                }
+            }
+            if (dst->push(inst) != next) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     bool operator!=(Ptr a, Ptr b) { return a.ix != b.ix; }
 
     bool operator==(const Instruction& a, const Instruction& b) {
@@ -874,6 +943,14 @@ namespace skvm {
         if (this->isImm(y.id, 1)) { return x; }
         return {this, this->push(Op::mul_i32, x.id, y.id)};
     }
+    I32 Builder::mul_hi(I32 x, I32 y) {
+        if (int X,Y; this->allImm(x.id,&X, y.id,&Y)) {
+            return splat(int((uint64_t)(uint32_t)X * (uint32_t)Y >> 32));
+        }
+        if (this->isImm(x.id, 0)) { return splat(0); }
+        if (this->isImm(y.id, 0)) { return splat(0); }
+        return {this, this->push(Op::mul_hi_u32, x.id, y.id)};
+    }
 
     I32 Builder::shl(I32 x, int bits) {
         if (bits == 0) { return x; }
@@ -890,6 +967,14 @@ namespace skvm {
         if (int X; this->allImm(x.id,&X)) { return splat(X >> bits); }
         return {this, this->push(Op::sra_i32, x.id,NA,NA,NA, bits)};
     }
+    I32 Builder::rotr(I32 x, int bits) {
+        bits &= 31;
+        if (bits == 0) { return x; }
+        if (int X; this->allImm(x.id,&X)) {
+            return splat(int((uint32_t)X >> bits | (uint32_t)X << (32-bits)));
+        }
+        return {this, this->push(Op::rotr_i32, x.id,NA,NA,NA, bits)};
+    }
 
     I32 Builder:: eq(F32 x, F32 y) {
         if (float X,Y; this->allImm(x.id,&X, y.id,&Y)) { return splat(X==Y ? ~0 : 0); }
@@ -1870,6 +1955,8 @@ namespace skvm {
     void Assembler::vpackusdw(Ymm dst, Ymm x, Operand y) { this->op(0x66,0x380f,0x2b, dst,x,y); }
     void Assembler::vpackuswb(Ymm dst, Ymm x, Operand y) { this->op(0x66,  0x0f,0x67, dst,x,y); }
 
+    void Assembler::vpmuludq(Ymm dst, Ymm x, Operand y) { this->op(0x66,0x0f,0xf4, dst,x,y); }
+
     void Assembler::vpunpckldq(Ymm dst, Ymm x, Operand y) { this->op(0x66,0x0f,0x62, dst,x,y); }
     void Assembler::vpunpckhdq(Ymm dst, Ymm x, Operand y) { this->op(0x66,0x0f,0x6a, dst,x,y); }
 
@@ -1902,6 +1989,11 @@ namespace skvm {
         this->imm_byte_after_operand(y, z << 4);
     }
 
+    void Assembler::vpblendd(Ymm dst, Ymm x, Operand y, int imm) {
+        this->op(0x66,0x3a0f,0x02, dst,x,y);
+        this->imm_byte_after_operand(y, imm);
+    }
+
     // Shift instructions encode their opcode extension as "dst", dst as x, and x as y.
     void Assembler::vpslld(Ymm dst, Ymm x, int imm) {
         this->op(0x66,0x0f,0x72,(Ymm)6, dst,x);
@@ -1915,6 +2007,10 @@ namespace skvm {
         this->op(0x66,0x0f,0x72,(Ymm)4, dst,x);
         this->byte(imm);
     }
+    void Assembler::vpsrlq(Ymm dst, Ymm x, int imm) {
+        this->op(0x66,0x0f,0x73,(Ymm)2, dst,x);
+        this->byte(imm);
+    }
     void Assembler::vpsllw(Ymm dst, Ymm x, int imm) {
         this->op(0x66,0x0f,0x71,(Ymm)6, dst,x);
         this->byte(imm);
@@ -2144,6 +2240,9 @@ namespace skvm {
     void Assembler::sub4s(V d, V n, V m) { this->op(0b0'1'1'01110'10'1, m, 0b10000'1, n, d); }
     void Assembler::mul4s(V d, V n, V m) { this->op(0b0'1'0'01110'10'1, m, 0b10011'1, n, d); }
 
+    void Assembler::umull (V d, V n, V m) { this->op(0b0'0'1'01110'10'1, m, 0b1100'0'0, n, d); }
+    void Assembler::umull2(V d, V n, V m) { this->op(0b0'1'1'01110'10'1, m, 0b1100'0'0, n, d); }
+
     void Assembler::cmeq4s(V d, V n, V m) { this->op(0b0'1'1'01110'10'1, m, 0b10001'1, n, d); }
     void Assembler::cmgt4s(V d, V n, V m) { this->op(0b0'1'0'01110'10'1, m, 0b0011'0'1, n, d); }
 
@@ -2582,10 +2681,23 @@ namespace skvm {
                 case Op::sub_i32: vals[i] = b->CreateSub(vals[x], vals[y]); break;
                 case Op::mul_i32: vals[i] = b->CreateMul(vals[x], vals[y]); break;
 
+                case Op::mul_hi_u32: {
+                    llvm::Type* i64 = llvm::Type::getInt64Ty(*ctx),
+                              * I64 = scalar ? i64 : llvm::VectorType::get(i64, K);
+                    vals[i] = b->CreateTrunc(
+                                  b->CreateLShr(b->CreateMul(b->CreateZExt(vals[x], I64),
+                                                             b->CreateZExt(vals[y], I64)),
+                                                32),
+                                  I32);
+                } break;
+
                 case Op::shl_i32: vals[i] = b->CreateShl (vals[x], immA); break;
                 case Op::sra_i32: vals[i] = b->CreateAShr(vals[x], immA); break;
                 case Op::shr_i32: vals[i] = b->CreateLShr(vals[x], immA); break;
 
+                case Op::rotr_i32: vals[i] = b->CreateOr(b->CreateLShr(vals[x], immA),
+                                                         b->CreateShl (vals[x], 32-immA)); break;
+
                 case Op:: eq_i32: vals[i] = S(I32, b->CreateICmpEQ (vals[x], vals[y])); break;
                 case Op:: gt_i32: vals[i] = S(I32, b->CreateICmpSGT(vals[x], vals[y])); break;
 
@@ -3676,6 +3788,23 @@ namespace skvm {
                     else           { a->vpmulld(dst(y), r(y), any(x)); }
                                      break;
 
+                case Op::mul_hi_u32: {
+                    // vpmuludq forms 64-bit products of the even 32-bit lanes, so multiply the
+                    // even and odd lanes separately, then pick out the high halves of each.
+                    A::Ymm even = alloc_tmp(),
+                           odd  = alloc_tmp(),
+                           tmp  = alloc_tmp();
+                    a->vpmuludq(even, r(x), any(y));    // 64-bit products of lanes 0,2,4,6
+                    a->vpsrlq  (odd, r(x), 32);
+                    a->vpsrlq  (tmp, r(y), 32);
+                    a->vpmuludq(odd, odd, tmp);         // 64-bit products of lanes 1,3,5,7
+                    a->vpsrlq  (even, even, 32);        // high halves down into even lanes...
+                    a->vpblendd(dst(), even, odd, 0xaa);// ...and odd products' are already odd.
+                    free_tmp(even);
+                    free_tmp(odd);
+                    free_tmp(tmp);
+                } break;
+
                 case Op::sub_i32: a->vpsubd(dst(x), r(x), any(y)); break;
 
                 case Op::bit_and:
@@ -3702,6 +3831,14 @@ namespace skvm {
                 case Op::shr_i32: a->vpsrld(dst(x), r(x), immA); break;
                 case Op::sra_i32: a->vpsrad(dst(x), r(x), immA); break;
 
+                case Op::rotr_i32: {
+                    A::Ymm tmp = alloc_tmp();
+                    a->vpsrld(tmp, r(x), immA);
+                    a->vpslld(dst(x), r(x), 32-immA);
+                    a->vpor  (dst(), dst(), tmp);
+                    free_tmp(tmp);
+                } break;
+
                 case Op::eq_i32:
                     if (in_reg(x)) { a->vpcmpeqd(dst(x), r(x), any(y)); }
                     else           { a->vpcmpeqd(dst(y), r(y), any(x)); }
@@ -3959,6 +4096,16 @@ namespace skvm {
                 case Op::sub_i32: a->sub4s(dst(x,y), r(x), r(y)); break;
                 case Op::mul_i32: a->mul4s(dst(x,y), r(x), r(y)); break;
 
+                case Op::mul_hi_u32: {
+                    A::V lo = alloc_tmp(),
+                         hi = alloc_tmp();
+                    a->umull (lo, r(x), r(y));          // 64-bit products of lanes 0,1
+                    a->umull2(hi, r(x), r(y));          // 64-bit products of lanes 2,3
+                    a->uzp24s(dst(x,y), lo, hi);        // the odd 32-bit lanes are the highs
+                    free_tmp(lo);
+                    free_tmp(hi);
+                } break;
+
                 case Op::bit_and  : a->and16b(dst(x,y), r(x), r(y)); break;
                 case Op::bit_or   : a->orr16b(dst(x,y), r(x), r(y)); break;
                 case Op::bit_xor  : a->eor16b(dst(x,y), r(x), r(y)); break;
@@ -3986,6 +4133,14 @@ namespace skvm {
                 case Op::shr_i32: a->ushr4s(dst(x), r(x), immA); break;
                 case Op::sra_i32: a->sshr4s(dst(x), r(x), immA); break;
 
+                case Op::rotr_i32: {
+                    A::V tmp = alloc_tmp();
+                    a->ushr4s(tmp, r(x), immA);
+                    a->shl4s (dst(x), r(x), 32-immA);
+                    a->orr16b(dst(), dst(), tmp);
+                    free_tmp(tmp);
+                } break;
+
                 case Op::eq_i32: a->cmeq4s(dst(x,y), r(x), r(y)); break;
                 case Op::gt_i32: a->cmgt4s(dst(x,y), r(x), r(y)); break;
 
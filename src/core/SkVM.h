@@ -17,6 +17,7 @@
 #include "src/core/SkVM_fwd.h"
 #include <vector>      // std::vector
 
+class SkStream;
 class SkWStream;
 
 #if defined(SKVM_JIT_WHEN_POSSIBLE) && !defined(SK_BUILD_FOR_IOS)
@@ -128,6 +129,8 @@ namespace skvm {
         void vpsubd (Ymm dst, Ymm x, Operand y);
         void vpmulld(Ymm dst, Ymm x, Operand y);
 
+        void vpmuludq(Ymm dst, Ymm x, Operand y);
+
         void vpaddw   (Ymm dst, Ymm x, Operand y);
         void vpsubw   (Ymm dst, Ymm x, Operand y);
         void vpmullw  (Ymm dst, Ymm x, Operand y);
@@ -182,6 +185,7 @@ namespace skvm {
         void vpslld(Ymm dst, Ymm x, int imm);
         void vpsrld(Ymm dst, Ymm x, int imm);
         void vpsrad(Ymm dst, Ymm x, int imm);
+        void vpsrlq(Ymm dst, Ymm x, int imm);
 
         void vpsllw(Ymm dst, Ymm x, int imm);
         void vpsrlw(Ymm dst, Ymm x, int imm);
@@ -208,6 +212,7 @@ namespace skvm {
         void vcvtph2ps(Ymm dst, Operand x);
 
         void vpblendvb(Ymm dst, Ymm x, Operand y, Ymm z);
+        void vpblendd (Ymm dst, Ymm x, Operand y, int imm);
 
         void vpshufb(Ymm dst, Ymm x, Operand y);
 
@@ -280,6 +285,7 @@ namespace skvm {
         using DOpNM = void(V d, V n, V m);
         DOpNM  and16b, orr16b, eor16b, bic16b, bsl16b,
                add4s,  sub4s,  mul4s,
+               umull, umull2,   // d.2d = n.2s * m.2s (low halves / high halves of n.4s,m.4s)
               cmeq4s, cmgt4s,
                        sub8h,  mul8h,
               fadd4s, fsub4s, fmul4s, fdiv4s, fmin4s, fmax4s,
@@ -442,12 +448,12 @@ namespace skvm {
         M(splat)                                                     \
         M(add_f32) M(add_i32)                                        \
         M(sub_f32) M(sub_i32)                                        \
-        M(mul_f32) M(mul_i32)                                        \
+        M(mul_f32) M(mul_i32) M(mul_hi_u32)                          \
         M(div_f32)                                                   \
         M(min_f32) M(max_f32)                                        \
         M(fma_f32) M(fms_f32) M(fnma_f32)                            \
         M(sqrt_f32)                                                  \
-        M(shl_i32) M(shr_i32) M(sra_i32)                             \
+        M(shl_i32) M(shr_i32) M(sra_i32) M(rotr_i32)                 \
         M(ceil) M(floor) M(trunc) M(round) M(to_fp16) M(from_fp16)   \
         M(to_f32)                                                    \
         M(neq_f32) M(eq_f32) M(eq_i32)                               \
@@ -800,10 +806,18 @@ namespace skvm {
         I32 mul(I32 x, int y) { return mul(x, splat(y)); }
         I32 mul(int x, I32 y) { return mul(splat(x), y); }
 
+        // High 32 bits of the unsigned 64-bit product, the workhorse of integer hashes.
+        I32 mul_hi(I32, I32);
+        I32 mul_hi(I32 x, int y) { return mul_hi(x, splat(y)); }
+        I32 mul_hi(int x, I32 y) { return mul_hi(splat(x), y); }
+
         I32 shl(I32 x, int bits);
         I32 shr(I32 x, int bits);
         I32 sra(I32 x, int bits);
 
+        I32 rotr(I32 x, int bits);                                // rotate right
+        I32 rotl(I32 x, int bits) { return rotr(x, -bits & 31); } // rotate left
+
         I32 eq(I32, I32);
         I32 eq(I32 x, int y) { return eq(x, splat(y)); }
         I32 eq(int x, I32 y) { return eq(splat(x), y); }
@@ -909,6 +923,18 @@ namespace skvm {
 
         uint64_t hash() const;
 
+        // Write the builder's instruction and argument-stride streams so an
+        // identical program can be rebuilt (and re-JITted) in another process
+        // without re-running the front end that produced it. The stream is not
+        // machine code and carries no CPU-feature assumptions; key any on-disk
+        // cache by hash() plus the SkCpu features of the consuming process.
+        void serialize(SkWStream*) const;
+
+        // Replay a serialized builder into |dst|, which must be freshly
+        // constructed. Returns false (leaving |dst| unspecified) on a
+        // malformed stream.
+        static bool Deserialize(SkStream*, Builder* dst);
+
         Val push(Instruction);
 
         bool allImm() const { return true; }
@@ -1042,6 +1068,13 @@ namespace skvm {
     SI I32 max(I32 x, int y) { return x->max(x,y); }
     SI I32 max(int x, I32 y) { return y->max(x,y); }
 
+    SI I32 mul_hi(I32 x, I32 y) { return x->mul_hi(x,y); }
+    SI I32 mul_hi(I32 x, int y) { return x->mul_hi(x,y); }
+    SI I32 mul_hi(int x, I32 y) { return y->mul_hi(x,y); }
+
+    SI I32 rotr(I32 x, int bits) { return x->rotr(x,bits); }
+    SI I32 rotl(I32 x, int bits) { return x->rotl(x,bits); }
+
     SI I32 operator==(I32 x, I32 y) { return x->eq(x,y); }
     SI I32 operator==(I32 x, int y) { return x->eq(x,y); }
     SI I32 operator==(int x, I32 y) { return y->eq(x,y); }
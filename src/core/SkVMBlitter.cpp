@@ -417,7 +417,8 @@ namespace {
 
             skvm::Color c = p->load(fmt, p->arg(SkColorTypeBytesPerPixel(ct)));
 
-            return SkColorSpaceXformSteps{fSprite, dst}.program(p, uniforms, c);
+            return SkColorSpaceXformSteps{fSprite, dst}.program(p, uniforms, c,
+                                                                ct, dst.colorType());
         }
     };
 
@@ -706,6 +707,10 @@ namespace {
             return nullptr;
         }
 
+        // The blit programs are built lazily at blit time from fParams, which keeps a reference
+        // to the draw's SkMatrixProvider.
+        bool retainsMatrixProvider() const override { return true; }
+
         void blitH(int x, int y, int w) override {
             if (fBlitH.empty()) {
                 fBlitH = this->buildProgram(Coverage::Full);
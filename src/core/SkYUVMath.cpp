@@ -188,6 +188,20 @@ void SkColorMatrix_YUV2RGB(SkYUVColorSpace cs, float m[20]) {
     }
 }
 
+SkYUVtoRGBACoeffs SkYUVtoRGBACoeffs::Make(SkYUVColorSpace cs) {
+    float m[20];
+    SkColorMatrix_YUV2RGB(cs, m);
+    SkYUVtoRGBACoeffs coeffs;
+    for (int c = 0; c < 3; ++c) {
+        for (int i = 0; i < 3; ++i) {
+            coeffs.fCoeff[c][i] = SkScalarRoundToInt(m[5*c + i] * (1 << kFractionBits));
+        }
+        coeffs.fBias[c] = SkScalarRoundToInt(m[5*c + 4] * 255.f * (1 << kFractionBits))
+                        + (1 << (kFractionBits - 1));
+    }
+    return coeffs;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 // we just drop the alpha rol/col from the colormatrix
@@ -13,6 +13,20 @@
 void SkColorMatrix_RGB2YUV(SkYUVColorSpace, float m[20]);
 void SkColorMatrix_YUV2RGB(SkYUVColorSpace, float m[20]);
 
+// Fixed-point form of the SkColorMatrix_YUV2RGB matrix for converting 8-bit YUV to 8-bit RGB
+// in one fused pass; the limited/full range expansion is already folded into the matrix.
+// Consumed by the SkOpts::yuv_to_rgba_row kernels.
+struct SkYUVtoRGBACoeffs {
+    static constexpr int kFractionBits = 12;
+
+    // fCoeff[c] holds the Y/U/V contributions to output channel c (R, G, B). fBias[c] is the
+    // matrix translate term scaled to 0..255 units, with the rounding term folded in.
+    int32_t fCoeff[3][3];
+    int32_t fBias[3];
+
+    static SkYUVtoRGBACoeffs Make(SkYUVColorSpace);
+};
+
 // Used to create the pre-compiled tables in SkYUVMath.cpp
 void SkColorMatrix_DumpYUVMatrixTables();
 
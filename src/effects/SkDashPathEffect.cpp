@@ -10,6 +10,7 @@
 #include "include/core/SkStrokeRec.h"
 #include "include/private/SkTo.h"
 #include "src/core/SkReadBuffer.h"
+#include "src/core/SkResourceCache.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/effects/SkDashImpl.h"
 #include "src/utils/SkDashPathPriv.h"
@@ -39,8 +40,90 @@ SkDashImpl::~SkDashImpl() {
     sk_free(fIntervals);
 }
 
+namespace {
+static unsigned gDashedPathKeyNamespaceLabel;
+
+// Dashing flattens the source path with SkPathMeasure on every draw, which dominates the cost of
+// repeatedly drawn dashed geometry (e.g. route outlines). Cache the flattened result in the
+// global SkResourceCache, keyed on everything InternalFilter's output depends on. Patterns with
+// more than kMaxCachedIntervals intervals are rare and simply bypass the cache so the key can
+// stay fixed-size.
+struct DashedPathKey : public SkResourceCache::Key {
+public:
+    static constexpr int kMaxCachedIntervals = 8;
+
+    DashedPathKey(uint32_t srcGenID, const SkScalar intervals[], int32_t count, SkScalar phase,
+                  const SkStrokeRec& rec, const SkRect* cullRect) {
+        fSrcGenID = srcGenID;
+        fCount = count;
+        fPhase = phase;
+        SkASSERT(count <= kMaxCachedIntervals);
+        for (int i = 0; i < kMaxCachedIntervals; ++i) {
+            fIntervals[i] = i < count ? intervals[i] : 0;
+        }
+        fStyle = rec.getStyle();
+        fCap = rec.getCap();
+        fJoin = rec.getJoin();
+        fWidth = rec.getWidth();
+        fMiter = rec.getMiter();
+        fResScale = rec.getResScale();
+        fHasCull = SkToBool(cullRect);
+        fCull = cullRect ? *cullRect : SkRect::MakeEmpty();
+        this->init(&gDashedPathKeyNamespaceLabel, 0,
+                   sizeof(*this) - sizeof(SkResourceCache::Key));
+    }
+
+    uint32_t fSrcGenID;
+    int32_t  fCount;
+    SkScalar fPhase;
+    SkScalar fIntervals[kMaxCachedIntervals];
+    int32_t  fStyle;
+    int32_t  fCap;
+    int32_t  fJoin;
+    SkScalar fWidth;
+    SkScalar fMiter;
+    SkScalar fResScale;
+    int32_t  fHasCull;
+    SkRect   fCull;
+};
+
+struct DashedPathRec : public SkResourceCache::Rec {
+    DashedPathRec(const DashedPathKey& key, const SkPath& path) : fKey(key), fPath(path) {}
+
+    DashedPathKey fKey;
+    SkPath        fPath;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override { return sizeof(*this) + fPath.approximateBytesUsed(); }
+    const char* getCategory() const override { return "dashed-path"; }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextData) {
+        const DashedPathRec& rec = static_cast<const DashedPathRec&>(baseRec);
+        *static_cast<SkPath*>(contextData) = rec.fPath;
+        return true;
+    }
+};
+}  // namespace
+
 bool SkDashImpl::onFilterPath(SkPath* dst, const SkPath& src, SkStrokeRec* rec,
                               const SkRect* cullRect) const {
+    // Two-point lines take the SpecialLineRec path, which is cheap and rewrites *rec; volatile
+    // paths have told us they won't be drawn again. Neither is worth caching.
+    SkPoint linePts[2];
+    bool cacheable = !src.isVolatile() && !src.isLine(linePts) &&
+                     fCount <= DashedPathKey::kMaxCachedIntervals;
+    if (cacheable) {
+        DashedPathKey key(src.getGenerationID(), fIntervals, fCount, fPhase, *rec, cullRect);
+        if (SkResourceCache::Find(key, DashedPathRec::Visitor, dst)) {
+            return true;
+        }
+        if (SkDashPath::InternalFilter(dst, src, rec, cullRect, fIntervals, fCount,
+                                       fInitialDashLength, fInitialDashIndex, fIntervalLength)) {
+            SkResourceCache::Add(new DashedPathRec(key, *dst));
+            return true;
+        }
+        return false;
+    }
     return SkDashPath::InternalFilter(dst, src, rec, cullRect, fIntervals, fCount,
                                       fInitialDashLength, fInitialDashIndex, fIntervalLength);
 }
@@ -105,11 +105,14 @@ void SkBlendImageFilter::flatten(SkWriteBuffer& buffer) const {
 
 sk_sp<SkSpecialImage> SkBlendImageFilter::onFilterImage(const Context& ctx,
                                                         SkIPoint* offset) const {
-    SkIPoint backgroundOffset = SkIPoint::Make(0, 0);
-    sk_sp<SkSpecialImage> background(this->filterInput(0, ctx, &backgroundOffset));
-
-    SkIPoint foregroundOffset = SkIPoint::Make(0, 0);
-    sk_sp<SkSpecialImage> foreground(this->filterInput(1, ctx, &foregroundOffset));
+    sk_sp<SkSpecialImage> inputs[2];
+    SkIPoint offsets[2];
+    this->filterAllInputs(ctx, inputs, offsets);
+
+    sk_sp<SkSpecialImage> background = std::move(inputs[0]);
+    const SkIPoint& backgroundOffset = offsets[0];
+    sk_sp<SkSpecialImage> foreground = std::move(inputs[1]);
+    const SkIPoint& foregroundOffset = offsets[1];
 
     SkIRect foregroundBounds = SkIRect::MakeEmpty();
     if (foreground) {
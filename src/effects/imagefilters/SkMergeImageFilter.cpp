@@ -70,10 +70,9 @@ sk_sp<SkSpecialImage> SkMergeImageFilter::onFilterImage(const Context& ctx,
     std::unique_ptr<sk_sp<SkSpecialImage>[]> inputs(new sk_sp<SkSpecialImage>[inputCount]);
     std::unique_ptr<SkIPoint[]> offsets(new SkIPoint[inputCount]);
 
-    // Filter all of the inputs.
+    // Filter all of the inputs, in parallel when a threaded executor is available.
+    this->filterAllInputs(ctx, inputs.get(), offsets.get());
     for (int i = 0; i < inputCount; ++i) {
-        offsets[i] = { 0, 0 };
-        inputs[i] = this->filterInput(i, ctx, &offsets[i]);
         if (!inputs[i]) {
             continue;
         }
@@ -29,11 +29,10 @@ GrBackendTextureImageGenerator::RefHelper::RefHelper(
                     std::unique_ptr<GrSemaphore> semaphore)
         : fOriginalTexture(texture)
         , fOwningContextID(owningContextID)
-        , fBorrowingContextReleaseProc(nullptr)
         , fSemaphore(std::move(semaphore)) {}
 
 GrBackendTextureImageGenerator::RefHelper::~RefHelper() {
-    SkASSERT(!fBorrowingContextID.isValid());
+    SkASSERT(fBorrows.empty());
 
     // Generator has been freed, and no one is borrowing the texture. Notify the original cache
     // that it can free the last ref, so it happens on the correct thread.
@@ -84,12 +83,27 @@ GrBackendTextureImageGenerator::~GrBackendTextureImageGenerator() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Heap-allocated context for ReleaseRefHelper_TextureReleaseProc, since a release proc has a
+// single void* and we need to know which context's borrow is ending.
+struct GrBackendTextureImageGenerator::BorrowRecord {
+    RefHelper*                       fRefHelper;
+    GrDirectContext::DirectContextID fContextID;
+};
+
 void GrBackendTextureImageGenerator::ReleaseRefHelper_TextureReleaseProc(void* ctx) {
-    RefHelper* refHelper = static_cast<RefHelper*>(ctx);
+    std::unique_ptr<BorrowRecord> record(static_cast<BorrowRecord*>(ctx));
+    RefHelper* refHelper = record->fRefHelper;
     SkASSERT(refHelper);
 
-    refHelper->fBorrowingContextReleaseProc = nullptr;
-    refHelper->fBorrowingContextID.makeInvalid();
+    {
+        SkAutoMutexExclusive lock(refHelper->fBorrowsMutex);
+        for (int i = 0; i < refHelper->fBorrows.count(); ++i) {
+            if (refHelper->fBorrows[i].fContextID == record->fContextID) {
+                refHelper->fBorrows.removeShuffle(i);
+                break;
+            }
+        }
+    }
     refHelper->unref();
 }
 
@@ -119,37 +133,43 @@ GrSurfaceProxyView GrBackendTextureImageGenerator::onGenerateTexture(
 
     auto proxyProvider = dContext->priv().proxyProvider();
 
-    fBorrowingMutex.acquire();
+    fRefHelper->fBorrowsMutex.acquire();
     sk_sp<GrRefCntedCallback> releaseProcHelper;
-    if (fRefHelper->fBorrowingContextID.isValid()) {
-        if (fRefHelper->fBorrowingContextID != dContext->directContextID()) {
-            fBorrowingMutex.release();
+    RefHelper::Borrow* existing = nullptr;
+    for (RefHelper::Borrow& borrow : fRefHelper->fBorrows) {
+        if (borrow.fContextID == dContext->directContextID()) {
+            existing = &borrow;
+            break;
+        }
+    }
+    if (existing) {
+        SkASSERT(existing->fReleaseProc);
+        // Ref the release proc to be held by the proxy we make below
+        releaseProcHelper = sk_ref_sp(existing->fReleaseProc);
+    } else {
+        // A semaphore can only be waited on once, so it restricts us to a single consuming
+        // context. Without one (the producing context synchronized with a flush) any number of
+        // contexts in the share group may wrap the texture concurrently.
+        if (!fRefHelper->fBorrows.empty() && fRefHelper->fSemaphore) {
+            fRefHelper->fBorrowsMutex.release();
             rContext->priv().printWarningMessage(
                     "GrBackendTextureImageGenerator: Trying to use texture on two GrContexts!\n");
             return {};
-        } else {
-            SkASSERT(fRefHelper->fBorrowingContextReleaseProc);
-            // Ref the release proc to be held by the proxy we make below
-            releaseProcHelper = sk_ref_sp(fRefHelper->fBorrowingContextReleaseProc);
         }
-    } else {
-        SkASSERT(!fRefHelper->fBorrowingContextReleaseProc);
         // The ref we add to fRefHelper here will be passed into and owned by the
         // GrRefCntedCallback.
         fRefHelper->ref();
-        releaseProcHelper =
-                GrRefCntedCallback::Make(ReleaseRefHelper_TextureReleaseProc, fRefHelper);
-        fRefHelper->fBorrowingContextReleaseProc = releaseProcHelper.get();
+        releaseProcHelper = GrRefCntedCallback::Make(
+                ReleaseRefHelper_TextureReleaseProc,
+                new BorrowRecord{fRefHelper, dContext->directContextID()});
+        fRefHelper->fBorrows.push_back({dContext->directContextID(), releaseProcHelper.get()});
     }
-    fRefHelper->fBorrowingContextID = dContext->directContextID();
     if (!fRefHelper->fBorrowedTextureKey.isValid()) {
         static const auto kDomain = GrUniqueKey::GenerateDomain();
         GrUniqueKey::Builder builder(&fRefHelper->fBorrowedTextureKey, kDomain, 1);
         builder[0] = this->uniqueID();
     }
-    fBorrowingMutex.release();
-
-    SkASSERT(fRefHelper->fBorrowingContextID == dContext->directContextID());
+    fRefHelper->fBorrowsMutex.release();
 
     GrBackendFormat backendFormat = fBackendTexture.getBackendFormat();
     SkASSERT(backendFormat.isValid());
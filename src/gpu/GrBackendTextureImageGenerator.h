@@ -12,16 +12,19 @@
 #include "include/gpu/GrDirectContext.h"
 #include "include/private/GrResourceKey.h"
 #include "include/private/SkMutex.h"
+#include "include/private/SkTArray.h"
 #include "src/gpu/GrTexture.h"
 
 class GrSemaphore;
 
 /*
  * This ImageGenerator is used to wrap a texture in one GrContext and can then be used as a source
- * in another GrContext. It holds onto a semaphore which the producing GrContext will signal and the
- * consuming GrContext will wait on before using the texture. Only one GrContext can ever be used
- * as a consumer (this is mostly because Vulkan can't allow multiple things to wait on the same
- * semaphore).
+ * in another GrContext. It may hold onto a semaphore which the producing GrContext will signal and
+ * the consuming GrContext will wait on before using the texture. When a semaphore is present only
+ * one GrContext can ever be used as a consumer (this is mostly because Vulkan can't allow multiple
+ * things to wait on the same semaphore). When the producing context synchronized with a flush
+ * instead (no semaphore, e.g. GL contexts in one share group), any number of contexts may consume
+ * the texture concurrently; each one wraps the same backend texture rather than re-uploading it.
  *
  * In practice, this capability is used by clients to create backend-specific texture resources in
  * one thread (with, say, GrContext-A) and then ship them over to another GrContext (say,
@@ -55,6 +58,7 @@ private:
                                    std::unique_ptr<GrSemaphore>,
                                    const GrBackendTexture&);
 
+    struct BorrowRecord;
     static void ReleaseRefHelper_TextureReleaseProc(void* ctx);
 
     class RefHelper : public SkNVRefCnt<RefHelper> {
@@ -71,22 +75,25 @@ private:
         // We use this key so that we don't rewrap the GrBackendTexture in a GrTexture for each
         // proxy created from this generator for a particular borrowing context.
         GrUniqueKey                      fBorrowedTextureKey;
-        // There is no ref associated with this pointer. We rely on our atomic bookkeeping with the
-        // context ID to know when this pointer is valid and safe to use. This is used to make sure
-        // all uses of the wrapped texture are finished on the borrowing context before we open
-        // this back up to other contexts. In general a ref to this release proc is owned by all
-        // proxies and gpu uses of the backend texture.
-        GrRefCntedCallback*              fBorrowingContextReleaseProc;
-        GrDirectContext::DirectContextID fBorrowingContextID;
+
+        // Bookkeeping for one context currently borrowing the texture. There is no ref associated
+        // with fReleaseProc; we rely on fBorrowsMutex and the context ID to know when the pointer
+        // is valid and safe to use. In general a ref to the release proc is owned by all proxies
+        // and gpu uses of the backend texture on that context, and the borrow is removed when the
+        // last of those goes away.
+        struct Borrow {
+            GrDirectContext::DirectContextID fContextID;
+            GrRefCntedCallback*              fReleaseProc;
+        };
+        // Guards fBorrows (and the creation of fBorrowedTextureKey). This lives here rather than
+        // on the generator because release procs can outlive the generator.
+        SkMutex                          fBorrowsMutex;
+        SkSTArray<1, Borrow>             fBorrows;
 
         std::unique_ptr<GrSemaphore>     fSemaphore;
     };
 
     RefHelper*       fRefHelper;
-    // This Mutex is used to guard the borrowing of the texture to one GrContext at a time as well
-    // as the creation of the fBorrowingContextReleaseProc. The latter happening if two threads with
-    // the same consuming GrContext try to generate a texture at the same time.
-    SkMutex          fBorrowingMutex;
 
     GrBackendTexture fBackendTexture;
     GrSurfaceOrigin  fSurfaceOrigin;
@@ -7,6 +7,8 @@
 
 #include "src/gpu/GrBlockAllocator.h"
 
+#include "src/core/SkSlabAlloc.h"
+
 #ifdef SK_DEBUG
 #include <vector>
 #endif
@@ -14,6 +16,7 @@
 GrBlockAllocator::GrBlockAllocator(GrowthPolicy policy, size_t blockIncrementBytes,
                                    size_t additionalPreallocBytes)
         : fTail(&fHead)
+        , fScratchBudget(0)
         // Round up to the nearest max-aligned value, and then divide so that fBlockSizeIncrement
         // can effectively fit higher byte counts in its 16 bits of storage
         , fBlockIncrement(SkTo<uint16_t>(GrAlignTo(blockIncrementBytes, kAddressAlign)
@@ -50,7 +53,7 @@ GrBlockAllocator::Block::~Block() {
 
 size_t GrBlockAllocator::totalSize() const {
     // Use size_t since the sum across all blocks could exceed 'int', even though each block won't
-    size_t size = offsetof(GrBlockAllocator, fHead) + this->scratchBlockSize();
+    size_t size = offsetof(GrBlockAllocator, fHead) + this->scratchBlockUsage();
     for (const Block* b : this->blocks()) {
         size += b->fSize;
     }
@@ -59,9 +62,9 @@ size_t GrBlockAllocator::totalSize() const {
 }
 
 size_t GrBlockAllocator::totalUsableSpace() const {
-    size_t size = this->scratchBlockSize();
-    if (size > 0) {
-        size -= kDataStart; // scratchBlockSize reports total block size, not usable size
+    size_t size = 0;
+    for (const Block* s = fHead.fPrev; s; s = s->fPrev) {
+        size += (s->fSize - kDataStart); // fSize reports total block size, not usable size
     }
     for (const Block* b : this->blocks()) {
         size += (b->fSize - kDataStart);
@@ -112,17 +115,20 @@ void GrBlockAllocator::releaseBlock(Block* block) {
             fTail = block->fPrev;
         }
 
-        // The released block becomes the new scratch block (if it's bigger), or delete it
+        // The released block becomes the primary scratch block if it's bigger; otherwise it is
+        // retained behind the primary block. trimScratchBlocks() then frees whatever portion of
+        // the chain exceeds the scratch budget (with the default budget of 0 this preserves the
+        // historical behavior of keeping only the single largest released block).
+        SkASSERT(block != fHead.fPrev); // shouldn't already be the scratch block
+        block->markAsScratch();
         if (this->scratchBlockSize() < block->fSize) {
-            SkASSERT(block != fHead.fPrev); // shouldn't already be the scratch block
-            if (fHead.fPrev) {
-                delete fHead.fPrev;
-            }
-            block->markAsScratch();
+            block->fPrev = fHead.fPrev;
             fHead.fPrev = block;
         } else {
-            delete block;
+            block->fPrev = fHead.fPrev->fPrev;
+            fHead.fPrev->fPrev = block;
         }
+        this->trimScratchBlocks();
     }
 
     // Decrement growth policy (opposite of addBlock()'s increment operations)
@@ -176,7 +182,7 @@ void GrBlockAllocator::reset() {
             b->poisonRange(kDataStart, b->fSize);
             this->resetScratchSpace();
         } else {
-            delete b;
+            DeleteBlock(b);
         }
     }
     SkASSERT(fTail == &fHead && fHead.fNext == nullptr && fHead.fPrev == nullptr &&
@@ -188,9 +194,57 @@ void GrBlockAllocator::reset() {
 }
 
 void GrBlockAllocator::resetScratchSpace() {
-    if (fHead.fPrev) {
-        delete fHead.fPrev;
-        fHead.fPrev = nullptr;
+    Block* scratch = fHead.fPrev;
+    fHead.fPrev = nullptr;
+    while (scratch) {
+        Block* prev = scratch->fPrev;
+        DeleteBlock(scratch);
+        scratch = prev;
+    }
+}
+
+size_t GrBlockAllocator::scratchBlockUsage() const {
+    size_t size = 0;
+    for (const Block* s = fHead.fPrev; s; s = s->fPrev) {
+        size += s->fSize;
+    }
+    return size;
+}
+
+GrBlockAllocator::Block* GrBlockAllocator::removeScratchBlock(int minimumSize) {
+    Block** link = &fHead.fPrev;
+    while (*link && (*link)->fSize < minimumSize) {
+        link = &(*link)->fPrev;
+    }
+    Block* block = *link;
+    if (block) {
+        SkASSERT(block->isScratch());
+        *link = block->fPrev;
+    }
+    return block;
+}
+
+void GrBlockAllocator::trimScratchBlocks() {
+    // The primary scratch block is always kept; the rest of the chain must fit in the budget.
+    // Dropping the tail of the chain frees the oldest (and no larger) retained blocks first.
+    if (!fHead.fPrev) {
+        return;
+    }
+    size_t retained = 0;
+    Block** link = &fHead.fPrev->fPrev;
+    while (*link) {
+        retained += (*link)->fSize;
+        if (retained > fScratchBudget) {
+            Block* stale = *link;
+            *link = nullptr;
+            while (stale) {
+                Block* prev = stale->fPrev;
+                DeleteBlock(stale);
+                stale = prev;
+            }
+            return;
+        }
+        link = &(*link)->fPrev;
     }
 }
 
@@ -211,12 +265,10 @@ void GrBlockAllocator::addBlock(int minimumSize, int maxSize) {
 
     int allocSize;
     void* mem = nullptr;
-    if (this->scratchBlockSize() >= minimumSize) {
-        // Activate the scratch block instead of making a new block
-        SkASSERT(fHead.fPrev->isScratch());
-        allocSize = fHead.fPrev->fSize;
-        mem = fHead.fPrev;
-        fHead.fPrev = nullptr;
+    if (Block* scratch = this->removeScratchBlock(minimumSize)) {
+        // Activate a retained scratch block instead of making a new block
+        allocSize = scratch->fSize;
+        mem = scratch;
     } else if (minimumSize < maxSize) {
         // Calculate the 'next' size per growth policy sequence
         GrowthPolicy gp = static_cast<GrowthPolicy>(fGrowthPolicy);
@@ -252,12 +304,19 @@ void GrBlockAllocator::addBlock(int minimumSize, int maxSize) {
 
     // Create new block and append to the linked list of blocks in this allocator
     if (!mem) {
-        mem = operator new(allocSize);
+        mem = sk_slab_alloc(allocSize);
     }
     fTail->fNext = new (mem) Block(fTail, allocSize);
     fTail = fTail->fNext;
 }
 
+void GrBlockAllocator::DeleteBlock(Block* block) {
+    SkASSERT(block && block->fSentinel == kAssignedMarker);
+    const int size = block->fSize;
+    block->~Block();
+    sk_slab_free(block, size);
+}
+
 #ifdef SK_DEBUG
 void GrBlockAllocator::validate() const {
     std::vector<const Block*> blocks;
@@ -267,9 +326,12 @@ void GrBlockAllocator::validate() const {
 
         SkASSERT(kAssignedMarker == block->fSentinel);
         if (block == &fHead) {
-            // The head blocks' fPrev may be non-null if it holds a scratch block, but that's not
-            // considered part of the linked list
-            SkASSERT(!prev && (!fHead.fPrev || fHead.fPrev->isScratch()));
+            // The head blocks' fPrev may be non-null if it holds a chain of scratch blocks, but
+            // that's not considered part of the linked list
+            SkASSERT(!prev);
+            for (const Block* s = fHead.fPrev; s; s = s->fPrev) {
+                SkASSERT(s->isScratch());
+            }
         } else {
             SkASSERT(prev == block->fPrev);
         }
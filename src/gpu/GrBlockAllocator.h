@@ -72,7 +72,6 @@ public:
     class Block final {
     public:
         ~Block();
-        void operator delete(void* p) { ::operator delete(p); }
 
         // Return the maximum allocation size with the given alignment that can fit in this block.
         template <size_t Align = 1, size_t Padding = 0>
@@ -378,6 +377,25 @@ public:
      */
     void resetScratchSpace();
 
+    /**
+     * Set the maximum number of bytes of released heap blocks to retain beyond the single
+     * scratch block that is always kept. The default budget of 0 preserves the keep-one-block
+     * behavior. With a positive budget, releaseBlock() stashes additional blocks (most recently
+     * released kept longest) until their combined size exceeds the budget; addBlock() reuses
+     * stashed blocks before going back to the heap. Setting the budget to the allocator's
+     * high-water totalSize() therefore makes a repeat of the same allocation cycle malloc-free.
+     */
+    void setScratchBlockBudget(size_t budget) {
+        fScratchBudget = budget;
+        this->trimScratchBlocks();
+    }
+    size_t scratchBlockBudget() const { return fScratchBudget; }
+
+    /**
+     * Return the total size of all retained scratch blocks (0 if there are none).
+     */
+    size_t scratchBlockUsage() const;
+
     template <bool Forward, bool Const> class BlockIter;
 
     /**
@@ -437,10 +455,25 @@ private:
     // that will preserve the static guarantees GrBlockAllocator makes.
     void addBlock(int minSize, int maxSize);
 
+    // Destroy a heap block created by addBlock() and return its storage to the slab backend.
+    // Never called on the inline head block.
+    static void DeleteBlock(Block* block);
+
     int scratchBlockSize() const { return fHead.fPrev ? fHead.fPrev->fSize : 0; }
 
+    // Unlink and return the first scratch block that can hold 'minimumSize', or null if none can.
+    Block* removeScratchBlock(int minimumSize);
+
+    // Delete scratch blocks beyond the primary one until the remainder fits in fScratchBudget.
+    void trimScratchBlocks();
+
     Block* fTail; // All non-head blocks are heap allocated; tail will never be null.
 
+    // Combined size limit for scratch blocks retained behind the primary one; see
+    // setScratchBlockBudget(). This is the one piece of state that doesn't fit in the bitfield
+    // below, costing a pointer's worth of growth over the original 16-byte footprint.
+    size_t fScratchBudget;
+
     // All remaining state is packed into 64 bits to keep GrBlockAllocator at 16 bytes + head block
     // (on a 64-bit system).
 
@@ -462,7 +495,8 @@ private:
     // from the initial allocation.
     // The head block's prev pointer may be non-null, which signifies a scratch block that may be
     // reused instead of allocating an entirely new block (this helps when allocate+release calls
-    // bounce back and forth across the capacity of a block).
+    // bounce back and forth across the capacity of a block). Further scratch blocks may be chained
+    // behind it through their own prev pointers, up to fScratchBudget bytes in total.
     alignas(kAddressAlign) Block fHead;
 
     static_assert(kGrowthPolicyCount <= 4);
@@ -8,6 +8,7 @@
 #include "include/gpu/GrDirectContext.h"
 #include "include/gpu/GrTypes.h"
 #include "include/private/SkMacros.h"
+#include "src/core/SkMathPriv.h"
 #include "src/core/SkSafeMath.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/GrBufferAllocPool.h"
@@ -36,17 +37,30 @@ sk_sp<GrCpuBuffer> GrBufferAllocPool::CpuBufferCache::makeBuffer(size_t size,
                                                                  bool mustBeInitialized) {
     SkASSERT(size > 0);
     Buffer* result = nullptr;
-    if (size == kDefaultBufferSize) {
+    if (size <= kMaxBlockSize && fMaxBuffersToCache) {
+        if (size > fHighWaterSize) {
+            fHighWaterSize = GrNextSizePow2(size);
+        }
+        Buffer* tooSmall = nullptr;
         int i = 0;
         for (; i < fMaxBuffersToCache && fBuffers[i].fBuffer; ++i) {
-            SkASSERT(fBuffers[i].fBuffer->size() == kDefaultBufferSize);
-            if (fBuffers[i].fBuffer->unique()) {
+            if (!fBuffers[i].fBuffer->unique()) {
+                continue;
+            }
+            if (fBuffers[i].fBuffer->size() >= size) {
                 result = &fBuffers[i];
+            } else if (!tooSmall) {
+                tooSmall = &fBuffers[i];
             }
         }
-        if (!result && i < fMaxBuffersToCache) {
-            fBuffers[i].fBuffer = GrCpuBuffer::Make(size);
-            result = &fBuffers[i];
+        if (!result) {
+            // Prefer an open slot; otherwise replace a buffer below the high-water mark.
+            Buffer* slot = i < fMaxBuffersToCache ? &fBuffers[i] : tooSmall;
+            if (slot) {
+                slot->fBuffer = GrCpuBuffer::Make(fHighWaterSize);
+                slot->fCleared = false;
+                result = slot;
+            }
         }
     }
     Buffer tempResult;
@@ -114,6 +128,10 @@ GrBufferAllocPool::~GrBufferAllocPool() {
 
 void GrBufferAllocPool::reset() {
     VALIDATE();
+    // Feed this cycle's usage into the sizing history (3:1 EWMA) and the efficiency counters.
+    fEwmaUsedPerReset = fEwmaUsedPerReset ? (3 * fEwmaUsedPerReset + fBytesInUse) / 4
+                                          : fBytesInUse;
+    fStats.fBytesUsed += fBytesInUse;
     fBytesInUse = 0;
     this->deleteBlocks();
     this->resetCpuData(0);
@@ -313,7 +331,14 @@ void GrBufferAllocPool::putBack(size_t bytes) {
 }
 
 bool GrBufferAllocPool::createBlock(size_t requestSize) {
-    size_t size = std::max(requestSize, kDefaultBufferSize);
+    // History-driven sizing: target what the recent flushes still needed at this point, so
+    // small frames don't map oversized buffers and heavy frames don't chain many small blocks
+    // (each with its own map/unmap/flush).
+    size_t hint = kDefaultBufferSize;
+    if (fEwmaUsedPerReset > fBytesInUse) {
+        hint = std::min(GrNextSizePow2(fEwmaUsedPerReset - fBytesInUse), kMaxBlockSize);
+    }
+    size_t size = std::max(requestSize, std::max(hint, kDefaultBufferSize));
 
     VALIDATE();
 
@@ -324,6 +349,8 @@ bool GrBufferAllocPool::createBlock(size_t requestSize) {
         fBlocks.pop_back();
         return false;
     }
+    fStats.fBlocksCreated += 1;
+    fStats.fBytesAllocated += block.fBuffer->size();
 
     block.fBytesFree = block.fBuffer->size();
     if (fBufferPtr) {
@@ -350,7 +377,7 @@ bool GrBufferAllocPool::createBlock(size_t requestSize) {
         SkASSERT(fBufferPtr);
     } else {
         if (GrCaps::kNone_MapFlags != fGpu->caps()->mapBufferFlags() &&
-            size > fGpu->caps()->bufferMapThreshold()) {
+            size > fGpu->getContext()->getBufferMapThreshold()) {
             fBufferPtr = static_cast<GrGpuBuffer*>(block.fBuffer.get())->map();
         }
     }
@@ -396,7 +423,7 @@ void GrBufferAllocPool::flushCpuData(const BufferBlock& block, size_t flushSize)
     VALIDATE(true);
 
     if (GrCaps::kNone_MapFlags != fGpu->caps()->mapBufferFlags() &&
-        flushSize > fGpu->caps()->bufferMapThreshold()) {
+        flushSize > fGpu->getContext()->getBufferMapThreshold()) {
         void* data = buffer->map();
         if (data) {
             memcpy(data, fBufferPtr, flushSize);
@@ -55,8 +55,24 @@ public:
         };
         std::unique_ptr<Buffer[]> fBuffers;
         int fMaxBuffersToCache = 0;
+        // Cached buffers are allocated at the largest size recently requested so that pools
+        // with adaptive block sizes keep hitting the cache as their blocks grow.
+        size_t fHighWaterSize = GrBufferAllocPool::kDefaultBufferSize;
     };
 
+    /**
+     * Cumulative pool efficiency counters: bytes actually written vs. block bytes allocated,
+     * and how many blocks it took. A used/allocated ratio well below 1 means block sizing is
+     * wasting mapped memory; a high block count per flush means per-block map/flush overhead.
+     */
+    struct Stats {
+        int    fBlocksCreated  = 0;
+        size_t fBytesAllocated = 0;
+        size_t fBytesUsed      = 0;
+    };
+
+    const Stats& stats() const { return fStats; }
+
     /**
      * Ensures all buffers are unmapped and have all data written to them.
      * Call before drawing using buffers from the pool.
@@ -156,7 +172,14 @@ private:
 #ifdef SK_DEBUG
     void validate(bool unusedBlockAllowed = false) const;
 #endif
+    // Blocks never grow beyond this, no matter what the flush history says.
+    static constexpr size_t kMaxBlockSize = 1 << 22;
+
     size_t fBytesInUse = 0;
+    // Exponentially-weighted average of the bytes used between resets (i.e. per flush); feeds
+    // the block size chosen by createBlock().
+    size_t fEwmaUsedPerReset = 0;
+    Stats fStats;
 
     SkTArray<BufferBlock> fBlocks;
     sk_sp<CpuBufferCache> fCpuBufferCache;
@@ -363,6 +363,9 @@ public:
     /** Supports using GrSemaphore. */
     bool semaphoreSupport() const { return fSemaphoreSupport; }
 
+    /** Supports GPU timestamp queries (see GrGpu::insertGpuTimestamp). */
+    bool timestampQuerySupport() const { return fTimestampQuerySupport; }
+
     bool crossContextTextureSupport() const { return fCrossContextTextureSupport; }
     /**
      * Returns whether or not we will be able to do a copy given the passed in params
@@ -571,6 +574,7 @@ protected:
 
     bool fFenceSyncSupport                           : 1;
     bool fSemaphoreSupport                           : 1;
+    bool fTimestampQuerySupport                      : 1;
 
     // Requires fence sync support in GL.
     bool fCrossContextTextureSupport                 : 1;
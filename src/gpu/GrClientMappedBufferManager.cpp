@@ -39,6 +39,7 @@ void GrClientMappedBufferManager::process() {
         for (auto& m : messages) {
             this->remove(m.fBuffer);
             m.fBuffer->unmap();
+            this->recycle(std::move(m.fBuffer));
         }
     }
 }
@@ -46,6 +47,39 @@ void GrClientMappedBufferManager::process() {
 void GrClientMappedBufferManager::abandon() {
     fAbandoned = true;
     fClientHeldBuffers.clear();
+    fFreeBuffers.reset();
+}
+
+void GrClientMappedBufferManager::setBufferPoolSize(int maxBuffers) {
+    SkASSERT(maxBuffers >= 0);
+    fBufferPoolSize = maxBuffers;
+    if (fFreeBuffers.count() > fBufferPoolSize) {
+        fFreeBuffers.resize_back(fBufferPoolSize);
+    }
+}
+
+sk_sp<GrGpuBuffer> GrClientMappedBufferManager::takeBuffer(size_t size) {
+    // Prefer the smallest retained buffer that can hold 'size' so that large buffers stay
+    // available for large requests.
+    int best = -1;
+    for (int i = 0; i < fFreeBuffers.count(); ++i) {
+        size_t candidate = fFreeBuffers[i]->size();
+        if (candidate >= size && (best < 0 || candidate < fFreeBuffers[best]->size())) {
+            best = i;
+        }
+    }
+    if (best < 0) {
+        return nullptr;
+    }
+    sk_sp<GrGpuBuffer> b = std::move(fFreeBuffers[best]);
+    fFreeBuffers.removeShuffle(best);
+    return b;
+}
+
+void GrClientMappedBufferManager::recycle(sk_sp<GrGpuBuffer> b) {
+    if (fFreeBuffers.count() < fBufferPoolSize && !b->wasDestroyed()) {
+        fFreeBuffers.push_back(std::move(b));
+    }
 }
 
 void GrClientMappedBufferManager::remove(const sk_sp<GrGpuBuffer>& b) {
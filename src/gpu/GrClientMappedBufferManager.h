@@ -73,12 +73,29 @@ public:
     /** Notifies the manager that the context has been abandoned. No more unmaps() will occur.*/
     void abandon();
 
+    /**
+     * Set the maximum number of finished transfer buffers to retain for reuse by takeBuffer().
+     * With a pool, a client streaming a steady rate of async readbacks (e.g. video composition)
+     * reaches a state where no readback allocates a new buffer. The default of 0 disables
+     * pooling; setting it also trims any excess retained buffers.
+     */
+    void setBufferPoolSize(int maxBuffers);
+
+    /**
+     * Take a retained buffer of at least 'size' bytes, or null if none is available. The
+     * returned buffer is unmapped and its contents are undefined.
+     */
+    sk_sp<GrGpuBuffer> takeBuffer(size_t size);
+
 private:
     BufferFinishedMessageBus::Inbox fFinishedBufferInbox;
     std::forward_list<sk_sp<GrGpuBuffer>> fClientHeldBuffers;
+    SkSTArray<4, sk_sp<GrGpuBuffer>> fFreeBuffers;
+    int fBufferPoolSize = 0;
     bool fAbandoned = false;
 
     void remove(const sk_sp<GrGpuBuffer>& b);
+    void recycle(sk_sp<GrGpuBuffer> b);
 };
 
 bool SkShouldPostMessageToBus(const GrClientMappedBufferManager::BufferFinishedMessage&,
@@ -20,6 +20,7 @@
 #include "src/gpu/GrRecordingContextPriv.h"
 #include "src/gpu/GrSWMaskHelper.h"
 #include "src/gpu/GrStencilMaskHelper.h"
+#include "src/gpu/GrThreadSafeCache.h"
 #include "src/gpu/effects/GrBlendFragmentProcessor.h"
 #include "src/gpu/effects/GrConvexPolyEffect.h"
 #include "src/gpu/effects/GrRRectEffect.h"
@@ -297,6 +298,71 @@ static void draw_to_sw_mask(GrSWMaskHelper* helper, const GrClipStack::Element&
     }
 }
 
+// The per-save-record mask cache below is keyed by the clip stack's generation ID, so it cannot
+// survive the stack being torn down and rebuilt. Many clients re-issue the identical clip every
+// frame (e.g. static rounded-panel UI), so we also key masks by the elements' actual geometry and
+// share them across frames through the thread-safe cache, which already retains uniquely-held
+// entries in LRU order until the resource cache needs the budget back. Returns false when any
+// element lacks a stable identity to key on (volatile paths) or the key would grow too large.
+static bool build_persistent_mask_key(const SkIRect& bounds,
+                                      const GrClipStack::Element** elements, int count,
+                                      GrUniqueKey* key) {
+    static const GrUniqueKey::Domain kDomain = GrUniqueKey::GenerateDomain();
+    static constexpr int kMaxKeyedElements = 8;
+
+    if (count > kMaxKeyedElements) {
+        return false;
+    }
+
+    SkSTArray<64, uint32_t> data;
+    auto addScalars = [&](const SkScalar* v, int n) {
+        for (int i = 0; i < n; ++i) {
+            data.push_back(SkFloat2Bits(v[i]));
+        }
+    };
+
+    data.push_back(SkToS16(bounds.fLeft) | (SkToS16(bounds.fRight) << 16));
+    data.push_back(SkToS16(bounds.fTop) | (SkToS16(bounds.fBottom) << 16));
+    for (int i = 0; i < count; ++i) {
+        const GrClipStack::Element& e = *(elements[i]);
+
+        data.push_back((uint32_t) e.fOp << 2 |
+                       (e.fAA == GrAA::kYes ? 2 : 0) |
+                       (e.fShape.inverted() ? 1 : 0));
+
+        SkScalar m[9];
+        e.fLocalToDevice.get9(m);
+        addScalars(m, 9);
+
+        switch (e.fShape.type()) {
+            case GrShape::Type::kRect:
+                addScalars(&e.fShape.rect().fLeft, 4);
+                break;
+            case GrShape::Type::kRRect: {
+                uint32_t rr[SkRRect::kSizeInMemory / sizeof(uint32_t)];
+                e.fShape.rrect().writeToMemory(rr);
+                data.push_back_n(SK_ARRAY_COUNT(rr), rr);
+            } break;
+            case GrShape::Type::kPath:
+                if (e.fShape.path().isVolatile()) {
+                    // The path's gen ID won't identify the same geometry next frame.
+                    return false;
+                }
+                data.push_back(e.fShape.path().getGenerationID());
+                // The gen ID ignores the fill type, so key it separately.
+                data.push_back((uint32_t) e.fShape.path().getFillType());
+                break;
+            default:
+                return false;
+        }
+    }
+
+    GrUniqueKey::Builder builder(key, kDomain, data.count(), "persistent_clip_mask");
+    memcpy(&builder[0], data.begin(), data.count() * sizeof(uint32_t));
+    builder.finish();
+    return true;
+}
+
 static GrSurfaceProxyView render_sw_mask(GrRecordingContext* context, const SkIRect& bounds,
                                          const GrClipStack::Element** elements, int count) {
     SkASSERT(count > 0);
@@ -1308,6 +1374,22 @@ GrClip::Effect GrClipStack::apply(GrRecordingContext* context, GrSurfaceDrawCont
             break;
     }
 
+    if (fAppliedGenID != kInvalidGenID && fAppliedGenID == cs.genID() && !cs.shader()) {
+        // The last full analysis of this save record applied every element with just the scissor
+        // and window rectangles cached below, and those are independent of the draw's bounds.
+        // Only the scissor vs. draw-bounds interaction has to be redone. (The shader is
+        // re-checked because adding a clip shader does not change the record's gen ID.)
+        SkASSERT(cs.op() == SkClipOp::kIntersect);
+        if (!GrClip::IsInsideClip(fAppliedScissor, *bounds)) {
+            out->hardClip().addScissor(fAppliedScissor, bounds);
+        }
+        if (!fAppliedWindowRects.empty()) {
+            out->hardClip().addWindowRectangles(fAppliedWindowRects,
+                                                GrWindowRectsState::Mode::kExclusive);
+        }
+        return out->doesClip() ? Effect::kClipped : Effect::kUnclipped;
+    }
+
     // We can determine a scissor based on the draw and the overall stack bounds.
     SkIRect scissorBounds;
     if (cs.op() == SkClipOp::kIntersect) {
@@ -1336,6 +1418,9 @@ GrClip::Effect GrClipStack::apply(GrRecordingContext* context, GrSurfaceDrawCont
     SkSTArray<kNumStackMasks, const Element*> elementsForMask;
 
     bool maskRequiresAA = false;
+    // True while every element that matters has been applied by the scissor or window rects
+    // alone; this makes the applied state reusable for later draws under the same save record.
+    bool allElementsHWApplied = true;
     auto* tessellator = context->priv().drawingManager()->getTessellationPathRenderer();
 
     int i = fElements.count();
@@ -1355,7 +1440,10 @@ GrClip::Effect GrClipStack::apply(GrRecordingContext* context, GrSurfaceDrawCont
                 return Effect::kClippedOut;
 
             case ClipGeometry::kBOnly:
-                // We don't need to produce a coverage FP or mask for the element
+                // We don't need to produce a coverage FP or mask for the element, but that
+                // conclusion is specific to this draw's bounds, so the applied state can't be
+                // reused by other draws.
+                allElementsHWApplied = false;
                 break;
 
             case ClipGeometry::kAOnly:
@@ -1384,6 +1472,10 @@ GrClip::Effect GrClipStack::apply(GrRecordingContext* context, GrSurfaceDrawCont
                     }
                 }
 
+                if (!fullyApplied) {
+                    allElementsHWApplied = false;
+                }
+
                 if (!fullyApplied && remainingAnalyticFPs > 0) {
                     std::tie(fullyApplied, clipFP) = analytic_clip_fp(e.asElement(),
                                                                       *caps->shaderCaps(),
@@ -1415,6 +1507,17 @@ GrClip::Effect GrClipStack::apply(GrRecordingContext* context, GrSurfaceDrawCont
         return Effect::kUnclipped;
     }
 
+    if (allElementsHWApplied && cs.op() == SkClipOp::kIntersect && !cs.shader() &&
+        cs.genID() != kInvalidGenID) {
+        // Every element was applied with the scissor and window rectangles alone, and for an
+        // intersect op neither depends on the draw's bounds. Cache them so later draws under
+        // this unchanged save record can skip the element analysis above.
+        SkASSERT(!clipFP && elementsForMask.empty());
+        fAppliedGenID = cs.genID();
+        fAppliedScissor = scissorBounds;
+        fAppliedWindowRects = windowRects;
+    }
+
     // Fill out the GrAppliedClip with what we know so far, possibly with a tightened scissor
     if (cs.op() == SkClipOp::kIntersect && !elementsForMask.empty()) {
         SkAssertResult(scissorBounds.intersect(draw.outerBounds()));
@@ -1556,8 +1659,14 @@ GrFPResult GrClipStack::GetSWMaskFP(GrRecordingContext* context, Mask::Stack* ma
                                     const Element** elements, int count,
                                     std::unique_ptr<GrFragmentProcessor> clipFP) {
     GrProxyProvider* proxyProvider = context->priv().proxyProvider();
+    GrThreadSafeCache* threadSafeCache = context->priv().threadSafeCache();
     GrSurfaceProxyView maskProxy;
 
+    // If the elements' geometry can be keyed stably, the mask is shared across frames (and DDL
+    // recorders) through the thread-safe cache instead of the genID-keyed per-record masks.
+    GrUniqueKey persistentKey;
+    const bool persistent = build_persistent_mask_key(bounds, elements, count, &persistentKey);
+
     SkIRect maskBounds; // may not be 'bounds' if we reuse a large clip mask
     // Check the existing masks from this save record for compatibility
     for (const Mask& m : masks->ritems()) {
@@ -1574,6 +1683,15 @@ GrFPResult GrClipStack::GetSWMaskFP(GrRecordingContext* context, Mask::Stack* ma
         }
     }
 
+    if (!maskProxy && persistent) {
+        // The save record doesn't know about this mask, but an identical clip from an earlier
+        // frame (or another DDL recorder) may have left it in the thread-safe cache.
+        maskProxy = threadSafeCache->find(persistentKey);
+        if (maskProxy) {
+            maskBounds = bounds; // the draw bounds are baked into the key
+        }
+    }
+
     if (!maskProxy) {
         // No existing mask was found, so need to render a new one
         maskProxy = render_sw_mask(context, bounds, elements, count);
@@ -1586,6 +1704,13 @@ GrFPResult GrClipStack::GetSWMaskFP(GrRecordingContext* context, Mask::Stack* ma
         Mask& mask = masks->emplace_back(current, bounds);
         proxyProvider->assignUniqueKeyToProxy(mask.key(), maskProxy.asTextureProxy());
         maskBounds = bounds;
+
+        if (persistent) {
+            // Also publish the view for reuse after this save record is gone. If another
+            // recorder raced us here we keep our view; retention is usage-based, with the cache
+            // holding uniquely-held masks in LRU order until the resource cache needs the budget.
+            threadSafeCache->add(persistentKey, maskProxy);
+        }
     }
 
     // Wrap the mask in an FP that samples it for coverage
@@ -304,6 +304,13 @@ private:
     mutable Mask::Stack      fMasks;
     mutable GrProxyProvider* fProxyProvider;
 
+    // Cached state from the most recent apply() that reduced the save record to just a scissor
+    // and window rectangles. Those are independent of the draw being clipped, so while the save
+    // record's gen ID is unchanged, later draws skip the per-element analysis (see apply()).
+    mutable uint32_t           fAppliedGenID = 0;   // 0 is the invalid gen ID, i.e. no cache
+    mutable SkIRect            fAppliedScissor = SkIRect::MakeEmpty();
+    mutable GrWindowRectangles fAppliedWindowRects;
+
     const SkIRect            fDeviceBounds;
     const SkMatrixProvider*  fMatrixProvider;
 
@@ -72,6 +72,7 @@ GrDirectContext::~GrDirectContext() {
     // before having been fully created
     if (fGpu) {
         this->flushAndSubmit();
+        this->deletePendingGpuTaskTimings();
     }
 
     // We need to make sure all work is finished on the gpu before we start releasing resources.
@@ -92,6 +93,37 @@ sk_sp<GrContextThreadSafeProxy> GrDirectContext::threadSafeProxy() {
     return INHERITED::threadSafeProxy();
 }
 
+void GrDirectContext::pollGpuTaskTimings(std::vector<GpuTaskTiming>* results) {
+    ASSERT_SINGLE_OWNER
+    if (this->abandoned()) {
+        return;
+    }
+    size_t keep = 0;
+    for (size_t i = 0; i < fPendingGpuTaskTimings.size(); ++i) {
+        PendingGpuTaskTiming& pending = fPendingGpuTaskTimings[i];
+        uint64_t end;
+        // Check the end timestamp first: query results resolve in order, so once it is
+        // available the begin timestamp is too.
+        if (fGpu->getGpuTimestampResult(pending.fEnd, &end)) {
+            uint64_t begin = 0;
+            SkAssertResult(fGpu->getGpuTimestampResult(pending.fBegin, &begin));
+            results->push_back({std::move(pending.fName), end - begin});
+        } else {
+            fPendingGpuTaskTimings[keep++] = std::move(pending);
+        }
+    }
+    fPendingGpuTaskTimings.resize(keep);
+}
+
+void GrDirectContext::deletePendingGpuTaskTimings() {
+    SkASSERT(fGpu);
+    for (const PendingGpuTaskTiming& pending : fPendingGpuTaskTimings) {
+        fGpu->deleteGpuTimestamp(pending.fBegin);
+        fGpu->deleteGpuTimestamp(pending.fEnd);
+    }
+    fPendingGpuTaskTimings.clear();
+}
+
 void GrDirectContext::resetGLTextureBindings() {
     if (this->abandoned() || this->backend() != GrBackendApi::kOpenGL) {
         return;
@@ -114,6 +146,9 @@ void GrDirectContext::abandonContext() {
     // We need to make sure all work is finished on the gpu before we start releasing resources.
     this->syncAllOutstandingGpuWork(this->caps()->mustSyncGpuDuringAbandon());
 
+    // The backend queries are lost with the abandoned context; just forget them.
+    fPendingGpuTaskTimings.clear();
+
     fStrikeCache->freeAll();
 
     fMappedBufferManager->abandon();
@@ -158,6 +193,8 @@ void GrDirectContext::releaseResourcesAndAbandonContext() {
     // We need to make sure all work is finished on the gpu before we start releasing resources.
     this->syncAllOutstandingGpuWork(/*shouldExecuteWhileAbandoned=*/true);
 
+    this->deletePendingGpuTaskTimings();
+
     fResourceProvider->abandon();
 
     // Release all resources in the backend 3D API.
@@ -250,8 +287,9 @@ bool GrDirectContext::init() {
 
     GrProxyProvider* proxyProvider = this->priv().proxyProvider();
 
+    fGlyphCacheTextureMaximumBytes = this->options().fGlyphCacheTextureMaximumBytes;
     fAtlasManager = std::make_unique<GrAtlasManager>(proxyProvider,
-                                                     this->options().fGlyphCacheTextureMaximumBytes,
+                                                     fGlyphCacheTextureMaximumBytes,
                                                      allowMultitexturing);
     this->priv().addOnFlushCallbackObject(fAtlasManager.get());
 
@@ -299,6 +337,78 @@ void GrDirectContext::setResourceCacheLimit(size_t maxResourceBytes) {
     fResourceCache->setLimit(maxResourceBytes);
 }
 
+void GrDirectContext::setResourceCachePurgeWatermark(size_t watermarkBytes) {
+    ASSERT_SINGLE_OWNER
+    fResourceCache->setPurgeWatermark(watermarkBytes);
+}
+
+uint32_t GrDirectContext::createResourceCachePartition(const char* name, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    return fResourceCache->createPartition(name, maxBytes);
+}
+
+void GrDirectContext::setResourceCachePartition(uint32_t partition) {
+    ASSERT_SINGLE_OWNER
+    fResourceCache->setActivePartition(partition);
+}
+
+void GrDirectContext::setResourceCachePartitionLimit(uint32_t partition, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    fResourceCache->setPartitionLimit(partition, maxBytes);
+}
+
+bool GrDirectContext::getResourceCachePartitionUsage(uint32_t partition,
+                                                     size_t* budgetedBytes,
+                                                     size_t* purgedBytes) const {
+    ASSERT_SINGLE_OWNER
+    GrResourceCache::PartitionStats stats;
+    if (!fResourceCache->getPartitionStats(partition, &stats)) {
+        return false;
+    }
+    if (budgetedBytes) {
+        *budgetedBytes = stats.fBudgetedBytes;
+    }
+    if (purgedBytes) {
+        *purgedBytes = stats.fPurgedBytes;
+    }
+    return true;
+}
+
+size_t GrDirectContext::getGlyphCacheTextureMaximumBytes() const {
+    ASSERT_SINGLE_OWNER
+    return fGlyphCacheTextureMaximumBytes;
+}
+
+void GrDirectContext::setGlyphCacheTextureMaximumBytes(size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    if (this->abandoned() || maxBytes == fGlyphCacheTextureMaximumBytes) {
+        return;
+    }
+    fGlyphCacheTextureMaximumBytes = maxBytes;
+    fAtlasManager->setMaxTextureBytes(maxBytes);
+}
+
+size_t GrDirectContext::getBufferMapThreshold() const {
+    return fBufferMapThresholdOverride >= 0 ? fBufferMapThresholdOverride
+                                            : this->caps()->bufferMapThreshold();
+}
+
+void GrDirectContext::setBufferMapThreshold(int threshold) {
+    ASSERT_SINGLE_OWNER
+    fBufferMapThresholdOverride = threshold;
+}
+
+void GrDirectContext::setResourceCacheNearBudgetProc(ResourceCacheNearBudgetProc proc,
+                                                     void* context) {
+    ASSERT_SINGLE_OWNER
+    fResourceCache->setNearBudgetProc(proc, context);
+}
+
+size_t GrDirectContext::getResourceCacheOverbudgetPurgeBytes() const {
+    ASSERT_SINGLE_OWNER
+    return fResourceCache->overbudgetPurgeBytes();
+}
+
 void GrDirectContext::purgeUnlockedResources(bool scratchResourcesOnly) {
     ASSERT_SINGLE_OWNER
 
@@ -316,6 +426,16 @@ void GrDirectContext::purgeUnlockedResources(bool scratchResourcesOnly) {
     fGpu->releaseUnlockedBackendObjects();
 }
 
+void GrDirectContext::setAsyncReadPixelsBufferPoolSize(int maxBuffers) {
+    ASSERT_SINGLE_OWNER
+
+    if (this->abandoned()) {
+        return;
+    }
+
+    fMappedBufferManager->setBufferPoolSize(maxBuffers);
+}
+
 void GrDirectContext::performDeferredCleanup(std::chrono::milliseconds msNotUsed,
                                              bool scratchResourcesOnly) {
     TRACE_EVENT0("skia.gpu", TRACE_FUNC);
@@ -332,6 +452,7 @@ void GrDirectContext::performDeferredCleanup(std::chrono::milliseconds msNotUsed
 
     fResourceCache->purgeAsNeeded();
     fResourceCache->purgeResourcesNotUsedSince(purgeTime, scratchResourcesOnly);
+    fResourceCache->purgeToWatermark();
 
     // The textBlob Cache doesn't actually hold any GPU resource but this is a convenient
     // place to purge stale blobs
@@ -941,6 +1062,11 @@ bool GrDirectContext::precompileShader(const SkData& key, const SkData& data) {
     return fGpu->precompileShader(key, data);
 }
 
+int GrDirectContext::precompileShaders(const sk_sp<SkData> keys[], const sk_sp<SkData> datas[],
+                                       int count, SkExecutor* executor) {
+    return fGpu->precompileShaders(keys, datas, count, executor);
+}
+
 #ifdef SK_ENABLE_DUMP_GPU
 #include "include/core/SkString.h"
 #include "src/utils/SkJSONWriter.h"
@@ -72,6 +72,15 @@ public:
 
     GrAuditTrail* auditTrail() { return fContext->auditTrail(); }
 
+    /**
+     * Queues an ops task timing whose bracketing timestamp queries are still pending. Resolved
+     * timings are returned by GrDirectContext::pollGpuTaskTimings().
+     */
+    void addGpuTaskTiming(SkString name, uint64_t beginTimestamp, uint64_t endTimestamp) {
+        fContext->fPendingGpuTaskTimings.push_back(
+                {std::move(name), beginTimestamp, endTimestamp});
+    }
+
     /**
      * Finalizes all pending reads and writes to the surfaces and also performs an MSAA resolves
      * if necessary. The GrSurfaceProxy array is treated as a hint. If it is supplied the context
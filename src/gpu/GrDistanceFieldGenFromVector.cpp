@@ -11,6 +11,8 @@
 #include "include/core/SkMatrix.h"
 #include "include/gpu/GrConfig.h"
 #include "include/private/SkTPin.h"
+#include "include/private/SkTemplates.h"
+#include "include/private/SkVx.h"
 #include "src/core/SkAutoMalloc.h"
 #include "src/core/SkGeometry.h"
 #include "src/core/SkPointPriv.h"
@@ -720,6 +722,29 @@ static unsigned char pack_distance_field_val(float dist) {
     return (unsigned char)SkScalarRoundToInt(dist / (2 * distanceMagnitude) * 256.0f);
 }
 
+// Packs a row of signed squared distances (negative means inside) four texels at a time,
+// matching pack_distance_field_val. The square root dominates the per-texel cost of the final
+// pass, so it is worth vectorizing.
+template <int distanceMagnitude>
+static void pack_distance_field_row(const float signedDistSq[], int width, unsigned char* out) {
+    int col = 0;
+    for (; col + 4 <= width; col += 4) {
+        auto d2 = skvx::Vec<4,float>::Load(signedDistSq + col);
+        // Invert the sign as pack_distance_field_val does: inside becomes positive. The
+        // unselected lane of each sqrt is NaN and discarded by the select.
+        auto dist = skvx::if_then_else(d2 < 0.0f, skvx::sqrt(-d2), -skvx::sqrt(d2));
+        dist = skvx::pin(dist, skvx::Vec<4,float>(-distanceMagnitude),
+                               skvx::Vec<4,float>(distanceMagnitude * 127.0f / 128.0f));
+        dist = (dist + distanceMagnitude) * (256.0f / (2 * distanceMagnitude));
+        skvx::cast<uint8_t>(skvx::round(dist)).store(out + col);
+    }
+    for (; col < width; ++col) {
+        const float d2 = signedDistSq[col];
+        const float dist = (d2 < 0.0f) ? -sqrtf(-d2) : sqrtf(d2);
+        out[col] = pack_distance_field_val<distanceMagnitude>(dist);
+    }
+}
+
 bool GrGenerateDistanceFieldFromPath(unsigned char* distanceField,
                                      const SkPath& path, const SkMatrix& drawMatrix,
                                      int width, int height, size_t rowBytes) {
@@ -805,6 +830,7 @@ bool GrGenerateDistanceFieldFromPath(unsigned char* distanceField,
     calculate_distance_field_data(&segments, dataPtr, width, height);
 
     // adjust distance based on winding
+    SkAutoSTMalloc<256, float> signedDistSq(width);
     for (int row = 0; row < height; ++row) {
         int windingNumber = 0; // Winding number start from zero for each scanline
         for (int col = 0; col < width; ++col) {
@@ -839,23 +865,15 @@ bool GrGenerateDistanceFieldFromPath(unsigned char* distanceField,
                 for (int col = 0; col < width; ++col) {
                     int idx = (row * width) + col;
                     dfSign = workingPath.contains(col + 0.5, row + 0.5) ? kInside : kOutside;
-                    const float miniDist = sqrt(dataPtr[idx].fDistSq);
-                    const float dist = dfSign * miniDist;
-
-                    unsigned char pixelVal = pack_distance_field_val<SK_DistanceFieldMagnitude>(dist);
-
-                    distanceField[(row * rowBytes) + col] = pixelVal;
+                    signedDistSq[col] = dfSign * dataPtr[idx].fDistSq;
                 }
-                continue;
+                break;
             }
 
-            const float miniDist = sqrt(dataPtr[idx].fDistSq);
-            const float dist = dfSign * miniDist;
-
-            unsigned char pixelVal = pack_distance_field_val<SK_DistanceFieldMagnitude>(dist);
-
-            distanceField[(row * rowBytes) + col] = pixelVal;
+            signedDistSq[col] = dfSign * dataPtr[idx].fDistSq;
         }
+        pack_distance_field_row<SK_DistanceFieldMagnitude>(signedDistSq.get(), width,
+                                                           &distanceField[row * rowBytes]);
     }
     return true;
 }
@@ -28,8 +28,13 @@ bool GrGenerateDistanceFieldFromPath(unsigned char* distanceField,
 
 inline bool IsDistanceFieldSupportedFillType(SkPathFillType fFillType)
 {
+    // The winding pass accumulates true crossing counts per scanline, so winding fills are
+    // handled as well as even-odd; rows whose count fails to close fall back to
+    // SkPath::contains.
     return (SkPathFillType::kEvenOdd == fFillType ||
-            SkPathFillType::kInverseEvenOdd == fFillType);
+            SkPathFillType::kInverseEvenOdd == fFillType ||
+            SkPathFillType::kWinding == fFillType ||
+            SkPathFillType::kInverseWinding == fFillType);
 }
 
 #endif
@@ -293,6 +293,10 @@ bool GrDrawOpAtlas::uploadToPage(unsigned int pageIdx, GrDeferredUploadTarget* t
 // are rare; i.e., we are not continually refreshing the frame.
 static constexpr auto kPlotRecentlyUsedCount = 32;
 static constexpr auto kAtlasRecentlyUsedCount = 128;
+// Cap on how many recently used plots a single compact() call will displace from the last page.
+// Draining the page incrementally spreads the re-rasterization of the displaced glyphs over
+// several flushes instead of landing it all on the next frame.
+static constexpr auto kMaxPlotsMigratedPerFlush = 2;
 
 GrDrawOpAtlas::ErrorCode GrDrawOpAtlas::addToAtlas(GrResourceProvider* resourceProvider,
                                                    GrDeferredUploadTarget* target,
@@ -412,6 +416,7 @@ void GrDrawOpAtlas::compact(GrDeferredUploadToken startTokenForNextFlush) {
     // For all plots, reset number of flushes since used if used this frame.
     PlotList::Iter plotIter;
     bool atlasUsedThisFlush = false;
+    int plotsUsedThisFlush = 0;
     for (uint32_t pageIndex = 0; pageIndex < fNumActivePages; ++pageIndex) {
         plotIter.init(fPages[pageIndex].fPlotList, PlotList::Iter::kHead_IterStart);
         while (Plot* plot = plotIter.get()) {
@@ -419,12 +424,25 @@ void GrDrawOpAtlas::compact(GrDeferredUploadToken startTokenForNextFlush) {
             if (plot->lastUseToken().inInterval(fPrevFlushToken, startTokenForNextFlush)) {
                 plot->resetFlushesSinceLastUsed();
                 atlasUsedThisFlush = true;
+                ++plotsUsedThisFlush;
             }
 
             plotIter.next();
         }
     }
 
+    // The trace framework retains the name pointer, so pick a static string per atlas flavor
+    // (each GrAtlasManager owns one atlas per mask format).
+    const char* counterName;
+    switch (fColorType) {
+        case GrColorType::kAlpha_8:   counterName = "skia atlas A8 plots";   break;
+        case GrColorType::kBGR_565:   counterName = "skia atlas 565 plots";  break;
+        case GrColorType::kRGBA_8888: counterName = "skia atlas 8888 plots"; break;
+        default:                      counterName = "skia atlas plots";      break;
+    }
+    TRACE_COUNTER2("skia.gpu.cache", counterName, "used", plotsUsedThisFlush,
+                   "free", fNumActivePages * fNumPlots - plotsUsedThisFlush);
+
     if (atlasUsedThisFlush) {
         fFlushesSinceLastUse = 0;
     } else {
@@ -518,24 +536,45 @@ void GrDrawOpAtlas::compact(GrDeferredUploadToken startTokenForNextFlush) {
         // to the first pages, this will eventually clear out usage of this page unless we have a
         // large need.
         if (availablePlots.count() && usedPlots && usedPlots <= fNumPlots / 4) {
+            // Gather the recently used plots so we can drain them most-idle-first; their glyphs
+            // are the least likely to be missed while they re-upload into earlier pages.
+            // We need to be somewhat harsh here so that a handful of plots that are
+            // consistently in use don't end up locking the page in memory.
+            SkSTArray<32, Plot*> warmPlots;
             plotIter.init(fPages[lastPageIndex].fPlotList, PlotList::Iter::kHead_IterStart);
             while (Plot* plot = plotIter.get()) {
-                // If this plot was used recently
                 if (plot->flushesSinceLastUsed() <= kPlotRecentlyUsedCount) {
-                    // See if there's room in an earlier page and if so evict.
-                    // We need to be somewhat harsh here so that a handful of plots that are
-                    // consistently in use don't end up locking the page in memory.
-                    if (availablePlots.count() > 0) {
-                        this->processEvictionAndResetRects(plot);
-                        this->processEvictionAndResetRects(availablePlots.back());
-                        availablePlots.pop_back();
-                        --usedPlots;
+                    warmPlots.push_back(plot);
+                }
+                plotIter.next();
+            }
+            // Displace a bounded number of plots per flush; compact() runs every flush, so the
+            // page still drains, just incrementally.
+            for (int migrations = std::min<int>(kMaxPlotsMigratedPerFlush, warmPlots.count());
+                 migrations > 0 && availablePlots.count();
+                 --migrations) {
+                int mostIdle = 0;
+                for (int i = 1; i < warmPlots.count(); ++i) {
+                    if (warmPlots[i]->flushesSinceLastUsed() >
+                        warmPlots[mostIdle]->flushesSinceLastUsed()) {
+                        mostIdle = i;
                     }
-                    if (!usedPlots || !availablePlots.count()) {
-                        break;
+                }
+                this->processEvictionAndResetRects(warmPlots[mostIdle]);
+                warmPlots.removeShuffle(mostIdle);
+                // Evict the coldest available plot: its glyphs are the least
+                // likely to be needed again, so clearing it costs the fewest
+                // re-rasterizations on pages that are still warm.
+                int coldest = 0;
+                for (int i = 1; i < availablePlots.count(); ++i) {
+                    if (availablePlots[i]->flushesSinceLastUsed() >
+                        availablePlots[coldest]->flushesSinceLastUsed()) {
+                        coldest = i;
                     }
                 }
-                plotIter.next();
+                this->processEvictionAndResetRects(availablePlots[coldest]);
+                availablePlots.removeShuffle(coldest);
+                --usedPlots;
             }
         }
 
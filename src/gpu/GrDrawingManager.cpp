@@ -42,6 +42,7 @@
 #include "src/gpu/GrTransferFromRenderTask.h"
 #include "src/gpu/GrWaitRenderTask.h"
 #include "src/gpu/GrWritePixelsRenderTask.h"
+#include "src/gpu/geometry/GrStyledShape.h"
 #include "src/gpu/text/GrSDFTControl.h"
 #include "src/image/SkSurface_Gpu.h"
 
@@ -72,7 +73,7 @@ GrDrawingManager::GrDrawingManager(GrRecordingContext* rContext, bool reduceOpsT
 
 GrDrawingManager::~GrDrawingManager() {
     this->closeAllTasks();
-    this->removeRenderTasks();
+    this->removeRenderTasks(&fDAG);
 }
 
 bool GrDrawingManager::wasAbandoned() const {
@@ -152,6 +153,8 @@ bool GrDrawingManager::flush(
     fActiveOpsTask = nullptr;
 
     this->sortTasks();
+    this->foldRedundantClears();
+    this->elideColorStores();
 
     if (!fCpuBufferCache) {
         // We cache more buffers when the backend is using client side arrays. Otherwise, we
@@ -174,8 +177,17 @@ bool GrDrawingManager::flush(
             }
         }
 
-        for (GrOnFlushCallbackObject* onFlushCBObject : fOnFlushCBObjects) {
-            onFlushCBObject->preFlush(&onFlushProvider, SkMakeSpan(fFlushingRenderTaskIDs));
+        // Schedule the atlas work in phases: instantiate every upload-only atlas before any
+        // atlas that renders its contents records render tasks. See AtlasPhase.
+        for (auto phase : {GrOnFlushCallbackObject::AtlasPhase::kUpload,
+                           GrOnFlushCallbackObject::AtlasPhase::kDefault,
+                           GrOnFlushCallbackObject::AtlasPhase::kRender}) {
+            for (GrOnFlushCallbackObject* onFlushCBObject : fOnFlushCBObjects) {
+                if (onFlushCBObject->atlasPhase() == phase) {
+                    onFlushCBObject->preFlush(&onFlushProvider,
+                                              SkMakeSpan(fFlushingRenderTaskIDs));
+                }
+            }
         }
         for (const auto& onFlushRenderTask : fOnFlushRenderTasks) {
             onFlushRenderTask->makeClosed(fContext);
@@ -209,21 +221,26 @@ bool GrDrawingManager::flush(
         }
     }
 
+    // Snapshot the sorted/clustered DAG and replay from the snapshot. Everything below
+    // only reads the snapshot and per-flush state, so tasks recorded mid-flush land in a
+    // fresh fDAG without perturbing the replay — the shape an off-thread replay needs.
+    SkTArray<sk_sp<GrRenderTask>> renderTasks = std::move(fDAG);
+
 #if 0
     // Enable this to print out verbose GrOp information
     SkDEBUGCODE(SkDebugf("onFlush renderTasks (%d):\n", fOnFlushRenderTasks.count()));
     for (const auto& onFlushRenderTask : fOnFlushRenderTasks) {
         SkDEBUGCODE(onFlushRenderTask->dump(/* printDependencies */ true);)
     }
-    SkDEBUGCODE(SkDebugf("Normal renderTasks (%d):\n", fDAG.count()));
-    for (const auto& task : fDAG) {
+    SkDEBUGCODE(SkDebugf("Normal renderTasks (%d):\n", renderTasks.count()));
+    for (const auto& task : renderTasks) {
         SkDEBUGCODE(task->dump(/* printDependencies */ true);)
     }
 #endif
 
     if (!resourceAllocator.failedInstantiation()) {
         if (!usingReorderedDAG) {
-            for (const auto& task : fDAG) {
+            for (const auto& task : renderTasks) {
                 SkASSERT(task);
                 task->gatherProxyIntervals(&resourceAllocator);
             }
@@ -232,8 +249,8 @@ bool GrDrawingManager::flush(
         resourceAllocator.assign();
     }
     bool flushed = !resourceAllocator.failedInstantiation() &&
-                    this->executeRenderTasks(&flushState);
-    this->removeRenderTasks();
+                    this->executeRenderTasks(SkMakeSpan(renderTasks), &flushState);
+    this->removeRenderTasks(&renderTasks);
 
     gpu->executeFlushInfo(proxies, access, info, newState);
 
@@ -269,21 +286,22 @@ bool GrDrawingManager::submitToGpu(bool syncToCpu) {
     return gpu->submitToGpu(syncToCpu);
 }
 
-bool GrDrawingManager::executeRenderTasks(GrOpFlushState* flushState) {
+bool GrDrawingManager::executeRenderTasks(SkSpan<sk_sp<GrRenderTask>> renderTasks,
+                                          GrOpFlushState* flushState) {
 #if GR_FLUSH_TIME_OP_SPEW
-    SkDebugf("Flushing %d opsTasks\n", fDAG.count());
-    for (int i = 0; i < fDAG.count(); ++i) {
-        if (fDAG[i]) {
+    SkDebugf("Flushing %d opsTasks\n", (int)renderTasks.size());
+    for (size_t i = 0; i < renderTasks.size(); ++i) {
+        if (renderTasks[i]) {
             SkString label;
-            label.printf("task %d/%d", i, fDAG.count());
-            fDAG[i]->dump(label, {}, true, true);
+            label.printf("task %d/%d", (int)i, (int)renderTasks.size());
+            renderTasks[i]->dump(label, {}, true, true);
         }
     }
 #endif
 
     bool anyRenderTasksExecuted = false;
 
-    for (const auto& renderTask : fDAG) {
+    for (const auto& renderTask : renderTasks) {
         if (!renderTask || !renderTask->isInstantiated()) {
              continue;
         }
@@ -320,7 +338,7 @@ bool GrDrawingManager::executeRenderTasks(GrOpFlushState* flushState) {
     fOnFlushRenderTasks.reset();
 
     // Execute the normal op lists.
-    for (const auto& renderTask : fDAG) {
+    for (const auto& renderTask : renderTasks) {
         SkASSERT(renderTask);
         if (!renderTask->isInstantiated()) {
             continue;
@@ -346,8 +364,8 @@ bool GrDrawingManager::executeRenderTasks(GrOpFlushState* flushState) {
     return anyRenderTasksExecuted;
 }
 
-void GrDrawingManager::removeRenderTasks() {
-    for (const auto& task : fDAG) {
+void GrDrawingManager::removeRenderTasks(SkTArray<sk_sp<GrRenderTask>>* renderTasks) {
+    for (const auto& task : *renderTasks) {
         SkASSERT(task);
         if (!task->unique() || task->requiresExplicitCleanup()) {
             // TODO: Eventually uniqueness should be guaranteed: http://skbug.com/7111.
@@ -357,7 +375,7 @@ void GrDrawingManager::removeRenderTasks() {
         }
         task->disown(this);
     }
-    fDAG.reset();
+    renderTasks->reset();
     fLastRenderTasks.reset();
     for (const sk_sp<GrRenderTask>& onFlushRenderTask : fOnFlushRenderTasks) {
         onFlushRenderTask->disown(this);
@@ -403,6 +421,60 @@ static void reorder_array_by_llist(const SkTInternalLList<T>& llist, SkTArray<sk
     SkASSERT(i == array->count());
 }
 
+void GrDrawingManager::foldRedundantClears() {
+    for (const auto& task : fDAG) {
+        GrOpsTask* opsTask = task ? task->asOpsTask() : nullptr;
+        if (!opsTask || opsTask->isSkippable() ||
+            !opsTask->fOpChains.empty() || GrLoadOp::kClear != opsTask->fColorLoadOp) {
+            continue;
+        }
+        if (opsTask->dependents().size() != 1) {
+            continue;
+        }
+        // With exactly one dependent, nothing else in this flush reads the cleared pixels.
+        GrOpsTask* next = opsTask->dependents()[0]->asOpsTask();
+        if (!next || next->isSkippable() || next->target(0) != opsTask->target(0)) {
+            continue;
+        }
+        if (next->fInitialStencilContent == GrOpsTask::StencilContent::kPreserved) {
+            // The next pass relies on the stencil state this pass's render pass leaves behind.
+            continue;
+        }
+        if (GrLoadOp::kLoad == next->fColorLoadOp) {
+            // Move the clear into the next pass's load op. The next task is already closed, so
+            // also grow its render pass bounds to cover the full attachment the clear touches.
+            next->fColorLoadOp = GrLoadOp::kClear;
+            next->fLoadClearColor = opsTask->fLoadClearColor;
+            next->fTotalBounds = next->target(0)->backingStoreBoundsRect();
+            next->fTotalBounds.roundOut(&next->fClippedContentBounds);
+        }
+        // Whether the clear was adopted as the next pass's load op or the next pass already
+        // clears or discards the whole attachment, this standalone clear pass is now dead.
+        opsTask->makeSkippable();
+    }
+}
+
+void GrDrawingManager::elideColorStores() {
+    for (const auto& task : fDAG) {
+        GrOpsTask* opsTask = task ? task->asOpsTask() : nullptr;
+        if (!opsTask || opsTask->dependents().size() != 1) {
+            continue;
+        }
+        // With exactly one dependent, nothing else in this flush reads the task's output; if
+        // that dependent overwrites the same attachment without loading it, the store is dead.
+        // (Future flushes only ever see the overwriter's contents, so they can't miss it.)
+        GrOpsTask* overwriter = opsTask->dependents()[0]->asOpsTask();
+        if (overwriter && !overwriter->isSkippable() &&
+            overwriter->target(0) == opsTask->target(0) &&
+            overwriter->overwritesColorAttachment()) {
+            opsTask->setColorStoreOp(GrStoreOp::kDiscard);
+            // The overwriting load op is now load-bearing: if reorderTasks merged the
+            // overwriter backward, its discard would vanish while the store stayed elided.
+            overwriter->setCannotMergeBackward();
+        }
+    }
+}
+
 bool GrDrawingManager::reorderTasks(GrResourceAllocator* resourceAllocator) {
     SkASSERT(fReduceOpsTaskSplitting);
     SkTInternalLList<GrRenderTask> llist;
@@ -917,6 +989,26 @@ bool GrDrawingManager::newWritePixelsTask(sk_sp<GrSurfaceProxy> dst,
 }
 
 #if SK_GPU_V1
+
+#if GR_GPU_STATS && GR_TEST_UTILS
+// Coarsely classifies a shape for the path renderer selection tally.
+static const char* shape_class(const GrStyledShape& shape) {
+    if (shape.style().isDashed()) {
+        return "dashed";
+    }
+    if (shape.style().isSimpleHairline()) {
+        return "hairline";
+    }
+    if (!shape.style().isSimpleFill()) {
+        return "styled";
+    }
+    if (shape.mayBeInverseFilledAfterStyling()) {
+        return "inverse_fill";
+    }
+    return shape.knownToBeConvex() ? "convex_fill" : "general_fill";
+}
+#endif
+
 /*
  * This method finds a path renderer that can draw the specified path on
  * the provided target.
@@ -947,6 +1039,13 @@ GrPathRenderer* GrDrawingManager::getPathRenderer(const GrPathRenderer::CanDrawP
     }
 #endif
 
+#if GR_GPU_STATS && GR_TEST_UTILS
+    if (pr) {
+        SkString key = SkStringPrintf("%s/%s", pr->name(), shape_class(*args.fShape));
+        fContext->priv().pathRendererStats().fSelectionCounts[key.c_str()]++;
+    }
+#endif
+
     return pr;
 }
 
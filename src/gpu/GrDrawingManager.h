@@ -166,13 +166,27 @@ private:
 
     void closeActiveOpsTask();
 
-    // return true if any GrRenderTasks were actually executed; false otherwise
-    bool executeRenderTasks(GrOpFlushState*);
+    // Replay a snapshot of the sorted/clustered DAG. Only reads the snapshot and
+    // per-flush state, so it stays valid if new tasks are recorded into fDAG
+    // mid-flush. Returns true if any GrRenderTasks were actually executed.
+    bool executeRenderTasks(SkSpan<sk_sp<GrRenderTask>>, GrOpFlushState*);
 
-    void removeRenderTasks();
+    void removeRenderTasks(SkTArray<sk_sp<GrRenderTask>>*);
 
     void sortTasks();
 
+    // Fold standalone clear passes into their successors: an ops task that does nothing but
+    // clear its color attachment is dead if the only consumer is a later ops task on the same
+    // target that clears, discards, or (after adopting the clear as its load op) overwrites it.
+    // Each folded task removes one whole render pass. Must run on the sorted, closed DAG.
+    void foldRedundantClears();
+
+    // Downgrade dead color-attachment stores to discards: if the only consumer of an ops task's
+    // color attachment is a later ops task that clears or discards the whole attachment on load,
+    // the earlier store never reaches visible pixels. On tiler GPUs each elided store saves a
+    // full tile-memory writeback. Must run on the sorted, closed DAG.
+    void elideColorStores();
+
     // Attempt to reorder tasks to reduce render passes, and check the memory budget of the
     // resulting intervals. Returns whether the reordering was successful & the memory budget
     // acceptable. If it returns true, fDAG has been updated to reflect the reordered tasks.
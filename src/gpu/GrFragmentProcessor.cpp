@@ -500,31 +500,51 @@ std::unique_ptr<GrFragmentProcessor> GrFragmentProcessor::Compose(
         return f;
     }
 
-    // Run an optimization pass on this composition.
+    // Flatten nested compositions into a single series, ordered by application. Composition is
+    // associative, so this canonicalizes equivalent trees that were assembled in different orders
+    // into a single shape (and a single program key), and it lets the color analysis below fold
+    // constants through the entire chain instead of just the outermost two links.
+    SkSTArray<4, std::unique_ptr<GrFragmentProcessor>> series;
+    auto flatten = [&](auto&& self, std::unique_ptr<GrFragmentProcessor> fp) -> void {
+        if (fp->classID() == kSeriesFragmentProcessor_ClassID) {
+            // Detach the children so they can be re-registered below. Composed children are
+            // always pass-through sampled, so only the registration bookkeeping is undone here.
+            for (int i = 1; i >= 0; --i) {  // child 1 (g) is applied before child 0 (f)
+                std::unique_ptr<GrFragmentProcessor> child = std::move(fp->fChildProcessors[i]);
+                child->fParent = nullptr;
+                child->fUsage = SkSL::SampleUsage();
+                self(self, std::move(child));
+            }
+        } else {
+            series.push_back(std::move(fp));
+        }
+    };
+    flatten(flatten, std::move(g));
+    flatten(flatten, std::move(f));
+
+    // Run an optimization pass on the series.
     GrProcessorAnalysisColor inputColor;
     inputColor.setToUnknown();
-
-    std::unique_ptr<GrFragmentProcessor> series[2] = {std::move(g), std::move(f)};
-    GrColorFragmentProcessorAnalysis info(inputColor, series, SK_ARRAY_COUNT(series));
+    GrColorFragmentProcessorAnalysis info(inputColor, series.begin(), series.count());
 
     SkPMColor4f knownColor;
     int leadingFPsToEliminate = info.initialProcessorsToEliminate(&knownColor);
-    switch (leadingFPsToEliminate) {
-        default:
-            // We shouldn't eliminate more than we started with.
-            SkASSERT(leadingFPsToEliminate <= 2);
-            [[fallthrough]];
-        case 0:
-            // Compose the two processors as requested.
-            return ComposeProcessor::Make(/*f=*/std::move(series[1]), /*g=*/std::move(series[0]));
-        case 1:
-            // Replace the first processor with a constant color.
-            return ComposeProcessor::Make(/*f=*/std::move(series[1]),
-                                          /*g=*/MakeColor(knownColor));
-        case 2:
-            // Replace the entire composition with a constant color.
-            return MakeColor(knownColor);
+    // We shouldn't eliminate more than we started with.
+    SkASSERT(leadingFPsToEliminate <= series.count());
+    if (leadingFPsToEliminate == series.count()) {
+        // Replace the entire composition with a constant color.
+        return MakeColor(knownColor);
+    }
+
+    // Rebuild the chain in canonical (right-leaning) form, replacing any eliminated leading
+    // processors with a constant color.
+    int i = leadingFPsToEliminate;
+    std::unique_ptr<GrFragmentProcessor> result =
+            (leadingFPsToEliminate > 0) ? MakeColor(knownColor) : std::move(series[i++]);
+    for (; i < series.count(); ++i) {
+        result = ComposeProcessor::Make(/*f=*/std::move(series[i]), /*g=*/std::move(result));
     }
+    return result;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/gpu/GrFramePipelineManager.h"
+
+#include "include/core/SkSurface.h"
+#include "include/gpu/GrDirectContext.h"
+#include "src/core/SkTraceEvent.h"
+
+GrFramePipelineManager::GrFramePipelineManager(GrDirectContext* dContext,
+                                               int maxFramesInFlight,
+                                               FrameFinishedProc finishedProc,
+                                               void* clientContext)
+        : fContext(dContext)
+        , fMaxFramesInFlight(std::max(maxFramesInFlight, 1))
+        , fFinishedProc(finishedProc)
+        , fClientContext(clientContext) {
+    SkASSERT(dContext);
+}
+
+GrFramePipelineManager::~GrFramePipelineManager() {
+    // The finished procs hold pointers back to this object, so every pending frame must drain
+    // before we go away. On an abandoned context the procs are called immediately, so this
+    // terminates there as well.
+    while (fFramesInFlight > 0) {
+        fContext->checkAsyncWorkCompletion();
+    }
+}
+
+void GrFramePipelineManager::PendingFrame::Finished(void* pendingFrame) {
+    auto* pending = static_cast<PendingFrame*>(pendingFrame);
+    GrFramePipelineManager* manager = pending->fManager;
+    SkASSERT(manager->fFramesInFlight > 0);
+    manager->fFramesInFlight--;
+    if (manager->fFinishedProc) {
+        manager->fFinishedProc(manager->fClientContext, pending->fFrameContext);
+    }
+    delete pending;
+}
+
+GrSemaphoresSubmitted GrFramePipelineManager::flushTaggedFrame(SkSurface* surface,
+                                                               void* frameContext) {
+    this->waitForFrameSlot();
+
+    auto* pending = new PendingFrame{this, frameContext};
+    GrFlushInfo info;
+    info.fFinishedProc = PendingFrame::Finished;
+    info.fFinishedContext = pending;
+    // The finished proc is guaranteed to be called even if the flush fails or the context is
+    // abandoned, so the count and the PendingFrame are reclaimed on every path.
+    fFramesInFlight++;
+    GrSemaphoresSubmitted result;
+    if (surface) {
+        result = surface->flush(SkSurface::BackendSurfaceAccess::kPresent, info);
+    } else {
+        result = fContext->flush(info);
+    }
+    fContext->submit();
+    return result;
+}
+
+GrSemaphoresSubmitted GrFramePipelineManager::flushFrameAndSubmit(void* frameContext) {
+    return this->flushTaggedFrame(nullptr, frameContext);
+}
+
+GrSemaphoresSubmitted GrFramePipelineManager::flushFrameAndSubmit(SkSurface* surface,
+                                                                  void* frameContext) {
+    SkASSERT(surface);
+    return this->flushTaggedFrame(surface, frameContext);
+}
+
+void GrFramePipelineManager::waitForFrameSlot() {
+    if (fFramesInFlight < fMaxFramesInFlight) {
+        return;
+    }
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
+    // Each check is one non-blocking fence query per pending frame; frames complete in
+    // submission order, so the oldest frame's fence gates the loop.
+    while (fFramesInFlight >= fMaxFramesInFlight) {
+        fContext->checkAsyncWorkCompletion();
+    }
+}
+
+void GrFramePipelineManager::checkForCompletedFrames() {
+    fContext->checkAsyncWorkCompletion();
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef GrFramePipelineManager_DEFINED
+#define GrFramePipelineManager_DEFINED
+
+#include "include/gpu/GrTypes.h"
+
+class GrDirectContext;
+class SkSurface;
+
+/**
+ * Tracks flushes that mark the end of a frame and bounds how many frames may be in flight on the
+ * GPU at once. Each frame costs a single finished-proc (one fence) rather than one per draw
+ * batch. When a frame's GPU work completes, an optional client callback is invoked with that
+ * frame's context pointer so per-frame resource sets (command pools, upload rings, etc.) can be
+ * recycled.
+ *
+ * All methods must be called from the thread that flushes the context (finished procs are
+ * invoked from flush, submit, and checkAsyncWorkCompletion on that same thread), mirroring the
+ * threading contract of GrDirectContext itself.
+ */
+class GrFramePipelineManager {
+public:
+    /**
+     * Called when the GPU has finished a frame's work. frameContext is the pointer that was
+     * passed to flushFrameAndSubmit for that frame.
+     */
+    using FrameFinishedProc = void (*)(void* clientContext, void* frameContext);
+
+    GrFramePipelineManager(GrDirectContext* dContext,
+                           int maxFramesInFlight = 2,
+                           FrameFinishedProc finishedProc = nullptr,
+                           void* clientContext = nullptr);
+
+    /** Waits for all in-flight frames, invoking the finished proc for each. */
+    ~GrFramePipelineManager();
+
+    /**
+     * Flushes and submits the context, counting the flush as the end of a frame. If
+     * maxFramesInFlight frames are already pending this first blocks until one completes, so a
+     * caller that draws and flushes in a loop is paced to the GPU. frameContext is handed back
+     * to the FrameFinishedProc when the GPU completes the frame.
+     */
+    GrSemaphoresSubmitted flushFrameAndSubmit(void* frameContext = nullptr);
+
+    /**
+     * As above, but flushes the surface (with BackendSurfaceAccess::kPresent) rather than the
+     * whole context, for clients that end their frame by presenting a surface.
+     */
+    GrSemaphoresSubmitted flushFrameAndSubmit(SkSurface* surface, void* frameContext = nullptr);
+
+    /**
+     * Blocks until fewer than maxFramesInFlight frames are pending, invoking finished procs for
+     * any frames that complete while waiting. flushFrameAndSubmit calls this itself; it is
+     * exposed so clients can take the wait before building the next frame's work instead.
+     */
+    void waitForFrameSlot();
+
+    /**
+     * Non-blocking: invokes the finished proc for any frames the GPU has completed.
+     */
+    void checkForCompletedFrames();
+
+    int framesInFlight() const { return fFramesInFlight; }
+    int maxFramesInFlight() const { return fMaxFramesInFlight; }
+
+private:
+    // Heap-allocated per frame; owns nothing. The context's finished proc deletes it.
+    struct PendingFrame {
+        static void Finished(void* pendingFrame);
+
+        GrFramePipelineManager* fManager;
+        void*                   fFrameContext;
+    };
+
+    GrSemaphoresSubmitted flushTaggedFrame(SkSurface* surface, void* frameContext);
+
+    GrDirectContext*  fContext;
+    int               fMaxFramesInFlight;
+    FrameFinishedProc fFinishedProc;
+    void*             fClientContext;
+    int               fFramesInFlight = 0;
+};
+
+#endif
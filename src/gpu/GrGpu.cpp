@@ -45,7 +45,13 @@ GrGpu::~GrGpu() {
 
 void GrGpu::initCapsAndCompiler(sk_sp<const GrCaps> caps) {
     fCaps = std::move(caps);
-    fCompiler = std::make_unique<SkSL::Compiler>(fCaps->shaderCaps());
+}
+
+SkSL::Compiler* GrGpu::shaderCompiler() const {
+    if (!fCompiler) {
+        fCompiler = std::make_unique<SkSL::Compiler>(fCaps->shaderCaps());
+    }
+    return fCompiler.get();
 }
 
 void GrGpu::disconnect(DisconnectType type) {}
@@ -593,7 +599,22 @@ void GrGpu::didWriteToSurface(GrSurface* surface, GrSurfaceOrigin origin, const
         GrTexture* texture = surface->asTexture();
         if (texture) {
             if (mipLevels == 1) {
-                texture->markMipmapsDirty();
+                if (bounds) {
+                    SkIRect dirtyRect = *bounds;
+                    if (kBottomLeft_GrSurfaceOrigin == origin) {
+                        dirtyRect.setLTRB(dirtyRect.left(),
+                                          surface->height() - dirtyRect.bottom(),
+                                          dirtyRect.right(),
+                                          surface->height() - dirtyRect.top());
+                    }
+                    if (dirtyRect.intersect(SkIRect::MakeSize(surface->dimensions()))) {
+                        texture->markMipmapsDirty(dirtyRect);
+                    } else {
+                        texture->markMipmapsDirty();
+                    }
+                } else {
+                    texture->markMipmapsDirty();
+                }
             } else {
                 texture->markMipmapsClean();
             }
@@ -702,6 +723,17 @@ void GrGpu::reportSubmitHistograms() {
     this->onReportSubmitHistograms();
 }
 
+int GrGpu::precompileShaders(const sk_sp<SkData> keys[], const sk_sp<SkData> datas[],
+                             int count, SkExecutor*) {
+    int compiled = 0;
+    for (int i = 0; i < count; ++i) {
+        if (keys[i] && datas[i] && this->precompileShader(*keys[i], *datas[i])) {
+            ++compiled;
+        }
+    }
+    return compiled;
+}
+
 bool GrGpu::checkAndResetOOMed() {
     if (fOOMed) {
         fOOMed = false;
@@ -744,10 +776,14 @@ void GrGpu::Stats::dump(SkString* out) {
     out->appendf("MSAA Attachment Creates: %d\n", fMSAAAttachmentCreates);
     out->appendf("Number of draws: %d\n", fNumDraws);
     out->appendf("Number of Scratch Textures reused %d\n", fNumScratchTexturesReused);
+    out->appendf("Number of Scratch Textures reused (approx size class) %d\n",
+                 fNumScratchTexturesApproxReused);
     out->appendf("Number of Scratch MSAA Attachments reused %d\n",
                  fNumScratchMSAAAttachmentsReused);
     out->appendf("Number of Render Passes: %d\n", fRenderPasses);
     out->appendf("Reordered DAGs Over Budget: %d\n", fNumReorderedDAGsOverBudget);
+    out->appendf("Redundant texture binds filtered: %d\n", fNumRedundantTextureBinds);
+    out->appendf("Redundant program binds filtered: %d\n", fNumRedundantProgramBinds);
 
     // enable this block to output CSV-style stats for program pre-compilation
 #if 0
@@ -770,6 +806,10 @@ void GrGpu::Stats::dumpKeyValuePairs(SkTArray<SkString>* keys, SkTArray<double>*
     values->push_back(fRenderPasses);
     keys->push_back(SkString("reordered_dags_over_budget"));
     values->push_back(fNumReorderedDAGsOverBudget);
+    keys->push_back(SkString("redundant_texture_binds"));
+    values->push_back(fNumRedundantTextureBinds);
+    keys->push_back(SkString("redundant_program_binds"));
+    values->push_back(fNumRedundantProgramBinds);
 }
 
 #endif // GR_GPU_STATS
@@ -41,6 +41,7 @@ class GrStencilSettings;
 class GrSurface;
 class GrTexture;
 class GrThreadSafePipelineBuilder;
+class SkExecutor;
 class SkJSONWriter;
 
 namespace SkSL {
@@ -65,7 +66,9 @@ public:
 
     virtual GrRingBuffer* uniformsRingBuffer() { return nullptr; }
 
-    SkSL::Compiler* shaderCompiler() const { return fCompiler.get(); }
+    // The compiler is created on first use to keep context creation off the shader-compiler
+    // startup cost; contexts that only use backend-binary cached programs never pay it.
+    SkSL::Compiler* shaderCompiler() const;
 
     enum class DisconnectType {
         // No cleanup should be attempted, immediately cease making backend API calls
@@ -380,6 +383,20 @@ public:
     virtual bool waitFence(GrFence) = 0;
     virtual void deleteFence(GrFence) const = 0;
 
+    /**
+     * Writes a backend timestamp into the command stream and returns an opaque nonzero handle
+     * for it, or 0 if the backend can't time GPU work (see GrCaps::timestampQuerySupport).
+     */
+    virtual uint64_t insertGpuTimestamp() { return 0; }
+    /**
+     * Polls a previously inserted timestamp. Returns true and writes the GPU time in
+     * nanoseconds once the GPU has executed past it, deleting the query; returns false while
+     * the result is still pending.
+     */
+    virtual bool getGpuTimestampResult(uint64_t, uint64_t* /*nanos*/) { return false; }
+    /** Deletes a pending timestamp without reading it. */
+    virtual void deleteGpuTimestamp(uint64_t) {}
+
     virtual std::unique_ptr<GrSemaphore> SK_WARN_UNUSED_RESULT makeSemaphore(
             bool isOwned = true) = 0;
     virtual std::unique_ptr<GrSemaphore> wrapBackendSemaphore(const GrBackendSemaphore&,
@@ -456,6 +473,11 @@ public:
         int numScratchTexturesReused() const { return fNumScratchTexturesReused; }
         void incNumScratchTexturesReused() { ++fNumScratchTexturesReused; }
 
+        // Counts the subset of reuses above that only hit because the request was rounded up
+        // to an approximate-fit size class; exact hits are the difference.
+        int numScratchTexturesApproxReused() const { return fNumScratchTexturesApproxReused; }
+        void incNumScratchTexturesApproxReused() { ++fNumScratchTexturesApproxReused; }
+
         int numScratchMSAAAttachmentsReused() const { return fNumScratchMSAAAttachmentsReused; }
         void incNumScratchMSAAAttachmentsReused() { ++fNumScratchMSAAAttachmentsReused; }
 
@@ -465,6 +487,15 @@ public:
         int numReorderedDAGsOverBudget() const { return fNumReorderedDAGsOverBudget; }
         void incNumReorderedDAGsOverBudget() { fNumReorderedDAGsOverBudget++; }
 
+        // Binds that the backend's shadowed state filtered out before reaching the driver.
+        // Large counts here usually mean a client is resetting more context state than it
+        // actually dirtied (see GrDirectContext::resetContext).
+        int numRedundantTextureBinds() const { return fNumRedundantTextureBinds; }
+        void incNumRedundantTextureBinds() { fNumRedundantTextureBinds++; }
+
+        int numRedundantProgramBinds() const { return fNumRedundantProgramBinds; }
+        void incNumRedundantProgramBinds() { fNumRedundantProgramBinds++; }
+
 #if GR_TEST_UTILS
         void dump(SkString*);
         void dumpKeyValuePairs(SkTArray<SkString>* keys, SkTArray<double>* values);
@@ -480,9 +511,12 @@ public:
         int fNumFailedDraws = 0;
         int fNumSubmitToGpus = 0;
         int fNumScratchTexturesReused = 0;
+        int fNumScratchTexturesApproxReused = 0;
         int fNumScratchMSAAAttachmentsReused = 0;
         int fRenderPasses = 0;
         int fNumReorderedDAGsOverBudget = 0;
+        int fNumRedundantTextureBinds = 0;
+        int fNumRedundantProgramBinds = 0;
 
 #else  // !GR_GPU_STATS
 
@@ -500,9 +534,12 @@ public:
         void incNumFailedDraws() {}
         void incNumSubmitToGpus() {}
         void incNumScratchTexturesReused() {}
+        void incNumScratchTexturesApproxReused() {}
         void incNumScratchMSAAAttachmentsReused() {}
         void incRenderPasses() {}
         void incNumReorderedDAGsOverBudget() {}
+        void incNumRedundantTextureBinds() {}
+        void incNumRedundantProgramBinds() {}
 #endif
     };
 
@@ -575,6 +612,13 @@ public:
 
     virtual bool precompileShader(const SkData& key, const SkData& data) { return false; }
 
+    // Precompiles a batch of cached shaders. Backends that can split compilation into a
+    // thread-safe translation phase run that phase on the executor's threads; the base
+    // implementation just loops over precompileShader() on the calling thread. Returns the
+    // number of shaders successfully compiled.
+    virtual int precompileShaders(const sk_sp<SkData> keys[], const sk_sp<SkData> datas[],
+                                  int count, SkExecutor*);
+
 #if GR_TEST_UTILS
     /** Check a handle represents an actual texture in the backend API that has not been freed. */
     virtual bool isTestingOnlyBackendTexture(const GrBackendTexture&) const = 0;
@@ -815,7 +859,7 @@ private:
     sk_sp<const GrCaps>             fCaps;
     // Compiler used for compiling SkSL into backend shader code. We only want to create the
     // compiler once, as there is significant overhead to the first compile.
-    std::unique_ptr<SkSL::Compiler> fCompiler;
+    mutable std::unique_ptr<SkSL::Compiler> fCompiler;
 
     uint32_t fResetBits;
     // The context owns us, not vice-versa, so this ptr is not ref'ed by Gpu.
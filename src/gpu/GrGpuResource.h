@@ -297,6 +297,9 @@ private:
     // This value reflects how recently this resource was accessed in the cache. This is maintained
     // by the cache.
     uint32_t fTimestamp;
+    // The budget partition this resource is accounted against, stamped by the cache at insertion
+    // from its active partition. 0 is the default (shared) partition.
+    uint32_t fPartition = 0;
     GrStdSteadyClock::time_point fTimeWhenBecamePurgeable;
 
     static const size_t kInvalidGpuMemorySize = ~static_cast<size_t>(0);
@@ -71,6 +71,9 @@ private:
     uint32_t timestamp() const { return fResource->fTimestamp; }
     void setTimestamp(uint32_t ts) { fResource->fTimestamp = ts; }
 
+    uint32_t partition() const { return fResource->fPartition; }
+    void setPartition(uint32_t partition) { fResource->fPartition = partition; }
+
     void setTimeWhenResourceBecomePurgeable() {
         SkASSERT(fResource->isPurgeable());
         fResource->fTimeWhenBecamePurgeable = GrStdSteadyClock::now();
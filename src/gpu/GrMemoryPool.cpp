@@ -7,8 +7,10 @@
 
 #include "src/gpu/GrMemoryPool.h"
 
+#include "include/private/SkMallocTag.h"
 #include "include/private/SkTPin.h"
 #include "src/core/SkASAN.h"
+#include "src/core/SkTraceEvent.h"
 
 #ifdef SK_DEBUG
     #include <atomic>
@@ -60,9 +62,15 @@ void GrMemoryPool::reportLeaks() const {
 
 void* GrMemoryPool::allocate(size_t size) {
     static_assert(alignof(Header) <= kAlignment);
+    SkAutoMallocTag autoTag(SkMallocTag::kGpu);
     SkDEBUGCODE(this->validate();)
 
+    size_t sizeBefore = fAllocator.totalSize();
     GrBlockAllocator::ByteRange alloc = fAllocator.allocate<kAlignment, sizeof(Header)>(size);
+    if (fAllocator.totalSize() != sizeBefore) {
+        // Only publish the counter when a block was added, to keep the common path cheap.
+        TRACE_COUNTER1("skia.gpu", "skia op pool", this->size());
+    }
 
     // Initialize GrMemoryPool's custom header at the start of the allocation
     Header* header = static_cast<Header*>(alloc.fBlock->ptr(alloc.fAlignedOffset - sizeof(Header)));
@@ -121,8 +129,15 @@ void GrMemoryPool::release(void* p) {
 
     int alive = block->metadata();
     if (alive == 1) {
+        if (fRetainAtHighWater) {
+            // Raise the retention budget to the pool's current footprint so that blocks released
+            // as this cycle winds down are kept for the next one.
+            fAllocator.setScratchBlockBudget(
+                    std::max(fAllocator.scratchBlockBudget(), this->size()));
+        }
         // This was last allocation in the block, so remove it
         fAllocator.releaseBlock(block);
+        TRACE_COUNTER1("skia.gpu", "skia op pool", this->size());
     } else {
         // Update count and release storage of the allocation itself
         block->setMetadata(alive - 1);
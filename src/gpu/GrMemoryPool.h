@@ -91,6 +91,25 @@ public:
         return offsetof(GrMemoryPool, fAllocator) + fAllocator.preallocSize();
     }
 
+    /**
+     * When enabled, released heap blocks are retained for reuse up to the pool's high-water
+     * footprint rather than only the single largest one. A workload with a stable per-cycle
+     * allocation pattern (e.g. ops recorded per frame) then reaches a steady state where no
+     * cycle allocates blocks from, or returns blocks to, the heap. The retained bytes are
+     * reported by scratchSpaceUsage() and can be returned with resetScratchSpace().
+     */
+    void setRetainBlocksAtHighWaterMark(bool retain) {
+        fRetainAtHighWater = retain;
+        if (!retain) {
+            fAllocator.setScratchBlockBudget(0);
+        }
+    }
+
+    /**
+     * Returns the number of bytes currently held for reuse in released blocks.
+     */
+    size_t scratchSpaceUsage() const { return fAllocator.scratchBlockUsage(); }
+
     /**
      * Frees any scratch blocks that are no longer being used.
      */
@@ -118,6 +137,8 @@ private:
 
     GrMemoryPool(size_t preallocSize, size_t minAllocSize);
 
+    bool fRetainAtHighWater = false;
+
 #ifdef SK_DEBUG
     SkTHashSet<int>  fAllocatedIDs;
     int              fAllocationCount;
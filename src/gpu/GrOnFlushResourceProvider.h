@@ -29,6 +29,18 @@ class GrOnFlushCallbackObject {
 public:
     virtual ~GrOnFlushCallbackObject() {}
 
+    /**
+     * Where in the preFlush sequence this object's atlas work belongs. Upload-only atlases
+     * (glyphs, small path masks) run first so their backing textures instantiate together and
+     * their pending page uploads form one contiguous batch. Atlases that render their contents
+     * (e.g. the tessellation path atlas) run last so everything they consume already exists and
+     * the render tasks they record stay contiguous rather than interleaving render-pass switches
+     * with upload work, which is especially costly on tiled GPUs.
+     */
+    enum class AtlasPhase : int8_t { kUpload, kDefault, kRender };
+
+    virtual AtlasPhase atlasPhase() const { return AtlasPhase::kDefault; }
+
     /*
      * The preFlush callback allows subsystems (e.g., text, path renderers) to create atlases
      * for a specific flush. All the GrRenderTask IDs required for the flush are passed into the
@@ -7,6 +7,7 @@
 
 #include "src/gpu/GrOpsTask.h"
 
+#include "include/core/SkRegion.h"
 #include "include/gpu/GrRecordingContext.h"
 #include "src/core/SkRectPriv.h"
 #include "src/core/SkScopeExit.h"
@@ -14,6 +15,7 @@
 #include "src/gpu/GrAttachment.h"
 #include "src/gpu/GrAuditTrail.h"
 #include "src/gpu/GrCaps.h"
+#include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/GrGpu.h"
 #include "src/gpu/GrMemoryPool.h"
 #include "src/gpu/GrOpFlushState.h"
@@ -32,6 +34,12 @@
 // Experimentally we have found that most combining occurs within the first 10 comparisons.
 static const int kMaxOpMergeDistance = 10;
 static const int kMaxOpChainDistance = 10;
+// How far back a chain may be moved when grouping chains of the same op class together. Larger
+// windows regroup streams that alternate more states, at the cost of a longer overlap scan.
+static const int kMaxOpGroupingDistance = 32;
+// Cap on the number of opaque occluder rects accumulated while culling occluded chains,
+// bounding the size of the coverage region.
+static const int kMaxOccluders = 16;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -118,10 +126,12 @@ inline void GrOpsTask::OpChain::List::validate() const {
 ////////////////////////////////////////////////////////////////////////////////
 
 GrOpsTask::OpChain::OpChain(GrOp::Owner op, GrProcessorSet::Analysis processorAnalysis,
-                            GrAppliedClip* appliedClip, const GrDstProxyView* dstProxyView)
+                            GrAppliedClip* appliedClip, const GrDstProxyView* dstProxyView,
+                            bool isDraw)
         : fList{std::move(op)}
         , fProcessorAnalysis(processorAnalysis)
-        , fAppliedClip(appliedClip) {
+        , fAppliedClip(appliedClip)
+        , fIsDraw(isDraw) {
     if (fProcessorAnalysis.requiresDstTexture()) {
         SkASSERT(dstProxyView && dstProxyView->proxy());
         fDstProxyView = *dstProxyView;
@@ -129,6 +139,35 @@ GrOpsTask::OpChain::OpChain(GrOp::Owner op, GrProcessorSet::Analysis processorAn
     fBounds = fList.head()->bounds();
 }
 
+bool GrOpsTask::OpChain::occludesBounds() const {
+    // A clip could reduce coverage and a second op in the list means fBounds is a union that
+    // neither op covers alone.
+    if (!fIsDraw || fAppliedClip || fList.head() != fList.tail()) {
+        return false;
+    }
+    GrOp* op = fList.head();
+    if (op->hasAABloat() || op->hasZeroArea()) {
+        return false;
+    }
+    if (!fProcessorAnalysis.isInitialized() || !fProcessorAnalysis.unaffectedByDstValue()) {
+        return false;
+    }
+    auto* drawOp = static_cast<GrDrawOp*>(op);
+    return !drawOp->usesStencil() && drawOp->fillsBoundsExactly();
+}
+
+bool GrOpsTask::OpChain::skippableWhenOccluded() const {
+    if (!fIsDraw || fList.empty()) {
+        return false;
+    }
+    for (const auto& op : GrOp::ChainRange<>(fList.head())) {
+        if (static_cast<const GrDrawOp&>(op).usesStencil()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void GrOpsTask::OpChain::visitProxies(const GrVisitProxyFunc& func) const {
     if (fList.empty()) {
         return;
@@ -415,7 +454,7 @@ void GrOpsTask::addDrawOp(GrDrawingManager* drawingMgr, GrOp::Owner op, bool use
     }
 
     this->recordOp(std::move(op), usesMSAA, processorAnalysis, clip.doesClip() ? &clip : nullptr,
-                   &dstProxyView, caps);
+                   &dstProxyView, caps, /*isDraw=*/true);
 }
 
 void GrOpsTask::endFlush(GrDrawingManager* drawingMgr) {
@@ -505,6 +544,7 @@ static GrOpsRenderPass* create_render_pass(GrGpu* gpu,
                                            GrSurfaceOrigin origin,
                                            const SkIRect& bounds,
                                            GrLoadOp colorLoadOp,
+                                           GrStoreOp colorStoreOp,
                                            const std::array<float, 4>& loadClearColor,
                                            GrLoadOp stencilLoadOp,
                                            GrStoreOp stencilStoreOp,
@@ -512,7 +552,7 @@ static GrOpsRenderPass* create_render_pass(GrGpu* gpu,
                                            GrXferBarrierFlags renderPassXferBarriers) {
     const GrOpsRenderPass::LoadAndStoreInfo kColorLoadStoreInfo {
         colorLoadOp,
-        GrStoreOp::kStore,
+        colorStoreOp,
         loadClearColor
     };
 
@@ -618,6 +658,7 @@ bool GrOpsTask::onExecute(GrOpFlushState* flushState) {
                                                      fTargetOrigin,
                                                      fClippedContentBounds,
                                                      fColorLoadOp,
+                                                     fColorStoreOp,
                                                      fLoadClearColor,
                                                      stencilLoadOp,
                                                      stencilStoreOp,
@@ -627,6 +668,13 @@ bool GrOpsTask::onExecute(GrOpFlushState* flushState) {
     if (!renderPass) {
         return false;
     }
+
+    GrGpu* gpu = flushState->gpu();
+    uint64_t beginTimestamp = 0;
+    if (gpu->getContext()->priv().options().fEnableGpuTimestampQueries) {
+        beginTimestamp = gpu->insertGpuTimestamp();
+    }
+
     flushState->setOpsRenderPass(renderPass);
     renderPass->begin();
 
@@ -658,6 +706,25 @@ bool GrOpsTask::onExecute(GrOpFlushState* flushState) {
     flushState->gpu()->submit(renderPass);
     flushState->setOpsRenderPass(nullptr);
 
+    if (beginTimestamp) {
+        if (uint64_t endTimestamp = gpu->insertGpuTimestamp()) {
+            // Name the timing after the first op and the chain count; this is the same op
+            // metadata the audit trail records.
+            const char* firstOpName = "no-op";
+            for (const auto& chain : fOpChains) {
+                if (chain.head()) {
+                    firstOpName = chain.head()->name();
+                    break;
+                }
+            }
+            gpu->getContext()->priv().addGpuTaskTiming(
+                    SkStringPrintf("%s (%d chains)", firstOpName, fOpChains.count()),
+                    beginTimestamp, endTimestamp);
+        } else {
+            gpu->deleteGpuTimestamp(beginTimestamp);
+        }
+    }
+
     return true;
 }
 
@@ -949,7 +1016,8 @@ void GrOpsTask::gatherProxyIntervals(GrResourceAllocator* alloc) const {
 
 void GrOpsTask::recordOp(
         GrOp::Owner op, bool usesMSAA, GrProcessorSet::Analysis processorAnalysis,
-        GrAppliedClip* clip, const GrDstProxyView* dstProxyView, const GrCaps& caps) {
+        GrAppliedClip* clip, const GrDstProxyView* dstProxyView, const GrCaps& caps,
+        bool isDraw) {
     GrSurfaceProxy* proxy = this->target(0);
 #ifdef SK_DEBUG
     op->validate();
@@ -1015,7 +1083,88 @@ void GrOpsTask::recordOp(
         clip = fArenas->arenaAlloc()->make<GrAppliedClip>(std::move(*clip));
         SkDEBUGCODE(fNumClips++;)
     }
-    fOpChains.emplace_back(std::move(op), processorAnalysis, clip, dstProxyView);
+    fOpChains.emplace_back(std::move(op), processorAnalysis, clip, dstProxyView, isDraw);
+}
+
+void GrOpsTask::cullOccludedChains() {
+    SkASSERT(!this->isClosed());
+    GrOP_INFO("opsTask: %d CullOccludedChains %d chains:\n", this->uniqueID(), fOpChains.count());
+
+    // Accumulated coverage of the opaque draws seen so far in the front-to-back walk. Keeping
+    // a region (rather than testing occluder rects individually) also culls draws hidden only
+    // by the union of several opaque draws - the common case for panel-style UIs - which is
+    // the same set a depth-tested front-to-back pass would reject.
+    SkRegion occlusion;
+    int numOccluders = 0;
+    int numCulled = 0;
+    for (int i = fOpChains.count() - 1; i >= 0; --i) {
+        OpChain& chain = fOpChains[i];
+        if (!occlusion.isEmpty() && chain.skippableWhenOccluded()) {
+            SkIRect outerBounds;
+            chain.bounds().roundOut(&outerBounds);
+            if (occlusion.contains(outerBounds)) {
+                GrOP_INFO("\t\t%d: chain (%s, head opID: %u) -> Culled as occluded\n",
+                          i, chain.head()->name(), chain.head()->uniqueID());
+                chain.deleteOps();
+                ++numCulled;
+                continue;
+            }
+        }
+        if (numOccluders < kMaxOccluders && chain.occludesBounds()) {
+            // Round the occluder inward so coverage is conservative on fractional edges.
+            SkIRect innerBounds;
+            chain.bounds().roundIn(&innerBounds);
+            if (!innerBounds.isEmpty()) {
+                occlusion.op(innerBounds, SkRegion::kUnion_Op);
+                ++numOccluders;
+            }
+        }
+    }
+
+    if (numCulled) {
+        // Compact out the emptied chains so the later passes can assume non-null heads.
+        int w = 0;
+        for (int i = 0; i < fOpChains.count(); ++i) {
+            if (fOpChains[i].shouldExecute()) {
+                if (w != i) {
+                    fOpChains[w] = std::move(fOpChains[i]);
+                }
+                ++w;
+            }
+        }
+        fOpChains.pop_back_n(fOpChains.count() - w);
+    }
+}
+
+void GrOpsTask::groupCompatibleChains() {
+    SkASSERT(!this->isClosed());
+    GrOP_INFO("opsTask: %d GroupCompatibleChains %d chains:\n",
+              this->uniqueID(), fOpChains.count());
+
+    for (int i = 1; i < fOpChains.count(); ++i) {
+        uint32_t classID = fOpChains[i].head()->classID();
+        // Scan backward for the nearest chain of the same op class, stopping at the window edge
+        // or at the first chain whose bounds forbid reordering.
+        int target = -1;
+        int stop = std::max(0, i - kMaxOpGroupingDistance);
+        for (int j = i - 1; j >= stop; --j) {
+            if (fOpChains[j].head()->classID() == classID) {
+                target = j + 1;
+                break;
+            }
+            if (!can_reorder(fOpChains[j].bounds(), fOpChains[i].bounds())) {
+                break;
+            }
+        }
+        if (target >= 0 && target < i) {
+            // Every chain in [target, i) has a different class and doesn't overlap chain i, so
+            // sliding chain i down to 'target' preserves painter's order.
+            GrOP_INFO("\t\t%d: chain (%s, head opID: %u) -> Grouped at %d\n",
+                      i, fOpChains[i].head()->name(), fOpChains[i].head()->uniqueID(), target);
+            std::rotate(fOpChains.begin() + target, fOpChains.begin() + i,
+                        fOpChains.begin() + i + 1);
+        }
+    }
 }
 
 void GrOpsTask::forwardCombine(const GrCaps& caps) {
@@ -1051,6 +1200,10 @@ void GrOpsTask::forwardCombine(const GrCaps& caps) {
 
 GrRenderTask::ExpectedOutcome GrOpsTask::onMakeClosed(GrRecordingContext* rContext,
                                                       SkIRect* targetUpdateBounds) {
+    if (rContext->priv().options().fCullOccludedDraws) {
+        this->cullOccludedChains();
+    }
+    this->groupCompatibleChains();
     this->forwardCombine(*rContext->priv().caps());
     if (!this->isColorNoOp()) {
         GrSurfaceProxy* proxy = this->target(0);
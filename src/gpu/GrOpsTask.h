@@ -132,7 +132,7 @@ protected:
     }
 
     void recordOp(GrOp::Owner, bool usesMSAA, GrProcessorSet::Analysis, GrAppliedClip*,
-                  const GrDstProxyView*, const GrCaps&);
+                  const GrDstProxyView*, const GrCaps&, bool isDraw = false);
 
     ExpectedOutcome onMakeClosed(GrRecordingContext*, SkIRect* targetUpdateBounds) override;
 
@@ -154,9 +154,23 @@ private:
     // resolve its texture.
     void setCannotMergeBackward() { fCannotMergeBackward = true; }
 
+    // True if executing this task begins a render pass that overwrites the entire color
+    // attachment without reading it back. Mirrors the early-out in onExecute: a task that skips
+    // its render pass leaves the attachment's prior contents alive. Only valid once closed.
+    bool overwritesColorAttachment() const {
+        bool skipsExecution = this->isColorNoOp() ||
+                (fClippedContentBounds.isEmpty() && fColorLoadOp != GrLoadOp::kDiscard);
+        return !skipsExecution && fColorLoadOp != GrLoadOp::kLoad;
+    }
+
+    // Called by GrDrawingManager::elideColorStores when a later task overwrites this task's
+    // whole color attachment before anyone reads it, making the store dead bandwidth on tilers.
+    void setColorStoreOp(GrStoreOp op) { fColorStoreOp = op; }
+
     class OpChain {
     public:
-        OpChain(GrOp::Owner, GrProcessorSet::Analysis, GrAppliedClip*, const GrDstProxyView*);
+        OpChain(GrOp::Owner, GrProcessorSet::Analysis, GrAppliedClip*, const GrDstProxyView*,
+                bool isDraw);
         ~OpChain() {
             // The ops are stored in a GrMemoryPool and must be explicitly deleted via the pool.
             SkASSERT(fList.empty());
@@ -194,6 +208,14 @@ private:
             return SkToBool(this->head());
         }
 
+        // True if executing this chain overwrites every pixel inside its bounds with a value
+        // independent of the destination, making it an occluder for earlier chains.
+        bool occludesBounds() const;
+
+        // True if dropping this chain changes nothing but the color values it would have drawn:
+        // it contains only draws and none of them touch the stencil buffer.
+        bool skippableWhenOccluded() const;
+
     private:
         class List {
         public:
@@ -230,6 +252,8 @@ private:
         GrDstProxyView fDstProxyView;
         GrAppliedClip* fAppliedClip;
         SkRect fBounds;
+        // True if the chain was recorded via addDrawOp, i.e. every op in it is a GrDrawOp.
+        bool fIsDraw;
     };
 
     void onMakeSkippable() override;
@@ -238,6 +262,16 @@ private:
 
     void gatherProxyIntervals(GrResourceAllocator*) const override;
 
+    // Reverse-scans the chains collecting the bounds of opaque full-coverage draws and deletes
+    // any earlier chain wholly covered by one of them, since it can never contribute to the
+    // final image.
+    void cullOccludedChains();
+
+    // Moves each chain backward past non-overlapping chains (within a bounded window) until it
+    // sits next to the previous chain of the same op class, so the execution order alternates
+    // pipelines less and forwardCombine() sees more mergeable neighbors.
+    void groupCompatibleChains();
+
     void forwardCombine(const GrCaps&);
 
     // Remove all ops, proxies, etc. Used in the merging algorithm when tasks can be skipped.
@@ -245,6 +279,10 @@ private:
 
     friend class OpsTaskTestingAccess;
 
+    // The drawing manager runs a flush-time pass over the sorted DAG to downgrade dead
+    // attachment stores (see elideColorStores).
+    friend class GrDrawingManager;
+
     // The RTC and OpsTask have to work together to handle buffer clears. In most cases, buffer
     // clearing can be done natively, in which case the op list's load ops are sufficient. In other
     // cases, draw ops must be used, which makes the RTC the best place for those decisions. This,
@@ -258,6 +296,7 @@ private:
     GrSurfaceOrigin fTargetOrigin;
 
     GrLoadOp fColorLoadOp = GrLoadOp::kLoad;
+    GrStoreOp fColorStoreOp = GrStoreOp::kStore;
     std::array<float, 4> fLoadClearColor = {0, 0, 0, 0};
     StencilContent fInitialStencilContent = StencilContent::kDontCare;
     bool fMustPreserveStencil = false;
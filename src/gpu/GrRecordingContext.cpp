@@ -252,6 +252,29 @@ void GrRecordingContext::DMSAAStats::merge(const DMSAAStats& stats) {
     }
 }
 
+void GrRecordingContext::PathRendererStats::dumpKeyValuePairs(SkTArray<SkString>* keys,
+                                                              SkTArray<double>* values) const {
+    for (const auto& [name, count] : fSelectionCounts) {
+        keys->push_back(SkStringPrintf("path_renderer_%s", name.c_str()));
+        values->push_back(count);
+    }
+}
+
+void GrRecordingContext::PathRendererStats::dump() const {
+    if (!fSelectionCounts.empty()) {
+        SkDebugf("Path Renderer Selections:\n");
+        for (const auto& [name, count] : fSelectionCounts) {
+            SkDebugf("    %s: %d\n", name.c_str(), count);
+        }
+    }
+}
+
+void GrRecordingContext::PathRendererStats::merge(const PathRendererStats& stats) {
+    for (const auto& [name, count] : stats.fSelectionCounts) {
+        fSelectionCounts[name] += count;
+    }
+}
+
 #endif // GR_GPU_STATS
 #endif // GR_TEST_UTILS
 
@@ -109,6 +109,9 @@ public:
 #if GR_GPU_STATS && GR_TEST_UTILS
     using DMSAAStats = GrRecordingContext::DMSAAStats;
     DMSAAStats& dmsaaStats() { return fContext->fDMSAAStats; }
+
+    using PathRendererStats = GrRecordingContext::PathRendererStats;
+    PathRendererStats& pathRendererStats() { return fContext->fPathRendererStats; }
 #endif
 
     GrSDFTControl getSDFTControl(bool useSDFTForSmallText) const;
@@ -119,6 +119,34 @@ GrResourceCache::GrResourceCache(GrSingleOwner* singleOwner,
         , fSingleOwner(singleOwner) {
     SkASSERT(owningContextID.isValid());
     SkASSERT(familyID != SK_InvalidUniqueID);
+    // Partition 0 is the default (quota-free) partition; every resource belongs to it unless a
+    // client partition is active at insertion.
+    fPartitions.push_back().fName = SkString("default");
+}
+
+uint32_t GrResourceCache::createPartition(const char* name, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    Partition& partition = fPartitions.push_back();
+    partition.fName = SkString(name);
+    partition.fMaxBytes = maxBytes;
+    return SkToU32(fPartitions.count() - 1);
+}
+
+void GrResourceCache::setPartitionLimit(uint32_t partition, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    SkASSERT(partition < SkToU32(fPartitions.count()));
+    fPartitions[partition].fMaxBytes = maxBytes;
+    this->purgeAsNeeded();
+}
+
+bool GrResourceCache::getPartitionStats(uint32_t partition, PartitionStats* stats) const {
+    if (partition >= SkToU32(fPartitions.count())) {
+        return false;
+    }
+    stats->fBudgetedBytes = fPartitions[partition].fBudgetedBytes;
+    stats->fMaxBytes = fPartitions[partition].fMaxBytes;
+    stats->fPurgedBytes = fPartitions[partition].fPurgedBytes;
+    return true;
 }
 
 GrResourceCache::~GrResourceCache() {
@@ -140,6 +168,7 @@ void GrResourceCache::insertResource(GrGpuResource* resource) {
     // We must set the timestamp before adding to the array in case the timestamp wraps and we wind
     // up iterating over all the resources that already have timestamps.
     resource->cacheAccess().setTimestamp(this->getNextTimestamp());
+    resource->cacheAccess().setPartition(fActivePartition);
 
     this->addToNonpurgeableArray(resource);
 
@@ -153,12 +182,14 @@ void GrResourceCache::insertResource(GrGpuResource* resource) {
     if (GrBudgetedType::kBudgeted == resource->resourcePriv().budgetedType()) {
         ++fBudgetedCount;
         fBudgetedBytes += size;
+        fPartitions[fActivePartition].fBudgetedBytes += size;
         TRACE_COUNTER2("skia.gpu.cache", "skia budget", "used",
                        fBudgetedBytes, "free", fMaxBytes - fBudgetedBytes);
 #if GR_CACHE_STATS
         fBudgetedHighWaterCount = std::max(fBudgetedCount, fBudgetedHighWaterCount);
         fBudgetedHighWaterBytes = std::max(fBudgetedBytes, fBudgetedHighWaterBytes);
 #endif
+        this->notifyNearBudgetIfNeeded();
     }
     SkASSERT(!resource->cacheAccess().isUsableAsScratch());
     this->purgeAsNeeded();
@@ -173,6 +204,7 @@ void GrResourceCache::removeResource(GrGpuResource* resource) {
     if (resource->resourcePriv().isPurgeable()) {
         fPurgeableQueue.remove(resource);
         fPurgeableBytes -= size;
+        TRACE_COUNTER1("skia.gpu.cache", "skia purgeable", fPurgeableBytes);
     } else {
         this->removeFromNonpurgeableArray(resource);
     }
@@ -182,8 +214,10 @@ void GrResourceCache::removeResource(GrGpuResource* resource) {
     if (GrBudgetedType::kBudgeted == resource->resourcePriv().budgetedType()) {
         --fBudgetedCount;
         fBudgetedBytes -= size;
+        fPartitions[resource->cacheAccess().partition()].fBudgetedBytes -= size;
         TRACE_COUNTER2("skia.gpu.cache", "skia budget", "used",
                        fBudgetedBytes, "free", fMaxBytes - fBudgetedBytes);
+        this->notifyNearBudgetIfNeeded();
     }
 
     if (resource->cacheAccess().isUsableAsScratch()) {
@@ -380,6 +414,7 @@ void GrResourceCache::refAndMakeResourceMRU(GrGpuResource* resource) {
     if (resource->resourcePriv().isPurgeable()) {
         // It's about to become unpurgeable.
         fPurgeableBytes -= resource->gpuMemorySize();
+        TRACE_COUNTER1("skia.gpu.cache", "skia purgeable", fPurgeableBytes);
         fPurgeableQueue.remove(resource);
         this->addToNonpurgeableArray(resource);
     } else if (!resource->cacheAccess().hasRefOrCommandBufferUsage() &&
@@ -439,6 +474,7 @@ void GrResourceCache::notifyARefCntReachedZero(GrGpuResource* resource,
     fPurgeableQueue.insert(resource);
     resource->cacheAccess().setTimeWhenResourceBecomePurgeable();
     fPurgeableBytes += resource->gpuMemorySize();
+    TRACE_COUNTER1("skia.gpu.cache", "skia purgeable", fPurgeableBytes);
 
     bool hasUniqueKey = resource->getUniqueKey().isValid();
 
@@ -489,6 +525,7 @@ void GrResourceCache::didChangeBudgetStatus(GrGpuResource* resource) {
     if (resource->resourcePriv().budgetedType() == GrBudgetedType::kBudgeted) {
         ++fBudgetedCount;
         fBudgetedBytes += size;
+        fPartitions[resource->cacheAccess().partition()].fBudgetedBytes += size;
 #if GR_CACHE_STATS
         fBudgetedHighWaterBytes = std::max(fBudgetedBytes, fBudgetedHighWaterBytes);
         fBudgetedHighWaterCount = std::max(fBudgetedCount, fBudgetedHighWaterCount);
@@ -500,11 +537,13 @@ void GrResourceCache::didChangeBudgetStatus(GrGpuResource* resource) {
         if (resource->cacheAccess().isUsableAsScratch()) {
             fScratchMap.insert(resource->resourcePriv().getScratchKey(), resource);
         }
+        this->notifyNearBudgetIfNeeded();
         this->purgeAsNeeded();
     } else {
         SkASSERT(resource->resourcePriv().budgetedType() != GrBudgetedType::kUnbudgetedCacheable);
         --fBudgetedCount;
         fBudgetedBytes -= size;
+        fPartitions[resource->cacheAccess().partition()].fBudgetedBytes -= size;
         if (!resource->resourcePriv().isPurgeable() &&
             !resource->cacheAccess().hasRefOrCommandBufferUsage()) {
             --fNumBudgetedResourcesFlushWillMakePurgeable;
@@ -513,6 +552,7 @@ void GrResourceCache::didChangeBudgetStatus(GrGpuResource* resource) {
             resource->resourcePriv().getScratchKey().isValid()) {
             fScratchMap.remove(resource->resourcePriv().getScratchKey(), resource);
         }
+        this->notifyNearBudgetIfNeeded();
     }
     SkASSERT(wasPurgeable == resource->resourcePriv().isPurgeable());
     TRACE_COUNTER2("skia.gpu.cache", "skia budget", "used",
@@ -542,10 +582,15 @@ void GrResourceCache::purgeAsNeeded() {
 
     this->processFreedGpuResources();
 
+    // Partition quotas first: they only evict the offending partition's resources, so the global
+    // pass below starts from a state where no client is leaning on another's budget.
+    this->purgePartitionsOverQuota();
+
     bool stillOverbudget = this->overBudget();
     while (stillOverbudget && fPurgeableQueue.count()) {
         GrGpuResource* resource = fPurgeableQueue.peek();
         SkASSERT(resource->resourcePriv().isPurgeable());
+        fOverbudgetPurgeBytes += resource->gpuMemorySize();
         resource->cacheAccess().release();
         stillOverbudget = this->overBudget();
     }
@@ -557,6 +602,7 @@ void GrResourceCache::purgeAsNeeded() {
         while (stillOverbudget && fPurgeableQueue.count()) {
             GrGpuResource* resource = fPurgeableQueue.peek();
             SkASSERT(resource->resourcePriv().isPurgeable());
+            fOverbudgetPurgeBytes += resource->gpuMemorySize();
             resource->cacheAccess().release();
             stillOverbudget = this->overBudget();
         }
@@ -565,6 +611,75 @@ void GrResourceCache::purgeAsNeeded() {
     this->validate();
 }
 
+void GrResourceCache::purgePartitionsOverQuota() {
+    bool anyOverQuota = false;
+    for (const Partition& partition : fPartitions) {
+        anyOverQuota |= partition.fMaxBytes && partition.fBudgetedBytes > partition.fMaxBytes;
+    }
+    if (!anyOverQuota) {
+        return;
+    }
+
+    // Scanning the sorted queue visits each partition's resources in LRU order. Releasing
+    // re-heaps the queue, so collect the victims first.
+    fPurgeableQueue.sort();
+    SkSTArray<8, size_t> projected;
+    for (const Partition& partition : fPartitions) {
+        projected.push_back(partition.fBudgetedBytes);
+    }
+    SkTDArray<GrGpuResource*> victims;
+    for (int i = 0; i < fPurgeableQueue.count(); i++) {
+        GrGpuResource* resource = fPurgeableQueue.at(i);
+        if (GrBudgetedType::kBudgeted != resource->resourcePriv().budgetedType()) {
+            continue;
+        }
+        uint32_t p = resource->cacheAccess().partition();
+        if (fPartitions[p].fMaxBytes && projected[p] > fPartitions[p].fMaxBytes) {
+            projected[p] -= resource->gpuMemorySize();
+            *victims.append() = resource;
+        }
+    }
+
+    for (int i = 0; i < victims.count(); i++) {
+        GrGpuResource* resource = victims[i];
+        SkASSERT(resource->resourcePriv().isPurgeable());
+        fPartitions[resource->cacheAccess().partition()].fPurgedBytes +=
+                resource->gpuMemorySize();
+        resource->cacheAccess().release();
+    }
+}
+
+void GrResourceCache::purgeToWatermark() {
+    ASSERT_SINGLE_OWNER
+
+    if (!fPurgeWatermarkBytes) {
+        return;
+    }
+
+    while (fBudgetedBytes > fPurgeWatermarkBytes && fPurgeableQueue.count()) {
+        GrGpuResource* resource = fPurgeableQueue.peek();
+        SkASSERT(resource->resourcePriv().isPurgeable());
+        resource->cacheAccess().release();
+    }
+
+    this->validate();
+}
+
+void GrResourceCache::notifyNearBudgetIfNeeded() {
+    if (!fNearBudgetProc || !fPurgeWatermarkBytes) {
+        return;
+    }
+    if (fBudgetedBytes >= fPurgeWatermarkBytes) {
+        if (!fNearBudgetNotified) {
+            fNearBudgetNotified = true;
+            fNearBudgetProc(fNearBudgetContext, fBudgetedBytes, fMaxBytes);
+        }
+    } else {
+        // Re-arm once the working set drops back below the watermark.
+        fNearBudgetNotified = false;
+    }
+}
+
 void GrResourceCache::purgeUnlockedResources(const GrStdSteadyClock::time_point* purgeTime,
                                              bool scratchResourcesOnly) {
 
@@ -9,6 +9,7 @@
 #define GrResourceCache_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkString.h"
 #include "include/gpu/GrDirectContext.h"
 #include "include/private/GrResourceKey.h"
 #include "include/private/SkTArray.h"
@@ -174,6 +175,67 @@ public:
      */
     bool purgeToMakeHeadroom(size_t desiredHeadroomBytes);
 
+    /** Sets the byte watermark that purgeToWatermark() purges toward and at which the
+        near-budget callback fires. Zero (the default) disables both. */
+    void setPurgeWatermark(size_t bytes) { fPurgeWatermarkBytes = bytes; }
+    size_t purgeWatermark() const { return fPurgeWatermarkBytes; }
+
+    /** Purges unlocked resources in LRU order until the budgeted byte count falls to the
+        watermark. Intended to run between frames so that reactive purging inside flush starts
+        with headroom instead of deallocating mid-frame. No-op when no watermark is set. */
+    void purgeToWatermark();
+
+    /** Called at most once each time the budgeted byte count rises to the watermark, as an early
+        warning that the next frame's working set is approaching the budget. The callback runs
+        while the cache is mid-update; it must only record the signal (e.g. to schedule a cleanup)
+        and must not use the context or cache. */
+    using NearBudgetProc = void (*)(void* context, size_t budgetedBytes, size_t budgetLimit);
+    void setNearBudgetProc(NearBudgetProc proc, void* context) {
+        fNearBudgetProc = proc;
+        fNearBudgetContext = context;
+    }
+
+    /**
+     * Named budget partitions for contexts shared by multiple clients. A resource inserted while
+     * a partition is active is accounted against that partition's byte quota in addition to the
+     * global budget. When a partition exceeds its quota, purgeAsNeeded() evicts that partition's
+     * purgeable resources in LRU order before any other partition loses anything, so one
+     * client's storm cannot evict another client's working set. Partition 0 is the default and
+     * has no quota of its own.
+     */
+    static constexpr uint32_t kDefaultPartition = 0;
+
+    /** Registers a partition and returns its id. 'maxBytes' of zero means no quota. */
+    uint32_t createPartition(const char* name, size_t maxBytes);
+
+    /** Changes a partition's quota, purging immediately if it is now exceeded. */
+    void setPartitionLimit(uint32_t partition, size_t maxBytes);
+
+    /** Subsequent insertions are accounted against 'partition'. */
+    void setActivePartition(uint32_t partition) {
+        SkASSERT(partition < SkToU32(fPartitions.count()));
+        fActivePartition = partition;
+    }
+    uint32_t activePartition() const { return fActivePartition; }
+
+    struct PartitionStats {
+        size_t fBudgetedBytes;  // bytes of budgeted resources tagged with this partition
+        size_t fMaxBytes;       // the quota; zero means none
+        size_t fPurgedBytes;    // total bytes evicted because the partition was over quota
+    };
+
+    /** Returns false if 'partition' has not been registered. */
+    bool getPartitionStats(uint32_t partition, PartitionStats*) const;
+
+    const char* partitionName(uint32_t partition) const {
+        return fPartitions[partition].fName.c_str();
+    }
+
+    /** Total bytes released by purgeAsNeeded() because the cache was over budget. These purges
+        happen inside flush, where their deallocations show up as frame-time spikes. The counter
+        is monotonic; sample it once per frame and diff to get a per-frame stat. */
+    size_t overbudgetPurgeBytes() const { return fOverbudgetPurgeBytes; }
+
     bool overBudget() const { return fBudgetedBytes > fMaxBytes; }
 
     /**
@@ -275,6 +337,13 @@ private:
 
     bool wouldFit(size_t bytes) const { return fBudgetedBytes+bytes <= fMaxBytes; }
 
+    // Fires or re-arms the near-budget callback after fBudgetedBytes changes.
+    void notifyNearBudgetIfNeeded();
+
+    // Evicts purgeable resources (LRU first) from any partition whose budgeted bytes exceed its
+    // quota. Other partitions' resources are untouched.
+    void purgePartitionsOverQuota();
+
     uint32_t getNextTimestamp();
 
     void purgeUnlockedResources(const GrStdSteadyClock::time_point* purgeTime,
@@ -360,6 +429,25 @@ private:
     // our budget, used in purgeAsNeeded()
     size_t                              fMaxBytes = kDefaultMaxSize;
 
+    // named budget partitions; index 0 is the default partition
+    struct Partition {
+        SkString fName;
+        size_t   fMaxBytes = 0;       // zero means no quota
+        size_t   fBudgetedBytes = 0;
+        size_t   fPurgedBytes = 0;
+    };
+    SkSTArray<1, Partition>             fPartitions;
+    uint32_t                            fActivePartition = kDefaultPartition;
+
+    // pre-eviction watermark and near-budget warning, used in purgeToWatermark()
+    size_t                              fPurgeWatermarkBytes = 0;
+    NearBudgetProc                      fNearBudgetProc = nullptr;
+    void*                               fNearBudgetContext = nullptr;
+    bool                                fNearBudgetNotified = false;
+
+    // bytes released while over budget, i.e. reactively inside flush
+    size_t                              fOverbudgetPurgeBytes = 0;
+
 #if GR_CACHE_STATS
     int                                 fHighWaterCount = 0;
     size_t                              fHighWaterBytes = 0;
@@ -244,6 +244,9 @@ sk_sp<GrTexture> GrResourceProvider::createApproxTexture(SkISize dimensions,
     if (auto tex = this->findAndRefScratchTexture(copyDimensions, format, renderable,
                                                   renderTargetSampleCnt, GrMipmapped::kNo,
                                                   isProtected)) {
+        if (copyDimensions != dimensions) {
+            fGpu->stats()->incNumScratchTexturesApproxReused();
+        }
         return tex;
     }
 
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/gpu/GrSharedImageRegistry.h"
+
+#include "include/core/SkPixmap.h"
+#include "include/gpu/GrDirectContext.h"
+#include "include/private/SkTArray.h"
+
+sk_sp<GrSharedImageRegistry> GrSharedImageRegistry::Make() {
+    return sk_sp<GrSharedImageRegistry>(new GrSharedImageRegistry);
+}
+
+sk_sp<SkImage> GrSharedImageRegistry::findOrMakeCrossContextImage(GrDirectContext* dContext,
+                                                                  const SkPixmap& pixmap,
+                                                                  uint32_t key,
+                                                                  bool buildMips) {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        if (sk_sp<SkImage>* found = fImages.find(key)) {
+            return *found;
+        }
+    }
+
+    // Upload outside the lock: MakeCrossContextFromPixmap flushes the producing context, which
+    // can take a while and must not block lookups of other keys.
+    sk_sp<SkImage> image = SkImage::MakeCrossContextFromPixmap(dContext, pixmap, buildMips);
+    if (!image) {
+        return nullptr;
+    }
+
+    SkAutoMutexExclusive lock(fMutex);
+    if (sk_sp<SkImage>* raced = fImages.find(key)) {
+        // Another thread registered 'key' while we were uploading. Use its image; ours unwinds
+        // through the normal cross-context release path.
+        return *raced;
+    }
+    fImages.set(key, image);
+    return image;
+}
+
+void GrSharedImageRegistry::purgeUnreferenced() {
+    SkAutoMutexExclusive lock(fMutex);
+    SkSTArray<8, uint32_t> toRemove;
+    fImages.foreach([&](uint32_t key, sk_sp<SkImage>* image) {
+        if ((*image)->unique()) {
+            toRemove.push_back(key);
+        }
+    });
+    for (uint32_t key : toRemove) {
+        fImages.remove(key);
+    }
+}
+
+int GrSharedImageRegistry::count() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return fImages.count();
+}
@@ -28,7 +28,7 @@ GrStagingBufferManager::Slice GrStagingBufferManager::allocateStagingBufferSlice
 
     if (!buffer) {
         GrResourceProvider* resourceProvider = fGpu->getContext()->priv().resourceProvider();
-        size_t bufferSize = std::max(size, kMinStagingBufferSize);
+        size_t bufferSize = std::max(size, fSizeHint);
         sk_sp<GrGpuBuffer> newBuffer = resourceProvider->createBuffer(
             bufferSize, GrGpuBufferType::kXferCpuToGpu, kDynamic_GrAccessPattern, nullptr);
         if (!newBuffer) {
@@ -52,9 +52,15 @@ GrStagingBufferManager::Slice GrStagingBufferManager::allocateStagingBufferSlice
 }
 
 void GrStagingBufferManager::detachBuffers() {
+    size_t used = 0;
     for (size_t i = 0; i < fBuffers.size(); ++i) {
+        used += fBuffers[i].fOffset;
         fBuffers[i].fBuffer->unmap();
         fGpu->takeOwnershipOfBuffer(std::move(fBuffers[i].fBuffer));
     }
     fBuffers.clear();
+    // Size the next submit's first buffer to cover everything staged this submit, so a steady
+    // stream of small uploads (e.g. tile streaming) coalesces into one allocation per frame
+    // instead of a series of minimum-size buffers.
+    fSizeHint = std::min(std::max(used, kMinStagingBufferSize), kMaxStagingBufferSize);
 }
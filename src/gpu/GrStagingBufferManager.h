@@ -47,6 +47,9 @@ public:
 
 private:
     static constexpr size_t kMinStagingBufferSize = 64 * 1024;
+    // Upper bound for the adaptive size hint below; individual slices larger than this still get
+    // a buffer of their exact size.
+    static constexpr size_t kMaxStagingBufferSize = 8 * 1024 * 1024;
 
     struct StagingBuffer {
         StagingBuffer(sk_sp<GrGpuBuffer> buffer, void* mapPtr)
@@ -61,6 +64,8 @@ private:
     };
 
     std::vector<StagingBuffer> fBuffers;
+    // Size for the next buffer allocation, tracking how much the previous submit staged in total.
+    size_t fSizeHint = kMinStagingBufferSize;
     GrGpu* fGpu;
 };
 
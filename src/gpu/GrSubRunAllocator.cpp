@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkMath.h"
+#include "src/core/SkSlabAlloc.h"
 #include "src/gpu/GrSubRunAllocator.h"
 
 #include <cstddef>
@@ -22,7 +23,7 @@ GrBagOfBytes::GrBagOfBytes(char* bytes, size_t size, size_t firstHeapAllocation)
     void* ptr = bytes;
     if (bytes && std::align(kMaxAlignment, sizeof(Block), ptr, space)) {
         this->setupBytesAndCapacity(bytes, size);
-        new (fEndByte) Block(nullptr, nullptr);
+        new (fEndByte) Block(nullptr, nullptr, 0);
     }
 }
 
@@ -33,14 +34,18 @@ GrBagOfBytes::~GrBagOfBytes() {
     Block* cursor = reinterpret_cast<Block*>(fEndByte);
     while (cursor != nullptr) {
         char* toDelete = cursor->fBlockStart;
+        int size = cursor->fBlockSize;
         cursor = cursor->fPrevious;
-        delete [] toDelete;
+        if (toDelete != nullptr) {
+            sk_slab_free(toDelete, size);
+        }
     }
 }
 
-GrBagOfBytes::Block::Block(char* previous, char* startOfBlock)
+GrBagOfBytes::Block::Block(char* previous, char* startOfBlock, int blockSize)
         : fBlockStart{startOfBlock}
-        , fPrevious{reinterpret_cast<Block*>(previous)} {}
+        , fPrevious{reinterpret_cast<Block*>(previous)}
+        , fBlockSize{blockSize} {}
 
 void* GrBagOfBytes::alignedBytes(int size, int alignment) {
     SkASSERT_RELEASE(0 < size && size < kMaxByteSize);
@@ -62,13 +67,13 @@ void GrBagOfBytes::needMoreBytes(int requestedSize, int alignment) {
     int nextBlockSize = fFibProgression.nextBlockSize();
     const int size = PlatformMinimumSizeWithOverhead(
             std::max(requestedSize, nextBlockSize), kAllocationAlignment);
-    char* const bytes = new char[size];
+    char* const bytes = static_cast<char*>(sk_slab_alloc(size));
     // fEndByte is changed by setupBytesAndCapacity. Remember it to link back to.
     char* const previousBlock = fEndByte;
     this->setupBytesAndCapacity(bytes, size);
 
     // Make a block to delete these bytes, and points to the previous block.
-    new (fEndByte) Block{previousBlock, bytes};
+    new (fEndByte) Block{previousBlock, bytes, size};
 
     // Make fCapacity the alignment for the requested object.
     fCapacity = fCapacity & -alignment;
@@ -107,10 +107,13 @@ private:
     // Beware. Order is important here. The destructor for fPrevious must be called first because
     // the Block is embedded in fBlockStart. Destructors are run in reverse order.
     struct Block {
-        Block(char* previous, char* startOfBlock);
+        Block(char* previous, char* startOfBlock, int blockSize);
         // The start of the originally allocated bytes. This is the thing that must be deleted.
         char* const fBlockStart;
         Block* const fPrevious;
+        // The size originally allocated for fBlockStart, so the storage can be returned to the
+        // slab pool it came from (see SkSlabAlloc.h). Zero for the caller-provided first block.
+        int const fBlockSize;
     };
 
     // Note: fCapacity is the number of bytes remaining, and is subtracted from fEndByte to
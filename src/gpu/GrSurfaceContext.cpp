@@ -1360,11 +1360,20 @@ GrSurfaceContext::PixelTransferResult GrSurfaceContext::transferPixels(GrColorTy
     size_t rowBytes = GrColorTypeBytesPerPixel(supportedRead.fColorType) * rect.width();
     rowBytes = GrAlignTo(rowBytes, this->caps()->transferBufferAlignment());
     size_t size = rowBytes * rect.height();
-    // By using kStream_GrAccessPattern here, we are not able to cache and reuse the buffer for
-    // multiple reads. Switching to kDynamic_GrAccessPattern would allow for this, however doing
-    // so causes a crash in a chromium test. See skbug.com/11297
-    auto buffer = direct->priv().resourceProvider()->createBuffer(
-            size, GrGpuBufferType::kXferGpuToCpu, GrAccessPattern::kStream_GrAccessPattern);
+    // If the client has opted into transfer buffer pooling, reuse a buffer from a previously
+    // finished readback instead of allocating. This is explicit reuse of buffers the manager
+    // owns, not resource-cache reuse, so it is safe with kStream_GrAccessPattern (see below).
+    sk_sp<GrGpuBuffer> buffer;
+    if (auto* mappedBufferManager = direct->priv().clientMappedBufferManager()) {
+        buffer = mappedBufferManager->takeBuffer(size);
+    }
+    if (!buffer) {
+        // By using kStream_GrAccessPattern here, we are not able to cache and reuse the buffer
+        // for multiple reads. Switching to kDynamic_GrAccessPattern would allow for this, however
+        // doing so causes a crash in a chromium test. See skbug.com/11297
+        buffer = direct->priv().resourceProvider()->createBuffer(
+                size, GrGpuBufferType::kXferGpuToCpu, GrAccessPattern::kStream_GrAccessPattern);
+    }
     if (!buffer) {
         return {};
     }
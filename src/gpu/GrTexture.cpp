@@ -22,14 +22,23 @@
 #endif
 
 void GrTexture::markMipmapsDirty() {
+    this->markMipmapsDirty(SkIRect::MakeSize(this->dimensions()));
+}
+
+void GrTexture::markMipmapsDirty(const SkIRect& dirtyRect) {
+    SkASSERT(SkIRect::MakeSize(this->dimensions()).contains(dirtyRect));
     if (GrMipmapStatus::kValid == fMipmapStatus) {
         fMipmapStatus = GrMipmapStatus::kDirty;
+        fMipmapDirtyRect = dirtyRect;
+    } else if (GrMipmapStatus::kDirty == fMipmapStatus) {
+        fMipmapDirtyRect.join(dirtyRect);
     }
 }
 
 void GrTexture::markMipmapsClean() {
     SkASSERT(GrMipmapStatus::kNotAllocated != fMipmapStatus);
     fMipmapStatus = GrMipmapStatus::kValid;
+    fMipmapDirtyRect.setEmpty();
 }
 
 size_t GrTexture::onGpuMemorySize() const {
@@ -51,6 +60,9 @@ GrTexture::GrTexture(GrGpu* gpu,
     } else {
         fMaxMipmapLevel = SkMipmap::ComputeLevelCount(this->width(), this->height());
     }
+    // Textures that start out with dirty mipmaps have never had valid level contents.
+    fMipmapDirtyRect = fMipmapStatus == GrMipmapStatus::kDirty ? SkIRect::MakeSize(dimensions)
+                                                               : SkIRect::MakeEmpty();
     if (textureType == GrTextureType::kExternal) {
         this->setReadOnly();
     }
@@ -11,6 +11,7 @@
 
 #include "include/core/SkImage.h"
 #include "include/core/SkPoint.h"
+#include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/gpu/GrBackendSurface.h"
 #include "include/private/GrTypesPriv.h"
@@ -46,11 +47,17 @@ public:
     }
 
     void markMipmapsDirty();
+    // Marks only the given base-level region as needing regeneration. Regions accumulate until
+    // the mipmaps are next marked clean.
+    void markMipmapsDirty(const SkIRect& dirtyRect);
     void markMipmapsClean();
     GrMipmapped mipmapped() const {
         return GrMipmapped(fMipmapStatus != GrMipmapStatus::kNotAllocated);
     }
     bool mipmapsAreDirty() const { return fMipmapStatus != GrMipmapStatus::kValid; }
+    // The base-level region that has changed since the mip levels were last regenerated.
+    // Only meaningful while mipmapsAreDirty().
+    const SkIRect& mipmapDirtyRect() const { return fMipmapDirtyRect; }
     GrMipmapStatus mipmapStatus() const { return fMipmapStatus; }
     int maxMipmapLevel() const { return fMaxMipmapLevel; }
 
@@ -75,6 +82,7 @@ private:
 
     GrTextureType                 fTextureType;
     GrMipmapStatus                fMipmapStatus;
+    SkIRect                       fMipmapDirtyRect;
     int                           fMaxMipmapLevel;
     friend class GrTextureResource;
 
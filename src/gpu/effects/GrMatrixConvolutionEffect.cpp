@@ -7,6 +7,7 @@
 #include "src/gpu/effects/GrMatrixConvolutionEffect.h"
 
 #include "include/private/SkHalf.h"
+#include "src/core/SkOpts.h"
 #include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/GrProxyProvider.h"
 #include "src/gpu/GrRecordingContextPriv.h"
@@ -118,10 +119,10 @@ GrMatrixConvolutionEffect::KernelWrapper::Make(GrRecordingContext* rContext,
     if (!bm.tryAllocPixels(info)) {
         return {};
     }
-    for (int i = 0; i < length; i++) {
-        if (useA16) {
-            *bm.getAddr16(i, 0) = SkFloatToHalf(values[i]);
-        } else {
+    if (useA16) {
+        SkOpts::floats_to_halfs(bm.getAddr16(0, 0), values, length);
+    } else {
+        for (int i = 0; i < length; i++) {
             *bm.getAddr8(i, 0) =
                 SkScalarRoundToInt((values[i] - min) / scalableSampler.fGain * 255);
         }
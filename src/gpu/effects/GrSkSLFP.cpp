@@ -78,7 +78,16 @@ public:
                 GrSLType gpuType;
                 SkAssertResult(SkSL::type_to_grsltype(fContext, *type, &gpuType));
 
-                if (*fUniformFlags++ & GrSkSLFP::kSpecialize_Flag) {
+                const GrSkSLFP::UniformFlags flags = *fUniformFlags++;
+
+                if (flags & GrSkSLFP::kUnused_Flag) {
+                    // The program never reads this uniform, so don't declare it; nothing will
+                    // reference the returned name. This packs the dead slot out of the program's
+                    // uniform block entirely.
+                    return String(var.name());
+                }
+
+                if (flags & GrSkSLFP::kSpecialize_Flag) {
                     SkASSERTF(!isArray, "specializing array uniforms is not allowed");
                     String value = GrGLSLTypeString(gpuType);
                     value.append("(");
@@ -222,7 +231,9 @@ public:
         const uint8_t* uniformData = outer.uniformData();
         const GrSkSLFP::UniformFlags* uniformFlags = outer.uniformFlags();
         for (const auto& v : outer.fEffect->uniforms()) {
-            if (*uniformFlags++ & GrSkSLFP::kSpecialize_Flag) {
+            if (*uniformFlags++ & (GrSkSLFP::kSpecialize_Flag | GrSkSLFP::kUnused_Flag)) {
+                // Specialized uniforms were baked into the shader; unused ones were never
+                // declared. Neither consumes a handle or needs an upload.
                 continue;
             }
             const UniformHandle handle = fUniformHandles[uniIndex++];
@@ -286,6 +297,13 @@ GrSkSLFP::GrSkSLFP(sk_sp<SkRuntimeEffect> effect, const char* name, OptFlags opt
         , fName(name)
         , fUniformSize(SkToU32(fEffect->uniformSize())) {
     memset(this->uniformFlags(), 0, fEffect->uniforms().count() * sizeof(UniformFlags));
+    UniformFlags* flags = this->uniformFlags();
+    for (const auto& v : fEffect->uniforms()) {
+        if (v.isUnused()) {
+            *flags = static_cast<UniformFlags>(*flags | kUnused_Flag);
+        }
+        ++flags;
+    }
     if (fEffect->usesSampleCoords()) {
         this->setUsesSampleCoordsDirectly();
     }
@@ -352,6 +370,10 @@ void GrSkSLFP::onGetGLSLProcessorKey(const GrShaderCaps& caps, GrProcessorKeyBui
     auto iter = fEffect->uniforms().begin();
 
     for (size_t i = 0; i < uniformCount; ++i, ++iter) {
+        if (flags[i] & kUnused_Flag) {
+            // Not part of the generated program, so its value can never affect the key.
+            continue;
+        }
         bool specialize = flags[i] & kSpecialize_Flag;
         b->addBool(specialize, "specialize");
         if (specialize) {
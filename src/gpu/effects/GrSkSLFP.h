@@ -175,6 +175,9 @@ private:
 
     enum UniformFlags : uint8_t {
         kSpecialize_Flag = 0x1,
+        // Mirrors SkRuntimeEffect::Uniform::kUnused_Flag: the program never reads this uniform,
+        // so it isn't declared in the shader and takes no space in the program's uniform block.
+        kUnused_Flag     = 0x2,
     };
 
     const UniformFlags* uniformFlags() const {
@@ -7,7 +7,7 @@
 #ifndef GrQuadBuffer_DEFINED
 #define GrQuadBuffer_DEFINED
 
-#include "include/private/SkTDArray.h"
+#include "include/private/SkTArray.h"
 #include "src/gpu/geometry/GrQuad.h"
 
 template<typename T>
@@ -17,8 +17,7 @@ public:
             : fCount(0)
             , fDeviceType(GrQuad::Type::kAxisAligned)
             , fLocalType(GrQuad::Type::kAxisAligned) {
-        // Pre-allocate space for 1 2D device-space quad, metadata, and header
-        fData.reserve(this->entrySize(fDeviceType, nullptr));
+        // The inline storage always covers the first entry, so nothing to reserve up front.
     }
 
     // Reserves space for the given number of entries; if 'needsLocals' is true, space will be
@@ -30,7 +29,7 @@ public:
             , fDeviceType(GrQuad::Type::kAxisAligned)
             , fLocalType(GrQuad::Type::kAxisAligned) {
         int entrySize = this->entrySize(fDeviceType, needsLocals ? &fLocalType : nullptr);
-        fData.reserve(count * entrySize);
+        fData.reserve_back(count * entrySize / kUnitSize);
     }
 
     // The number of device-space quads (and metadata, and optional local quads) that are in the
@@ -63,7 +62,7 @@ public:
                 , fLocalQuad(SkRect::MakeEmpty())
                 , fBuffer(buffer)
                 , fCurrentEntry(nullptr)
-                , fNextEntry(buffer->fData.begin()) {
+                , fNextEntry(buffer->dataStart()) {
             SkDEBUGCODE(fExpectedCount = buffer->count();)
         }
 
@@ -169,7 +168,15 @@ private:
     // FIXME (michaelludwig) - Since this is intended only for ops, can we use the arena to
     //      allocate storage for the quad buffer? Since this is forward-iteration only, could also
     //      explore a linked-list structure for concatenating quads when batching ops
-    SkTDArray<char> fData;
+
+    // The data is stored in 4-byte units, all entry fields are 4-byte aligned, and the inline
+    // storage is sized to hold the largest possible single entry. Most ops are recorded with one
+    // quad and then merged into an earlier op's buffer, so the common case never touches the heap;
+    // only merge destinations that accumulate many quads spill to a heap allocation.
+    static constexpr int kUnitSize = sizeof(int32_t);
+    static constexpr int kInlineUnits = (kMetaSize + 2 * k3DQuadFloats * sizeof(float)) / kUnitSize;
+
+    SkSTArray<kInlineUnits, int32_t, true> fData;
 
     int fCount; // Number of (device, local, metadata) entries
     GrQuad::Type fDeviceType; // Most general type of all entries
@@ -194,6 +201,17 @@ private:
         }
     }
 
+    // Helpers to view the 4-byte unit storage as the byte stream the entries are packed into
+    inline char* dataStart() {
+        return reinterpret_cast<char*>(fData.begin());
+    }
+    inline const char* dataStart() const {
+        return reinterpret_cast<const char*>(fData.begin());
+    }
+    inline const char* dataEnd() const {
+        return reinterpret_cast<const char*>(fData.end());
+    }
+
     // Helpers to access typed sections of the buffer, given the start of an entry
     inline Header* header(char* entry) {
         return static_cast<Header*>(static_cast<void*>(entry));
@@ -266,8 +284,10 @@ void GrQuadBuffer<T>::append(const GrQuad& deviceQuad, T&& metadata, const GrQua
     GrQuad::Type localType = localQuad ? localQuad->quadType() : GrQuad::Type::kAxisAligned;
     int entrySize = this->entrySize(deviceQuad.quadType(), localQuad ? &localType : nullptr);
 
-    // Fill in the entry, as described in fData's declaration
-    char* entry = fData.append(entrySize);
+    // Fill in the entry, as described in fData's declaration (entries are always a whole number
+    // of 4-byte units since the header, metadata, and coordinates are all 4-byte aligned).
+    SkASSERT(entrySize % kUnitSize == 0);
+    char* entry = reinterpret_cast<char*>(fData.push_back_n(entrySize / kUnitSize));
     // First the header
     Header* h = this->header(entry);
     h->fDeviceType = static_cast<unsigned>(deviceQuad.quadType());
@@ -300,7 +320,7 @@ void GrQuadBuffer<T>::append(const GrQuad& deviceQuad, T&& metadata, const GrQua
 
 template<typename T>
 void GrQuadBuffer<T>::concat(const GrQuadBuffer<T>& that) {
-    fData.append(that.fData.count(), that.fData.begin());
+    fData.push_back_n(that.fData.count(), that.fData.begin());
     fCount += that.fCount;
     if (that.fDeviceType > fDeviceType) {
         fDeviceType = that.fDeviceType;
@@ -316,7 +336,7 @@ void GrQuadBuffer<T>::validate(const char* entry, int expectedCount) const {
     // Triggers if accessing before next() is called on an iterator
     SkASSERT(entry);
     // Triggers if accessing after next() returns false
-    SkASSERT(entry < fData.end());
+    SkASSERT(entry < this->dataEnd());
     // Triggers if elements have been added to the buffer while iterating entries
     SkASSERT(expectedCount == fCount);
     // Make sure the start of the entry looks like a header
@@ -331,7 +351,7 @@ void GrQuadBuffer<T>::validate(const char* entry, int expectedCount) const {
 template<typename T>
 bool GrQuadBuffer<T>::Iter::next() {
     SkASSERT(fNextEntry);
-    if (fNextEntry >= fBuffer->fData.end()) {
+    if (fNextEntry >= fBuffer->dataEnd()) {
         return false;
     }
     // There is at least one more entry, so store the current start for metadata access
@@ -355,15 +375,15 @@ template<typename T>
 bool GrQuadBuffer<T>::MetadataIter::next() {
     if (fCurrentEntry) {
         // Advance pointer by entry size
-        if (fCurrentEntry < fBuffer->fData.end()) {
+        if (fCurrentEntry < fBuffer->dataEnd()) {
             const Header* h = fBuffer->header(fCurrentEntry);
             fCurrentEntry += fBuffer->entrySize(h);
         }
     } else {
         // First call to next
-        fCurrentEntry = fBuffer->fData.begin();
+        fCurrentEntry = fBuffer->dataStart();
     }
     // Nothing else is needed to do but report whether or not the updated pointer is valid
-    return fCurrentEntry < fBuffer->fData.end();
+    return fCurrentEntry < fBuffer->dataEnd();
 }
 #endif  // GrQuadBuffer_DEFINED
@@ -690,6 +690,16 @@ void GrGLCaps::init(const GrContextOptions& contextOptions,
         fFenceType = FenceType::kNVFence;
     }
 
+    // Timestamp queries, used by the opt-in GPU timing instrumentation. The ES
+    // disjoint_timer_query entry points aren't fetched by the interface factories,
+    // so this is desktop GL only for now.
+    if (GR_IS_GR_GL(standard) &&
+        (version >= GR_GL_VER(3, 3) || ctxInfo.hasExtension("GL_ARB_timer_query"))) {
+        fTimestampQuerySupport = gli->fFunctions.fGenQueries &&
+                                 gli->fFunctions.fQueryCounter &&
+                                 gli->fFunctions.fGetQueryObjectui64v;
+    }
+
     // Safely moving textures between contexts requires semaphores.
     fCrossContextTextureSupport = fSemaphoreSupport;
 
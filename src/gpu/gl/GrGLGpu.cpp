@@ -18,8 +18,10 @@
 #include "include/private/SkTo.h"
 #include "src/core/SkAutoMalloc.h"
 #include "src/core/SkCompressedDataUtils.h"
+#include "src/core/SkConvertPixels.h"
 #include "src/core/SkMipmap.h"
 #include "src/core/SkTraceEvent.h"
+#include "src/core/SkWriteBuffer.h"
 #include "src/gpu/GrBackendUtils.h"
 #include "src/gpu/GrCpuBuffer.h"
 #include "src/gpu/GrDataUtils.h"
@@ -403,6 +405,15 @@ GrGLGpu::~GrGLGpu() {
         this->deleteFramebuffer(fStencilClearFBOID);
     }
 
+    for (UploadPBO& pbo : fUploadPBOs) {
+        if (pbo.fBufferID) {
+            GL_CALL(DeleteBuffers(1, &pbo.fBufferID));
+        }
+        if (pbo.fFence) {
+            this->deleteFence(pbo.fFence);
+        }
+    }
+
     for (size_t i = 0; i < SK_ARRAY_COUNT(fCopyPrograms); ++i) {
         if (0 != fCopyPrograms[i].fProgram) {
             GL_CALL(DeleteProgram(fCopyPrograms[i].fProgram));
@@ -422,6 +433,7 @@ GrGLGpu::~GrGLGpu() {
 
 void GrGLGpu::disconnect(DisconnectType type) {
     INHERITED::disconnect(type);
+    fPendingProgramBinaries.reset();
     if (DisconnectType::kCleanup == type) {
         if (fHWProgramID) {
             GL_CALL(UseProgram(0));
@@ -435,6 +447,14 @@ void GrGLGpu::disconnect(DisconnectType type) {
         if (fStencilClearFBOID) {
             this->deleteFramebuffer(fStencilClearFBOID);
         }
+        for (UploadPBO& pbo : fUploadPBOs) {
+            if (pbo.fBufferID) {
+                GL_CALL(DeleteBuffers(1, &pbo.fBufferID));
+            }
+            if (pbo.fFence) {
+                this->deleteFence(pbo.fFence);
+            }
+        }
         for (size_t i = 0; i < SK_ARRAY_COUNT(fCopyPrograms); ++i) {
             if (fCopyPrograms[i].fProgram) {
                 GL_CALL(DeleteProgram(fCopyPrograms[i].fProgram));
@@ -466,6 +486,10 @@ void GrGLGpu::disconnect(DisconnectType type) {
     fTempSrcFBOID = 0;
     fTempDstFBOID = 0;
     fStencilClearFBOID = 0;
+    for (UploadPBO& pbo : fUploadPBOs) {
+        pbo = UploadPBO();
+    }
+    fNextUploadPBO = 0;
     fCopyProgramArrayBuffer.reset();
     for (size_t i = 0; i < SK_ARRAY_COUNT(fCopyPrograms); ++i) {
         fCopyPrograms[i].fProgram = 0;
@@ -1041,6 +1065,16 @@ void GrGLGpu::uploadTexData(SkISize texDims,
     this->unbindXferBuffer(GrGpuBufferType::kXferCpuToGpu);
     GL_CALL(PixelStorei(GR_GL_UNPACK_ALIGNMENT, 1));
 
+    // Stage large single-level uploads through a pooled pixel-unpack buffer when the driver
+    // supports it. Streaming clients (e.g. tiled video) otherwise stall in glTexSubImage2D while
+    // the driver copies out of client memory.
+    static constexpr size_t kMinUploadPBOBytes = 64 * 1024;
+    if (1 == mipLevelCount && texels[0].fPixels &&
+        dstRect.width() * bpp * dstRect.height() >= kMinUploadPBOBytes &&
+        this->uploadTexDataViaPBO(target, dstRect, externalFormat, externalType, bpp, texels[0])) {
+        return;
+    }
+
     SkISize dims = dstRect.size();
     for (int level = 0; level < mipLevelCount; ++level, dims = {std::max(dims.width()  >> 1, 1),
                                                                 std::max(dims.height() >> 1, 1)}) {
@@ -1067,6 +1101,93 @@ void GrGLGpu::uploadTexData(SkISize texDims,
     }
 }
 
+bool GrGLGpu::uploadTexDataViaPBO(GrGLenum target,
+                                  SkIRect dstRect,
+                                  GrGLenum externalFormat,
+                                  GrGLenum externalType,
+                                  size_t bpp,
+                                  const GrMipLevel& texel) {
+    const GrGLCaps& caps = this->glCaps();
+    // We need real PBOs, glMapBufferRange for unsynchronized mapping, and fences to know when a
+    // ring entry's last upload has been consumed. The interfaces we target don't expose
+    // glBufferStorage, so the buffers are remapped per upload rather than persistently mapped.
+    if ((caps.transferBufferType() != GrGLCaps::TransferBufferType::kNV_PBO &&
+         caps.transferBufferType() != GrGLCaps::TransferBufferType::kARB_PBO) ||
+        caps.mapBufferType() != GrGLCaps::kMapBufferRange_MapBufferType ||
+        !this->caps()->fenceSyncSupport()) {
+        return false;
+    }
+
+    UploadPBO* pbo = &fUploadPBOs[fNextUploadPBO];
+    if (pbo->fFence) {
+        if (!this->waitFence(pbo->fFence)) {
+            // The oldest buffer in the ring is still in flight; upload from client memory rather
+            // than stalling here.
+            return false;
+        }
+        this->deleteFence(pbo->fFence);
+        pbo->fFence = 0;
+    }
+    if (!pbo->fBufferID) {
+        GL_CALL(GenBuffers(1, &pbo->fBufferID));
+        if (!pbo->fBufferID) {
+            return false;
+        }
+    }
+
+    const size_t trimRowBytes = dstRect.width() * bpp;
+    const size_t size = trimRowBytes * dstRect.height();
+
+    // This binding bypasses the buffer state tracking that bindBuffer() does for GrGLBuffers, so
+    // rebind explicitly and invalidate the tracked state when done.
+    GL_CALL(BindBuffer(GR_GL_PIXEL_UNPACK_BUFFER, pbo->fBufferID));
+    if (pbo->fSize < size) {
+        GrGLenum error = GL_ALLOC_CALL(BufferData(GR_GL_PIXEL_UNPACK_BUFFER, size, nullptr,
+                                                  GR_GL_STREAM_DRAW));
+        if (error != GR_GL_NO_ERROR) {
+            pbo->fSize = 0;
+            GL_CALL(BindBuffer(GR_GL_PIXEL_UNPACK_BUFFER, 0));
+            this->hwBufferState(GrGpuBufferType::kXferCpuToGpu)->invalidate();
+            return false;
+        }
+        pbo->fSize = size;
+    }
+
+    // The fence check above proved the GPU is done reading, so an unsynchronized map is safe and
+    // avoids an implicit sync in the driver.
+    void* mapPtr;
+    GL_CALL_RET(mapPtr, MapBufferRange(GR_GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                       GR_GL_MAP_WRITE_BIT | GR_GL_MAP_UNSYNCHRONIZED_BIT));
+    if (!mapPtr) {
+        GL_CALL(BindBuffer(GR_GL_PIXEL_UNPACK_BUFFER, 0));
+        this->hwBufferState(GrGpuBufferType::kXferCpuToGpu)->invalidate();
+        return false;
+    }
+
+    // Trim rows while staging; the buffer then holds tightly packed rows so no UNPACK_ROW_LENGTH
+    // is needed (important for ES2-class contexts without that support).
+    SkRectMemcpy(mapPtr, trimRowBytes, texel.fPixels, texel.fRowBytes, trimRowBytes,
+                 dstRect.height());
+
+    GrGLboolean success;
+    GL_CALL_RET(success, UnmapBuffer(GR_GL_PIXEL_UNPACK_BUFFER));
+    if (!success) {
+        GL_CALL(BindBuffer(GR_GL_PIXEL_UNPACK_BUFFER, 0));
+        this->hwBufferState(GrGpuBufferType::kXferCpuToGpu)->invalidate();
+        return false;
+    }
+
+    GL_CALL(TexSubImage2D(target, 0, dstRect.x(), dstRect.y(), dstRect.width(), dstRect.height(),
+                          externalFormat, externalType, nullptr));
+    pbo->fFence = this->insertFence();
+
+    GL_CALL(BindBuffer(GR_GL_PIXEL_UNPACK_BUFFER, 0));
+    this->hwBufferState(GrGpuBufferType::kXferCpuToGpu)->invalidate();
+
+    fNextUploadPBO = (fNextUploadPBO + 1) % kNumUploadPBOs;
+    return true;
+}
+
 bool GrGLGpu::uploadCompressedTexData(SkImage::CompressionType compressionType,
                                       GrGLFormat format,
                                       SkISize dimensions,
@@ -1892,6 +2013,7 @@ void GrGLGpu::flushProgram(sk_sp<GrGLProgram> program) {
     }
     SkASSERT((program == fHWProgram) == (fHWProgramID == program->programID()));
     if (program == fHWProgram) {
+        fStats.incNumRedundantProgramBinds();
         return;
     }
     auto id = program->programID();
@@ -1905,6 +2027,7 @@ void GrGLGpu::flushProgram(GrGLuint id) {
     SkASSERT(id);
     if (fHWProgramID == id) {
         SkASSERT(!fHWProgram);
+        fStats.incNumRedundantProgramBinds();
         return;
     }
     fHWProgram.reset();
@@ -2650,6 +2773,8 @@ void GrGLGpu::bindTexture(int unitIdx, GrSamplerState samplerState, const GrSwiz
         this->setTextureUnit(unitIdx);
         GL_CALL(BindTexture(target, texture->textureID()));
         fHWTextureUnitBindings[unitIdx].setBoundID(target, textureID);
+    } else {
+        fStats.incNumRedundantTextureBinds();
     }
 
     if (samplerState.mipmapped() == GrMipmapped::kYes) {
@@ -3971,7 +4096,49 @@ void GrGLGpu::flush(FlushType flushType) {
     }
 }
 
+void GrGLGpu::storeProgramBinaryAtSubmit(sk_sp<GrGLProgram> program, sk_sp<SkData> key,
+                                         sk_sp<SkData> prefix, SkString description) {
+    PendingProgramBinary& pending = fPendingProgramBinaries.push_back();
+    pending.fProgram = std::move(program);
+    pending.fKey = std::move(key);
+    pending.fPrefix = std::move(prefix);
+    pending.fDescription = std::move(description);
+}
+
+void GrGLGpu::storePendingProgramBinaries() {
+    if (fPendingProgramBinaries.empty()) {
+        return;
+    }
+    auto* cache = this->getContext()->priv().getPersistentCache();
+    for (PendingProgramBinary& pending : fPendingProgramBinaries) {
+        if (!cache) {
+            break;
+        }
+        GrGLuint programID = pending.fProgram->programID();
+        GrGLsizei length = 0;
+        GL_CALL(GetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length));
+        if (length <= 0) {
+            continue;
+        }
+        SkBinaryWriteBuffer writer;
+        writer.writePad32(pending.fPrefix->data(), pending.fPrefix->size());
+
+        SkAutoSMalloc<2048> binary(length);
+        GrGLenum binaryFormat;
+        GL_CALL(GetProgramBinary(programID, length, &length, &binaryFormat, binary.get()));
+
+        writer.writeUInt(binaryFormat);
+        writer.writeInt(length);
+        writer.writePad32(binary.get(), length);
+
+        auto data = writer.snapshotAsData();
+        cache->store(*pending.fKey, *data, pending.fDescription);
+    }
+    fPendingProgramBinaries.reset();
+}
+
 bool GrGLGpu::onSubmitToGpu(bool syncCpu) {
+    this->storePendingProgramBinaries();
     if (syncCpu || (!fFinishCallbacks.empty() && !this->caps()->fenceSyncSupport())) {
         this->finishOutstandingGpuWork();
         fFinishCallbacks.callAll(true);
@@ -4048,6 +4215,44 @@ void GrGLGpu::deleteFence(GrFence fence) const {
     }
 }
 
+uint64_t GrGLGpu::insertGpuTimestamp() {
+    if (!this->caps()->timestampQuerySupport()) {
+        return 0;
+    }
+    GrGLuint query = 0;
+    GL_CALL(GenQueries(1, &query));
+    if (!query) {
+        return 0;
+    }
+    GL_CALL(QueryCounter(query, GR_GL_TIMESTAMP));
+    return query;
+}
+
+bool GrGLGpu::getGpuTimestampResult(uint64_t timestamp, uint64_t* nanos) {
+    SkASSERT(this->caps()->timestampQuerySupport());
+    if (!timestamp) {
+        return false;
+    }
+    GrGLuint query = SkToUInt(timestamp);
+    GrGLuint available = 0;
+    GL_CALL(GetQueryObjectuiv(query, GR_GL_QUERY_RESULT_AVAILABLE, &available));
+    if (!available) {
+        return false;
+    }
+    GrGLuint64 result = 0;
+    GL_CALL(GetQueryObjectui64v(query, GR_GL_QUERY_RESULT, &result));
+    GL_CALL(DeleteQueries(1, &query));
+    *nanos = result;
+    return true;
+}
+
+void GrGLGpu::deleteGpuTimestamp(uint64_t timestamp) {
+    if (timestamp) {
+        GrGLuint query = SkToUInt(timestamp);
+        GL_CALL(DeleteQueries(1, &query));
+    }
+}
+
 std::unique_ptr<GrSemaphore> SK_WARN_UNUSED_RESULT GrGLGpu::makeSemaphore(bool isOwned) {
     SkASSERT(this->caps()->semaphoreSupport());
     return GrGLSemaphore::Make(this, isOwned);
@@ -152,6 +152,19 @@ public:
         return fProgramCache->precompileShader(this->getContext(), key, data);
     }
 
+    int precompileShaders(const sk_sp<SkData> keys[], const sk_sp<SkData> datas[],
+                          int count, SkExecutor* executor) override {
+        return fProgramCache->precompileShaders(this->getContext(), keys, datas, count, executor);
+    }
+
+    // Queues a program's binary to be read back and handed to the persistent cache when the
+    // current work is submitted. Deferring the glGetProgramBinary call gives drivers that link
+    // on a worker thread time to finish, so the readback doesn't serialize on the link. fPrefix
+    // holds the already-serialized cache-blob header (version, tag, driver stamp, inputs); the
+    // binary itself is appended when the readback runs.
+    void storeProgramBinaryAtSubmit(sk_sp<GrGLProgram>, sk_sp<SkData> key, sk_sp<SkData> prefix,
+                                    SkString description);
+
 #if GR_TEST_UTILS
     bool isTestingOnlyBackendTexture(const GrBackendTexture&) const override;
 
@@ -172,6 +185,10 @@ public:
     bool waitFence(GrFence) override;
     void deleteFence(GrFence) const override;
 
+    uint64_t insertGpuTimestamp() override;
+    bool getGpuTimestampResult(uint64_t, uint64_t* nanos) override;
+    void deleteGpuTimestamp(uint64_t) override;
+
     std::unique_ptr<GrSemaphore> SK_WARN_UNUSED_RESULT makeSemaphore(bool isOwned) override;
     std::unique_ptr<GrSemaphore> wrapBackendSemaphore(const GrBackendSemaphore&,
                                                       GrSemaphoreWrapType,
@@ -365,6 +382,10 @@ private:
 
     bool onSubmitToGpu(bool syncCpu) override;
 
+    // reads back the program binaries queued by storeProgramBinaryAtSubmit and stores them in
+    // the persistent cache
+    void storePendingProgramBinaries();
+
     bool waitSync(GrGLsync, uint64_t timeout, bool flush);
 
     bool copySurfaceAsDraw(GrSurface* dst, bool drawToMultisampleFBO, GrSurface* src,
@@ -388,6 +409,8 @@ private:
                                                const GrProgramInfo&,
                                                Stats::ProgramCacheResult*);
         bool precompileShader(GrDirectContext*, const SkData& key, const SkData& data);
+        int precompileShaders(GrDirectContext*, const sk_sp<SkData> keys[],
+                              const sk_sp<SkData> datas[], int count, SkExecutor*);
 
     private:
         struct Entry;
@@ -488,6 +511,17 @@ private:
                        const GrMipLevel texels[],
                        int mipLevelCount);
 
+    // Stages a large single-level upload in a pooled pixel-unpack buffer so the GL can DMA from
+    // driver-visible memory instead of synchronously copying out of client memory in
+    // glTexSubImage2D. Returns false if the pool is unsupported or every buffer in the ring is
+    // still in flight; the caller then uploads directly from client memory.
+    bool uploadTexDataViaPBO(GrGLenum target,
+                             SkIRect dstRect,
+                             GrGLenum externalFormat,
+                             GrGLenum externalType,
+                             size_t bpp,
+                             const GrMipLevel& texel);
+
     // Helper for onCreateCompressedTexture. Compressed textures are read-only so we only use this
     // to populate a new texture. Returns false if we failed to create and upload the texture.
     bool uploadCompressedTexData(SkImage::CompressionType compressionType,
@@ -530,6 +564,15 @@ private:
     // GL program-related state
     sk_sp<ProgramCache>         fProgramCache;
 
+    // program binary readbacks deferred until onSubmitToGpu; see storeProgramBinaryAtSubmit
+    struct PendingProgramBinary {
+        sk_sp<GrGLProgram> fProgram;
+        sk_sp<SkData> fKey;
+        sk_sp<SkData> fPrefix;
+        SkString fDescription;
+    };
+    SkTArray<PendingProgramBinary> fPendingProgramBinaries;
+
     ///////////////////////////////////////////////////////////////////////////
     ///@name Caching of GL State
     ///@{
@@ -549,6 +592,17 @@ private:
 
     GrGLuint                    fStencilClearFBOID;
 
+    // Ring of pixel-unpack buffers used by uploadTexDataViaPBO to stage large texture uploads.
+    // A buffer is reused only after the fence from its previous upload has signaled.
+    struct UploadPBO {
+        GrGLuint fBufferID = 0;
+        size_t   fSize = 0;
+        GrFence  fFence = 0;
+    };
+    static constexpr int kNumUploadPBOs = 3;
+    UploadPBO                   fUploadPBOs[kNumUploadPBOs];
+    int                         fNextUploadPBO = 0;
+
     // last scissor / viewport scissor state seen by the GL.
     struct {
         TriState fEnabled;
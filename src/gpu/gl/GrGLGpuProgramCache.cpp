@@ -11,11 +11,14 @@
 
 #include "include/gpu/GrContextOptions.h"
 #include "include/gpu/GrDirectContext.h"
+#include "include/private/SkTemplates.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/GrProcessor.h"
 #include "src/gpu/GrProgramDesc.h"
 #include "src/gpu/gl/builders/GrGLProgramBuilder.h"
 #include "src/gpu/glsl/GrGLSLFragmentProcessor.h"
+#include "src/sksl/SkSLCompiler.h"
 
 struct GrGLGpu::ProgramCache::Entry {
     Entry(sk_sp<GrGLProgram> program)
@@ -140,3 +143,74 @@ bool GrGLGpu::ProgramCache::precompileShader(GrDirectContext* dContext,
     fMap.insert(desc, std::make_unique<Entry>(precompiledProgram));
     return true;
 }
+
+int GrGLGpu::ProgramCache::precompileShaders(GrDirectContext* dContext,
+                                             const sk_sp<SkData> keys[],
+                                             const sk_sp<SkData> datas[],
+                                             int count,
+                                             SkExecutor* executor) {
+    if (!executor) {
+        int compiled = 0;
+        for (int i = 0; i < count; ++i) {
+            if (keys[i] && datas[i] && this->precompileShader(dContext, *keys[i], *datas[i])) {
+                ++compiled;
+            }
+        }
+        return compiled;
+    }
+
+    GrGLGpu* glGpu = static_cast<GrGLGpu*>(dContext->priv().getGpu());
+    auto errorHandler = dContext->priv().getShaderErrorHandler();
+    bool sharpenTextures = dContext->priv().options().fSharpenMipmappedTextures;
+    const GrShaderCaps* shaderCaps = glGpu->glCaps().shaderCaps();
+
+    // The SkSL -> GLSL translation makes no GL calls, so it runs on the executor's threads. Each
+    // task builds its own compiler (they are not thread-safe) and translates a run of shaders to
+    // amortize the setup cost. The driver compiles and links below, on the calling thread.
+    SkAutoTArray<GrGLPrecompiledShaderSource> sources(count);
+    SkAutoTArray<bool> translated(count);
+    constexpr int kShadersPerTask = 8;
+    int taskCount = (count + kShadersPerTask - 1) / kShadersPerTask;
+    SkTaskGroup taskGroup(*executor);
+    taskGroup.batch(taskCount, [&](int task) {
+        SkSL::Compiler compiler(shaderCaps);
+        int stop = std::min(count, (task + 1) * kShadersPerTask);
+        for (int i = task * kShadersPerTask; i < stop; ++i) {
+            translated[i] = datas[i] &&
+                            GrGLProgramBuilder::TranslatePrecompiledProgram(
+                                    &compiler, sharpenTextures, errorHandler, *datas[i],
+                                    &sources[i]);
+        }
+    });
+    taskGroup.wait();
+
+    int compiled = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!keys[i] || !datas[i]) {
+            continue;
+        }
+        if (!translated[i]) {
+            // not cached SkSL; likely a program binary blob, which needs the context thread
+            if (this->precompileShader(dContext, *keys[i], *datas[i])) {
+                ++compiled;
+            }
+            continue;
+        }
+        GrProgramDesc desc;
+        if (!GrProgramDesc::BuildFromData(&desc, keys[i]->data(), keys[i]->size())) {
+            continue;
+        }
+        if (fMap.find(desc)) {
+            // We've already seen/compiled this shader
+            ++compiled;
+            continue;
+        }
+        GrGLPrecompiledProgram precompiledProgram;
+        if (!GrGLProgramBuilder::PrecompileProgram(dContext, &precompiledProgram, sources[i])) {
+            continue;
+        }
+        fMap.insert(desc, std::make_unique<Entry>(precompiledProgram));
+        ++compiled;
+    }
+    return compiled;
+}
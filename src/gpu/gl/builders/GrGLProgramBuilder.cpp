@@ -10,6 +10,7 @@
 #include "include/gpu/GrDirectContext.h"
 #include "src/core/SkATrace.h"
 #include "src/core/SkAutoMalloc.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/core/SkWriteBuffer.h"
@@ -156,7 +157,43 @@ static constexpr SkFourByteTag kSKSL_Tag = SkSetFourByteTag('S', 'K', 'S', 'L');
 static constexpr SkFourByteTag kGLSL_Tag = SkSetFourByteTag('G', 'L', 'S', 'L');
 static constexpr SkFourByteTag kGLPB_Tag = SkSetFourByteTag('G', 'L', 'P', 'B');
 
-void GrGLProgramBuilder::storeShaderInCache(const SkSL::Program::Inputs& inputs, GrGLuint programID,
+// A program binary is only usable on the exact driver build that produced it. Each binary blob
+// is stamped with the driver's identity, including a hash of the raw GL identification strings
+// for drivers we don't otherwise recognize, so a binary left over from before a driver update is
+// rejected up front instead of being handed to glProgramBinary and recompiled on failure.
+static uint32_t gl_driver_id_hash(const GrGLInterface* gl) {
+    uint32_t hash = 0;
+    for (GrGLenum name : {GR_GL_VENDOR, GR_GL_RENDERER, GR_GL_VERSION}) {
+        const GrGLubyte* str;
+        GR_GL_CALL_RET(gl, str, GetString(name));
+        if (str) {
+            hash = SkOpts::hash_fn(str, strlen(reinterpret_cast<const char*>(str)), hash);
+        }
+    }
+    return hash;
+}
+
+static void write_program_binary_driver_stamp(SkBinaryWriteBuffer* writer,
+                                              const GrGLContext& ctx) {
+    writer->writeUInt(static_cast<uint32_t>(ctx.driver()));
+    writer->writeUInt(static_cast<uint32_t>(ctx.driverVersion() >> 32));
+    writer->writeUInt(static_cast<uint32_t>(ctx.driverVersion()));
+    writer->writeUInt(gl_driver_id_hash(ctx.glInterface()));
+}
+
+static bool check_program_binary_driver_stamp(SkReadBuffer* reader, const GrGLContext& ctx) {
+    uint32_t driver = reader->readUInt();
+    uint64_t driverVersion = static_cast<uint64_t>(reader->readUInt()) << 32;
+    driverVersion |= reader->readUInt();
+    uint32_t idHash = reader->readUInt();
+    return reader->isValid() &&
+           driver == static_cast<uint32_t>(ctx.driver()) &&
+           driverVersion == ctx.driverVersion() &&
+           idHash == gl_driver_id_hash(ctx.glInterface());
+}
+
+void GrGLProgramBuilder::storeShaderInCache(const SkSL::Program::Inputs& inputs,
+                                            const sk_sp<GrGLProgram>& program,
                                             const SkSL::String shaders[], bool isSkSL,
                                             SkSL::Program::Settings* settings) {
     if (!this->gpu()->getContext()->priv().getPersistentCache()) {
@@ -165,27 +202,20 @@ void GrGLProgramBuilder::storeShaderInCache(const SkSL::Program::Inputs& inputs,
     sk_sp<SkData> key = SkData::MakeWithoutCopy(this->desc().asKey(), this->desc().keyLength());
     SkString description = GrProgramDesc::Describe(fProgramInfo, *fGpu->caps());
     if (fGpu->glCaps().programBinarySupport()) {
-        // binary cache
-        GrGLsizei length = 0;
-        GL_CALL(GetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length));
-        if (length > 0) {
-            SkBinaryWriteBuffer writer;
-            writer.writeInt(GrPersistentCacheUtils::GetCurrentVersion());
-            writer.writeUInt(kGLPB_Tag);
-
-            writer.writePad32(&inputs, sizeof(inputs));
-
-            SkAutoSMalloc<2048> binary(length);
-            GrGLenum binaryFormat;
-            GL_CALL(GetProgramBinary(programID, length, &length, &binaryFormat, binary.get()));
-
-            writer.writeUInt(binaryFormat);
-            writer.writeInt(length);
-            writer.writePad32(binary.get(), length);
-
-            auto data = writer.snapshotAsData();
-            this->gpu()->getContext()->priv().getPersistentCache()->store(*key, *data, description);
-        }
+        // binary cache: serialize everything that precedes the binary now, but defer the
+        // glGetProgramBinary call itself until the surrounding work is submitted. By then
+        // drivers that link on a worker thread have finished, so retrieving the binary does
+        // not block on the link.
+        SkBinaryWriteBuffer writer;
+        writer.writeInt(GrPersistentCacheUtils::GetCurrentVersion());
+        writer.writeUInt(kGLPB_Tag);
+        write_program_binary_driver_stamp(&writer, fGpu->glContext());
+        writer.writePad32(&inputs, sizeof(inputs));
+        fGpu->storeProgramBinaryAtSubmit(program,
+                                         SkData::MakeWithCopy(this->desc().asKey(),
+                                                              this->desc().keyLength()),
+                                         writer.snapshotAsData(),
+                                         std::move(description));
     } else {
         // source cache, plus metadata to allow for a complete precompile
         GrPersistentCacheUtils::ShaderMetadata meta;
@@ -270,6 +300,11 @@ sk_sp<GrGLProgram> GrGLProgramBuilder::finalize(const GrGLPrecompiledProgram* pr
                     cached = false;
                     break;
                 }
+                if (!check_program_binary_driver_stamp(&reader, fGpu->glContext())) {
+                    // the binary was produced by a different driver or driver version
+                    cached = false;
+                    break;
+                }
                 reader.readPad32(&inputs, sizeof(inputs));
                 GrGLenum binaryFormat = reader.readUInt();
                 GrGLsizei length      = reader.readInt();
@@ -452,6 +487,8 @@ sk_sp<GrGLProgram> GrGLProgramBuilder::finalize(const GrGLPrecompiledProgram* pr
 
     cleanup_shaders(fGpu, shadersToDelete);
 
+    sk_sp<GrGLProgram> program = this->createProgram(programID);
+
     // We temporarily can't cache tessellation shaders while using back door GLSL.
     //
     // We also can't cache SkSL or GLSL if we were given a precompiled program, but there's not
@@ -468,9 +505,9 @@ sk_sp<GrGLProgram> GrGLProgramBuilder::finalize(const GrGLPrecompiledProgram* pr
             }
             isSkSL = true;
         }
-        this->storeShaderInCache(inputs, programID, glsl, isSkSL, &settings);
+        this->storeShaderInCache(inputs, program, glsl, isSkSL, &settings);
     }
-    return this->createProgram(programID);
+    return program;
 }
 
 void GrGLProgramBuilder::bindProgramResourceLocations(GrGLuint programID) {
@@ -542,32 +579,97 @@ sk_sp<GrGLProgram> GrGLProgramBuilder::createProgram(GrGLuint programID) {
                              fInstanceStride);
 }
 
-bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
-                                           GrGLPrecompiledProgram* precompiledProgram,
-                                           const SkData& cachedData) {
+// Restores a driver program binary harvested by storeShaderInCache. This skips compilation and
+// linking entirely, so it's the cheapest way to warm the program cache before the first frame.
+static bool precompile_program_binary(GrGLGpu* glGpu,
+                                      GrGLPrecompiledProgram* precompiledProgram,
+                                      SkReadBuffer* reader) {
+    if (!glGpu->glCaps().programBinarySupport() ||
+        !check_program_binary_driver_stamp(reader, glGpu->glContext())) {
+        return false;
+    }
+    SkSL::Program::Inputs inputs;
+    reader->readPad32(&inputs, sizeof(inputs));
+    GrGLenum binaryFormat = reader->readUInt();
+    GrGLsizei length      = reader->readInt();
+    const void* binary = reader->skip(length);
+    if (!reader->isValid()) {
+        return false;
+    }
+    const GrGLInterface* gl = glGpu->glInterface();
+    GrGLuint programID;
+    GR_GL_CALL_RET(gl, programID, CreateProgram());
+    if (0 == programID) {
+        return false;
+    }
+    glGpu->clearErrorsAndCheckForOOM();
+    GR_GL_CALL_NOERRCHECK(gl, ProgramBinary(programID, binaryFormat, const_cast<void*>(binary),
+                                            length));
+    bool linked = glGpu->getErrorAndCheckForOOM() == GR_GL_NO_ERROR;
+    if (linked) {
+        GrGLint status = GR_GL_INIT_ZERO;
+        GR_GL_CALL(gl, GetProgramiv(programID, GR_GL_LINK_STATUS, &status));
+        linked = SkToBool(status);
+    }
+    if (!linked) {
+        GR_GL_CALL(gl, DeleteProgram(programID));
+        return false;
+    }
+    precompiledProgram->fProgramID = programID;
+    precompiledProgram->fInputs = inputs;
+    return true;
+}
+
+bool GrGLProgramBuilder::TranslatePrecompiledProgram(SkSL::Compiler* compiler,
+                                                     bool sharpenTextures,
+                                                     GrContextOptions::ShaderErrorHandler* errorHandler,
+                                                     const SkData& cachedData,
+                                                     GrGLPrecompiledShaderSource* source) {
     SkReadBuffer reader(cachedData.data(), cachedData.size());
     SkFourByteTag shaderType = GrPersistentCacheUtils::GetType(&reader);
     if (shaderType != kSKSL_Tag) {
-        // TODO: Support GLSL, and maybe even program binaries, too?
+        // Program binaries are handled by PrecompileProgram directly.
+        // TODO: Support GLSL, too?
         return false;
     }
 
-    GrGLGpu* glGpu = static_cast<GrGLGpu*>(dContext->priv().getGpu());
-
-    const GrGLInterface* gl = glGpu->glInterface();
-    auto errorHandler = dContext->priv().getShaderErrorHandler();
-
     SkSL::Program::Settings settings;
-    settings.fSharpenTextures = dContext->priv().options().fSharpenMipmappedTextures;
+    settings.fSharpenTextures = sharpenTextures;
     GrPersistentCacheUtils::ShaderMetadata meta;
     meta.fSettings = &settings;
 
     SkSL::String shaders[kGrShaderTypeCount];
-    SkSL::Program::Inputs inputs;
-    if (!GrPersistentCacheUtils::UnpackCachedShaders(&reader, shaders, &inputs, 1, &meta)) {
+    if (!GrPersistentCacheUtils::UnpackCachedShaders(&reader, shaders, &source->fInputs, 1,
+                                                     &meta)) {
+        return false;
+    }
+
+    auto translate = [&](SkSL::ProgramKind kind, GrShaderType type) {
+        return GrSkSLtoGLSL(compiler, kind, shaders[type], settings, &source->fGLSL[type],
+                            errorHandler) != nullptr;
+    };
+
+    if (!translate(SkSL::ProgramKind::kFragment, kFragment_GrShaderType) ||
+        !translate(SkSL::ProgramKind::kVertex, kVertex_GrShaderType) ||
+        (!shaders[kGeometry_GrShaderType].empty() &&
+         !translate(SkSL::ProgramKind::kGeometry, kGeometry_GrShaderType))) {
         return false;
     }
 
+    source->fAttributeNames = std::move(meta.fAttributeNames);
+    source->fHasCustomColorOutput = meta.fHasCustomColorOutput;
+    source->fHasSecondaryColorOutput = meta.fHasSecondaryColorOutput;
+    return true;
+}
+
+bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
+                                           GrGLPrecompiledProgram* precompiledProgram,
+                                           const GrGLPrecompiledShaderSource& source) {
+    GrGLGpu* glGpu = static_cast<GrGLGpu*>(dContext->priv().getGpu());
+
+    const GrGLInterface* gl = glGpu->glInterface();
+    auto errorHandler = dContext->priv().getShaderErrorHandler();
+
     GrGLuint programID;
     GR_GL_CALL_RET(gl, programID, CreateProgram());
     if (0 == programID) {
@@ -576,13 +678,7 @@ bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
 
     SkTDArray<GrGLuint> shadersToDelete;
 
-    auto compileShader = [&](SkSL::ProgramKind kind, const SkSL::String& sksl, GrGLenum type) {
-        SkSL::String glsl;
-        auto program = GrSkSLtoGLSL(glGpu, kind, sksl, settings, &glsl, errorHandler);
-        if (!program) {
-            return false;
-        }
-
+    auto compileShader = [&](const SkSL::String& glsl, GrGLenum type) {
         if (GrGLuint shaderID = GrGLCompileAndAttachShader(glGpu->glContext(), programID, type,
                                                            glsl, glGpu->pipelineBuilder()->stats(),
                                                            errorHandler)) {
@@ -593,32 +689,26 @@ bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
         }
     };
 
-    if (!compileShader(SkSL::ProgramKind::kFragment,
-                       shaders[kFragment_GrShaderType],
-                       GR_GL_FRAGMENT_SHADER) ||
-        !compileShader(SkSL::ProgramKind::kVertex,
-                       shaders[kVertex_GrShaderType],
-                       GR_GL_VERTEX_SHADER) ||
-        (!shaders[kGeometry_GrShaderType].empty() &&
-         !compileShader(SkSL::ProgramKind::kGeometry,
-                       shaders[kGeometry_GrShaderType],
-                       GR_GL_GEOMETRY_SHADER))) {
+    if (!compileShader(source.fGLSL[kFragment_GrShaderType], GR_GL_FRAGMENT_SHADER) ||
+        !compileShader(source.fGLSL[kVertex_GrShaderType], GR_GL_VERTEX_SHADER) ||
+        (!source.fGLSL[kGeometry_GrShaderType].empty() &&
+         !compileShader(source.fGLSL[kGeometry_GrShaderType], GR_GL_GEOMETRY_SHADER))) {
         cleanup_program(glGpu, programID, shadersToDelete);
         return false;
     }
 
-    for (int i = 0; i < meta.fAttributeNames.count(); ++i) {
+    for (int i = 0; i < source.fAttributeNames.count(); ++i) {
         GR_GL_CALL(glGpu->glInterface(), BindAttribLocation(programID, i,
-                                                          meta.fAttributeNames[i].c_str()));
+                                                          source.fAttributeNames[i].c_str()));
     }
 
     const GrGLCaps& caps = glGpu->glCaps();
-    if (meta.fHasCustomColorOutput && caps.bindFragDataLocationSupport()) {
+    if (source.fHasCustomColorOutput && caps.bindFragDataLocationSupport()) {
         GR_GL_CALL(glGpu->glInterface(),
                    BindFragDataLocation(programID, 0,
                                         GrGLSLFragmentShaderBuilder::DeclaredColorOutputName()));
     }
-    if (meta.fHasSecondaryColorOutput && caps.shaderCaps()->mustDeclareFragmentShaderOutput()) {
+    if (source.fHasSecondaryColorOutput && caps.shaderCaps()->mustDeclareFragmentShaderOutput()) {
         GR_GL_CALL(glGpu->glInterface(),
                    BindFragDataLocationIndexed(programID, 0, 1,
                                GrGLSLFragmentShaderBuilder::DeclaredSecondaryColorOutputName()));
@@ -635,6 +725,29 @@ bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
     cleanup_shaders(glGpu, shadersToDelete);
 
     precompiledProgram->fProgramID = programID;
-    precompiledProgram->fInputs = inputs;
+    precompiledProgram->fInputs = source.fInputs;
     return true;
 }
+
+bool GrGLProgramBuilder::PrecompileProgram(GrDirectContext* dContext,
+                                           GrGLPrecompiledProgram* precompiledProgram,
+                                           const SkData& cachedData) {
+    GrGLGpu* glGpu = static_cast<GrGLGpu*>(dContext->priv().getGpu());
+
+    {
+        SkReadBuffer reader(cachedData.data(), cachedData.size());
+        if (GrPersistentCacheUtils::GetType(&reader) == kGLPB_Tag) {
+            return precompile_program_binary(glGpu, precompiledProgram, &reader);
+        }
+    }
+
+    GrGLPrecompiledShaderSource source;
+    if (!TranslatePrecompiledProgram(glGpu->shaderCompiler(),
+                                     dContext->priv().options().fSharpenMipmappedTextures,
+                                     dContext->priv().getShaderErrorHandler(),
+                                     cachedData,
+                                     &source)) {
+        return false;
+    }
+    return PrecompileProgram(dContext, precompiledProgram, source);
+}
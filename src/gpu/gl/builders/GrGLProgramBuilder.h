@@ -33,6 +33,17 @@ struct GrGLPrecompiledProgram {
     SkSL::Program::Inputs fInputs;
 };
 
+// The CPU-side half of a shader precompile: cached SkSL translated to GLSL, plus the metadata
+// needed to bind and link it. Producing one of these makes no GL calls, so it can be built on
+// another thread; see GrGLProgramBuilder::TranslatePrecompiledProgram.
+struct GrGLPrecompiledShaderSource {
+    SkSL::String fGLSL[kGrShaderTypeCount];
+    SkSL::Program::Inputs fInputs;
+    SkTArray<SkSL::String> fAttributeNames;
+    bool fHasCustomColorOutput = false;
+    bool fHasSecondaryColorOutput = false;
+};
+
 class GrGLProgramBuilder : public GrGLSLProgramBuilder {
 public:
     /** Generates a shader program.
@@ -51,6 +62,19 @@ public:
 
     static bool PrecompileProgram(GrDirectContext*, GrGLPrecompiledProgram*, const SkData&);
 
+    /** Translates a cached SkSL blob to GLSL. GL-free, so callable off the context thread with a
+     *  caller-owned compiler; the error handler may be invoked from that thread. */
+    static bool TranslatePrecompiledProgram(SkSL::Compiler*,
+                                            bool sharpenTextures,
+                                            GrContextOptions::ShaderErrorHandler*,
+                                            const SkData& cachedData,
+                                            GrGLPrecompiledShaderSource*);
+
+    /** Compiles and links previously translated GLSL. Must run on the context thread. */
+    static bool PrecompileProgram(GrDirectContext*,
+                                  GrGLPrecompiledProgram*,
+                                  const GrGLPrecompiledShaderSource&);
+
     const GrCaps* caps() const override;
 
     GrGLGpu* gpu() const { return fGpu; }
@@ -70,7 +94,7 @@ private:
     void computeCountsAndStrides(GrGLuint programID,
                                  const GrGeometryProcessor&,
                                  bool bindAttribLocations);
-    void storeShaderInCache(const SkSL::Program::Inputs& inputs, GrGLuint programID,
+    void storeShaderInCache(const SkSL::Program::Inputs& inputs, const sk_sp<GrGLProgram>&,
                             const SkSL::String shaders[], bool isSkSL,
                             SkSL::Program::Settings* settings);
     sk_sp<GrGLProgram> finalize(const GrGLPrecompiledProgram*);
@@ -96,7 +120,8 @@ private:
     size_t fVertexStride;
     size_t fInstanceStride;
 
-    // shader pulled from cache. Data is organized as:
+    // shader pulled from cache. For program binaries the data is organized as:
+    // driver stamp (driver enum, driver version, GL identification string hash)
     // SkSL::Program::Inputs inputs
     // int binaryFormat
     // (all remaining bytes) char[] binary
@@ -21,6 +21,15 @@ std::unique_ptr<SkSL::Program> GrSkSLtoGLSL(const GrGLGpu* gpu,
                                             SkSL::String* glsl,
                                             GrContextOptions::ShaderErrorHandler* errorHandler);
 
+// As above, with an explicit compiler. Unlike the GrGLGpu overload this makes no GL calls, so it
+// may run on any thread as long as the compiler is not shared between threads.
+std::unique_ptr<SkSL::Program> GrSkSLtoGLSL(SkSL::Compiler* compiler,
+                                            SkSL::ProgramKind programKind,
+                                            const SkSL::String& sksl,
+                                            const SkSL::Program::Settings& settings,
+                                            SkSL::String* glsl,
+                                            GrContextOptions::ShaderErrorHandler* errorHandler);
+
 GrGLuint GrGLCompileAndAttachShader(const GrGLContext& glCtx,
                                     GrGLuint programId,
                                     GrGLenum type,
@@ -12,6 +12,7 @@
 #include "include/private/SkHalf.h"
 #include "include/private/SkMalloc.h"
 #include "include/private/SkTemplates.h"
+#include "src/core/SkOpts.h"
 
 #include <functional>
 
@@ -126,17 +127,19 @@ void GrGradientBitmapCache::add(const void* buffer, size_t len, const SkBitmap&
 
 void GrGradientBitmapCache::fillGradient(const SkPMColor4f* colors, const SkScalar* positions,
                                          int count, SkColorType colorType, SkBitmap* bitmap) {
-    SkHalf* pixelsF16 = reinterpret_cast<SkHalf*>(bitmap->getPixels());
     uint32_t* pixels32 = reinterpret_cast<uint32_t*>(bitmap->getPixels());
 
+    // For F16 we lerp the whole ramp in float and narrow to half in one batched pass below.
+    SkAutoSTMalloc<256 * 4, float> rampStorage;
+    float* rampF32 = nullptr;
+    if (colorType == kRGBA_F16_SkColorType) {
+        rampF32 = rampStorage.reset(fResolution * 4);
+    }
+
     typedef std::function<void(const Sk4f&, int)> pixelWriteFn_t;
 
-    pixelWriteFn_t writeF16Pixel = [&](const Sk4f& x, int index) {
-        Sk4h c = SkFloatToHalf_finite_ftz(x);
-        pixelsF16[4*index+0] = c[0];
-        pixelsF16[4*index+1] = c[1];
-        pixelsF16[4*index+2] = c[2];
-        pixelsF16[4*index+3] = c[3];
+    pixelWriteFn_t writeF16Pixel = [&](const Sk4f& c, int index) {
+        c.store(rampF32 + 4*index);
     };
     pixelWriteFn_t write8888Pixel = [&](const Sk4f& c, int index) {
         pixels32[index] = Sk4f_toL32(c);
@@ -168,6 +171,11 @@ void GrGradientBitmapCache::fillGradient(const SkPMColor4f* colors, const SkScal
         prevIndex = nextIndex;
     }
     SkASSERT(prevIndex == fResolution - 1);
+
+    if (rampF32) {
+        SkOpts::floats_to_halfs(reinterpret_cast<SkHalf*>(bitmap->getPixels()),
+                                rampF32, fResolution * 4);
+    }
 }
 
 void GrGradientBitmapCache::getGradient(const SkPMColor4f* colors, const SkScalar* positions,
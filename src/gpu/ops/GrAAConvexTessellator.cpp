@@ -27,6 +27,14 @@ static const SkScalar kQuadTolerance = 0.2f;
 static const SkScalar kCubicTolerance = 0.2f;
 static const SkScalar kConicTolerance = 0.25f;
 
+// Complexity budget: the ring computations are linear in the point count per ring, and the
+// point count is otherwise driven by authored geometry (e.g. rounded polygons with hundreds of
+// points). Above this many extracted points, near-colinear fusing is re-run with progressively
+// coarser tolerances (doubling from kClose up to kMaxDecimationTol) until the polygon fits the
+// budget, bounding tessellation cost by screen-space detail rather than authored point count.
+static const int kPtCountBudget = 256;
+static const SkScalar kMaxDecimationTol = 1.0f;
+
 // dot product below which we use a round cap between curve segments
 static const SkScalar kRoundCapThreshold = 0.8f;
 
@@ -60,14 +68,15 @@ static bool duplicate_pt(const SkPoint& p0, const SkPoint& p1) {
 }
 
 static bool points_are_colinear_and_b_is_middle(const SkPoint& a, const SkPoint& b,
-                                                const SkPoint& c, float* accumError) {
+                                                const SkPoint& c, float* accumError,
+                                                SkScalar tol = kClose) {
     // First check distance from b to the infinite line through a, c
     SkVector aToC = c - a;
     SkVector n = {aToC.fY, -aToC.fX};
     n.normalize();
 
     SkScalar distBToLineAC = SkScalarAbs(n.dot(b) - n.dot(a));
-    if (*accumError + distBToLineAC >= kClose || aToC.dot(b - a) <= 0.f || aToC.dot(c - b) <= 0.f) {
+    if (*accumError + distBToLineAC >= tol || aToC.dot(b - a) <= 0.f || aToC.dot(c - b) <= 0.f) {
         // Too far from the line or not between the line segment from a to c
         return false;
     } else {
@@ -118,6 +127,37 @@ void GrAAConvexTessellator::popFirstPtShuffle() {
     this->validate();
 }
 
+void GrAAConvexTessellator::removePt(int index) {
+    this->validate();
+
+    fPts.remove(index);
+    fCoverages.remove(index);
+    fMovable.remove(index);
+    fCurveState.remove(index);
+
+    this->validate();
+}
+
+// Fuse near-colinear points with progressively coarser tolerances until the polygon fits
+// kPtCountBudget. Removing a vertex of a convex polygon keeps it convex and moves the boundary
+// inward by less than the tolerance, so the result stays within a pixel of the exact outline.
+void GrAAConvexTessellator::decimate() {
+    SkScalar tol = kClose;
+    while (this->numPts() > kPtCountBudget && tol < kMaxDecimationTol) {
+        tol *= 2;
+        SkScalar accumError = 0.f;
+        for (int i = 1; this->numPts() > 3 && i < this->numPts() - 1;) {
+            if (points_are_colinear_and_b_is_middle(fPts[i - 1], fPts[i], fPts[i + 1],
+                                                    &accumError, tol)) {
+                this->removePt(i);
+            } else {
+                accumError = 0.f;
+                ++i;
+            }
+        }
+    }
+}
+
 void GrAAConvexTessellator::updatePt(int index,
                                      const SkPoint& pt,
                                      SkScalar depth,
@@ -452,6 +492,11 @@ bool GrAAConvexTessellator::extractFromPath(const SkMatrix& m, const SkPath& pat
         }
     }
 
+    // Enforce the complexity budget before the ring machinery runs.
+    if (this->numPts() > kPtCountBudget) {
+        this->decimate();
+    }
+
     // Compute the normals and bisectors.
     SkASSERT(fNorms.empty());
     if (this->numPts() >= 3) {
@@ -196,6 +196,8 @@ private:
     int addPt(const SkPoint& pt, SkScalar depth, SkScalar coverage, bool movable, CurveState curve);
     void popLastPt();
     void popFirstPtShuffle();
+    void removePt(int index);
+    void decimate();
 
     void updatePt(int index, const SkPoint& pt, SkScalar depth, SkScalar coverage);
 
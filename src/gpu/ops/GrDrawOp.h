@@ -46,6 +46,14 @@ public:
         return this->fixedFunctionFlags() & FixedFunctionFlags::kUsesStencil;
     }
 
+    /**
+     * Returns true if the op's geometry rasterizes every pixel inside its bounds with full
+     * coverage (no AA bloat, no interior gaps). Combined with a dst-independent blend from the
+     * processor analysis, such a draw overwrites everything beneath its bounds, which the ops
+     * task uses to cull occluded earlier draws. Conservatively false by default.
+     */
+    virtual bool fillsBoundsExactly() const { return false; }
+
 #ifdef SK_DEBUG
     bool fAddDrawOpCalled = false;
 
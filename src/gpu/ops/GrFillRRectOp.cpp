@@ -69,8 +69,12 @@ private:
         kWideColor        = 1 << 2,
         kMSAAEnabled      = 1 << 3,
         kFakeNonAA        = 1 << 4,
+        // The rrect's four corners share a single (x,y) radius pair (rect/oval/simple types).
+        // The instance data carries that one pair instead of all eight radii and the shader
+        // broadcasts it. This is the overwhelmingly common case in UI content.
+        kUniformRadii     = 1 << 5,
     };
-    constexpr static int kNumProcessorFlags = 5;
+    constexpr static int kNumProcessorFlags = 6;
 
     GR_DECL_BITFIELD_CLASS_OPS_FRIENDS(ProcessorFlags);
 
@@ -175,6 +179,9 @@ GrOp::Owner FillRRectOp::Make(GrRecordingContext* ctx,
     if (aa == GrAA::kNo) {
         flags |= ProcessorFlags::kFakeNonAA;
     }
+    if (rrect.getType() <= SkRRect::kSimple_Type) {
+        flags |= ProcessorFlags::kUniformRadii;
+    }
 
     // Produce a matrix that draws the round rect from normalized [-1, -1, +1, +1] space.
     float l = rrect.rect().left(), r = rrect.rect().right(),
@@ -226,10 +233,16 @@ FillRRectOp::FillRRectOp(GrProcessorSet* processorSet,
     this->writeInstanceData(m.getTranslateX(), m.getTranslateY());
 
     // Convert the radii to [-1, -1, +1, +1] space and write their attribs.
-    Sk4f radiiX, radiiY;
-    Sk4f::Load2(SkRRectPriv::GetRadiiArray(rrect), &radiiX, &radiiY);
-    (radiiX * (2/rrect.width())).store(this->appendInstanceData<float>(4));
-    (radiiY * (2/rrect.height())).store(this->appendInstanceData<float>(4));
+    if (fProcessorFlags & ProcessorFlags::kUniformRadii) {
+        // All four corners share one radius pair; write it once and let the shader broadcast.
+        const SkVector& radii = rrect.getSimpleRadii();
+        this->writeInstanceData(radii.fX * (2/rrect.width()), radii.fY * (2/rrect.height()));
+    } else {
+        Sk4f radiiX, radiiY;
+        Sk4f::Load2(SkRRectPriv::GetRadiiArray(rrect), &radiiX, &radiiY);
+        (radiiX * (2/rrect.width())).store(this->appendInstanceData<float>(4));
+        (radiiY * (2/rrect.height())).store(this->appendInstanceData<float>(4));
+    }
 
     // We will write the color and local rect attribs during finalize().
 }
@@ -301,8 +314,13 @@ private:
 
         fInstanceAttribs.emplace_back("skew", kFloat4_GrVertexAttribType, kFloat4_GrSLType);
         fInstanceAttribs.emplace_back("translate", kFloat2_GrVertexAttribType, kFloat2_GrSLType);
-        fInstanceAttribs.emplace_back("radii_x", kFloat4_GrVertexAttribType, kFloat4_GrSLType);
-        fInstanceAttribs.emplace_back("radii_y", kFloat4_GrVertexAttribType, kFloat4_GrSLType);
+        if (fFlags & ProcessorFlags::kUniformRadii) {
+            fInstanceAttribs.emplace_back(
+                    "radii_pair", kFloat2_GrVertexAttribType, kFloat2_GrSLType);
+        } else {
+            fInstanceAttribs.emplace_back("radii_x", kFloat4_GrVertexAttribType, kFloat4_GrSLType);
+            fInstanceAttribs.emplace_back("radii_y", kFloat4_GrVertexAttribType, kFloat4_GrSLType);
+        }
         fColorAttrib = &fInstanceAttribs.push_back(
                 MakeColorAttribute("color", (fFlags & ProcessorFlags::kWideColor)));
         if (fFlags & ProcessorFlags::kHasLocalCoords) {
@@ -525,6 +543,11 @@ class FillRRectOp::Processor::Impl : public GrGLSLGeometryProcessor {
         v->codeAppend("float2 aa_bloatradius = axiswidths * pixellength * .5;");
 
         // Identify our radii.
+        if (proc.fFlags & ProcessorFlags::kUniformRadii) {
+            // All four corners share one radius pair; broadcast it so the math below is unchanged.
+            v->codeAppend("float4 radii_x = radii_pair.xxxx;");
+            v->codeAppend("float4 radii_y = radii_pair.yyyy;");
+        }
         v->codeAppend("float4 radii_and_neighbors = radii_selector"
                               "* float4x4(radii_x, radii_y, radii_x.yxwz, radii_y.wzyx);");
         v->codeAppend("float2 radii = radii_and_neighbors.xy;");
@@ -176,6 +176,16 @@ public:
 
     DEFINE_OP_CLASS_ID
 
+    bool fillsBoundsExactly() const override {
+        // A single non-AA axis-aligned quad rasterizes exactly its bounds. Merged ops hold
+        // multiple quads whose union need not cover the joint bounds, and a stencil test could
+        // discard interior pixels.
+        return fHelper.aaType() == GrAAType::kNone &&
+               !this->usesStencil() &&
+               fQuads.count() == 1 &&
+               fQuads.deviceQuadType() == GrQuad::Type::kAxisAligned;
+    }
+
 private:
     friend class ::GrFillRectOp; // for access to addQuad
 
@@ -32,6 +32,7 @@ void GrSmallPathAtlasMgr::reset() {
 
     fShapeList.reset();
     fShapeCache.reset();
+    fCachedMaskBytes = 0;
 
 #ifdef DF_PATH_TRACKING
     SkDebugf("Cached shapes: %d, freed shapes: %d\n", g_NumCachedShapes, g_NumFreedShapes);
@@ -63,6 +64,7 @@ bool GrSmallPathAtlasMgr::initAtlas(GrProxyProvider* proxyProvider, const GrCaps
 }
 
 void GrSmallPathAtlasMgr::deleteCacheEntry(GrSmallPathShapeData* shapeData) {
+    fCachedMaskBytes -= shapeData->cachedMaskBytes();
     fShapeCache.remove(shapeData->fKey);
     fShapeList.remove(shapeData);
     delete shapeData;
@@ -113,6 +115,42 @@ void GrSmallPathAtlasMgr::setUseToken(GrSmallPathShapeData* shapeData,
     fAtlas->setLastUseToken(shapeData->fAtlasLocator, token);
 }
 
+void GrSmallPathAtlasMgr::cacheMask(GrSmallPathShapeData* shapeData, const void* image,
+                                    int width, int height, int srcInset) {
+    SkASSERT(!shapeData->hasCachedMask());
+
+    size_t size = (size_t)width * height;
+    if (size > kMaxCachedMaskBytes) {
+        return;
+    }
+
+    shapeData->fMaskData.append((int)size, static_cast<const uint8_t*>(image));
+    shapeData->fMaskWidth = width;
+    shapeData->fMaskHeight = height;
+    shapeData->fMaskInset = srcInset;
+    fCachedMaskBytes += size;
+
+    // Purge the oldest cached masks until we're back within budget. Entries that are no longer
+    // in the atlas exist solely to hold their mask so they are deleted outright.
+    ShapeDataList::Iter iter;
+    iter.init(fShapeList, ShapeDataList::Iter::kHead_IterStart);
+    GrSmallPathShapeData* entry;
+    while (fCachedMaskBytes > kMaxCachedMaskBytes && (entry = iter.get())) {
+        iter.next();
+        if (entry == shapeData || !entry->hasCachedMask()) {
+            continue;
+        }
+        fCachedMaskBytes -= entry->cachedMaskBytes();
+        if (entry->fAtlasLocator.plotLocator().isValid()) {
+            entry->fMaskData.reset();
+        } else {
+            fShapeCache.remove(entry->fKey);
+            fShapeList.remove(entry);
+            delete entry;
+        }
+    }
+}
+
 // Callback to clear out internal path cache when eviction occurs
 void GrSmallPathAtlasMgr::evict(GrDrawOpAtlas::PlotLocator plotLocator) {
     // remove any paths that use this plot
@@ -122,6 +160,12 @@ void GrSmallPathAtlasMgr::evict(GrDrawOpAtlas::PlotLocator plotLocator) {
     while ((shapeData = iter.get())) {
         iter.next();
         if (plotLocator == shapeData->fAtlasLocator.plotLocator()) {
+            if (shapeData->hasCachedMask()) {
+                // Keep the entry; its cached mask lets the shape be re-added to the atlas
+                // without re-rasterization.
+                shapeData->fAtlasLocator.invalidatePlotLocator();
+                continue;
+            }
             fShapeCache.remove(shapeData->fKey);
             fShapeList.remove(shapeData);
             delete shapeData;
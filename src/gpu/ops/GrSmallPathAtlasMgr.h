@@ -46,7 +46,18 @@ public:
 
     void setUseToken(GrSmallPathShapeData*, GrDeferredUploadToken);
 
+    // Stores a CPU copy of 'shapeData's rasterized mask so the shape can be re-added to the
+    // atlas without re-rasterization if its plot is evicted. The oldest cached masks are purged
+    // to stay within budget.
+    void cacheMask(GrSmallPathShapeData* shapeData, const void* image,
+                   int width, int height, int srcInset);
+
     // GrOnFlushCallbackObject overrides
+
+    // The small path atlas only uploads CPU-rasterized masks; schedule it with the other
+    // upload-only atlases.
+    AtlasPhase atlasPhase() const override { return AtlasPhase::kUpload; }
+
     void preFlush(GrOnFlushResourceProvider* onFlushRP,
                   SkSpan<const uint32_t> /* taskIDs */) override {
         if (fAtlas) {
@@ -80,9 +91,12 @@ private:
     using ShapeCache = SkTDynamicHash<GrSmallPathShapeData, GrSmallPathShapeDataKey>;
     typedef SkTInternalLList<GrSmallPathShapeData> ShapeDataList;
 
+    static constexpr size_t kMaxCachedMaskBytes = 4 * 1024 * 1024;
+
     std::unique_ptr<GrDrawOpAtlas> fAtlas;
     ShapeCache                     fShapeCache;
     ShapeDataList                  fShapeList;
+    size_t                         fCachedMaskBytes = 0;
 };
 
 #endif // GrSmallPathAtlasMgr_DEFINED
@@ -391,9 +391,23 @@ private:
         return GrDrawOpAtlas::ErrorCode::kSucceeded == code;
     }
 
+    // Re-adds a shape whose rasterized mask was retained when its plot was evicted.
+    bool addCachedMaskToAtlas(GrMeshDrawTarget* target, FlushInfo* flushInfo,
+                              GrSmallPathAtlasMgr* atlasMgr,
+                              GrSmallPathShapeData* shapeData) const {
+        SkASSERT(shapeData->hasCachedMask());
+        return this->addToAtlasWithRetry(target, flushInfo, atlasMgr,
+                                         shapeData->fMaskWidth, shapeData->fMaskHeight,
+                                         shapeData->fMaskData.begin(), shapeData->fBounds,
+                                         shapeData->fMaskInset, shapeData);
+    }
+
     bool addDFPathToAtlas(GrMeshDrawTarget* target, FlushInfo* flushInfo,
                           GrSmallPathAtlasMgr* atlasMgr, GrSmallPathShapeData* shapeData,
                           const GrStyledShape& shape, uint32_t dimension, SkScalar scale) const {
+        if (shapeData->hasCachedMask()) {
+            return this->addCachedMaskToAtlas(target, flushInfo, atlasMgr, shapeData);
+        }
 
         const SkRect& bounds = shape.bounds();
 
@@ -478,6 +492,8 @@ private:
         drawBounds.fRight /= scale;
         drawBounds.fBottom /= scale;
 
+        atlasMgr->cacheMask(shapeData, dfStorage.get(), width, height, SK_DistanceFieldPad);
+
         return this->addToAtlasWithRetry(target, flushInfo, atlasMgr,
                                          width, height, dfStorage.get(),
                                          drawBounds, SK_DistanceFieldPad, shapeData);
@@ -486,6 +502,10 @@ private:
     bool addBMPathToAtlas(GrMeshDrawTarget* target, FlushInfo* flushInfo,
                           GrSmallPathAtlasMgr* atlasMgr, GrSmallPathShapeData* shapeData,
                           const GrStyledShape& shape, const SkMatrix& ctm) const {
+        if (shapeData->hasCachedMask()) {
+            return this->addCachedMaskToAtlas(target, flushInfo, atlasMgr, shapeData);
+        }
+
         const SkRect& bounds = shape.bounds();
         if (bounds.isEmpty()) {
             return false;
@@ -545,6 +565,8 @@ private:
 
         SkRect drawBounds = SkRect::Make(devPathBounds).makeOffset(-translateX, -translateY);
 
+        atlasMgr->cacheMask(shapeData, dst.addr(), dst.width(), dst.height(), 0);
+
         return this->addToAtlasWithRetry(target, flushInfo, atlasMgr,
                                          dst.width(), dst.height(), dst.addr(),
                                          drawBounds, 0, shapeData);
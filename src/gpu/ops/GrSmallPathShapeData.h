@@ -8,6 +8,7 @@
 #ifndef GrSmallPathShapeData_DEFINED
 #define GrSmallPathShapeData_DEFINED
 
+#include "include/private/SkTDArray.h"
 #include "src/core/SkOpts.h"
 #include "src/gpu/GrDrawOpAtlas.h"
 
@@ -52,6 +53,16 @@ public:
     SkRect                        fBounds;
     GrDrawOpAtlas::AtlasLocator   fAtlasLocator;
 
+    // CPU copy of the rasterized mask, retained (within GrSmallPathAtlasMgr's budget) so that
+    // the shape can be re-added to the atlas without re-rasterization after its plot is evicted.
+    SkTDArray<uint8_t>            fMaskData;
+    int                           fMaskWidth = 0;
+    int                           fMaskHeight = 0;
+    int                           fMaskInset = 0;
+
+    bool hasCachedMask() const { return !fMaskData.isEmpty(); }
+    size_t cachedMaskBytes() const { return fMaskData.count() * sizeof(uint8_t); }
+
     SK_DECLARE_INTERNAL_LLIST_INTERFACE(GrSmallPathShapeData);
 
     static inline const GrSmallPathShapeDataKey& GetKey(const GrSmallPathShapeData& data) {
@@ -68,6 +68,13 @@ bool cache_match(const SkData* data, SkScalar tol) {
     return info->fIsLinear || info->fTolerance < 3.0f * tol;
 }
 
+// Curves are triangulated at a finer tolerance than the current view requires. Triangulating at
+// exactly the required tolerance means that any zoom-in fails the cache_match test above and
+// re-triangulates, so zooming a path re-runs the triangulator nearly every frame. The refinement
+// costs some extra vertices up front but, combined with the 3x slack in cache_match, lets one
+// cached triangulation serve all zoom-outs and up to a 12x zoom-in.
+static constexpr SkScalar kTolRefinement = 0.25f;
+
 // Should 'challenger' replace 'incumbent' in the cache if there is a collision?
 bool is_newer_better(SkData* incumbent, SkData* challenger) {
     const TessInfo* i = static_cast<const TessInfo*>(incumbent->data());
@@ -361,15 +368,15 @@ private:
         StaticVertexAllocator allocator(rp, canMapVB);
 
         bool isLinear;
-        int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
-                                      &isLinear);
+        int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds,
+                                      kTolRefinement * tol, &isLinear);
         if (vertexCount == 0) {
             return;
         }
 
         fVertexData = allocator.detachVertexData();
 
-        key.setCustomData(create_data(vertexCount, isLinear, tol));
+        key.setCustomData(create_data(vertexCount, isLinear, kTolRefinement * tol));
 
         auto [tmpV, tmpD] = threadSafeCache->addVertsWithData(key, fVertexData, is_newer_better);
         if (tmpV != fVertexData) {
@@ -497,15 +504,15 @@ private:
         GrCpuVertexAllocator allocator;
 
         bool isLinear;
-        int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
-                                      &isLinear);
+        int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds,
+                                      kTolRefinement * tol, &isLinear);
         if (vertexCount == 0) {
             return;
         }
 
         fVertexData = allocator.detachVertexData();
 
-        key.setCustomData(create_data(vertexCount, isLinear, tol));
+        key.setCustomData(create_data(vertexCount, isLinear, kTolRefinement * tol));
 
         // If some other thread created and cached its own triangulation, the 'is_newer_better'
         // predicate will replace the version in the cache if 'fVertexData' is a more accurate
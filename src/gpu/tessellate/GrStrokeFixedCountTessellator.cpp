@@ -7,8 +7,15 @@
 
 #include "src/gpu/tessellate/GrStrokeFixedCountTessellator.h"
 
+#include "include/private/SkFloatBits.h"
+#include "include/private/SkIDChangeListener.h"
 #include "src/core/SkGeometry.h"
+#include "src/core/SkPathPriv.h"
+#include "src/core/SkRectPriv.h"
+#include "src/gpu/GrMeshDrawTarget.h"
+#include "src/gpu/GrResourceCache.h"
 #include "src/gpu/GrResourceProvider.h"
+#include "src/gpu/GrThreadSafeCache.h"
 #include "src/gpu/geometry/GrPathUtils.h"
 #include "src/gpu/geometry/GrWangsFormula.h"
 #include "src/gpu/tessellate/GrCullTest.h"
@@ -19,19 +26,54 @@ namespace {
 constexpr static float kMaxParametricSegments_pow4 = 32*32*32*32;  // 32^4
 constexpr static int8_t kMaxParametricSegments_log2 = 5;  // log2(32)
 
-// Writes out strokes to the given instance chunk array, chopping if necessary so that all instances
+// Accumulates instances in malloc'ed memory, interface-compatible with the way InstanceWriter
+// uses GrVertexChunkBuilder. Used to generate instance data that will outlive the flush and be
+// shared across frames via GrThreadSafeCache.
+class CpuInstanceBuffer : SkNoncopyable {
+public:
+    CpuInstanceBuffer(size_t stride, int preallocCount)
+            : fStride(stride)
+            , fCapacity(std::max(preallocCount, 1))
+            , fData(static_cast<char*>(sk_malloc_throw(fCapacity * fStride))) {}
+
+    ~CpuInstanceBuffer() { sk_free(fData); }
+
+    SK_ALWAYS_INLINE GrVertexWriter appendVertex() {
+        if (fCount == fCapacity) {
+            fCapacity *= 2;
+            fData = static_cast<char*>(sk_realloc_throw(fData, fCapacity * fStride));
+        }
+        return {fData + fStride * fCount++};
+    }
+
+    int count() const { return fCount; }
+
+    // Releases ownership of the instance data to the caller, who becomes responsible for
+    // sk_free-ing it (e.g., by wrapping it in a GrThreadSafeCache::VertexData).
+    void* detach() { return std::exchange(fData, nullptr); }
+
+private:
+    const size_t fStride;
+    int fCapacity;
+    int fCount = 0;
+    char* fData;
+};
+
+// Writes out strokes to the given chunk builder, chopping if necessary so that all instances
 // require 32 parametric segments or less. (We don't consider radial segments here. The tessellator
-// will just add enough additional segments to handle a worst-case 180 degree stroke.)
+// will just add enough additional segments to handle a worst-case 180 degree stroke.) The chunk
+// builder is either a GrVertexChunkBuilder writing directly to draw buffers or a
+// CpuInstanceBuffer accumulating cacheable instances.
+template <typename ChunkBuilder>
 class InstanceWriter {
 public:
     using ShaderFlags = GrStrokeTessellator::ShaderFlags;
 
-    InstanceWriter(ShaderFlags shaderFlags, GrMeshDrawTarget* target, float matrixMaxScale,
-                   const SkRect& strokeCullBounds, const SkMatrix& viewMatrix,
-                   GrVertexChunkArray* patchChunks, size_t instanceStride, int minInstancesPerChunk)
+    InstanceWriter(ShaderFlags shaderFlags, ChunkBuilder* chunkBuilder, float matrixMaxScale,
+                   const SkRect& strokeCullBounds, const SkMatrix& viewMatrix)
             : fShaderFlags(shaderFlags)
             , fCullTest(strokeCullBounds, viewMatrix)
-            , fChunkBuilder(target, patchChunks, instanceStride, minInstancesPerChunk)
+            , fChunkBuilder(chunkBuilder)
             , fParametricPrecision(GrStrokeTolerances::CalcParametricPrecision(matrixMaxScale)) {
     }
 
@@ -114,7 +156,7 @@ public:
     // Draws a circle whose diameter is equal to the stroke width. We emit circles at cusp points
     // round caps, and empty strokes that are specified to be drawn as circles.
     void writeCircle(SkPoint location) {
-        if (GrVertexWriter writer = fChunkBuilder.appendVertex()) {
+        if (GrVertexWriter writer = fChunkBuilder->appendVertex()) {
             // The shader interprets an empty stroke + empty join as a special case that denotes a
             // circle, or 180-degree point stroke.
             writer.fill(location, 5);
@@ -181,7 +223,7 @@ private:
             memcpy(fDeferredFirstStroke, p, sizeof(fDeferredFirstStroke));
             fHasDeferredFirstStroke = true;
             fHasLastControlPoint = true;
-        } else if (GrVertexWriter writer = fChunkBuilder.appendVertex()) {
+        } else if (GrVertexWriter writer = fChunkBuilder->appendVertex()) {
             writer.writeArray(p, 4);
             writer.write(fLastControlPoint);
             this->writeDynamicAttribs(&writer);
@@ -207,7 +249,7 @@ private:
 
     const ShaderFlags fShaderFlags;
     const GrCullTest fCullTest;
-    GrVertexChunkBuilder fChunkBuilder;
+    ChunkBuilder* const fChunkBuilder;
     const float fParametricPrecision;
     float fMaxParametricSegments_pow4 = 1;
 
@@ -233,55 +275,40 @@ static int worst_case_edges_in_join(SkPaint::Join joinType, float numRadialSegme
     return numEdges;
 }
 
-}  // namespace
-
-GrStrokeFixedCountTessellator::GrStrokeFixedCountTessellator(const GrShaderCaps& shaderCaps,
-                                                             ShaderFlags shaderFlags,
-                                                             const SkMatrix& viewMatrix,
-                                                             PathStrokeList* pathStrokeList,std::array<float,
-                                                             2> matrixMinMaxScales,
-                                                             const SkRect& strokeCullBounds)
-        : GrStrokeTessellator(shaderCaps, GrStrokeTessellationShader::Mode::kFixedCount,
-                              shaderFlags, kMaxParametricSegments_log2, viewMatrix,
-                              pathStrokeList, matrixMinMaxScales, strokeCullBounds) {
-}
-
-GR_DECLARE_STATIC_UNIQUE_KEY(gVertexIDFallbackBufferKey);
+// Fills the instance writer with every stroke in the path-stroke list, returning (via out
+// params) the worst-case join edge count and radial segments per radian that the caller needs in
+// order to size the fixed-count triangle strip.
+template <typename ChunkBuilder>
+static void write_path_strokes(const GrShaderCaps& shaderCaps,
+                               const GrStrokeTessellationShader& shader,
+                               GrStrokeTessellator::PathStrokeList* pathStrokeList,
+                               const float matrixMinMaxScales[2],
+                               InstanceWriter<ChunkBuilder>* instanceWriter,
+                               int* outMaxEdgesInJoin,
+                               float* outMaxRadialSegmentsPerRadian) {
+    using PathStrokeList = GrStrokeTessellator::PathStrokeList;
 
-void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
-                                            int totalCombinedVerbCnt) {
-    const GrShaderCaps& shaderCaps = *target->caps().shaderCaps();
     int maxEdgesInJoin = 0;
     float maxRadialSegmentsPerRadian = 0;
 
-    // Over-allocate enough patches for each stroke to chop once, and for 8 extra caps. Since we
-    // have to chop at inflections, points of 180 degree rotation, and anywhere a stroke requires
-    // too many parametric segments, many strokes will end up getting choppped.
-    int strokePreallocCount = totalCombinedVerbCnt * 2;
-    int capPreallocCount = 8;
-    int minInstancesPerChunk = strokePreallocCount + capPreallocCount;
-    InstanceWriter instanceWriter(fShader.flags(), target, fMatrixMinMaxScales[1],
-                                  fStrokeCullBounds, fShader.viewMatrix(), &fInstanceChunks,
-                                  fShader.instanceStride(), minInstancesPerChunk);
-
-    if (!fShader.hasDynamicStroke()) {
+    if (!shader.hasDynamicStroke()) {
         // Strokes are static. Calculate tolerances once.
-        const SkStrokeRec& stroke = fPathStrokeList->fStroke;
-        float localStrokeWidth = GrStrokeTolerances::GetLocalStrokeWidth(fMatrixMinMaxScales.data(),
+        const SkStrokeRec& stroke = pathStrokeList->fStroke;
+        float localStrokeWidth = GrStrokeTolerances::GetLocalStrokeWidth(matrixMinMaxScales,
                                                                          stroke.getWidth());
         float numRadialSegmentsPerRadian = GrStrokeTolerances::CalcNumRadialSegmentsPerRadian(
-                instanceWriter.parametricPrecision(), localStrokeWidth);
+                instanceWriter->parametricPrecision(), localStrokeWidth);
         maxEdgesInJoin = worst_case_edges_in_join(stroke.getJoin(), numRadialSegmentsPerRadian);
         maxRadialSegmentsPerRadian = numRadialSegmentsPerRadian;
     }
 
     // Fast SIMD queue that buffers up values for "numRadialSegmentsPerRadian". Only used when we
     // have dynamic stroke.
-    GrStrokeToleranceBuffer toleranceBuffer(instanceWriter.parametricPrecision());
+    GrStrokeToleranceBuffer toleranceBuffer(instanceWriter->parametricPrecision());
 
-    for (PathStrokeList* pathStroke = fPathStrokeList; pathStroke; pathStroke = pathStroke->fNext) {
+    for (PathStrokeList* pathStroke = pathStrokeList; pathStroke; pathStroke = pathStroke->fNext) {
         const SkStrokeRec& stroke = pathStroke->fStroke;
-        if (fShader.hasDynamicStroke()) {
+        if (shader.hasDynamicStroke()) {
             // Strokes are dynamic. Calculate tolerances every time.
             float numRadialSegmentsPerRadian =
                     toleranceBuffer.fetchRadialSegmentsPerRadian(pathStroke);
@@ -290,40 +317,40 @@ void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
                     maxEdgesInJoin);
             maxRadialSegmentsPerRadian = std::max(numRadialSegmentsPerRadian,
                                                   maxRadialSegmentsPerRadian);
-            instanceWriter.updateDynamicStroke(stroke);
+            instanceWriter->updateDynamicStroke(stroke);
         }
-        if (fShader.hasDynamicColor()) {
-            instanceWriter.updateDynamicColor(pathStroke->fColor);
+        if (shader.hasDynamicColor()) {
+            instanceWriter->updateDynamicColor(pathStroke->fColor);
         }
-        GrStrokeIterator strokeIter(pathStroke->fPath, &pathStroke->fStroke, &fShader.viewMatrix());
+        GrStrokeIterator strokeIter(pathStroke->fPath, &pathStroke->fStroke, &shader.viewMatrix());
         while (strokeIter.next()) {
             const SkPoint* p = strokeIter.pts();
             switch (strokeIter.verb()) {
                 using Verb = GrStrokeIterator::Verb;
                 int numChops;
                 case Verb::kContourFinished:
-                    instanceWriter.finishContour();
+                    instanceWriter->finishContour();
                     break;
                 case Verb::kCircle:
                     // Round cap or else an empty stroke that is specified to be drawn as a circle.
-                    instanceWriter.writeCircle(p[0]);
+                    instanceWriter->writeCircle(p[0]);
                     [[fallthrough]];
                 case Verb::kMoveWithinContour:
-                    instanceWriter.setLastControlPoint(p[0]);
+                    instanceWriter->setLastControlPoint(p[0]);
                     break;
                 case Verb::kLine:
-                    instanceWriter.lineTo(p[0], p[1]);
+                    instanceWriter->lineTo(p[0], p[1]);
                     break;
                 case Verb::kQuad:
                     if (GrPathUtils::conicHasCusp(p)) {
                         // The cusp is always at the midtandent.
                         SkPoint cusp = SkEvalQuadAt(p, SkFindQuadMidTangent(p));
-                        instanceWriter.writeCircle(cusp);
+                        instanceWriter->writeCircle(cusp);
                         // A quad can only have a cusp if it's flat with a 180-degree turnaround.
-                        instanceWriter.lineTo(p[0], cusp);
-                        instanceWriter.lineTo(cusp, p[2]);
+                        instanceWriter->lineTo(p[0], cusp);
+                        instanceWriter->lineTo(cusp, p[2]);
                     } else {
-                        instanceWriter.quadraticTo(p);
+                        instanceWriter->quadraticTo(p);
                     }
                     break;
                 case Verb::kConic:
@@ -331,12 +358,12 @@ void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
                         // The cusp is always at the midtandent.
                         SkConic conic(p, strokeIter.w());
                         SkPoint cusp = conic.evalAt(conic.findMidTangent());
-                        instanceWriter.writeCircle(cusp);
+                        instanceWriter->writeCircle(cusp);
                         // A conic can only have a cusp if it's flat with a 180-degree turnaround.
-                        instanceWriter.lineTo(p[0], cusp);
-                        instanceWriter.lineTo(cusp, p[2]);
+                        instanceWriter->lineTo(p[0], cusp);
+                        instanceWriter->lineTo(cusp, p[2]);
                     } else {
-                        instanceWriter.conicTo(shaderCaps, p, strokeIter.w());
+                        instanceWriter->conicTo(shaderCaps, p, strokeIter.w());
                     }
                     break;
                 case Verb::kCubic:
@@ -345,32 +372,32 @@ void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
                     bool areCusps;
                     numChops = GrPathUtils::findCubicConvex180Chops(p, T, &areCusps);
                     if (numChops == 0) {
-                        instanceWriter.cubicConvex180To(p);
+                        instanceWriter->cubicConvex180To(p);
                     } else if (numChops == 1) {
                         SkChopCubicAt(p, chops, T[0]);
                         if (areCusps) {
-                            instanceWriter.writeCircle(chops[3]);
+                            instanceWriter->writeCircle(chops[3]);
                             // In a perfect world, these 3 points would be be equal after chopping
                             // on a cusp.
                             chops[2] = chops[4] = chops[3];
                         }
-                        instanceWriter.cubicConvex180To(chops);
-                        instanceWriter.cubicConvex180To(chops + 3);
+                        instanceWriter->cubicConvex180To(chops);
+                        instanceWriter->cubicConvex180To(chops + 3);
                     } else {
                         SkASSERT(numChops == 2);
                         SkChopCubicAt(p, chops, T[0], T[1]);
                         if (areCusps) {
-                            instanceWriter.writeCircle(chops[3]);
-                            instanceWriter.writeCircle(chops[6]);
+                            instanceWriter->writeCircle(chops[3]);
+                            instanceWriter->writeCircle(chops[6]);
                             // Two cusps are only possible if it's a flat line with two 180-degree
                             // turnarounds.
-                            instanceWriter.lineTo(chops[0], chops[3]);
-                            instanceWriter.lineTo(chops[3], chops[6]);
-                            instanceWriter.lineTo(chops[6], chops[9]);
+                            instanceWriter->lineTo(chops[0], chops[3]);
+                            instanceWriter->lineTo(chops[3], chops[6]);
+                            instanceWriter->lineTo(chops[6], chops[9]);
                         } else {
-                            instanceWriter.cubicConvex180To(chops);
-                            instanceWriter.cubicConvex180To(chops + 3);
-                            instanceWriter.cubicConvex180To(chops + 6);
+                            instanceWriter->cubicConvex180To(chops);
+                            instanceWriter->cubicConvex180To(chops + 3);
+                            instanceWriter->cubicConvex180To(chops + 6);
                         }
                     }
                     break;
@@ -378,41 +405,201 @@ void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
         }
     }
 
-    // The maximum rotation we can have in a stroke is 180 degrees (SK_ScalarPI radians).
-    int maxRadialSegmentsInStroke =
-            std::max(SkScalarCeilToInt(maxRadialSegmentsPerRadian * SK_ScalarPI), 1);
-
-    int maxParametricSegmentsInStroke = SkScalarCeilToInt(sqrtf(sqrtf(
-            instanceWriter.maxParametricSegments_pow4())));
-    SkASSERT(maxParametricSegmentsInStroke >= 1);  // maxParametricSegments_pow4 is always >= 1.
-
-    // Now calculate the maximum number of edges we will need in the stroke portion of the instance.
-    // The first and last edges in a stroke are shared by both the parametric and radial sets of
-    // edges, so the total number of edges is:
-    //
-    //   numCombinedEdges = numParametricEdges + numRadialEdges - 2
-    //
-    // It's also important to differentiate between the number of edges and segments in a strip:
-    //
-    //   numSegments = numEdges - 1
-    //
-    // So the total number of combined edges in the stroke is:
-    //
-    //   numEdgesInStroke = numParametricSegments + 1 + numRadialSegments + 1 - 2
-    //                    = numParametricSegments + numRadialSegments
-    //
-    int maxEdgesInStroke = maxRadialSegmentsInStroke + maxParametricSegmentsInStroke;
-
-    // Each triangle strip has two sections: It starts with a join then transitions to a stroke. The
-    // number of edges in an instance is the sum of edges from the join and stroke sections both.
-    // NOTE: The final join edge and the first stroke edge are co-located, however we still need to
-    // emit both because the join's edge is half-width and the stroke's is full-width.
-    int fixedEdgeCount = maxEdgesInJoin + maxEdgesInStroke;
-
-    // Don't draw more vertices than can be indexed by a signed short. We just have to draw the line
-    // somewhere and this seems reasonable enough. (There are two vertices per edge, so 2^14 edges
-    // make 2^15 vertices.)
-    fixedEdgeCount = std::min(fixedEdgeCount, (1 << 14) - 1);
+    *outMaxEdgesInJoin = maxEdgesInJoin;
+    *outMaxRadialSegmentsPerRadian = maxRadialSegmentsPerRadian;
+}
+
+// When a single static path/stroke pair is drawn, its instance data is cached in
+// GrThreadSafeCache and reused across flushes. The custom data on the cache entry records the
+// instance count and the fixed edge count computed when the instances were generated.
+struct CachedInstanceInfo {
+    int fNumInstances;
+    int fFixedEdgeCount;
+};
+
+static bool keep_incumbent(SkData*, SkData*) {
+    // Entries under the same key are generated from identical inputs, so the first one in wins.
+    return false;
+}
+
+static void create_instance_key(GrUniqueKey* key, const SkPath& path, const SkStrokeRec& stroke,
+                                int matrixMaxScaleLog2) {
+    static const GrUniqueKey::Domain kDomain = GrUniqueKey::GenerateDomain();
+
+    GrUniqueKey::Builder builder(key, kDomain, 5, "Fixed-Count Stroke Instances");
+    builder[0] = path.getGenerationID();
+    builder[1] = SkFloat2Bits(stroke.getWidth());
+    builder[2] = SkFloat2Bits(stroke.getMiter());
+    builder[3] = (stroke.getJoin() << 18) | (stroke.getCap() << 16) | stroke.getStyle();
+    builder[4] = static_cast<uint32_t>(matrixMaxScaleLog2);
+    builder.finish();
+}
+
+// When the SkPathRef genID changes, invalidate a corresponding GrResource described by key.
+class UniqueKeyInvalidator : public SkIDChangeListener {
+public:
+    UniqueKeyInvalidator(const GrUniqueKey& key, uint32_t contextUniqueID)
+            : fMsg(key, contextUniqueID, /* inThreadSafeCache */ true) {}
+
+private:
+    GrUniqueKeyInvalidatedMessage fMsg;
+
+    void changed() override { SkMessageBus<GrUniqueKeyInvalidatedMessage, uint32_t>::Post(fMsg); }
+};
+
+}  // namespace
+
+GrStrokeFixedCountTessellator::GrStrokeFixedCountTessellator(const GrShaderCaps& shaderCaps,
+                                                             ShaderFlags shaderFlags,
+                                                             const SkMatrix& viewMatrix,
+                                                             PathStrokeList* pathStrokeList,std::array<float,
+                                                             2> matrixMinMaxScales,
+                                                             const SkRect& strokeCullBounds)
+        : GrStrokeTessellator(shaderCaps, GrStrokeTessellationShader::Mode::kFixedCount,
+                              shaderFlags, kMaxParametricSegments_log2, viewMatrix,
+                              pathStrokeList, matrixMinMaxScales, strokeCullBounds) {
+}
+
+GR_DECLARE_STATIC_UNIQUE_KEY(gVertexIDFallbackBufferKey);
+
+void GrStrokeFixedCountTessellator::prepare(GrMeshDrawTarget* target,
+                                            int totalCombinedVerbCnt) {
+    const GrShaderCaps& shaderCaps = *target->caps().shaderCaps();
+    int maxEdgesInJoin = 0;
+    float maxRadialSegmentsPerRadian = 0;
+    float maxParametricSegments_pow4 = 1;
+    int cachedFixedEdgeCount = 0;
+
+    // Over-allocate enough patches for each stroke to chop once, and for 8 extra caps. Since we
+    // have to chop at inflections, points of 180 degree rotation, and anywhere a stroke requires
+    // too many parametric segments, many strokes will end up getting choppped.
+    int strokePreallocCount = totalCombinedVerbCnt * 2;
+    int capPreallocCount = 8;
+    int minInstancesPerChunk = strokePreallocCount + capPreallocCount;
+
+    // A single static path/stroke pair is a candidate for caching its instances across flushes:
+    // the instances are written in local path space, and the view matrix only affects them
+    // through its maximum scale factor (which decides chopping). We quantize that scale to the
+    // next power of two and tessellate at the quantized scale with culling disabled, so any draw
+    // whose scale is at or below that octave can reuse the cached instances under any
+    // translation. Hairline strokes are excluded because their geometry is built in device
+    // space.
+    GrUniqueKey key;
+    sk_sp<GrThreadSafeCache::VertexData> pendingCacheAdd;
+    const SkPath& path = fPathStrokeList->fPath;
+    if (!fPathStrokeList->fNext && !fShader.hasDynamicStroke() && !fShader.hasDynamicColor() &&
+        !fPathStrokeList->fStroke.isHairlineStyle() && !path.isVolatile()) {
+        int scaleLog2 = std::min(sk_float_nextlog2(fMatrixMinMaxScales[1]), 30);
+        create_instance_key(&key, path, fPathStrokeList->fStroke, scaleLog2);
+
+        auto threadSafeCache = target->threadSafeCache();
+        auto [cachedVerts, data] = threadSafeCache->findVertsWithData(key);
+        if (cachedVerts && data && data->size() == sizeof(CachedInstanceInfo)) {
+            const auto* info = static_cast<const CachedInstanceInfo*>(data->data());
+            if (!cachedVerts->gpuBuffer()) {
+                // Since we have a direct context and a ref on 'cachedVerts' we need not worry
+                // about any threading issues in this call.
+                if (sk_sp<GrGpuBuffer> buffer = target->resourceProvider()->createBuffer(
+                            cachedVerts->size(), GrGpuBufferType::kVertex, kStatic_GrAccessPattern,
+                            cachedVerts->vertices())) {
+                    cachedVerts->setGpuBuffer(std::move(buffer));
+                }
+            }
+            if (cachedVerts->gpuBuffer()) {
+                fInstanceChunks.push_back({cachedVerts->refGpuBuffer(), info->fNumInstances, 0});
+                cachedFixedEdgeCount = info->fFixedEdgeCount;
+            }
+        }
+        if (!cachedFixedEdgeCount) {
+            CpuInstanceBuffer cpuBuffer(fShader.instanceStride(), minInstancesPerChunk);
+            InstanceWriter<CpuInstanceBuffer> instanceWriter(fShader.flags(), &cpuBuffer,
+                                                             static_cast<float>(1 << scaleLog2),
+                                                             SkRectPriv::MakeLargest(),
+                                                             fShader.viewMatrix());
+            write_path_strokes(shaderCaps, fShader, fPathStrokeList, fMatrixMinMaxScales.data(),
+                               &instanceWriter, &maxEdgesInJoin, &maxRadialSegmentsPerRadian);
+            maxParametricSegments_pow4 = instanceWriter.maxParametricSegments_pow4();
+            if (int instanceCount = cpuBuffer.count()) {
+                auto vertexData = GrThreadSafeCache::MakeVertexData(cpuBuffer.detach(),
+                                                                    instanceCount,
+                                                                    fShader.instanceStride());
+                if (sk_sp<GrGpuBuffer> buffer = target->resourceProvider()->createBuffer(
+                            vertexData->size(), GrGpuBufferType::kVertex, kStatic_GrAccessPattern,
+                            vertexData->vertices())) {
+                    vertexData->setGpuBuffer(std::move(buffer));
+                    fInstanceChunks.push_back({vertexData->refGpuBuffer(), instanceCount, 0});
+                    // Added to the cache below, once the fixed edge count is known.
+                    pendingCacheAdd = std::move(vertexData);
+                }
+            }
+        }
+    } else {
+        GrVertexChunkBuilder chunkBuilder(target, &fInstanceChunks, fShader.instanceStride(),
+                                          minInstancesPerChunk);
+        InstanceWriter<GrVertexChunkBuilder> instanceWriter(fShader.flags(), &chunkBuilder,
+                                                            fMatrixMinMaxScales[1],
+                                                            fStrokeCullBounds,
+                                                            fShader.viewMatrix());
+        write_path_strokes(shaderCaps, fShader, fPathStrokeList, fMatrixMinMaxScales.data(),
+                           &instanceWriter, &maxEdgesInJoin, &maxRadialSegmentsPerRadian);
+        maxParametricSegments_pow4 = instanceWriter.maxParametricSegments_pow4();
+    }
+
+    int fixedEdgeCount;
+    if (cachedFixedEdgeCount) {
+        fixedEdgeCount = cachedFixedEdgeCount;
+    } else {
+        // The maximum rotation we can have in a stroke is 180 degrees (SK_ScalarPI radians).
+        int maxRadialSegmentsInStroke =
+                std::max(SkScalarCeilToInt(maxRadialSegmentsPerRadian * SK_ScalarPI), 1);
+
+        int maxParametricSegmentsInStroke = SkScalarCeilToInt(sqrtf(sqrtf(
+                maxParametricSegments_pow4)));
+        SkASSERT(maxParametricSegmentsInStroke >= 1);  // maxParametricSegments_pow4 is always >= 1.
+
+        // Now calculate the maximum number of edges we will need in the stroke portion of the
+        // instance. The first and last edges in a stroke are shared by both the parametric and
+        // radial sets of edges, so the total number of edges is:
+        //
+        //   numCombinedEdges = numParametricEdges + numRadialEdges - 2
+        //
+        // It's also important to differentiate between the number of edges and segments in a
+        // strip:
+        //
+        //   numSegments = numEdges - 1
+        //
+        // So the total number of combined edges in the stroke is:
+        //
+        //   numEdgesInStroke = numParametricSegments + 1 + numRadialSegments + 1 - 2
+        //                    = numParametricSegments + numRadialSegments
+        //
+        int maxEdgesInStroke = maxRadialSegmentsInStroke + maxParametricSegmentsInStroke;
+
+        // Each triangle strip has two sections: It starts with a join then transitions to a
+        // stroke. The number of edges in an instance is the sum of edges from the join and stroke
+        // sections both.
+        // NOTE: The final join edge and the first stroke edge are co-located, however we still
+        // need to emit both because the join's edge is half-width and the stroke's is full-width.
+        fixedEdgeCount = maxEdgesInJoin + maxEdgesInStroke;
+
+        // Don't draw more vertices than can be indexed by a signed short. We just have to draw
+        // the line somewhere and this seems reasonable enough. (There are two vertices per edge,
+        // so 2^14 edges make 2^15 vertices.)
+        fixedEdgeCount = std::min(fixedEdgeCount, (1 << 14) - 1);
+    }
+
+    if (pendingCacheAdd) {
+        CachedInstanceInfo info = {pendingCacheAdd->numVertices(), fixedEdgeCount};
+        key.setCustomData(SkData::MakeWithCopy(&info, sizeof(info)));
+        auto [tmpV, tmpD] = target->threadSafeCache()->addVertsWithData(key, pendingCacheAdd,
+                                                                        keep_incumbent);
+        if (tmpV == pendingCacheAdd) {
+            // The cache holds the CPU-side copy of the instances; drop it if the path's contents
+            // change out from under the genID in our key.
+            SkPathPriv::AddGenIDChangeListener(
+                    path, sk_make_sp<UniqueKeyInvalidator>(key, target->contextUniqueID()));
+        }
+    }
 
     if (!target->caps().shaderCaps()->vertexIDSupport()) {
         // Our shader won't be able to use sk_VertexID. Bind a fallback vertex buffer with the IDs
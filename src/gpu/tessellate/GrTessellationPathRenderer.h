@@ -55,6 +55,10 @@ public:
                                std::unique_ptr<GrFragmentProcessor> inputFP,
                                const SkIRect& drawBounds, const SkMatrix&, const SkPath&, GrAA);
 
+    // The tessellation atlas renders its coverage masks; schedule it after the upload-only
+    // atlases so its render tasks stay contiguous.
+    AtlasPhase atlasPhase() const override { return AtlasPhase::kRender; }
+
     void preFlush(GrOnFlushResourceProvider*, SkSpan<const uint32_t> taskIDs) override;
 
 private:
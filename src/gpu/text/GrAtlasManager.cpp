@@ -9,6 +9,7 @@
 
 #include "src/codec/SkMasks.h"
 #include "src/core/SkAutoMalloc.h"
+#include "src/core/SkTSort.h"
 #include "src/gpu/GrGlyph.h"
 #include "src/gpu/GrImageInfo.h"
 #include "src/gpu/text/GrStrikeCache.h"
@@ -186,6 +187,36 @@ GrDrawOpAtlas::ErrorCode GrAtlasManager::addGlyphToAtlas(const SkGlyph& skGlyph,
     return errorCode;
 }
 
+GrDrawOpAtlas::ErrorCode GrAtlasManager::addGlyphsToAtlas(SkSpan<GlyphAndImage> glyphs,
+                                                          GrMaskFormat maskFormat,
+                                                          int srcPadding,
+                                                          GrResourceProvider* resourceProvider,
+                                                          GrDeferredUploadTarget* uploadTarget,
+                                                          GrDrawOpAtlas::BulkUseTokenUpdater* updater,
+                                                          GrDeferredUploadToken token,
+                                                          bool bilerpPadding) {
+    // Taller glyphs first: the skyline packer opens a new shelf at the tallest pending height,
+    // so a descending pass wastes the least vertical space and keeps a run of glyphs in as few
+    // plots as possible. Everything placed in one plot before the next flush shares one upload.
+    SkTQSort(glyphs.begin(), glyphs.end(), [](const GlyphAndImage& a, const GlyphAndImage& b) {
+        return a.fSkGlyph->height() > b.fSkGlyph->height();
+    });
+
+    for (const GlyphAndImage& gi : glyphs) {
+        // The same glyph can appear more than once in a run; only add it the first time.
+        if (this->hasGlyph(maskFormat, gi.fGrGlyph)) {
+            continue;
+        }
+        auto code = this->addGlyphToAtlas(*gi.fSkGlyph, gi.fGrGlyph, srcPadding,
+                                          resourceProvider, uploadTarget, bilerpPadding);
+        if (code != GrDrawOpAtlas::ErrorCode::kSucceeded) {
+            return code;
+        }
+        this->addGlyphToBulkAndSetUseToken(updater, maskFormat, gi.fGrGlyph, token);
+    }
+    return GrDrawOpAtlas::ErrorCode::kSucceeded;
+}
+
 // add to texture atlas that matches this format
 GrDrawOpAtlas::ErrorCode GrAtlasManager::addToAtlas(GrResourceProvider* resourceProvider,
                                                     GrDeferredUploadTarget* target,
@@ -288,6 +319,16 @@ void GrAtlasManager::dump(GrDirectContext* context) const {
 }
 #endif
 
+void GrAtlasManager::setMaxTextureBytes(size_t maxTextureBytes) {
+    // Dropping the atlases bumps the atlas generation, so outstanding text blobs re-add their
+    // glyphs to the rebuilt atlases on their next flush instead of referencing stale pages.
+    for (int i = 0; i < kMaskFormatCount; i++) {
+        fAtlases[i] = nullptr;
+    }
+
+    new (&fAtlasConfig) GrDrawOpAtlasConfig{fCaps->maxTextureSize(), maxTextureBytes};
+}
+
 void GrAtlasManager::setAtlasDimensionsToMinimum_ForTesting() {
     // Delete any old atlases.
     // This should be safe to do as long as we are not in the middle of a flush.
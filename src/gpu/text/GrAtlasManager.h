@@ -8,6 +8,7 @@
 #ifndef GrAtlasManager_DEFINED
 #define GrAtlasManager_DEFINED
 
+#include "include/core/SkSpan.h"
 #include "src/gpu/GrCaps.h"
 #include "src/gpu/GrDrawOpAtlas.h"
 #include "src/gpu/GrOnFlushResourceProvider.h"
@@ -57,6 +58,28 @@ public:
                                              GrDeferredUploadTarget*,
                                              bool bilerpPadding = false);
 
+    // A glyph together with its mask image, as collected by a text op for bulk insertion.
+    struct GlyphAndImage {
+        const SkGlyph* fSkGlyph;
+        GrGlyph*       fGrGlyph;
+    };
+
+    // Adds a run of glyphs in one pass. The glyphs are sorted by height first so the skyline
+    // packer fills plot rows contiguously, and glyphs landing in the same plot coalesce into a
+    // single combined upload region rather than one scheduled upload per glyph. Each placed
+    // glyph's plot has its use token set through the updater right away so earlier glyphs in
+    // the batch cannot be evicted to make room for later ones. Stops at the first glyph that
+    // cannot be added and returns its error code; the caller can determine which glyphs made
+    // it in with hasGlyph(). Reorders the span in place.
+    GrDrawOpAtlas::ErrorCode addGlyphsToAtlas(SkSpan<GlyphAndImage>,
+                                              GrMaskFormat,
+                                              int srcPadding,
+                                              GrResourceProvider*,
+                                              GrDeferredUploadTarget*,
+                                              GrDrawOpAtlas::BulkUseTokenUpdater*,
+                                              GrDeferredUploadToken,
+                                              bool bilerpPadding = false);
+
     // To ensure the GrDrawOpAtlas does not evict the Glyph Mask from its texture backing store,
     // the client must pass in the current op token along with the GrGlyph.
     // A BulkUseTokenUpdater is used to manage bulk last use token updating in the Atlas.
@@ -85,6 +108,9 @@ public:
 
     // GrOnFlushCallbackObject overrides
 
+    // Glyph atlases only upload; schedule them ahead of rendered atlases.
+    AtlasPhase atlasPhase() const override { return AtlasPhase::kUpload; }
+
     void preFlush(GrOnFlushResourceProvider* onFlushRP, SkSpan<const uint32_t>) override {
         for (int i = 0; i < kMaskFormatCount; ++i) {
             if (fAtlases[i]) {
@@ -114,6 +140,11 @@ public:
     void setAtlasDimensionsToMinimum_ForTesting();
     void setMaxPages_TestingOnly(uint32_t maxPages);
 
+    // Re-derives the atlas configuration for a new texture byte budget on a live context. The
+    // existing atlases are dropped and repopulate lazily at the new dimensions as text draws.
+    // Must not be called during a flush.
+    void setMaxTextureBytes(size_t maxTextureBytes);
+
 private:
     bool initAtlas(GrMaskFormat);
     // Change an expected 565 mask format to 8888 if 565 is not supported (will happen when using
@@ -38,10 +38,12 @@ SkScalar GrSDFTControl::MinSDFTRange(bool useSDFTForSmallText, SkScalar min) {
 }
 
 GrSDFTControl::GrSDFTControl(
-        bool ableToUseSDFT, bool useSDFTForSmallText, SkScalar min, SkScalar max)
+        bool ableToUseSDFT, bool useSDFTForSmallText, SkScalar min, SkScalar max,
+        bool snapBlobsToPixel)
         : fMinDistanceFieldFontSize{MinSDFTRange(useSDFTForSmallText, min)}
         , fMaxDistanceFieldFontSize{max}
-        , fAbleToUseSDFT{ableToUseSDFT} {
+        , fAbleToUseSDFT{ableToUseSDFT}
+        , fSnapBlobsToPixel{snapBlobsToPixel} {
     SkASSERT_RELEASE(0 < min && min <= max);
 }
 
@@ -16,7 +16,8 @@ class SkSurfaceProps;
 
 class GrSDFTControl {
 public:
-    GrSDFTControl(bool ableToUseSDFT, bool useSDFTForSmallText, SkScalar min, SkScalar max);
+    GrSDFTControl(bool ableToUseSDFT, bool useSDFTForSmallText, SkScalar min, SkScalar max,
+                  bool snapBlobsToPixel = false);
 
     enum DrawingType : uint8_t {
         kDirect = 1,
@@ -32,6 +33,11 @@ public:
                       SkScalar* textRatio) const;
     std::pair<SkScalar, SkScalar> computeSDFMinMaxScale(
             SkScalar textSize, const SkMatrix& viewMatrix) const;
+
+    // True if cached blobs may be reused under pure translation with positions snapped to the
+    // nearest device pixel. See GrContextOptions::fSnapTextBlobsToPixel.
+    bool snapBlobsToPixel() const { return fSnapBlobsToPixel; }
+
 private:
     static SkScalar MinSDFTRange(bool useSDFTForSmallText, SkScalar min);
 
@@ -43,6 +49,7 @@ private:
     const SkScalar fMaxDistanceFieldFontSize;
 
     const bool fAbleToUseSDFT;
+    const bool fSnapBlobsToPixel;
 };
 
 #endif  // GrSDFTControl_DEFINED
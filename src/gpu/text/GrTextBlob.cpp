@@ -140,13 +140,17 @@ void fill_transformed_vertices_3D(SkZip<Quad, const GrGlyph*, const VertexData>
     }
 }
 
+bool is_same_2x2(const SkMatrix& initialMatrix, const SkMatrix& drawMatrix) {
+    return initialMatrix.getScaleX() == drawMatrix.getScaleX() &&
+           initialMatrix.getScaleY() == drawMatrix.getScaleY() &&
+           initialMatrix.getSkewX()  == drawMatrix.getSkewX()  &&
+           initialMatrix.getSkewY()  == drawMatrix.getSkewY();
+}
+
 // Check for integer translate with the same 2x2 matrix.
 std::tuple<bool, SkVector> check_integer_translate(
         const SkMatrix& initialMatrix, const SkMatrix& drawMatrix) {
-    if (initialMatrix.getScaleX() != drawMatrix.getScaleX() ||
-        initialMatrix.getScaleY() != drawMatrix.getScaleY() ||
-        initialMatrix.getSkewX()  != drawMatrix.getSkewX()  ||
-        initialMatrix.getSkewY()  != drawMatrix.getSkewY()) {
+    if (!is_same_2x2(initialMatrix, drawMatrix)) {
         return {false, {0, 0}};
     }
 
@@ -386,21 +390,35 @@ std::tuple<bool, int> GlyphVector::regenerateAtlas(int begin, int end,
         // Update the atlas information in the GrStrike.
         auto tokenTracker = uploadTarget->tokenTracker();
         auto glyphs = fGlyphs.subspan(begin, end - begin);
-        int glyphsPlacedInAtlas = 0;
-        bool success = true;
+
+        // Gather the glyphs missing from the atlas and insert them as one batch so a run's
+        // worth of masks is packed in a single pass and each plot schedules a single combined
+        // upload instead of one per glyph.
+        SkSTArray<64, GrAtlasManager::GlyphAndImage> missing;
         for (const Variant& variant : glyphs) {
             GrGlyph* grGlyph = variant.grGlyph;
             SkASSERT(grGlyph != nullptr);
+            if (!atlasManager->hasGlyph(maskFormat, grGlyph)) {
+                missing.push_back({metricsAndImages.glyph(grGlyph->fPackedID), grGlyph});
+            }
+        }
+
+        bool success = true;
+        if (!missing.empty()) {
+            auto code = atlasManager->addGlyphsToAtlas(
+                    SkMakeSpan(missing), maskFormat, srcPadding, target->resourceProvider(),
+                    uploadTarget, &fBulkUseToken, tokenTracker->nextDrawToken(), bilerpPadding);
+            success = code != GrDrawOpAtlas::ErrorCode::kError;
+        }
 
+        // Count the prefix of glyphs now resident in the atlas and set their use tokens.
+        // The batch may have placed glyphs past a failure; those stay resident and are
+        // picked up when the remainder of the run is regenerated.
+        int glyphsPlacedInAtlas = 0;
+        for (const Variant& variant : glyphs) {
+            GrGlyph* grGlyph = variant.grGlyph;
             if (!atlasManager->hasGlyph(maskFormat, grGlyph)) {
-                const SkGlyph& skGlyph = *metricsAndImages.glyph(grGlyph->fPackedID);
-                auto code = atlasManager->addGlyphToAtlas(
-                        skGlyph, grGlyph, srcPadding, target->resourceProvider(),
-                        uploadTarget, bilerpPadding);
-                if (code != GrDrawOpAtlas::ErrorCode::kSucceeded) {
-                    success = code != GrDrawOpAtlas::ErrorCode::kError;
-                    break;
-                }
+                break;
             }
             atlasManager->addGlyphToBulkAndSetUseToken(
                     &fBulkUseToken, maskFormat, grGlyph,
@@ -572,6 +590,12 @@ DirectMaskSubRun::canReuse(const SkPaint& paint, const SkMatrix& drawMatrix) con
         return translation.x() == 0 && translation.y() == 0;
     }
 
+    // When pixel snapping, any pure translation can be reused; the fractional part of the
+    // offset is rounded away when the vertices are filled.
+    if (!reuse && fBlob->snapToPixel()) {
+        reuse = is_same_2x2(fBlob->initialMatrix(), drawMatrix);
+    }
+
     return reuse;
 }
 
@@ -1418,7 +1442,7 @@ auto GrTextBlob::Key::Make(const SkGlyphRunList& glyphRunList,
             key.fSetOfDrawingTypes |= control.drawingType(run.font(), paint, drawMatrix);
         }
 
-        if (key.fSetOfDrawingTypes & GrSDFTControl::kDirect) {
+        if ((key.fSetOfDrawingTypes & GrSDFTControl::kDirect) && !control.snapBlobsToPixel()) {
             // Store the fractional offset of the position. We know that the matrix can't be
             // perspective at this point.
             SkPoint mappedOrigin = drawMatrix.mapOrigin();
@@ -1427,6 +1451,12 @@ auto GrTextBlob::Key::Make(const SkGlyphRunList& glyphRunList,
                     mappedOrigin.x() - SkScalarFloorToScalar(mappedOrigin.x()));
             key.fDrawMatrix.setTranslateY(
                     mappedOrigin.y() - SkScalarFloorToScalar(mappedOrigin.y()));
+        } else if (key.fSetOfDrawingTypes & GrSDFTControl::kDirect) {
+            // With pixel snapping the blob is reused under any pure translation, so only the
+            // 2x2 part of the matrix distinguishes keys.
+            key.fDrawMatrix = drawMatrix;
+            key.fDrawMatrix.setTranslateX(0);
+            key.fDrawMatrix.setTranslateY(0);
         } else {
             // For path and SDFT, the matrix doesn't matter.
             key.fDrawMatrix = SkMatrix::I();
@@ -1505,6 +1535,7 @@ sk_sp<GrTextBlob> GrTextBlob::Make(const SkGlyphRunList& glyphRunList,
     SkColor initialLuminance = SkPaintPriv::ComputeLuminanceColor(paint);
     sk_sp<GrTextBlob> blob{new (allocation)
                             GrTextBlob(bytesNeededForSubRun, drawMatrix, initialLuminance)};
+    blob->fSnapToPixel = control.snapBlobsToPixel();
 
     for (auto& glyphRun : glyphRunList) {
         painter->processGlyphRun(glyphRun,
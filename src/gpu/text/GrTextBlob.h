@@ -224,6 +224,10 @@ public:
     bool hasPerspective() const;
     const SkMatrix& initialMatrix() const { return fInitialMatrix; }
 
+    // True if this blob may be reused under any pure translation with glyph positions snapped
+    // to the nearest device pixel. See GrContextOptions::fSnapTextBlobsToPixel.
+    bool snapToPixel() const { return fSnapToPixel; }
+
     std::tuple<SkScalar, SkScalar> scaleBounds() const {
         return {fMaxMinScale, fMinMaxScale};
     }
@@ -285,6 +289,7 @@ private:
     SkScalar fMinMaxScale{SK_ScalarMax};
 
     bool fSomeGlyphsExcluded{false};
+    bool fSnapToPixel{false};
 };
 
 class GrSubRunNoCachePainter : public SkGlyphRunPainterInterface {
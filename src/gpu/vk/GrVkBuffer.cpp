@@ -44,7 +44,10 @@ static const GrVkDescriptorSet* make_uniform_desc_set(GrVkGpu* gpu, VkBuffer buf
     memset(&bufferInfo, 0, sizeof(VkDescriptorBufferInfo));
     bufferInfo.buffer = buffer;
     bufferInfo.offset = 0;
-    bufferInfo.range = size;
+    // A dynamic uniform descriptor's range is the size of one bind, not the whole buffer, and it
+    // may not exceed maxUniformBufferRange (the uniform ring buffer can be larger than that).
+    bufferInfo.range = std::min(size,
+            (size_t)gpu->physicalDeviceProperties().limits.maxUniformBufferRange);
 
     VkWriteDescriptorSet descriptorWrite;
     memset(&descriptorWrite, 0, sizeof(VkWriteDescriptorSet));
@@ -54,7 +57,7 @@ static const GrVkDescriptorSet* make_uniform_desc_set(GrVkGpu* gpu, VkBuffer buf
     descriptorWrite.dstBinding = GrVkUniformHandler::kUniformBinding;
     descriptorWrite.dstArrayElement = 0;
     descriptorWrite.descriptorCount = 1;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     descriptorWrite.pImageInfo = nullptr;
     descriptorWrite.pBufferInfo = &bufferInfo;
     descriptorWrite.pTexelBufferView = nullptr;
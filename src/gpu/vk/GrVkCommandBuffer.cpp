@@ -531,6 +531,12 @@ void GrVkPrimaryCommandBuffer::executeCommands(const GrVkGpu* gpu,
     this->invalidateState();
 }
 
+void GrVkPrimaryCommandBuffer::retireCommandBuffer(
+        std::unique_ptr<GrVkSecondaryCommandBuffer> buffer) {
+    SkASSERT(!buffer->fIsActive);
+    fSecondaryCommandBuffers.push_back(std::move(buffer));
+}
+
 static bool submit_to_queue(GrVkGpu* gpu,
                             VkQueue queue,
                             VkFence fence,
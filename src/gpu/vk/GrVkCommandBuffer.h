@@ -232,6 +232,12 @@ public:
     void executeCommands(const GrVkGpu* gpu,
                          std::unique_ptr<GrVkSecondaryCommandBuffer> secondaryBuffer);
 
+    // Takes ownership of a SecondaryCommandBuffer that was ended without being executed (e.g.
+    // nothing was recorded into it). Since the command pool was not created with the reset bit,
+    // the buffer cannot be reused until the pool itself is reset, so it is held alongside the
+    // executed secondaries and recycled with them when this command buffer finishes.
+    void retireCommandBuffer(std::unique_ptr<GrVkSecondaryCommandBuffer> secondaryBuffer);
+
     // Commands that only work outside of a render pass
     void clearColorImage(const GrVkGpu* gpu,
                          GrVkImage* image,
@@ -24,7 +24,7 @@ GrVkDescriptorSetManager* GrVkDescriptorSetManager::CreateUniformManager(GrVkGpu
     }
     visibilities.push_back(stages);
     SkTArray<const GrVkSampler*> samplers;
-    return Create(gpu, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, visibilities, samplers);
+    return Create(gpu, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, visibilities, samplers);
 }
 
 GrVkDescriptorSetManager* GrVkDescriptorSetManager::CreateSamplerManager(
@@ -120,13 +120,13 @@ static bool get_layout_and_desc_count(GrVkGpu* gpu,
         if (result != VK_SUCCESS) {
             return false;
         }
-    } else if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+    } else if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) {
         static constexpr int kUniformDescPerSet = 1;
         SkASSERT(kUniformDescPerSet == visibilities.count());
         // Create Uniform Buffer Descriptor
         VkDescriptorSetLayoutBinding dsUniBinding;
         dsUniBinding.binding = GrVkUniformHandler::kUniformBinding;
-        dsUniBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        dsUniBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         dsUniBinding.descriptorCount = 1;
         dsUniBinding.stageFlags = visibility_to_vk_stage_flags(visibilities[0]);
         dsUniBinding.pImmutableSamplers = nullptr;
@@ -217,6 +217,9 @@ GrVkGpu::GrVkGpu(GrDirectContext* direct, const GrVkBackendContext& backendConte
         , fQueueIndex(backendContext.fGraphicsQueueIndex)
         , fResourceProvider(this)
         , fStagingBufferManager(this)
+        // 256 is the largest minUniformBufferOffsetAlignment allowed by the spec, so suballocated
+        // uniform offsets are valid dynamic offsets on any device.
+        , fUniformsRingBuffer(this, 128 * 1024, 256, GrGpuBufferType::kUniform)
         , fDisconnected(false)
         , fProtectedContext(backendContext.fProtectedContext) {
     SkASSERT(!backendContext.fOwnsInstanceAndDevice);
@@ -358,6 +361,10 @@ GrOpsRenderPass* GrVkGpu::onGetOpsRenderPass(
    sk_sp<GrVkFramebuffer> framebuffer;
     if (vkRT->wrapsSecondaryCommandBuffer()) {
         framebuffer = vkRT->externalFramebuffer();
+        // Any setup work we record (uploads, layout transitions) must be on the queue before the
+        // client executes the wrapped secondary command buffer, so the next submit cannot be
+        // deferred.
+        fMustSubmitCommandBuffer = true;
     } else {
         auto fb = vkRT->getFramebuffer(withResolve, SkToBool(stencil), selfDepFlags,
                                        loadFromResolve);
@@ -375,6 +382,11 @@ GrOpsRenderPass* GrVkGpu::onGetOpsRenderPass(
     return fCachedOpsRenderPass.get();
 }
 
+// Cap on how many consecutive flushes may share one queue submission. This bounds how much work
+// can pile up in the open command buffer (and how long its resources go unreclaimed) for clients
+// that submit many times per frame without ever hitting a sync point.
+static constexpr int kMaxDeferredQueueSubmits = 16;
+
 bool GrVkGpu::submitCommandBuffer(SyncQueue sync) {
     TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     if (!this->currentCommandBuffer()) {
@@ -394,6 +406,19 @@ bool GrVkGpu::submitCommandBuffer(SyncQueue sync) {
         return true;
     }
 
+    if (kDeferrable_SyncQueue == sync && !fMustSubmitCommandBuffer &&
+        !fSemaphoresToSignal.count() && !fSemaphoresToWaitOn.count() &&
+        fDeferredSubmitCount < kMaxDeferredQueueSubmits) {
+        // Nothing can observe this submission's completion: there are no semaphores and no CPU
+        // sync was requested. Keep accumulating work into the open command buffer so that
+        // several flushes share one vkQueueSubmit and one fence. Anything that does need the
+        // work on the queue (semaphores, a forced sync, an inserted fence, a finish proc check,
+        // handing a surface to an external consumer) triggers the real submission.
+        ++fDeferredSubmitCount;
+        fResourceProvider.checkCommandBuffers();
+        return true;
+    }
+
     fMainCmdBuffer->end(this);
     SkASSERT(fMainCmdPool);
     fMainCmdPool->close();
@@ -426,6 +451,11 @@ bool GrVkGpu::submitCommandBuffer(SyncQueue sync) {
     }
     fSemaphoresToSignal.reset();
 
+    // Whether or not the submission went through, the old command buffer is done accumulating
+    // work.
+    fDeferredSubmitCount = 0;
+    fMustSubmitCommandBuffer = false;
+
     // Release old command pool and create a new one
     fMainCmdPool->unref();
     fMainCmdPool = fResourceProvider.findOrCreateCommandPool();
@@ -525,7 +555,7 @@ bool GrVkGpu::onWritePixels(GrSurface* surface,
                                              texels,
                                              mipLevelCount);
         if (1 == mipLevelCount) {
-            texture->markMipmapsDirty();
+            texture->markMipmapsDirty(rect);
         }
     }
 
@@ -609,7 +639,7 @@ bool GrVkGpu::onTransferPixelsTo(GrTexture* texture,
                                                     &region);
     this->currentCommandBuffer()->addGrBuffer(std::move(transferBuffer));
 
-    tex->markMipmapsDirty();
+    tex->markMipmapsDirty(rect);
     return true;
 }
 
@@ -1412,6 +1442,14 @@ bool GrVkGpu::onRegenerateMipMapLevels(GrTexture* tex) {
     VkImageBlit blitRegion;
     memset(&blitRegion, 0, sizeof(VkImageBlit));
 
+    // Only the base-level region that changed since the last regeneration needs to be pushed
+    // down the chain; outside of it every level still matches the base. The tracked rect is
+    // empty if the texture was marked dirty without bounds, in which case we do the full chain.
+    SkIRect levelDirty = tex->mipmapDirtyRect();
+    if (levelDirty.isEmpty() || !SkIRect::MakeWH(width, height).contains(levelDirty)) {
+        levelDirty = SkIRect::MakeWH(width, height);
+    }
+
     // SkMipmap doesn't include the base level in the level count so we have to add 1
     uint32_t levelCount = SkMipmap::ComputeLevelCount(tex->width(), tex->height()) + 1;
     SkASSERT(levelCount == vkTex->mipLevels());
@@ -1447,12 +1485,26 @@ bool GrVkGpu::onRegenerateMipMapLevels(GrTexture* tex) {
         this->addImageMemoryBarrier(vkTex->resource(), VK_PIPELINE_STAGE_TRANSFER_BIT,
                                     VK_PIPELINE_STAGE_TRANSFER_BIT, false, &imageMemoryBarrier);
 
+        // The dirty region shrinks along with the level. The source region is the dst scaled
+        // back up so interior blits stay an exact 2:1 reduction; at the texture's edge we use
+        // the previous level's full extent, matching the full-chain behavior for odd sizes.
+        SkIRect dstDirty = SkIRect::MakeLTRB(levelDirty.left() / 2,
+                                             levelDirty.top() / 2,
+                                             std::min(width, (levelDirty.right() + 1) / 2),
+                                             std::min(height, (levelDirty.bottom() + 1) / 2));
+        SkIRect srcDirty = SkIRect::MakeLTRB(
+                dstDirty.left() * 2,
+                dstDirty.top() * 2,
+                dstDirty.right() == width ? prevWidth : dstDirty.right() * 2,
+                dstDirty.bottom() == height ? prevHeight : dstDirty.bottom() * 2);
+
         blitRegion.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, mipLevel - 1, 0, 1 };
-        blitRegion.srcOffsets[0] = { 0, 0, 0 };
-        blitRegion.srcOffsets[1] = { prevWidth, prevHeight, 1 };
+        blitRegion.srcOffsets[0] = { srcDirty.left(), srcDirty.top(), 0 };
+        blitRegion.srcOffsets[1] = { srcDirty.right(), srcDirty.bottom(), 1 };
         blitRegion.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, 0, 1 };
-        blitRegion.dstOffsets[0] = { 0, 0, 0 };
-        blitRegion.dstOffsets[1] = { width, height, 1 };
+        blitRegion.dstOffsets[0] = { dstDirty.left(), dstDirty.top(), 0 };
+        blitRegion.dstOffsets[1] = { dstDirty.right(), dstDirty.bottom(), 1 };
+        levelDirty = dstDirty;
         this->currentCommandBuffer()->blitImage(this,
                                                 vkTex->resource(),
                                                 vkTex->image(),
@@ -1816,6 +1868,9 @@ bool GrVkGpu::setBackendSurfaceState(GrVkImageInfo info,
                                       texture->currentQueueFamilyIndex());
     }
     set_layout_and_queue_from_mutable_state(this, texture.get(), newInfo);
+    // The transition is for an external consumer of the surface, so the next submit must
+    // actually reach the queue.
+    fMustSubmitCommandBuffer = true;
     if (finishedCallback) {
         this->addFinishedCallback(std::move(finishedCallback));
     }
@@ -2075,6 +2130,9 @@ void GrVkGpu::prepareSurfacesForBackendAccessAndStateUpdates(
                 image->prepareForPresent(this);
             }
         }
+        // These transitions hand the surfaces to the presentation engine or an external queue,
+        // so the submit that follows cannot be deferred.
+        fMustSubmitCommandBuffer = true;
     }
 }
 
@@ -2097,11 +2155,24 @@ bool GrVkGpu::onSubmitToGpu(bool syncCpu) {
     if (syncCpu) {
         return this->submitCommandBuffer(kForce_SyncQueue);
     } else {
-        return this->submitCommandBuffer(kSkip_SyncQueue);
+        return this->submitCommandBuffer(kDeferrable_SyncQueue);
     }
 }
 
+void GrVkGpu::checkFinishProcs() {
+    // The client is polling for completed work. Any deferred queue submission must land now or
+    // its fence (and thus its finished procs) can never signal.
+    if (fDeferredSubmitCount) {
+        this->submitCommandBuffer(kSkip_SyncQueue);
+    }
+    fResourceProvider.checkCommandBuffers();
+}
+
 void GrVkGpu::finishOutstandingGpuWork() {
+    // Waiting on the queue won't cover work whose submission was deferred; submit it first.
+    if (fDeferredSubmitCount && this->currentCommandBuffer()) {
+        this->submitCommandBuffer(kSkip_SyncQueue);
+    }
     VK_CALL(QueueWaitIdle(fQueue));
 
     if (this->vkCaps().mustSyncCommandBuffersWithQueue()) {
@@ -2510,6 +2581,13 @@ void GrVkGpu::submitSecondaryCommandBuffer(std::unique_ptr<GrVkSecondaryCommandB
     this->currentCommandBuffer()->executeCommands(this, std::move(buffer));
 }
 
+void GrVkGpu::retireSecondaryCommandBuffer(std::unique_ptr<GrVkSecondaryCommandBuffer> buffer) {
+    if (!this->currentCommandBuffer()) {
+        return;
+    }
+    this->currentCommandBuffer()->retireCommandBuffer(std::move(buffer));
+}
+
 void GrVkGpu::submit(GrOpsRenderPass* renderPass) {
     SkASSERT(fCachedOpsRenderPass.get() == renderPass);
 
@@ -2518,6 +2596,12 @@ void GrVkGpu::submit(GrOpsRenderPass* renderPass) {
 }
 
 GrFence SK_WARN_UNUSED_RESULT GrVkGpu::insertFence() {
+    // The fence signals when all work currently on the queue completes, so any deferred queue
+    // submission must be made visible to the queue first.
+    if (fDeferredSubmitCount) {
+        this->submitCommandBuffer(kSkip_SyncQueue);
+    }
+
     VkFenceCreateInfo createInfo;
     memset(&createInfo, 0, sizeof(VkFenceCreateInfo));
     createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -11,6 +11,7 @@
 #include "include/gpu/vk/GrVkBackendContext.h"
 #include "include/gpu/vk/GrVkTypes.h"
 #include "src/gpu/GrGpu.h"
+#include "src/gpu/GrRingBuffer.h"
 #include "src/gpu/GrStagingBufferManager.h"
 #include "src/gpu/vk/GrVkCaps.h"
 #include "src/gpu/vk/GrVkMSAALoadManager.h"
@@ -55,6 +56,7 @@ public:
     const GrVkCaps& vkCaps() const { return *fVkCaps; }
 
     GrStagingBufferManager* stagingBufferManager() override { return &fStagingBufferManager; }
+    GrRingBuffer* uniformsRingBuffer() override { return &fUniformsRingBuffer; }
     void takeOwnershipOfBuffer(sk_sp<GrGpuBuffer>) override;
 
     bool isDeviceLost() const override { return fDeviceIsLost; }
@@ -147,6 +149,11 @@ public:
 
     void submitSecondaryCommandBuffer(std::unique_ptr<GrVkSecondaryCommandBuffer>);
 
+    // Used for a secondary command buffer that ended up with no commands recorded into it. The
+    // buffer is not executed, but must still be kept alive until the current command buffer
+    // finishes so that it can be returned to the command pool with the executed secondaries.
+    void retireSecondaryCommandBuffer(std::unique_ptr<GrVkSecondaryCommandBuffer>);
+
     void submit(GrOpsRenderPass*) override;
 
     GrFence SK_WARN_UNUSED_RESULT insertFence() override;
@@ -168,7 +175,7 @@ public:
     // command buffer to the gpu.
     void addDrawable(std::unique_ptr<SkDrawable::GpuDrawHandler> drawable);
 
-    void checkFinishProcs() override { fResourceProvider.checkCommandBuffers(); }
+    void checkFinishProcs() override;
     void finishOutstandingGpuWork() override;
 
     std::unique_ptr<GrSemaphore> prepareTextureForCrossContextUsage(GrTexture*) override;
@@ -200,8 +207,15 @@ public:
 
 private:
     enum SyncQueue {
+        // Submit to the queue and wait on the CPU until all submitted work has finished.
         kForce_SyncQueue,
-        kSkip_SyncQueue
+        // Submit to the queue without waiting.
+        kSkip_SyncQueue,
+        // The queue submission itself may be deferred: as long as there are no semaphores to
+        // wait on or signal and nothing external can observe the submission, the current
+        // command buffer is left open so that several flushes share a single vkQueueSubmit
+        // (and a single fence).
+        kDeferrable_SyncQueue
     };
 
     GrVkGpu(GrDirectContext*, const GrVkBackendContext&, const sk_sp<GrVkCaps> caps,
@@ -332,7 +346,9 @@ private:
     // work in the queue to finish before returning. If this GrVkGpu object has any semaphores in
     // fSemaphoreToSignal, we will add those signal semaphores to the submission of this command
     // buffer. If this GrVkGpu object has any semaphores in fSemaphoresToWaitOn, we will add those
-    // wait semaphores to the submission of this command buffer.
+    // wait semaphores to the submission of this command buffer. If sync is
+    // kDeferrable_SyncQueue and nothing can observe the submission, the command buffer is left
+    // open instead so that later flushes can share its eventual queue submission.
     bool submitCommandBuffer(SyncQueue sync);
 
     void copySurfaceAsCopyImage(GrSurface* dst, GrSurface* src, GrVkImage* dstImage,
@@ -384,6 +400,7 @@ private:
     // Created by GrVkGpu
     GrVkResourceProvider                                  fResourceProvider;
     GrStagingBufferManager                                fStagingBufferManager;
+    GrRingBuffer                                          fUniformsRingBuffer;
 
     GrVkMSAALoadManager                                   fMSAALoadManager;
 
@@ -391,6 +408,16 @@ private:
     // just a raw pointer; object's lifespan is managed by fCmdPool
     GrVkPrimaryCommandBuffer*                             fMainCmdBuffer;
 
+    // Number of consecutive kDeferrable_SyncQueue submits that have been deferred. While this is
+    // non-zero, fMainCmdBuffer still holds work from earlier flushes that has not been handed to
+    // the queue yet.
+    int                                                   fDeferredSubmitCount = 0;
+    // Set when the current command buffer records work that something outside this GrVkGpu will
+    // synchronize with on its own (e.g. setup for a wrapped secondary command buffer, or layout
+    // transitions handing a surface to an external queue or the presentation engine). Such work
+    // must reach the queue at the next submit and cannot be deferred.
+    bool                                                  fMustSubmitCommandBuffer = false;
+
     SkSTArray<1, GrVkSemaphore::Resource*>                fSemaphoresToWaitOn;
     SkSTArray<1, GrVkSemaphore::Resource*>                fSemaphoresToSignal;
 
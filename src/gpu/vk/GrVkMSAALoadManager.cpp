@@ -195,10 +195,13 @@ bool GrVkMSAALoadManager::loadMSAAFromResolve(GrVkGpu* gpu,
     }
     GrVkBuffer* vkUniformBuffer = static_cast<GrVkBuffer*>(uniformBuffer.get());
     static_assert(GrVkUniformHandler::kUniformBufferDescSet < GrVkUniformHandler::kInputDescSet);
+    // The uniform descriptor set layout uses dynamic buffers, so we must supply an offset even
+    // though this buffer only holds one copy of the uniforms.
+    uint32_t dynamicOffset = 0;
     commandBuffer->bindDescriptorSets(gpu, fPipelineLayout,
                                       GrVkUniformHandler::kUniformBufferDescSet,
                                       /*setCount=*/1, vkUniformBuffer->uniformDescriptorSet(),
-                                      /*dynamicOffsetCount=*/0, /*dynamicOffsets=*/nullptr);
+                                      /*dynamicOffsetCount=*/1, &dynamicOffset);
     commandBuffer->addGrBuffer(std::move(uniformBuffer));
 
     // Update the input descriptor set
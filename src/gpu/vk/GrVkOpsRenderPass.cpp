@@ -327,7 +327,15 @@ void GrVkOpsRenderPass::submit() {
     }
 
     if (fCurrentSecondaryCommandBuffer) {
-        fGpu->submitSecondaryCommandBuffer(std::move(fCurrentSecondaryCommandBuffer));
+        if (fCurrentCBIsEmpty) {
+            // The render pass only performed its load ops (e.g. a clear); executing an empty
+            // secondary command buffer would just invalidate all of the primary's bound state
+            // for the passes that follow. Retire the buffer unexecuted instead; it rejoins the
+            // command pool's free list once the primary finishes.
+            fGpu->retireSecondaryCommandBuffer(std::move(fCurrentSecondaryCommandBuffer));
+        } else {
+            fGpu->submitSecondaryCommandBuffer(std::move(fCurrentSecondaryCommandBuffer));
+        }
     }
     fGpu->endRenderPass(fRenderTarget, fOrigin, fBounds);
 }
@@ -90,20 +90,7 @@ bool GrVkPipelineState::setAndBindUniforms(GrVkGpu* gpu,
     fXferProcessor->setData(fDataManager, programInfo.pipeline().getXferProcessor());
 
     // Upload uniform data and bind descriptor set.
-    auto [uniformBuffer, success] = fDataManager.uploadUniforms(gpu, fPipeline->layout(),
-                                                                commandBuffer);
-    if (!success) {
-        return false;
-    }
-    if (uniformBuffer) {
-        const GrVkBuffer* vkBuffer = static_cast<GrVkBuffer*>(uniformBuffer.get());
-        static const int kUniformDSIdx = GrVkUniformHandler::kUniformBufferDescSet;
-        commandBuffer->bindDescriptorSets(gpu, fPipeline->layout(), kUniformDSIdx, /*setCount=*/1,
-                                          vkBuffer->uniformDescriptorSet(),
-                                          /*dynamicOffsetCount=*/0, /*dynamicOffsets=*/nullptr);
-        commandBuffer->addGrBuffer(std::move(uniformBuffer));
-    }
-    return true;
+    return fDataManager.uploadAndBindUniforms(gpu, fPipeline->layout(), commandBuffer);
 }
 
 bool GrVkPipelineState::setAndBindTextures(GrVkGpu* gpu,
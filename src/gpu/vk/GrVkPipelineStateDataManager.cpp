@@ -7,11 +7,11 @@
 
 #include "src/gpu/vk/GrVkPipelineStateDataManager.h"
 
-#include "include/gpu/GrDirectContext.h"
-#include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/GrGpuBuffer.h"
-#include "src/gpu/GrResourceProvider.h"
+#include "src/gpu/GrRingBuffer.h"
+#include "src/gpu/vk/GrVkBuffer.h"
 #include "src/gpu/vk/GrVkCommandBuffer.h"
+#include "src/gpu/vk/GrVkDescriptorSet.h"
 #include "src/gpu/vk/GrVkGpu.h"
 
 GrVkPipelineStateDataManager::GrVkPipelineStateDataManager(const UniformInfoArray& uniforms,
@@ -38,29 +38,69 @@ GrVkPipelineStateDataManager::GrVkPipelineStateDataManager(const UniformInfoArra
     }
 }
 
-std::pair<sk_sp<GrGpuBuffer>, bool> GrVkPipelineStateDataManager::uploadUniforms(
-        GrVkGpu* gpu, VkPipelineLayout layout, GrVkCommandBuffer* commandBuffer) {
+bool GrVkPipelineStateDataManager::uploadAndBindUniforms(GrVkGpu* gpu, VkPipelineLayout layout,
+                                                         GrVkCommandBuffer* commandBuffer) {
     if (fUniformSize == 0) {
-        return std::make_pair(nullptr, true);
+        return true;
     }
     if (fUsePushConstants) {
         commandBuffer->pushConstants(gpu, layout, gpu->vkCaps().getPushConstantStageFlags(),
                                      0, fUniformSize, fUniformData.get());
-        fUniformBuffer = nullptr;
-    } else {
-        if (fUniformsDirty) {
-            GrResourceProvider* resourceProvider = gpu->getContext()->priv().resourceProvider();
-            fUniformBuffer = resourceProvider->createBuffer(
-                    fUniformSize, GrGpuBufferType::kUniform, kDynamic_GrAccessPattern,
-                    fUniformData.get());
-            if (!fUniformBuffer) {
-                return std::make_pair(nullptr, false);
-            }
-            fUniformsDirty = false;
+        return true;
+    }
+
+    // Once a suballocation's submit finishes the ring buffer is free to hand its space out again,
+    // so we cannot reuse a slice from a previous draw and instead copy the data each time.
+    GrRingBuffer::Slice slice = gpu->uniformsRingBuffer()->suballocate(fUniformSize);
+    char* mapPtr = static_cast<char*>(slice.fBuffer->map());
+    if (!mapPtr) {
+        return false;
+    }
+    memcpy(mapPtr + slice.fOffset, fUniformData.get(), fUniformSize);
+    slice.fBuffer->unmap();
+    fUniformsDirty = false;
+
+    if (slice.fBuffer != fUniformBuffer.get()) {
+        // The ring buffer has moved to a new GrGpuBuffer. The old descriptor set may still be in
+        // flight, so rather than rewrite it we hand it off to be recycled and point a fresh set at
+        // the new buffer.
+        if (fUniformDescriptorSet) {
+            fUniformDescriptorSet->recycle();
         }
+        fUniformDescriptorSet = gpu->resourceProvider().getUniformDescriptorSet();
+        if (!fUniformDescriptorSet) {
+            fUniformBuffer.reset();
+            return false;
+        }
+        fUniformBuffer = sk_ref_sp(slice.fBuffer);
+
+        VkDescriptorBufferInfo bufferInfo;
+        memset(&bufferInfo, 0, sizeof(VkDescriptorBufferInfo));
+        bufferInfo.buffer = static_cast<GrVkBuffer*>(slice.fBuffer)->vkBuffer();
+        bufferInfo.offset = 0;
+        bufferInfo.range = fUniformSize;
+
+        VkWriteDescriptorSet descriptorWrite;
+        memset(&descriptorWrite, 0, sizeof(VkWriteDescriptorSet));
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = *fUniformDescriptorSet->descriptorSet();
+        descriptorWrite.dstBinding = GrVkUniformHandler::kUniformBinding;
+        descriptorWrite.dstArrayElement = 0;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        descriptorWrite.pBufferInfo = &bufferInfo;
+
+        GR_VK_CALL(gpu->vkInterface(),
+                   UpdateDescriptorSets(gpu->device(), 1, &descriptorWrite, 0, nullptr));
     }
 
-    return std::make_pair(fUniformBuffer, true);
+    uint32_t dynamicOffset = SkToU32(slice.fOffset);
+    commandBuffer->bindDescriptorSets(gpu, layout, GrVkUniformHandler::kUniformBufferDescSet,
+                                      /*setCount=*/1, fUniformDescriptorSet->descriptorSet(),
+                                      /*dynamicOffsetCount=*/1, &dynamicOffset);
+    commandBuffer->addRecycledResource(fUniformDescriptorSet);
+    commandBuffer->addGrBuffer(sk_ref_sp(slice.fBuffer));
+    return true;
 }
 
 void GrVkPipelineStateDataManager::set1iv(UniformHandle u,
@@ -157,4 +197,10 @@ void GrVkPipelineStateDataManager::setMatrix2fv(UniformHandle u,
     }
 }
 
-void GrVkPipelineStateDataManager::releaseData() { fUniformBuffer.reset(); }
+void GrVkPipelineStateDataManager::releaseData() {
+    fUniformBuffer.reset();
+    if (fUniformDescriptorSet) {
+        fUniformDescriptorSet->recycle();
+        fUniformDescriptorSet = nullptr;
+    }
+}
@@ -15,6 +15,7 @@
 
 class GrGpuBuffer;
 class GrVkCommandBuffer;
+class GrVkDescriptorSet;
 class GrVkGpu;
 
 class GrVkPipelineStateDataManager : public GrUniformDataManager {
@@ -24,11 +25,12 @@ public:
     GrVkPipelineStateDataManager(const UniformInfoArray&, uint32_t uniformSize,
                                  bool usePushConstants);
 
-    // Returns the uniform buffer that holds all the uniform data. If there are no uniforms it
-    // returns nullptr. If there was an error in creating or uploading the uniforms the value of the
-    // returned bool will be false and the buffer will be nullptr. Otherwise the bool will be true.
-    std::pair<sk_sp<GrGpuBuffer>, bool> uploadUniforms(GrVkGpu* gpu, VkPipelineLayout,
-                                                       GrVkCommandBuffer* commandBuffer);
+    // Uploads the uniform data, either as push constants or as a suballocation of the gpu's
+    // uniform ring buffer, and binds it to the command buffer. In the ring buffer case the
+    // descriptor set is cached here and rebinding a draw only changes the dynamic offset.
+    // Returns false if the upload or descriptor set update failed.
+    bool uploadAndBindUniforms(GrVkGpu* gpu, VkPipelineLayout,
+                               GrVkCommandBuffer* commandBuffer);
 
     void releaseData();
 
@@ -40,7 +42,10 @@ public:
     void setMatrix2fv(UniformHandle, int arrayCount, const float matrices[]) const override;
 
 private:
+    // The ring buffer allocation our descriptor set was last written against, and the set itself.
+    // The set only needs to be rewritten when the ring buffer moves to a new GrGpuBuffer.
     sk_sp<GrGpuBuffer> fUniformBuffer;
+    const GrVkDescriptorSet* fUniformDescriptorSet = nullptr;
     bool fUsePushConstants;
 
     using INHERITED = GrUniformDataManager;
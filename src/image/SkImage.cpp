@@ -87,6 +87,30 @@ void SkImage::asyncRescaleAndReadPixels(const SkImageInfo& info,
             info, srcRect, rescaleGamma, rescaleMode, callback, context);
 }
 
+void SkImage::asyncRescaleAndReadPixelsTiled(const SkImageInfo& info,
+                                             const SkIRect& srcRect,
+                                             int tileRows,
+                                             RescaleGamma rescaleGamma,
+                                             RescaleMode rescaleMode,
+                                             ReadPixelsTileCallback callback,
+                                             ReadPixelsContext context) {
+    if (!SkIRect::MakeWH(this->width(), this->height()).contains(srcRect) ||
+        !SkImageInfoIsValid(info)) {
+        callback(context, SkIRect::MakeEmpty(), nullptr);
+        return;
+    }
+    SkIssueTiledReadPixels(info, srcRect, tileRows, rescaleGamma, rescaleMode, callback, context,
+                           [this](const SkImageInfo& tileInfo,
+                                  const SkIRect& tileSrc,
+                                  RescaleGamma gamma,
+                                  RescaleMode mode,
+                                  ReadPixelsCallback* cb,
+                                  ReadPixelsContext ctx) {
+                               as_IB(this)->onAsyncRescaleAndReadPixels(tileInfo, tileSrc, gamma,
+                                                                        mode, cb, ctx);
+                           });
+}
+
 void SkImage::asyncRescaleAndReadPixelsYUV420(SkYUVColorSpace yuvColorSpace,
                                               sk_sp<SkColorSpace> dstColorSpace,
                                               const SkIRect& srcRect,
@@ -179,6 +203,19 @@ sk_sp<SkImage> SkImage::MakeFromEncoded(sk_sp<SkData> encoded) {
     return SkImage::MakeFromGenerator(SkImageGenerator::MakeFromEncoded(std::move(encoded)));
 }
 
+static SkImage::CompressedDataTranscoder gCompressedDataTranscoder;
+
+SkImage::CompressedDataTranscoder SkImage::SetCompressedDataTranscoder(
+        CompressedDataTranscoder transcoder) {
+    CompressedDataTranscoder prev = gCompressedDataTranscoder;
+    gCompressedDataTranscoder = transcoder;
+    return prev;
+}
+
+SkImage::CompressedDataTranscoder SkGetCompressedDataTranscoder() {
+    return gCompressedDataTranscoder;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 sk_sp<SkImage> SkImage::makeSubset(const SkIRect& subset, GrDirectContext* direct) const {
@@ -234,6 +271,14 @@ void SkImage::flushAndSubmit(GrDirectContext* dContext) {
     dContext->submit();
 }
 
+bool SkImage::notifyTextureContentsChanged(GrDirectContext* dContext,
+                                           int numWaitSemaphores,
+                                           const GrBackendSemaphore* waitSemaphores) {
+    return as_IB(this)->onNotifyTextureContentsChanged(dContext,
+                                                       numWaitSemaphores,
+                                                       waitSemaphores);
+}
+
 #else
 
 bool SkImage::isTextureBacked() const { return false; }
@@ -256,6 +301,10 @@ GrSemaphoresSubmitted SkImage::flush(GrDirectContext*, const GrFlushInfo&) {
 
 void SkImage::flushAndSubmit(GrDirectContext*) {}
 
+bool SkImage::notifyTextureContentsChanged(GrDirectContext*, int, const GrBackendSemaphore*) {
+    return false;
+}
+
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -414,6 +463,20 @@ std::unique_ptr<GrFragmentProcessor> SkImage_Base::MakeFragmentProcessorFromView
     }
 }
 
+static GrUniqueKey make_cached_mipmapped_view_key(uint32_t imageUniqueID, SkISize dimensions) {
+    GrUniqueKey baseKey;
+    GrMakeKeyFromImageID(&baseKey, imageUniqueID, SkIRect::MakeSize(dimensions));
+    SkASSERT(baseKey.isValid());
+    GrUniqueKey mipmappedKey;
+    static const GrUniqueKey::Domain kMipmappedDomain = GrUniqueKey::GenerateDomain();
+    {  // No extra values beyond the domain are required. Must name the var to please
+       // clang-tidy.
+        GrUniqueKey::Builder b(&mipmappedKey, baseKey, kMipmappedDomain, 0);
+    }
+    SkASSERT(mipmappedKey.isValid());
+    return mipmappedKey;
+}
+
 GrSurfaceProxyView SkImage_Base::FindOrMakeCachedMipmappedView(GrRecordingContext* rContext,
                                                                GrSurfaceProxyView view,
                                                                uint32_t imageUniqueID) {
@@ -425,16 +488,7 @@ GrSurfaceProxyView SkImage_Base::FindOrMakeCachedMipmappedView(GrRecordingContex
     }
     GrProxyProvider* proxyProvider = rContext->priv().proxyProvider();
 
-    GrUniqueKey baseKey;
-    GrMakeKeyFromImageID(&baseKey, imageUniqueID, SkIRect::MakeSize(view.dimensions()));
-    SkASSERT(baseKey.isValid());
-    GrUniqueKey mipmappedKey;
-    static const GrUniqueKey::Domain kMipmappedDomain = GrUniqueKey::GenerateDomain();
-    {  // No extra values beyond the domain are required. Must name the var to please
-       // clang-tidy.
-        GrUniqueKey::Builder b(&mipmappedKey, baseKey, kMipmappedDomain, 0);
-    }
-    SkASSERT(mipmappedKey.isValid());
+    GrUniqueKey mipmappedKey = make_cached_mipmapped_view_key(imageUniqueID, view.dimensions());
     if (sk_sp<GrTextureProxy> cachedMippedView =
                 proxyProvider->findOrCreateProxyByUniqueKey(mipmappedKey)) {
         return {std::move(cachedMippedView), view.origin(), view.swizzle()};
@@ -449,6 +503,18 @@ GrSurfaceProxyView SkImage_Base::FindOrMakeCachedMipmappedView(GrRecordingContex
     return copy;
 }
 
+void SkImage_Base::invalidateDerivedCaches(GrRecordingContext* rContext) const {
+    // Drop any raster copies keyed on our unique ID.
+    if (fAddedToRasterCache.exchange(false)) {
+        SkNotifyBitmapGenIDIsStale(this->uniqueID());
+    }
+    // Drop the cached mipmapped view; it was built from the previous contents.
+    GrUniqueKey mipmappedKey = make_cached_mipmapped_view_key(this->uniqueID(),
+                                                              this->dimensions());
+    rContext->priv().proxyProvider()->processInvalidUniqueKey(
+            mipmappedKey, nullptr, GrProxyProvider::InvalidateGPUResource::kYes);
+}
+
 #endif
 
 GrBackendTexture SkImage_Base::onGetBackendTexture(bool flushPendingGrContextIO,
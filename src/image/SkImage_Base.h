@@ -117,6 +117,15 @@ public:
     // If this image is the current cached image snapshot of a surface then this is called when the
     // surface is destroyed to indicate no further writes may happen to surface backing store.
     virtual void generatingSurfaceIsDeleted() {}
+
+    // Called when the contents of this image's backing texture were changed externally (e.g. a
+    // video decoder wrote a new frame). The default applies to images that don't wrap a
+    // client-owned texture.
+    virtual bool onNotifyTextureContentsChanged(GrDirectContext*,
+                                                int numWaitSemaphores,
+                                                const GrBackendSemaphore* waitSemaphores) {
+        return false;
+    }
 #endif
 
     virtual bool onPinAsTexture(GrRecordingContext*) const { return false; }
@@ -193,6 +202,13 @@ protected:
     static GrSurfaceProxyView FindOrMakeCachedMipmappedView(GrRecordingContext*,
                                                             GrSurfaceProxyView,
                                                             uint32_t imageUniqueID);
+
+    /**
+     * Discards cached copies derived from the image's current contents: raster-cache entries
+     * and the cached mipmapped view made by FindOrMakeCachedMipmappedView(). Called when the
+     * backing texture's contents are about to be replaced.
+     */
+    void invalidateDerivedCaches(GrRecordingContext*) const;
 #endif
 
 private:
@@ -228,6 +244,9 @@ static inline const SkImage_Base* as_IB(const SkImage* image) {
     return static_cast<const SkImage_Base*>(image);
 }
 
+// Returns the transcoder registered with SkImage::SetCompressedDataTranscoder, or nullptr.
+SkImage::CompressedDataTranscoder SkGetCompressedDataTranscoder();
+
 #if SK_SUPPORT_GPU
 inline GrSurfaceProxyView SkImage_Base::CopyView(GrRecordingContext* context,
                                                  GrSurfaceProxyView src,
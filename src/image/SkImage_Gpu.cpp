@@ -15,6 +15,7 @@
 #include "include/private/SkImageInfoPriv.h"
 #include "src/core/SkAutoPixmapStorage.h"
 #include "src/core/SkBitmapCache.h"
+#include "src/core/SkCompressedDataUtils.h"
 #include "src/core/SkMipmap.h"
 #include "src/core/SkScopeExit.h"
 #include "src/core/SkTraceEvent.h"
@@ -384,6 +385,30 @@ void SkImage_Gpu::onAsyncRescaleAndReadPixelsYUV420(SkYUVColorSpace yuvColorSpac
 
 void SkImage_Gpu::generatingSurfaceIsDeleted() { fChooser.makeVolatileProxyStable(); }
 
+bool SkImage_Gpu::onNotifyTextureContentsChanged(GrDirectContext* dContext,
+                                                 int numWaitSemaphores,
+                                                 const GrBackendSemaphore* waitSemaphores) {
+    if (!fContext->priv().matches(dContext) || dContext->abandoned()) {
+        return false;
+    }
+    // Order the producer's writes before any of our reads of the new contents. The client
+    // retains ownership of the semaphores.
+    if (numWaitSemaphores > 0 &&
+        !dContext->wait(numWaitSemaphores, waitSemaphores, /*deleteSemaphoresAfterWait=*/false)) {
+        return false;
+    }
+    // If the wrapped texture has mip levels then the resident levels were built from the old
+    // base level and must be regenerated before the next mipmapped sampling.
+    sk_sp<GrSurfaceProxy> proxy = fChooser.chooseProxy(dContext);
+    if (GrTextureProxy* texProxy = proxy->asTextureProxy()) {
+        if (texProxy->mipmapped() == GrMipmapped::kYes) {
+            texProxy->markMipmapsDirty();
+        }
+    }
+    this->invalidateDerivedCaches(dContext);
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 static sk_sp<SkImage> new_wrapped_texture_common(GrRecordingContext* rContext,
@@ -509,6 +534,35 @@ sk_sp<SkImage> SkImage::MakeTextureFromCompressed(GrDirectContext* direct, sk_sp
     }
 
     GrBackendFormat beFormat = direct->compressedBackendFormat(type);
+    if (!beFormat.isValid()) {
+        // Before decompressing, offer each compression type the GPU does support to the
+        // registered transcoder (if any), so the data can stay compressed on this device.
+        if (SkImage::CompressedDataTranscoder transcoder = SkGetCompressedDataTranscoder()) {
+            for (int ct = 0; ct < kCompressionTypeCount; ++ct) {
+                CompressionType candidate = static_cast<CompressionType>(ct);
+                if (candidate == CompressionType::kNone || candidate == type) {
+                    continue;
+                }
+                GrBackendFormat candidateFormat = direct->compressedBackendFormat(candidate);
+                if (!candidateFormat.isValid()) {
+                    continue;
+                }
+                sk_sp<SkData> transcoded = transcoder(data, width, height, type, candidate);
+                if (!transcoded) {
+                    continue;
+                }
+                size_t expectedSize = SkCompressedDataSize(candidate, {width, height}, nullptr,
+                                                           mipMapped == GrMipmapped::kYes);
+                if (transcoded->size() < expectedSize) {
+                    continue;
+                }
+                data = std::move(transcoded);
+                type = candidate;
+                beFormat = std::move(candidateFormat);
+                break;
+            }
+        }
+    }
     if (!beFormat.isValid()) {
         sk_sp<SkImage> tmp = MakeRasterFromCompressed(std::move(data), width, height, type);
         if (!tmp) {
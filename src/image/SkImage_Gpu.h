@@ -73,6 +73,10 @@ public:
 
     void generatingSurfaceIsDeleted() override;
 
+    bool onNotifyTextureContentsChanged(GrDirectContext*,
+                                        int numWaitSemaphores,
+                                        const GrBackendSemaphore* waitSemaphores) override;
+
 private:
     SkImage_Gpu(sk_sp<GrDirectContext>,
                 GrSurfaceProxyView volatileSrc,
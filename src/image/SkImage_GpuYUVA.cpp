@@ -9,6 +9,7 @@
 #include <cstring>
 #include <type_traits>
 
+#include "include/core/SkImageGenerator.h"
 #include "include/core/SkYUVAPixmaps.h"
 #include "include/gpu/GrDirectContext.h"
 #include "include/gpu/GrRecordingContext.h"
@@ -255,6 +256,39 @@ sk_sp<SkImage> SkImage::MakeFromYUVATextures(GrRecordingContext* context,
                                        imageColorSpace);
 }
 
+sk_sp<SkImage> SkImage::MakeFromEncodedYUVA(GrRecordingContext* context,
+                                            sk_sp<SkData> encoded,
+                                            GrMipmapped buildMips,
+                                            sk_sp<SkColorSpace> imageColorSpace) {
+    if (!context || !encoded) {
+        return nullptr;
+    }
+
+    auto generator = SkImageGenerator::MakeFromEncoded(std::move(encoded));
+    if (!generator) {
+        return nullptr;
+    }
+
+    SkYUVAPixmapInfo::SupportedDataTypes supportedDataTypes(*context);
+    SkYUVAPixmapInfo yuvaPixmapInfo;
+    if (!generator->queryYUVAInfo(supportedDataTypes, &yuvaPixmapInfo)) {
+        return nullptr;
+    }
+    SkYUVAPixmaps pixmaps = SkYUVAPixmaps::Allocate(yuvaPixmapInfo);
+    if (!pixmaps.isValid() || !generator->getYUVAPlanes(pixmaps)) {
+        return nullptr;
+    }
+
+    if (!imageColorSpace) {
+        imageColorSpace = generator->getInfo().refColorSpace();
+    }
+    return MakeFromYUVAPixmaps(context,
+                               pixmaps,
+                               buildMips,
+                               /*limitToMaxTextureSize=*/true,
+                               std::move(imageColorSpace));
+}
+
 sk_sp<SkImage> SkImage::MakeFromYUVAPixmaps(GrRecordingContext* context,
                                             const SkYUVAPixmaps& pixmaps,
                                             GrMipmapped buildMips,
@@ -26,8 +26,10 @@
 #include "src/gpu/GrGpuResourcePriv.h"
 #include "src/gpu/GrPaint.h"
 #include "src/gpu/GrProxyProvider.h"
+#include "src/gpu/GrImageInfo.h"
 #include "src/gpu/GrRecordingContextPriv.h"
 #include "src/gpu/GrSamplerState.h"
+#include "src/gpu/GrSurfaceContext.h"
 #include "src/gpu/GrSurfaceFillContext.h"
 #include "src/gpu/GrYUVATextureProxies.h"
 #include "src/gpu/SkGr.h"
@@ -398,6 +400,91 @@ sk_sp<SkCachedData> SkImage_Lazy::getPlanes(
     return data;
 }
 
+GrSurfaceProxyView SkImage_Lazy::startProgressiveDecode(GrRecordingContext* rContext) const {
+    const int rowBudget = rContext->priv().options().fProgressiveLazyImageDecodeRows;
+    auto dContext = GrAsDirectContext(rContext);
+    if (rowBudget <= 0 || !dContext) {
+        return {};
+    }
+    if (this->height() <= rowBudget) {
+        return {};  // the whole decode fits in one slice anyway
+    }
+
+    ScopedGenerator generator(fSharedGenerator);
+    if (fProgressiveDecode) {
+        return {};
+    }
+    auto state = std::make_unique<ProgressiveDecode>();
+    if (!state->fBitmap.tryAllocPixels(this->imageInfo())) {
+        return {};
+    }
+    if (!generator->startIncrementalDecode(state->fBitmap.info(), state->fBitmap.getPixels(),
+                                           state->fBitmap.rowBytes())) {
+        return {};
+    }
+    // Rows the decode has not reached yet read as transparent until their slice arrives.
+    state->fBitmap.eraseColor(SK_ColorTRANSPARENT);
+    int totalRows = 0;
+    if (!generator->incrementalDecode(rowBudget, &totalRows)) {
+        return {};
+    }
+
+    auto sContext = GrSurfaceContext::Make(rContext, GrImageInfo(state->fBitmap.info()));
+    if (!sContext) {
+        return {};
+    }
+    SkPixmap pixmap;
+    SkAssertResult(state->fBitmap.peekPixels(&pixmap));
+    if (!sContext->writePixels(dContext, pixmap, {0, 0})) {
+        return {};
+    }
+    state->fRowsUploaded = totalRows;
+    if (totalRows < this->height()) {
+        fProgressiveDecode = std::move(state);
+    }
+    return sContext->readSurfaceView();
+}
+
+void SkImage_Lazy::pumpProgressiveDecode(GrRecordingContext* rContext,
+                                         const GrSurfaceProxyView& view) const {
+    auto dContext = GrAsDirectContext(rContext);
+    if (!dContext) {
+        return;  // e.g. recording a DDL; the decode resumes under a direct context
+    }
+    const int rowBudget = std::max(rContext->priv().options().fProgressiveLazyImageDecodeRows, 1);
+
+    ScopedGenerator generator(fSharedGenerator);
+    ProgressiveDecode* state = fProgressiveDecode.get();
+    if (!state || view.dimensions() != state->fBitmap.dimensions()) {
+        return;
+    }
+    int totalRows = state->fRowsUploaded;
+    bool done;
+    if (!generator->incrementalDecode(rowBudget, &totalRows)) {
+        // The input could not be decoded further. The generator filled the rows it could not
+        // produce, so upload everything left and finish.
+        totalRows = state->fBitmap.height();
+        done = true;
+    } else {
+        done = totalRows >= state->fBitmap.height();
+    }
+
+    if (totalRows > state->fRowsUploaded) {
+        SkPixmap full, strip;
+        SkAssertResult(state->fBitmap.peekPixels(&full));
+        if (full.extractSubset(&strip, SkIRect::MakeLTRB(0, state->fRowsUploaded,
+                                                         full.width(), totalRows))) {
+            GrSurfaceContext sContext(rContext, view,
+                                      GrColorInfo(state->fBitmap.info().colorInfo()));
+            sContext.writePixels(dContext, strip, {0, state->fRowsUploaded});
+        }
+        state->fRowsUploaded = totalRows;
+    }
+    if (done) {
+        fProgressiveDecode.reset();
+    }
+}
+
 /*
  *  We have 4 ways to try to return a texture (in sorted order)
  *
@@ -447,6 +534,12 @@ GrSurfaceProxyView SkImage_Lazy::lockTextureProxyView(GrRecordingContext* rConte
         if (proxy) {
             GrSwizzle swizzle = caps->getReadSwizzle(proxy->backendFormat(), ct);
             GrSurfaceProxyView view(std::move(proxy), kTopLeft_GrSurfaceOrigin, swizzle);
+            if (fProgressiveDecode) {
+                // The texture is still being filled in; decode and upload the next slice and
+                // keep drawing the base level. Mip generation waits for the full image.
+                this->pumpProgressiveDecode(rContext, view);
+                return view;
+            }
             if (mipmapped == GrMipmapped::kNo ||
                 view.asTextureProxy()->mipmapped() == GrMipmapped::kYes) {
                 return view;
@@ -496,6 +589,15 @@ GrSurfaceProxyView SkImage_Lazy::lockTextureProxyView(GrRecordingContext* rConte
         }
     }
 
+    // 3b. For large images whose generator can decode in row slices, create the texture with
+    //     only the first slice decoded and fill in the remainder over subsequent frames.
+    if (texGenPolicy == GrImageTexGenPolicy::kDraw && mipmapped == GrMipmapped::kNo) {
+        if (auto view = this->startProgressiveDecode(rContext)) {
+            installKey(view);
+            return view;
+        }
+    }
+
     // 4. Ask the generator to return a bitmap, which the GPU can convert.
     auto hint = texGenPolicy == GrImageTexGenPolicy::kDraw ? CachingHint::kAllow_CachingHint
                                                            : CachingHint::kDisallow_CachingHint;
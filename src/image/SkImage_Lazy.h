@@ -13,6 +13,7 @@
 #include "src/image/SkImage_Base.h"
 
 #if SK_SUPPORT_GPU
+#include "include/core/SkBitmap.h"
 #include "include/core/SkYUVAPixmaps.h"
 #endif
 
@@ -81,6 +82,14 @@ private:
     GrSurfaceProxyView textureProxyViewFromPlanes(GrRecordingContext*, SkBudgeted) const;
     sk_sp<SkCachedData> getPlanes(const SkYUVAPixmapInfo::SupportedDataTypes& supportedDataTypes,
                                   SkYUVAPixmaps* pixmaps) const;
+
+    // If GrContextOptions::fProgressiveLazyImageDecodeRows is set and the generator supports
+    // incremental decode, creates the texture with only the first slice of rows decoded and
+    // remembers the decode state; each later lock of the cached texture decodes and uploads
+    // another slice until the image is complete. Returns an empty view when the progressive
+    // path does not apply and the caller should decode the whole image.
+    GrSurfaceProxyView startProgressiveDecode(GrRecordingContext*) const;
+    void pumpProgressiveDecode(GrRecordingContext*, const GrSurfaceProxyView&) const;
 #endif
 
     class ScopedGenerator;
@@ -99,6 +108,14 @@ private:
     // When the SkImage_Lazy goes away, we will iterate over all the listeners to inform them
     // of the unique ID's demise. This is used to remove cached textures from GrContext.
     mutable SkIDChangeListener::List fUniqueIDListeners;
+
+    // In-flight progressive decode, if any. Only accessed while holding the shared generator's
+    // mutex (via ScopedGenerator), since the decode state lives in the generator.
+    struct ProgressiveDecode {
+        SkBitmap fBitmap;         // full-size CPU staging, filled top-down
+        int      fRowsUploaded = 0;
+    };
+    mutable std::unique_ptr<ProgressiveDecode> fProgressiveDecode;
 #endif
 
     using INHERITED = SkImage_Base;
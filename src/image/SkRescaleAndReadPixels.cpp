@@ -11,7 +11,9 @@
 #include "include/core/SkPaint.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkSurface.h"
+#include "src/image/SkRescaleAndReadPixels.h"
 
+#include <algorithm>
 #include <cmath>
 
 void SkRescaleAndReadPixels(SkBitmap bmp,
@@ -153,3 +155,52 @@ void SkRescaleAndReadPixels(SkBitmap bmp,
         callback(context, nullptr);
     }
 }
+
+namespace {
+
+// Heap-allocated per-band context for SkIssueTiledReadPixels. Owns nothing beyond the band's
+// placement; freed when the band's single-shot read completes.
+struct TileContext {
+    SkImage::ReadPixelsTileCallback* fCallback;
+    SkImage::ReadPixelsContext fContext;
+    SkIRect fTileRect;
+};
+
+void deliver_tile(SkImage::ReadPixelsContext context,
+                  std::unique_ptr<const SkImage::AsyncReadResult> result) {
+    std::unique_ptr<TileContext> tile(static_cast<TileContext*>(context));
+    tile->fCallback(tile->fContext, tile->fTileRect, std::move(result));
+}
+
+}  // anonymous namespace
+
+void SkIssueTiledReadPixels(const SkImageInfo& resultInfo,
+                            const SkIRect& srcRect,
+                            int tileRows,
+                            SkImage::RescaleGamma rescaleGamma,
+                            SkImage::RescaleMode rescaleMode,
+                            SkImage::ReadPixelsTileCallback callback,
+                            SkImage::ReadPixelsContext context,
+                            const std::function<void(const SkImageInfo&,
+                                                     const SkIRect&,
+                                                     SkImage::RescaleGamma,
+                                                     SkImage::RescaleMode,
+                                                     SkImage::ReadPixelsCallback*,
+                                                     SkImage::ReadPixelsContext)>& read) {
+    bool rescaling = srcRect.size() != resultInfo.dimensions();
+    if (tileRows <= 0 || tileRows >= resultInfo.height() || rescaling) {
+        // Band geometry doesn't decompose under rescale, so deliver a single tile.
+        auto tile = new TileContext{callback, context, SkIRect::MakeSize(resultInfo.dimensions())};
+        read(resultInfo, srcRect, rescaleGamma, rescaleMode, deliver_tile, tile);
+        return;
+    }
+    for (int y = 0; y < resultInfo.height(); y += tileRows) {
+        int h = std::min(tileRows, resultInfo.height() - y);
+        SkIRect tileRect = SkIRect::MakeXYWH(0, y, resultInfo.width(), h);
+        SkIRect tileSrc = SkIRect::MakeXYWH(srcRect.left(), srcRect.top() + y,
+                                            srcRect.width(), h);
+        auto tile = new TileContext{callback, context, tileRect};
+        read(resultInfo.makeWH(resultInfo.width(), h), tileSrc, rescaleGamma, rescaleMode,
+             deliver_tile, tile);
+    }
+}
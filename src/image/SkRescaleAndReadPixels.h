@@ -9,6 +9,8 @@
 #include "include/core/SkImage.h"
 #include "include/core/SkSamplingOptions.h"
 
+#include <functional>
+
 struct SkImageInfo;
 struct SkIRect;
 
@@ -20,3 +22,22 @@ void SkRescaleAndReadPixels(SkBitmap src,
                             SkImage::RescaleMode,
                             SkImage::ReadPixelsCallback,
                             SkImage::ReadPixelsContext);
+
+/** Shared implementation for SkImage:: and SkSurface::asyncRescaleAndReadPixelsTiled. Splits the
+    request into horizontal bands of at most 'tileRows' rows and issues each band through 'read',
+    which performs a single-shot async read (e.g. onAsyncRescaleAndReadPixels) and must eventually
+    invoke the ReadPixelsCallback it is given. Collapses to one band when rescaling is required or
+    'tileRows' is not in (0, resultInfo.height()). */
+void SkIssueTiledReadPixels(const SkImageInfo& resultInfo,
+                            const SkIRect& srcRect,
+                            int tileRows,
+                            SkImage::RescaleGamma,
+                            SkImage::RescaleMode,
+                            SkImage::ReadPixelsTileCallback callback,
+                            SkImage::ReadPixelsContext context,
+                            const std::function<void(const SkImageInfo&,
+                                                     const SkIRect&,
+                                                     SkImage::RescaleGamma,
+                                                     SkImage::RescaleMode,
+                                                     SkImage::ReadPixelsCallback*,
+                                                     SkImage::ReadPixelsContext)>& read);
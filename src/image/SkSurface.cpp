@@ -211,6 +211,15 @@ sk_sp<SkImage> SkSurface::makeImageSnapshot(const SkIRect& srcBounds) {
     }
 }
 
+sk_sp<SkImage> SkSurface::makeIncrementalImageSnapshot(const SkIRect& dirtyRect) {
+    const SkIRect surfBounds = { 0, 0, fWidth, fHeight };
+    SkIRect dirty = dirtyRect;
+    if (!dirty.intersect(surfBounds)) {
+        dirty.setEmpty();
+    }
+    return asSB(this)->onNewIncrementalImageSnapshot(dirty);
+}
+
 sk_sp<SkSurface> SkSurface::makeSurface(const SkImageInfo& info) {
     return asSB(this)->onNewSurface(info);
 }
@@ -257,6 +266,30 @@ void SkSurface::asyncRescaleAndReadPixels(const SkImageInfo& info,
             info, srcRect, rescaleGamma, rescaleMode, callback, context);
 }
 
+void SkSurface::asyncRescaleAndReadPixelsTiled(const SkImageInfo& info,
+                                               const SkIRect& srcRect,
+                                               int tileRows,
+                                               RescaleGamma rescaleGamma,
+                                               RescaleMode rescaleMode,
+                                               ReadPixelsTileCallback callback,
+                                               ReadPixelsContext context) {
+    if (!SkIRect::MakeWH(this->width(), this->height()).contains(srcRect) ||
+        !SkImageInfoIsValid(info)) {
+        callback(context, SkIRect::MakeEmpty(), nullptr);
+        return;
+    }
+    SkIssueTiledReadPixels(info, srcRect, tileRows, rescaleGamma, rescaleMode, callback, context,
+                           [this](const SkImageInfo& tileInfo,
+                                  const SkIRect& tileSrc,
+                                  RescaleGamma gamma,
+                                  RescaleMode mode,
+                                  ReadPixelsCallback* cb,
+                                  ReadPixelsContext ctx) {
+                               asSB(this)->onAsyncRescaleAndReadPixels(tileInfo, tileSrc, gamma,
+                                                                       mode, cb, ctx);
+                           });
+}
+
 void SkSurface::asyncRescaleAndReadPixelsYUV420(SkYUVColorSpace yuvColorSpace,
                                                 sk_sp<SkColorSpace> dstColorSpace,
                                                 const SkIRect& srcRect,
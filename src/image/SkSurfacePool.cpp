@@ -0,0 +1,110 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkSurfacePool.h"
+
+#include "include/core/SkCanvas.h"
+#include "src/core/SkCanvasPriv.h"
+
+#if SK_SUPPORT_GPU
+#include "include/gpu/GrRecordingContext.h"
+#endif
+
+#include <algorithm>
+
+SkSurfacePool::SkSurfacePool(int maxSurfaces) : fMaxSurfaces(std::max(maxSurfaces, 1)) {}
+
+SkSurfacePool::~SkSurfacePool() = default;
+
+static void reset_canvas(SkSurface* surface) {
+    SkCanvas* canvas = surface->getCanvas();
+    canvas->restoreToCount(1);
+    canvas->resetMatrix();
+    SkCanvasPriv::ReplaceClip(canvas, SkIRect::MakeWH(surface->width(), surface->height()));
+}
+
+sk_sp<SkSurface> SkSurfacePool::acquire(GrRecordingContext* recordingContext,
+                                        const SkImageInfo& info,
+                                        int sampleCount,
+                                        const SkSurfaceProps* props) {
+    for (Entry& entry : fEntries) {
+        if (entry.fInUse || entry.fSampleCount != sampleCount) {
+            continue;
+        }
+        SkSurface* surface = entry.fSurface.get();
+        if (surface->recordingContext() != recordingContext ||
+            surface->imageInfo() != info ||
+            (props && surface->props() != *props)) {
+            continue;
+        }
+        entry.fInUse = true;
+        // Force a new content generation so images snapped from the previous use keep their
+        // pixels; the pool's surfaces hand back undefined contents.
+        surface->notifyContentWillChange(SkSurface::kDiscard_ContentChangeMode);
+        reset_canvas(surface);
+        return entry.fSurface;
+    }
+
+    sk_sp<SkSurface> surface;
+#if SK_SUPPORT_GPU
+    if (recordingContext) {
+        surface = SkSurface::MakeRenderTarget(recordingContext, SkBudgeted::kYes, info,
+                                              sampleCount, props);
+    } else
+#endif
+    {
+        if (recordingContext || sampleCount != 1) {
+            return nullptr;
+        }
+        surface = SkSurface::MakeRaster(info, props);
+    }
+    if (surface) {
+        fEntries.push_back({surface, sampleCount, /*fInUse=*/true});
+    }
+    return surface;
+}
+
+void SkSurfacePool::recycle(sk_sp<SkSurface> surface) {
+    auto it = fEntries.begin();
+    for (; it != fEntries.end(); ++it) {
+        if (it->fSurface.get() == surface.get()) {
+            break;
+        }
+    }
+    surface.reset();  // the pool's own ref keeps the entry's surface alive
+    if (it == fEntries.end() || !it->fInUse) {
+        return;
+    }
+    if (!it->fSurface->unique()) {
+        // The caller kept a ref; the surface can't be handed to someone else.
+        fEntries.erase(it);
+        return;
+    }
+    it->fInUse = false;
+    if (this->count() > fMaxSurfaces) {
+        for (auto oldest = fEntries.begin(); oldest != fEntries.end(); ++oldest) {
+            if (!oldest->fInUse) {
+                fEntries.erase(oldest);
+                break;
+            }
+        }
+    }
+}
+
+void SkSurfacePool::purge() {
+    fEntries.erase(std::remove_if(fEntries.begin(), fEntries.end(),
+                                  [](const Entry& entry) { return !entry.fInUse; }),
+                   fEntries.end());
+}
+
+int SkSurfacePool::count() const {
+    int idle = 0;
+    for (const Entry& entry : fEntries) {
+        idle += !entry.fInUse;
+    }
+    return idle;
+}
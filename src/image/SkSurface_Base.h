@@ -50,6 +50,15 @@ public:
      */
     virtual sk_sp<SkImage> onNewImageSnapshot(const SkIRect* subset = nullptr) { return nullptr; }
 
+    /**
+     *  Incremental snapshot: the caller promises that only 'dirty' (already clipped to the
+     *  surface bounds) has changed since the previous snapshot taken from this surface. The
+     *  default implementation ignores the hint and takes a regular (copy-on-write) snapshot.
+     */
+    virtual sk_sp<SkImage> onNewIncrementalImageSnapshot(const SkIRect& /*dirty*/) {
+        return this->refCachedImage();
+    }
+
     virtual void onWritePixels(const SkPixmap&, int x, int y) = 0;
 
     /**
@@ -22,8 +22,10 @@
 #include "src/gpu/GrProxyProvider.h"
 #include "src/gpu/GrRecordingContextPriv.h"
 #include "src/gpu/GrRenderTarget.h"
+#include "src/gpu/GrSurfaceDrawContext.h"
 #include "src/gpu/GrTexture.h"
 #include "src/gpu/SkBaseGpuDevice.h"
+#include "src/gpu/SkGr.h"
 #include "src/image/SkImage_Base.h"
 #include "src/image/SkImage_Gpu.h"
 #include "src/image/SkSurface_Base.h"
@@ -148,6 +150,92 @@ sk_sp<SkImage> SkSurface_Gpu::onNewImageSnapshot(const SkIRect* subset) {
                                    info.colorInfo());
 }
 
+sk_sp<SkImage> SkSurface_Gpu::onNewIncrementalImageSnapshot(const SkIRect& dirty) {
+    GrSurfaceProxyView srcView = fDevice->readSurfaceView();
+    GrRenderTargetProxy* rtp = fDevice->targetProxy();
+    if (!rtp || !srcView.asTextureProxy() || rtp->refsWrappedObjects()) {
+        // Client-created buffers keep the regular snapshot path.
+        return this->refCachedImage();
+    }
+
+    auto rContext = fDevice->recordingContext();
+    const SkImageInfo info = fDevice->imageInfo();
+    const SkIRect surfBounds = SkIRect::MakeSize(srcView.dimensions());
+
+    if (fSnapshotSrcID != srcView.proxy()->uniqueID()) {
+        // First use, or the surface was retargeted (copy-on-write) or discarded: every backing
+        // is entirely stale.
+        for (SnapshotBacking& backing : fSnapshotBackings) {
+            backing.fStale.setRect(surfBounds);
+        }
+        fSnapshotSrcID = srcView.proxy()->uniqueID();
+    } else if (!dirty.isEmpty()) {
+        for (SnapshotBacking& backing : fSnapshotBackings) {
+            backing.fStale.op(dirty, SkRegion::kUnion_Op);
+        }
+    }
+
+    // Recycle a backing whose last snapshot has been released, else allocate the second one.
+    SnapshotBacking* backing = nullptr;
+    for (SnapshotBacking& candidate : fSnapshotBackings) {
+        if (candidate.fView && (!candidate.fImage || candidate.fImage->unique())) {
+            backing = &candidate;
+            break;
+        }
+    }
+    if (!backing) {
+        for (SnapshotBacking& candidate : fSnapshotBackings) {
+            if (!candidate.fView) {
+                backing = &candidate;
+                break;
+            }
+        }
+    }
+    if (!backing) {
+        // Both backings are still referenced by live snapshots; fall back to copy-on-write.
+        return this->refCachedImage();
+    }
+
+    GrColorType grCT = SkColorTypeToGrColorType(info.colorType());
+    std::unique_ptr<GrSurfaceDrawContext> sdc;
+    if (!backing->fView) {
+        sdc = GrSurfaceDrawContext::Make(rContext, grCT, info.refColorSpace(),
+                                         SkBackingFit::kExact, srcView.dimensions(),
+                                         this->props(), /*sampleCnt=*/1, GrMipmapped::kNo,
+                                         rtp->isProtected(), srcView.origin(),
+                                         rtp->isBudgeted());
+        if (!sdc) {
+            return this->refCachedImage();
+        }
+        backing->fView = sdc->readSurfaceView();
+        backing->fStale.setRect(surfBounds);
+    } else {
+        sdc = GrSurfaceDrawContext::Make(rContext, grCT, sk_ref_sp(backing->fView.proxy()),
+                                         info.refColorSpace(), backing->fView.origin(),
+                                         this->props());
+        if (!sdc) {
+            return this->refCachedImage();
+        }
+    }
+
+    // Patch just the stale region from the surface into the backing.
+    for (SkRegion::Iterator iter(backing->fStale); !iter.done(); iter.next()) {
+        SkIRect rect = iter.rect();
+        if (!rect.intersect(surfBounds)) {
+            continue;
+        }
+        sdc->drawTexture(nullptr, srcView, info.alphaType(), GrSamplerState::Filter::kNearest,
+                         GrSamplerState::MipmapMode::kNone, SkBlendMode::kSrc, SK_PMColor4fWHITE,
+                         SkRect::Make(rect), SkRect::Make(rect), GrAA::kNo, GrQuadAAFlags::kNone,
+                         SkCanvas::kStrict_SrcRectConstraint, SkMatrix::I(), nullptr);
+    }
+    backing->fStale.setEmpty();
+
+    backing->fImage = sk_make_sp<SkImage_Gpu>(sk_ref_sp(rContext), kNeedNewImageUniqueID,
+                                              backing->fView, info.colorInfo());
+    return backing->fImage;
+}
+
 void SkSurface_Gpu::onWritePixels(const SkPixmap& src, int x, int y) {
     fDevice->writePixels(src, x, y);
 }
@@ -202,7 +290,11 @@ void SkSurface_Gpu::onCopyOnWrite(ContentChangeMode mode) {
     }
 }
 
-void SkSurface_Gpu::onDiscard() { fDevice->discard(); }
+void SkSurface_Gpu::onDiscard() {
+    // The surface content is undefined now, so the snapshot backings can't be patched from it.
+    fSnapshotSrcID = GrSurfaceProxy::UniqueID::InvalidID();
+    fDevice->discard();
+}
 
 GrSemaphoresSubmitted SkSurface_Gpu::onFlush(BackendSurfaceAccess access, const GrFlushInfo& info,
                                              const GrBackendSurfaceMutableState* newState) {
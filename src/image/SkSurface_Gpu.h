@@ -8,7 +8,9 @@
 #ifndef SkSurface_Gpu_DEFINED
 #define SkSurface_Gpu_DEFINED
 
+#include "include/core/SkRegion.h"
 #include "include/private/GrTypesPriv.h"
+#include "src/gpu/GrSurfaceProxyView.h"
 #include "src/image/SkSurface_Base.h"
 
 #if SK_SUPPORT_GPU
@@ -32,6 +34,7 @@ public:
     SkCanvas* onNewCanvas() override;
     sk_sp<SkSurface> onNewSurface(const SkImageInfo&) override;
     sk_sp<SkImage> onNewImageSnapshot(const SkIRect* subset) override;
+    sk_sp<SkImage> onNewIncrementalImageSnapshot(const SkIRect& dirty) override;
     void onWritePixels(const SkPixmap&, int x, int y) override;
     void onAsyncRescaleAndReadPixels(const SkImageInfo& info, const SkIRect& srcRect,
                                      RescaleGamma rescaleGamma, RescaleMode,
@@ -63,6 +66,20 @@ public:
 private:
     sk_sp<SkBaseGpuDevice> fDevice;
 
+    // Reusable textures backing makeIncrementalImageSnapshot(). Each records the region of the
+    // surface that changed since the backing was last refreshed, so a new snapshot only copies
+    // that damage. Two backings ping-pong so a client can hold the latest snapshot while the
+    // previous one is recycled.
+    struct SnapshotBacking {
+        GrSurfaceProxyView fView;
+        SkRegion           fStale;
+        sk_sp<SkImage>     fImage;  // last snapshot handed out from this backing
+    };
+    SnapshotBacking            fSnapshotBackings[2];
+    // The surface proxy the backings mirror; invalid forces a full refresh (first use, or the
+    // surface was retargeted by copy-on-write or discarded).
+    GrSurfaceProxy::UniqueID   fSnapshotSrcID = GrSurfaceProxy::UniqueID::InvalidID();
+
     using INHERITED = SkSurface_Base;
 };
 
@@ -9,17 +9,21 @@
 
 #ifdef SK_ENCODE_PNG
 
+#include "include/core/SkExecutor.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
 #include "include/encode/SkPngEncoder.h"
 #include "include/private/SkImageInfoPriv.h"
+#include "include/private/SkTemplates.h"
 #include "src/codec/SkColorTable.h"
 #include "src/codec/SkPngPriv.h"
 #include "src/core/SkMSAN.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/images/SkImageEncoderFns.h"
 #include <vector>
 
 #include "png.h"
+#include "zlib.h"
 
 static_assert(PNG_FILTER_NONE  == (int)SkPngEncoder::FilterFlag::kNone,  "Skia libpng filter err.");
 static_assert(PNG_FILTER_SUB   == (int)SkPngEncoder::FilterFlag::kSub,   "Skia libpng filter err.");
@@ -454,7 +458,249 @@ bool SkPngEncoder::onEncodeRows(int numRows) {
     return true;
 }
 
+namespace {
+
+// One horizontal slice of a parallel encode: rows [fBeginRow, fEndRow) are filtered and
+// deflated into an independent byte stream that concatenates with its neighbors.
+struct PngEncodeSlice {
+    int                  fBeginRow;
+    int                  fEndRow;
+    std::vector<uint8_t> fCompressed;
+    uLong                fAdler = 0;
+    uLong                fFilteredBytes = 0;
+    bool                 fSuccess = false;
+};
+
+enum class ParallelEncodeResult {
+    kSuccess,
+    kFailed,            // the header was already written; do not fall back
+    kFallbackToSerial,  // nothing was written to the stream
+};
+
+}  // namespace
+
+static uint8_t paeth_predictor(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return (pb <= pc) ? b : c;
+}
+
+static void apply_png_filter(int filter, uint8_t* dst, const uint8_t* cur, const uint8_t* prev,
+                             int rowLen, int bpp) {
+    for (int x = 0; x < rowLen; x++) {
+        const uint8_t left      = x >= bpp ? cur[x - bpp]  : 0;
+        const uint8_t upperLeft = x >= bpp ? prev[x - bpp] : 0;
+        switch (filter) {
+            case 0: dst[x] = cur[x];                                                   break;
+            case 1: dst[x] = cur[x] - left;                                            break;
+            case 2: dst[x] = cur[x] - prev[x];                                         break;
+            case 3: dst[x] = cur[x] - (uint8_t)((left + prev[x]) / 2);                 break;
+            case 4: dst[x] = cur[x] - paeth_predictor(left, prev[x], upperLeft);       break;
+        }
+    }
+}
+
+// Choose the filter whose output has the minimum sum of absolute values, mirroring libpng's
+// heuristic, and write the filter byte followed by the filtered row into dst.
+static void filter_row(uint8_t* dst, uint8_t* scratch, const uint8_t* cur, const uint8_t* prev,
+                       int rowLen, int bpp, int filterFlags) {
+    static constexpr struct {
+        SkPngEncoder::FilterFlag fFlag;
+        int                      fFilter;
+    } kFilters[] = {
+        { SkPngEncoder::FilterFlag::kNone,  0 },
+        { SkPngEncoder::FilterFlag::kSub,   1 },
+        { SkPngEncoder::FilterFlag::kUp,    2 },
+        { SkPngEncoder::FilterFlag::kAvg,   3 },
+        { SkPngEncoder::FilterFlag::kPaeth, 4 },
+    };
+
+    int best = -1;
+    uint64_t bestSum = 0;
+    for (const auto& candidate : kFilters) {
+        if (!(filterFlags & (int)candidate.fFlag)) {
+            continue;
+        }
+        apply_png_filter(candidate.fFilter, scratch, cur, prev, rowLen, bpp);
+        uint64_t sum = 0;
+        for (int x = 0; x < rowLen; x++) {
+            sum += scratch[x] < 128 ? scratch[x] : 256 - scratch[x];
+        }
+        if (best < 0 || sum < bestSum) {
+            best = candidate.fFilter;
+            bestSum = sum;
+            memcpy(dst + 1, scratch, rowLen);
+        }
+    }
+    if (best < 0) {
+        // FilterFlag::kZero: no filtering.
+        best = 0;
+        memcpy(dst + 1, cur, rowLen);
+    }
+    dst[0] = (uint8_t)best;
+}
+
+static void encode_png_slice(const SkPixmap& src, transform_scanline_proc proc,
+                             int pngBytesPerPixel, int zlibLevel, int filterFlags,
+                             bool isFirst, bool isLast, PngEncodeSlice* slice) {
+    const int rowLen = pngBytesPerPixel * src.width();
+    const int srcBpp = SkColorTypeBytesPerPixel(src.colorType());
+    SkAutoTMalloc<uint8_t> rowStorage(2 * rowLen);
+    SkAutoTMalloc<uint8_t> scratch(rowLen);
+    SkAutoTMalloc<uint8_t> filtered(rowLen + 1);
+    uint8_t* prevRow = rowStorage.get();
+    uint8_t* currRow = rowStorage.get() + rowLen;
+
+    // Filters reference the row above the slice; recreate it (or zeros for the first row).
+    if (slice->fBeginRow > 0) {
+        proc((char*)prevRow, (const char*)src.addr(0, slice->fBeginRow - 1), src.width(), srcBpp);
+    } else {
+        memset(prevRow, 0, rowLen);
+    }
+
+    z_stream zStream{};
+    // The first slice carries the zlib header; later slices continue as raw deflate data.
+    if (Z_OK != deflateInit2(&zStream, zlibLevel, Z_DEFLATED, isFirst ? 15 : -15, 8,
+                             Z_DEFAULT_STRATEGY)) {
+        return;
+    }
+
+    uLong adler = adler32(0, nullptr, 0);
+    uint8_t buffer[8192];
+    auto deflateRow = [&](const uint8_t* data, size_t len, int flush) {
+        zStream.next_in = const_cast<Bytef*>(data);
+        zStream.avail_in = (uInt)len;
+        while (true) {
+            zStream.next_out = buffer;
+            zStream.avail_out = sizeof(buffer);
+            if (Z_STREAM_ERROR == deflate(&zStream, flush)) {
+                return false;
+            }
+            slice->fCompressed.insert(slice->fCompressed.end(), buffer,
+                                      buffer + sizeof(buffer) - zStream.avail_out);
+            if (0 == zStream.avail_in && 0 != zStream.avail_out) {
+                return true;
+            }
+        }
+    };
+
+    for (int row = slice->fBeginRow; row < slice->fEndRow; row++) {
+        const void* srcRow = src.addr(0, row);
+        sk_msan_assert_initialized(srcRow,
+                                   (const uint8_t*)srcRow + (src.width() << src.shiftPerPixel()));
+        proc((char*)currRow, (const char*)srcRow, src.width(), srcBpp);
+        filter_row(filtered.get(), scratch.get(), currRow, prevRow, rowLen, pngBytesPerPixel,
+                   filterFlags);
+        adler = adler32(adler, filtered.get(), rowLen + 1);
+
+        int flush = Z_NO_FLUSH;
+        if (row == slice->fEndRow - 1) {
+            // A full flush byte-aligns the slice and resets the deflate window, so the next
+            // slice's stream needs no history from this one. The last slice ends the stream.
+            flush = isLast ? Z_FINISH : Z_FULL_FLUSH;
+        }
+        if (!deflateRow(filtered.get(), rowLen + 1, flush)) {
+            deflateEnd(&zStream);
+            return;
+        }
+        std::swap(prevRow, currRow);
+    }
+    deflateEnd(&zStream);
+
+    slice->fAdler = adler;
+    slice->fFilteredBytes = (uLong)(rowLen + 1) * (slice->fEndRow - slice->fBeginRow);
+    slice->fSuccess = true;
+}
+
+static ParallelEncodeResult encode_png_parallel(SkWStream* dst, const SkPixmap& src,
+                                                const SkPngEncoder::Options& options) {
+    // Slices need enough rows to amortize task overhead and the per-slice full flush.
+    constexpr int kMinRowsPerSlice = 128;
+    constexpr int kMaxSlices = 32;
+    int numSlices = std::min(src.height() / kMinRowsPerSlice, kMaxSlices);
+    if (numSlices < 2) {
+        return ParallelEncodeResult::kFallbackToSerial;
+    }
+
+    // writeInfo() uses png_set_filler() for this combination, which only applies to rows
+    // written through libpng.
+    if (kRGBA_F16_SkColorType == src.colorType() && kOpaque_SkAlphaType == src.alphaType()) {
+        return ParallelEncodeResult::kFallbackToSerial;
+    }
+    transform_scanline_proc proc = choose_proc(src.info());
+    if (!proc) {
+        return ParallelEncodeResult::kFallbackToSerial;
+    }
+
+    std::unique_ptr<SkPngEncoderMgr> encoderMgr = SkPngEncoderMgr::Make(dst);
+    if (!encoderMgr || !encoderMgr->setHeader(src.info(), options)
+                    || !encoderMgr->setColorSpace(src.info())) {
+        // Nothing has been written to the stream yet.
+        return ParallelEncodeResult::kFallbackToSerial;
+    }
+
+    const int filterFlags = (int)options.fFilterFlags & (int)SkPngEncoder::FilterFlag::kAll;
+    const int zlibLevel = std::min(std::max(0, options.fZLibLevel), 9);
+
+    std::vector<PngEncodeSlice> slices(numSlices);
+    const int rowsPerSlice = src.height() / numSlices;
+    for (int i = 0; i < numSlices; i++) {
+        slices[i].fBeginRow = i * rowsPerSlice;
+        slices[i].fEndRow = (i == numSlices - 1) ? src.height() : (i + 1) * rowsPerSlice;
+    }
+
+    SkTaskGroup taskGroup(*options.fExecutor);
+    taskGroup.batch(numSlices, [&](int i) {
+        encode_png_slice(src, proc, encoderMgr->pngBytesPerPixel(), zlibLevel, filterFlags,
+                         0 == i, numSlices - 1 == i, &slices[i]);
+    });
+    taskGroup.wait();
+
+    uLong adler = slices[0].fAdler;
+    for (int i = 0; i < numSlices; i++) {
+        if (!slices[i].fSuccess) {
+            return ParallelEncodeResult::kFallbackToSerial;
+        }
+        if (i > 0) {
+            adler = adler32_combine(adler, slices[i].fAdler, slices[i].fFilteredBytes);
+        }
+    }
+    // The last slice's Z_FINISH produced raw deflate data; append the zlib adler32 trailer
+    // for the whole stream.
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        slices.back().fCompressed.push_back((adler >> shift) & 0xff);
+    }
+
+    if (!encoderMgr->writeInfo(src.info())) {
+        return ParallelEncodeResult::kFallbackToSerial;
+    }
+    if (setjmp(png_jmpbuf(encoderMgr->pngPtr()))) {
+        return ParallelEncodeResult::kFailed;
+    }
+    for (const PngEncodeSlice& slice : slices) {
+        png_write_chunk(encoderMgr->pngPtr(), (png_const_bytep)"IDAT",
+                        slice.fCompressed.data(), slice.fCompressed.size());
+    }
+    png_write_chunk(encoderMgr->pngPtr(), (png_const_bytep)"IEND", nullptr, 0);
+    return ParallelEncodeResult::kSuccess;
+}
+
 bool SkPngEncoder::Encode(SkWStream* dst, const SkPixmap& src, const Options& options) {
+    if (options.fExecutor && SkPixmapIsValid(src)) {
+        switch (encode_png_parallel(dst, src, options)) {
+            case ParallelEncodeResult::kSuccess:
+                return true;
+            case ParallelEncodeResult::kFailed:
+                return false;
+            case ParallelEncodeResult::kFallbackToSerial:
+                break;
+        }
+    }
     auto encoder = SkPngEncoder::Make(dst, src, options);
     return encoder.get() && encoder->encodeRows(src.height());
 }
@@ -60,6 +60,7 @@ bool SkWebpEncoder::Encode(SkWStream* stream, const SkPixmap& pixmap, const Opti
     if (!WebPConfigPreset(&webp_config, WEBP_PRESET_DEFAULT, opts.fQuality)) {
         return false;
     }
+    webp_config.thread_level = opts.fMultiThread ? 1 : 0;
 
     WebPPicture pic;
     WebPPictureInit(&pic);
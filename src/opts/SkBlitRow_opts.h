@@ -251,6 +251,63 @@ inline void blit_row_color32(SkPMColor* dst, const SkPMColor* src, int count, Sk
     }
 }
 
+// Srcover count premul RGBA F16 src pixels onto an F16 dst. Four pixels (16 halfs) per pass,
+// so the half<->float conversions use the F16C/NEON fast paths in SkVx when available.
+/*not static*/
+inline void blit_row_f16_srcover(uint64_t* dst, const uint64_t* src, int count) {
+    sk_msan_assert_initialized(src, src+count);
+
+    while (count >= 4) {
+        skvx::Vec<16,float> s = skvx::from_half(skvx::Vec<16,uint16_t>::Load(src)),
+                            d = skvx::from_half(skvx::Vec<16,uint16_t>::Load(dst));
+        auto sa = skvx::shuffle<3,3,3,3, 7,7,7,7, 11,11,11,11, 15,15,15,15>(s);
+        skvx::to_half(s + d * (1.0f - sa)).store(dst);
+        src   += 4;
+        dst   += 4;
+        count -= 4;
+    }
+    while (count --> 0) {
+        skvx::Vec<4,float> s = skvx::from_half(skvx::Vec<4,uint16_t>::Load(src)),
+                           d = skvx::from_half(skvx::Vec<4,uint16_t>::Load(dst));
+        skvx::to_half(s + d * (1.0f - s[3])).store(dst);
+        src++;
+        dst++;
+    }
+}
+
+// Srcover count premul 1010102 src pixels onto a 1010102 dst. With a 2-bit alpha the blend
+// factor (1-sa) is a multiple of 1/3, so dst*(3-sa)/3 is exact; x/3 is computed for our small
+// products as (x*21846)>>16.
+/*not static*/
+inline void blit_row_1010102_srcover(uint32_t* dst, const uint32_t* src, int count) {
+    sk_msan_assert_initialized(src, src+count);
+
+    constexpr int N = 8;
+    using U32 = skvx::Vec<N, uint32_t>;
+
+    auto kernel = [](U32 s, U32 d) {
+        U32 inv = 3 - (s >> 30);
+        auto div3 = [](U32 x) { return (x * 21846) >> 16; };
+        U32 r = skvx::min(( s        & 1023) + div3(( d        & 1023) * inv), U32(1023)),
+            g = skvx::min(((s >> 10) & 1023) + div3(((d >> 10) & 1023) * inv), U32(1023)),
+            b = skvx::min(((s >> 20) & 1023) + div3(((d >> 20) & 1023) * inv), U32(1023)),
+            a = skvx::min(( s >> 30        ) + div3(( d >> 30        ) * inv), U32(   3));
+        return r | (g << 10) | (b << 20) | (a << 30);
+    };
+
+    while (count >= N) {
+        kernel(U32::Load(src), U32::Load(dst)).store(dst);
+        src   += N;
+        dst   += N;
+        count -= N;
+    }
+    while (count --> 0) {
+        *dst = kernel(U32{*src}, U32{*dst})[0];
+        src++;
+        dst++;
+    }
+}
+
 }  // namespace SK_OPTS_NS
 
 #endif//SkBlitRow_opts_DEFINED
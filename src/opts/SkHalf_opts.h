@@ -0,0 +1,46 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkHalf_opts_DEFINED
+#define SkHalf_opts_DEFINED
+
+#include "include/private/SkVx.h"
+
+// Span-based half <-> float conversion kernels backing SkOpts::halfs_to_floats and
+// SkOpts::floats_to_halfs. Like the Sk4h helpers in SkHalf.h these assume finite values and may
+// flush values which would be denormal half floats to zero; hardware conversions (F16C, ARMv8)
+// are used when the instruction set allows.
+
+namespace SK_OPTS_NS {
+
+inline void halfs_to_floats(float dst[], const uint16_t src[], int count) {
+    while (count >= 8) {
+        skvx::from_half(skvx::Vec<8,uint16_t>::Load(src)).store(dst);
+        src += 8;
+        dst += 8;
+        count -= 8;
+    }
+    for (int i = 0; i < count; ++i) {
+        dst[i] = skvx::from_half(skvx::Vec<1,uint16_t>{src[i]})[0];
+    }
+}
+
+inline void floats_to_halfs(uint16_t dst[], const float src[], int count) {
+    while (count >= 8) {
+        skvx::to_half(skvx::Vec<8,float>::Load(src)).store(dst);
+        src += 8;
+        dst += 8;
+        count -= 8;
+    }
+    for (int i = 0; i < count; ++i) {
+        dst[i] = skvx::to_half(skvx::Vec<1,float>{src[i]})[0];
+    }
+}
+
+}  // namespace SK_OPTS_NS
+
+#endif  // SkHalf_opts_DEFINED
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkMatrix_opts_DEFINED
+#define SkMatrix_opts_DEFINED
+
+#include "include/core/SkPoint.h"
+#include "include/private/SkVx.h"
+
+// Bulk point-mapping kernels backing SkMatrixPriv::MapPointsSoA and
+// SkMatrixPriv::MapPointsAndBounds. 'mat' holds the six affine coefficients
+// { scaleX, skewX, transX, skewY, scaleY, transY }; perspective is handled by the callers.
+
+namespace SK_OPTS_NS {
+
+inline void matrix_map_points_soa(const float mat[6],
+                                  float dstX[], float dstY[],
+                                  const float srcX[], const float srcY[],
+                                  int count) {
+    using float8 = skvx::Vec<8,float>;
+    float8 sx = mat[0], kx = mat[1], tx = mat[2],
+           ky = mat[3], sy = mat[4], ty = mat[5];
+    // The split x/y lanes load and store full registers with no interleave shuffles.
+    while (count >= 8) {
+        float8 x = float8::Load(srcX),
+               y = float8::Load(srcY);
+        (x * sx + y * kx + tx).store(dstX);
+        (x * ky + y * sy + ty).store(dstY);
+        srcX += 8; srcY += 8;
+        dstX += 8; dstY += 8;
+        count -= 8;
+    }
+    for (int i = 0; i < count; ++i) {
+        float x = srcX[i],
+              y = srcY[i];
+        dstX[i] = x * mat[0] + y * mat[1] + mat[2];
+        dstY[i] = x * mat[3] + y * mat[4] + mat[5];
+    }
+}
+
+// Maps interleaved points and accumulates the bounds of the mapped points in the same pass.
+// Writes { left, top, right, bottom } to 'boundsLTRB' and returns false if any mapped value
+// was non-finite (count must be > 0).
+inline bool matrix_map_points_bounds(const float mat[6],
+                                     SkPoint dst[], const SkPoint src[], int count,
+                                     float boundsLTRB[4]) {
+    SkASSERT(count > 0);
+    using float8 = skvx::Vec<8,float>;
+    float8 scale = {mat[0], mat[4], mat[0], mat[4], mat[0], mat[4], mat[0], mat[4]},
+           skew  = {mat[1], mat[3], mat[1], mat[3], mat[1], mat[3], mat[1], mat[3]},
+           trans = {mat[2], mat[5], mat[2], mat[5], mat[2], mat[5], mat[2], mat[5]};
+    // Interleaved x,y min/max accumulators, plus a product that goes NaN if any value does
+    // (the same finiteness trick SkRect::setBoundsCheck uses).
+    float8 vmin =  SK_ScalarInfinity,
+           vmax = -SK_ScalarInfinity,
+           prod = 0.0f;
+    while (count >= 4) {
+        float8 p   = float8::Load(src);                     // x0 y0 x1 y1 x2 y2 x3 y3
+        float8 swz = skvx::shuffle<1,0,3,2,5,4,7,6>(p);     // y0 x0 y1 x1 y2 x2 y3 x3
+        float8 mapped = p * scale + swz * skew + trans;
+        mapped.store(dst);
+        vmin = skvx::min(vmin, mapped);
+        vmax = skvx::max(vmax, mapped);
+        prod = prod * mapped;
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+    float minX = skvx::min(skvx::shuffle<0,2,4,6>(vmin)),
+          minY = skvx::min(skvx::shuffle<1,3,5,7>(vmin)),
+          maxX = skvx::max(skvx::shuffle<0,2,4,6>(vmax)),
+          maxY = skvx::max(skvx::shuffle<1,3,5,7>(vmax));
+    float accum = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        float x = src[i].fX * mat[0] + src[i].fY * mat[1] + mat[2],
+              y = src[i].fX * mat[3] + src[i].fY * mat[4] + mat[5];
+        dst[i].set(x, y);
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+        accum = accum * x * y;
+    }
+    boundsLTRB[0] = minX;
+    boundsLTRB[1] = minY;
+    boundsLTRB[2] = maxX;
+    boundsLTRB[3] = maxY;
+    return skvx::all(prod == 0.0f) && accum == 0;
+}
+
+}  // namespace SK_OPTS_NS
+
+#endif // SkMatrix_opts_DEFINED
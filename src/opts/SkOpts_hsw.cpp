@@ -11,20 +11,31 @@
 #include "src/core/SkCubicSolver.h"
 #include "src/opts/SkBitmapProcState_opts.h"
 #include "src/opts/SkBlitRow_opts.h"
+#include "src/opts/SkHalf_opts.h"
+#include "src/opts/SkMatrix_opts.h"
 #include "src/opts/SkRasterPipeline_opts.h"
 #include "src/opts/SkSwizzler_opts.h"
 #include "src/opts/SkUtils_opts.h"
 #include "src/opts/SkVM_opts.h"
+#include "src/opts/SkYUVtoRGBA_opts.h"
 
 namespace SkOpts {
     void Init_hsw() {
-        blit_row_color32     = hsw::blit_row_color32;
-        blit_row_s32a_opaque = hsw::blit_row_s32a_opaque;
+        blit_row_color32          = hsw::blit_row_color32;
+        blit_row_s32a_opaque      = hsw::blit_row_s32a_opaque;
+        blit_row_f16_srcover      = hsw::blit_row_f16_srcover;
+        blit_row_1010102_srcover  = hsw::blit_row_1010102_srcover;
 
         S32_alpha_D32_filter_DX  = hsw::S32_alpha_D32_filter_DX;
 
         cubic_solver = SK_OPTS_NS::cubic_solver;
 
+        halfs_to_floats = SK_OPTS_NS::halfs_to_floats;
+        floats_to_halfs = SK_OPTS_NS::floats_to_halfs;
+
+        matrix_map_points_soa    = SK_OPTS_NS::matrix_map_points_soa;
+        matrix_map_points_bounds = SK_OPTS_NS::matrix_map_points_bounds;
+
         RGBA_to_BGRA          = SK_OPTS_NS::RGBA_to_BGRA;
         RGBA_to_rgbA          = SK_OPTS_NS::RGBA_to_rgbA;
         RGBA_to_bgrA          = SK_OPTS_NS::RGBA_to_bgrA;
@@ -33,6 +44,14 @@ namespace SkOpts {
         grayA_to_rgbA         = SK_OPTS_NS::grayA_to_rgbA;
         inverted_CMYK_to_RGB1 = SK_OPTS_NS::inverted_CMYK_to_RGB1;
         inverted_CMYK_to_BGR1 = SK_OPTS_NS::inverted_CMYK_to_BGR1;
+        RGBA_to_F16           = SK_OPTS_NS::RGBA_to_F16;
+        F16_to_RGBA           = SK_OPTS_NS::F16_to_RGBA;
+        RGBA_to_1010102       = SK_OPTS_NS::RGBA_to_1010102;
+        RGBA_1010102_to_RGBA  = SK_OPTS_NS::RGBA_1010102_to_RGBA;
+
+        yuv_to_rgba_row = SK_OPTS_NS::yuv_to_rgba_row;
+
+        sample_u32 = SK_OPTS_NS::sample_u32;
 
     #define M(st) stages_highp[SkRasterPipeline::st] = (StageFn)SK_OPTS_NS::st;
         SK_RASTER_PIPELINE_STAGES(M)
@@ -1582,6 +1582,27 @@ STAGE(srcover_rgba_8888, const SkRasterPipeline_MemoryCtx* ctx) {
     store(ptr, dst, tail);
 }
 
+STAGE(srcover_rgba_f16, const SkRasterPipeline_MemoryCtx* ctx) {
+    auto ptr = ptr_at_xy<uint64_t>(ctx, dx,dy);
+
+    U16 R,G,B,A;
+    load4((const uint16_t*)ptr,tail, &R,&G,&B,&A);
+    dr = from_half(R);
+    dg = from_half(G);
+    db = from_half(B);
+    da = from_half(A);
+
+    r = mad(dr, inv(a), r);
+    g = mad(dg, inv(a), g);
+    b = mad(db, inv(a), b);
+    a = mad(da, inv(a), a);
+
+    store4((uint16_t*)ptr,tail, to_half(r)
+                              , to_half(g)
+                              , to_half(b)
+                              , to_half(a));
+}
+
 STAGE(clamp_0, Ctx::None) {
     r = max(r, 0);
     g = max(g, 0);
@@ -1851,6 +1872,27 @@ STAGE(gamma_, const float* G) {
     b = fn(b);
 }
 
+// 256 samples of a transfer function at i/255, linearly interpolated between. Sample points land
+// exactly on 8-bit-origin inputs, and the curves we table are gentle enough that interpolation
+// between them stays within ~2e-6. Inputs are clamped to the table's [0,1] domain, so only select
+// this for normalized sources (see SkColorSpaceXformSteps).
+STAGE(tf_lut, const float* table) {
+    auto fn = [&](F v) {
+        U32 sign;
+        v = strip_sign(v, &sign);
+
+        F ix = min(v, 1.0f) * 255.0f,
+          lo = min(floor_(ix), 254.0f);
+        U32 base = trunc_(lo);
+        F from = gather(table, base),
+          to   = gather(table, base + 1);
+        return apply_sign(lerp(from, to, ix - lo), sign);
+    };
+    r = fn(r);
+    g = fn(g);
+    b = fn(b);
+}
+
 STAGE(PQish, const skcms_TransferFunction* ctx) {
     auto fn = [&](F v) {
         U32 sign;
@@ -1906,6 +1948,63 @@ STAGE(HLGinvish, const skcms_TransferFunction* ctx) {
     b = fn(b);
 }
 
+STAGE(clut_3d, const SkRasterPipeline_Clut3DCtx* ctx) {
+    const float* t = ctx->table;
+    const float scale = ctx->scale,            // size - 1
+                stepR = (scale+1)*(scale+1)*3, // offsets between adjacent grid nodes, in floats
+                stepG = (scale+1)*3,
+                stepB = 3;
+
+    // Grid coordinates, clamped to the table's domain.
+    F cr = min(max(r, 0.0f), 1.0f) * scale,
+      cg = min(max(g, 0.0f), 1.0f) * scale,
+      cb = min(max(b, 0.0f), 1.0f) * scale;
+
+    // Cell origin and fractional position within the cell. Clamping the origin to size-2 makes
+    // the top edge land on the last cell with fractions of exactly 1.
+    F br = min(floor_(cr), scale - 1.0f),
+      bg = min(floor_(cg), scale - 1.0f),
+      bb = min(floor_(cb), scale - 1.0f),
+      fr = cr - br,
+      fg = cg - bg,
+      fb = cb - bb;
+
+    // Tetrahedral interpolation: of the cell's 8 corners, blend the 4 spanning the tetrahedron
+    // that contains (fr,fg,fb). The corners step along the largest fraction's axis first and the
+    // smallest's last, weighted by consecutive differences of the sorted fractions.
+    F maxf = max(fr, max(fg, fb)),
+      minf = min(fr, min(fg, fb)),
+      midf = (fr + fg + fb) - maxf - minf;
+
+    F sR = stepR,
+      sG = stepG,
+      sB = stepB;
+    F eMax = if_then_else(fr >= fg, if_then_else(fr >= fb, sR, sB),
+                                    if_then_else(fg >= fb, sG, sB)),
+      eMin = if_then_else(fr <  fg, if_then_else(fr <  fb, sR, sB),
+                                    if_then_else(fg <  fb, sG, sB));
+
+    // All index math stays exact in floats: even a 33^3 table spans well under 2^24.
+    F i0 = mad(br, stepR, mad(bg, stepG, bb * stepB)),
+      i3 = i0 + (stepR + stepG + stepB);
+    U32 ix0 = trunc_(i0),
+        ix1 = trunc_(i0 + eMax),
+        ix2 = trunc_(i3 - eMin),
+        ix3 = trunc_(i3);
+
+    F w0 = 1.0f - maxf,
+      w1 = maxf - midf,
+      w2 = midf - minf,
+      w3 = minf;
+
+    r = mad(w0, gather(t+0, ix0), mad(w1, gather(t+0, ix1),
+        mad(w2, gather(t+0, ix2),     w3 * gather(t+0, ix3))));
+    g = mad(w0, gather(t+1, ix0), mad(w1, gather(t+1, ix1),
+        mad(w2, gather(t+1, ix2),     w3 * gather(t+1, ix3))));
+    b = mad(w0, gather(t+2, ix0), mad(w1, gather(t+2, ix1),
+        mad(w2, gather(t+2, ix2),     w3 * gather(t+2, ix3))));
+}
+
 STAGE(load_a8, const SkRasterPipeline_MemoryCtx* ctx) {
     auto ptr = ptr_at_xy<const uint8_t>(ctx, dx,dy);
 
@@ -2662,6 +2761,11 @@ STAGE(callback, SkRasterPipeline_CallbackCtx* c) {
     load4(c->read_from,0, &r,&g,&b,&a);
 }
 
+// Interleaved between stages by SkRasterPipeline::build_stamped_pipeline(); never appended.
+STAGE(stamp_cycles, SkRasterPipeline_StampCtx* ctx) {
+    SkRasterPipelineStamp(ctx);
+}
+
 STAGE(gauss_a_to_rgba, Ctx::None) {
     // x = 1 - x;
     // exp(-x * x * 4) - 0.018f;
@@ -3274,6 +3378,12 @@ STAGE_PP(swap_rb_dst, Ctx::None) {
     db = tmp;
 }
 
+// Interleaved between stages by SkRasterPipeline::build_stamped_pipeline(); never appended.
+// Implemented in lowp too so tracing doesn't boot pipelines into highp.
+STAGE_PP(stamp_cycles, SkRasterPipeline_StampCtx* ctx) {
+    SkRasterPipelineStamp(ctx);
+}
+
 STAGE_PP(move_src_dst, Ctx::None) {
     dr = r;
     dg = g;
@@ -4055,6 +4165,7 @@ STAGE_PP(swizzle, void* ctx) {
     NOT_IMPLEMENTED(load_f16_dst)
     NOT_IMPLEMENTED(store_f16)
     NOT_IMPLEMENTED(gather_f16)
+    NOT_IMPLEMENTED(srcover_rgba_f16)
     NOT_IMPLEMENTED(load_af16)
     NOT_IMPLEMENTED(load_af16_dst)
     NOT_IMPLEMENTED(store_af16)
@@ -4088,9 +4199,11 @@ STAGE_PP(swizzle, void* ctx) {
     NOT_IMPLEMENTED(matrix_4x3)
     NOT_IMPLEMENTED(parametric)
     NOT_IMPLEMENTED(gamma_)
+    NOT_IMPLEMENTED(tf_lut)
     NOT_IMPLEMENTED(PQish)
     NOT_IMPLEMENTED(HLGish)
     NOT_IMPLEMENTED(HLGinvish)
+    NOT_IMPLEMENTED(clut_3d)
     NOT_IMPLEMENTED(rgb_to_hsl)
     NOT_IMPLEMENTED(hsl_to_rgb)
     NOT_IMPLEMENTED(gauss_a_to_rgba)
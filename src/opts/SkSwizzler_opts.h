@@ -1384,6 +1384,121 @@ static void RGB_to_BGR1_portable(uint32_t dst[], const uint8_t* src, int count)
     }
 #endif
 
+// Pixel converters for SkConvertPixels' swizzle-free RGBA_F16 and 1010102 fast paths. The
+// half<->float steps are written on skvx so they lower to F16C / NEON conversion instructions
+// when this header is compiled for those instruction sets; the 1010102 repacks are
+// integer-only and autovectorize.
+
+/*not static*/ inline void RGBA_to_F16(uint64_t dst[], const uint32_t* src, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // 4 pixels = 16 unorm8 channels; widen to [0,1] floats and narrow to halfs.
+        auto px = skvx::cast<float>(skvx::Vec<16,uint8_t>::Load(src + i)) * (1/255.0f);
+        skvx::to_half(px).store(dst + i);
+    }
+    for (; i < count; i++) {
+        auto px = skvx::cast<float>(skvx::Vec<4,uint8_t>::Load(src + i)) * (1/255.0f);
+        skvx::to_half(px).store(dst + i);
+    }
+}
+
+/*not static*/ inline void F16_to_RGBA(uint32_t dst[], const uint64_t* src, int count) {
+    auto narrow = [](skvx::Vec<16,uint16_t> halfs, uint32_t* dst4) {
+        // Clamp to [0,1] like the pipeline's gamut clamp, then round to unorm8.
+        auto px = skvx::from_half(halfs);
+        px = skvx::max(0.0f, skvx::min(px, 1.0f));
+        skvx::cast<uint8_t>(px * 255.0f + 0.5f).store(dst4);
+    };
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        narrow(skvx::Vec<16,uint16_t>::Load(src + i), dst + i);
+    }
+    if (i < count) {
+        uint64_t tmpSrc[4] = {0, 0, 0, 0};
+        uint32_t tmpDst[4];
+        memcpy(tmpSrc, src + i, (count - i) * sizeof(uint64_t));
+        narrow(skvx::Vec<16,uint16_t>::Load(tmpSrc), tmpDst);
+        memcpy(dst + i, tmpDst, (count - i) * sizeof(uint32_t));
+    }
+}
+
+/*not static*/ inline void RGBA_to_1010102(uint32_t dst[], const uint32_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        uint32_t r = (src[i] >>  0) & 0xFF,
+                 g = (src[i] >>  8) & 0xFF,
+                 b = (src[i] >> 16) & 0xFF,
+                 a = (src[i] >> 24);
+        // These divisions match round(x * (2^bits - 1) / 255.0f) exactly, and compile down to
+        // multiply-and-shift.
+        r = (r * 1023 + 127) / 255;
+        g = (g * 1023 + 127) / 255;
+        b = (b * 1023 + 127) / 255;
+        a = (a *    3 + 127) / 255;
+        dst[i] = (uint32_t)r <<  0
+               | (uint32_t)g << 10
+               | (uint32_t)b << 20
+               | (uint32_t)a << 30;
+    }
+}
+
+/*not static*/ inline void RGBA_1010102_to_RGBA(uint32_t dst[], const uint32_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        uint32_t r = (src[i] >>  0) & 0x3FF,
+                 g = (src[i] >> 10) & 0x3FF,
+                 b = (src[i] >> 20) & 0x3FF,
+                 a = (src[i] >> 30);
+        r = (r * 255 + 511) / 1023;
+        g = (g * 255 + 511) / 1023;
+        b = (b * 255 + 511) / 1023;
+        dst[i] = r <<  0
+               | g <<  8
+               | b << 16
+               | (a * 0x55) << 24;
+    }
+}
+
+// Strided 32-bit pixel copy for SkSwizzler's sampled (subset/scaled) decodes: takes one pixel
+// every deltaSrc bytes. The wide source row streams through the cache exactly once, so each
+// path prefetches a handful of samples ahead (prefetch never faults, even past the row end).
+/*not static*/ inline void sample_u32(uint32_t dst[], const uint8_t* src, int deltaSrc,
+                                      int count) {
+    int i = 0;
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+    // Gather 8 samples per iteration using byte offsets (gather scale = 1).
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_set1_epi32(deltaSrc),
+                                               _mm256_setr_epi32(0,1,2,3,4,5,6,7));
+    for (; i + 8 <= count; i += 8) {
+        SK_PREFETCH(src + (size_t)(i + 16) * deltaSrc);
+        __m256i px = _mm256_i32gather_epi32((const int*)(src + (size_t)i * deltaSrc),
+                                            offsets, 1);
+        _mm256_storeu_si256((__m256i*)(dst + i), px);
+    }
+#elif defined(SK_ARM_HAS_NEON)
+    // No gather on NEON; fill a register with lane loads so the stores still go out 128 bits
+    // at a time.
+    for (; i + 4 <= count; i += 4) {
+        SK_PREFETCH(src + (size_t)(i + 16) * deltaSrc);
+        uint32x4_t px = vdupq_n_u32(0);
+        px = vld1q_lane_u32((const uint32_t*)(src + (size_t)(i+0) * deltaSrc), px, 0);
+        px = vld1q_lane_u32((const uint32_t*)(src + (size_t)(i+1) * deltaSrc), px, 1);
+        px = vld1q_lane_u32((const uint32_t*)(src + (size_t)(i+2) * deltaSrc), px, 2);
+        px = vld1q_lane_u32((const uint32_t*)(src + (size_t)(i+3) * deltaSrc), px, 3);
+        vst1q_u32(dst + i, px);
+    }
+#else
+    for (; i + 4 <= count; i += 4) {
+        SK_PREFETCH(src + (size_t)(i + 16) * deltaSrc);
+        memcpy(dst + i + 0, src + (size_t)(i+0) * deltaSrc, 4);
+        memcpy(dst + i + 1, src + (size_t)(i+1) * deltaSrc, 4);
+        memcpy(dst + i + 2, src + (size_t)(i+2) * deltaSrc, 4);
+        memcpy(dst + i + 3, src + (size_t)(i+3) * deltaSrc, 4);
+    }
+#endif
+    for (; i < count; i++) {
+        memcpy(dst + i, src + (size_t)i * deltaSrc, 4);
+    }
+}
+
 }  // namespace SK_OPTS_NS
 
 #endif // SkSwizzler_opts_DEFINED
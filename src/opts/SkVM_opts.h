@@ -235,10 +235,19 @@ namespace SK_OPTS_NS {
                     CASE(Op::sub_i32): r[d].i32 = r[x].i32 - r[y].i32; break;
                     CASE(Op::mul_i32): r[d].i32 = r[x].i32 * r[y].i32; break;
 
+                    CASE(Op::mul_hi_u32): r[d].u32 = skvx::cast<uint32_t>(
+                                                       skvx::cast<uint64_t>(r[x].u32) *
+                                                       skvx::cast<uint64_t>(r[y].u32) >> 32);
+                                          break;
+
                     CASE(Op::shl_i32): r[d].i32 = r[x].i32 << immA; break;
                     CASE(Op::sra_i32): r[d].i32 = r[x].i32 >> immA; break;
                     CASE(Op::shr_i32): r[d].u32 = r[x].u32 >> immA; break;
 
+                    CASE(Op::rotr_i32): r[d].u32 = r[x].u32 >> immA
+                                                 | r[x].u32 << (32-immA);
+                                        break;
+
                     CASE(Op:: eq_f32): r[d].i32 = r[x].f32 == r[y].f32; break;
                     CASE(Op::neq_f32): r[d].i32 = r[x].f32 != r[y].f32; break;
                     CASE(Op:: gt_f32): r[d].i32 = r[x].f32 >  r[y].f32; break;
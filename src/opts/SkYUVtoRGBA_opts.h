@@ -0,0 +1,83 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkYUVtoRGBA_opts_DEFINED
+#define SkYUVtoRGBA_opts_DEFINED
+
+#include "include/private/SkTPin.h"
+#include "include/private/SkVx.h"
+#include "src/core/SkYUVMath.h"
+
+namespace SK_OPTS_NS {
+
+// Converts one row of 8-bit 4:2:0 YUV to premultiplied opaque RGBA_8888 in a single fused
+// pass: the color-space matrix (with the limited/full range expansion folded in) comes
+// pre-scaled in coeffs and each chroma sample is upsampled across its two pixels. chromaStep
+// is 1 when u and v are planar rows (I420) and 2 when they point at the first U and V byte of
+// an interleaved UV row (NV12).
+static void yuv_to_rgba_row(uint32_t* dst,
+                            const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                            int chromaStep, int width,
+                            const SkYUVtoRGBACoeffs& coeffs) {
+    constexpr int kBits = SkYUVtoRGBACoeffs::kFractionBits;
+    const int32_t yR = coeffs.fCoeff[0][0], uR = coeffs.fCoeff[0][1], vR = coeffs.fCoeff[0][2];
+    const int32_t yG = coeffs.fCoeff[1][0], uG = coeffs.fCoeff[1][1], vG = coeffs.fCoeff[1][2];
+    const int32_t yB = coeffs.fCoeff[2][0], uB = coeffs.fCoeff[2][1], vB = coeffs.fCoeff[2][2];
+
+    using I32x8  = skvx::Vec< 8, int32_t>;
+    using I32x16 = skvx::Vec<16, int32_t>;
+
+    int x = 0;
+    // Eight chroma samples feed sixteen pixels per iteration.
+    for (; x + 16 <= width; x += 16) {
+        I32x8 u8, v8;
+        if (chromaStep == 1) {
+            u8 = skvx::cast<int32_t>(skvx::Vec<8, uint8_t>::Load(u + x/2));
+            v8 = skvx::cast<int32_t>(skvx::Vec<8, uint8_t>::Load(v + x/2));
+        } else {
+            auto uv = skvx::cast<int32_t>(skvx::Vec<16, uint8_t>::Load(u + x));
+            u8 = skvx::shuffle<0,2,4,6,8,10,12,14>(uv);
+            v8 = skvx::shuffle<1,3,5,7,9,11,13,15>(uv);
+        }
+
+        // Per-chroma-sample contributions, then each lane duplicated across its two pixels.
+        I32x8 rc = uR*u8 + vR*v8 + coeffs.fBias[0];
+        I32x8 gc = uG*u8 + vG*v8 + coeffs.fBias[1];
+        I32x8 bc = uB*u8 + vB*v8 + coeffs.fBias[2];
+        auto dup = [](const I32x8& c) {
+            return skvx::join(skvx::shuffle<0,0,1,1,2,2,3,3>(c),
+                              skvx::shuffle<4,4,5,5,6,6,7,7>(c));
+        };
+
+        I32x16 y16 = skvx::cast<int32_t>(skvx::Vec<16, uint8_t>::Load(y + x));
+        I32x16 r = skvx::pin((yR*y16 + dup(rc)) >> kBits, I32x16(0), I32x16(255));
+        I32x16 g = skvx::pin((yG*y16 + dup(gc)) >> kBits, I32x16(0), I32x16(255));
+        I32x16 b = skvx::pin((yB*y16 + dup(bc)) >> kBits, I32x16(0), I32x16(255));
+
+        auto rgba = skvx::cast<uint32_t>(r)
+                  | skvx::cast<uint32_t>(g) <<  8
+                  | skvx::cast<uint32_t>(b) << 16
+                  | (uint32_t)0xFF << 24;
+        rgba.store(dst + x);
+    }
+    for (; x < width; ++x) {
+        const int32_t Y = y[x];
+        const int32_t U = u[(x/2)*chromaStep];
+        const int32_t V = v[(x/2)*chromaStep];
+        const int32_t r = SkTPin((yR*Y + uR*U + vR*V + coeffs.fBias[0]) >> kBits, 0, 255);
+        const int32_t g = SkTPin((yG*Y + uG*U + vG*V + coeffs.fBias[1]) >> kBits, 0, 255);
+        const int32_t b = SkTPin((yB*Y + uB*U + vB*V + coeffs.fBias[2]) >> kBits, 0, 255);
+        dst[x] = (uint32_t)0xFF << 24
+               | (uint32_t)   b << 16
+               | (uint32_t)   g <<  8
+               | (uint32_t)   r <<  0;
+    }
+}
+
+}  // namespace SK_OPTS_NS
+
+#endif  // SkYUVtoRGBA_opts_DEFINED
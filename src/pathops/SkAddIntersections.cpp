@@ -277,6 +277,11 @@ bool AddIntersectTs(SkOpContour* test, SkOpContour* next, SkOpCoincidence* coinc
             continue;
         }
         do {
+            // Each segment pair examined counts against the op's budget (when one was set);
+            // stopping early leaves the op incomplete, which the caller reports as failure.
+            if (!test->globalState()->chargeBudget(1)) {
+                return false;
+            }
             if (!SkPathOpsBounds::Intersects(wt.bounds(), wn.bounds())) {
                 continue;
             }
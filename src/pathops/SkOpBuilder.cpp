@@ -7,8 +7,10 @@
 
 #include "include/core/SkMatrix.h"
 #include "include/pathops/SkPathOps.h"
+#include "include/private/SkTemplates.h"
 #include "src/core/SkArenaAlloc.h"
 #include "src/core/SkPathPriv.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/pathops/SkOpEdgeBuilder.h"
 #include "src/pathops/SkPathOpsCommon.h"
 
@@ -52,9 +54,9 @@ bool SkOpBuilder::FixWinding(SkPath* path) {
             return true;
         }
     }
-    SkSTArenaAlloc<4096> allocator;
+    SkOpScratchAllocator allocator;
     SkOpContourHead contourHead;
-    SkOpGlobalState globalState(&contourHead, &allocator  SkDEBUGPARAMS(false)
+    SkOpGlobalState globalState(&contourHead, allocator.allocator()  SkDEBUGPARAMS(false)
             SkDEBUGPARAMS(nullptr));
     SkOpEdgeBuilder builder(*path, &contourHead, &globalState);
     if (builder.unparseable() || !builder.finish()) {
@@ -126,6 +128,10 @@ void SkOpBuilder::reset() {
    paths with union ops could be locally resolved and still improve over doing the
    ops one at a time. */
 bool SkOpBuilder::resolve(SkPath* result) {
+    return this->resolve(result, nullptr);
+}
+
+bool SkOpBuilder::resolve(SkPath* result, SkExecutor* executor) {
     SkPath original = *result;
     int count = fOps.count();
     bool allUnion = true;
@@ -172,13 +178,34 @@ bool SkOpBuilder::resolve(SkPath* result) {
         reset();
         return true;
     }
+    // Each path's simplification pass is independent of the others, so when the caller
+    // supplied an executor run them on its threads. The winding fix-up and final combine
+    // below stay on the calling thread.
+    if (executor != nullptr && count > 1) {
+        SkAutoSTMalloc<16, bool> simplified(count);
+        SkTaskGroup taskGroup(*executor);
+        taskGroup.batch(count, [&](int index) {
+            simplified[index] = Simplify(fPathRefs[index], &fPathRefs[index]);
+        });
+        taskGroup.wait();
+        for (int index = 0; index < count; ++index) {
+            if (!simplified[index]) {
+                reset();
+                *result = original;
+                return false;
+            }
+        }
+    } else {
+        for (int index = 0; index < count; ++index) {
+            if (!Simplify(fPathRefs[index], &fPathRefs[index])) {
+                reset();
+                *result = original;
+                return false;
+            }
+        }
+    }
     SkPath sum;
     for (int index = 0; index < count; ++index) {
-        if (!Simplify(fPathRefs[index], &fPathRefs[index])) {
-            reset();
-            *result = original;
-            return false;
-        }
         if (!fPathRefs[index].isEmpty()) {
             // convert the even odd result back to winding form before accumulating it
             if (!FixWinding(&fPathRefs[index])) {
@@ -273,13 +273,17 @@ public:
         SkDEBUGCODE(fDebugIndent -= 2);
     }
 
-    void rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit** hits, SkArenaAlloc*);
+    void rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkTDArray<SkOpRayHit>* hits);
 
     void reset() {
         fTail = nullptr;
         fNext = nullptr;
         fCount = 0;
         fDone = false;
+        fRaySegments.reset();
+        for (int side = 0; side < 4; ++side) {
+            fRayBounds[side].reset();
+        }
         SkDEBUGCODE(fBounds.setLTRB(SK_ScalarMax, SK_ScalarMax, SK_ScalarMin, SK_ScalarMin));
         SkDEBUGCODE(fFirstSorted = -1);
         SkDEBUGCODE(fDebugIndent = 0);
@@ -374,6 +378,10 @@ protected:
     SkOpSegment fHead;
     SkOpSegment* fTail;
     SkOpContour* fNext;
+    // per-segment bounds in SkRect field order, kept parallel to fRaySegments so that
+    // rayCheck can reject segments with a flat scan instead of walking the segment list
+    SkTDArray<SkScalar> fRayBounds[4];
+    SkTDArray<SkOpSegment*> fRaySegments;
     SkPathOpsBounds fBounds;
     int fCcw;
     int fCount;
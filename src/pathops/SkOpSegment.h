@@ -20,6 +20,7 @@ class SkOpContour;
 enum class SkOpRayDir;
 struct SkOpRayHit;
 class SkPathWriter;
+template <typename T> class SkTDArray;
 
 class SkOpSegment {
 public:
@@ -330,7 +331,7 @@ public:
 
     bool ptsDisjoint(double t1, const SkPoint& pt1, double t2, const SkPoint& pt2) const;
 
-    void rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit** hits, SkArenaAlloc*);
+    void rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkTDArray<SkOpRayHit>* hits);
     void release(const SkOpSpan* );
 
 #if DEBUG_COIN
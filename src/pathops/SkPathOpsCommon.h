@@ -23,7 +23,7 @@ SkOpSpan* FindUndone(SkOpContourHead* );
 bool FixWinding(SkPath* path);
 bool SortContourList(SkOpContourHead** , bool evenOdd, bool oppEvenOdd);
 bool HandleCoincidence(SkOpContourHead* , SkOpCoincidence* );
-bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result
+bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result, int budget
              SkDEBUGPARAMS(bool skipAssert)
              SkDEBUGPARAMS(const char* testName));
 
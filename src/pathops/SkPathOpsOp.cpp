@@ -4,6 +4,9 @@
  * Use of this source code is governed by a BSD-style license that can be
  * found in the LICENSE file.
  */
+#include "include/core/SkMatrix.h"
+#include "include/core/SkRegion.h"
+#include "include/private/SkMallocTag.h"
 #include "src/pathops/SkAddIntersections.h"
 #include "src/pathops/SkOpCoincidence.h"
 #include "src/pathops/SkOpEdgeBuilder.h"
@@ -236,8 +239,9 @@ extern void (*gVerboseFinalize)();
 
 #endif
 
-bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result
+bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result, int budget
         SkDEBUGPARAMS(bool skipAssert) SkDEBUGPARAMS(const char* testName)) {
+    SkAutoMallocTag autoTag(SkMallocTag::kPathOps);
 #if DEBUG_DUMP_VERIFY
 #ifndef SK_DEBUG
     const char* testName = "release";
@@ -286,11 +290,12 @@ bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result
         }
         return Simplify(work, result);
     }
-    SkSTArenaAlloc<4096> allocator;  // FIXME: add a constant expression here, tune
+    SkOpScratchAllocator allocator;
     SkOpContour contour;
     SkOpContourHead* contourList = static_cast<SkOpContourHead*>(&contour);
-    SkOpGlobalState globalState(contourList, &allocator
+    SkOpGlobalState globalState(contourList, allocator.allocator()
             SkDEBUGPARAMS(skipAssert) SkDEBUGPARAMS(testName));
+    globalState.setBudget(budget);
     SkOpCoincidence coincidence(&globalState);
     const SkPath* minuend = &one;
     const SkPath* subtrahend = &two;
@@ -331,6 +336,9 @@ bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result
                 && (next = next->next()))
             ;
     } while ((current = current->next()));
+    if (globalState.budgetExceeded()) {
+        return false;
+    }
 #if DEBUG_VALIDATE
     globalState.setPhase(SkOpPhase::kWalking);
 #endif
@@ -370,7 +378,7 @@ bool OpDebug(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result
 bool Op(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result) {
 #if DEBUG_DUMP_VERIFY
     if (SkPathOpsDebug::gVerifyOp) {
-        if (!OpDebug(one, two, op, result  SkDEBUGPARAMS(false) SkDEBUGPARAMS(nullptr))) {
+        if (!OpDebug(one, two, op, result, 0  SkDEBUGPARAMS(false) SkDEBUGPARAMS(nullptr))) {
             SkPathOpsDebug::ReportOpFail(one, two, op);
             return false;
         }
@@ -378,5 +386,67 @@ bool Op(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result) {
         return true;
     }
 #endif
-    return OpDebug(one, two, op, result  SkDEBUGPARAMS(true) SkDEBUGPARAMS(nullptr));
+    return OpDebug(one, two, op, result, 0  SkDEBUGPARAMS(true) SkDEBUGPARAMS(nullptr));
+}
+
+// Rasterizes both operands into SkRegions on a grid 'resolution' times finer than the paths'
+// coordinate space, applies the region boolean, and converts the boundary back to a path.
+static bool op_as_region(const SkPath& one, const SkPath& two, SkPathOp op, SkScalar resolution,
+                         SkPath* result) {
+    static_assert((int)kDifference_SkPathOp        == (int)SkRegion::kDifference_Op, "");
+    static_assert((int)kIntersect_SkPathOp         == (int)SkRegion::kIntersect_Op, "");
+    static_assert((int)kUnion_SkPathOp             == (int)SkRegion::kUnion_Op, "");
+    static_assert((int)kXOR_SkPathOp               == (int)SkRegion::kXOR_Op, "");
+    static_assert((int)kReverseDifference_SkPathOp == (int)SkRegion::kReverseDifference_Op, "");
+
+    if (!(resolution > 0) || one.isInverseFillType() || two.isInverseFillType()) {
+        return false;
+    }
+    SkRect bounds = one.getBounds();
+    bounds.join(two.getBounds());
+    const SkMatrix toGrid = SkMatrix::Scale(resolution, resolution);
+    SkRect gridBounds;
+    toGrid.mapRect(&gridBounds, bounds);
+    SkIRect clipBounds;
+    gridBounds.roundOut(&clipBounds);
+    if (gridBounds.width() >= (float)SK_MaxS32 || gridBounds.height() >= (float)SK_MaxS32) {
+        return false;
+    }
+    SkPath oneGrid, twoGrid;
+    one.transform(toGrid, &oneGrid);
+    two.transform(toGrid, &twoGrid);
+    SkRegion clip, regionOne, regionTwo;
+    clip.setRect(clipBounds.makeOutset(1, 1));
+    regionOne.setPath(oneGrid, clip);
+    regionTwo.setPath(twoGrid, clip);
+    regionOne.op(regionTwo, (SkRegion::Op)op);
+    SkPath boundary;
+    regionOne.getBoundaryPath(&boundary);
+    boundary.transform(SkMatrix::Scale(1 / resolution, 1 / resolution), result);
+    return true;
+}
+
+bool OpBudgeted(const SkPath& one, const SkPath& two, SkPathOp op, SkPath* result, int budget,
+                SkScalar resolution, bool* wasApproximated) {
+    if (wasApproximated) {
+        *wasApproximated = false;
+    }
+    if (budget <= 0) {
+        return Op(one, two, op, result);
+    }
+    SkPath exact;
+    if (OpDebug(one, two, op, &exact, budget  SkDEBUGPARAMS(true) SkDEBUGPARAMS(nullptr))) {
+        *result = exact;
+        return true;
+    }
+    // The exact op gave up -- on the budget or on the input itself -- so scan-convert instead.
+    SkPath approx;
+    if (!op_as_region(one, two, op, resolution, &approx)) {
+        return false;
+    }
+    if (wasApproximated) {
+        *wasApproximated = true;
+    }
+    *result = approx;
+    return true;
 }
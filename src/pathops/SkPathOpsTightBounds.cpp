@@ -44,10 +44,10 @@ bool TightBounds(const SkPath& path, SkRect* result) {
         *result = path.getBounds();
         return true;
     }
-    SkSTArenaAlloc<4096> allocator;  // FIXME: constant-ize, tune
+    SkOpScratchAllocator allocator;
     SkOpContour contour;
     SkOpContourHead* contourList = static_cast<SkOpContourHead*>(&contour);
-    SkOpGlobalState globalState(contourList, &allocator  SkDEBUGPARAMS(false)
+    SkOpGlobalState globalState(contourList, allocator.allocator()  SkDEBUGPARAMS(false)
             SkDEBUGPARAMS(nullptr));
     // turn path into list of segments
     SkOpEdgeBuilder builder(path, contourList, &globalState);
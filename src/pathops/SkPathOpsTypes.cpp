@@ -5,7 +5,10 @@
  * found in the LICENSE file.
  */
 #include "include/private/SkFloatBits.h"
+#include "include/private/SkMalloc.h"
 #include "src/core/SkArenaAlloc.h"
+
+#include <algorithm>
 #include "src/pathops/SkOpCoincidence.h"
 #include "src/pathops/SkPathOpsTypes.h"
 
@@ -253,3 +256,67 @@ SkOpGlobalState::SkOpGlobalState(SkOpContourHead* head,
     fPreviousFuncName = nullptr;
 #endif
 }
+
+namespace {
+
+// Per-thread scratch block retained between pathops operations; see SkOpScratchAllocator.
+struct ThreadScratch {
+    char* fBlock = nullptr;
+    size_t fSize = 0;
+    size_t fNextSize = 0;  // pending growth, applied on the next acquire
+    bool fInUse = false;
+
+    ~ThreadScratch() { sk_free(fBlock); }
+};
+
+thread_local ThreadScratch gThreadScratch;
+
+constexpr size_t kMinRetainedSize = 16 * 1024;
+constexpr size_t kMaxRetainedSize = 1024 * 1024;
+
+}  // namespace
+
+SkOpScratchAllocator::SkOpScratchAllocator()
+    : fThreadBlock(AcquireThreadBlock(&fThreadBlockSize))
+    , fArena(fThreadBlock ? fThreadBlock : fInlineBlock,
+             fThreadBlock ? fThreadBlockSize : sizeof(fInlineBlock),
+             fThreadBlock ? fThreadBlockSize : sizeof(fInlineBlock)) {
+}
+
+SkOpScratchAllocator::~SkOpScratchAllocator() {
+    // fArena's destructor runs after this body and still reads the backing block, so the
+    // thread block is only marked available here; replacement waits for the next acquire.
+    ReleaseThreadBlock(fThreadBlock, fArena.hasOverflowed());
+}
+
+char* SkOpScratchAllocator::AcquireThreadBlock(size_t* size) {
+    ThreadScratch& scratch = gThreadScratch;
+    if (scratch.fInUse) {  // an enclosing operation already holds the block
+        return nullptr;
+    }
+    if (scratch.fNextSize > scratch.fSize) {
+        sk_free(scratch.fBlock);
+        scratch.fBlock = static_cast<char*>(sk_malloc_throw(scratch.fNextSize));
+        scratch.fSize = scratch.fNextSize;
+    }
+    if (!scratch.fBlock) {
+        return nullptr;
+    }
+    scratch.fInUse = true;
+    *size = scratch.fSize;
+    return scratch.fBlock;
+}
+
+void SkOpScratchAllocator::ReleaseThreadBlock(char* block, bool overflowed) {
+    ThreadScratch& scratch = gThreadScratch;
+    if (block) {
+        SkASSERT(scratch.fInUse && block == scratch.fBlock);
+        scratch.fInUse = false;
+        if (overflowed && scratch.fSize < kMaxRetainedSize) {
+            scratch.fNextSize = std::min(scratch.fSize * 2, kMaxRetainedSize);
+        }
+    } else if (overflowed && !scratch.fBlock && !scratch.fInUse) {
+        // The inline block did not cover the operation; start retaining a per-thread block.
+        scratch.fNextSize = kMinRetainedSize;
+    }
+}
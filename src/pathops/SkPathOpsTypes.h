@@ -14,6 +14,7 @@
 #include "include/pathops/SkPathOps.h"
 #include "include/private/SkFloatingPoint.h"
 #include "include/private/SkSafe_math.h"
+#include "src/core/SkArenaAlloc.h"
 #include "src/pathops/SkPathOpsDebug.h"
 
 enum SkPathOpsMask {
@@ -22,7 +23,6 @@ enum SkPathOpsMask {
     kEvenOdd_PathOpsMask = 1
 };
 
-class SkArenaAlloc;
 class SkOpCoincidence;
 class SkOpContour;
 class SkOpContourHead;
@@ -180,11 +180,30 @@ public:
         return fWindingFailed;
     }
 
+    // a budget of zero (the default) means the op may run unbounded
+    void setBudget(int budget) {
+        fBudget = budget;
+    }
+
+    // deducts amount from the budget; returns false once the budget is spent
+    bool chargeBudget(int amount) {
+        if (fBudget > 0 && (fBudgetSpent += amount) > fBudget) {
+            return false;
+        }
+        return true;
+    }
+
+    bool budgetExceeded() const {
+        return fBudget > 0 && fBudgetSpent > fBudget;
+    }
+
 private:
     SkArenaAlloc* fAllocator;
     SkOpCoincidence* fCoincidence;
     SkOpContourHead* fContourHead;
     int fNested;
+    int fBudget = 0;
+    int fBudgetSpent = 0;
     bool fAllocatedOpSpan;
     bool fWindingFailed;
     SkOpPhase fPhase;
@@ -216,6 +235,35 @@ private:
 #endif
 };
 
+// Scratch storage for the arena handed to SkOpGlobalState over one pathops operation.
+// Small operations run entirely out of the inline block, matching the per-call
+// SkSTArenaAlloc this replaces. Operations that outgrow it promote a per-thread block
+// which is retained between calls and doubled toward the high-water mark of the thread's
+// past operations, so callers issuing many ops back to back stop paying the per-call
+// block ramp-up. If the thread's block is already held by an enclosing operation, the
+// arena falls back to the inline block plus ordinary heap growth.
+class SkOpScratchAllocator {
+public:
+    SkOpScratchAllocator();
+    ~SkOpScratchAllocator();
+
+    SkOpScratchAllocator(const SkOpScratchAllocator&) = delete;
+    SkOpScratchAllocator& operator=(const SkOpScratchAllocator&) = delete;
+
+    SkArenaAlloc* allocator() { return &fArena; }
+
+private:
+    static char* AcquireThreadBlock(size_t* size);
+    static void ReleaseThreadBlock(char* block, bool overflowed);
+
+    static constexpr size_t kInlineStorage = 4096;  // covers typical one-shot operations
+
+    size_t fThreadBlockSize = 0;
+    char* fThreadBlock;  // non-null while this operation holds the thread's block
+    char fInlineBlock[kInlineStorage];
+    SkArenaAllocWithReset fArena;
+};
+
 #ifdef SK_DEBUG
 #if DEBUG_COINCIDENCE
 #define SkOPASSERT(cond) SkASSERT((this->globalState() && \
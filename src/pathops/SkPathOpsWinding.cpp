@@ -68,11 +68,6 @@ static SkScalar rect_side(const SkRect& r, SkOpRayDir dir) {
     return (&r.fLeft)[static_cast<int>(dir)];
 }
 
-static bool sideways_overlap(const SkRect& rect, const SkPoint& pt, SkOpRayDir dir) {
-    int i = !xy_index(dir);
-    return approximately_between((&rect.fLeft)[i], (&pt.fX)[i], (&rect.fRight)[i]);
-}
-
 static bool less_than(SkOpRayDir dir) {
     return static_cast<bool>((static_cast<int>(dir) & 2) == 0);
 }
@@ -85,7 +80,6 @@ static bool ccw_dxdy(const SkDVector& v, SkOpRayDir dir) {
 
 struct SkOpRayHit {
     SkOpRayDir makeTestBase(SkOpSpan* span, double t) {
-        fNext = nullptr;
         fSpan = span;
         fT = span->t() * (1 - t) + span->next()->t() * t;
         SkOpSegment* segment = span->segment();
@@ -95,7 +89,6 @@ struct SkOpRayHit {
         return fabs(fSlope.fX) < fabs(fSlope.fY) ? SkOpRayDir::kLeft : SkOpRayDir::kTop;
     }
 
-    SkOpRayHit* fNext;
     SkOpSpan* fSpan;
     SkPoint fPt;
     double fT;
@@ -103,8 +96,7 @@ struct SkOpRayHit {
     bool fValid;
 };
 
-void SkOpContour::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit** hits,
-                           SkArenaAlloc* allocator) {
+void SkOpContour::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkTDArray<SkOpRayHit>* hits) {
     // if the bounds extreme is outside the best, we're done
     SkScalar baseXY = pt_xy(base.fPt, dir);
     SkScalar boundsXY = rect_side(fBounds, dir);
@@ -112,23 +104,48 @@ void SkOpContour::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit**
     if (!approximately_equal(baseXY, boundsXY) && (baseXY < boundsXY) == checkLessThan) {
         return;
     }
-    SkOpSegment* testSegment = &fHead;
-    do {
-        testSegment->rayCheck(base, dir, hits, allocator);
-    } while ((testSegment = testSegment->next()));
+    if (fRaySegments.count() != fCount) {
+        // segments are only appended after the last rebuild, so a count mismatch is the
+        // only staleness to check for
+        fRaySegments.setCount(fCount);
+        for (int side = 0; side < 4; ++side) {
+            fRayBounds[side].setCount(fCount);
+        }
+        SkOpSegment* segment = &fHead;
+        int i = 0;
+        do {
+            const SkPathOpsBounds& segBounds = segment->bounds();
+            fRayBounds[0][i] = segBounds.fLeft;
+            fRayBounds[1][i] = segBounds.fTop;
+            fRayBounds[2][i] = segBounds.fRight;
+            fRayBounds[3][i] = segBounds.fBottom;
+            fRaySegments[i] = segment;
+            ++i;
+        } while ((segment = segment->next()));
+        SkASSERT(i == fCount);
+    }
+    // scan the parallel bounds arrays to reject segments the ray cannot hit; this keeps
+    // the hot rejection test out of the pointer-chased segment list
+    int sideIndex = !xy_index(dir);
+    const SkScalar* nearSide = fRayBounds[sideIndex].begin();
+    const SkScalar* farSide = fRayBounds[sideIndex + 2].begin();
+    const SkScalar* dirSide = fRayBounds[static_cast<int>(dir)].begin();
+    SkScalar baseYX = pt_yx(base.fPt, dir);
+    for (int i = 0; i < fCount; ++i) {
+        if (!approximately_between(nearSide[i], baseYX, farSide[i])) {
+            continue;
+        }
+        if (!approximately_equal(baseXY, dirSide[i]) && (baseXY < dirSide[i]) == checkLessThan) {
+            continue;
+        }
+        fRaySegments[i]->rayCheck(base, dir, hits);
+    }
 }
 
-void SkOpSegment::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit** hits,
-                           SkArenaAlloc* allocator) {
-    if (!sideways_overlap(fBounds, base.fPt, dir)) {
-        return;
-    }
+void SkOpSegment::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkTDArray<SkOpRayHit>* hits) {
+    // the caller already rejected this segment's bounds against the ray
     SkScalar baseXY = pt_xy(base.fPt, dir);
-    SkScalar boundsXY = rect_side(fBounds, dir);
     bool checkLessThan = less_than(dir);
-    if (!approximately_equal(baseXY, boundsXY) && (baseXY < boundsXY) == checkLessThan) {
-        return;
-    }
     double tVals[3];
     SkScalar baseYX = pt_yx(base.fPt, dir);
     int roots = (*CurveIntercept[fVerb * 2 + xy_index(dir)])(fPts, fWeight, baseYX, tVals);
@@ -177,14 +194,12 @@ void SkOpSegment::rayCheck(const SkOpRayHit& base, SkOpRayDir dir, SkOpRayHit**
         } else if (!span->windValue() && !span->oppValue()) {
             continue;
         }
-        SkOpRayHit* newHit = allocator->make<SkOpRayHit>();
-        newHit->fNext = *hits;
+        SkOpRayHit* newHit = hits->append();
         newHit->fPt = pt;
         newHit->fSlope = slope;
         newHit->fSpan = span;
         newHit->fT = t;
         newHit->fValid = valid;
-        *hits = newHit;
     }
 }
 
@@ -203,20 +218,20 @@ SkOpSpan* SkOpSegment::windingSpanAtT(double tHit) {
     return nullptr;
 }
 
-static bool hit_compare_x(const SkOpRayHit* a, const SkOpRayHit* b) {
-    return a->fPt.fX < b->fPt.fX;
+static bool hit_compare_x(const SkOpRayHit& a, const SkOpRayHit& b) {
+    return a.fPt.fX < b.fPt.fX;
 }
 
-static bool reverse_hit_compare_x(const SkOpRayHit* a, const SkOpRayHit* b) {
-    return b->fPt.fX  < a->fPt.fX;
+static bool reverse_hit_compare_x(const SkOpRayHit& a, const SkOpRayHit& b) {
+    return b.fPt.fX  < a.fPt.fX;
 }
 
-static bool hit_compare_y(const SkOpRayHit* a, const SkOpRayHit* b) {
-    return a->fPt.fY < b->fPt.fY;
+static bool hit_compare_y(const SkOpRayHit& a, const SkOpRayHit& b) {
+    return a.fPt.fY < b.fPt.fY;
 }
 
-static bool reverse_hit_compare_y(const SkOpRayHit* a, const SkOpRayHit* b) {
-    return b->fPt.fY  < a->fPt.fY;
+static bool reverse_hit_compare_y(const SkOpRayHit& a, const SkOpRayHit& b) {
+    return b.fPt.fY  < a.fPt.fY;
 }
 
 static double get_t_guess(int tTry, int* dirOffset) {
@@ -236,7 +251,6 @@ static double get_t_guess(int tTry, int* dirOffset) {
 }
 
 bool SkOpSpan::sortableTop(SkOpContour* contourHead) {
-    SkSTArenaAlloc<1024> allocator;
     int dirOffset;
     double t = get_t_guess(fTopTTry++, &dirOffset);
     SkOpRayHit hitBase;
@@ -244,28 +258,25 @@ bool SkOpSpan::sortableTop(SkOpContour* contourHead) {
     if (hitBase.fSlope.fX == 0 && hitBase.fSlope.fY == 0) {
         return false;
     }
-    SkOpRayHit* hitHead = &hitBase;
     dir = static_cast<SkOpRayDir>(static_cast<int>(dir) + dirOffset);
     if (hitBase.fSpan && hitBase.fSpan->segment()->verb() > SkPath::kLine_Verb
             && !pt_dydx(hitBase.fSlope, dir)) {
         return false;
     }
+    // collect the hits into a flat array; sorting and walking values beats chasing an
+    // allocator-backed list of them
+    SkTDArray<SkOpRayHit> hits;
+    *hits.append() = hitBase;
     SkOpContour* contour = contourHead;
     do {
         if (!contour->count()) {
             continue;
         }
-        contour->rayCheck(hitBase, dir, &hitHead, &allocator);
+        contour->rayCheck(hitBase, dir, &hits);
     } while ((contour = contour->next()));
     // sort hits
-    SkSTArray<1, SkOpRayHit*> sorted;
-    SkOpRayHit* hit = hitHead;
-    while (hit) {
-        sorted.push_back(hit);
-        hit = hit->fNext;
-    }
-    int count = sorted.count();
-    SkTQSort(sorted.begin(), sorted.end(),
+    int count = hits.count();
+    SkTQSort(hits.begin(), hits.end(),
              xy_index(dir) ? less_than(dir) ? hit_compare_y : reverse_hit_compare_y
                            : less_than(dir) ? hit_compare_x : reverse_hit_compare_x);
     // verify windings
@@ -274,7 +285,7 @@ bool SkOpSpan::sortableTop(SkOpContour* contourHead) {
             gDebugRayDirName[static_cast<int>(dir)], hitBase.fSpan->segment()->debugID(),
             hitBase.fT, hitBase.fPt.fX, hitBase.fPt.fY);
     for (int index = 0; index < count; ++index) {
-        hit = sorted[index];
+        const SkOpRayHit* hit = &hits[index];
         SkOpSpan* span = hit->fSpan;
         SkOpSegment* hitSegment = span ? span->segment() : nullptr;
         bool operand = span ? hitSegment->operand() : false;
@@ -292,7 +303,7 @@ bool SkOpSpan::sortableTop(SkOpContour* contourHead) {
     int wind = 0;
     int oppWind = 0;
     for (int index = 0; index < count; ++index) {
-        hit = sorted[index];
+        const SkOpRayHit* hit = &hits[index];
         if (!hit->fValid) {
             return false;
         }
@@ -310,7 +321,7 @@ bool SkOpSpan::sortableTop(SkOpContour* contourHead) {
             return false;
         }
         if (index < count - 1) {
-            const SkPoint& next = sorted[index + 1]->fPt;
+            const SkPoint& next = hits[index + 1].fPt;
             if (SkDPoint::ApproximatelyEqual(next, hit->fPt)) {
                 return false;
             }
@@ -99,12 +99,34 @@ static void emit_image_stream(SkPDFDocument* doc,
     doc->emitStream(pdfDict, std::move(writeStream), ref);
 }
 
-static void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndirectReference ref) {
-    SkDynamicMemoryWStream buffer;
-    SkDeflateWStream deflateWStream(&buffer);
+// As emit_image_stream(), but for a deflated stream whose length is not known in advance:
+// writeStream compresses straight into the document and /Length is written afterward as an
+// indirect object.
+template <typename T>
+static void stream_deflated_image(SkPDFDocument* doc,
+                                  SkPDFIndirectReference ref,
+                                  T writeStream,
+                                  SkISize size,
+                                  const char* colorSpace,
+                                  SkPDFIndirectReference sMask) {
+    SkPDFDict pdfDict("XObject");
+    pdfDict.insertName("Subtype", "Image");
+    pdfDict.insertInt("Width", size.width());
+    pdfDict.insertInt("Height", size.height());
+    pdfDict.insertName("ColorSpace", colorSpace);
+    if (sMask) {
+        pdfDict.insertRef("SMask", sMask);
+    }
+    pdfDict.insertInt("BitsPerComponent", 8);
+    pdfDict.insertName("Filter", "FlateDecode");
+    doc->emitStreamDeferredLength(&pdfDict, std::move(writeStream), ref);
+}
+
+static void write_deflated_alpha(const SkPixmap& pm, SkWStream* out) {
+    SkDeflateWStream deflateWStream(out);
     if (kAlpha_8_SkColorType == pm.colorType()) {
         SkASSERT(pm.rowBytes() == (size_t)pm.width());
-        buffer.write(pm.addr8(), pm.width() * pm.height());
+        deflateWStream.write(pm.addr8(), pm.width() * pm.height());
     } else {
         SkASSERT(pm.alphaType() == kUnpremul_SkAlphaType);
         SkASSERT(pm.colorType() == kBGRA_8888_SkColorType);
@@ -125,6 +147,21 @@ static void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndir
         deflateWStream.write(byteBuffer, dst - byteBuffer);
     }
     deflateWStream.finalize();
+}
+
+static void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndirectReference ref) {
+    #ifndef SK_PDF_BASE85_BINARY
+    if (!doc->executor()) {
+        // Without an executor the document stream is only written from this thread, so the
+        // scanline bands can compress straight into it; this image's peak memory is one band
+        // rather than its whole compressed stream.
+        stream_deflated_image(doc, ref, [&pm](SkWStream* out) { write_deflated_alpha(pm, out); },
+                              pm.info().dimensions(), "DeviceGray", SkPDFIndirectReference());
+        return;
+    }
+    #endif
+    SkDynamicMemoryWStream buffer;
+    write_deflated_alpha(pm, &buffer);
 
     #ifdef SK_PDF_BASE85_BINARY
     SkPDFUtils::Base85Encode(buffer.detachAsStream(), &buffer);
@@ -135,28 +172,17 @@ static void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndir
                       length, false);
 }
 
-static void do_deflated_image(const SkPixmap& pm,
-                              SkPDFDocument* doc,
-                              bool isOpaque,
-                              SkPDFIndirectReference ref) {
-    SkPDFIndirectReference sMask;
-    if (!isOpaque) {
-        sMask = doc->reserveRef();
-    }
-    SkDynamicMemoryWStream buffer;
-    SkDeflateWStream deflateWStream(&buffer);
-    const char* colorSpace = "DeviceGray";
+static void write_deflated_image(const SkPixmap& pm, SkWStream* out) {
+    SkDeflateWStream deflateWStream(out);
     switch (pm.colorType()) {
         case kAlpha_8_SkColorType:
             fill_stream(&deflateWStream, '\x00', pm.width() * pm.height());
             break;
         case kGray_8_SkColorType:
-            SkASSERT(sMask.fValue = -1);
             SkASSERT(pm.rowBytes() == (size_t)pm.width());
             deflateWStream.write(pm.addr8(), pm.width() * pm.height());
             break;
         default:
-            colorSpace = "DeviceRGB";
             SkASSERT(pm.alphaType() == kUnpremul_SkAlphaType);
             SkASSERT(pm.colorType() == kBGRA_8888_SkColorType);
             SkASSERT(pm.rowBytes() == (size_t)pm.width() * 4);
@@ -183,6 +209,32 @@ static void do_deflated_image(const SkPixmap& pm,
             deflateWStream.write(byteBuffer, dst - byteBuffer);
     }
     deflateWStream.finalize();
+}
+
+static void do_deflated_image(const SkPixmap& pm,
+                              SkPDFDocument* doc,
+                              bool isOpaque,
+                              SkPDFIndirectReference ref) {
+    SkPDFIndirectReference sMask;
+    if (!isOpaque) {
+        sMask = doc->reserveRef();
+    }
+    const char* colorSpace = "DeviceGray";
+    if (pm.colorType() != kAlpha_8_SkColorType && pm.colorType() != kGray_8_SkColorType) {
+        colorSpace = "DeviceRGB";
+    }
+    #ifndef SK_PDF_BASE85_BINARY
+    if (!doc->executor()) {
+        stream_deflated_image(doc, ref, [&pm](SkWStream* out) { write_deflated_image(pm, out); },
+                              pm.info().dimensions(), colorSpace, sMask);
+        if (!isOpaque) {
+            do_deflated_alpha(pm, doc, sMask);
+        }
+        return;
+    }
+    #endif
+    SkDynamicMemoryWStream buffer;
+    write_deflated_image(pm, &buffer);
     #ifdef SK_PDF_BASE85_BINARY
     SkPDFUtils::Base85Encode(buffer.detachAsStream(), &buffer);
     #endif
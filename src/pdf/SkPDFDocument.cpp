@@ -8,9 +8,11 @@
 #include "include/docs/SkPDFDocument.h"
 #include "src/pdf/SkPDFDocumentPriv.h"
 
+#include "include/core/SkExecutor.h"
 #include "include/core/SkStream.h"
 #include "include/docs/SkPDFDocument.h"
 #include "include/private/SkTo.h"
+#include "src/core/SkDataPriv.h"
 #include "src/pdf/SkPDFDevice.h"
 #include "src/pdf/SkPDFFont.h"
 #include "src/pdf/SkPDFGradientShader.h"
@@ -580,8 +582,35 @@ void SkPDFDocument::onClose(SkWStream* stream) {
 
     auto docCatalogRef = this->emit(*docCatalog);
 
-    for (const SkPDFFont* f : get_fonts(*this)) {
-        f->emitSubset(this);
+    std::vector<const SkPDFFont*> fonts = get_fonts(*this);
+    auto is_type0 = [](const SkPDFFont* f) {
+        return f->getType() == SkAdvancedTypefaceMetrics::kType1CID_Font ||
+               f->getType() == SkAdvancedTypefaceMetrics::kTrueType_Font;
+    };
+    // Type 1 and Type 3 emission mutates the per-typeface caches, which the Type 0 jobs
+    // below read on the executor, so all of the serial fonts must be emitted before any
+    // job is queued.
+    for (const SkPDFFont* f : fonts) {
+        if (!fExecutor || !is_type0(f)) {
+            f->emitSubset(this);
+        }
+    }
+    if (fExecutor) {
+        for (const SkPDFFont* f : fonts) {
+            if (!is_type0(f)) {
+                continue;
+            }
+            // Subsetting is the bulk of the remaining single-threaded work when closing a
+            // document whose streams serialize on the executor. A Type 0 subset only reads
+            // the per-typeface caches, so warm those here and run the subsetting as a job.
+            SkPDFFont::GetMetrics(f->typeface(), this);
+            SkPDFFont::GetUnicodeMap(f->typeface(), this);
+            this->incrementJobCount();
+            fExecutor->add([f, this]() {
+                f->emitSubset(this);
+                this->signalJobComplete();
+            });
+        }
     }
 
     this->waitForJobs();
@@ -606,7 +635,9 @@ void SkPDFDocument::waitForJobs() {
 ///////////////////////////////////////////////////////////////////////////////
 
 void SkPDF::SetNodeId(SkCanvas* canvas, int nodeID) {
-    sk_sp<SkData> payload = SkData::MakeWithCopy(&nodeID, sizeof(nodeID));
+    // The same node id is set for every piece of content belonging to the node, so intern the
+    // payloads rather than allocating a fresh copy per draw.
+    sk_sp<SkData> payload = SkMakeInternedData(&nodeID, sizeof(nodeID));
     const char* key = SkPDFGetNodeIdKey();
     canvas->drawAnnotation({0, 0, 0, 0}, key, payload.get());
 }
@@ -110,6 +110,29 @@ public:
         this->endObject();
     }
 
+    /**
+       Like emitStream(), but writes the stream's /Length as an indirect object after the
+       stream content, so writeStream can compress directly into the output without first
+       buffering everything to learn its size.
+     */
+    template <typename T>
+    void emitStreamDeferredLength(SkPDFDict* dict, T writeStream, SkPDFIndirectReference ref) {
+        SkPDFIndirectReference lengthRef = this->reserveRef();
+        dict->insertRef("Length", lengthRef);
+        SkAutoMutexExclusive lock(fMutex);
+        SkWStream* stream = this->beginObject(ref);
+        dict->emitObject(stream);
+        stream->writeText(" stream\n");
+        size_t streamStart = stream->bytesWritten();
+        writeStream(stream);
+        size_t length = stream->bytesWritten() - streamStart;
+        stream->writeText("\nendstream");
+        this->endObject();
+        stream = this->beginObject(lengthRef);
+        stream->writeDecAsText(length);
+        this->endObject();
+    }
+
     const SkPDF::Metadata& metadata() const { return fMetadata; }
 
     SkPDFIndirectReference getPage(size_t pageIndex) const;
@@ -526,6 +526,57 @@ SkStrikeSpec make_small_strike(const SkTypeface& typeface) {
                                   SkMatrix::I());
 }
 
+namespace {
+// Process-wide memo of serialized Type 3 glyph programs, keyed by typeface ID and glyph ID.
+// Batch workloads regenerate documents using the same fonts over and over; a glyph's outline
+// program is a pure function of the typeface, so it can be shared across SkPDFDocuments
+// instead of being re-serialized from the glyph path each time. The memo empties itself
+// rather than evicting when it outgrows its budget; glyph programs are small enough that
+// steady-state workloads never get there.
+class SkPDFGlyphProgramMemo {
+public:
+    sk_sp<SkData> find(uint64_t key) {
+        SkAutoMutexExclusive lock(fMutex);
+        sk_sp<SkData>* program = fMap.find(key);
+        return program ? *program : nullptr;
+    }
+    void set(uint64_t key, const sk_sp<SkData>& program) {
+        SkAutoMutexExclusive lock(fMutex);
+        if (fBytesUsed + program->size() > kMaxBytesUsed) {
+            fMap.reset();
+            fBytesUsed = 0;
+        }
+        fBytesUsed += program->size();
+        fMap.set(key, program);
+    }
+
+private:
+    static constexpr size_t kMaxBytesUsed = 1 << 22;
+    SkMutex fMutex;
+    SkTHashMap<uint64_t, sk_sp<SkData>> fMap;
+    size_t fBytesUsed = 0;
+};
+}  // namespace
+
+static SkPDFGlyphProgramMemo* glyph_program_memo() {
+    static SkPDFGlyphProgramMemo* memo = new SkPDFGlyphProgramMemo;
+    return memo;
+}
+
+static sk_sp<SkData> get_glyph_program(const SkTypeface* typeface, const SkGlyph* glyph) {
+    uint64_t key = (uint64_t)typeface->uniqueID() << 32 | glyph->getGlyphID();
+    sk_sp<SkData> program = glyph_program_memo()->find(key);
+    if (!program) {
+        SkDynamicMemoryWStream content;
+        setGlyphWidthAndBoundingBox(glyph->advanceX(), glyph->iRect(), &content);
+        SkPDFUtils::EmitPath(*glyph->path(), SkPaint::kFill_Style, &content);
+        SkPDFUtils::PaintPath(SkPaint::kFill_Style, glyph->path()->getFillType(), &content);
+        program = content.detachAsData();
+        glyph_program_memo()->set(key, program);
+    }
+    return program;
+}
+
 static void emit_subset_type3(const SkPDFFont& pdfFont, SkPDFDocument* doc) {
     SkTypeface* typeface = pdfFont.typeface();
     SkGlyphID firstGlyphID = pdfFont.firstGlyphID();
@@ -591,12 +642,14 @@ static void emit_subset_type3(const SkPDFFont& pdfFont, SkPDFDocument* doc) {
             glyphBBox = glyph->iRect();
             bbox.join(glyphBBox);
             const SkPath* path = glyph->path();
-            SkDynamicMemoryWStream content;
             if (path && !path->isEmpty()) {
-                setGlyphWidthAndBoundingBox(glyph->advanceX(), glyphBBox, &content);
-                SkPDFUtils::EmitPath(*path, SkPaint::kFill_Style, &content);
-                SkPDFUtils::PaintPath(SkPaint::kFill_Style, path->getFillType(), &content);
+                charProcs->insertRef(
+                        characterName,
+                        SkPDFStreamOut(nullptr,
+                                       SkMemoryStream::Make(get_glyph_program(typeface, glyph)),
+                                       doc));
             } else {
+                SkDynamicMemoryWStream content;
                 auto pimg = to_image(gID, &smallGlyphs);
                 if (!pimg.fImage) {
                     setGlyphWidthAndBoundingBox(glyph->advanceX(), glyphBBox, &content);
@@ -617,9 +670,9 @@ static void emit_subset_type3(const SkPDFFont& pdfFont, SkPDFDocument* doc) {
                     content.write(characterName.c_str(), characterName.size());
                     content.writeText(" Do\n");
                 }
+                charProcs->insertRef(characterName, SkPDFStreamOut(nullptr,
+                                                                   content.detachAsStream(), doc));
             }
-            charProcs->insertRef(characterName, SkPDFStreamOut(nullptr,
-                                                               content.detachAsStream(), doc));
         }
         encDiffs->appendName(std::move(characterName));
         widthArray->appendScalar(advance);
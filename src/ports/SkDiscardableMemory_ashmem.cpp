@@ -0,0 +1,123 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkTypes.h"
+#include "src/core/SkDiscardableMemory.h"
+#include "src/lazy/SkDiscardableMemoryPool.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+// The ashmem driver is stable kernel ABI on Android, but its uapi header is not part of the
+// NDK, so the subset of the interface used here is declared locally (as libcutils does).
+struct ashmem_pin {
+    uint32_t offset;
+    uint32_t len;
+};
+
+#define ASHMEM_NAME_LEN 256
+#define __ASHMEMIOC     0x77
+#define ASHMEM_SET_NAME _IOW(__ASHMEMIOC, 1, char[ASHMEM_NAME_LEN])
+#define ASHMEM_SET_SIZE _IOW(__ASHMEMIOC, 3, size_t)
+#define ASHMEM_PIN      _IOW(__ASHMEMIOC, 7, struct ashmem_pin)
+#define ASHMEM_UNPIN    _IOW(__ASHMEMIOC, 8, struct ashmem_pin)
+#define ASHMEM_NOT_PURGED 0
+#define ASHMEM_WAS_PURGED 1
+
+constexpr char kAshmemDevice[] = "/dev/ashmem";
+
+/**
+ *  Discardable memory backed by an ashmem region. While unpinned the kernel may reclaim the
+ *  pages under memory pressure instead of swapping or killing; a subsequent lock() then fails
+ *  and the client re-creates the content, while unpurged regions survive pressure events with
+ *  their content intact.
+ */
+class SkDiscardableMemoryAshmem : public SkDiscardableMemory {
+public:
+    SkDiscardableMemoryAshmem(int fd, void* addr, size_t size)
+            : fFd(fd), fAddr(addr), fSize(size) {}
+
+    ~SkDiscardableMemoryAshmem() override {
+        SkASSERT(!fLocked);
+        munmap(fAddr, fSize);
+        close(fFd);
+    }
+
+    bool lock() override {
+        SkASSERT(!fLocked);
+        ashmem_pin pin = {0, 0};  // zero length pins the whole region
+        int result = ioctl(fFd, ASHMEM_PIN, &pin);
+        if (ASHMEM_NOT_PURGED == result) {
+            SkDEBUGCODE(fLocked = true;)
+            return true;
+        }
+        if (ASHMEM_WAS_PURGED == result) {
+            // The pin itself succeeded but the pages were reclaimed, so their content is gone;
+            // release them again and report the lock failure.
+            ioctl(fFd, ASHMEM_UNPIN, &pin);
+        }
+        return false;
+    }
+
+    void* data() override {
+        SkASSERT(fLocked);
+        return fAddr;
+    }
+
+    void unlock() override {
+        SkASSERT(fLocked);
+        SkDEBUGCODE(fLocked = false;)
+        ashmem_pin pin = {0, 0};
+        ioctl(fFd, ASHMEM_UNPIN, &pin);
+    }
+
+private:
+    const int    fFd;
+    void* const  fAddr;
+    const size_t fSize;
+    SkDEBUGCODE(bool fLocked = true;)  // ashmem regions are created pinned
+};
+
+static SkDiscardableMemory* create_pool_fallback(size_t bytes) {
+    // Without ashmem (non-Android kernel, SELinux denial), the in-process pool still provides
+    // discardable semantics under its own budget.
+    return SkGetGlobalDiscardableMemoryPool()->create(bytes);
+}
+
+}  // namespace
+
+SkDiscardableMemory* SkDiscardableMemory::Create(size_t bytes) {
+    int fd = open(kAshmemDevice, O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+        return create_pool_fallback(bytes);
+    }
+
+    const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t size = (bytes + pageSize - 1) & ~(pageSize - 1);
+
+    char name[ASHMEM_NAME_LEN];
+    snprintf(name, sizeof(name), "skia-resource-cache-%zu", bytes);
+    if (ioctl(fd, ASHMEM_SET_NAME, name) < 0 ||
+        ioctl(fd, ASHMEM_SET_SIZE, size) < 0) {
+        close(fd);
+        return create_pool_fallback(bytes);
+    }
+
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == addr) {
+        close(fd);
+        return create_pool_fallback(bytes);
+    }
+
+    // The region starts pinned, matching the contract that Create returns locked memory.
+    return new SkDiscardableMemoryAshmem(fd, addr, size);
+}
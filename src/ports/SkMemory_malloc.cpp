@@ -6,6 +6,7 @@
  */
 
 #include "include/private/SkMalloc.h"
+#include "include/private/SkMallocTag.h"
 
 #include <cstdlib>
 
@@ -38,6 +39,28 @@ static inline void* throw_on_failure(size_t size, void* p) {
     return p;
 }
 
+#ifdef SK_MALLOC_ACCOUNTING
+// Each block is prefixed with a header recording its size and tag, so sk_free() and
+// sk_realloc_throw() can attribute it without a side table. The header is padded to 16 bytes
+// to preserve malloc's alignment guarantee for the caller's block.
+struct alignas(16) SkBlockHeader {
+    size_t      fSize;
+    SkMallocTag fTag;
+};
+static_assert(sizeof(SkBlockHeader) == 16, "header must not weaken malloc alignment");
+
+static void* finish_tracked_alloc(void* base, size_t size) {
+    if (!base) {
+        return nullptr;
+    }
+    SkBlockHeader* header = static_cast<SkBlockHeader*>(base);
+    header->fSize = size;
+    header->fTag = sk_malloc_tag_current();
+    sk_malloc_tag_note_alloc(header->fTag, size);
+    return header + 1;
+}
+#endif
+
 void sk_abort_no_print() {
 #if defined(SK_BUILD_FOR_WIN) && defined(SK_IS_BOT)
     // do not display a system dialog before aborting the process
@@ -62,16 +85,40 @@ void sk_out_of_memory(void) {
 }
 
 void* sk_realloc_throw(void* addr, size_t size) {
+#ifdef SK_MALLOC_ACCOUNTING
+    // The resized block is attributed to the current scope, like a fresh allocation.
+    if (addr) {
+        SkBlockHeader* header = static_cast<SkBlockHeader*>(addr) - 1;
+        sk_malloc_tag_note_free(header->fTag, header->fSize);
+        addr = header;
+    }
+    if (size == 0) {
+        free(addr);
+        return nullptr;
+    }
+    return throw_on_failure(
+            size, finish_tracked_alloc(realloc(addr, size + sizeof(SkBlockHeader)), size));
+#else
     return throw_on_failure(size, realloc(addr, size));
+#endif
 }
 
 void sk_free(void* p) {
     if (p) {
+#ifdef SK_MALLOC_ACCOUNTING
+        SkBlockHeader* header = static_cast<SkBlockHeader*>(p) - 1;
+        sk_malloc_tag_note_free(header->fTag, header->fSize);
+        p = header;
+#endif
         free(p);
     }
 }
 
 void* sk_malloc_flags(size_t size, unsigned flags) {
+#ifdef SK_MALLOC_ACCOUNTING
+    const size_t requestedSize = size;
+    size += sizeof(SkBlockHeader);
+#endif
     void* p;
     if (flags & SK_MALLOC_ZERO_INITIALIZE) {
         p = calloc(size, 1);
@@ -92,6 +139,9 @@ void* sk_malloc_flags(size_t size, unsigned flags) {
         (void)mallopt(M_THREAD_DISABLE_MEM_INIT, 0);
 #endif
     }
+#ifdef SK_MALLOC_ACCOUNTING
+    p = finish_tracked_alloc(p, requestedSize);
+#endif
     if (flags & SK_MALLOC_THROW) {
         return throw_on_failure(size, p);
     } else {
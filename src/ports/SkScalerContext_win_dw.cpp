@@ -16,6 +16,7 @@
 #include "include/core/SkFontMetrics.h"
 #include "include/core/SkPath.h"
 #include "include/private/SkMutex.h"
+#include "include/private/SkTemplates.h"
 #include "include/private/SkTo.h"
 #include "src/core/SkDraw.h"
 #include "src/core/SkEndian.h"
@@ -41,6 +42,8 @@
 #include <dwrite_1.h>
 #include <dwrite_3.h>
 
+#include <algorithm>
+
 namespace {
 
 /* Note:
@@ -1191,8 +1194,14 @@ void SkScalerContext_DW::generateImage(const SkGlyph& glyph) {
         return;
     }
 
+    this->convertDWMask(glyph, (const uint8_t*)bits, renderingMode, textureType);
+}
+
+void SkScalerContext_DW::convertDWMask(const SkGlyph& glyph,
+                                       const uint8_t* src,
+                                       DWRITE_RENDERING_MODE renderingMode,
+                                       DWRITE_TEXTURE_TYPE textureType) {
     //Copy the mask into the glyph.
-    const uint8_t* src = (const uint8_t*)bits;
     if (DWRITE_RENDERING_MODE_ALIASED == renderingMode) {
         SkASSERT(SkMask::kBW_Format == glyph.fMaskFormat);
         SkASSERT(DWRITE_TEXTURE_ALIASED_1x1 == textureType);
@@ -1229,6 +1238,189 @@ void SkScalerContext_DW::generateImage(const SkGlyph& glyph) {
     }
 }
 
+bool SkScalerContext_DW::canBatchGlyph(const SkGlyph& glyph) {
+    // A glyph offset in a run moves the raster by whole pixels only when the transform does not
+    // scale, skew, or rotate, so batching is restricted to untransformed strikes. Color and PNG
+    // glyphs do not go through a glyph run analysis at all.
+    return SkMask::kARGB32_Format != glyph.fMaskFormat &&
+           !glyph.isEmpty() &&
+           1.0f == fXform.m11 && 0.0f == fXform.m12 &&
+           0.0f == fXform.m21 && 1.0f == fXform.m22;
+}
+
+bool SkScalerContext_DW::drawBatchedGlyphRun(SkSpan<const SkGlyph*> glyphs,
+                                             DWRITE_RENDERING_MODE renderingMode,
+                                             DWRITE_TEXTURE_TYPE textureType)
+{
+    DWriteFontTypeface* typeface = this->getDWriteTypeface();
+    const int bpp = (DWRITE_TEXTURE_CLEARTYPE_3x1 == textureType) ? 3 : 1;
+
+    // Lay the glyphs out left to right in one strip, with a gap so that the analysis cannot
+    // blend the anti-aliased edges of neighboring glyphs together.
+    static constexpr int kGap = 2;
+    const int count = SkTo<int>(glyphs.size());
+    SkAutoSTMalloc<16, int> xStart(count);
+    int stripWidth = 0;
+    int minTop = glyphs[0]->top();
+    int maxBottom = minTop;
+    size_t maxGlyphBytes = 0;
+    for (int i = 0; i < count; ++i) {
+        const SkGlyph& glyph = *glyphs[i];
+        xStart[i] = stripWidth;
+        stripWidth += glyph.width() + kGap;
+        minTop = std::min(minTop, glyph.top());
+        maxBottom = std::max(maxBottom, glyph.top() + glyph.height());
+        maxGlyphBytes = std::max(maxGlyphBytes, (size_t)(glyph.width() * glyph.height() * bpp));
+    }
+    stripWidth -= kGap;
+    const int stripHeight = maxBottom - minTop;
+
+    // A pathologically long run would make the texture buffer balloon; draw those in pieces.
+    static constexpr int kMaxStripBytes = 1 << 20;
+    const int sizeNeeded = stripWidth * stripHeight * bpp;
+    if (sizeNeeded <= 0 || sizeNeeded > kMaxStripBytes) {
+        return false;
+    }
+    if (sizeNeeded > fBits.count()) {
+        fBits.setCount(sizeNeeded);
+    }
+
+    // erase
+    memset(fBits.begin(), 0, sizeNeeded);
+
+    // All glyphs in the run share the same subpixel position.
+    fXform.dx = SkFixedToFloat(glyphs[0]->getSubXFixed());
+    fXform.dy = SkFixedToFloat(glyphs[0]->getSubYFixed());
+
+    SkAutoSTMalloc<16, UINT16> indices(count);
+    SkAutoSTMalloc<16, FLOAT> advances(count);
+    SkAutoSTMalloc<16, DWRITE_GLYPH_OFFSET> offsets(count);
+    for (int i = 0; i < count; ++i) {
+        const SkGlyph& glyph = *glyphs[i];
+        indices[i] = glyph.getGlyphID();
+        advances[i] = 0.0f;
+        // The offset is a whole number of pixels, so each glyph rasterizes exactly as it would
+        // alone at the origin, just translated to its slot in the strip.
+        offsets[i].advanceOffset = (FLOAT)(xStart[i] - glyph.left());
+        offsets[i].ascenderOffset = 0.0f;
+    }
+
+    DWRITE_GLYPH_RUN run;
+    run.glyphCount = count;
+    run.glyphAdvances = advances.get();
+    run.fontFace = typeface->fDWriteFontFace.get();
+    run.fontEmSize = SkScalarToFloat(fTextSizeRender);
+    run.bidiLevel = 0;
+    run.glyphIndices = indices.get();
+    run.isSideways = FALSE;
+    run.glyphOffsets = offsets.get();
+    {
+        SkTScopedComPtr<IDWriteGlyphRunAnalysis> glyphRunAnalysis;
+        {
+            Exclusive l(maybe_dw_mutex(*typeface));
+            // IDWriteFactory2::CreateGlyphRunAnalysis is very bad at aliased glyphs.
+            if (typeface->fFactory2 &&
+                    (fGridFitMode == DWRITE_GRID_FIT_MODE_DISABLED ||
+                     fAntiAliasMode == DWRITE_TEXT_ANTIALIAS_MODE_GRAYSCALE))
+            {
+                HRBM(typeface->fFactory2->CreateGlyphRunAnalysis(&run,
+                         &fXform,
+                         renderingMode,
+                         fMeasuringMode,
+                         fGridFitMode,
+                         fAntiAliasMode,
+                         0.0f, // baselineOriginX,
+                         0.0f, // baselineOriginY,
+                         &glyphRunAnalysis),
+                     "Could not create DW2 glyph run analysis for batch.");
+            } else {
+                HRBM(typeface->fFactory->CreateGlyphRunAnalysis(&run,
+                         1.0f, // pixelsPerDip,
+                         &fXform,
+                         renderingMode,
+                         fMeasuringMode,
+                         0.0f, // baselineOriginX,
+                         0.0f, // baselineOriginY,
+                         &glyphRunAnalysis),
+                     "Could not create glyph run analysis for batch.");
+            }
+        }
+        RECT bbox;
+        bbox.left = 0;
+        bbox.top = minTop;
+        bbox.right = stripWidth;
+        bbox.bottom = maxBottom;
+        {
+            Shared l(maybe_dw_mutex(*typeface));
+            HRBM(glyphRunAnalysis->CreateAlphaTexture(textureType,
+                    &bbox,
+                    fBits.begin(),
+                    sizeNeeded),
+                "Could not draw batched mask.");
+        }
+    }
+
+    // The conversion routines expect a glyph's texels tightly packed, so copy each glyph's rows
+    // out of the strip before converting.
+    SkAutoTMalloc<uint8_t> glyphBits(maxGlyphBytes);
+    const size_t stripRB = (size_t)stripWidth * bpp;
+    for (int i = 0; i < count; ++i) {
+        const SkGlyph& glyph = *glyphs[i];
+        const size_t glyphRB = (size_t)glyph.width() * bpp;
+        const uint8_t* srcRow = fBits.begin() + (glyph.top() - minTop) * stripRB + xStart[i] * bpp;
+        uint8_t* dstRow = glyphBits.get();
+        for (int y = 0; y < glyph.height(); ++y) {
+            memcpy(dstRow, srcRow, glyphRB);
+            srcRow += stripRB;
+            dstRow += glyphRB;
+        }
+        this->convertDWMask(glyph, glyphBits.get(), renderingMode, textureType);
+    }
+    return true;
+}
+
+void SkScalerContext_DW::generateImages(SkSpan<const SkGlyph*> glyphs) {
+    size_t i = 0;
+    while (i < glyphs.size()) {
+        const SkGlyph& lead = *glyphs[i];
+        if (!this->canBatchGlyph(lead)) {
+            this->generateImage(lead);
+            ++i;
+            continue;
+        }
+
+        // Gather the run of glyphs which may share one glyph run analysis with lead. Glyphs
+        // rendered at different subpixel positions or in different modes need their own.
+        size_t end = i + 1;
+        while (end < glyphs.size()) {
+            const SkGlyph& glyph = *glyphs[end];
+            if (!this->canBatchGlyph(glyph) ||
+                glyph.getSubXFixed() != lead.getSubXFixed() ||
+                glyph.getSubYFixed() != lead.getSubYFixed() ||
+                glyph.fForceBW != lead.fForceBW)
+            {
+                break;
+            }
+            ++end;
+        }
+
+        DWRITE_RENDERING_MODE renderingMode = fRenderingMode;
+        DWRITE_TEXTURE_TYPE textureType = fTextureType;
+        if (lead.fForceBW) {
+            renderingMode = DWRITE_RENDERING_MODE_ALIASED;
+            textureType = DWRITE_TEXTURE_ALIASED_1x1;
+        }
+
+        SkSpan<const SkGlyph*> batch{glyphs.data() + i, end - i};
+        if (batch.size() < 2 || !this->drawBatchedGlyphRun(batch, renderingMode, textureType)) {
+            for (const SkGlyph* glyph : batch) {
+                this->generateImage(*glyph);
+            }
+        }
+        i = end;
+    }
+}
+
 bool SkScalerContext_DW::generatePath(SkGlyphID glyph, SkPath* path) {
     SkASSERT(path);
     path->reset();
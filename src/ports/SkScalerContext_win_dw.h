@@ -30,6 +30,7 @@ protected:
     bool generateAdvance(SkGlyph* glyph) override;
     void generateMetrics(SkGlyph* glyph) override;
     void generateImage(const SkGlyph& glyph) override;
+    void generateImages(SkSpan<const SkGlyph*> glyphs) override;
     bool generatePath(SkGlyphID glyph, SkPath* path) override;
     void generateFontMetrics(SkFontMetrics*) override;
 
@@ -54,6 +55,20 @@ private:
                            DWRITE_RENDERING_MODE renderingMode,
                            DWRITE_TEXTURE_TYPE textureType);
 
+    /** Converts a tightly packed DWrite alpha texture into glyph.fImage. */
+    void convertDWMask(const SkGlyph& glyph,
+                       const uint8_t* src,
+                       DWRITE_RENDERING_MODE renderingMode,
+                       DWRITE_TEXTURE_TYPE textureType);
+
+    /** True if this glyph can share one glyph-run analysis with its neighbors. */
+    bool canBatchGlyph(const SkGlyph& glyph);
+
+    /** Renders a run of compatible glyphs with a single glyph-run analysis. */
+    bool drawBatchedGlyphRun(SkSpan<const SkGlyph*> glyphs,
+                             DWRITE_RENDERING_MODE renderingMode,
+                             DWRITE_TEXTURE_TYPE textureType);
+
     HRESULT getBoundingBox(SkGlyph* glyph,
                            DWRITE_RENDERING_MODE renderingMode,
                            DWRITE_TEXTURE_TYPE textureType,
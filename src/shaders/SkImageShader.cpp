@@ -614,7 +614,7 @@ bool SkImageShader::doStages(const SkStageRec& rec, SkImageStageUpdater* updater
         // Transform color space and alpha type to match shader convention (dst CS, premul alpha).
         alloc->make<SkColorSpaceXformSteps>(cs, at,
                                             rec.fDstCS, kPremul_SkAlphaType)
-            ->apply(p);
+            ->apply(p, pm.colorType());
 
         return true;
     };
@@ -992,5 +992,6 @@ skvm::Color SkImageShader::onProgram(skvm::Builder* p,
         c.b = clamp(c.b, 0.0f, limit);
     }
 
-    return SkColorSpaceXformSteps{cs,at, dst.colorSpace(),dst.alphaType()}.program(p, uniforms, c);
+    return SkColorSpaceXformSteps{cs,at, dst.colorSpace(),dst.alphaType()}
+            .program(p, uniforms, c, upper.colorType(), dst.colorType());
 }
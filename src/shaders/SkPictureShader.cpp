@@ -166,9 +166,23 @@ static sk_sp<SkColorSpace> ref_or_srgb(SkColorSpace* cs) {
     return cs ? sk_ref_sp(cs) : SkColorSpace::MakeSRGB();
 }
 
+// Clamp the tile size to about 4M pixels
+static const SkScalar kMaxTileArea = 2048 * 2048;
+
+// Rounds a draw-derived scale up to the next power of two, so that every scale within an
+// octave shares one cached tile. The local matrix compensation keeps drawing correct anywhere
+// within the bucket; the cost is at most one octave of oversampling.
+static SkScalar scale_bucket(SkScalar scale) {
+    if (!(scale > 0)) {
+        return 1;
+    }
+    return SkScalarPow(2, SkScalarCeilToScalar(SkScalarLog2(scale)));
+}
+
 struct CachedImageInfo {
     bool        success;
-    SkSize      tileScale;
+    SkSize      tileScale;      // Additional scale factors applied when sampling the picture.
+    SkSize      scaleBucket;    // Quantized scale, or empty if the tile isn't scale-bucketed.
     SkMatrix    matrixForDraw;
     SkImageInfo imageInfo;
 
@@ -177,24 +191,32 @@ struct CachedImageInfo {
                                 SkTCopyOnFirstWrite<SkMatrix>* localMatrix,     // in/out
                                 SkColorType dstColorType,
                                 SkColorSpace* dstColorSpace,
-                                const int maxTextureSize) {
+                                const int maxTextureSize,
+                                const bool bucketScale) {
         const SkMatrix m = SkMatrix::Concat(viewMatrix, **localMatrix);
 
+        SkSize scaleBucket = {0, 0};
         const SkSize scaledSize = [&]() {
             SkSize size;
             // Use a rotation-invariant scale
             if (!m.decomposeScale(&size, nullptr)) {
                 size = {1, 1};
             }
+            if (bucketScale) {
+                // Quantize the scale so a continuous zoom reuses one tile per octave instead
+                // of re-rasterizing the picture every frame.
+                size = {scale_bucket(size.width()), scale_bucket(size.height())};
+                scaleBucket = size;
+            }
             size.fWidth  *= bounds.width();
             size.fHeight *= bounds.height();
 
-            // Clamp the tile size to about 4M pixels
-            static const SkScalar kMaxTileArea = 2048 * 2048;
             SkScalar tileArea = size.width() * size.height();
             if (tileArea > kMaxTileArea) {
                 SkScalar clampScale = SkScalarSqrt(kMaxTileArea / tileArea);
                 size.set(size.width() * clampScale, size.height() * clampScale);
+                // A clamped tile no longer lies exactly on a bucket.
+                scaleBucket = {0, 0};
             }
 
             // Scale down the tile size if larger than maxTextureSize for GPU Path
@@ -205,6 +227,7 @@ struct CachedImageInfo {
                                                                    size.height());
                     size.set(SkScalarFloorToScalar(size.width() * downScale),
                              SkScalarFloorToScalar(size.height() * downScale));
+                    scaleBucket = {0, 0};
                 }
             }
             return size;
@@ -212,7 +235,7 @@ struct CachedImageInfo {
 
         const SkISize tileSize = scaledSize.toCeil();
         if (tileSize.isEmpty()) {
-            return {false, {}, {}, {}};
+            return {false, {}, {}, {}, {}};
         }
 
         const SkSize tileScale = {
@@ -230,6 +253,7 @@ struct CachedImageInfo {
         return {
             true,
             tileScale,
+            scaleBucket,
             SkMatrix::RectToRect(bounds, SkRect::MakeIWH(tileSize.width(), tileSize.height())),
             SkImageInfo::Make(tileSize.width(), tileSize.height(),
                               imgCT, kPremul_SkAlphaType, imgCS),
@@ -247,6 +271,49 @@ struct CachedImageInfo {
     }
 };
 
+// Walks up the scale-bucket chain looking for an already-rasterized tile of the same picture;
+// halving an existing tile is much cheaper than replaying the picture. Only unclamped
+// power-of-two buckets are probed, so the reconstructed keys match what CachedImageInfo::Make
+// produced for the larger tile.
+static sk_sp<SkImage> downsample_from_larger_bucket(const CachedImageInfo& info,
+                                                    const SkRect& tile,
+                                                    uint32_t pictureID) {
+    if (info.scaleBucket.isEmpty()) {
+        return nullptr;
+    }
+    SkSize parentScale = info.scaleBucket;
+    for (int level = 1; level <= 2; ++level) {
+        parentScale = {parentScale.width() * 2, parentScale.height() * 2};
+        const SkSize parentSize = {parentScale.width() * tile.width(),
+                                   parentScale.height() * tile.height()};
+        if (parentSize.width() * parentSize.height() > kMaxTileArea) {
+            // The parent bucket would have been clamped, so its key isn't reconstructible.
+            break;
+        }
+        const SkISize parentTileSize = parentSize.toCeil();
+        const SkSize parentTileScale = {parentTileSize.width() / tile.width(),
+                                        parentTileSize.height() / tile.height()};
+        ImageFromPictureKey parentKey(info.imageInfo.colorSpace(), info.imageInfo.colorType(),
+                                      pictureID, tile, parentTileScale);
+        sk_sp<SkImage> parent;
+        if (!SkResourceCache::Find(parentKey, ImageFromPictureRec::Visitor, &parent)) {
+            continue;
+        }
+        auto surf = SkSurface::MakeRaster(info.imageInfo);
+        if (!surf) {
+            return nullptr;
+        }
+        SkPaint paint;
+        paint.setBlendMode(SkBlendMode::kSrc);
+        surf->getCanvas()->drawImageRect(parent.get(),
+                                         SkRect::MakeIWH(info.imageInfo.width(),
+                                                         info.imageInfo.height()),
+                                         SkSamplingOptions(SkFilterMode::kLinear), &paint);
+        return surf->makeImageSnapshot();
+    }
+    return nullptr;
+}
+
 // Returns a cached image shader, which wraps a single picture tile at the given
 // CTM/local matrix.  Also adjusts the local matrix for tile scaling.
 sk_sp<SkShader> SkPictureShader::rasterShader(const SkMatrix& viewMatrix,
@@ -254,9 +321,12 @@ sk_sp<SkShader> SkPictureShader::rasterShader(const SkMatrix& viewMatrix,
                                               SkColorType dstColorType,
                                               SkColorSpace* dstColorSpace) const {
     const int maxTextureSize_NotUsedForCPU = 0;
+    // Scale-bucketed tiles only make sense when the tile is resampled with filtering.
+    const bool bucketScale = fFilter == SkFilterMode::kLinear;
     CachedImageInfo info = CachedImageInfo::Make(fTile, viewMatrix, localMatrix,
                                                  dstColorType, dstColorSpace,
-                                                 maxTextureSize_NotUsedForCPU);
+                                                 maxTextureSize_NotUsedForCPU,
+                                                 bucketScale);
     if (!info.success) {
         return nullptr;
     }
@@ -266,7 +336,10 @@ sk_sp<SkShader> SkPictureShader::rasterShader(const SkMatrix& viewMatrix,
 
     sk_sp<SkImage> image;
     if (!SkResourceCache::Find(key, ImageFromPictureRec::Visitor, &image)) {
-        image = info.makeImage(SkSurface::MakeRaster(info.imageInfo), fPicture.get());
+        image = downsample_from_larger_bucket(info, fTile, fPicture->uniqueID());
+        if (!image) {
+            image = info.makeImage(SkSurface::MakeRaster(info.imageInfo), fPicture.get());
+        }
         if (!image) {
             return nullptr;
         }
@@ -376,7 +449,8 @@ std::unique_ptr<GrFragmentProcessor> SkPictureShader::asFragmentProcessor(
     auto dstCS = ref_or_srgb(args.fDstColorInfo->colorSpace());
     auto info = CachedImageInfo::Make(fTile, args.fMatrixProvider.localToDevice(), &lm,
                                       dstColorType, dstCS.get(),
-                                      ctx->priv().caps()->maxTextureSize());
+                                      ctx->priv().caps()->maxTextureSize(),
+                                      fFilter == SkFilterMode::kLinear);
     SkMatrix inv;
     if (!info.success || !(*lm).invert(&inv)) {
         return nullptr;
@@ -240,10 +240,10 @@ skvm::Coord SkShaderBase::ApplyMatrix(skvm::Builder* p, const SkMatrix& m,
               y = coord.y;
     if (m.isIdentity()) {
         // That was easy.
-    } else if (m.isTranslate()) {
-        x = p->add(x, p->uniformF(uniforms->pushF(m[2])));
-        y = p->add(y, p->uniformF(uniforms->pushF(m[5])));
     } else if (m.isScaleTranslate()) {
+        // Handle translate-only matrices here too: a mad with a uniform scale of 1 costs the
+        // same as an add, and animated matrices then keep one program shape (and one cached
+        // skvm program) as they move between translate and scale+translate.
         x = p->mad(x, p->uniformF(uniforms->pushF(m[0])), p->uniformF(uniforms->pushF(m[2])));
         y = p->mad(y, p->uniformF(uniforms->pushF(m[4])), p->uniformF(uniforms->pushF(m[5])));
     } else {  // Affine or perspective.
@@ -540,50 +540,80 @@ skvm::Color SkGradientShaderBase::onProgram(skvm::Builder* p,
         stops.push_back(t_lo);
         fb[stops.size()] = { 0.0f, color_lo };
 
-        // We'll gather FBs from that array we just created.
-        skvm::Uniform fbs = uniforms->pushPtr(fb);
-
-        // Find the two stops we need to interpolate.
-        skvm::I32 ix;
-        if (fOrigPos == nullptr) {
-            // Evenly spaced stops... we can calculate ix directly.
-            // Of note: we need to clamp t and skip over that conceptual -inf stop we made up.
-            ix = trunc(clamp01(t) * uniformF(stops.size() - 1) + 1.0f);
+        if (stops.size() <= 8) {
+            // With this few stops it's cheaper to unroll the search into a branchless select
+            // chain than to compute an index and gather: each select lowers to a simple blend
+            // (and gathers run scalar in the interpreter), and all the uniform loads hoist out
+            // of the pixel loop, leaving one compare and eight blends per stop.
+            skvm::F32 Fr = uniformF(fb[0].f[0]), Br = uniformF(fb[0].b[0]),
+                      Fg = uniformF(fb[0].f[1]), Bg = uniformF(fb[0].b[1]),
+                      Fb = uniformF(fb[0].f[2]), Bb = uniformF(fb[0].b[2]),
+                      Fa = uniformF(fb[0].f[3]), Ba = uniformF(fb[0].b[3]);
+            for (size_t i = 0; i < stops.size(); i++) {
+                skvm::I32 cond = (t >= uniformF(stops[i]));
+                const FB& next = fb[i+1];
+                Fr = select(cond, uniformF(next.f[0]), Fr);
+                Fg = select(cond, uniformF(next.f[1]), Fg);
+                Fb = select(cond, uniformF(next.f[2]), Fb);
+                Fa = select(cond, uniformF(next.f[3]), Fa);
+
+                Br = select(cond, uniformF(next.b[0]), Br);
+                Bg = select(cond, uniformF(next.b[1]), Bg);
+                Bb = select(cond, uniformF(next.b[2]), Bb);
+                Ba = select(cond, uniformF(next.b[3]), Ba);
+            }
+            color = {
+                t * Fr + Br,
+                t * Fg + Bg,
+                t * Fb + Bb,
+                t * Fa + Ba,
+            };
         } else {
-            // Starting ix at 0 bakes in our conceptual first stop at -inf.
-            // TODO: good place to experiment with a loop in skvm.... stops.size() can be huge.
-            ix = p->splat(0);
-            for (float stop : stops) {
-                // ix += (t >= stop) ? +1 : 0 ~~>
-                // ix -= (t >= stop) ? -1 : 0
-                ix -= (t >= uniformF(stop));
+            // We'll gather FBs from that array we just created.
+            skvm::Uniform fbs = uniforms->pushPtr(fb);
+
+            // Find the two stops we need to interpolate.
+            skvm::I32 ix;
+            if (fOrigPos == nullptr) {
+                // Evenly spaced stops... we can calculate ix directly.
+                // Of note: we need to clamp t and skip over that conceptual -inf stop we made up.
+                ix = trunc(clamp01(t) * uniformF(stops.size() - 1) + 1.0f);
+            } else {
+                // Starting ix at 0 bakes in our conceptual first stop at -inf.
+                // TODO: good place to experiment with a loop in skvm.... stops.size() can be huge.
+                ix = p->splat(0);
+                for (float stop : stops) {
+                    // ix += (t >= stop) ? +1 : 0 ~~>
+                    // ix -= (t >= stop) ? -1 : 0
+                    ix -= (t >= uniformF(stop));
+                }
+                // TODO: we could skip any of the default stops GradientShaderBase's ctor added
+                // to ensure the full [0,1] span is covered.  This linear search doesn't need
+                // them for correctness, and it'd be up to two fewer stops to check.
+                // N.B. we do still need those stops for the fOrigPos == nullptr direct math path.
             }
-            // TODO: we could skip any of the default stops GradientShaderBase's ctor added
-            // to ensure the full [0,1] span is covered.  This linear search doesn't need
-            // them for correctness, and it'd be up to two fewer stops to check.
-            // N.B. we do still need those stops for the fOrigPos == nullptr direct math path.
-        }
 
-        // A scale factor and bias for each lane, 8 total.
-        // TODO: simpler, faster, tidier to push 8 uniform pointers, one for each struct lane?
-        ix = shl(ix, 3);
-        skvm::F32 Fr = gatherF(fbs, ix + 0);
-        skvm::F32 Fg = gatherF(fbs, ix + 1);
-        skvm::F32 Fb = gatherF(fbs, ix + 2);
-        skvm::F32 Fa = gatherF(fbs, ix + 3);
-
-        skvm::F32 Br = gatherF(fbs, ix + 4);
-        skvm::F32 Bg = gatherF(fbs, ix + 5);
-        skvm::F32 Bb = gatherF(fbs, ix + 6);
-        skvm::F32 Ba = gatherF(fbs, ix + 7);
-
-        // This is what we've been building towards!
-        color = {
-            t * Fr + Br,
-            t * Fg + Bg,
-            t * Fb + Bb,
-            t * Fa + Ba,
-        };
+            // A scale factor and bias for each lane, 8 total.
+            // TODO: simpler, faster, tidier to push 8 uniform pointers, one for each struct lane?
+            ix = shl(ix, 3);
+            skvm::F32 Fr = gatherF(fbs, ix + 0);
+            skvm::F32 Fg = gatherF(fbs, ix + 1);
+            skvm::F32 Fb = gatherF(fbs, ix + 2);
+            skvm::F32 Fa = gatherF(fbs, ix + 3);
+
+            skvm::F32 Br = gatherF(fbs, ix + 4);
+            skvm::F32 Bg = gatherF(fbs, ix + 5);
+            skvm::F32 Bb = gatherF(fbs, ix + 6);
+            skvm::F32 Ba = gatherF(fbs, ix + 7);
+
+            // This is what we've been building towards!
+            color = {
+                t * Fr + Br,
+                t * Fg + Bg,
+                t * Fb + Bb,
+                t * Fa + Ba,
+            };
+        }
     }
 
     // If we interpolated unpremul, premul now to match our output convention.
@@ -1151,11 +1151,85 @@ void Analysis::ValidateIndexingForES2(const ProgramElement& pe, ErrorReporter& e
     visitor.visitProgramElement(pe);
 }
 
+// Matches the constant-expression rules of ConstantExpressionVisitor, but additionally accepts
+// references to 'uniform' variables. Such an expression has the same value for every invocation
+// in a draw, which makes it a candidate for hoisting out of per-fragment code.
+class ConstantOrUniformExpressionVisitor : public ProgramVisitor {
+public:
+    bool visitExpression(const Expression& e) override {
+        switch (e.kind()) {
+            // ... a literal value
+            case Expression::Kind::kBoolLiteral:
+            case Expression::Kind::kIntLiteral:
+            case Expression::Kind::kFloatLiteral:
+                return false;
+
+            // ... settings resolve to a constant when the program is compiled
+            case Expression::Kind::kSetting:
+                return false;
+
+            // ... a 'uniform' variable, or a global or local variable qualified as 'const'
+            case Expression::Kind::kVariableReference: {
+                const Variable* v = e.as<VariableReference>().variable();
+                if (v->modifiers().fFlags & Modifiers::kUniform_Flag) {
+                    return false;
+                }
+                return !((v->storage() == Variable::Storage::kGlobal ||
+                          v->storage() == Variable::Storage::kLocal) &&
+                         (v->modifiers().fFlags & Modifiers::kConst_Flag));
+            }
+
+            // ... expressions composed of both of the above
+            case Expression::Kind::kBinary:
+            case Expression::Kind::kConstructorArray:
+            case Expression::Kind::kConstructorCompound:
+            case Expression::Kind::kConstructorCompoundCast:
+            case Expression::Kind::kConstructorDiagonalMatrix:
+            case Expression::Kind::kConstructorMatrixResize:
+            case Expression::Kind::kConstructorScalarCast:
+            case Expression::Kind::kConstructorSplat:
+            case Expression::Kind::kConstructorStruct:
+            case Expression::Kind::kFieldAccess:
+            case Expression::Kind::kIndex:
+            case Expression::Kind::kPrefix:
+            case Expression::Kind::kPostfix:
+            case Expression::Kind::kSwizzle:
+            case Expression::Kind::kTernary:
+                return INHERITED::visitExpression(e);
+
+            // Function calls are rejected; even a call whose arguments are all uniform could
+            // have invocation-dependent behavior (e.g. sampling or sk_FragCoord in the callee).
+            case Expression::Kind::kExternalFunctionCall:
+            case Expression::Kind::kFunctionCall:
+                return true;
+
+            case Expression::Kind::kPoison:
+                return true;
+
+            // These should never appear in final IR
+            case Expression::Kind::kExternalFunctionReference:
+            case Expression::Kind::kFunctionReference:
+            case Expression::Kind::kTypeReference:
+            default:
+                SkDEBUGFAIL("Unexpected expression type");
+                return true;
+        }
+    }
+
+private:
+    using INHERITED = ProgramVisitor;
+};
+
 bool Analysis::IsConstantExpression(const Expression& expr) {
     ConstantExpressionVisitor visitor(/*loopIndices=*/nullptr);
     return !visitor.visitExpression(expr);
 }
 
+bool Analysis::IsConstantOrUniform(const Expression& expr) {
+    ConstantOrUniformExpressionVisitor visitor;
+    return !visitor.visitExpression(expr);
+}
+
 bool Analysis::CanExitWithoutReturningValue(const FunctionDeclaration& funcDecl,
                                             const Statement& body) {
     if (funcDecl.returnType().isVoid()) {
@@ -127,6 +127,13 @@ struct Analysis {
     //   of the texture lookup functions
     static bool IsConstantExpression(const Expression& expr);
 
+    // Is 'expr' composed entirely of constant-expressions and references to 'uniform' variables?
+    // Such an expression has the same value for every invocation in a draw, so evaluating it per
+    // fragment is wasted work; this identifies candidates for hoisting to per-draw computation.
+    // Function calls are rejected, since even a call with uniform arguments can depend on
+    // invocation-varying state inside the callee.
+    static bool IsConstantOrUniform(const Expression& expr);
+
     struct UnrollableLoopInfo {
         const Variable* fIndex;
         double fStart;
@@ -8,8 +8,10 @@
 #include "src/sksl/SkSLCompiler.h"
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "include/private/SkMutex.h"
 #include "include/sksl/DSLCore.h"
 #include "src/core/SkScopeExit.h"
 #include "src/core/SkTraceEvent.h"
@@ -892,6 +894,107 @@ bool Compiler::optimize(Program& program) {
 
 #if defined(SKSL_STANDALONE) || SK_SUPPORT_GPU
 
+#if !defined(SKSL_STANDALONE)
+
+// A process-global memo of backend emissions, keyed on the post-optimization IR. Apps that run
+// several GrDirectContexts compile the same programs once per context; each context owns its own
+// Compiler, but the IR and settings for those repeats are identical, so the emission step can be
+// shared. Keys are exact matches (the serialized IR is part of the key), so a hash collision can
+// never hand back the wrong shader text.
+
+static SkMutex& emission_cache_mutex() {
+    static SkMutex& mutex = *(new SkMutex);
+    return mutex;
+}
+
+static std::unordered_map<std::string, String>& emission_cache() {
+    static std::unordered_map<std::string, String>& cache =
+            *(new std::unordered_map<std::string, String>);
+    return cache;
+}
+
+// Emissions are at most a few KB each, and the population of distinct programs in a process is
+// small, so we cap the entry count rather than accounting bytes.
+static constexpr size_t kMaxCachedEmissions = 1024;
+
+// The emitted GLSL depends on the shader caps, so every cap the GLSL code generator consults is
+// folded into the key; compilers configured for different devices never share an entry. This
+// list must stay in sync with every `this->caps()` access in SkSLGLSLCodeGenerator.cpp: a cap
+// read there but missing here lets a context reuse GLSL generated for a device whose caps
+// differ only in that bit. The SPIR-V and Metal generators do not read the caps, so their keys
+// omit this (letting contexts for different devices still share those emissions).
+static void append_glsl_caps(const ShaderCapsClass& caps, String* key) {
+    auto appendString = [key](const char* s) { key->appendf("%s;", s ? s : ""); };
+    key->appendf("%d;", (int)caps.generation());
+    appendString(caps.versionDeclString());
+    appendString(caps.shaderDerivativeExtensionString());
+    appendString(caps.fragCoordConventionsExtensionString());
+    appendString(caps.geometryShaderExtensionString());
+    appendString(caps.gsInvocationsExtensionString());
+    appendString(caps.externalTextureExtensionString());
+    appendString(caps.secondExternalTextureExtensionString());
+    appendString(caps.fbFetchColorName());
+    key->appendf("%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d;",
+                 caps.usesPrecisionModifiers(),
+                 caps.noDefaultPrecisionForExternalSamplers(),
+                 caps.mustDeclareFragmentShaderOutput(),
+                 caps.canUseFragCoord(),
+                 caps.canUseMinAndAbsTogether(),
+                 caps.canUseFractForNegativeValues(),
+                 caps.mustForceNegatedAtanParamToFloat(),
+                 caps.mustForceNegatedLdexpParamToMultiply(),
+                 caps.emulateAbsIntFunction(),
+                 caps.removePowWithConstantExponent(),
+                 caps.addAndTrueToLoopCondition(),
+                 caps.unfoldShortCircuitAsTernary(),
+                 caps.rewriteDoWhileLoops(),
+                 caps.rewriteMatrixComparisons(),
+                 caps.builtinFMASupport(),
+                 caps.builtinDeterminantSupport(),
+                 caps.incompleteShortIntPrecision());
+}
+
+static String emission_cache_key(const Program& program, const char* backend,
+                                 const ShaderCapsClass* caps) {
+    const ProgramConfig& config = *program.fConfig;
+    const ProgramSettings& settings = config.fSettings;
+    String key;
+    key.appendf("%s;%d;", backend, (int)config.fKind);
+    // These are the settings the code generators consult directly; the rest only shape the IR,
+    // which is serialized below.
+    key.appendf("%d%d%d%d%d;%d;%d;%d;%d;%d;",
+                settings.fFlipY, settings.fFragColorIsInOut, settings.fForceHighPrecision,
+                settings.fSharpenTextures, settings.fUsePushConstants,
+                settings.fRTHeightOffset, settings.fRTHeightBinding, settings.fRTHeightSet,
+                settings.fDefaultUniformSet, settings.fDefaultUniformBinding);
+    if (caps) {
+        append_glsl_caps(*caps, &key);
+    }
+    key.append(program.description());
+    return key;
+}
+
+static bool find_cached_emission(const String& key, String* out) {
+    SkAutoMutexExclusive lock(emission_cache_mutex());
+    const auto& cache = emission_cache();
+    auto iter = cache.find(key);
+    if (iter == cache.end()) {
+        return false;
+    }
+    *out = iter->second;
+    return true;
+}
+
+static void add_cached_emission(const String& key, const String& emission) {
+    SkAutoMutexExclusive lock(emission_cache_mutex());
+    auto& cache = emission_cache();
+    if (cache.size() < kMaxCachedEmissions) {
+        cache[key] = emission;
+    }
+}
+
+#endif  // !defined(SKSL_STANDALONE)
+
 bool Compiler::toSPIRV(Program& program, OutputStream& out) {
     TRACE_EVENT0("skia.shaders", "SkSL::Compiler::toSPIRV");
     AutoSource as(this, program.fSource.get());
@@ -937,10 +1040,19 @@ bool Compiler::toSPIRV(Program& program, OutputStream& out) {
 }
 
 bool Compiler::toSPIRV(Program& program, String* out) {
+#if !defined(SKSL_STANDALONE)
+    String key = emission_cache_key(program, "SPIRV", /*caps=*/nullptr);
+    if (find_cached_emission(key, out)) {
+        return true;
+    }
+#endif
     StringStream buffer;
     bool result = this->toSPIRV(program, buffer);
     if (result) {
         *out = buffer.str();
+#if !defined(SKSL_STANDALONE)
+        add_cached_emission(key, *out);
+#endif
     }
     return result;
 }
@@ -954,21 +1066,42 @@ bool Compiler::toGLSL(Program& program, OutputStream& out) {
 }
 
 bool Compiler::toGLSL(Program& program, String* out) {
+#if !defined(SKSL_STANDALONE)
+    String key = emission_cache_key(program, "GLSL", &fContext->fCaps);
+    if (find_cached_emission(key, out)) {
+        return true;
+    }
+#endif
     StringStream buffer;
     bool result = this->toGLSL(program, buffer);
     if (result) {
         *out = buffer.str();
+#if !defined(SKSL_STANDALONE)
+        add_cached_emission(key, *out);
+#endif
     }
     return result;
 }
 
 bool Compiler::toHLSL(Program& program, String* out) {
+#if !defined(SKSL_STANDALONE)
+    String key = emission_cache_key(program, "HLSL", /*caps=*/nullptr);
+    if (find_cached_emission(key, out)) {
+        return true;
+    }
+#endif
     String spirv;
     if (!this->toSPIRV(program, &spirv)) {
         return false;
     }
 
-    return SPIRVtoHLSL(spirv, out);
+    if (!SPIRVtoHLSL(spirv, out)) {
+        return false;
+    }
+#if !defined(SKSL_STANDALONE)
+    add_cached_emission(key, *out);
+#endif
+    return true;
 }
 
 bool Compiler::toMetal(Program& program, OutputStream& out) {
@@ -980,10 +1113,19 @@ bool Compiler::toMetal(Program& program, OutputStream& out) {
 }
 
 bool Compiler::toMetal(Program& program, String* out) {
+#if !defined(SKSL_STANDALONE)
+    String key = emission_cache_key(program, "Metal", /*caps=*/nullptr);
+    if (find_cached_emission(key, out)) {
+        return true;
+    }
+#endif
     StringStream buffer;
     bool result = this->toMetal(program, buffer);
     if (result) {
         *out = buffer.str();
+#if !defined(SKSL_STANDALONE)
+        add_cached_emission(key, *out);
+#endif
     }
     return result;
 }
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/utils/SkAsyncWStream.h"
+
+#include "include/core/SkExecutor.h"
+#include "include/private/SkSemaphore.h"
+#include "include/private/SkTemplates.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+class AsyncWStream : public SkWStream {
+public:
+    AsyncWStream(std::unique_ptr<SkWStream> sink, size_t halfSize, SkExecutor* executor)
+            : fSink(std::move(sink))
+            , fExecutor(executor ? executor : &SkExecutor::GetDefault())
+            , fHalfSize(halfSize)
+            , fStorage(2 * halfSize)
+            , fFillBuf(fStorage.get())
+            , fDrainBuf(fStorage.get() + halfSize) {}
+
+    ~AsyncWStream() override {
+        // Everything buffered still belongs on disk, and the pending drain writes fSink and
+        // fDrainBuf from the executor; push the rest out and let it finish.
+        this->flush();
+    }
+
+    bool write(const void* buffer, size_t size) override {
+        const char* src = static_cast<const char*>(buffer);
+        fBytesWritten += size;
+        while (size > 0) {
+            if (fFillPos == fHalfSize && !this->advanceBuffer()) {
+                return false;
+            }
+            size_t n = std::min(size, fHalfSize - fFillPos);
+            memcpy(fFillBuf + fFillPos, src, n);
+            fFillPos += n;
+            src += n;
+            size -= n;
+        }
+        return !fSinkFailed;
+    }
+
+    void flush() override {
+        // Hand off the partial buffer, wait for it to land, then flush the wrapped stream so
+        // its bytes reach the backing store too.
+        if (fFillPos > 0) {
+            this->advanceBuffer();
+        }
+        if (fDrainPending) {
+            fDrainDone.wait();
+            fDrainPending = false;
+        }
+        fSink->flush();
+    }
+
+    size_t bytesWritten() const override { return fBytesWritten; }
+
+private:
+    // Waits out the in-flight drain, swaps the filled buffer in behind it, and schedules its
+    // write. Returns false once the sink has failed. The semaphore orders the worker's writes
+    // to fSinkFailed before the producer reads it.
+    bool advanceBuffer() {
+        if (fDrainPending) {
+            fDrainDone.wait();
+            fDrainPending = false;
+        }
+        if (fSinkFailed) {
+            return false;
+        }
+        std::swap(fFillBuf, fDrainBuf);
+        size_t drainSize = fFillPos;
+        fFillPos = 0;
+        fDrainPending = true;
+        fExecutor->add([this, drainSize] {
+            if (!fSink->write(fDrainBuf, drainSize)) {
+                fSinkFailed = true;
+            }
+            fDrainDone.signal();
+        });
+        return true;
+    }
+
+    std::unique_ptr<SkWStream> fSink;
+    SkExecutor*                fExecutor;
+    const size_t               fHalfSize;
+    SkAutoTMalloc<char>        fStorage;
+
+    char*  fFillBuf;
+    char*  fDrainBuf;
+    size_t fFillPos      = 0;
+    size_t fBytesWritten = 0;
+
+    bool        fDrainPending = false;
+    bool        fSinkFailed   = false;
+    SkSemaphore fDrainDone;
+};
+
+}  // namespace
+
+std::unique_ptr<SkWStream> SkAsyncWStream::Make(std::unique_ptr<SkWStream> stream,
+                                                size_t bufferSize,
+                                                SkExecutor* executor) {
+    if (!stream) {
+        return nullptr;
+    }
+    // Below this the handoff overhead swamps any overlap with the sink.
+    size_t halfSize = std::max<size_t>(bufferSize / 2, 256);
+    return std::make_unique<AsyncWStream>(std::move(stream), halfSize, executor);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/utils/SkBatchRenderer.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkSurface.h"
+#include "include/private/SkMutex.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+// Finished surfaces parked for reuse by later jobs with the same SkImageInfo. Snapshots taken
+// from a pooled surface stay valid: redrawing into it goes through SkSurface's copy-on-write.
+class SurfacePool {
+public:
+    explicit SurfacePool(size_t budget) : fBudget(budget) {}
+
+    sk_sp<SkSurface> take(const SkImageInfo& info) {
+        {
+            SkAutoMutexExclusive lock(fMutex);
+            for (size_t i = 0; i < fSurfaces.size(); ++i) {
+                if (fSurfaces[i]->imageInfo() == info) {
+                    sk_sp<SkSurface> surface = std::move(fSurfaces[i]);
+                    fSurfaces[i] = std::move(fSurfaces.back());
+                    fSurfaces.pop_back();
+                    fBytes -= info.computeMinByteSize();
+                    return surface;
+                }
+            }
+        }
+        return SkSurface::MakeRaster(info);
+    }
+
+    void put(sk_sp<SkSurface> surface) {
+        size_t size = surface->imageInfo().computeMinByteSize();
+        SkAutoMutexExclusive lock(fMutex);
+        if (fBytes + size > fBudget) {
+            return;  // Over budget: let the surface die instead of pooling it.
+        }
+        fBytes += size;
+        fSurfaces.push_back(std::move(surface));
+    }
+
+private:
+    const size_t fBudget;
+    SkMutex      fMutex;
+    std::vector<sk_sp<SkSurface>> fSurfaces SK_GUARDED_BY(fMutex);
+    size_t       fBytes SK_GUARDED_BY(fMutex) = 0;
+};
+
+}  // namespace
+
+void SkBatchRenderer::Render(const Job jobs[], int count,
+                             const ResultProc& resultProc,
+                             const ProgressProc& progressProc,
+                             const Options& options) {
+    if (count <= 0) {
+        return;
+    }
+
+    SurfacePool pool(options.fSurfacePoolBudget);
+    std::atomic<int> completed{0};
+
+    SkExecutor& executor = options.fExecutor ? *options.fExecutor : SkExecutor::GetDefault();
+    SkTaskGroup tg(executor);
+    tg.batch(count, [&](int i) {
+        const Job& job = jobs[i];
+
+        sk_sp<SkImage> image;
+        if (job.fPicture && job.fInfo.width() > 0 && job.fInfo.height() > 0) {
+            if (sk_sp<SkSurface> surface = pool.take(job.fInfo)) {
+                SkCanvas* canvas = surface->getCanvas();
+                canvas->clear(job.fClearColor);
+                canvas->save();
+                canvas->concat(job.fMatrix);
+                job.fPicture->playback(canvas);
+                canvas->restore();
+                image = surface->makeImageSnapshot();
+                pool.put(std::move(surface));
+            }
+        }
+
+        if (resultProc) {
+            resultProc(i, std::move(image));
+        }
+        if (progressProc) {
+            progressProc(completed.fetch_add(1, std::memory_order_relaxed) + 1, count);
+        }
+    });
+    tg.wait();
+}
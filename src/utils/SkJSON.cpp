@@ -112,6 +112,9 @@ ArrayValue::ArrayValue(const Value* src, size_t size, SkArenaAlloc& alloc) {
 //
 namespace {
 
+// first byte reserved for tagging, \0 terminator => 6 usable chars
+static constexpr size_t kMaxInlineStringSize = sizeof(Value) - 2;
+
 // An internal string builder with a fast 8 byte short string load path
 // (for the common case where the string is not at the end of the stream).
 class FastString final : public Value {
@@ -136,8 +139,6 @@ public:
     }
 
 private:
-    // first byte reserved for tagging, \0 terminator => 6 usable chars
-    static constexpr size_t kMaxInlineStringSize = sizeof(Value) - 2;
 
     void initLongString(const char* src, size_t size, SkArenaAlloc& alloc) {
         SkASSERT(size > kMaxInlineStringSize);
@@ -182,6 +183,26 @@ private:
     }
 };
 
+// A zero-copy long string referencing caller-owned storage (in-situ parse mode).  The arena
+// slab holds only {size | kExternalSizeFlag, ptr} instead of a copy of the characters; the
+// caller is responsible for null-terminating the source in place.
+class ExternalString final : public Value {
+public:
+    ExternalString(const char* src, size_t size, SkArenaAlloc& alloc) {
+        SkASSERT(size > kMaxInlineStringSize);
+        SkASSERT(!(size & kExternalSizeFlag));
+        SkASSERT(src[size] == '\0');
+
+        auto* header = reinterpret_cast<size_t*>(
+                alloc.makeBytesAlignedTo(sizeof(size_t) + sizeof(const char*), kRecAlign));
+        header[0] = size | kExternalSizeFlag;
+        memcpy(header + 1, &src, sizeof(src));
+
+        this->init_tagged_pointer(Tag::kString, header);
+        SkASSERT(this->getTag() == Tag::kString);
+    }
+};
+
 } // namespace
 
 StringValue::StringValue(const char* src, size_t size, SkArenaAlloc& alloc) {
@@ -293,8 +314,9 @@ static inline float pow10(int32_t exp) {
 
 class DOMParser {
 public:
-    explicit DOMParser(SkArenaAlloc& alloc)
-        : fAlloc(alloc) {
+    explicit DOMParser(SkArenaAlloc& alloc, bool in_situ = false)
+        : fAlloc(alloc)
+        , fInSitu(in_situ) {
         fValueStack.reserve(kValueStackReserve);
         fUnescapeBuffer.reserve(kUnescapeBufferReserve);
     }
@@ -339,8 +361,10 @@ public:
         p = skip_ws(p);
         if (*p != '"') return this->error(NullValue(), p, "expected object key");
 
-        p = this->matchString(p, p_stop, [this](const char* key, size_t size, const char* eos) {
-            this->pushObjectKey(key, size, eos);
+        p = this->matchString(p, p_stop,
+                              [this](const char* key, size_t size, const char* eos,
+                                     bool in_input) {
+            this->pushObjectKey(key, size, eos, in_input);
         });
         if (!p) return NullValue();
 
@@ -357,8 +381,10 @@ public:
         case '\0':
             return this->error(NullValue(), p, "unexpected input end");
         case '"':
-            p = this->matchString(p, p_stop, [this](const char* str, size_t size, const char* eos) {
-                this->pushString(str, size, eos);
+            p = this->matchString(p, p_stop,
+                                  [this](const char* str, size_t size, const char* eos,
+                                         bool in_input) {
+                this->pushString(str, size, eos, in_input);
             });
             break;
         case '[':
@@ -467,6 +493,9 @@ public:
 private:
     SkArenaAlloc&         fAlloc;
 
+    // In-situ mode references (and mutates) the input buffer instead of copying long strings.
+    const bool            fInSitu;
+
     // Pending values stack.
     static constexpr size_t kValueStackReserve = 256;
     std::vector<Value>    fValueStack;
@@ -568,11 +597,11 @@ private:
         )
     }
 
-    void pushObjectKey(const char* key, size_t size, const char* eos) {
+    void pushObjectKey(const char* key, size_t size, const char* eos, bool in_input) {
         SkASSERT(this->inObjectScope());
         SkASSERT(fValueStack.size() >= SkTo<size_t>(fScopeIndex));
         SkASSERT(!((fValueStack.size() - SkTo<size_t>(fScopeIndex)) & 1));
-        this->pushString(key, size, eos);
+        this->pushString(key, size, eos, in_input);
     }
 
     void pushTrue() {
@@ -587,7 +616,14 @@ private:
         fValueStack.push_back(NullValue());
     }
 
-    void pushString(const char* s, size_t size, const char* eos) {
+    void pushString(const char* s, size_t size, const char* eos, bool in_input) {
+        if (fInSitu && in_input && size > kMaxInlineStringSize) {
+            // Terminate in place (overwriting the closing '"') and reference the input
+            // directly, skipping the arena copy.  Only valid for unescaped input spans.
+            const_cast<char*>(s)[size] = '\0';
+            fValueStack.push_back(ExternalString(s, size, fAlloc));
+            return;
+        }
         fValueStack.push_back(FastString(s, size, eos, fAlloc));
     }
 
@@ -701,7 +737,7 @@ private:
             if (*p == '"') {
                 // Valid string found.
                 if (!requires_unescape) {
-                    func(s_begin, p - s_begin, p_stop);
+                    func(s_begin, p - s_begin, p_stop, /*in_input=*/true);
                 } else {
                     // Slow unescape.  We could avoid this extra copy with some effort,
                     // but in practice escaped strings should be rare.
@@ -711,7 +747,9 @@ private:
                     }
 
                     SkASSERT(!buf->empty());
-                    func(buf->data(), buf->size(), buf->data() + buf->size() - 1);
+                    // The unescape buffer is transient - never referenced in situ.
+                    func(buf->data(), buf->size(), buf->data() + buf->size() - 1,
+                         /*in_input=*/false);
                 }
                 return p + 1;
             }
@@ -918,6 +956,13 @@ DOM::DOM(const char* data, size_t size)
     fRoot = parser.parse(data, size);
 }
 
+DOM::DOM(char* data, size_t size)
+    : fAlloc(kMinChunkSize) {
+    DOMParser parser(fAlloc, /*in_situ=*/true);
+
+    fRoot = parser.parse(data, size);
+}
+
 void DOM::write(SkWStream* stream) const {
     Write(fRoot, stream);
 }
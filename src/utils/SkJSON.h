@@ -134,6 +134,11 @@ protected:
     };
     static constexpr uint8_t kTagMask = 0b00000111;
 
+    // Long string records normally store a copy of the characters inline in the arena slab,
+    // but in-situ DOMs reference caller-owned storage instead.  The high bit of the stored
+    // size selects the layout - see StringValue.
+    static constexpr size_t kExternalSizeFlag = ~(~static_cast<size_t>(0) >> 1);
+
     void init_tagged(Tag);
     void init_tagged_pointer(Tag, void*);
 
@@ -297,22 +302,28 @@ public:
             // short_strlen.
             return strlen(this->cast<char>());
         case Tag::kString:
-            return this->cast<VectorValue<char, Value::Type::kString>>()->size();
+            return *this->ptr<size_t>() & ~kExternalSizeFlag;
         default:
             return 0;
         }
     }
 
     const char* begin() const {
-        return this->getTag() == Tag::kShortString
-            ? this->cast<char>()
-            : this->cast<VectorValue<char, Value::Type::kString>>()->begin();
+        if (this->getTag() == Tag::kShortString) {
+            return this->cast<char>();
+        }
+        // Long strings either carry the characters in the slab, or (for in-situ DOMs)
+        // reference the caller's buffer - see kExternalSizeFlag.
+        const auto* size_ptr = this->ptr<size_t>();
+        return (*size_ptr & kExternalSizeFlag)
+            ? *reinterpret_cast<const char* const*>(size_ptr + 1)
+            : reinterpret_cast<const char*>(size_ptr + 1);
     }
 
     const char* end() const {
         return this->getTag() == Tag::kShortString
             ? strchr(this->cast<char>(), '\0')
-            : this->cast<VectorValue<char, Value::Type::kString>>()->end();
+            : this->begin() + this->size();
     }
 };
 
@@ -336,6 +347,13 @@ class DOM final : public SkNoncopyable {
 public:
     DOM(const char*, size_t);
 
+    /**
+     *  In-situ (zero-copy) parse mode: long strings reference |data| directly instead of
+     *  being copied into the DOM arena, and |data| is modified in place (strings are
+     *  null-terminated over their closing quote).  The buffer must outlive the DOM.
+     */
+    DOM(char* data, size_t size);
+
     const Value& root() const { return fRoot; }
 
     void write(SkWStream*) const;
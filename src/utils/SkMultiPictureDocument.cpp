@@ -23,13 +23,20 @@
   File format:
       BEGINNING_OF_FILE:
         kMagic
-        uint32_t version_number (==2)
+        uint32_t version_number (==3)
         uint32_t page_count
         {
           float sizeX
           float sizeY
         } * page_count
-        skp file
+        {
+          uint64_t offset  // offset of the page's skp from BEGINNING_OF_FILE
+        } * page_count
+        skp file * page_count
+
+  Version 2 files lack the offset table and instead serialize all pages as a
+  single skp whose pages are separated by kEndPage annotations.  The offset
+  table lets a reader deserialize one page without touching the others.
 */
 
 namespace {
@@ -38,15 +45,10 @@ static constexpr char kMagic[] = "Skia Multi-Picture Doc\n\n";
 
 static constexpr char kEndPage[] = "SkMultiPictureEndPage";
 
-const uint32_t kVersion = 2;
+const uint32_t kVersion = 3;
 
-static SkSize join(const SkTArray<SkSize>& sizes) {
-    SkSize joined = {0, 0};
-    for (SkSize s : sizes) {
-        joined = SkSize{std::max(joined.width(), s.width()), std::max(joined.height(), s.height())};
-    }
-    return joined;
-}
+// Oldest version this reader still understands.
+const uint32_t kMinReadVersion = 2;
 
 struct MultiPictureDocument final : public SkDocument {
     const SkSerialProcs fProcs;
@@ -84,15 +86,22 @@ struct MultiPictureDocument final : public SkDocument {
         for (SkSize s : fSizes) {
             wStream->write(&s, sizeof(s));
         }
-        SkSize bigsize = join(fSizes);
-        SkCanvas* c = fPictureRecorder.beginRecording(SkRect::MakeSize(bigsize));
+        // Serialize the pages up front: SkWStream is forward-only, so the offset
+        // table has to be written before the data whose offsets it records.
+        SkTArray<sk_sp<SkData>> pageData;
         for (const sk_sp<SkPicture>& page : fPages) {
-            c->drawPicture(page);
-            // Annotations must include some data.
-            c->drawAnnotation(SkRect::MakeEmpty(), kEndPage, SkData::MakeWithCString("X"));
+            SkDynamicMemoryWStream buffer;
+            page->serialize(&buffer, &fProcs);
+            pageData.push_back(buffer.detachAsData());
+        }
+        uint64_t offset = wStream->bytesWritten() + fPages.count() * sizeof(uint64_t);
+        for (const sk_sp<SkData>& data : pageData) {
+            wStream->write(&offset, sizeof(offset));
+            offset += data->size();
+        }
+        for (const sk_sp<SkData>& data : pageData) {
+            wStream->write(data->data(), data->size());
         }
-        sk_sp<SkPicture> p = fPictureRecorder.finishRecordingAsPicture();
-        p->serialize(wStream, &fProcs);
         fPages.reset();
         fSizes.reset();
         return;
@@ -111,7 +120,7 @@ sk_sp<SkDocument> SkMakeMultiPictureDocument(SkWStream* wStream, const SkSerialP
 
 ////////////////////////////////////////////////////////////////////////////////
 
-int SkMultiPictureDocumentReadPageCount(SkStreamSeekable* stream) {
+static int read_page_count(SkStreamSeekable* stream, uint32_t* versionNumber) {
     if (!stream) {
         return 0;
     }
@@ -122,8 +131,8 @@ int SkMultiPictureDocumentReadPageCount(SkStreamSeekable* stream) {
         stream = nullptr;
         return 0;
     }
-    uint32_t versionNumber;
-    if (!stream->readU32(&versionNumber) || versionNumber != kVersion) {
+    if (!stream->readU32(versionNumber) ||
+        *versionNumber < kMinReadVersion || *versionNumber > kVersion) {
         return 0;
     }
     uint32_t pageCount;
@@ -134,6 +143,11 @@ int SkMultiPictureDocumentReadPageCount(SkStreamSeekable* stream) {
     return SkTo<int>(pageCount);
 }
 
+int SkMultiPictureDocumentReadPageCount(SkStreamSeekable* stream) {
+    uint32_t versionNumber;
+    return read_page_count(stream, &versionNumber);
+}
+
 bool SkMultiPictureDocumentReadPageSizes(SkStreamSeekable* stream,
                                          SkDocumentPage* dstArray,
                                          int dstArrayCount) {
@@ -189,9 +203,35 @@ bool SkMultiPictureDocumentRead(SkStreamSeekable* stream,
                                 SkDocumentPage* dstArray,
                                 int dstArrayCount,
                                 const SkDeserialProcs* procs) {
+    uint32_t versionNumber;
+    if (read_page_count(stream, &versionNumber) < 1) {
+        return false;
+    }
     if (!SkMultiPictureDocumentReadPageSizes(stream, dstArray, dstArrayCount)) {
         return false;
     }
+    if (versionNumber >= kVersion) {
+        // The offset table follows the page sizes; the pages are independent skps.
+        SkTArray<uint64_t> offsets(dstArrayCount);
+        for (int i = 0; i < dstArrayCount; ++i) {
+            uint64_t offset;
+            if (sizeof(offset) != stream->read(&offset, sizeof(offset))) {
+                return false;
+            }
+            offsets.push_back(offset);
+        }
+        for (int i = 0; i < dstArrayCount; ++i) {
+            if (!stream->seek(SkToSizeT(offsets[i]))) {
+                return false;
+            }
+            dstArray[i].fPicture = SkPicture::MakeFromStream(stream, procs);
+            if (!dstArray[i].fPicture) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     SkSize joined = {0.0f, 0.0f};
     for (int i = 0; i < dstArrayCount; ++i) {
         joined = SkSize{std::max(joined.width(), dstArray[i].fSize.width()),
@@ -213,3 +253,42 @@ bool SkMultiPictureDocumentRead(SkStreamSeekable* stream,
     }
     return true;
 }
+
+bool SkMultiPictureDocumentReadPage(SkStreamSeekable* stream,
+                                    int pageIndex,
+                                    SkDocumentPage* dst,
+                                    const SkDeserialProcs* procs) {
+    if (!dst) {
+        return false;
+    }
+    uint32_t versionNumber;
+    int pageCount = read_page_count(stream, &versionNumber);
+    if (pageCount < 1 || pageIndex < 0 || pageIndex >= pageCount) {
+        return false;
+    }
+    if (versionNumber < kVersion) {
+        // Older files interleave all pages in one skp; there is no way to pull
+        // out one page without playing back the rest.
+        return false;
+    }
+    size_t sizesStart = stream->getPosition();
+    if (!stream->seek(sizesStart + pageIndex * sizeof(SkSize))) {
+        return false;
+    }
+    if (sizeof(dst->fSize) != stream->read(&dst->fSize, sizeof(dst->fSize))) {
+        return false;
+    }
+    size_t offsetsStart = sizesStart + pageCount * sizeof(SkSize);
+    if (!stream->seek(offsetsStart + pageIndex * sizeof(uint64_t))) {
+        return false;
+    }
+    uint64_t offset;
+    if (sizeof(offset) != stream->read(&offset, sizeof(offset))) {
+        return false;
+    }
+    if (!stream->seek(SkToSizeT(offset))) {
+        return false;
+    }
+    dst->fPicture = SkPicture::MakeFromStream(stream, procs);
+    return dst->fPicture != nullptr;
+}
@@ -44,4 +44,16 @@ SK_SPI bool SkMultiPictureDocumentRead(SkStreamSeekable* src,
                                        int dstArrayCount,
                                        const SkDeserialProcs* = nullptr);
 
+/**
+ *  Read a single page of the SkMultiPictureDocument without deserializing the
+ *  others, using the file's page offset table.  Only files written by this
+ *  version of the code (version 3) carry the table; returns false for older
+ *  files or on error.  Note that SkDeserialProcs which accumulate state across
+ *  pages (e.g. image-sharing procs) require the pages to be read in order.
+ */
+SK_SPI bool SkMultiPictureDocumentReadPage(SkStreamSeekable* src,
+                                           int pageIndex,
+                                           SkDocumentPage* dst,
+                                           const SkDeserialProcs* = nullptr);
+
 #endif  // SkMultiPictureDocument_DEFINED
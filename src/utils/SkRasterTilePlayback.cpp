@@ -0,0 +1,75 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/utils/SkRasterTilePlayback.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkPixmap.h"
+#include "include/private/SkTArray.h"
+#include "src/core/SkTaskGroup.h"
+
+bool SkPlayTilesParallel(const SkPixmap& dst,
+                         const SkRasterTile tiles[],
+                         int count,
+                         SkExecutor* executor,
+                         const SkSurfaceProps* props) {
+    if (!dst.addr() || count < 0) {
+        return false;
+    }
+    for (int i = 0; i < count; ++i) {
+        if (!tiles[i].fPicture) {
+            return false;
+        }
+        for (int j = i + 1; j < count; ++j) {
+            // Overlapping clips would let two threads touch the same pixels.
+            if (SkIRect::Intersects(tiles[i].fClip, tiles[j].fClip)) {
+                return false;
+            }
+        }
+    }
+
+    SkTaskGroup taskGroup(executor ? *executor : SkExecutor::GetDefault());
+    taskGroup.batch(count, [&](int i) {
+        // Each task gets its own canvas (and SkBitmapDevice) over the shared pixels. The
+        // integer-rect clip confines every write to this tile, so no synchronization is
+        // needed between tasks.
+        auto canvas = SkCanvas::MakeRasterDirect(dst.info(), dst.writable_addr(),
+                                                 dst.rowBytes(), props);
+        if (!canvas) {
+            return;
+        }
+        canvas->clipIRect(tiles[i].fClip);
+        tiles[i].fPicture->playback(canvas.get());
+    });
+    taskGroup.wait();
+    return true;
+}
+
+bool SkPlayPictureTiledParallel(const SkPixmap& dst,
+                                sk_sp<const SkPicture> picture,
+                                int tilesX,
+                                int tilesY,
+                                SkExecutor* executor,
+                                const SkSurfaceProps* props) {
+    if (!picture || tilesX < 1 || tilesY < 1) {
+        return false;
+    }
+    SkTArray<SkRasterTile> tiles(tilesX * tilesY);
+    for (int ty = 0; ty < tilesY; ++ty) {
+        for (int tx = 0; tx < tilesX; ++tx) {
+            // Divide so the grid covers dst exactly even when the dimensions don't split
+            // evenly; the last row/column absorbs the remainder.
+            SkIRect clip = SkIRect::MakeLTRB(dst.width() * tx / tilesX,
+                                             dst.height() * ty / tilesY,
+                                             dst.width() * (tx + 1) / tilesX,
+                                             dst.height() * (ty + 1) / tilesY);
+            tiles.push_back({picture, clip});
+        }
+    }
+    return SkPlayTilesParallel(dst, tiles.begin(), tiles.count(), executor, props);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkRasterTilePlayback_DEFINED
+#define SkRasterTilePlayback_DEFINED
+
+#include "include/core/SkPicture.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+
+class SkExecutor;
+class SkPixmap;
+struct SkSurfaceProps;
+
+/**
+ *  Parallel tile playback for raster destinations.
+ *
+ *  The GPU backend records draws on threads with SkDeferredDisplayListRecorder and replays the
+ *  DDLs on the direct context. Raster recording is already thread friendly -- each thread can
+ *  own an SkPictureRecorder -- but playback into a single surface is serial. These helpers
+ *  supply the missing half: each tile is replayed through its own canvas over the shared
+ *  pixels, restricted to a non-overlapping device clip, so the tiles can draw concurrently.
+ */
+
+struct SkRasterTile {
+    // Content for this tile, in the destination's coordinate space. Tiles may share a picture.
+    sk_sp<const SkPicture> fPicture;
+    // Device-space clip for this tile. Must not overlap any other tile's clip.
+    SkIRect fClip;
+};
+
+/**
+ *  Replays each tile's picture into 'dst', clipped to the tile's rect, fanning the tiles out
+ *  across 'executor' (or the default executor if nullptr). Blocks until every tile has drawn.
+ *  Returns false without drawing if 'dst' has no pixels or any pair of tile clips overlap.
+ */
+SK_SPI bool SkPlayTilesParallel(const SkPixmap& dst,
+                                const SkRasterTile tiles[],
+                                int count,
+                                SkExecutor* executor = nullptr,
+                                const SkSurfaceProps* props = nullptr);
+
+/**
+ *  Convenience for the common whole-frame case: splits 'dst' into a tilesX x tilesY grid and
+ *  replays 'picture' once per tile.
+ */
+SK_SPI bool SkPlayPictureTiledParallel(const SkPixmap& dst,
+                                       sk_sp<const SkPicture> picture,
+                                       int tilesX,
+                                       int tilesY,
+                                       SkExecutor* executor = nullptr,
+                                       const SkSurfaceProps* props = nullptr);
+
+#endif  // SkRasterTilePlayback_DEFINED
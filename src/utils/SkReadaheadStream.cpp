@@ -0,0 +1,136 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/utils/SkReadaheadStream.h"
+
+#include "include/core/SkExecutor.h"
+#include "include/private/SkSemaphore.h"
+#include "include/private/SkTemplates.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+class ReadaheadStream : public SkStream {
+public:
+    ReadaheadStream(std::unique_ptr<SkStream> source, size_t halfSize, SkExecutor* executor)
+            : fSource(std::move(source))
+            , fExecutor(executor ? executor : &SkExecutor::GetDefault())
+            , fHalfSize(halfSize)
+            , fStorage(2 * halfSize)
+            , fReadBuf(fStorage.get())
+            , fFillBuf(fStorage.get() + halfSize) {
+        this->scheduleFill();
+    }
+
+    ~ReadaheadStream() override {
+        // The pending fill reads fSource and fFillBuf from the executor; let it finish first.
+        if (fFillPending) {
+            fFillDone.wait();
+        }
+    }
+
+    size_t read(void* buffer, size_t size) override {
+        char* dst = static_cast<char*>(buffer);
+        size_t total = 0;
+        while (size > 0) {
+            if (fReadPos == fReadSize && !this->advanceBuffer()) {
+                break;
+            }
+            size_t n = std::min(size, fReadSize - fReadPos);
+            if (dst) {
+                memcpy(dst, fReadBuf + fReadPos, n);
+                dst += n;
+            }
+            fReadPos += n;
+            total += n;
+            size -= n;
+        }
+        return total;
+    }
+
+    size_t peek(void* buffer, size_t size) const override {
+        // Peeking may have to swap in the pending buffer, but never consumes bytes.
+        auto* mutableThis = const_cast<ReadaheadStream*>(this);
+        if (fReadPos == fReadSize && !mutableThis->advanceBuffer()) {
+            return 0;
+        }
+        size_t n = std::min(size, fReadSize - fReadPos);
+        memcpy(buffer, fReadBuf + fReadPos, n);
+        return n;
+    }
+
+    bool isAtEnd() const override {
+        if (fReadPos < fReadSize) {
+            return false;
+        }
+        return !const_cast<ReadaheadStream*>(this)->advanceBuffer();
+    }
+
+private:
+    void scheduleFill() {
+        SkASSERT(!fFillPending);
+        if (fSourceAtEnd) {
+            return;
+        }
+        fFillPending = true;
+        fExecutor->add([this] {
+            fFillSize = fSource->read(fFillBuf, fHalfSize);
+            // A zero-byte read also counts as the end, so a stalled source can't make us
+            // reschedule empty fills forever.
+            fSourceAtEnd = fSource->isAtEnd() || fFillSize == 0;
+            fFillDone.signal();
+        });
+    }
+
+    // Waits for the in-flight fill, swaps it in as the read buffer, and kicks off the next fill.
+    // Returns false once the source is exhausted. The semaphore orders the worker's writes to
+    // fFillSize/fFillBuf/fSourceAtEnd before the consumer reads them.
+    bool advanceBuffer() {
+        SkASSERT(fReadPos == fReadSize);
+        if (!fFillPending) {
+            return false;
+        }
+        fFillDone.wait();
+        fFillPending = false;
+        std::swap(fReadBuf, fFillBuf);
+        fReadSize = fFillSize;
+        fReadPos = 0;
+        this->scheduleFill();
+        return fReadSize > 0;
+    }
+
+    std::unique_ptr<SkStream> fSource;
+    SkExecutor*               fExecutor;
+    const size_t              fHalfSize;
+    SkAutoTMalloc<char>       fStorage;
+
+    char*  fReadBuf;
+    char*  fFillBuf;
+    size_t fReadPos  = 0;
+    size_t fReadSize = 0;
+
+    size_t      fFillSize    = 0;
+    bool        fFillPending = false;
+    bool        fSourceAtEnd = false;
+    SkSemaphore fFillDone;
+};
+
+}  // namespace
+
+std::unique_ptr<SkStream> SkReadaheadStream::Make(std::unique_ptr<SkStream> stream,
+                                                  size_t bufferSize,
+                                                  SkExecutor* executor) {
+    if (!stream) {
+        return nullptr;
+    }
+    // Each half must at least cover a codec's header sniffing; tiny buffers just add overhead.
+    size_t halfSize = std::max<size_t>(bufferSize / 2, 256);
+    return std::make_unique<ReadaheadStream>(std::move(stream), halfSize, executor);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/utils/SkTiledPictureRaster.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPixmap.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace SkTiledPictureRaster {
+
+bool Draw(const SkPixmap& dst, const SkPicture* picture, const SkMatrix* matrix,
+          int bands, SkExecutor* executor) {
+    if (!picture || dst.width() <= 0 || dst.height() <= 0 || !dst.addr()) {
+        return false;
+    }
+
+    if (bands <= 0) {
+        bands = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    bands = std::min(bands, dst.height());
+
+    // Ceil so the final band picks up any leftover rows.
+    const int rowsPerBand = (dst.height() + bands - 1) / bands;
+
+    SkTaskGroup taskGroup(executor ? *executor : SkExecutor::GetDefault());
+    taskGroup.batch(bands, [&](int i) {
+        const int top = i * rowsPerBand;
+        const SkIRect bandRect = SkIRect::MakeLTRB(0, top,
+                                                   dst.width(),
+                                                   std::min(top + rowsPerBand, dst.height()));
+        SkPixmap band;
+        if (!dst.extractSubset(&band, bandRect)) {
+            return;
+        }
+        // Each band owns its canvas (and so its device and blitters); the only
+        // state shared across workers is the immutable picture.
+        std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(band.info(),
+                                                                      band.writable_addr(),
+                                                                      band.rowBytes());
+        SkASSERT(canvas);
+        canvas->translate(0, -SkIntToScalar(top));
+        if (matrix) {
+            canvas->concat(*matrix);
+        }
+        canvas->drawPicture(picture);
+    });
+    taskGroup.wait();
+    return true;
+}
+
+}  // namespace SkTiledPictureRaster
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkTiledPictureRaster_DEFINED
+#define SkTiledPictureRaster_DEFINED
+
+#include "include/core/SkTypes.h"
+
+class SkExecutor;
+class SkMatrix;
+class SkPicture;
+class SkPixmap;
+
+namespace SkTiledPictureRaster {
+
+// Rasterize |picture| into |dst| by splitting the destination into |bands|
+// horizontal strips and replaying the picture into each strip in parallel on
+// |executor| (or the process-default executor when null). Each band gets its
+// own canvas, device and blitters over a disjoint row range of |dst|, so no
+// mutable state is shared between workers. |matrix| is applied before playback
+// if provided. Returns false if |dst| has no pixels or |picture| is null.
+//
+// Bands are clamped to the destination height; pass bands <= 0 to use one
+// band per hardware thread.
+bool Draw(const SkPixmap& dst, const SkPicture* picture, const SkMatrix* matrix,
+          int bands, SkExecutor* executor = nullptr);
+
+}  // namespace SkTiledPictureRaster
+
+#endif  // SkTiledPictureRaster_DEFINED
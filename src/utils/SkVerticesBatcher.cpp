@@ -0,0 +1,115 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/utils/SkVerticesBatcher.h"
+
+#include "include/core/SkCanvas.h"
+#include "src/core/SkVerticesPriv.h"
+
+bool SkVerticesBatcher::append(sk_sp<SkVertices> vertices, const SkMatrix& matrix) {
+    if (!vertices) {
+        return false;
+    }
+    SkVerticesPriv info = vertices->priv();
+    if (info.mode() != SkVertices::kTriangles_VertexMode || info.vertexCount() == 0) {
+        return false;
+    }
+    if (fEntries.empty()) {
+        fHasTexCoords = info.hasTexCoords();
+        fHasColors    = info.hasColors();
+    } else if (fHasTexCoords != info.hasTexCoords() || fHasColors != info.hasColors()) {
+        return false;
+    }
+    // Indices are uint16_t, so an indexed batch can only address 65536 vertices.
+    if ((fIndexed || info.hasIndices()) && fVertexCount + info.vertexCount() > 65536) {
+        return false;
+    }
+
+    fVertexCount += info.vertexCount();
+    fIndexed     |= info.hasIndices();
+    fEntries.push_back({std::move(vertices), matrix});
+    return true;
+}
+
+void SkVerticesBatcher::reset() {
+    fEntries.reset();
+    fVertexCount  = 0;
+    fIndexed      = false;
+    fHasTexCoords = false;
+    fHasColors    = false;
+}
+
+sk_sp<SkVertices> SkVerticesBatcher::detach() {
+    if (fEntries.empty()) {
+        return nullptr;
+    }
+
+    // A single unbatched mesh needs no rebuild if its transform is identity.
+    if (fEntries.count() == 1 && fEntries.front().fMatrix.isIdentity()) {
+        sk_sp<SkVertices> vertices = std::move(fEntries.front().fVertices);
+        this->reset();
+        return vertices;
+    }
+
+    int indexCount = 0;
+    if (fIndexed) {
+        // Unindexed triangles contribute identity indices so they can join an indexed batch.
+        for (const Entry& entry : fEntries) {
+            SkVerticesPriv info = entry.fVertices->priv();
+            indexCount += info.hasIndices() ? info.indexCount() : info.vertexCount();
+        }
+    }
+
+    uint32_t flags = (fHasTexCoords ? SkVertices::kHasTexCoords_BuilderFlag : 0)
+                   | (fHasColors    ? SkVertices::kHasColors_BuilderFlag    : 0);
+    SkVertices::Builder builder(SkVertices::kTriangles_VertexMode, fVertexCount, indexCount,
+                                flags);
+    if (!builder.isValid()) {
+        return nullptr;
+    }
+
+    SkPoint*  positions = builder.positions();
+    SkPoint*  texCoords = builder.texCoords();
+    SkColor*  colors    = builder.colors();
+    uint16_t* indices   = builder.indices();
+
+    int baseVertex = 0;
+    for (const Entry& entry : fEntries) {
+        SkVerticesPriv info = entry.fVertices->priv();
+        int n = info.vertexCount();
+
+        entry.fMatrix.mapPoints(positions + baseVertex, info.positions(), n);
+        if (texCoords) {
+            memcpy(texCoords + baseVertex, info.texCoords(), n * sizeof(SkPoint));
+        }
+        if (colors) {
+            memcpy(colors + baseVertex, info.colors(), n * sizeof(SkColor));
+        }
+        if (indices) {
+            if (info.hasIndices()) {
+                const uint16_t* src = info.indices();
+                for (int i = 0; i < info.indexCount(); ++i) {
+                    *indices++ = SkToU16(baseVertex + src[i]);
+                }
+            } else {
+                for (int i = 0; i < n; ++i) {
+                    *indices++ = SkToU16(baseVertex + i);
+                }
+            }
+        }
+        baseVertex += n;
+    }
+
+    this->reset();
+    return builder.detach();
+}
+
+void SkVerticesBatcher::draw(SkCanvas* canvas, SkBlendMode mode, const SkPaint& paint) {
+    if (sk_sp<SkVertices> vertices = this->detach()) {
+        canvas->drawVertices(vertices, mode, paint);
+    }
+}
@@ -10,7 +10,9 @@
 #include <memory>
 
 #include "include/core/SkStream.h"
+#include "include/private/SkTHash.h"
 #include "include/private/SkTo.h"
+#include "src/core/SkOpts.h"
 #include "src/xml/SkXMLParser.h"
 #include "src/xml/SkXMLWriter.h"
 
@@ -236,7 +238,7 @@ protected:
 
     bool onAddAttribute(const char name[], const char value[]) override {
         SkDOM::Attr* attr = fAttrs.append();
-        attr->fName = dupstr(fAlloc, name, strlen(name));
+        attr->fName = this->internString(name, strlen(name));
         attr->fValue = dupstr(fAlloc, value, strlen(value));
         return false;
     }
@@ -276,19 +278,49 @@ private:
             this->flushAttributes();
         }
         fNeedToFlush = true;
-        fElemName = dupstr(fAlloc, elem, elemSize);
+        // Element names repeat constantly (think <path> in icon sets), so share one arena copy;
+        // text content is generally unique and gets its own.
+        fElemName = type == SkDOM::kElement_Type ? this->internString(elem, elemSize)
+                                                 : dupstr(fAlloc, elem, elemSize);
         fElemType = type;
         ++fLevel;
     }
 
+    // An arena-backed string set so repeated element and attribute names are stored once per
+    // document instead of once per occurrence.
+    struct StringSpan {
+        const char* fPtr;
+        size_t      fLen;
+        bool operator==(const StringSpan& o) const {
+            return fLen == o.fLen && !memcmp(fPtr, o.fPtr, fLen);
+        }
+    };
+    struct Interned {
+        const char* fStr;
+        uint32_t    fLen;
+        static StringSpan GetKey(const Interned& s) { return {s.fStr, s.fLen}; }
+        static uint32_t Hash(const StringSpan& s) { return SkOpts::hash_fn(s.fPtr, s.fLen, 0); }
+    };
+
+    const char* internString(const char* src, size_t len) {
+        if (const Interned* found = fStrings.find(StringSpan{src, len})) {
+            return found->fStr;
+        }
+        const char* copy = dupstr(fAlloc, src, len);
+        fStrings.set(Interned{copy, SkToU32(len)});
+        return copy;
+    }
+
     SkTDArray<SkDOM::Node*> fParentStack;
     SkArenaAllocWithReset*  fAlloc;
     SkDOM::Node*            fRoot;
     bool                    fNeedToFlush;
 
+    SkTHashTable<Interned, StringSpan, Interned> fStrings;
+
     // state needed for flushAttributes()
     SkTDArray<SkDOM::Attr>  fAttrs;
-    char*                   fElemName;
+    const char*             fElemName;
     SkDOM::Type             fElemType;
     int                     fLevel;
 };
@@ -154,6 +154,33 @@ bool SkXMLParser::parse(SkStream& docStream)
     // Disable entity processing, to inhibit internal entity expansion. See expat CVE-2013-0340.
     XML_SetEntityDeclHandler(ctx.fXMLParser, entity_decl_handler);
 
+    auto reportError = [&ctx]() {
+        XML_Error error = XML_GetErrorCode(ctx.fXMLParser);
+        int line = XML_GetCurrentLineNumber(ctx.fXMLParser);
+        int column = XML_GetCurrentColumnNumber(ctx.fXMLParser);
+        const XML_LChar* errorString = XML_ErrorString(error);
+        SkDebugf("parse error @%d:%d: %d (%s).\n", line, column, error, errorString);
+    };
+
+    // If the document is already fully in memory, hand it to expat in one shot instead of
+    // copying it through fixed-size buffers; expat can then tokenize straight out of the
+    // caller's storage.
+    if (const char* base = static_cast<const char*>(docStream.getMemoryBase());
+        base && docStream.hasPosition() && docStream.hasLength()) {
+        const size_t offset = docStream.getPosition(),
+                     length = docStream.getLength();
+        if (offset <= length && SkTFitsIn<int32_t>(length - offset)) {
+            XML_Status status = XML_Parse(ctx.fXMLParser, base + offset,
+                                          SkToS32(length - offset), true);
+            if (XML_STATUS_ERROR == status) {
+                reportError();
+                return false;
+            }
+            (void)docStream.skip(length - offset);
+            return true;
+        }
+    }
+
     static constexpr int kBufferSize = 4096;
     bool done = false;
     do {
@@ -167,11 +194,7 @@ bool SkXMLParser::parse(SkStream& docStream)
         done = docStream.isAtEnd();
         XML_Status status = XML_ParseBuffer(ctx.fXMLParser, SkToS32(len), done);
         if (XML_STATUS_ERROR == status) {
-            XML_Error error = XML_GetErrorCode(ctx.fXMLParser);
-            int line = XML_GetCurrentLineNumber(ctx.fXMLParser);
-            int column = XML_GetCurrentColumnNumber(ctx.fXMLParser);
-            const XML_LChar* errorString = XML_ErrorString(error);
-            SkDebugf("parse error @%d:%d: %d (%s).\n", line, column, error, errorString);
+            reportError();
             return false;
         }
     } while (!done);
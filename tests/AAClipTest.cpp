@@ -19,8 +19,10 @@
 #include "include/private/SkMalloc.h"
 #include "include/utils/SkRandom.h"
 #include "src/core/SkAAClip.h"
+#include "src/core/SkBlitter.h"
 #include "src/core/SkMask.h"
 #include "src/core/SkRasterClip.h"
+#include "src/core/SkRasterClipStack.h"
 #include "tests/Test.h"
 
 #include <string.h>
@@ -420,6 +422,61 @@ static void test_crbug_422693(skiatest::Reporter* reporter) {
     rc.op(path, SkMatrix::I(), rc.getBounds(), SkRegion::kIntersect_Op, true);
 }
 
+namespace {
+// Records coverage into an A8 mask so blitter output can be compared to copyToMask().
+class CoverageBlitter : public SkBlitter {
+public:
+    CoverageBlitter(SkMask* mask) : fMask(mask) {}
+
+    void blitH(int x, int y, int width) override {
+        memset(fMask->getAddr8(x, y), 0xFF, width);
+    }
+
+    void blitAntiH(int x, int y, const SkAlpha aa[], const int16_t runs[]) override {
+        uint8_t* row = fMask->getAddr8(x, y);
+        for (int n = runs[0]; n > 0; n = runs[0]) {
+            memset(row, aa[0], n);
+            row += n;
+            runs += n;
+            aa += n;
+        }
+    }
+
+private:
+    SkMask* fMask;
+};
+}  // namespace
+
+// blitRect() walks the clip's RLE one row-span at a time; blitting an opaque rect over
+// the whole clip must still reproduce the clip's own coverage exactly.
+static void test_blit_rect(skiatest::Reporter* reporter) {
+    SkPath path;
+    path.addRoundRect(SkRect::MakeXYWH(0.25f, 0.5f, 100.5f, 80.25f), 20, 15);
+    SkAAClip clip;
+    clip.setPath(path);
+
+    SkMask expected;
+    clip.copyToMask(&expected);
+
+    SkMask actual;
+    actual.fFormat = SkMask::kA8_Format;
+    actual.fBounds = expected.fBounds;
+    actual.fRowBytes = actual.fBounds.width();
+    actual.fImage = SkMask::AllocImage(actual.computeImageSize());
+    sk_bzero(actual.fImage, actual.computeImageSize());
+
+    CoverageBlitter coverage(&actual);
+    SkAAClipBlitter blitter;
+    blitter.init(&coverage, &clip);
+    blitter.blitRect(actual.fBounds.fLeft, actual.fBounds.fTop,
+                     actual.fBounds.width(), actual.fBounds.height());
+
+    REPORTER_ASSERT(reporter, expected == actual);
+
+    SkMask::FreeImage(expected.fImage);
+    SkMask::FreeImage(actual.fImage);
+}
+
 static void test_huge(skiatest::Reporter* reporter) {
     SkAAClip clip;
     int big = 0x70000000;
@@ -429,6 +486,44 @@ static void test_huge(skiatest::Reporter* reporter) {
     clip.setRect(r);
 }
 
+DEF_TEST(RasterClipStackMemo, reporter) {
+    SkPath oval, star;
+    oval.addOval(SkRect::MakeXYWH(10.3f, 10.7f, 80, 60));
+    star.moveTo(50, 10);
+    star.lineTo(70, 90);
+    star.lineTo(10, 40);
+    star.lineTo(90, 40);
+    star.lineTo(30, 90);
+    star.close();
+
+    SkRasterClipStack stack(100, 100);
+
+    stack.save();
+    stack.clipPath(SkMatrix::I(), oval, SkClipOp::kIntersect, true);
+    const SkRasterClip firstOval = stack.rc();
+    stack.clipPath(SkMatrix::I(), star, SkClipOp::kIntersect, true);
+    const SkRasterClip firstChained = stack.rc();
+    stack.restore();
+
+    REPORTER_ASSERT(reporter, stack.rc().isRect());
+
+    // Replaying the identical clip sequence (memoized or not) must produce the same clips.
+    for (int i = 0; i < 3; ++i) {
+        stack.save();
+        stack.clipPath(SkMatrix::I(), oval, SkClipOp::kIntersect, true);
+        REPORTER_ASSERT(reporter, stack.rc() == firstOval);
+        stack.clipPath(SkMatrix::I(), star, SkClipOp::kIntersect, true);
+        REPORTER_ASSERT(reporter, stack.rc() == firstChained);
+        stack.restore();
+    }
+
+    // The same path under a different matrix may not reuse the memoized clip.
+    stack.save();
+    stack.clipPath(SkMatrix::Scale(0.5f, 0.5f), oval, SkClipOp::kIntersect, true);
+    REPORTER_ASSERT(reporter, !(stack.rc() == firstOval));
+    stack.restore();
+}
+
 DEF_TEST(AAClip, reporter) {
     test_empty(reporter);
     test_path_bounds(reporter);
@@ -438,6 +533,7 @@ DEF_TEST(AAClip, reporter) {
     test_regressions();
     test_nearly_integral(reporter);
     test_really_a_rect(reporter);
+    test_blit_rect(reporter);
     test_crbug_422693(reporter);
     test_huge(reporter);
 }
@@ -202,3 +202,71 @@ DEF_TEST(AndroidCodec_P3, r) {
     }};
     REPORTER_ASSERT(r, 0 == memcmp(&matrix, &kExpected, sizeof(skcms_Matrix3x3)));
 }
+
+static void test_box_filter(skiatest::Reporter* r, const char* path, int sampleSize) {
+    sk_sp<SkData> data = GetResourceAsData(path);
+    if (!data) {
+        return;
+    }
+
+    auto codec = SkAndroidCodec::MakeFromData(data);
+    if (!codec) {
+        ERRORF(r, "Could not create codec for %s", path);
+        return;
+    }
+
+    const SkImageInfo fullInfo = codec->getInfo().makeColorType(kRGBA_8888_SkColorType)
+                                                 .makeAlphaType(kPremul_SkAlphaType);
+    SkBitmap full;
+    full.allocPixels(fullInfo);
+    REPORTER_ASSERT(r, SkCodec::kSuccess ==
+            codec->codec()->getPixels(fullInfo, full.getPixels(), full.rowBytes()));
+
+    const SkISize sampledSize = codec->getSampledDimensions(sampleSize);
+    const SkImageInfo sampledInfo = fullInfo.makeDimensions(sampledSize);
+    SkBitmap sampled;
+    sampled.allocPixels(sampledInfo);
+
+    SkAndroidCodec::AndroidOptions options;
+    options.fSampleSize = sampleSize;
+    options.fBoxFilter = true;
+    REPORTER_ASSERT(r, SkCodec::kSuccess == codec->getAndroidPixels(
+            sampledInfo, sampled.getPixels(), sampled.rowBytes(), &options));
+
+    // Each output pixel must be the rounded average of the box it represents, where the
+    // last row and column of boxes absorb the remainder.
+    const int sampleX = full.width() / sampledSize.width();
+    const int sampleY = full.height() / sampledSize.height();
+    for (int y = 0; y < sampledSize.height(); y++) {
+        const int rowBegin = y * sampleY;
+        const int rowEnd = (y == sampledSize.height() - 1) ? full.height() : rowBegin + sampleY;
+        for (int x = 0; x < sampledSize.width(); x++) {
+            const int colBegin = x * sampleX;
+            const int colEnd = (x == sampledSize.width() - 1) ? full.width() : colBegin + sampleX;
+            uint32_t acc[4] = {0, 0, 0, 0};
+            for (int sy = rowBegin; sy < rowEnd; sy++) {
+                for (int sx = colBegin; sx < colEnd; sx++) {
+                    const uint8_t* px = (const uint8_t*) full.getAddr32(sx, sy);
+                    for (int c = 0; c < 4; c++) {
+                        acc[c] += px[c];
+                    }
+                }
+            }
+            const uint32_t count = (rowEnd - rowBegin) * (colEnd - colBegin);
+            const uint8_t* actual = (const uint8_t*) sampled.getAddr32(x, y);
+            for (int c = 0; c < 4; c++) {
+                if (actual[c] != (acc[c] + count / 2) / count) {
+                    ERRORF(r, "%s sample %d: mismatch at (%d, %d) channel %d", path, sampleSize,
+                           x, y, c);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+DEF_TEST(AndroidCodec_boxFilter, r) {
+    test_box_filter(r, "images/mandrill_512.png", 3);
+    test_box_filter(r, "images/mandrill_512.png", 7);
+    test_box_filter(r, "images/dog.jpg", 5);
+}
@@ -469,3 +469,66 @@ DEF_TEST(AnimatedImage, r) {
         }
     }
 }
+
+DEF_TEST(AnimatedImage_frameDamage, r) {
+    if (GetResourcePath().isEmpty()) {
+        return;
+    }
+    auto readPixels = [r](const sk_sp<SkImage>& image, SkBitmap* bm) {
+        bm->allocPixels(image->imageInfo().makeAlphaType(kPremul_SkAlphaType));
+        REPORTER_ASSERT(r, image->readPixels(bm->pixmap(), 0, 0));
+    };
+    for (const char* file : { "images/alphabetAnim.gif",
+                              "images/randPixelsAnim.gif",
+                              "images/stoplight.webp",
+                              "images/required.webp",
+                              }) {
+        auto data = GetResourceAsData(file);
+        if (!data) {
+            ERRORF(r, "Could not get %s", file);
+            continue;
+        }
+
+        auto androidCodec = SkAndroidCodec::MakeFromCodec(SkCodec::MakeFromData(data));
+        if (!androidCodec) {
+            ERRORF(r, "Could not create androidCodec for %s", file);
+            continue;
+        }
+
+        auto animatedImage = SkAnimatedImage::Make(std::move(androidCodec));
+        if (!animatedImage) {
+            ERRORF(r, "Could not create animated image for %s", file);
+            continue;
+        }
+        animatedImage->setRepetitionCount(0);
+
+        const SkIRect bounds = animatedImage->getBounds().roundOut();
+
+        // The first frame was decoded from scratch, so everything is damaged.
+        REPORTER_ASSERT(r, animatedImage->currentFrameDamage() == bounds);
+
+        SkBitmap prev;
+        readPixels(animatedImage->getCurrentFrame(), &prev);
+
+        while (animatedImage->decodeNextFrame() != SkAnimatedImage::kFinished) {
+            const SkIRect damage = animatedImage->currentFrameDamage();
+            REPORTER_ASSERT(r, bounds.contains(damage));
+
+            // Every pixel outside the reported damage must match the previous frame.
+            SkBitmap curr;
+            readPixels(animatedImage->getCurrentFrame(), &curr);
+            for (int y = 0; y < curr.height(); ++y) {
+                for (int x = 0; x < curr.width(); ++x) {
+                    if (!damage.contains(x, y) && curr.getColor(x, y) != prev.getColor(x, y)) {
+                        ERRORF(r, "%s: pixel (%i, %i) changed outside damage [%i %i %i %i]",
+                               file, x, y, damage.fLeft, damage.fTop,
+                               damage.fRight, damage.fBottom);
+                        y = curr.height();
+                        break;
+                    }
+                }
+            }
+            prev = curr;
+        }
+    }
+}
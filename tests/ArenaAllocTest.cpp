@@ -178,6 +178,26 @@ DEF_TEST(ArenaAlloc, r) {
     }
 }
 
+DEF_TEST(ArenaAllocWithResetOverflow, r) {
+    {
+        char block[1024];
+        SkArenaAllocWithReset arena{block, sizeof(block), 0};
+        REPORTER_ASSERT(r, !arena.hasOverflowed());
+        arena.makeArrayDefault<char>(64);
+        REPORTER_ASSERT(r, !arena.hasOverflowed());
+        arena.makeArrayDefault<char>(2048);
+        REPORTER_ASSERT(r, arena.hasOverflowed());
+        arena.reset();
+        REPORTER_ASSERT(r, !arena.hasOverflowed());
+    }
+    {
+        SkArenaAllocWithReset arena{1024};
+        REPORTER_ASSERT(r, !arena.hasOverflowed());
+        arena.makeArrayDefault<char>(16);
+        REPORTER_ASSERT(r, arena.hasOverflowed());
+    }
+}
+
 DEF_TEST(SkFibBlockSizes, r) {
     {
         SkFibBlockSizes<std::numeric_limits<uint32_t>::max()> fibs{1, 1};
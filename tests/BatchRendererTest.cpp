@@ -0,0 +1,70 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkPictureRecorder.h"
+#include "include/utils/SkBatchRenderer.h"
+#include "tests/Test.h"
+
+#include <atomic>
+#include <vector>
+
+static sk_sp<SkPicture> record_solid_picture(SkColor color) {
+    SkPictureRecorder recorder;
+    SkCanvas* canvas = recorder.beginRecording(8, 8);
+    canvas->clear(color);
+    return recorder.finishRecordingAsPicture();
+}
+
+static void test_batch_renderer(skiatest::Reporter* reporter, SkExecutor* executor) {
+    static constexpr int kJobs = 8;
+    const SkColor colors[] = { SK_ColorRED, SK_ColorGREEN, SK_ColorBLUE, SK_ColorYELLOW };
+
+    std::vector<SkBatchRenderer::Job> jobs(kJobs);
+    for (int i = 0; i < kJobs; ++i) {
+        jobs[i].fPicture = record_solid_picture(colors[i % SK_ARRAY_COUNT(colors)]);
+        jobs[i].fInfo = SkImageInfo::MakeN32Premul(8, 8);
+    }
+    // One job with no picture should report a null image but still count as completed.
+    jobs[kJobs - 1].fPicture = nullptr;
+
+    std::vector<sk_sp<SkImage>> results(kJobs);
+    std::atomic<int> progressCalls{0};
+
+    SkBatchRenderer::Options options;
+    options.fExecutor = executor;
+    SkBatchRenderer::Render(
+            jobs.data(), kJobs,
+            [&](int index, sk_sp<SkImage> image) { results[index] = std::move(image); },
+            [&](int completed, int total) {
+                REPORTER_ASSERT(reporter, completed >= 1 && completed <= total);
+                REPORTER_ASSERT(reporter, total == kJobs);
+                progressCalls.fetch_add(1);
+            },
+            options);
+
+    REPORTER_ASSERT(reporter, progressCalls.load() == kJobs);
+    REPORTER_ASSERT(reporter, !results[kJobs - 1]);
+    for (int i = 0; i < kJobs - 1; ++i) {
+        REPORTER_ASSERT(reporter, results[i]);
+        SkBitmap bm;
+        bm.allocPixels(SkImageInfo::MakeN32Premul(8, 8));
+        REPORTER_ASSERT(reporter, results[i]->readPixels(bm.pixmap(), 0, 0));
+        REPORTER_ASSERT(reporter, bm.getColor(4, 4) == colors[i % SK_ARRAY_COUNT(colors)]);
+    }
+}
+
+DEF_TEST(BatchRenderer, reporter) {
+    // Inline executor: the batch renders serially on this thread.
+    test_batch_renderer(reporter, nullptr);
+
+    // Threaded executor: jobs genuinely run concurrently and share pooled surfaces.
+    std::unique_ptr<SkExecutor> threadPool = SkExecutor::MakeFIFOThreadPool(4);
+    test_batch_renderer(reporter, threadPool.get());
+}
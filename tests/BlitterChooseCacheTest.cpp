@@ -0,0 +1,55 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSurface.h"
+#include "tests/Test.h"
+
+// A raster device memoizes its last chosen blitter across draws (SkBlitterChooseCache), so runs
+// of same-paint draws reuse one pipeline. Interleave paints, matrices, and draw types to check
+// that cache hits and re-keys both render correctly.
+DEF_TEST(BlitterChooseCache, reporter) {
+    auto surface = SkSurface::MakeRasterN32Premul(64, 64);
+    SkCanvas* canvas = surface->getCanvas();
+    canvas->clear(SK_ColorWHITE);
+
+    SkPaint red;
+    red.setColor(SK_ColorRED);
+    SkPaint blue;
+    blue.setColor(SK_ColorBLUE);
+
+    // Repeated same-paint fills (cache hits) ...
+    for (int i = 0; i < 8; ++i) {
+        canvas->drawRect(SkRect::MakeXYWH(i * 8, 0, 8, 8), red);
+    }
+    // ... a different paint (re-key) ...
+    canvas->drawRect(SkRect::MakeXYWH(0, 8, 64, 8), blue);
+    // ... the first paint again, and under a translated matrix.
+    canvas->drawRect(SkRect::MakeXYWH(0, 16, 64, 8), red);
+    canvas->save();
+    canvas->translate(0, 24);
+    canvas->drawRect(SkRect::MakeXYWH(0, 0, 64, 8), red);
+    canvas->restore();
+
+    SkBitmap readback;
+    readback.allocN32Pixels(64, 64);
+    REPORTER_ASSERT(reporter, surface->readPixels(readback.pixmap(), 0, 0));
+
+    auto check_row = [&](int y, SkColor color) {
+        for (int x = 0; x < 64; ++x) {
+            REPORTER_ASSERT(reporter, readback.getColor(x, y) == color,
+                            "(%d, %d) %08x != %08x", x, y, readback.getColor(x, y), color);
+        }
+    };
+    check_row( 4, SK_ColorRED);
+    check_row(12, SK_ColorBLUE);
+    check_row(20, SK_ColorRED);
+    check_row(28, SK_ColorRED);
+    check_row(36, SK_ColorWHITE);
+}
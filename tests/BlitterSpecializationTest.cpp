@@ -0,0 +1,60 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSurface.h"
+#include "include/private/SkColorData.h"
+#include "tests/Test.h"
+
+// The SK_BLITTER_SPECIALIZATIONS table (SkBlitterSpecializations.h) routes solid-color kSrc
+// draws on kN32 to a fused blitter. Check that it writes the same values Src blending demands:
+// full coverage replaces the dst outright (even with zero paint alpha), and partial coverage
+// lerps the dst toward the premultiplied src color.
+DEF_TEST(BlitterSpecialization_SolidSrc, reporter) {
+    auto surface = SkSurface::MakeRasterN32Premul(32, 32);
+    SkCanvas* canvas = surface->getCanvas();
+    SkBitmap readback;
+    readback.allocN32Pixels(32, 32);
+
+    // Full-coverage translucent Src: the dst must be replaced, not blended over.
+    canvas->clear(SK_ColorGREEN);
+    SkPaint paint;
+    paint.setColor(0x80FF0000);
+    paint.setBlendMode(SkBlendMode::kSrc);
+    canvas->drawRect(SkRect::MakeXYWH(4, 4, 16, 16), paint);
+
+    REPORTER_ASSERT(reporter, surface->readPixels(readback, 0, 0));
+    REPORTER_ASSERT(reporter, *readback.getAddr32(8, 8) == SkPreMultiplyColor(0x80FF0000));
+    REPORTER_ASSERT(reporter, *readback.getAddr32(24, 24) == SkPreMultiplyColor(SK_ColorGREEN));
+
+    // Zero-alpha Src must still write: it erases the covered pixels.
+    paint.setColor(0x00000000);
+    canvas->drawRect(SkRect::MakeXYWH(4, 4, 16, 16), paint);
+
+    REPORTER_ASSERT(reporter, surface->readPixels(readback, 0, 0));
+    REPORTER_ASSERT(reporter, *readback.getAddr32(8, 8) == 0);
+    REPORTER_ASSERT(reporter, *readback.getAddr32(24, 24) == SkPreMultiplyColor(SK_ColorGREEN));
+
+    // Antialiased half-coverage edge: each channel should land halfway between the dst and the
+    // premultiplied src color (within rounding).
+    canvas->clear(SK_ColorWHITE);
+    paint.setColor(0x80FF0000);
+    paint.setAntiAlias(true);
+    canvas->drawRect(SkRect::MakeXYWH(4.5f, 4, 16, 16), paint);
+
+    REPORTER_ASSERT(reporter, surface->readPixels(readback, 0, 0));
+    SkPMColor edge = *readback.getAddr32(4, 8);
+    SkPMColor src = SkPreMultiplyColor(0x80FF0000);
+    SkPMColor dst = SkPreMultiplyColor(SK_ColorWHITE);
+    for (int shift = 0; shift <= 24; shift += 8) {
+        int expected = (((src >> shift) & 0xFF) + ((dst >> shift) & 0xFF)) / 2;
+        int actual = (edge >> shift) & 0xFF;
+        REPORTER_ASSERT(reporter, SkTAbs(actual - expected) <= 1);
+    }
+}
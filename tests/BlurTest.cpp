@@ -33,6 +33,7 @@
 #include "src/core/SkBlurMask.h"
 #include "src/core/SkGpuBlurUtils.h"
 #include "src/core/SkMask.h"
+#include "src/core/SkMaskBlurFilter.h"
 #include "src/core/SkMaskFilterBase.h"
 #include "src/core/SkMathPriv.h"
 #include "src/effects/SkEmbossMaskFilter.h"
@@ -572,6 +573,51 @@ DEF_GPUTEST_FOR_RENDERING_CONTEXTS(BlurMaskBiggerThanDest, reporter, ctxInfo) {
     REPORTER_ASSERT(reporter, readback.getColor(31, 31) == SK_ColorBLACK);
 }
 
+DEF_TEST(BlurMaskStripConsistency, reporter) {
+    // SkMaskBlurFilter blurs eight rows per vectorized strip and finishes the leftover rows
+    // with a scalar scan. Blurring a vertically flipped mask must give the vertically flipped
+    // blur; since the flip changes which rows fall in strips and which in the scalar remainder,
+    // any disagreement between the two scans breaks the symmetry.
+    const int w = 25,
+              h = 19;  // not a multiple of eight, so both scans run
+
+    SkMask src;
+    src.fBounds = SkIRect::MakeWH(w, h);
+    src.fFormat = SkMask::kA8_Format;
+    src.fRowBytes = w;
+    src.fImage = SkMask::AllocImage(src.computeTotalImageSize());
+
+    SkMask srcFlipped = src;
+    srcFlipped.fImage = SkMask::AllocImage(srcFlipped.computeTotalImageSize());
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint8_t alpha = (x * 7 + y * 13) & 0xFF;
+            src.fImage[y * w + x] = alpha;
+            srcFlipped.fImage[(h - 1 - y) * w + x] = alpha;
+        }
+    }
+
+    SkMaskBlurFilter filter{5.0, 5.0};  // sigma >= 2 selects the box blur engine
+    SkMask dst, dstFlipped;
+    filter.blur(src, &dst);
+    filter.blur(srcFlipped, &dstFlipped);
+
+    REPORTER_ASSERT(reporter, dst.fBounds.size() == dstFlipped.fBounds.size());
+    int dstW = dst.fBounds.width(),
+        dstH = dst.fBounds.height();
+    for (int y = 0; y < dstH; y++) {
+        const uint8_t* row        = &dst.fImage[y * dst.fRowBytes];
+        const uint8_t* rowFlipped = &dstFlipped.fImage[(dstH - 1 - y) * dstFlipped.fRowBytes];
+        REPORTER_ASSERT(reporter, memcmp(row, rowFlipped, dstW) == 0);
+    }
+
+    SkMask::FreeImage(src.fImage);
+    SkMask::FreeImage(srcFlipped.fImage);
+    SkMask::FreeImage(dst.fImage);
+    SkMask::FreeImage(dstFlipped.fImage);
+}
+
 DEF_TEST(zero_blur, reporter) {
     SkBitmap alpha, bitmap;
 
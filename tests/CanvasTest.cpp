@@ -461,6 +461,37 @@ DEF_TEST(Canvas_SaveState, reporter) {
     REPORTER_ASSERT(reporter, 1 == canvas.getSaveCount());
 }
 
+// Matrix-only save levels defer the device's clip-stack save; make sure clip state still
+// restores correctly when matrix-only and clipping levels are interleaved.
+DEF_TEST(Canvas_DeferredDeviceSave, reporter) {
+    SkCanvas canvas(100, 100);
+    canvas.clipRect(SkRect::MakeWH(80, 80));
+    const SkIRect base = canvas.getDeviceClipBounds();
+
+    // Matrix-only save/restore leaves the clip untouched.
+    canvas.save();
+    canvas.translate(10, 10);
+    canvas.rotate(45);
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == base);
+    canvas.restore();
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == base);
+
+    // A clip in a nested level restores through an enclosing matrix-only level.
+    canvas.save();
+    canvas.translate(5, 5);
+    canvas.save();
+    canvas.clipRect(SkRect::MakeWH(20, 20));
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == SkIRect::MakeXYWH(5, 5, 20, 20));
+    canvas.restore();
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == base);
+
+    // The enclosing level can start clipping after the inner level has been restored.
+    canvas.clipRect(SkRect::MakeWH(40, 40));
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == SkIRect::MakeXYWH(5, 5, 40, 40));
+    canvas.restore();
+    REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == base);
+}
+
 DEF_TEST(Canvas_ClipEmptyPath, reporter) {
     SkCanvas canvas(10, 10);
     canvas.save();
@@ -760,3 +791,48 @@ DEF_TEST(canvas_markctm, reporter) {
     // found the previous one
     REPORTER_ASSERT(reporter, canvas.findMarkedCTM(id_a, &m) && m == a1);
 }
+
+DEF_TEST(Canvas_RasterEdgeAAImageSet, reporter) {
+    // Use a lazy (picture-backed) image so the raster image-set path exercises its
+    // resolve-each-unique-image-once fast path, then check it matches per-entry drawImageRect.
+    SkPictureRecorder recorder;
+    SkCanvas* rec = recorder.beginRecording(SkRect::MakeWH(16, 16));
+    rec->clear(SK_ColorGREEN);
+    SkPaint red;
+    red.setColor(SK_ColorRED);
+    rec->drawRect(SkRect::MakeXYWH(0, 0, 8, 8), red);
+    sk_sp<SkImage> image = SkImage::MakeFromPicture(recorder.finishRecordingAsPicture(),
+                                                    {16, 16}, nullptr, nullptr,
+                                                    SkImage::BitDepth::kU8,
+                                                    SkColorSpace::MakeSRGB());
+    REPORTER_ASSERT(reporter, image && image->isLazyGenerated());
+
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(40, 40);
+    auto setSurface = SkSurface::MakeRaster(info);
+    auto refSurface = SkSurface::MakeRaster(info);
+    setSurface->getCanvas()->clear(SK_ColorWHITE);
+    refSurface->getCanvas()->clear(SK_ColorWHITE);
+
+    SkTArray<SkCanvas::ImageSetEntry> entries;
+    for (int i = 0; i < 4; ++i) {
+        SkRect dst = SkRect::MakeXYWH(17.f * (i % 2), 17.f * (i / 2), 16, 16);
+        entries.push_back(SkCanvas::ImageSetEntry(image, SkRect::MakeWH(16, 16), dst,
+                                                  /*alpha=*/1.f, SkCanvas::kNone_QuadAAFlags));
+        refSurface->getCanvas()->drawImageRect(image.get(), SkRect::MakeWH(16, 16), dst,
+                                               SkSamplingOptions(), nullptr,
+                                               SkCanvas::kFast_SrcRectConstraint);
+    }
+    setSurface->getCanvas()->experimental_DrawEdgeAAImageSet(
+            entries.begin(), entries.count(), nullptr, nullptr, SkSamplingOptions(), nullptr,
+            SkCanvas::kFast_SrcRectConstraint);
+
+    SkBitmap setBM, refBM;
+    setBM.allocPixels(info);
+    refBM.allocPixels(info);
+    REPORTER_ASSERT(reporter, setSurface->readPixels(setBM, 0, 0));
+    REPORTER_ASSERT(reporter, refSurface->readPixels(refBM, 0, 0));
+    for (int y = 0; y < info.height(); ++y) {
+        REPORTER_ASSERT(reporter, 0 == memcmp(setBM.getAddr32(0, y), refBM.getAddr32(0, y),
+                                              info.width() * sizeof(uint32_t)));
+    }
+}
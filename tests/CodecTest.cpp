@@ -1839,3 +1839,58 @@ DEF_TEST(Codec_noConversion, r) {
         REPORTER_ASSERT(r, bm.getColor(0, 0) == rec.color);
     }
 }
+
+static void test_region_decode_session(skiatest::Reporter* r, const char* path) {
+    std::unique_ptr<SkStream> stream(GetResourceAsStream(path));
+    if (!stream) {
+        return;
+    }
+    std::unique_ptr<SkCodec> codec(SkCodec::MakeFromStream(std::move(stream)));
+    if (!codec) {
+        ERRORF(r, "Unable to create codec '%s'.", path);
+        return;
+    }
+
+    const SkImageInfo info = codec->getInfo().makeColorType(kN32_SkColorType)
+                                             .makeAlphaType(kPremul_SkAlphaType);
+    SkBitmap full;
+    full.allocPixels(info);
+    REPORTER_ASSERT(r, SkCodec::kSuccess ==
+            codec->getPixels(info, full.getPixels(), full.rowBytes()));
+
+    const int w = info.width();
+    const int h = info.height();
+    const SkIRect regions[] = {
+        SkIRect::MakeXYWH(w / 4, 0,         w / 2, h / 4),  // top
+        SkIRect::MakeXYWH(w / 4, h / 4,     w / 2, h / 4),  // adjacent below: continues
+        SkIRect::MakeXYWH(w / 4, 3 * h / 4, w / 2, h / 4),  // gap below: skips forward
+        SkIRect::MakeXYWH(w / 4, h / 2,     w / 2, h / 4),  // above: forces a restart
+        SkIRect::MakeXYWH(0,     h / 2,     w / 4, h / 4),  // new columns: forces a restart
+    };
+
+    SkCodec::RegionDecodeSession session(codec.get());
+    for (const SkIRect& region : regions) {
+        SkBitmap tile;
+        tile.allocPixels(info.makeDimensions(region.size()));
+        REPORTER_ASSERT(r, SkCodec::kSuccess ==
+                session.decodeRegion(tile.info(), tile.getPixels(), tile.rowBytes(), region));
+        for (int y = 0; y < region.height(); y++) {
+            REPORTER_ASSERT(r, !memcmp(tile.getAddr(0, y),
+                                       full.getAddr(region.left(), region.top() + y),
+                                       tile.info().minRowBytes()));
+        }
+    }
+
+    // Out of bounds and mismatched dimensions are rejected up front.
+    SkBitmap tile;
+    tile.allocPixels(info.makeWH(w / 2, h / 4));
+    REPORTER_ASSERT(r, SkCodec::kInvalidParameters == session.decodeRegion(
+            tile.info(), tile.getPixels(), tile.rowBytes(), SkIRect::MakeXYWH(w, 0, w / 2, h / 4)));
+    REPORTER_ASSERT(r, SkCodec::kInvalidParameters == session.decodeRegion(
+            tile.info(), tile.getPixels(), tile.rowBytes(), SkIRect::MakeWH(w / 4, h / 4)));
+}
+
+DEF_TEST(Codec_regionDecodeSession, r) {
+    test_region_decode_session(r, "images/mandrill_512_q075.jpg");
+    test_region_decode_session(r, "images/mandrill_512.png");
+}
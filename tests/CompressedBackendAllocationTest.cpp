@@ -333,3 +333,53 @@ DEF_GPUTEST_FOR_RENDERING_CONTEXTS(CompressedBackendAllocationTest, reporter, ct
         }
     }
 }
+
+static int gTranscodeCount = 0;
+
+static sk_sp<SkData> zero_fill_transcoder(sk_sp<SkData>, int width, int height,
+                                          SkImage::CompressionType,
+                                          SkImage::CompressionType dstType) {
+    gTranscodeCount++;
+    size_t size = SkCompressedDataSize(dstType, {width, height}, nullptr, /*mipMapped=*/false);
+    sk_sp<SkData> data = SkData::MakeUninitialized(size);
+    memset(data->writable_data(), 0, size);
+    return data;
+}
+
+// Verify that MakeTextureFromCompressed routes unsupported compression types through the
+// registered transcoder instead of decompressing.
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(CompressedDataTranscoderTest, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+
+    // Find a compression type the device cannot sample and one that it can.
+    SkImage::CompressionType srcType = SkImage::CompressionType::kNone;
+    SkImage::CompressionType dstType = SkImage::CompressionType::kNone;
+    for (int i = 1; i < SkImage::kCompressionTypeCount; ++i) {
+        auto ct = static_cast<SkImage::CompressionType>(i);
+        if (dContext->compressedBackendFormat(ct).isValid()) {
+            dstType = ct;
+        } else {
+            srcType = ct;
+        }
+    }
+    if (SkImage::CompressionType::kNone == srcType || SkImage::CompressionType::kNone == dstType) {
+        // The device supports every compression type (or none); there is nothing to transcode.
+        return;
+    }
+
+    gTranscodeCount = 0;
+    SkImage::CompressedDataTranscoder prevTranscoder =
+            SkImage::SetCompressedDataTranscoder(zero_fill_transcoder);
+
+    size_t srcSize = SkCompressedDataSize(srcType, {32, 32}, nullptr, /*mipMapped=*/false);
+    sk_sp<SkData> srcData = SkData::MakeUninitialized(srcSize);
+    memset(srcData->writable_data(), 0, srcSize);
+
+    sk_sp<SkImage> image = SkImage::MakeTextureFromCompressed(dContext, std::move(srcData),
+                                                              32, 32, srcType);
+    REPORTER_ASSERT(reporter, image);
+    REPORTER_ASSERT(reporter, image && image->isTextureBacked());
+    REPORTER_ASSERT(reporter, gTranscodeCount >= 1);
+
+    SkImage::SetCompressedDataTranscoder(prevTranscoder);
+}
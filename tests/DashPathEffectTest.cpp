@@ -141,3 +141,31 @@ DEF_TEST(DashCrazy_crbug_875494, r) {
     paint.setPathEffect(SkDashPathEffect::Make(vals, N, 222));
     paint.getFillPath(path, &path2, &cull);
 }
+
+// The dashed result for non-line, non-volatile paths is cached in SkResourceCache. Check that a
+// repeated filter returns the same path, and that marking the source volatile bypasses the cache.
+DEF_TEST(DashPathEffectTest_cached_result, r) {
+    SkScalar intervals[4] = { 10, 4, 2, 4 };
+    sk_sp<SkPathEffect> dash(SkDashPathEffect::Make(intervals, 4, 3));
+
+    SkPath path;
+    path.moveTo(0, 0);
+    path.quadTo(50, 100, 100, 0);
+    path.cubicTo(150, -100, 200, 100, 250, 0);
+
+    SkPaint paint;
+    paint.setStyle(SkPaint::kStroke_Style);
+    paint.setStrokeWidth(2);
+    paint.setPathEffect(dash);
+
+    SkPath first, second;
+    REPORTER_ASSERT(r, paint.getFillPath(path, &first));
+    REPORTER_ASSERT(r, paint.getFillPath(path, &second));
+    REPORTER_ASSERT(r, first == second);
+
+    SkPath volatilePath(path);
+    volatilePath.setIsVolatile(true);
+    SkPath uncached;
+    REPORTER_ASSERT(r, paint.getFillPath(volatilePath, &uncached));
+    REPORTER_ASSERT(r, uncached == first);
+}
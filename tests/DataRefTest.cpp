@@ -13,6 +13,7 @@
 #include "include/core/SkTypes.h"
 #include "include/private/SkTArray.h"
 #include "include/private/SkTemplates.h"
+#include "src/core/SkDataPriv.h"
 #include "src/core/SkOSFile.h"
 #include "src/core/SkTaskGroup.h"
 #include "src/utils/SkOSPath.h"
@@ -225,3 +226,52 @@ DEF_TEST(Data_empty, reporter) {
         }
     }
 }
+
+DEF_TEST(Data_small_slab, reporter) {
+    // Churn lots of small datas through the slab allocator; contents must stay intact and
+    // chunks must be recycled without confusing slab and malloc storage.
+    constexpr int N = 1000;
+    sk_sp<SkData> datas[N];
+    for (int rounds = 0; rounds < 3; rounds++) {
+        for (int i = 0; i < N; i++) {
+            uint32_t buffer[16];
+            size_t size = 1 + (i % sizeof(buffer));
+            memset(buffer, i & 0xff, sizeof(buffer));
+            datas[i] = SkData::MakeWithCopy(buffer, size);
+        }
+        // Free every other one to exercise the free list, then refill.
+        for (int i = 0; i < N; i += 2) {
+            datas[i] = SkData::MakeUninitialized(64);
+            memset(datas[i]->writable_data(), i & 0xff, 64);
+        }
+        for (int i = 0; i < N; i++) {
+            const uint8_t* bytes = datas[i]->bytes();
+            for (size_t b = 0; b < datas[i]->size(); b++) {
+                REPORTER_ASSERT(reporter, bytes[b] == (i & 0xff));
+            }
+        }
+    }
+}
+
+DEF_TEST(Data_interning, reporter) {
+    const char* word = "ImageB";
+    sk_sp<SkData> a = SkMakeInternedData(word, strlen(word));
+    sk_sp<SkData> b = SkMakeInternedData(word, strlen(word));
+    REPORTER_ASSERT(reporter, a == b);
+    REPORTER_ASSERT(reporter, a->size() == strlen(word));
+    REPORTER_ASSERT(reporter, 0 == memcmp(a->data(), word, strlen(word)));
+
+    sk_sp<SkData> c = SkMakeInternedData("ImageC", 6);
+    REPORTER_ASSERT(reporter, c != a);
+    REPORTER_ASSERT(reporter, !c->equals(a.get()));
+
+    // Beyond the interning limit identical contents get distinct copies.
+    char big[100];
+    memset(big, 'x', sizeof(big));
+    sk_sp<SkData> d = SkMakeInternedData(big, sizeof(big));
+    sk_sp<SkData> e = SkMakeInternedData(big, sizeof(big));
+    REPORTER_ASSERT(reporter, d != e);
+    REPORTER_ASSERT(reporter, d->equals(e.get()));
+
+    REPORTER_ASSERT(reporter, SkMakeInternedData(nullptr, 0)->size() == 0);
+}
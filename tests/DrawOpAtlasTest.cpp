@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkFont.h"
@@ -15,6 +16,7 @@
 #include "include/core/SkPoint.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSize.h"
+#include "include/core/SkSurface.h"
 #include "include/core/SkTypes.h"
 #include "include/gpu/GrBackendSurface.h"
 #include "include/gpu/GrDirectContext.h"
@@ -306,3 +308,50 @@ DEF_GPUTEST(GrDrawOpAtlasConfig_Basic, reporter, options) {
     test_atlas_config(reporter, 65536, 0, kA8_GrMaskFormat,
                       { 512, 512 }, { 256, 256 });
 }
+
+// Verifies that the glyph atlas budget and buffer-map threshold can be retuned on a live
+// context: the getters report the effective values and text still renders after a resize.
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(DirectContextLiveTuning, reporter, ctxInfo) {
+    auto context = ctxInfo.directContext();
+
+    REPORTER_ASSERT(reporter, context->getGlyphCacheTextureMaximumBytes() ==
+                              GrContextOptions{}.fGlyphCacheTextureMaximumBytes);
+
+    auto surface = SkSurface::MakeRenderTarget(
+            context, SkBudgeted::kNo,
+            SkImageInfo::MakeN32Premul(128, 64));
+    if (!surface) {
+        return;
+    }
+
+    SkPaint paint;
+    paint.setColor(SK_ColorBLACK);
+    SkFont font;
+    font.setEdging(SkFont::Edging::kAntiAlias);
+
+    auto drawText = [&] {
+        surface->getCanvas()->clear(SK_ColorWHITE);
+        surface->getCanvas()->drawString("resize me", 10, 32, font, paint);
+        surface->flushAndSubmit();
+    };
+
+    drawText();
+
+    // Shrink the atlas budget; the live atlases are dropped and must repopulate.
+    context->setGlyphCacheTextureMaximumBytes(256 * 1024);
+    REPORTER_ASSERT(reporter, context->getGlyphCacheTextureMaximumBytes() == 256 * 1024);
+    drawText();
+
+    // And grow it again.
+    context->setGlyphCacheTextureMaximumBytes(4 * 1024 * 1024);
+    REPORTER_ASSERT(reporter, context->getGlyphCacheTextureMaximumBytes() == 4 * 1024 * 1024);
+    drawText();
+
+    size_t defaultThreshold = context->getBufferMapThreshold();
+    context->setBufferMapThreshold(1 << 16);
+    REPORTER_ASSERT(reporter, context->getBufferMapThreshold() == (1 << 16));
+    drawText();
+
+    context->setBufferMapThreshold(-1);
+    REPORTER_ASSERT(reporter, context->getBufferMapThreshold() == defaultThreshold);
+}
@@ -371,3 +371,64 @@ DEF_TEST(DrawPath, reporter) {
     test_big_aa_rect(reporter);
     test_halfway();
 }
+
+// Cached and uncached fills of the same geometry must produce identical pixels. A volatile path
+// opts out of the coverage-mask cache, so it exercises the direct scan conversion path.
+DEF_TEST(DrawPath_maskCacheEquivalence, reporter) {
+    SkPath path;
+    path.moveTo(8.25f, 4.5f);
+    path.cubicTo(40.0f, 2.0f, 55.5f, 30.25f, 60.0f, 58.0f);
+    path.quadTo(32.75f, 50.0f, 20.5f, 61.5f);
+    path.cubicTo(10.0f, 48.75f, 30.0f, 40.0f, 12.25f, 30.5f);
+    path.quadTo(2.5f, 22.0f, 8.25f, 4.5f);
+    path.close();
+
+    SkPath volatilePath = path;
+    volatilePath.setIsVolatile(true);
+
+    SkPaint paint;
+    paint.setAntiAlias(true);
+
+    auto draw = [&](const SkPath& p, const SkMatrix& matrix) {
+        SkBitmap bm;
+        bm.allocN32Pixels(96, 96);
+        SkCanvas canvas(bm);
+        canvas.clear(SK_ColorWHITE);
+        canvas.concat(matrix);
+        canvas.drawPath(p, paint);
+        return bm;
+    };
+
+    const SkMatrix matrices[] = {
+        SkMatrix::I(),
+        SkMatrix::Translate(5.0f, 3.0f),        // reuses the first draw's mask, offset
+        SkMatrix::Translate(5.25f, 3.75f),      // new subpixel phase
+        SkMatrix::RotateDeg(30.0f, {32, 32}),
+    };
+    // The canonical and device matrices can round vertices differently in the last ulp, so
+    // allow the coverage to differ by one step; anything more is a placement bug.
+    auto nearlyEqual = [](const SkBitmap& a, const SkBitmap& b) {
+        for (int y = 0; y < a.height(); ++y) {
+            for (int x = 0; x < a.width(); ++x) {
+                SkPMColor ca = *a.getAddr32(x, y);
+                SkPMColor cb = *b.getAddr32(x, y);
+                for (int shift = 0; shift < 32; shift += 8) {
+                    int da = (ca >> shift) & 0xFF;
+                    int db = (cb >> shift) & 0xFF;
+                    if (SkTAbs(da - db) > 1) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    };
+
+    for (const SkMatrix& matrix : matrices) {
+        SkBitmap cold = draw(path, matrix);          // may populate the cache
+        SkBitmap warm = draw(path, matrix);          // may hit the cache
+        SkBitmap direct = draw(volatilePath, matrix);
+        REPORTER_ASSERT(reporter, nearlyEqual(cold, direct));
+        REPORTER_ASSERT(reporter, nearlyEqual(warm, direct));
+    }
+}
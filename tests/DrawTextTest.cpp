@@ -108,6 +108,46 @@ DEF_TEST(DrawText_dashout, reporter) {
     REPORTER_ASSERT(reporter, compare(drawDashedTextBitmap, size, emptyBitmap, size));
 }
 
+/** The raster mask path coalesces a run of A8 glyph masks into a single blit. Drawing the glyphs
+    one at a time never coalesces, so the two draws must produce identical pixels. */
+DEF_TEST(DrawText_maskRunCoalesce, reporter) {
+    SkIRect size = SkIRect::MakeWH(256, 64);
+
+    SkBitmap runBitmap;
+    create(&runBitmap, size);
+    SkCanvas runCanvas(runBitmap);
+
+    SkBitmap glyphBitmap;
+    create(&glyphBitmap, size);
+    SkCanvas glyphCanvas(glyphBitmap);
+
+    SkFont font(nullptr, 16);
+    font.setEdging(SkFont::Edging::kAntiAlias);
+
+    SkPaint paint;
+    paint.setColor(SK_ColorBLACK);
+
+    static constexpr char text[] = "Hamburgefons";
+    static constexpr size_t len = sizeof(text) - 1;
+    SkGlyphID glyphs[len];
+    const int count = font.textToGlyphs(text, len, SkTextEncoding::kUTF8, glyphs, len);
+    SkScalar widths[len];
+    font.getWidths(glyphs, count, widths);
+
+    runCanvas.drawColor(bgColor);
+    runCanvas.drawSimpleText(text, len, SkTextEncoding::kUTF8, 10.0f, 40.0f, font, paint);
+
+    glyphCanvas.drawColor(bgColor);
+    SkScalar x = 10.0f;
+    for (int i = 0; i < count; ++i) {
+        glyphCanvas.drawSimpleText(&glyphs[i], sizeof(SkGlyphID), SkTextEncoding::kGlyphID,
+                                   x, 40.0f, font, paint);
+        x += widths[i];
+    }
+
+    REPORTER_ASSERT(reporter, compare(runBitmap, size, glyphBitmap, size));
+}
+
 // Test drawing text at some unusual coordinates.
 // We measure success by not crashing or asserting.
 DEF_TEST(DrawText_weirdCoordinates, r) {
@@ -12,6 +12,7 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColorPriv.h"
 #include "include/core/SkEncodedImageFormat.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkSurface.h"
@@ -332,6 +333,35 @@ DEF_TEST(Encode_PngOptions, r) {
     REPORTER_ASSERT(r, almost_equals(bm0, bm2, 0));
 }
 
+DEF_TEST(Encode_PngParallel, r) {
+    SkBitmap bitmap;
+    if (!GetResourceAsBitmap("images/mandrill_512.png", &bitmap)) {
+        return;
+    }
+
+    SkPixmap src;
+    if (!bitmap.peekPixels(&src)) {
+        REPORTER_ASSERT(r, false);
+        return;
+    }
+
+    SkDynamicMemoryWStream serialDst, parallelDst;
+    SkPngEncoder::Options options;
+    REPORTER_ASSERT(r, SkPngEncoder::Encode(&serialDst, src, options));
+
+    auto executor = SkExecutor::MakeFIFOThreadPool(8);
+    options.fExecutor = executor.get();
+    REPORTER_ASSERT(r, SkPngEncoder::Encode(&parallelDst, src, options));
+
+    // The parallel encode pays a full flush per slice but must still decode to the same pixels.
+    sk_sp<SkData> serialData = serialDst.detachAsData();
+    sk_sp<SkData> parallelData = parallelDst.detachAsData();
+    SkBitmap serialBm, parallelBm;
+    SkImage::MakeFromEncoded(serialData)->asLegacyBitmap(&serialBm);
+    SkImage::MakeFromEncoded(parallelData)->asLegacyBitmap(&parallelBm);
+    REPORTER_ASSERT(r, almost_equals(serialBm, parallelBm, 0));
+}
+
 #ifndef SK_BUILD_FOR_GOOGLE3
 DEF_TEST(Encode_WebpQuality, r) {
     SkBitmap bm;
@@ -11,6 +11,8 @@
 #include "src/core/SkScan.h"
 #include "tests/Test.h"
 
+#include <vector>
+
 struct FakeBlitter : public SkBlitter {
     FakeBlitter()
         : m_blitCount(0) { }
@@ -46,3 +48,45 @@ DEF_TEST(FillPathInverse, reporter) {
 
     REPORTER_ASSERT(reporter, blitter.m_blitCount == expected_lines);
 }
+
+struct SpanRecordingBlitter : public SkBlitter {
+    std::vector<SkIRect> m_spans;
+
+    void blitH(int x, int y, int width) override {
+        m_spans.push_back(SkIRect::MakeXYWH(x, y, width, 1));
+    }
+
+    void blitRect(int x, int y, int width, int height) override {
+        m_spans.push_back(SkIRect::MakeXYWH(x, y, width, height));
+    }
+
+    void blitAntiH(int x, int y, const SkAlpha antialias[], const int16_t runs[]) override {
+      SkDEBUGFAIL("blitAntiH not implemented");
+    }
+};
+
+// Cached edge lists (served on repeat fills of the same non-volatile path) must
+// produce the same spans as a fresh edge build.
+DEF_TEST(FillPathCachedEdges, reporter) {
+    SkPath path;
+    for (int i = 0; i < 10; ++i) {
+        path.moveTo(10.0f + i, 5.0f)
+            .quadTo(50.0f, 20.0f + 7 * i, 90.0f - i, 80.0f)
+            .cubicTo(70.0f, 90.0f, 30.0f + 3 * i, 60.0f, 15.0f, 95.0f - i)
+            .close();
+    }
+    SkIRect clip = SkIRect::MakeWH(100, 100);
+
+    SpanRecordingBlitter first, second;
+    SkScan::FillPath(path, clip, &first);    // builds edges, populates the cache
+    SkScan::FillPath(path, clip, &second);   // served from the cache
+
+    SkPath volatilePath = path;
+    volatilePath.setIsVolatile(true);
+    SpanRecordingBlitter uncached;
+    SkScan::FillPath(volatilePath, clip, &uncached);
+
+    REPORTER_ASSERT(reporter, !first.m_spans.empty());
+    REPORTER_ASSERT(reporter, first.m_spans == second.m_spans);
+    REPORTER_ASSERT(reporter, first.m_spans == uncached.m_spans);
+}
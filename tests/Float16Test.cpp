@@ -70,3 +70,31 @@ DEF_TEST(SkFloatToHalf_finite_ftz, r) {
                            actual == alternate || actual == alternate - 1);
     }
 }
+
+DEF_TEST(SkOpts_halfs_to_floats, r) {
+    // Exercise the span kernels across sizes that cover both the vector body and the scalar
+    // tail, comparing against the serial conversions.
+    for (int count : { 1, 3, 7, 8, 9, 64, 77 }) {
+        SkAutoTMalloc<uint16_t> halfs(count);
+        SkAutoTMalloc<float>    floats(count),
+                                roundTrip(count);
+        SkRandom rand;
+        for (int i = 0; i < count; ++i) {
+            // Finite, normal-range values (the kernels may flush denorms and don't handle
+            // inf/NaN, matching SkHalfToFloat_finite_ftz).
+            floats[i] = rand.nextRangeF(-65000.0f, 65000.0f);
+        }
+
+        SkOpts::floats_to_halfs(halfs.get(), floats.get(), count);
+        for (int i = 0; i < count; ++i) {
+            uint16_t expected = SkFloatToHalf(floats[i]);
+            // Like _finite_ftz(), the kernel may truncate instead of rounding.
+            REPORTER_ASSERT(r, halfs[i] == expected || halfs[i] == expected - 1);
+        }
+
+        SkOpts::halfs_to_floats(roundTrip.get(), halfs.get(), count);
+        for (int i = 0; i < count; ++i) {
+            REPORTER_ASSERT(r, roundTrip[i] == SkHalfToFloat(halfs[i]));
+        }
+    }
+}
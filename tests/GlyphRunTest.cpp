@@ -13,6 +13,36 @@
 #include <algorithm>
 #include <memory>
 
+DEF_TEST(GlyphRunBatch, reporter) {
+    SkFont smallFont;
+    smallFont.setSize(12);
+    SkFont bigFont;
+    bigFont.setSize(24);
+
+    const SkGlyphID glyphs[] = {10, 11, 12};
+    const SkPoint positions[] = {{0, 0}, {10, 0}, {20, 0}};
+
+    const SkCanvas::GlyphRun runs[] = {
+            {&smallFont, glyphs, positions, 3, {5, 100}},
+            {&bigFont,   glyphs, positions, 3, {5, 130}},
+            {&smallFont, glyphs, positions, 0, {5, 160}},  // empty runs are dropped
+    };
+
+    SkGlyphRunBuilder builder;
+    const SkGlyphRunList& list = builder.glyphRunsToGlyphRunList(runs, 3, SkPaint());
+
+    REPORTER_ASSERT(reporter, list.runCount() == 2);
+    REPORTER_ASSERT(reporter, list.origin() == SkPoint::Make(5, 100));
+
+    // The first run's positions pass through untranslated; the second run's positions are
+    // rebased onto the first run's origin.
+    REPORTER_ASSERT(reporter, list[0].font() == smallFont);
+    REPORTER_ASSERT(reporter, list[1].font() == bigFont);
+    for (int i = 0; i < 3; ++i) {
+        REPORTER_ASSERT(reporter, list[0].positions()[i] == positions[i]);
+        REPORTER_ASSERT(reporter, list[1].positions()[i] == positions[i] + SkPoint::Make(0, 30));
+    }
+}
 
 #if 0   // should we revitalize this by consing up a device for drawTextBlob() ?
 DEF_TEST(GlyphRunBlob, reporter) {
@@ -500,6 +500,53 @@ DEF_TEST(GrBlockAllocatorScratchBlockReserve, r) {
     REPORTER_ASSERT(r, (size_t) pool->testingOnly_scratchBlockSize() == scratchAvail);
 }
 
+DEF_TEST(GrBlockAllocatorScratchBudget, r) {
+    GrSBlockAllocator<256> pool;
+
+    // Grow to 4 heap blocks, then release them all.
+    add_block(pool);
+    add_block(pool);
+    add_block(pool);
+    add_block(pool);
+    size_t highWater = pool->totalSize();
+
+    pool->setScratchBlockBudget(highWater);
+    for (auto* b : pool->rblocks()) {
+        if (b != pool->headBlock()) {
+            pool->releaseBlock(b);
+        }
+    }
+
+    // All of the released blocks fit in the budget, so the footprint is unchanged and the
+    // allocator is back to just its head block.
+    REPORTER_ASSERT(r, block_count(pool) == 1);
+    REPORTER_ASSERT(r, pool->scratchBlockUsage() > 0);
+    REPORTER_ASSERT(r, pool->totalSize() == highWater);
+
+    // Re-growing to the same footprint must consume the retained blocks instead of mallocing.
+    add_block(pool);
+    add_block(pool);
+    add_block(pool);
+    add_block(pool);
+    REPORTER_ASSERT(r, pool->scratchBlockUsage() == 0);
+    REPORTER_ASSERT(r, pool->totalSize() == highWater);
+
+    // Shrinking the budget to 0 restores the keep-one-block behavior.
+    for (auto* b : pool->rblocks()) {
+        if (b != pool->headBlock()) {
+            pool->releaseBlock(b);
+        }
+    }
+    REPORTER_ASSERT(r, pool->totalSize() == highWater);
+    pool->setScratchBlockBudget(0);
+    REPORTER_ASSERT(r, pool->scratchBlockUsage() ==
+                       (size_t) pool->testingOnly_scratchBlockSize());
+
+    // And resetScratchSpace() returns everything.
+    pool->resetScratchSpace();
+    REPORTER_ASSERT(r, pool->scratchBlockUsage() == 0);
+}
+
 DEF_TEST(GrBlockAllocatorStealBlocks, r) {
     GrSBlockAllocator<256> poolA;
     GrSBlockAllocator<128> poolB;
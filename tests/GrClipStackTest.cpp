@@ -21,6 +21,7 @@
 #include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/GrProxyProvider.h"
 #include "src/gpu/GrSurfaceDrawContext.h"
+#include "src/gpu/GrThreadSafeCache.h"
 
 namespace {
 
@@ -2078,3 +2079,54 @@ DEF_GPUTEST_FOR_CONTEXTS(GrClipStack_SWMask,
     cs = nullptr;
     verifyKeys({}, {keyADepth1, keyBDepth1});
 }
+
+DEF_GPUTEST_FOR_CONTEXTS(GrClipStack_SWMaskCrossFrame,
+                         sk_gpu_test::GrContextFactory::IsRenderingContext,
+                         r, ctxInfo, disable_tessellation_atlas) {
+    GrDirectContext* context = ctxInfo.directContext();
+    std::unique_ptr<GrSurfaceDrawContext> rtc = GrSurfaceDrawContext::Make(
+            context, GrColorType::kRGBA_8888, nullptr, SkBackingFit::kExact, kDeviceBounds.size(),
+            SkSurfaceProps());
+
+    // Reusing the same SkPath object across "frames" keeps its gen ID stable, which is what lets
+    // the mask be found in the thread-safe cache after the clip stack is torn down and rebuilt.
+    SkPath path;
+    path.addCircle(20.f, 20.f, 15.f);
+    path.addCircle(27.f, 27.f, 15.f);
+    path.setFillType(SkPathFillType::kEvenOdd);
+
+    SkSimpleMatrixProvider matrixProvider = SkMatrix::I();
+    auto drawFrame = [&]() {
+        std::unique_ptr<GrClipStack> cs(new GrClipStack(kDeviceBounds, &matrixProvider, false));
+        cs->save();
+        cs->clipPath(SkMatrix::I(), path, GrAA::kYes, SkClipOp::kIntersect);
+        GrPaint paint;
+        paint.setColor4f({1.f, 1.f, 1.f, 1.f});
+        rtc->drawRect(cs.get(), std::move(paint), GrAA::kYes, SkMatrix::I(),
+                      {0.f, 0.f, 20.f, 20.f});
+        // Only valid when this draw had to render and register a new mask
+        GrUniqueKey key = cs->testingOnly_getLastSWMaskKey();
+        cs->restore();
+        context->flush();
+        return key;
+    };
+
+    GrThreadSafeCache* cache = context->priv().threadSafeCache();
+    const int baseEntries = cache->numEntries();
+
+    // The first frame renders the mask and publishes it for cross-frame reuse
+    GrUniqueKey first = drawFrame();
+    REPORTER_ASSERT(r, first.isValid(), "First frame should render a SW mask");
+    REPORTER_ASSERT(r, cache->numEntries() == baseEntries + 1);
+
+    // An identical second frame finds the published mask instead of rendering a new one
+    GrUniqueKey second = drawFrame();
+    REPORTER_ASSERT(r, !second.isValid(), "Second frame should reuse the cached SW mask");
+    REPORTER_ASSERT(r, cache->numEntries() == baseEntries + 1);
+
+    // A volatile path has no stable identity, so its mask cannot be shared across frames
+    path.setIsVolatile(true);
+    GrUniqueKey third = drawFrame();
+    REPORTER_ASSERT(r, third.isValid(), "Volatile path should render a per-record SW mask");
+    REPORTER_ASSERT(r, cache->numEntries() == baseEntries + 1);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2021 Google LLC.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "tests/Test.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkSurface.h"
+#include "include/gpu/GrDirectContext.h"
+#include "src/gpu/GrFramePipelineManager.h"
+
+namespace {
+struct RecycleRecord {
+    int   fFinishedCount = 0;
+    void* fLastFrameContext = nullptr;
+};
+}  // namespace
+
+static void recycle_frame(void* clientContext, void* frameContext) {
+    auto* record = static_cast<RecycleRecord*>(clientContext);
+    record->fFinishedCount++;
+    record->fLastFrameContext = frameContext;
+}
+
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(GrFramePipelineManagerTest, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+
+    SkImageInfo info = SkImageInfo::Make(8, 8, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    sk_sp<SkSurface> surface = SkSurface::MakeRenderTarget(dContext, SkBudgeted::kNo, info);
+
+    RecycleRecord record;
+    static constexpr int kMaxFramesInFlight = 2;
+    int frameSlots[8];
+    {
+        GrFramePipelineManager pipeline(dContext, kMaxFramesInFlight, recycle_frame, &record);
+        REPORTER_ASSERT(reporter, pipeline.maxFramesInFlight() == kMaxFramesInFlight);
+
+        for (int i = 0; i < 8; ++i) {
+            surface->getCanvas()->clear(SkColorSetARGB(0xFF, 0, 0, i));
+            pipeline.flushFrameAndSubmit(surface.get(), &frameSlots[i]);
+            // Backpressure: the flush waits for a slot before adding a frame, so the in-flight
+            // count can never exceed the limit.
+            REPORTER_ASSERT(reporter, pipeline.framesInFlight() <= kMaxFramesInFlight);
+        }
+        // Destruction drains every pending frame, invoking the recycle proc for each.
+    }
+    REPORTER_ASSERT(reporter, record.fFinishedCount == 8);
+    REPORTER_ASSERT(reporter, record.fLastFrameContext == &frameSlots[7]);
+
+    // A frame flushed with no frame context still completes and recycles.
+    {
+        GrFramePipelineManager pipeline(dContext, /*maxFramesInFlight=*/1, recycle_frame, &record);
+        pipeline.flushFrameAndSubmit();
+        pipeline.waitForFrameSlot();
+        REPORTER_ASSERT(reporter, pipeline.framesInFlight() == 0);
+    }
+    REPORTER_ASSERT(reporter, record.fFinishedCount == 9);
+    REPORTER_ASSERT(reporter, record.fLastFrameContext == nullptr);
+}
@@ -315,3 +315,40 @@ DEF_TEST(GrMemoryPoolAPI, reporter) {
         REPORTER_ASSERT(reporter, pool->size() == hugeBlockSize + kMinAllocSize);
     }
 }
+
+DEF_TEST(GrMemoryPoolHighWaterRetention, reporter) {
+    constexpr size_t kMinAllocSize = GrMemoryPool::kMinAllocationSize;
+    auto pool = GrMemoryPool::Make(kMinAllocSize, kMinAllocSize);
+    pool->setRetainBlocksAtHighWaterMark(true);
+
+    // Simulate one "frame": allocate across several blocks, then release everything.
+    auto runCycle = [&]() {
+        SkTDArray<void*> allocations;
+        while (pool->size() < 4 * kMinAllocSize) {
+            *allocations.append() = pool->allocate(64);
+        }
+        size_t footprint = pool->size();
+        for (void* p : allocations) {
+            pool->release(p);
+        }
+        return footprint;
+    };
+
+    size_t highWater = runCycle();
+    REPORTER_ASSERT(reporter, pool->isEmpty());
+    // The blocks from the first cycle should all have been retained.
+    REPORTER_ASSERT(reporter, pool->scratchSpaceUsage() >= highWater);
+
+    // A second identical cycle must be serviced from the retained blocks.
+    size_t retained = pool->scratchSpaceUsage();
+    runCycle();
+    REPORTER_ASSERT(reporter, pool->scratchSpaceUsage() == retained);
+
+    // Disabling retention reverts to keeping only the single largest released block.
+    pool->setRetainBlocksAtHighWaterMark(false);
+    runCycle();
+    REPORTER_ASSERT(reporter, pool->scratchSpaceUsage() <= kMinAllocSize + highWater / 4);
+
+    pool->resetScratchSpace();
+    REPORTER_ASSERT(reporter, pool->scratchSpaceUsage() == 0);
+}
@@ -9,8 +9,11 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkSurface.h"
 #include "include/core/SkTextBlob.h"
+#include "include/gpu/GrDirectContext.h"
 #include "src/core/SkSurfacePriv.h"
+#include "src/gpu/GrDirectContextPriv.h"
 #include "src/gpu/text/GrTextBlob.h"
+#include "src/gpu/text/GrTextBlobCache.h"
 #include "tests/Test.h"
 #include "tools/ToolUtils.h"
 
@@ -320,3 +323,56 @@ DEF_TEST(GrSubRunAllocator, r) {
         REPORTER_ASSERT(r, ((intptr_t)ptr & 7) == 0);
     }
 }
+
+static void enable_snap_to_pixel(GrContextOptions* options) {
+    options->fSnapTextBlobsToPixel = true;
+}
+
+// With fSnapTextBlobsToPixel, a cached blob must be reused under a sub-pixel translation with
+// its glyphs snapped to the nearest device pixel instead of being rebuilt.
+DEF_GPUTEST_FOR_CONTEXTS(GrTextBlobSnapToPixelReuse,
+                         &sk_gpu_test::GrContextFactory::IsRenderingContext,
+                         reporter, ctxInfo, enable_snap_to_pixel) {
+    auto tf = ToolUtils::create_portable_typeface("Mono", SkFontStyle());
+    SkFont font{tf};
+    font.setHinting(SkFontHinting::kNormal);
+    font.setSize(12);
+    font.setEdging(SkFont::Edging::kAntiAlias);
+    font.setSubpixel(true);
+
+    SkTextBlobBuilder builder;
+    const auto& runBuffer = builder.allocRunPosH(font, 30, 0, nullptr);
+    for (int i = 0; i < 30; i++) {
+        runBuffer.glyphs[i] = static_cast<SkGlyphID>(i);
+        runBuffer.pos[i] = SkIntToScalar(i * 10);
+    }
+    auto blob = builder.make();
+
+    auto dContext = ctxInfo.directContext();
+    auto base = rasterize_blob(blob.get(), SkPaint(), dContext, SkMatrix::I());
+    dContext->flushAndSubmit();
+    size_t usedBytes = dContext->priv().getTextBlobCache()->usedBytes();
+
+    // 0.5 rounds up to a whole pixel in x; y is unchanged.
+    auto moved = rasterize_blob(
+            blob.get(), SkPaint(), dContext, SkMatrix::Translate(0.5f, 0.25f));
+    dContext->flushAndSubmit();
+
+    REPORTER_ASSERT(reporter, check_for_black(base) && check_for_black(moved));
+
+    // The cached blob was reused; nothing new was inserted.
+    REPORTER_ASSERT(reporter,
+                    dContext->priv().getTextBlobCache()->usedBytes() == usedBytes);
+
+    // The glyph masks are byte-identical to the original draw, shifted one pixel in x.
+    bool match = true;
+    for (int y = 0; y < base.height() && match; y++) {
+        for (int x = 0; x < base.width() - 1; x++) {
+            if (moved.getColor(x + 1, y) != base.getColor(x, y)) {
+                match = false;
+                break;
+            }
+        }
+    }
+    REPORTER_ASSERT(reporter, match);
+}
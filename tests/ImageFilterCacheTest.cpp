@@ -51,14 +51,14 @@ static void test_find_existing(skiatest::Reporter* reporter,
 
     SkIPoint offset = SkIPoint::Make(3, 4);
     auto filter = make_filter();
-    cache->set(key1, filter.get(),
+    cache->set(key1, filter.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
 
     skif::FilterResult<For::kOutput> foundImage;
-    REPORTER_ASSERT(reporter, cache->get(key1, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key1, nullptr, &foundImage));
     REPORTER_ASSERT(reporter, offset == SkIPoint(foundImage.layerOrigin()));
 
-    REPORTER_ASSERT(reporter, !cache->get(key2, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key2, nullptr, &foundImage));
 }
 
 // If either id is different or the clip or the matrix are different the
@@ -80,14 +80,14 @@ static void test_dont_find_if_diff_key(skiatest::Reporter* reporter,
 
     SkIPoint offset = SkIPoint::Make(3, 4);
     auto filter = make_filter();
-    cache->set(key0, filter.get(),
+    cache->set(key0, filter.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
 
     skif::FilterResult<For::kOutput> foundImage;
-    REPORTER_ASSERT(reporter, !cache->get(key1, &foundImage));
-    REPORTER_ASSERT(reporter, !cache->get(key2, &foundImage));
-    REPORTER_ASSERT(reporter, !cache->get(key3, &foundImage));
-    REPORTER_ASSERT(reporter, !cache->get(key4, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key1, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key2, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key3, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key4, nullptr, &foundImage));
 }
 
 // Test purging when the max cache size is exceeded
@@ -102,19 +102,19 @@ static void test_internal_purge(skiatest::Reporter* reporter, const sk_sp<SkSpec
 
     SkIPoint offset = SkIPoint::Make(3, 4);
     auto filter1 = make_filter();
-    cache->set(key1, filter1.get(),
+    cache->set(key1, filter1.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
 
     skif::FilterResult<For::kOutput> foundImage;
-    REPORTER_ASSERT(reporter, cache->get(key1, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key1, nullptr, &foundImage));
 
     // This should knock the first one out of the cache
     auto filter2 = make_filter();
-    cache->set(key2, filter2.get(),
+    cache->set(key2, filter2.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
 
-    REPORTER_ASSERT(reporter, cache->get(key2, &foundImage));
-    REPORTER_ASSERT(reporter, !cache->get(key1, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key2, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key1, nullptr, &foundImage));
 }
 
 // Exercise the purgeByKey and purge methods
@@ -131,27 +131,27 @@ static void test_explicit_purging(skiatest::Reporter* reporter,
     SkIPoint offset = SkIPoint::Make(3, 4);
     auto filter1 = make_filter();
     auto filter2 = make_filter();
-    cache->set(key1, filter1.get(),
+    cache->set(key1, filter1.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
-    cache->set(key2, filter2.get(),
+    cache->set(key2, filter2.get(), nullptr,
                skif::FilterResult<For::kOutput>(image, skif::LayerSpace<SkIPoint>(offset)));
     SkDEBUGCODE(REPORTER_ASSERT(reporter, 2 == cache->count());)
 
     skif::FilterResult<For::kOutput> foundImage;
-    REPORTER_ASSERT(reporter, cache->get(key1, &foundImage));
-    REPORTER_ASSERT(reporter, cache->get(key2, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key1, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key2, nullptr, &foundImage));
 
     cache->purgeByImageFilter(filter1.get());
     SkDEBUGCODE(REPORTER_ASSERT(reporter, 1 == cache->count());)
 
-    REPORTER_ASSERT(reporter, !cache->get(key1, &foundImage));
-    REPORTER_ASSERT(reporter, cache->get(key2, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key1, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, cache->get(key2, nullptr, &foundImage));
 
     cache->purge();
     SkDEBUGCODE(REPORTER_ASSERT(reporter, 0 == cache->count());)
 
-    REPORTER_ASSERT(reporter, !cache->get(key1, &foundImage));
-    REPORTER_ASSERT(reporter, !cache->get(key2, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key1, nullptr, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key2, nullptr, &foundImage));
 }
 
 DEF_TEST(ImageFilterCache_RasterBacked, reporter) {
@@ -1168,6 +1168,52 @@ DEF_GPUTEST_FOR_RENDERING_CONTEXTS(ImageBackendAccessAbandoned_Gpu, reporter, ct
     REPORTER_ASSERT(reporter, !beTex.isValid());
 }
 
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(ImageNotifyTextureContentsChanged, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+
+    const SkImageInfo ii = SkImageInfo::Make(4, 4, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    SkBitmap blue, green;
+    blue.allocPixels(ii);
+    blue.eraseColor(SK_ColorBLUE);
+    green.allocPixels(ii);
+    green.eraseColor(SK_ColorGREEN);
+
+    auto mbet = ManagedBackendTexture::MakeWithData(dContext, blue.pixmap(),
+                                                    kTopLeft_GrSurfaceOrigin, GrRenderable::kNo,
+                                                    GrProtected::kNo);
+    if (!mbet) {
+        ERRORF(reporter, "Could not make texture.");
+        return;
+    }
+
+    sk_sp<SkImage> image = SkImage::MakeFromTexture(dContext, mbet->texture(),
+                                                    kTopLeft_GrSurfaceOrigin,
+                                                    kRGBA_8888_SkColorType, kPremul_SkAlphaType,
+                                                    nullptr);
+    REPORTER_ASSERT(reporter, image);
+    if (!image) {
+        return;
+    }
+
+    // Raster images don't wrap a client-owned texture.
+    sk_sp<SkImage> rasterImage = create_image();
+    REPORTER_ASSERT(reporter, !rasterImage->notifyTextureContentsChanged(dContext));
+
+    // Populate the raster cache from the original contents.
+    SkBitmap read;
+    REPORTER_ASSERT(reporter, as_IB(image)->getROPixels(dContext, &read));
+    REPORTER_ASSERT(reporter, read.getColor(0, 0) == SK_ColorBLUE);
+
+    // Overwrite the texture contents as a video decoder would and declare the update.
+    REPORTER_ASSERT(reporter, dContext->updateBackendTexture(mbet->texture(), green.pixmap()));
+    REPORTER_ASSERT(reporter, image->notifyTextureContentsChanged(dContext));
+
+    // The cached raster copy of the old contents must not be returned.
+    read.reset();
+    REPORTER_ASSERT(reporter, as_IB(image)->getROPixels(dContext, &read));
+    REPORTER_ASSERT(reporter, read.getColor(0, 0) == SK_ColorGREEN);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 static sk_sp<SkImage> create_picture_image(sk_sp<SkColorSpace> space) {
@@ -454,3 +454,44 @@ DEF_TEST(JSON_ParseNumber, reporter) {
         REPORTER_ASSERT(reporter, SkScalarNearlyEqual(**jnumber, test.value, test.tolerance));
     }
 }
+
+DEF_TEST(JSON_InSituParse, reporter) {
+    static constexpr char json[] =
+        "{ \"key_one\": \"a long string value\","
+        "  \"k2\": [ \"short\", \"another long string\", \"esc\\u0041ped long string\" ] }";
+
+    std::vector<char> buffer(json, json + strlen(json));
+    buffer.push_back('\0');
+
+    const DOM dom(buffer.data(), strlen(json));
+    const ObjectValue* jroot = dom.root();
+    REPORTER_ASSERT(reporter, jroot);
+
+    const StringValue* v1 = (*jroot)["key_one"];
+    REPORTER_ASSERT(reporter, v1);
+    REPORTER_ASSERT(reporter, !strcmp(v1->begin(), "a long string value"));
+    REPORTER_ASSERT(reporter, v1->size() == strlen("a long string value"));
+    // Long unescaped strings reference the caller's buffer directly.
+    REPORTER_ASSERT(reporter, v1->begin() >= buffer.data() &&
+                              v1->end()   <= buffer.data() + buffer.size());
+
+    const ArrayValue* v2 = (*jroot)["k2"];
+    REPORTER_ASSERT(reporter, v2 && v2->size() == 3);
+
+    const StringValue* s0 = (*v2)[0];
+    REPORTER_ASSERT(reporter, s0);
+    REPORTER_ASSERT(reporter, !strcmp(s0->begin(), "short"));
+
+    const StringValue* s1 = (*v2)[1];
+    REPORTER_ASSERT(reporter, s1);
+    REPORTER_ASSERT(reporter, !strcmp(s1->begin(), "another long string"));
+    REPORTER_ASSERT(reporter, s1->begin() >= buffer.data() &&
+                              s1->end()   <= buffer.data() + buffer.size());
+
+    // Escaped strings are unescaped into the DOM arena, not referenced in situ.
+    const StringValue* s2 = (*v2)[2];
+    REPORTER_ASSERT(reporter, s2);
+    REPORTER_ASSERT(reporter, !strcmp(s2->begin(), "escAped long string"));
+    REPORTER_ASSERT(reporter, s2->begin() < buffer.data() ||
+                              s2->begin() >= buffer.data() + buffer.size());
+}
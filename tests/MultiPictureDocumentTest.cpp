@@ -85,11 +85,13 @@ DEF_TEST(SkMultiPictureDocument_Serialize_and_deserialize, reporter) {
     // Create the stream we will serialize into.
     SkDynamicMemoryWStream stream;
 
-    // Create the image sharing proc.
+    // Create the image and typeface sharing procs.
     SkSharingSerialContext ctx;
     SkSerialProcs procs;
     procs.fImageProc = SkSharingSerialContext::serializeImage;
     procs.fImageCtx = &ctx;
+    procs.fTypefaceProc = SkSharingSerialContext::serializeTypeface;
+    procs.fTypefaceCtx = &ctx;
 
     // Create the multi picture document used for recording frames.
     sk_sp<SkDocument> multipic = SkMakeMultiPictureDocument(&stream, &procs);
@@ -136,6 +138,8 @@ DEF_TEST(SkMultiPictureDocument_Serialize_and_deserialize, reporter) {
     SkDeserialProcs dprocs;
     dprocs.fImageProc = SkSharingDeserialContext::deserializeImage;
     dprocs.fImageCtx = &deserialContext;
+    dprocs.fTypefaceProc = SkSharingDeserialContext::deserializeTypeface;
+    dprocs.fTypefaceCtx = &deserialContext;
 
     // Confirm data is a MultiPictureDocument
     int frame_count = SkMultiPictureDocumentReadPageCount(writtenStream.get());
@@ -167,6 +171,56 @@ DEF_TEST(SkMultiPictureDocument_Serialize_and_deserialize, reporter) {
     }
 }
 
+// Test random access to a single page via the offset table, without deserializing the rest.
+DEF_TEST(SkMultiPictureDocument_ReadPage, reporter) {
+    SkDynamicMemoryWStream stream;
+    sk_sp<SkDocument> multipic = SkMakeMultiPictureDocument(&stream);
+
+    static const int NUM_FRAMES = 12;
+    static const int WIDTH = 256;
+    static const int HEIGHT = 256;
+
+    auto surface(SkSurface::MakeRasterN32Premul(100, 100));
+    surface->getCanvas()->clear(SK_ColorGREEN);
+    sk_sp<SkImage> image(surface->makeImageSnapshot());
+
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(WIDTH, HEIGHT);
+    std::vector<sk_sp<SkImage>> expectedImages;
+
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        SkCanvas* pictureCanvas = multipic->beginPage(WIDTH, HEIGHT);
+        draw_basic(pictureCanvas, i, image);
+        multipic->endPage();
+        auto surf = SkSurface::MakeRaster(info);
+        draw_basic(surf->getCanvas(), i, image);
+        expectedImages.push_back(surf->makeImageSnapshot());
+    }
+    multipic->close();
+
+    std::unique_ptr<SkStreamAsset> writtenStream = stream.detachAsStream();
+
+    // Out-of-range indices fail cleanly.
+    SkDocumentPage page;
+    REPORTER_ASSERT(reporter,
+        !SkMultiPictureDocumentReadPage(writtenStream.get(), -1, &page));
+    REPORTER_ASSERT(reporter,
+        !SkMultiPictureDocumentReadPage(writtenStream.get(), NUM_FRAMES, &page));
+
+    // Read pages out of order; each read stands alone.
+    for (int i : {7, 0, NUM_FRAMES - 1, 3}) {
+        REPORTER_ASSERT(reporter,
+            SkMultiPictureDocumentReadPage(writtenStream.get(), i, &page),
+            "Failed to read page %d", i);
+        REPORTER_ASSERT(reporter, page.fSize.width() == WIDTH);
+        REPORTER_ASSERT(reporter, page.fSize.height() == HEIGHT);
+
+        auto surf = SkSurface::MakeRaster(info);
+        surf->getCanvas()->drawPicture(page.fPicture);
+        auto img = surf->makeImageSnapshot();
+        REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(img.get(), expectedImages[i].get()));
+    }
+}
+
 
 #if SK_SUPPORT_GPU && defined(SK_BUILD_FOR_ANDROID) && __ANDROID_API__ >= 26
 
@@ -622,3 +622,55 @@ DEF_GPUTEST_FOR_GL_RENDERING_CONTEXTS(OnFlushCallbackTest, reporter, ctxInfo) {
     x += kDrawnTileSize;
     test_color(reporter, readBack, x, SK_ColorYELLOW);
 }
+
+namespace {
+
+// Records the order in which the drawing manager invoked its preFlush callbacks.
+class PhaseRecorder : public GrOnFlushCallbackObject {
+public:
+    PhaseRecorder(AtlasPhase phase, SkTArray<const PhaseRecorder*>* order)
+            : fPhase(phase), fOrder(order) {}
+
+    AtlasPhase atlasPhase() const override { return fPhase; }
+
+    void preFlush(GrOnFlushResourceProvider*, SkSpan<const uint32_t>) override {
+        fOrder->push_back(this);
+    }
+
+private:
+    AtlasPhase fPhase;
+    SkTArray<const PhaseRecorder*>* fOrder;
+};
+
+}  // anonymous namespace
+
+// Upload-phase atlas callbacks must run before default- and render-phase ones regardless of
+// registration order.
+DEF_GPUTEST_FOR_GL_RENDERING_CONTEXTS(OnFlushCallbackPhaseOrder, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+
+    SkTArray<const PhaseRecorder*> order;
+    PhaseRecorder render(GrOnFlushCallbackObject::AtlasPhase::kRender, &order);
+    PhaseRecorder upload(GrOnFlushCallbackObject::AtlasPhase::kUpload, &order);
+    PhaseRecorder fallback(GrOnFlushCallbackObject::AtlasPhase::kDefault, &order);
+
+    // Register in reverse phase order to prove the scheduler reorders them.
+    dContext->priv().addOnFlushCallbackObject(&render);
+    dContext->priv().addOnFlushCallbackObject(&fallback);
+    dContext->priv().addOnFlushCallbackObject(&upload);
+
+    auto rtc = GrSurfaceDrawContext::Make(
+            dContext, GrColorType::kRGBA_8888, nullptr, SkBackingFit::kApprox, {16, 16},
+            SkSurfaceProps());
+    rtc->clear(SK_PMColor4fWHITE);
+    dContext->priv().flushSurface(rtc->asSurfaceProxy());
+
+    REPORTER_ASSERT(reporter, order.count() == 3);
+    REPORTER_ASSERT(reporter, order[0] == &upload);
+    REPORTER_ASSERT(reporter, order[1] == &fallback);
+    REPORTER_ASSERT(reporter, order[2] == &render);
+
+    dContext->priv().testingOnly_flushAndRemoveOnFlushCallbackObject(&render);
+    dContext->priv().testingOnly_flushAndRemoveOnFlushCallbackObject(&fallback);
+    dContext->priv().testingOnly_flushAndRemoveOnFlushCallbackObject(&upload);
+}
@@ -230,3 +230,40 @@ DEF_TEST(Font_getpos, r) {
         }
     }
 }
+
+// The widths-only and measureText(bounds == nullptr) paths are served from the strike's flat
+// advance table; check they agree with the full-metrics path.
+DEF_TEST(Font_advanceTable, r) {
+    SkFont font;
+    const char text[] = "Hamburgefons!@#!#23425,./;'[]";
+    int count = font.countText(text, strlen(text), SkTextEncoding::kUTF8);
+    SkAutoTArray<uint16_t> glyphStorage(count);
+    uint16_t* glyphs = glyphStorage.get();
+    (void)font.textToGlyphs(text, strlen(text), SkTextEncoding::kUTF8, glyphs, count);
+
+    SkAutoTArray<SkScalar> widthStorage(count);
+    SkAutoTArray<SkScalar> metricWidthStorage(count);
+    SkAutoTArray<SkRect> boundsStorage(count);
+
+    SkScalar* widths = widthStorage.get();
+    SkScalar* metricWidths = metricWidthStorage.get();
+    SkRect* bounds = boundsStorage.get();
+
+    for (auto size : { 1.0f, 12.0f, 100.0f, 500.0f }) {
+        font.setSize(size);
+
+        font.getWidths(glyphs, count, widths);                      // advance-table path
+        font.getWidthsBounds(glyphs, count, metricWidths, bounds, nullptr);  // metrics path
+
+        SkScalar sum = 0;
+        for (int i = 0; i < count; ++i) {
+            REPORTER_ASSERT(r, widths[i] == metricWidths[i]);
+            sum += widths[i];
+        }
+
+        SkScalar measured = font.measureText(glyphs, count * sizeof(uint16_t),
+                                             SkTextEncoding::kGlyphID);
+        // measureText scales the summed width, so allow for rounding relative to the total.
+        REPORTER_ASSERT(r, SkScalarAbs(measured - sum) < sum * 0.0001f + 0.0001f);
+    }
+}
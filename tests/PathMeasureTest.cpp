@@ -327,3 +327,47 @@ DEF_TEST(contour_measure, reporter) {
 
     test_shrink(reporter);
 }
+
+DEF_TEST(contour_measure_pos_tans, reporter) {
+    SkPath path;
+    path.moveTo(0, 0);
+    path.cubicTo(10, 0, 20, 30, 40, 40);
+    path.quadTo(60, 50, 80, 40);
+    path.lineTo(100, 0);
+
+    SkContourMeasureIter fact(path, false);
+    auto cm = fact.next();
+    REPORTER_ASSERT(reporter, cm);
+
+    const SkScalar length = cm->length();
+    SkScalar ascending[10];
+    for (size_t i = 0; i < SK_ARRAY_COUNT(ascending); ++i) {
+        // deliberately run past the ends to exercise pinning
+        ascending[i] = -1 + length * 1.2f * i / (SK_ARRAY_COUNT(ascending) - 1);
+    }
+    SkScalar unsorted[10];
+    for (size_t i = 0; i < SK_ARRAY_COUNT(unsorted); ++i) {
+        unsorted[i] = ascending[SK_ARRAY_COUNT(unsorted) - 1 - i];
+    }
+
+    for (const SkScalar* distances : {ascending, unsorted}) {
+        SkPoint  pos[10];
+        SkVector tan[10];
+        REPORTER_ASSERT(reporter, cm->getPosTans(distances, 10, pos, tan));
+        for (int i = 0; i < 10; ++i) {
+            SkPoint  expectedPos;
+            SkVector expectedTan;
+            REPORTER_ASSERT(reporter, cm->getPosTan(distances[i], &expectedPos, &expectedTan));
+            REPORTER_ASSERT(reporter, pos[i] == expectedPos);
+            REPORTER_ASSERT(reporter, tan[i] == expectedTan);
+        }
+    }
+
+    // nullable outputs
+    SkPoint posOnly[10];
+    REPORTER_ASSERT(reporter, cm->getPosTans(ascending, 10, posOnly, nullptr));
+    REPORTER_ASSERT(reporter, cm->getPosTans(ascending, 10, nullptr, nullptr));
+
+    const SkScalar nan[] = { 0, SK_ScalarNaN };
+    REPORTER_ASSERT(reporter, !cm->getPosTans(nan, 2, nullptr, nullptr));
+}
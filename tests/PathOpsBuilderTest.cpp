@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkBitmap.h"
+#include "include/core/SkExecutor.h"
 #include "tests/PathOpsExtendedTest.h"
 #include "tests/PathOpsTestCommon.h"
 #include "tests/Test.h"
@@ -79,6 +80,26 @@ DEF_TEST(PathOpsBuilder, reporter) {
     REPORTER_ASSERT(reporter, pixelDiff == 0);
 }
 
+DEF_TEST(PathOpsBuilderParallelResolve, reporter) {
+    // A grid of disjoint rects unioned together must resolve identically with and
+    // without an executor.
+    SkOpBuilder serialBuilder, parallelBuilder;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            SkPath rect;
+            rect.addRect(SkRect::MakeXYWH(x * 30.0f, y * 30.0f, 20, 20));
+            serialBuilder.add(rect, kUnion_SkPathOp);
+            parallelBuilder.add(rect, kUnion_SkPathOp);
+        }
+    }
+    SkPath serialResult, parallelResult;
+    REPORTER_ASSERT(reporter, serialBuilder.resolve(&serialResult));
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    REPORTER_ASSERT(reporter, parallelBuilder.resolve(&parallelResult, executor.get()));
+    int pixelDiff = comparePaths(reporter, __FUNCTION__, serialResult, parallelResult);
+    REPORTER_ASSERT(reporter, pixelDiff == 0);
+}
+
 DEF_TEST(BuilderIssue3838, reporter) {
     SkPath path;
     path.moveTo(200, 170);
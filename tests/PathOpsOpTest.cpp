@@ -12540,3 +12540,32 @@ DEF_TEST(PathOpsRepOp, reporter) {
   for (int index = 0; index < 1; ++index)
     RunTestSet(reporter, repTests, SK_ARRAY_COUNT(repTests), nullptr, nullptr, nullptr, false);
 }
+
+DEF_TEST(PathOpsOpBudgeted, reporter) {
+    SkPath one, two;
+    one.addRect(0, 0, 100, 100);
+    two.addRect(50, 50, 150, 150);
+
+    // A generous budget resolves exactly and reports no approximation.
+    SkPath exact, budgeted;
+    bool approximated = true;
+    REPORTER_ASSERT(reporter, Op(one, two, kUnion_SkPathOp, &exact));
+    REPORTER_ASSERT(reporter, OpBudgeted(one, two, kUnion_SkPathOp, &budgeted,
+                                         1000000, 1, &approximated));
+    REPORTER_ASSERT(reporter, !approximated);
+    REPORTER_ASSERT(reporter, exact == budgeted);
+
+    // Exhausting the budget falls back to the scan-converted region boolean: the flag is set
+    // and the result still classifies interior and exterior points correctly.
+    SkPath many;
+    for (int i = 0; i < 40; ++i) {
+        many.addCircle(50 + (i % 7) * 0.1f, 50 + (i % 5) * 0.1f, 60 + i * 0.01f);
+    }
+    SkPath fallback;
+    REPORTER_ASSERT(reporter, OpBudgeted(many, two, kUnion_SkPathOp, &fallback,
+                                         1, 1, &approximated));
+    REPORTER_ASSERT(reporter, approximated);
+    REPORTER_ASSERT(reporter, fallback.contains(50, 50));
+    REPORTER_ASSERT(reporter, fallback.contains(145, 145));
+    REPORTER_ASSERT(reporter, !fallback.contains(-100, -100));
+}
@@ -5073,6 +5073,43 @@ DEF_TEST(PathRefSerialization, reporter) {
     }
 }
 
+DEF_TEST(PathSerializeConvexityHint, reporter) {
+    SkPath convex, concave;
+    convex.moveTo(0, 0);
+    convex.lineTo(40, 5);
+    convex.lineTo(50, 40);
+    convex.lineTo(5, 60);
+    convex.close();
+    concave.moveTo(0, 0);
+    concave.lineTo(80, 0);
+    concave.lineTo(40, 30);  // points back toward the interior
+    concave.lineTo(80, 60);
+    concave.lineTo(0, 60);
+    concave.close();
+
+    // Convexity computed before serializing is recorded, and adopted on deserialize.
+    for (const SkPath& path : { convex, concave }) {
+        SkPathConvexity computed = path.isConvex() ? SkPathConvexity::kConvex
+                                                   : SkPathConvexity::kConcave;
+        sk_sp<SkData> data = path.serialize();
+        SkPath readBack;
+        REPORTER_ASSERT(reporter, readBack.readFromMemory(data->data(), data->size()));
+        REPORTER_ASSERT(reporter, SkPathPriv::GetConvexityOrUnknown(readBack) == computed);
+        REPORTER_ASSERT(reporter, readBack == path);
+    }
+
+    // If the writer never computed convexity, nothing is recorded.
+    {
+        SkPath copy = convex;
+        SkPathPriv::SetConvexity(copy, SkPathConvexity::kUnknown);
+        sk_sp<SkData> data = copy.serialize();
+        SkPath readBack;
+        REPORTER_ASSERT(reporter, readBack.readFromMemory(data->data(), data->size()));
+        REPORTER_ASSERT(reporter,
+                SkPathPriv::GetConvexityOrUnknown(readBack) == SkPathConvexity::kUnknown);
+    }
+}
+
 DEF_TEST(NonFinitePathIteration, reporter) {
     SkPath path;
     path.moveTo(SK_ScalarInfinity, SK_ScalarInfinity);
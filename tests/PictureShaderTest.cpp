@@ -110,3 +110,57 @@ DEF_TEST(PictureShader_caching2, reporter) {
     SkResourceCache::VisitAll(counter, &data);
     REPORTER_ASSERT(reporter, data.counter == 0);
 }
+
+/*
+ *  Check scale bucketing of picture-shader tiles:
+ *  - with linear filtering, all scales within one octave share a single cache entry
+ *  - crossing an octave boundary adds a second entry
+ */
+DEF_TEST(PictureShader_scaleBuckets, reporter) {
+    auto picture = []() {
+        SkPictureRecorder recorder;
+        recorder.beginRecording(100, 100)->drawColor(SK_ColorGREEN);
+        return recorder.finishRecordingAsPicture();
+    }();
+
+    struct Data {
+        uint64_t sharedID;
+        int counter;
+    } data = {
+        SkPicturePriv::MakeSharedID(picture->uniqueID()),
+        0,
+    };
+
+    auto counter = [](const SkResourceCache::Rec& rec, void* dataPtr) {
+        if (rec.getKey().getSharedID() == ((Data*)dataPtr)->sharedID) {
+            ((Data*)dataPtr)->counter += 1;
+        }
+    };
+
+    sk_sp<SkSurface> surface = SkSurface::MakeRasterN32Premul(256, 256);
+    SkPaint paint;
+    paint.setShader(picture->makeShader(SkTileMode::kRepeat, SkTileMode::kRepeat,
+                                        SkFilterMode::kLinear));
+
+    // All of these land in the (1, 2] octave, so only one tile should be rasterized.
+    for (SkScalar scale : {1.1f, 1.5f, 1.9f}) {
+        surface->getCanvas()->save();
+        surface->getCanvas()->scale(scale, scale);
+        surface->getCanvas()->drawPaint(paint);
+        surface->getCanvas()->restore();
+    }
+
+    SkResourceCache::VisitAll(counter, &data);
+    REPORTER_ASSERT(reporter, data.counter == 1);
+
+    // One octave down; this may be downsampled from the existing tile, but either way it is
+    // one additional cache entry.
+    surface->getCanvas()->save();
+    surface->getCanvas()->scale(0.75f, 0.75f);
+    surface->getCanvas()->drawPaint(paint);
+    surface->getCanvas()->restore();
+
+    data.counter = 0;
+    SkResourceCache::VisitAll(counter, &data);
+    REPORTER_ASSERT(reporter, data.counter == 2);
+}
@@ -43,6 +43,33 @@ static bool verify_query(SkRect query, SkRect rects[], const std::vector<int>& f
     return found == expected;
 }
 
+static bool verify_ranges(SkRect query, SkRect rects[],
+                          const std::vector<SkBBoxHierarchy::OpRange>& ranges) {
+    // Ranges must be ascending, non-empty, and separated (adjacent ranges are merged).
+    int prevEnd = -1;
+    for (const auto& range : ranges) {
+        if (range.fBegin <= prevEnd || range.fEnd <= range.fBegin) {
+            return false;
+        }
+        prevEnd = range.fEnd;
+    }
+    // Every intersecting rect must be covered; non-intersecting rects may be (conservatively).
+    auto covered = [&ranges](int op) {
+        for (const auto& range : ranges) {
+            if (op >= range.fBegin && op < range.fEnd) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (int i = 0; i < NUM_RECTS; ++i) {
+        if (SkRect::Intersects(query, rects[i]) && !covered(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void run_queries(skiatest::Reporter* reporter, SkRandom& rand, SkRect rects[],
                         const SkRTree& tree) {
     for (size_t i = 0; i < NUM_QUERIES; ++i) {
@@ -50,7 +77,18 @@ static void run_queries(skiatest::Reporter* reporter, SkRandom& rand, SkRect rec
         SkRect query = random_rect(rand);
         tree.search(query, &hits);
         REPORTER_ASSERT(reporter, verify_query(query, rects, hits));
+
+        std::vector<SkBBoxHierarchy::OpRange> ranges;
+        tree.searchRanges(query, &ranges);
+        REPORTER_ASSERT(reporter, verify_ranges(query, rects, ranges));
     }
+
+    // A query covering every rect collapses to the root's single contiguous range.
+    std::vector<SkBBoxHierarchy::OpRange> all;
+    tree.searchRanges(SkRect::MakeLTRB(-1000, -1000, 2000, 2000), &all);
+    REPORTER_ASSERT(reporter, all.size() == 1 &&
+                              all[0].fBegin == 0 &&
+                              all[0].fEnd == tree.getCount());
 }
 
 DEF_TEST(RTree, reporter) {
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkPictureRecorder.h"
+#include "src/utils/SkRasterTilePlayback.h"
+#include "tests/Test.h"
+
+static sk_sp<SkPicture> make_test_picture(int w, int h) {
+    SkPictureRecorder recorder;
+    SkCanvas* canvas = recorder.beginRecording(SkRect::MakeIWH(w, h));
+    canvas->clear(SK_ColorWHITE);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setColor(SK_ColorBLUE);
+    // Circles straddling the tile boundaries, to check that clipped playback matches the
+    // serial result along tile edges.
+    canvas->drawCircle(w / 2.0f, h / 2.0f, w / 3.0f, paint);
+    paint.setColor(SK_ColorRED);
+    canvas->drawCircle(0, 0, w / 4.0f, paint);
+    paint.setColor(SK_ColorGREEN);
+    canvas->drawCircle(w * 0.9f, h * 0.7f, h / 5.0f, paint);
+    return recorder.finishRecordingAsPicture();
+}
+
+DEF_TEST(RasterTilePlayback, reporter) {
+    static constexpr int kW = 99, kH = 77;
+    sk_sp<SkPicture> picture = make_test_picture(kW, kH);
+
+    SkBitmap serial, tiled;
+    serial.allocN32Pixels(kW, kH);
+    tiled.allocN32Pixels(kW, kH);
+
+    picture->playback(SkCanvas::MakeRasterDirect(serial.info(), serial.getPixels(),
+                                                 serial.rowBytes()).get());
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkPixmap dst;
+    REPORTER_ASSERT(reporter, tiled.peekPixels(&dst));
+    REPORTER_ASSERT(reporter,
+                    SkPlayPictureTiledParallel(dst, picture, 3, 2, executor.get()));
+
+    for (int y = 0; y < kH; ++y) {
+        REPORTER_ASSERT(reporter, !memcmp(serial.getAddr32(0, y), tiled.getAddr32(0, y),
+                                          kW * sizeof(uint32_t)));
+    }
+
+    // Overlapping tile clips must be rejected before any thread draws.
+    SkRasterTile overlapping[2] = {{picture, SkIRect::MakeWH(50, 50)},
+                                   {picture, SkIRect::MakeXYWH(25, 25, 50, 50)}};
+    REPORTER_ASSERT(reporter, !SkPlayTilesParallel(dst, overlapping, 2, executor.get()));
+}
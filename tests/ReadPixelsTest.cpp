@@ -527,3 +527,58 @@ DEF_TEST(ReadPixels_InvalidRowBytes, reporter) {
         REPORTER_ASSERT(reporter, !surf->readPixels(dstII, storage.get(), badRowBytes, 0, 0));
     }
 }
+
+DEF_TEST(AsyncReadPixelsTiled_Raster, reporter) {
+    auto srcII = SkImageInfo::Make({13, 13}, kN32_SkColorType, kPremul_SkAlphaType);
+    auto surf = SkSurface::MakeRaster(srcII);
+    fill_src_canvas(surf->getCanvas());
+    auto image = surf->makeImageSnapshot();
+
+    struct TileResult {
+        SkIRect fRect;
+        std::unique_ptr<const SkImage::AsyncReadResult> fResult;
+    };
+    struct Context {
+        std::vector<TileResult> fTiles;
+    } context;
+    auto callback = [](void* c, const SkIRect& tileRect,
+                       std::unique_ptr<const SkImage::AsyncReadResult> result) {
+        static_cast<Context*>(c)->fTiles.push_back({tileRect, std::move(result)});
+    };
+
+    // Raster delivers every band synchronously, top to bottom.
+    image->asyncRescaleAndReadPixelsTiled(srcII, srcII.bounds(), /*tileRows=*/4,
+                                          SkImage::RescaleGamma::kSrc,
+                                          SkImage::RescaleMode::kNearest,
+                                          callback, &context);
+    REPORTER_ASSERT(reporter, context.fTiles.size() == 4);  // 4 + 4 + 4 + 1 rows
+    int expectedTop = 0;
+    for (const TileResult& tile : context.fTiles) {
+        REPORTER_ASSERT(reporter, tile.fResult && tile.fResult->count() == 1);
+        if (!tile.fResult) {
+            continue;
+        }
+        REPORTER_ASSERT(reporter, tile.fRect.top() == expectedTop);
+        REPORTER_ASSERT(reporter, tile.fRect.width() == srcII.width());
+        expectedTop = tile.fRect.bottom();
+        for (int y = 0; y < tile.fRect.height(); ++y) {
+            const SkPMColor* row = reinterpret_cast<const SkPMColor*>(
+                    static_cast<const char*>(tile.fResult->data(0)) +
+                    y*tile.fResult->rowBytes(0));
+            for (int x = 0; x < tile.fRect.width(); ++x) {
+                REPORTER_ASSERT(reporter,
+                                row[x] == get_src_color(x, tile.fRect.top() + y));
+            }
+        }
+    }
+    REPORTER_ASSERT(reporter, expectedTop == srcII.height());
+
+    // An uncontained srcRect fails with a single empty-rect callback.
+    context.fTiles.clear();
+    image->asyncRescaleAndReadPixelsTiled(srcII, SkIRect::MakeWH(50, 50), /*tileRows=*/4,
+                                          SkImage::RescaleGamma::kSrc,
+                                          SkImage::RescaleMode::kNearest,
+                                          callback, &context);
+    REPORTER_ASSERT(reporter, context.fTiles.size() == 1);
+    REPORTER_ASSERT(reporter, context.fTiles[0].fRect.isEmpty() && !context.fTiles[0].fResult);
+}
@@ -684,6 +684,68 @@ DEF_GPUTEST_FOR_RENDERING_CONTEXTS(ImageAsyncReadPixels, reporter, ctxInfo) {
     }
 }
 
+namespace {
+struct AsyncTileContext {
+    SkPixmap fDst;       // full-result destination; tiles land at their tileRect
+    int fCalled = 0;
+    int fFailed = 0;
+};
+}  // anonymous namespace
+
+static void async_tile_callback(void* c, const SkIRect& tileRect,
+                                std::unique_ptr<const SkImage::AsyncReadResult> result) {
+    auto context = static_cast<AsyncTileContext*>(c);
+    ++context->fCalled;
+    if (!result) {
+        ++context->fFailed;
+        return;
+    }
+    size_t bpp = context->fDst.info().bytesPerPixel();
+    char* dst = static_cast<char*>(context->fDst.writable_addr()) +
+                tileRect.top()*context->fDst.rowBytes() + tileRect.left()*bpp;
+    SkRectMemcpy(dst, context->fDst.rowBytes(), result->data(0), result->rowBytes(0),
+                 tileRect.width()*bpp, tileRect.height());
+}
+
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(SurfaceAsyncReadPixelsTiled, reporter, ctxInfo) {
+    auto direct = ctxInfo.directContext();
+    const auto ii = SkImageInfo::Make(17, 17, kRGBA_8888_SkColorType, kPremul_SkAlphaType,
+                                      SkColorSpace::MakeSRGB());
+    auto surf = SkSurface::MakeRenderTarget(direct, SkBudgeted::kYes, ii);
+    if (!surf) {
+        return;
+    }
+    SkAutoPixmapStorage ref = make_ref_data(ii, /*forceOpaque=*/false);
+    surf->writePixels(ref, 0, 0);
+
+    // tileRows outside (0, height) must collapse to a single callback.
+    for (int tileRows : {0, 5, ii.height(), 100}) {
+        SkAutoPixmapStorage read;
+        read.alloc(ii);
+        read.erase(SK_ColorTRANSPARENT);
+        AsyncTileContext context;
+        context.fDst = read;
+        surf->asyncRescaleAndReadPixelsTiled(ii, ii.bounds(), tileRows,
+                                             SkImage::RescaleGamma::kSrc,
+                                             SkImage::RescaleMode::kNearest,
+                                             async_tile_callback, &context);
+        direct->submit();
+        int expected = (tileRows > 0 && tileRows < ii.height())
+                               ? (ii.height() + tileRows - 1)/tileRows
+                               : 1;
+        while (context.fCalled < expected) {
+            direct->checkAsyncWorkCompletion();
+        }
+        REPORTER_ASSERT(reporter, context.fCalled == expected);
+        REPORTER_ASSERT(reporter, context.fFailed == 0);
+        for (int y = 0; y < ii.height() && !context.fFailed; ++y) {
+            REPORTER_ASSERT(reporter,
+                            !memcmp(read.addr(0, y), ref.addr(0, y), ii.minRowBytes()),
+                            "tileRows %d mismatch at row %d", tileRows, y);
+        }
+    }
+}
+
 DEF_GPUTEST(AsyncReadPixelsContextShutdown, reporter, options) {
     const auto ii = SkImageInfo::Make(10, 10, kRGBA_8888_SkColorType, kPremul_SkAlphaType,
                                       SkColorSpace::MakeSRGB());
@@ -414,3 +414,164 @@ DEF_TEST(savelayer_srcmode_alpha, r) {
     do_savelayer_srcmode(r, 0x80FF0000);
 }
 
+
+DEF_TEST(RecordOpts_MergeNestedSaveLayers, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    SkRect outerBounds = SkRect::MakeXYWH(10, 10, 200, 200);
+    SkRect innerBounds = SkRect::MakeXYWH(50, 50, 400, 400);
+
+    SkPaint outerPaint, innerPaint;
+    outerPaint.setAlphaf(0.5f);
+    innerPaint.setAlphaf(0.5f);
+
+    recorder.saveLayer(&outerBounds, &outerPaint);
+        recorder.saveLayer(&innerBounds, &innerPaint);
+            recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+        recorder.restore();
+    recorder.restore();
+
+    SkRecordMergeNestedSaveLayers(&record);
+
+    assert_type<SkRecords::NoOp>(r, record, 0);       // outer SaveLayer
+    assert_type<SkRecords::SaveLayer>(r, record, 1);
+    assert_type<SkRecords::DrawRect>(r, record, 2);
+    assert_type<SkRecords::Restore>(r, record, 3);
+    assert_type<SkRecords::NoOp>(r, record, 4);       // outer Restore
+
+    const SkRecords::SaveLayer* merged = assert_type<SkRecords::SaveLayer>(r, record, 1);
+    // The outer alpha folds into the inner paint, and the bounds hints intersect.
+    REPORTER_ASSERT(r, merged->paint->getAlpha() == SkMulDiv255Round(0x80, 0x80));
+    REPORTER_ASSERT(r, *merged->bounds == SkRect::MakeXYWH(50, 50, 160, 160));
+}
+
+DEF_TEST(RecordOpts_MergeNestedSaveLayersBlocked, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    SkPaint opacity;
+    opacity.setAlphaf(0.5f);
+
+    // A draw between the layers means the outer layer holds more than the inner one.
+    recorder.saveLayer(nullptr, &opacity);
+        recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+        recorder.saveLayer(nullptr, &opacity);
+            recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+        recorder.restore();
+    recorder.restore();
+
+    SkRecordMergeNestedSaveLayers(&record);
+
+    REPORTER_ASSERT(r, 2 == count_instances_of_type<SkRecords::SaveLayer>(record));
+}
+
+DEF_TEST(RecordOpts_NoopPassthroughSaveLayers, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    // An opaque src-over layer around src-over draws does nothing.
+    recorder.saveLayer(nullptr, nullptr);
+        recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+        recorder.drawRect(SkRect::MakeWH(50, 50), SkPaint());
+    recorder.restore();
+
+    // A non-src-over draw inside must keep its layer.
+    SkPaint clear;
+    clear.setBlendMode(SkBlendMode::kClear);
+    recorder.saveLayer(nullptr, nullptr);
+        recorder.drawRect(SkRect::MakeWH(100, 100), clear);
+    recorder.restore();
+
+    // So must a layer with alpha.
+    SkPaint opacity;
+    opacity.setAlphaf(0.5f);
+    recorder.saveLayer(nullptr, &opacity);
+        recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+    recorder.restore();
+
+    SkRecordNoopPassthroughSaveLayers(&record);
+
+    assert_type<SkRecords::NoOp>(r, record, 0);
+    assert_type<SkRecords::DrawRect>(r, record, 1);
+    assert_type<SkRecords::DrawRect>(r, record, 2);
+    assert_type<SkRecords::NoOp>(r, record, 3);
+
+    assert_type<SkRecords::SaveLayer>(r, record, 4);
+    assert_type<SkRecords::Restore>(r, record, 6);
+
+    assert_type<SkRecords::SaveLayer>(r, record, 7);
+    assert_type<SkRecords::Restore>(r, record, 9);
+}
+
+DEF_TEST(RecordOpts_CollapseMatrixConcats, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    recorder.translate(10, 20);
+    recorder.translate(5, 5);
+    recorder.concat(SkMatrix::Scale(2, 2));
+    recorder.concat(SkMatrix::RotateDeg(45));
+    recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+
+    SkRecordCollapseMatrixConcats(&record);
+
+    assert_type<SkRecords::NoOp>(r, record, 0);
+    const SkRecords::Translate* translate = assert_type<SkRecords::Translate>(r, record, 1);
+    REPORTER_ASSERT(r, translate->dx == 15 && translate->dy == 25);
+
+    assert_type<SkRecords::NoOp>(r, record, 2);
+    // SkCanvas routes SkMatrix concats through didConcat44.
+    const SkRecords::Concat44* concat = assert_type<SkRecords::Concat44>(r, record, 3);
+    REPORTER_ASSERT(r, concat->matrix ==
+                       SkM44(SkMatrix::Scale(2, 2)) * SkM44(SkMatrix::RotateDeg(45)));
+}
+
+DEF_TEST(RecordOpts_MergeClipIntersections, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    recorder.clipRect(SkRect::MakeLTRB(0, 0, 100, 100));
+    recorder.clipRect(SkRect::MakeLTRB(50, 50, 200, 200));
+    recorder.drawRect(SkRect::MakeWH(100, 100), SkPaint());
+    // AA mismatch must block the merge.
+    recorder.clipRect(SkRect::MakeWH(80, 80), SkClipOp::kIntersect, true);
+    recorder.clipRect(SkRect::MakeWH(60, 60), SkClipOp::kIntersect, false);
+
+    SkRecordMergeClipIntersections(&record);
+
+    assert_type<SkRecords::NoOp>(r, record, 0);
+    const SkRecords::ClipRect* clip = assert_type<SkRecords::ClipRect>(r, record, 1);
+    REPORTER_ASSERT(r, clip->rect == SkRect::MakeLTRB(50, 50, 100, 100));
+
+    assert_type<SkRecords::ClipRect>(r, record, 3);
+    assert_type<SkRecords::ClipRect>(r, record, 4);
+}
+
+DEF_TEST(RecordOpts_FuseDrawImageRuns, r) {
+    auto surface = SkSurface::MakeRasterN32Premul(8, 8);
+    surface->getCanvas()->clear(SK_ColorGREEN);
+    sk_sp<SkImage> image = surface->makeImageSnapshot();
+
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    recorder.drawImage(image, 0, 0, SkSamplingOptions(), nullptr);
+    recorder.drawImage(image, 10, 0, SkSamplingOptions(), nullptr);
+    recorder.drawImage(image, 20, 0, SkSamplingOptions(), nullptr);
+    // A paint blocks fusion from this point on.
+    SkPaint halfAlpha;
+    halfAlpha.setAlphaf(0.5f);
+    recorder.drawImage(image, 30, 0, SkSamplingOptions(), &halfAlpha);
+
+    SkRecordFuseDrawImageRuns(&record);
+
+    const SkRecords::DrawEdgeAAImageSet* set =
+            assert_type<SkRecords::DrawEdgeAAImageSet>(r, record, 0);
+    REPORTER_ASSERT(r, set->count == 3);
+    REPORTER_ASSERT(r, set->set[1].fDstRect == SkRect::MakeXYWH(10, 0, 8, 8));
+    REPORTER_ASSERT(r, set->set[2].fImage == image);
+    assert_type<SkRecords::NoOp>(r, record, 1);
+    assert_type<SkRecords::NoOp>(r, record, 2);
+    assert_type<SkRecords::DrawImage>(r, record, 3);
+}
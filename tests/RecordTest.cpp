@@ -97,6 +97,33 @@ DEF_TEST(Record_defrag, r) {
     assert_type<SkRecords::Restore >(r, record, 3);
 }
 
+DEF_TEST(Record_appendRange, r) {
+    auto src = sk_make_sp<SkRecord>();
+    SkRect rect = SkRect::MakeWH(10, 10);
+    SkPaint paint;
+    APPEND((*src), SkRecords::Save);
+    APPEND((*src), SkRecords::DrawRect, paint, rect);
+    APPEND((*src), SkRecords::Restore);
+
+    SkRecord dst;
+    REPORTER_ASSERT(r, dst.appendRange(src, 0, src->count()));
+    REPORTER_ASSERT(r, dst.count() == 3);
+    assert_type<SkRecords::Save    >(r, dst, 0);
+    assert_type<SkRecords::DrawRect>(r, dst, 1);
+    assert_type<SkRecords::Restore >(r, dst, 2);
+
+    AreaSummer summer;
+    summer.apply(dst);
+    REPORTER_ASSERT(r, summer.area() == 100);
+
+    // Ranges containing commands that own their pointees can't be spliced.
+    auto layered = sk_make_sp<SkRecord>();
+    new (layered->append<SkRecords::SaveLayer>()) SkRecords::SaveLayer();
+    SkRecord dst2;
+    REPORTER_ASSERT(r, !dst2.appendRange(layered, 0, layered->count()));
+    REPORTER_ASSERT(r, dst2.count() == 0);
+}
+
 #undef APPEND
 
 template <typename T>
@@ -117,3 +144,45 @@ DEF_TEST(Record_Alignment, r) {
         REPORTER_ASSERT(r, is_aligned(record.alloc<uint64_t>()));
     }
 }
+
+#include "src/core/SkRecordSizeProfile.h"
+#include "src/core/SkRecorder.h"
+
+DEF_TEST(RecordSizeProfile, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, 100, 100);
+
+    SkPath path;
+    path.moveTo(0, 0);
+    path.cubicTo(10, 10, 20, 0, 30, 10);
+    path.close();
+    SkPath other;
+    other.moveTo(5, 5);
+    other.lineTo(40, 40);
+
+    SkPaint paint;
+    recorder.drawPath(path, paint);
+    recorder.drawPath(path, paint);  // same SkPathRef as above
+    recorder.drawPath(other, paint);
+    recorder.drawRect({0, 0, 50, 50}, paint);
+
+    SkRecordSizeProfile profile;
+    SkRecordComputeSizeProfile(record, &profile);
+
+    REPORTER_ASSERT(r, profile.fTotalOps == 4);
+    const SkRecordSizeProfile::OpStats& drawPath = profile.fOps[SkRecords::DrawPath_Type];
+    REPORTER_ASSERT(r, 0 == strcmp(drawPath.fName, "DrawPath"));
+    REPORTER_ASSERT(r, drawPath.fCount == 3);
+
+    // Three refs to two distinct paths: the shared path's bytes are charged only once.
+    REPORTER_ASSERT(r, profile.fPathRefs == 3);
+    REPORTER_ASSERT(r, profile.fUniquePaths == 2);
+    REPORTER_ASSERT(r, profile.fUniquePathBytes ==
+                               path.approximateBytesUsed() + other.approximateBytesUsed());
+    REPORTER_ASSERT(r, drawPath.fBytes ==
+                               3 * sizeof(SkRecords::DrawPath) + profile.fUniquePathBytes);
+
+    REPORTER_ASSERT(r, profile.fOps[SkRecords::DrawRect_Type].fCount == 1);
+    REPORTER_ASSERT(r, profile.fTotalBytes > 0);
+    REPORTER_ASSERT(r, profile.fImageRefs == 0 && profile.fTextBlobRefs == 0);
+}
@@ -1458,6 +1458,138 @@ static void test_partial_purge(skiatest::Reporter* reporter) {
     }
 }
 
+static void test_purge_watermark(skiatest::Reporter* reporter) {
+    Mock mock(300);
+    GrResourceCache* cache = mock.cache();
+    GrGpu* gpu = mock.gpu();
+
+    cache->setPurgeWatermark(100);
+
+    int notifications = 0;
+    cache->setNearBudgetProc([](void* context, size_t, size_t) {
+        *static_cast<int*>(context) += 1;
+    }, &notifications);
+
+    GrUniqueKey key1, key2, key3, key4, key5;
+    make_unique_key<0>(&key1, 1);
+    make_unique_key<0>(&key2, 2);
+    make_unique_key<0>(&key3, 3);
+    make_unique_key<0>(&key4, 4);
+    make_unique_key<0>(&key5, 5);
+
+    // Crossing the 100 byte watermark fires the near-budget callback exactly once.
+    TestResource* a = new TestResource(gpu, SkBudgeted::kYes, 60);
+    a->resourcePriv().setUniqueKey(key1);
+    REPORTER_ASSERT(reporter, 0 == notifications);
+    TestResource* b = new TestResource(gpu, SkBudgeted::kYes, 60);
+    b->resourcePriv().setUniqueKey(key2);
+    REPORTER_ASSERT(reporter, 1 == notifications);
+    TestResource* c = new TestResource(gpu, SkBudgeted::kYes, 60);
+    c->resourcePriv().setUniqueKey(key3);
+    REPORTER_ASSERT(reporter, 1 == notifications);
+
+    // Nothing is purgeable while we hold refs, so pre-eviction can't free anything.
+    cache->purgeToWatermark();
+    REPORTER_ASSERT(reporter, 180 == cache->getBudgetedResourceBytes());
+
+    // Once our refs are dropped the resources sit purgeable under their unique keys, and
+    // pre-eviction purges in LRU order until we're at or below the watermark.
+    a->unref();
+    b->unref();
+    c->unref();
+    REPORTER_ASSERT(reporter, 3 == TestResource::NumAlive());
+    cache->purgeToWatermark();
+    REPORTER_ASSERT(reporter, 1 == TestResource::NumAlive());
+    REPORTER_ASSERT(reporter, 60 == cache->getBudgetedResourceBytes());
+    REPORTER_ASSERT(reporter, !cache->findAndRefUniqueResource(key1));
+    REPORTER_ASSERT(reporter, !cache->findAndRefUniqueResource(key2));
+
+    // Dropping below the watermark re-armed the callback.
+    TestResource* d = new TestResource(gpu, SkBudgeted::kYes, 60);
+    d->resourcePriv().setUniqueKey(key4);
+    REPORTER_ASSERT(reporter, 2 == notifications);
+    d->unref();
+
+    // Pre-eviction isn't counted as over-budget purging, but busting the 300 byte budget is:
+    // inserting 250 bytes on top of 120 purgeable ones forces 120 bytes out reactively.
+    REPORTER_ASSERT(reporter, 0 == cache->overbudgetPurgeBytes());
+    TestResource* e = new TestResource(gpu, SkBudgeted::kYes, 250);
+    e->resourcePriv().setUniqueKey(key5);
+    REPORTER_ASSERT(reporter, 120 == cache->overbudgetPurgeBytes());
+    REPORTER_ASSERT(reporter, 250 == cache->getBudgetedResourceBytes());
+    e->unref();
+
+    cache->setNearBudgetProc(nullptr, nullptr);
+    cache->purgeUnlockedResources();
+    REPORTER_ASSERT(reporter, 0 == TestResource::NumAlive());
+}
+
+static void test_budget_partitions(skiatest::Reporter* reporter) {
+    Mock mock(1000);
+    GrResourceCache* cache = mock.cache();
+    GrGpu* gpu = mock.gpu();
+
+    uint32_t clientA = cache->createPartition("clientA", 100);
+    uint32_t clientB = cache->createPartition("clientB", 0);
+    REPORTER_ASSERT(reporter, 0 == strcmp("clientA", cache->partitionName(clientA)));
+
+    GrUniqueKey key1, key2, key3;
+    make_unique_key<0>(&key1, 1);
+    make_unique_key<0>(&key2, 2);
+    make_unique_key<0>(&key3, 3);
+
+    // Resources created while a partition is active are accounted against it.
+    cache->setActivePartition(clientA);
+    TestResource* a1 = new TestResource(gpu, SkBudgeted::kYes, 60);
+    a1->resourcePriv().setUniqueKey(key1);
+    TestResource* a2 = new TestResource(gpu, SkBudgeted::kYes, 30);
+    a2->resourcePriv().setUniqueKey(key2);
+    cache->setActivePartition(clientB);
+    TestResource* b1 = new TestResource(gpu, SkBudgeted::kYes, 60);
+    b1->resourcePriv().setUniqueKey(key3);
+    cache->setActivePartition(GrResourceCache::kDefaultPartition);
+
+    GrResourceCache::PartitionStats stats;
+    REPORTER_ASSERT(reporter, cache->getPartitionStats(clientA, &stats));
+    REPORTER_ASSERT(reporter, 90 == stats.fBudgetedBytes);
+    REPORTER_ASSERT(reporter, 100 == stats.fMaxBytes);
+    REPORTER_ASSERT(reporter, cache->getPartitionStats(clientB, &stats));
+    REPORTER_ASSERT(reporter, 60 == stats.fBudgetedBytes);
+    REPORTER_ASSERT(reporter, !cache->getPartitionStats(99, &stats));
+
+    // Busting clientA's quota evicts only clientA's purgeable resources, LRU first, even though
+    // the cache as a whole is nowhere near its budget.
+    a1->unref();
+    a2->unref();
+    b1->unref();
+    cache->setActivePartition(clientA);
+    TestResource* a3 = new TestResource(gpu, SkBudgeted::kYes, 50);
+    cache->setActivePartition(GrResourceCache::kDefaultPartition);
+
+    REPORTER_ASSERT(reporter, cache->getPartitionStats(clientA, &stats));
+    REPORTER_ASSERT(reporter, 80 == stats.fBudgetedBytes);  // a1 (oldest) was evicted
+    REPORTER_ASSERT(reporter, 60 == stats.fPurgedBytes);
+    REPORTER_ASSERT(reporter, !cache->findAndRefUniqueResource(key1));
+    GrGpuResource* res = cache->findAndRefUniqueResource(key2);
+    REPORTER_ASSERT(reporter, res);
+    SkSafeUnref(res);
+
+    // clientB has no quota and was untouched.
+    REPORTER_ASSERT(reporter, cache->getPartitionStats(clientB, &stats));
+    REPORTER_ASSERT(reporter, 60 == stats.fBudgetedBytes);
+    REPORTER_ASSERT(reporter, 0 == stats.fPurgedBytes);
+
+    // Tightening a quota purges immediately.
+    cache->setPartitionLimit(clientB, 10);
+    REPORTER_ASSERT(reporter, cache->getPartitionStats(clientB, &stats));
+    REPORTER_ASSERT(reporter, 0 == stats.fBudgetedBytes);
+    REPORTER_ASSERT(reporter, 60 == stats.fPurgedBytes);
+
+    a3->unref();
+    cache->purgeUnlockedResources();
+    REPORTER_ASSERT(reporter, 0 == TestResource::NumAlive());
+}
+
 static void test_custom_data(skiatest::Reporter* reporter) {
     GrUniqueKey key1, key2;
     make_unique_key<0>(&key1, 1);
@@ -1627,6 +1759,8 @@ DEF_GPUTEST(ResourceCacheMisc, reporter, /* options */) {
     test_timestamp_wrap(reporter);
     test_time_purge(reporter);
     test_partial_purge(reporter);
+    test_purge_watermark(reporter);
+    test_budget_partitions(reporter);
     test_custom_data(reporter);
     test_abandoned(reporter);
     test_tags(reporter);
@@ -5,8 +5,11 @@
  * found in the LICENSE file.
  */
 
+#include "include/third_party/skcms/skcms.h"
 #include "src/core/SkColorSpacePriv.h"
 #include "src/core/SkColorSpaceXformSteps.h"
+#include "src/core/SkRasterPipeline.h"
+#include "src/core/SkVM.h"
 #include "tests/Test.h"
 
 DEF_TEST(SkColorSpaceXformSteps, r) {
@@ -170,3 +173,83 @@ DEF_TEST(SkColorSpaceXformSteps, r) {
                 (t&16) ? " true" : "false");
     }
 }
+
+DEF_TEST(SkColorSpaceXformSteps_srgbLut, r) {
+    // An sRGB -> linear-sRGB conversion of opaque pixels is a lone linearize step, which
+    // apply(SkRasterPipeline*, SkColorType) may run as an interpolated table for 8-bit sources.
+    auto srgb  = SkColorSpace::MakeSRGB(),
+         srgb1 = srgb->makeLinearGamma();
+    SkColorSpaceXformSteps steps(srgb.get(), kOpaque_SkAlphaType, srgb1.get(), kOpaque_SkAlphaType);
+    REPORTER_ASSERT(r, steps.flags.linearize && !steps.flags.encode);
+
+    auto run = [&](float v, SkColorType srcCT) {
+        float rgba[4] = { v, v, v, 1.0f };
+        SkRasterPipeline_MemoryCtx ctx = { rgba, 0 };
+        SkRasterPipeline_<256> p;
+        p.append(SkRasterPipeline::load_f32, &ctx);
+        steps.apply(&p, srcCT);
+        p.append(SkRasterPipeline::store_f32, &ctx);
+        p.run(0,0,1,1);
+        return rgba[0];
+    };
+
+    for (int i = 0; i < 256; i++) {
+        float v = i * (1 / 255.0f),
+              expected = skcms_TransferFunction_eval(&SkNamedTransferFn::kSRGB, v);
+        // 8-bit inputs land on the table's sample points.
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(run(v, kRGBA_8888_SkColorType), expected, 1e-6f));
+        // Float inputs take the exact path, which agrees with skcms to approx_powf precision.
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(run(v, kRGBA_F32_SkColorType), expected, 1e-4f));
+    }
+
+    // Between sample points (e.g. after bilinear filtering) the table interpolates closely.
+    for (float v : { 0.001f, 0.013f, 0.0404f, 0.1f, 0.33337f, 0.5601f, 0.77f, 0.9999f }) {
+        float expected = skcms_TransferFunction_eval(&SkNamedTransferFn::kSRGB, v);
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(run(v, kRGBA_8888_SkColorType), expected, 1e-4f));
+    }
+}
+
+DEF_TEST(SkColorSpaceXformSteps_approxSrgbProgram, r) {
+    // program(..., srcCT, dstCT) may swap a parametric sRGB curve for a cheap approximation when
+    // the matching endpoint is 8-bit; the approximations must stay within one 8-bit step.
+    auto srgb  = SkColorSpace::MakeSRGB(),
+         srgb1 = srgb->makeLinearGamma();
+
+    auto run = [&](const SkColorSpaceXformSteps& steps,
+                   SkColorType srcCT, SkColorType dstCT, float v) {
+        skvm::Builder b;
+        skvm::Uniforms uniforms(b.uniform(), 0);
+        skvm::Ptr src = b.varying<float>(),
+                  dst = b.varying<float>();
+        skvm::F32 x = b.loadF(src);
+        skvm::Color c = steps.program(&b, &uniforms, {x,x,x, b.splat(1.0f)}, srcCT, dstCT);
+        b.storeF(dst, c.r);
+
+        float out;
+        b.done().eval(1, uniforms.buf.data(), &v, &out);
+        return out;
+    };
+
+    SkColorSpaceXformSteps linearize(srgb .get(), kOpaque_SkAlphaType,
+                                     srgb1.get(), kOpaque_SkAlphaType),
+                           encode   (srgb1.get(), kOpaque_SkAlphaType,
+                                     srgb .get(), kOpaque_SkAlphaType);
+
+    for (int i = 0; i < 256; i++) {
+        float v = i * (1/255.0f),
+              linear = skcms_TransferFunction_eval(&SkNamedTransferFn::kSRGB, v);
+
+        // sRGB-encoded 8-bit source: the cubic EOTF fit.
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(
+                run(linearize, kRGBA_8888_SkColorType, kRGBA_F32_SkColorType, v),
+                linear, 1/255.0f));
+        // Linear source headed for an 8-bit sRGB dest: the sqrt-based inverse fit.
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(
+                run(encode, kRGBA_F32_SkColorType, kRGBA_8888_SkColorType, linear),
+                v, 1/255.0f));
+        // Float endpoints on both sides fall back to the exact curves.
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(
+                run(linearize, kRGBA_F32_SkColorType, kRGBA_F32_SkColorType, v),
+                linear, 1e-4f));
+    }
+}
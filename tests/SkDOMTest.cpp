@@ -83,4 +83,27 @@ DEF_TEST(SkDOM_test, r) {
     }
 }
 
+DEF_TEST(SkDOM_sharedNameStrings, r) {
+    static const char gDoc[] =
+        "<root><item width='10'/><item width='20'/></root>";
+
+    SkMemoryStream docStream(gDoc, sizeof(gDoc) - 1);
+    SkDOM dom;
+    const SkDOM::Node* root = dom.build(docStream);
+    REPORTER_ASSERT(r, root);
+
+    const SkDOM::Node* first = dom.getFirstChild(root);
+    const SkDOM::Node* second = dom.getNextSibling(first);
+    REPORTER_ASSERT(r, first && second);
+
+    // Repeated element and attribute names should share a single interned arena copy.
+    REPORTER_ASSERT(r, dom.getName(first) == dom.getName(second));
+
+    SkDOM::AttrIter i1(dom, first), i2(dom, second);
+    const char* value;
+    const char* n1 = i1.next(&value);
+    const char* n2 = i2.next(&value);
+    REPORTER_ASSERT(r, n1 && n1 == n2);
+}
+
 #endif // SK_XML
@@ -50,6 +50,53 @@ DEF_TEST(SkRasterPipeline_nonsense, r) {
     p.run(0,0,20,1);
 }
 
+DEF_TEST(SkRasterPipeline_stage_trace, r) {
+    SkRasterPipeline::ResetStageTraceStats();
+    SkRasterPipeline::SetStageTraceRate(1);  // instrument every execution
+
+    uint64_t red  = 0x3c00000000003c00ull,
+             blue = 0x3800380000000000ull,
+             result;
+
+    SkRasterPipeline_MemoryCtx load_s_ctx = { &blue, 0 },
+                               load_d_ctx = { &red, 0 },
+                               store_ctx  = { &result, 0 };
+
+    SkRasterPipeline_<256> p;
+    p.append(SkRasterPipeline::load_f16,     &load_s_ctx);
+    p.append(SkRasterPipeline::load_f16_dst, &load_d_ctx);
+    p.append(SkRasterPipeline::srcover);
+    p.append(SkRasterPipeline::store_f16, &store_ctx);
+    // Run a few times: concurrently running tests can win the one-at-a-time
+    // stamped-execution slot, so a single run isn't guaranteed to be sampled.
+    for (int i = 0; i < 10; i++) {
+        p.run(0,0,1,1);
+    }
+
+    SkRasterPipeline::SetStageTraceRate(0);
+
+    // The stamps must not disturb the pipeline's results.
+    REPORTER_ASSERT(r, ((result >>  0) & 0xffff) == 0x3800);
+    REPORTER_ASSERT(r, ((result >> 16) & 0xffff) == 0x0000);
+    REPORTER_ASSERT(r, ((result >> 32) & 0xffff) == 0x3800);
+    REPORTER_ASSERT(r, ((result >> 48) & 0xffff) == 0x3c00);
+
+    // All four of our stages should have been sampled, most expensive first.
+    SkRasterPipeline::StageTraceStats stats[64];
+    int n = SkRasterPipeline::GetStageTraceStats(stats, 64);
+    int found = 0;
+    for (int i = 0; i < n; i++) {
+        REPORTER_ASSERT(r, stats[i].samples > 0);
+        REPORTER_ASSERT(r, i == 0 || stats[i].ticks <= stats[i-1].ticks);
+        for (const char* name : {"load_f16", "load_f16_dst", "srcover", "store_f16"}) {
+            if (0 == strcmp(stats[i].name, name)) {
+                found++;
+            }
+        }
+    }
+    REPORTER_ASSERT(r, found == 4);
+}
+
 DEF_TEST(SkRasterPipeline_JIT, r) {
     // This tests a couple odd corners that a JIT backend can stumble over.
 
@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkGraphics.h"
 #include "include/core/SkPicture.h"
 #include "include/core/SkPictureRecorder.h"
@@ -289,3 +290,69 @@ DEF_TEST(ResourceCache_purge, reporter) {
         }
     }
 }
+
+DEF_TEST(ResourceCache_purgePartial, reporter) {
+    static const int kRecCount = 10;
+    const size_t kRecSize = 1024;   // TestRec::bytesUsed()
+
+    SkResourceCache cache(1024 * 1024);
+    int flags[kRecCount] = {};
+    for (int i = 0; i < kRecCount; ++i) {
+        auto rec = std::make_unique<TestRec>(1, i, &flags[i]);
+        rec->fCanBePurged = true;
+        cache.add(rec.release(), nullptr);
+    }
+    REPORTER_ASSERT(reporter, cache.getTotalBytesUsed() == kRecCount * kRecSize);
+
+    // Purge a slice and verify we stopped once the request was met.
+    size_t freed = cache.purgePartial(3 * kRecSize);
+    REPORTER_ASSERT(reporter, freed == 3 * kRecSize);
+    REPORTER_ASSERT(reporter, cache.getTotalBytesUsed() == (kRecCount - 3) * kRecSize);
+
+    // A subsequent call resumes where the previous one stopped.
+    freed = cache.purgePartial(2 * kRecSize);
+    REPORTER_ASSERT(reporter, freed == 2 * kRecSize);
+    REPORTER_ASSERT(reporter, cache.getTotalBytesUsed() == (kRecCount - 5) * kRecSize);
+
+    // An oversized request drains the cache and reports what was actually freed.
+    freed = cache.purgePartial(2 * kRecCount * kRecSize);
+    REPORTER_ASSERT(reporter, freed == (kRecCount - 5) * kRecSize);
+    REPORTER_ASSERT(reporter, cache.getTotalBytesUsed() == 0);
+}
+
+DEF_TEST(ResourceCache_shardStats, reporter) {
+    // The global cache is sharded; exercise it through the static API and make sure the
+    // contention counters advance sensibly.
+    SkResourceCache::ShardStats before[64];
+    int shardCount = SkResourceCache::GetShardStats(before, SK_ARRAY_COUNT(before));
+    REPORTER_ASSERT(reporter, shardCount > 0);
+    REPORTER_ASSERT(reporter, shardCount <= (int)SK_ARRAY_COUNT(before));
+
+    // Touch every shard at least once.
+    SkResourceCache::GetTotalBytesUsed();
+
+    SkResourceCache::ShardStats after[64];
+    REPORTER_ASSERT(reporter, shardCount == SkResourceCache::GetShardStats(after, shardCount));
+    for (int i = 0; i < shardCount; ++i) {
+        REPORTER_ASSERT(reporter, after[i].fLocks > before[i].fLocks);
+        REPORTER_ASSERT(reporter, after[i].fContentions <= after[i].fLocks);
+    }
+}
+
+DEF_TEST(SkGraphicsInitAsync, reporter) {
+    {
+        // The thread pool joins on destruction, so the warm-ups have all run by the end of
+        // this scope.
+        auto executor = SkExecutor::MakeFIFOThreadPool(2);
+        SkGraphics::InitAsync(executor.get());
+    }
+    SkString report;
+    SkGraphics::GetInitTimings(&report);
+    REPORTER_ASSERT(reporter, report.contains("opts:"));
+    REPORTER_ASSERT(reporter, report.contains("strike-cache:"));
+    REPORTER_ASSERT(reporter, report.contains("resource-cache:"));
+    REPORTER_ASSERT(reporter, report.contains("font-manager:"));
+
+    // Null executor is a no-op.
+    SkGraphics::InitAsync(nullptr);
+}
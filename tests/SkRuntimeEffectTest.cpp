@@ -536,6 +536,24 @@ static void test_RuntimeEffect_Shaders(skiatest::Reporter* r, GrRecordingContext
     effect.test(0xFF00FFFF);
 }
 
+DEF_TEST(SkRuntimeEffectUnusedUniforms, r) {
+    auto [effect, errorText] = SkRuntimeEffect::MakeForShader(SkString(
+            "uniform half4 liveColor;"
+            "uniform half4 deadColor;"
+            "half4 main(float2 p) { return liveColor; }"));
+    REPORTER_ASSERT(r, effect, "%s", errorText.c_str());
+
+    const SkRuntimeEffect::Uniform* live = effect->findUniform("liveColor");
+    REPORTER_ASSERT(r, live && !live->isUnused());
+
+    const SkRuntimeEffect::Uniform* dead = effect->findUniform("deadColor");
+    REPORTER_ASSERT(r, dead && dead->isUnused());
+
+    // Dead uniforms are flagged (so backends can skip declaring and uploading them), but they
+    // still occupy their slot in the uniform data layout.
+    REPORTER_ASSERT(r, effect->uniformSize() == 8 * sizeof(float));
+}
+
 DEF_TEST(SkRuntimeEffectSimple, r) {
     test_RuntimeEffect_Shaders(r, nullptr);
 }
@@ -628,6 +646,43 @@ DEF_TEST(SkRuntimeShaderBuilderReuse, r) {
     auto shader_1 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/true);
 }
 
+DEF_TEST(SkRuntimeShaderBuilderCachesShader, r) {
+    const char* kSource = R"(
+        uniform half x;
+        half4 main(float2 p) { return half4(x); }
+    )";
+
+    sk_sp<SkRuntimeEffect> effect = SkRuntimeEffect::MakeForShader(SkString(kSource)).effect;
+    REPORTER_ASSERT(r, effect);
+
+    SkRuntimeShaderBuilder b(std::move(effect));
+    b.uniform("x") = 0.5f;
+    auto shader_0 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/false);
+
+    // With no changes, the builder hands back the same (immutable) shader.
+    auto shader_1 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/false);
+    REPORTER_ASSERT(r, shader_0 == shader_1);
+
+    // Re-assigning the same value is a no-op, so the shader is still reused.
+    b.uniform("x") = 0.5f;
+    auto shader_2 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/false);
+    REPORTER_ASSERT(r, shader_0 == shader_2);
+
+    // A new value, different creation args, or a local matrix each produce a new shader.
+    b.uniform("x") = 1.0f;
+    auto shader_3 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/false);
+    REPORTER_ASSERT(r, shader_0 != shader_3);
+
+    auto shader_4 = b.makeShader(/*localMatrix=*/nullptr, /*isOpaque=*/true);
+    REPORTER_ASSERT(r, shader_3 != shader_4);
+
+    SkMatrix lm = SkMatrix::Scale(2.0f, 2.0f);
+    auto shader_5 = b.makeShader(&lm, /*isOpaque=*/false);
+    REPORTER_ASSERT(r, shader_3 != shader_5);
+    auto shader_6 = b.makeShader(&lm, /*isOpaque=*/false);
+    REPORTER_ASSERT(r, shader_5 == shader_6);
+}
+
 DEF_TEST(SkRuntimeBlendBuilderReuse, r) {
     const char* kSource = R"(
         uniform half x;
@@ -674,9 +729,9 @@ DEF_TEST(SkRuntimeShaderBuilderSetUniforms, r) {
 }
 
 DEF_TEST(SkRuntimeEffectThreaded, r) {
-    // SkRuntimeEffect uses a single compiler instance, but it's mutex locked.
-    // This tests that we can safely use it from more than one thread, and also
-    // that programs don't refer to shared structures owned by the compiler.
+    // SkRuntimeEffect draws compilers from a shared pool, one per concurrent thread.
+    // This tests that we can safely compile from more than one thread, and also
+    // that programs don't refer to shared structures owned by any one compiler.
     // skbug.com/10589
     static constexpr char kSource[] = "half4 main(float2 p) { return sk_FragCoord.xyxy; }";
 
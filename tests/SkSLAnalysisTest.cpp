@@ -0,0 +1,63 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/sksl/SkSLAnalysis.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/ir/SkSLBlock.h"
+#include "src/sksl/ir/SkSLFunctionDefinition.h"
+#include "src/sksl/ir/SkSLVarDeclarations.h"
+
+#include "tests/Test.h"
+
+// Returns the initializer expressions of the local variables declared in `main`, in order.
+static std::vector<const SkSL::Expression*> get_local_initializers(const SkSL::Program& program) {
+    std::vector<const SkSL::Expression*> initializers;
+    for (const SkSL::ProgramElement* element : program.elements()) {
+        if (!element->is<SkSL::FunctionDefinition>()) {
+            continue;
+        }
+        const SkSL::Statement& body = *element->as<SkSL::FunctionDefinition>().body();
+        for (const std::unique_ptr<SkSL::Statement>& stmt : body.as<SkSL::Block>().children()) {
+            if (stmt->is<SkSL::VarDeclaration>()) {
+                initializers.push_back(stmt->as<SkSL::VarDeclaration>().value().get());
+            }
+        }
+    }
+    return initializers;
+}
+
+DEF_TEST(SkSLAnalysisIsConstantOrUniform, r) {
+    GrShaderCaps caps(GrContextOptions{});
+    SkSL::Compiler compiler(&caps);
+    SkSL::Program::Settings settings;
+    const char* src = R"(
+        uniform half u;
+        uniform half2 uv;
+        void main() {
+            half a = u * 2 + uv.x;
+            half b = a + 1;
+            half c = u + half(sk_FragCoord.x);
+            sk_FragColor = half4(a, b, c, 1);
+        }
+    )";
+    std::unique_ptr<SkSL::Program> program =
+            compiler.convertProgram(SkSL::ProgramKind::kFragment, SkSL::String(src), settings);
+    if (!program) {
+        ERRORF(r, "Program failed to compile:\n%s\n%s\n", src, compiler.errorText().c_str());
+        return;
+    }
+    std::vector<const SkSL::Expression*> initializers = get_local_initializers(*program);
+    REPORTER_ASSERT(r, initializers.size() == 3);
+    if (initializers.size() == 3) {
+        // `u * 2 + uv.x` only touches uniforms and constants.
+        REPORTER_ASSERT(r, SkSL::Analysis::IsConstantOrUniform(*initializers[0]));
+        // `a + 1` references a non-const local variable.
+        REPORTER_ASSERT(r, !SkSL::Analysis::IsConstantOrUniform(*initializers[1]));
+        // `u + half(sk_FragCoord.x)` varies per fragment.
+        REPORTER_ASSERT(r, !SkSL::Analysis::IsConstantOrUniform(*initializers[2]));
+    }
+}
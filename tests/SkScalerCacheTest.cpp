@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkFont.h"
+#include "include/core/SkGraphics.h"
 #include "include/core/SkTypeface.h"
 #include "src/core/SkScalerCache.h"
 #include "src/core/SkStrikeSpec.h"
@@ -83,3 +84,43 @@ DEF_TEST(SkScalerCacheMultiThread, Reporter) {
         SkTaskGroup(*executor).batch(kThreadCount, perThread);
     }
 }
+
+DEF_TEST(SkGraphicsPrefetchGlyphImages, Reporter) {
+    // Run the queued work synchronously so the test does not need to wait.
+    class DirectExecutor : public SkExecutor {
+        void add(std::function<void(void)> work) override { work(); }
+    } executor;
+
+    SkFont font;
+    font.setEdging(SkFont::Edging::kAntiAlias);
+    font.setTypeface(ToolUtils::create_portable_typeface());
+
+    SkGlyphID glyphs['z'];
+    for (int c = ' '; c < 'z'; c++) {
+        glyphs[c] = font.unicharToGlyph(c);
+    }
+    constexpr int glyphCount = 'z' - ' ';
+
+    SkPaint defaultPaint;
+    SkSurfaceProps props(0, kUnknown_SkPixelGeometry);
+
+    size_t usedBefore = SkGraphics::GetFontCacheUsed();
+    SkGraphics::PrefetchGlyphImages(font, defaultPaint, SkMatrix::I(), props,
+                                    &glyphs[' '], glyphCount, &executor);
+    REPORTER_ASSERT(Reporter, SkGraphics::GetFontCacheUsed() > usedBefore);
+
+    // The strike the prefetch populated should already hold every image.
+    SkStrikeSpec strikeSpec = SkStrikeSpec::MakeMask(
+            font, defaultPaint, props,
+            SkScalerContextFlags::kFakeGammaAndBoostContrast, SkMatrix::I());
+    sk_sp<SkStrike> strike = strikeSpec.findOrCreateStrike();
+    SkPackedGlyphID packedIDs[glyphCount];
+    for (int i = 0; i < glyphCount; i++) {
+        packedIDs[i] = SkPackedGlyphID{glyphs[' ' + i]};
+    }
+    const SkGlyph* results[glyphCount];
+    strike->prepareImages(SkMakeSpan(packedIDs, glyphCount), results);
+    for (int i = 0; i < glyphCount; i++) {
+        REPORTER_ASSERT(Reporter, results[i]->isEmpty() || results[i]->image() != nullptr);
+    }
+}
@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkColorPriv.h"
+#include "include/core/SkStream.h"
 #include "include/private/SkColorData.h"
 #include "src/core/SkCpu.h"
 #include "src/core/SkMSAN.h"
@@ -73,6 +74,73 @@ DEF_TEST(SkVM_memset, r) {
     });
 }
 
+DEF_TEST(SkVM_serialize, r) {
+    skvm::Builder b;
+    {
+        auto src = b.varying<int>(),
+             dst = b.varying<int>();
+        skvm::I32 v = b.load32(src);
+        b.store32(dst, b.add(b.mul(v, b.splat(3)), b.splat(1)));
+    }
+
+    SkDynamicMemoryWStream wstream;
+    b.serialize(&wstream);
+    sk_sp<SkData> bytes = wstream.detachAsData();
+
+    SkMemoryStream rstream(bytes);
+    skvm::Builder copy;
+    REPORTER_ASSERT(r, skvm::Builder::Deserialize(&rstream, &copy));
+    REPORTER_ASSERT(r, copy.hash() == b.hash());
+    REPORTER_ASSERT(r, copy.program() == b.program());
+
+    test_jit_and_interpreter(copy, [&](const skvm::Program& p) {
+        int src[] = {0,1,2,3},
+            dst[] = {0,0,0,0};
+        p.eval(SK_ARRAY_COUNT(src), src, dst);
+        for (size_t i = 0; i < SK_ARRAY_COUNT(src); i++) {
+            REPORTER_ASSERT(r, dst[i] == (int)i*3 + 1);
+        }
+    });
+
+    // Truncated and corrupt streams must fail cleanly.
+    SkMemoryStream truncated(bytes->data(), bytes->size() / 2);
+    skvm::Builder scratch;
+    REPORTER_ASSERT(r, !skvm::Builder::Deserialize(&truncated, &scratch));
+}
+
+DEF_TEST(SkVM_integer_hash_ops, r) {
+    // mul_hi and rotr/rotl are the building blocks of integer hashes.  Run one round of a
+    // xorshift-multiply style hash through both backends and check a scalar reference.
+    skvm::Builder b;
+    {
+        auto src = b.varying<int>(),
+             dst = b.varying<int>();
+        skvm::I32 v = b.load32(src);
+        v = b.bit_xor(v, b.shr(v, 16));
+        v = b.mul(v, 0x7feb352d);
+        v = b.rotl(v, 13);
+        v = b.mul_hi(v, (int)0x846ca68b);
+        b.store32(dst, v);
+    }
+
+    test_jit_and_interpreter(b, [&](const skvm::Program& p) {
+        uint32_t src[33], dst[33];
+        for (uint32_t i = 0; i < 33; i++) {
+            src[i] = i*i*i + 1013904223u;
+        }
+
+        p.eval(33, src, dst);
+        for (uint32_t i = 0; i < 33; i++) {
+            uint32_t v = src[i];
+            v ^= v >> 16;
+            v *= 0x7feb352d;
+            v  = v << 13 | v >> 19;
+            v  = (uint32_t)((uint64_t)v * 0x846ca68b >> 32);
+            REPORTER_ASSERT(r, dst[i] == v);
+        }
+    });
+}
+
 DEF_TEST(SkVM_memcpy, r) {
     skvm::Builder b;
     {
@@ -1093,6 +1161,16 @@ DEF_TEST(SkVM_Assembler, r) {
         0xc4,0xc1,0x7d, 0x72,0xd0, 0x05,
     });
 
+    test_asm(r, [&](A& a) {
+        a.vpmuludq(A::ymm4, A::ymm3, A::ymm2);
+        a.vpsrlq  (A::ymm4, A::ymm3, 12);
+        a.vpblendd(A::ymm0, A::ymm1, A::ymm2, 0xaa);
+    },{
+        0xc5,0xe5, 0xf4, 0xe2,
+        0xc5,0xdd, 0x73,0xd3, 0x0c,
+        0xc4,0xe3,0x75, 0x02, 0xc2, 0xaa,
+    });
+
     test_asm(r, [&](A& a) {
         A::Label l;
         a.vpermps(A::ymm1, A::ymm2, A::Mem{A::rdi, 32});
@@ -1577,6 +1655,14 @@ DEF_TEST(SkVM_Assembler, r) {
         0x64,0xe4,0x21,0x6e,
     });
 
+    test_asm(r, [&](A& a) {
+        a.umull (A::v4, A::v3, A::v1);
+        a.umull2(A::v4, A::v3, A::v1);
+    },{
+        0x64,0xc0,0xa1,0x2e,
+        0x64,0xc0,0xa1,0x6e,
+    });
+
     test_asm(r, [&](A& a) {
         a.shl4s(A::v4, A::v3,  0);
         a.shl4s(A::v4, A::v3,  1);
@@ -661,3 +661,91 @@ DEF_TEST(RBuffer, reporter) {
     REPORTER_ASSERT(reporter, !buffer.read(&tmp, 4));
     REPORTER_ASSERT(reporter, !buffer.isValid());
 }
+
+#include "include/core/SkExecutor.h"
+#include "include/utils/SkReadaheadStream.h"
+
+static void test_readahead_stream(skiatest::Reporter* reporter, SkExecutor* executor) {
+    SkRandom rand(0x52414853);
+    constexpr size_t kSize = 10 * 1000 + 13;  // deliberately not a multiple of the buffer halves
+    SkAutoMalloc src(kSize);
+    uint8_t* bytes = static_cast<uint8_t*>(src.get());
+    for (size_t i = 0; i < kSize; i++) {
+        bytes[i] = rand.nextU() & 0xFF;
+    }
+
+    auto stream = SkReadaheadStream::Make(
+            std::make_unique<SkMemoryStream>(src.get(), kSize, /*copyData=*/false),
+            /*bufferSize=*/1024, executor);
+    REPORTER_ASSERT(reporter, stream);
+    REPORTER_ASSERT(reporter, !stream->isAtEnd());
+
+    // Peeking must not consume anything.
+    uint8_t peeked[32];
+    REPORTER_ASSERT(reporter, stream->peek(peeked, sizeof(peeked)) == sizeof(peeked));
+    REPORTER_ASSERT(reporter, !memcmp(peeked, bytes, sizeof(peeked)));
+
+    // Drain in ragged chunk sizes and make sure every byte comes back in order.
+    SkAutoMalloc dst(kSize);
+    uint8_t* out = static_cast<uint8_t*>(dst.get());
+    size_t total = 0;
+    while (total < kSize) {
+        size_t chunk = 1 + rand.nextULessThan(997);
+        size_t read = stream->read(out + total, chunk);
+        REPORTER_ASSERT(reporter, read == std::min(chunk, kSize - total));
+        total += read;
+    }
+    REPORTER_ASSERT(reporter, !memcmp(dst.get(), src.get(), kSize));
+    REPORTER_ASSERT(reporter, stream->isAtEnd());
+    REPORTER_ASSERT(reporter, stream->read(out, 1) == 0);
+}
+
+DEF_TEST(ReadaheadStream, reporter) {
+    // Inline executor: readahead degrades to synchronous buffering.
+    test_readahead_stream(reporter, nullptr);
+
+    // Threaded executor: fills genuinely race ahead of the reads.
+    std::unique_ptr<SkExecutor> threadPool = SkExecutor::MakeFIFOThreadPool(2);
+    test_readahead_stream(reporter, threadPool.get());
+}
+
+#include "include/utils/SkAsyncWStream.h"
+
+static void test_async_wstream(skiatest::Reporter* reporter, SkExecutor* executor) {
+    // An awkward size: not a multiple of the buffer halves or of any write chunk below.
+    static constexpr size_t kSize = 10013;
+    SkAutoTMalloc<char> src(kSize);
+    SkRandom rand;
+    for (size_t i = 0; i < kSize; ++i) {
+        src[i] = static_cast<char>(rand.nextU());
+    }
+
+    auto sink = std::make_unique<SkDynamicMemoryWStream>();
+    SkDynamicMemoryWStream* sinkPtr = sink.get();
+    auto stream = SkAsyncWStream::Make(std::move(sink), /*bufferSize=*/1024, executor);
+    REPORTER_ASSERT(reporter, stream);
+
+    // Write in ragged chunks so handoffs land mid-chunk.
+    const size_t chunks[] = { 1, 7, 128, 512, 3, 999, 256 };
+    size_t total = 0, i = 0;
+    while (total < kSize) {
+        size_t n = std::min(chunks[i++ % SK_ARRAY_COUNT(chunks)], kSize - total);
+        REPORTER_ASSERT(reporter, stream->write(src.get() + total, n));
+        total += n;
+        REPORTER_ASSERT(reporter, stream->bytesWritten() == total);
+    }
+
+    stream->flush();
+    REPORTER_ASSERT(reporter, sinkPtr->bytesWritten() == kSize);
+    sk_sp<SkData> written = sinkPtr->detachAsData();
+    REPORTER_ASSERT(reporter, !memcmp(written->data(), src.get(), kSize));
+}
+
+DEF_TEST(AsyncWStream, reporter) {
+    // Inline executor: writes degrade to synchronous buffering.
+    test_async_wstream(reporter, nullptr);
+
+    // Threaded executor: drains genuinely lag behind the writes.
+    std::unique_ptr<SkExecutor> threadPool = SkExecutor::MakeFIFOThreadPool(2);
+    test_async_wstream(reporter, threadPool.get());
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkSurface.h"
+#include "include/core/SkSurfacePool.h"
+#include "tests/Test.h"
+
+DEF_TEST(SurfacePool_reuse, reporter) {
+    SkSurfacePool pool;
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(16, 16);
+
+    sk_sp<SkSurface> first = pool.acquire(nullptr, info);
+    REPORTER_ASSERT(reporter, first);
+    SkSurface* firstPtr = first.get();
+    pool.recycle(std::move(first));
+    REPORTER_ASSERT(reporter, pool.count() == 1);
+
+    // Same description comes back recycled; a different one does not.
+    sk_sp<SkSurface> second = pool.acquire(nullptr, info);
+    REPORTER_ASSERT(reporter, second.get() == firstPtr);
+    sk_sp<SkSurface> other = pool.acquire(nullptr, SkImageInfo::MakeN32Premul(32, 32));
+    REPORTER_ASSERT(reporter, other.get() != firstPtr);
+
+    pool.recycle(std::move(second));
+    pool.recycle(std::move(other));
+    REPORTER_ASSERT(reporter, pool.count() == 2);
+    pool.purge();
+    REPORTER_ASSERT(reporter, pool.count() == 0);
+}
+
+DEF_TEST(SurfacePool_canvasReset, reporter) {
+    SkSurfacePool pool;
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(16, 16);
+
+    sk_sp<SkSurface> surface = pool.acquire(nullptr, info);
+    SkCanvas* canvas = surface->getCanvas();
+    canvas->save();
+    canvas->translate(3, 4);
+    canvas->clipRect(SkRect::MakeWH(4, 4));
+    pool.recycle(std::move(surface));
+
+    surface = pool.acquire(nullptr, info);
+    canvas = surface->getCanvas();
+    REPORTER_ASSERT(reporter, canvas->getSaveCount() == 1);
+    REPORTER_ASSERT(reporter, canvas->getTotalMatrix().isIdentity());
+    REPORTER_ASSERT(reporter, canvas->getDeviceClipBounds() == SkIRect::MakeWH(16, 16));
+    pool.recycle(std::move(surface));
+}
+
+DEF_TEST(SurfacePool_snapshotSafety, reporter) {
+    SkSurfacePool pool;
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(4, 4);
+
+    sk_sp<SkSurface> surface = pool.acquire(nullptr, info);
+    surface->getCanvas()->clear(SK_ColorGREEN);
+    sk_sp<SkImage> snapped = surface->makeImageSnapshot();
+    pool.recycle(std::move(surface));
+
+    // Reusing the surface must not change the pixels of the earlier snapshot.
+    surface = pool.acquire(nullptr, info);
+    surface->getCanvas()->clear(SK_ColorRED);
+
+    SkBitmap bitmap;
+    bitmap.allocPixels(info);
+    REPORTER_ASSERT(reporter, snapped->readPixels(nullptr, bitmap.pixmap(), 0, 0));
+    REPORTER_ASSERT(reporter, bitmap.getColor(0, 0) == SK_ColorGREEN);
+    pool.recycle(std::move(surface));
+}
+
+DEF_TEST(SurfacePool_callerHoldsRef, reporter) {
+    SkSurfacePool pool;
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(8, 8);
+
+    sk_sp<SkSurface> surface = pool.acquire(nullptr, info);
+    sk_sp<SkSurface> extraRef = surface;
+    pool.recycle(std::move(surface));
+
+    // The surface can't be reused while the caller still holds it.
+    REPORTER_ASSERT(reporter, pool.count() == 0);
+    sk_sp<SkSurface> fresh = pool.acquire(nullptr, info);
+    REPORTER_ASSERT(reporter, fresh.get() != extraRef.get());
+    pool.recycle(std::move(fresh));
+}
@@ -1184,3 +1184,52 @@ DEF_TEST(surface_image_unity, reporter) {
         }
     }
 }
+
+// Incremental snapshots patch a recycled backing texture with just the declared dirty rect, so
+// check that successive snapshots see new damage, that an outstanding older snapshot keeps its
+// own pixels, and that undeclared (clean) areas carry forward.
+DEF_GPUTEST_FOR_RENDERING_CONTEXTS(SurfaceIncrementalSnapshot_Gpu, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(16, 16);
+    sk_sp<SkSurface> surface = SkSurface::MakeRenderTarget(dContext, SkBudgeted::kNo, info);
+    SkCanvas* canvas = surface->getCanvas();
+
+    auto read_pixel = [&](const sk_sp<SkImage>& image, int x, int y) {
+        SkPMColor pixel = 0;
+        SkImageInfo pixelInfo = SkImageInfo::MakeN32Premul(1, 1);
+        REPORTER_ASSERT(reporter,
+                        image->readPixels(dContext, pixelInfo, &pixel, sizeof(pixel), x, y));
+        return pixel;
+    };
+    const SkPMColor red   = SkPreMultiplyColor(SK_ColorRED);
+    const SkPMColor blue  = SkPreMultiplyColor(SK_ColorBLUE);
+    const SkPMColor green = SkPreMultiplyColor(SK_ColorGREEN);
+
+    canvas->clear(SK_ColorRED);
+    sk_sp<SkImage> img1 = surface->makeIncrementalImageSnapshot(SkIRect::MakeWH(16, 16));
+    REPORTER_ASSERT(reporter, img1);
+    REPORTER_ASSERT(reporter, read_pixel(img1, 6, 6) == red);
+
+    // Second snapshot while the first is still alive: only the blue rect is dirty.
+    SkPaint paint;
+    paint.setColor(SK_ColorBLUE);
+    canvas->drawIRect(SkIRect::MakeXYWH(4, 4, 4, 4), paint);
+    sk_sp<SkImage> img2 = surface->makeIncrementalImageSnapshot(SkIRect::MakeXYWH(4, 4, 4, 4));
+    REPORTER_ASSERT(reporter, img2);
+    REPORTER_ASSERT(reporter, img2->uniqueID() != img1->uniqueID());
+    REPORTER_ASSERT(reporter, read_pixel(img2, 6, 6) == blue);
+    REPORTER_ASSERT(reporter, read_pixel(img2, 1, 1) == red);
+
+    // The outstanding first snapshot must not see the new stroke.
+    REPORTER_ASSERT(reporter, read_pixel(img1, 6, 6) == red);
+
+    // Drop the first snapshot so its backing recycles, and accumulate more damage.
+    img1.reset();
+    paint.setColor(SK_ColorGREEN);
+    canvas->drawIRect(SkIRect::MakeXYWH(0, 0, 2, 2), paint);
+    sk_sp<SkImage> img3 = surface->makeIncrementalImageSnapshot(SkIRect::MakeXYWH(0, 0, 2, 2));
+    REPORTER_ASSERT(reporter, img3);
+    REPORTER_ASSERT(reporter, read_pixel(img3, 1, 1) == green);
+    REPORTER_ASSERT(reporter, read_pixel(img3, 6, 6) == blue);
+    REPORTER_ASSERT(reporter, read_pixel(img3, 12, 12) == red);
+}
@@ -144,6 +144,62 @@ DEF_TEST(SwizzleOpts, r) {
     REPORTER_ASSERT(r, dst == 0xFA04ADCA);
 }
 
+DEF_TEST(ConvertOpts, r) {
+    // unorm8 -> half -> unorm8 must round-trip exactly, including the non-vector tail.
+    uint32_t src[7], back[7];
+    uint64_t f16[7];
+    for (int i = 0; i < 7; i++) {
+        src[i] = 0x01234567 * (i + 1) + i;
+    }
+    SkOpts::RGBA_to_F16(f16, src, 7);
+    SkOpts::F16_to_RGBA(back, f16, 7);
+    for (int i = 0; i < 7; i++) {
+        REPORTER_ASSERT(r, back[i] == src[i]);
+    }
+
+    // Out-of-range halfs clamp to [0,1]: r=2.0, g=-1.0, b=2.0, a=1.0.
+    uint64_t hdr = 0x3C00'4000'BC00'4000;
+    uint32_t clamped;
+    SkOpts::F16_to_RGBA(&clamped, &hdr, 1);
+    REPORTER_ASSERT(r, clamped == 0xFFFF00FF);
+
+    // The 1010102 repacks must match round(x * scale) in every channel.
+    for (int v = 0; v < 256; v++) {
+        uint32_t gray = v * 0x01010101;
+        uint32_t packed;
+        SkOpts::RGBA_to_1010102(&packed, &gray, 1);
+        uint32_t c10 = (uint32_t)sk_float_round2int(v / 255.0f * 1023.0f);
+        uint32_t a2  = (uint32_t)sk_float_round2int(v / 255.0f *    3.0f);
+        REPORTER_ASSERT(r, packed == (c10 | c10 << 10 | c10 << 20 | a2 << 30));
+    }
+    for (uint32_t v = 0; v < 1024; v++) {
+        uint32_t packed = v | v << 10 | v << 20 | 3u << 30;
+        uint32_t px;
+        SkOpts::RGBA_1010102_to_RGBA(&px, &packed, 1);
+        uint32_t c8 = (uint32_t)sk_float_round2int(v / 1023.0f * 255.0f);
+        REPORTER_ASSERT(r, px == (c8 | c8 << 8 | c8 << 16 | 0xFF000000));
+    }
+}
+
+DEF_TEST(SampleOpts, r) {
+    // sample_u32 must match the scalar strided copy for any stride and count, including tails.
+    uint8_t src[4 + 40*19];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 7 + 3);
+    }
+    for (int deltaSrc : {4, 5, 8, 12, 19}) {
+        for (int count : {0, 1, 3, 4, 7, 8, 9, 40}) {
+            uint32_t dst[40];
+            SkOpts::sample_u32(dst, src, deltaSrc, count);
+            for (int i = 0; i < count; i++) {
+                uint32_t expected;
+                memcpy(&expected, src + i * deltaSrc, 4);
+                REPORTER_ASSERT(r, dst[i] == expected);
+            }
+        }
+    }
+}
+
 DEF_TEST(PublicSwizzleOpts, r) {
     uint32_t dst, src;
 
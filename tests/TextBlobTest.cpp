@@ -480,6 +480,30 @@ DEF_TEST(TextBlob_iter, reporter) {
     REPORTER_ASSERT(reporter, run.fGlyphIndices[2] == run.fGlyphIndices[3]);
 }
 
+DEF_TEST(TextBlob_runBounds, reporter) {
+    SkTextBlobBuilder builder;
+    add_run(&builder, "Hello", 10, 20, nullptr);
+    add_run(&builder, "World", 10, 1020, nullptr);
+    auto blob = builder.make();
+
+    SkRect runBounds[2];
+    int runs = 0;
+    for (SkTextBlobRunIterator it(blob.get()); !it.done(); it.next()) {
+        REPORTER_ASSERT(reporter, runs < 2);
+        runBounds[runs++] = it.bounds();
+    }
+    REPORTER_ASSERT(reporter, runs == 2);
+
+    // Each run's cached bounds is non-empty and lies within the blob bounds.
+    for (const SkRect& bounds : runBounds) {
+        REPORTER_ASSERT(reporter, !bounds.isEmpty());
+        REPORTER_ASSERT(reporter, blob->bounds().contains(bounds));
+    }
+
+    // Runs 1000px apart must not share bounds, or per-run culling could never kick in.
+    REPORTER_ASSERT(reporter, !runBounds[0].intersects(runBounds[1]));
+}
+
 DEF_TEST(TextBlob_getIntercepts, reporter) {
     SkFont font;
     font.setSize(16);
@@ -509,3 +533,44 @@ DEF_TEST(TextBlob_getIntercepts, reporter) {
     // raised 'y' should not intersect
     REPORTER_ASSERT(reporter, blobHighY->getIntercepts(bounds, nullptr) == 0);
 }
+
+DEF_TEST(TextBlob_replaceGlyphs, reporter) {
+    SkFont font;
+    font.setSize(16);
+
+    SkTextBlobBuilder builder;
+    const auto& buffer = builder.allocRunPos(font, 4);
+    for (int i = 0; i < 4; ++i) {
+        buffer.glyphs[i] = SkToU16(10 + i);
+        buffer.points()[i] = SkPoint::Make(i * 16.0f, 0);
+    }
+    auto blob = builder.make();
+    const uint32_t oldID = blob->uniqueID();
+
+    // Mismatched count fails and leaves the blob untouched.
+    const SkGlyphID shortRun[2] = { 1, 2 };
+    REPORTER_ASSERT(reporter, !blob->replaceGlyphs(shortRun, 2));
+    REPORTER_ASSERT(reporter, blob->uniqueID() == oldID);
+
+    // A second reference blocks mutation.
+    {
+        auto extraRef = blob;
+        const SkGlyphID glyphs[4] = { 20, 21, 22, 23 };
+        REPORTER_ASSERT(reporter, !blob->replaceGlyphs(glyphs, 4));
+    }
+
+    // Uniquely owned with matching count succeeds, keeping positions.
+    const SkGlyphID glyphs[4] = { 20, 21, 22, 23 };
+    REPORTER_ASSERT(reporter, blob->replaceGlyphs(glyphs, 4));
+    REPORTER_ASSERT(reporter, blob->uniqueID() != oldID);
+
+    SkTextBlob::Iter::ExperimentalRun run;
+    SkTextBlob::Iter iter(*blob);
+    REPORTER_ASSERT(reporter, iter.experimentalNext(&run));
+    REPORTER_ASSERT(reporter, run.count == 4);
+    for (int i = 0; i < 4; ++i) {
+        REPORTER_ASSERT(reporter, run.glyphs[i] == glyphs[i]);
+        REPORTER_ASSERT(reporter, run.positions[i] == SkPoint::Make(i * 16.0f, 0));
+    }
+    REPORTER_ASSERT(reporter, !iter.experimentalNext(&run));
+}
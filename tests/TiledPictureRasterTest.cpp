@@ -0,0 +1,58 @@
+/*
+ * Copyright 2021 Google Inc.
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPictureRecorder.h"
+#include "src/utils/SkTiledPictureRaster.h"
+#include "tests/Test.h"
+
+static sk_sp<SkPicture> make_test_picture(int w, int h) {
+    SkPictureRecorder recorder;
+    SkCanvas* canvas = recorder.beginRecording(SkIntToScalar(w), SkIntToScalar(h));
+    canvas->clear(SK_ColorWHITE);
+    SkPaint paint;
+    paint.setColor(SK_ColorRED);
+    canvas->drawRect(SkRect::MakeXYWH(5, 5, w - 10.0f, h - 10.0f), paint);
+    paint.setColor(SK_ColorBLUE);
+    canvas->drawCircle(w * 0.5f, h * 0.5f, w * 0.25f, paint);
+    return recorder.finishRecordingAsPicture();
+}
+
+DEF_TEST(TiledPictureRaster, reporter) {
+    constexpr int kW = 64, kH = 53;  // deliberately not a multiple of any band count
+    sk_sp<SkPicture> picture = make_test_picture(kW, kH);
+
+    SkBitmap reference;
+    reference.allocN32Pixels(kW, kH);
+    reference.eraseColor(SK_ColorTRANSPARENT);
+    SkCanvas refCanvas(reference);
+    refCanvas.drawPicture(picture);
+
+    for (int bands : {1, 3, 8, kH, kH + 5}) {
+        SkBitmap tiled;
+        tiled.allocN32Pixels(kW, kH);
+        tiled.eraseColor(SK_ColorTRANSPARENT);
+        SkPixmap pm;
+        REPORTER_ASSERT(reporter, tiled.peekPixels(&pm));
+        REPORTER_ASSERT(reporter,
+                        SkTiledPictureRaster::Draw(pm, picture.get(), nullptr, bands));
+
+        // Band-parallel playback must be pixel-identical to single-threaded playback.
+        bool match = true;
+        for (int y = 0; y < kH && match; ++y) {
+            match = 0 == memcmp(reference.getAddr32(0, y), tiled.getAddr32(0, y),
+                                kW * sizeof(uint32_t));
+        }
+        REPORTER_ASSERT(reporter, match, "bands=%d", bands);
+    }
+
+    // Degenerate inputs fail cleanly.
+    SkPixmap empty;
+    REPORTER_ASSERT(reporter, !SkTiledPictureRaster::Draw(empty, picture.get(), nullptr, 4));
+}
@@ -8,6 +8,7 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkSurface.h"
 #include "include/core/SkVertices.h"
+#include "include/utils/SkVerticesBatcher.h"
 #include "src/core/SkAutoMalloc.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkVerticesPriv.h"
@@ -164,3 +165,57 @@ DEF_TEST(Vertices_clipping, reporter) {
         }
     }
 }
+
+DEF_TEST(Vertices_batcher, reporter) {
+    const SkPoint pts[] = {{0, 0}, {4, 0}, {0, 4}};
+    const SkPoint texs[] = {{0, 0}, {1, 0}, {0, 1}};
+    const SkColor colors[] = {SK_ColorRED, SK_ColorGREEN, SK_ColorBLUE};
+    const uint16_t indices[] = {2, 1, 0};
+
+    auto plain   = SkVertices::MakeCopy(SkVertices::kTriangles_VertexMode, 3, pts, texs, colors);
+    auto indexed = SkVertices::MakeCopy(SkVertices::kTriangles_VertexMode, 3, pts, texs, colors,
+                                        3, indices);
+
+    // A single identity-transformed mesh comes back unmodified.
+    {
+        SkVerticesBatcher batcher;
+        REPORTER_ASSERT(reporter, batcher.append(plain, SkMatrix::I()));
+        REPORTER_ASSERT(reporter, batcher.detach() == plain);
+        REPORTER_ASSERT(reporter, batcher.empty());
+    }
+
+    // Mixing indexed and unindexed meshes produces one indexed mesh with baked transforms.
+    {
+        SkVerticesBatcher batcher;
+        REPORTER_ASSERT(reporter, batcher.append(plain, SkMatrix::I()));
+        REPORTER_ASSERT(reporter, batcher.append(indexed, SkMatrix::Translate(10, 0)));
+
+        auto batch = batcher.detach();
+        REPORTER_ASSERT(reporter, batch);
+        SkVerticesPriv info = batch->priv();
+        REPORTER_ASSERT(reporter, info.vertexCount() == 6);
+        REPORTER_ASSERT(reporter, info.indexCount() == 6);
+        REPORTER_ASSERT(reporter, info.hasTexCoords() && info.hasColors());
+        for (int i = 0; i < 3; ++i) {
+            REPORTER_ASSERT(reporter, info.positions()[i] == pts[i]);
+            REPORTER_ASSERT(reporter, info.positions()[3 + i] == SkPoint::Make(pts[i].fX + 10, pts[i].fY));
+            REPORTER_ASSERT(reporter, info.texCoords()[3 + i] == texs[i]);
+            REPORTER_ASSERT(reporter, info.colors()[3 + i] == colors[i]);
+            REPORTER_ASSERT(reporter, info.indices()[i] == i);
+            REPORTER_ASSERT(reporter, info.indices()[3 + i] == 3 + indices[i]);
+        }
+    }
+
+    // Attribute and mode mismatches are rejected without disturbing the batch.
+    {
+        auto noAttrs = SkVertices::MakeCopy(SkVertices::kTriangles_VertexMode, 3, pts,
+                                            nullptr, nullptr);
+        auto fan     = SkVertices::MakeCopy(SkVertices::kTriangleFan_VertexMode, 3, pts,
+                                            texs, colors);
+        SkVerticesBatcher batcher;
+        REPORTER_ASSERT(reporter, batcher.append(plain, SkMatrix::I()));
+        REPORTER_ASSERT(reporter, !batcher.append(noAttrs, SkMatrix::I()));
+        REPORTER_ASSERT(reporter, !batcher.append(fan, SkMatrix::I()));
+        REPORTER_ASSERT(reporter, batcher.detach()->priv().vertexCount() == 3);
+    }
+}
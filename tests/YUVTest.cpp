@@ -165,3 +165,63 @@ DEF_TEST(YUVMath, reporter) {
         }
     }
 }
+
+#include "src/core/SkOpts.h"
+#include "include/utils/SkRandom.h"
+
+// The fused fixed-point row kernel must agree with the float matrix it was built from to
+// within one code value per channel, for both planar (I420) and interleaved (NV12) chroma.
+DEF_TEST(YUVtoRGBARowOpts, reporter) {
+    const SkYUVColorSpace spaces[] = {
+        kJPEG_Full_SkYUVColorSpace,
+        kRec601_Limited_SkYUVColorSpace,
+        kRec709_Full_SkYUVColorSpace,
+        kRec709_Limited_SkYUVColorSpace,
+        kBT2020_8bit_Full_SkYUVColorSpace,
+        kBT2020_8bit_Limited_SkYUVColorSpace,
+        kIdentity_SkYUVColorSpace,
+    };
+
+    // Odd width exercises both the vector body and the scalar tail, and an odd trailing
+    // chroma sample.
+    constexpr int kWidth = 37;
+    constexpr int kChromaWidth = (kWidth + 1) / 2;
+
+    SkRandom rand;
+    uint8_t yRow[kWidth];
+    uint8_t uRow[kChromaWidth], vRow[kChromaWidth], uvRow[2*kChromaWidth];
+    for (int i = 0; i < kWidth; ++i) {
+        yRow[i] = rand.nextU() & 0xff;
+    }
+    for (int i = 0; i < kChromaWidth; ++i) {
+        uRow[i] = rand.nextU() & 0xff;
+        vRow[i] = rand.nextU() & 0xff;
+        uvRow[2*i + 0] = uRow[i];
+        uvRow[2*i + 1] = vRow[i];
+    }
+
+    for (SkYUVColorSpace cs : spaces) {
+        float mtx[20];
+        SkColorMatrix_YUV2RGB(cs, mtx);
+        const SkYUVtoRGBACoeffs coeffs = SkYUVtoRGBACoeffs::Make(cs);
+
+        uint32_t planar[kWidth], interleaved[kWidth];
+        SkOpts::yuv_to_rgba_row(planar, yRow, uRow, vRow, 1, kWidth, coeffs);
+        SkOpts::yuv_to_rgba_row(interleaved, yRow, uvRow, uvRow + 1, 2, kWidth, coeffs);
+
+        for (int x = 0; x < kWidth; ++x) {
+            REPORTER_ASSERT(reporter, planar[x] == interleaved[x]);
+
+            const uint8_t yuv[3] = {yRow[x], uRow[x/2], vRow[x/2]};
+            for (int c = 0; c < 3; ++c) {
+                float expected = mtx[5*c + 0]*yuv[0] + mtx[5*c + 1]*yuv[1] +
+                                 mtx[5*c + 2]*yuv[2] + mtx[5*c + 4]*255;
+                int ref = SkTPin(SkScalarRoundToInt(expected), 0, 255);
+                int actual = (planar[x] >> (8*c)) & 0xff;
+                REPORTER_ASSERT(reporter, SkTAbs(ref - actual) <= 1,
+                                "cs %d x %d channel %d: %d vs %d", cs, x, c, ref, actual);
+            }
+            REPORTER_ASSERT(reporter, (planar[x] >> 24) == 0xff);
+        }
+    }
+}
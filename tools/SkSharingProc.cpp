@@ -11,6 +11,8 @@
 #include "include/core/SkData.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkSerialProcs.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkTypeface.h"
 
 namespace {
     sk_sp<SkData> collectNonTextureImagesProc(SkImage* img, void* ctx) {
@@ -53,6 +55,22 @@ sk_sp<SkData> SkSharingSerialContext::serializeImage(SkImage* img, void* ctx) {
     return SkData::MakeWithCopy(&fid, sizeof(fid));
 }
 
+sk_sp<SkData> SkSharingSerialContext::serializeTypeface(SkTypeface* typeface, void* ctx) {
+    SkSharingSerialContext* context = reinterpret_cast<SkSharingSerialContext*>(ctx);
+    uint32_t id = typeface->uniqueID();
+    // find out if we have already serialized this, and if so, what its in-file id is.
+    auto iter = context->fTypefaceMap.find(id);
+    if (iter == context->fTypefaceMap.end()) {
+        // When not present, add its id to the map and return its usual serialized form,
+        // including the font data so the file is self contained.
+        context->fTypefaceMap[id] = context->fTypefaceMap.size(); // Next in-file id
+        return typeface->serialize(SkTypeface::SerializeBehavior::kDoIncludeData);
+    }
+    uint32_t fid = iter->second;
+    // if present, return only the in-file id we registered the first time we serialized it.
+    return SkData::MakeWithCopy(&fid, sizeof(fid));
+}
+
 sk_sp<SkImage> SkSharingDeserialContext::deserializeImage(
   const void* data, size_t length, void* ctx) {
     if (!data || !length || !ctx) {
@@ -81,3 +99,30 @@ sk_sp<SkImage> SkSharingDeserialContext::deserializeImage(
     context->fImages.push_back(image);
     return image;
 }
+
+sk_sp<SkTypeface> SkSharingDeserialContext::deserializeTypeface(
+  const void* data, size_t length, void* ctx) {
+    if (!data || !length || !ctx) {
+        SkDebugf("SkSharingDeserialContext::deserializeTypeface arguments invalid %p %zu %p.\n",
+            data, length, ctx);
+        return nullptr; // the caller will fall back to the default typeface.
+    }
+    SkSharingDeserialContext* context = reinterpret_cast<SkSharingDeserialContext*>(ctx);
+    uint32_t fid;
+    // If the data is a typeface fid, look up an already deserialized typeface from our list.
+    // A serialized typeface is always larger than an fid (it starts with a larger descriptor).
+    if (length == sizeof(fid)) {
+        memcpy(&fid, data, sizeof(fid));
+        if (fid >= context->fTypefaces.size()) {
+            SkDebugf("Cannot deserialize using id, We do not have the data for typeface %d.\n",
+                fid);
+            return nullptr;
+        }
+        return context->fTypefaces[fid];
+    }
+    // Otherwise, the data is a typeface, deserialize it, and store it in our list at its fid.
+    SkMemoryStream stream(data, length);
+    const sk_sp<SkTypeface> typeface = SkTypeface::MakeDeserialize(&stream);
+    context->fTypefaces.push_back(typeface);
+    return typeface;
+}
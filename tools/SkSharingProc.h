@@ -14,6 +14,7 @@
 #include "include/core/SkData.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkSerialProcs.h"
+#include "include/core/SkTypeface.h"
 
 /**
  * This serial proc serializes each image it encounters only once, using their uniqueId as the
@@ -60,6 +61,15 @@ struct SkSharingSerialContext {
     // procs.fImageProc = SkSharingSerialContext::serializeImage;
     // procs.fImageCtx = ctx.get();
     static sk_sp<SkData> serializeImage(SkImage* img, void* ctx);
+
+    // A map from the ids from SkTypeface::uniqueID() to ids used within the file
+    std::unordered_map<uint32_t, uint32_t> fTypefaceMap;
+
+    // A serial proc that shares typefaces between subpictures, analogous to serializeImage.
+    // Set it as fTypefaceProc with the same context as serializeImage. Typefaces dominate the
+    // per-picture overhead for text-heavy content, since each picture otherwise re-embeds the
+    // full font data.
+    static sk_sp<SkData> serializeTypeface(SkTypeface* typeface, void* ctx);
 };
 
 struct SkSharingDeserialContext {
@@ -70,6 +80,13 @@ struct SkSharingDeserialContext {
     // A deserial proc that can interpret id's in place of images as references to previous images.
     // Can also deserialize a SKP where all images are inlined (it's backwards compatible)
     static sk_sp<SkImage> deserializeImage(const void* data, size_t length, void* ctx);
+
+    // a list of unique typefaces in the order they were encountered in the file
+    std::vector<sk_sp<SkTypeface>> fTypefaces;
+
+    // A deserial proc that can interpret id's in place of typefaces as references to previous
+    // typefaces, matching serializeTypeface. Also handles inlined typefaces.
+    static sk_sp<SkTypeface> deserializeTypeface(const void* data, size_t length, void* ctx);
 };
 
 #endif
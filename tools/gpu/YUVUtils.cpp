@@ -15,6 +15,7 @@
 #include "include/gpu/GrRecordingContext.h"
 #include "include/gpu/GrYUVABackendTextures.h"
 #include "src/codec/SkCodecImageGenerator.h"
+#include "src/core/SkOpts.h"
 #include "src/core/SkYUVAInfoLocation.h"
 #include "src/core/SkYUVMath.h"
 #include "src/gpu/GrDirectContextPriv.h"
@@ -67,6 +68,10 @@ protected:
             fFlattened.allocPixels(info);
             SkASSERT(info == this->getInfo());
 
+            if (this->flattenFast(info)) {
+                return fFlattened.readPixels(info, pixels, rowBytes, 0, 0);
+            }
+
             float mtx[20];
             SkColorMatrix_YUV2RGB(fPixmaps.yuvaInfo().yuvColorSpace(), mtx);
             SkYUVAInfo::YUVALocations yuvaLocations = fPixmaps.toYUVALocations();
@@ -129,6 +134,40 @@ protected:
     }
 
 private:
+    // Flattens common 8-bit 4:2:0 layouts (I420 and NV12) with the fused SkOpts row kernel
+    // instead of the generic per-pixel lookup. Returns false when the layout isn't covered.
+    bool flattenFast(const SkImageInfo& info) {
+        const SkYUVAInfo& yuvaInfo = fPixmaps.yuvaInfo();
+        bool interleavedUV;
+        switch (yuvaInfo.planeConfig()) {
+            case SkYUVAInfo::PlaneConfig::kY_U_V: interleavedUV = false; break;
+            case SkYUVAInfo::PlaneConfig::kY_UV:  interleavedUV = true;  break;
+            default: return false;
+        }
+        if (info.colorType() != kRGBA_8888_SkColorType                 ||
+            yuvaInfo.origin() != kTopLeft_SkEncodedOrigin              ||
+            yuvaInfo.subsampling() != SkYUVAInfo::Subsampling::k420    ||
+            fPixmaps.dataType() != SkYUVAPixmapInfo::DataType::kUnorm8) {
+            return false;
+        }
+
+        const SkYUVtoRGBACoeffs coeffs = SkYUVtoRGBACoeffs::Make(yuvaInfo.yuvColorSpace());
+        const SkPixmap& yPlane = fPixmaps.plane(0);
+        const SkPixmap& uPlane = fPixmaps.plane(1);
+        const SkPixmap& vPlane = fPixmaps.plane(interleavedUV ? 1 : 2);
+        const int chromaStep = interleavedUV ? 2 : 1;
+        for (int y = 0; y < info.height(); ++y) {
+            auto* uRow = static_cast<const uint8_t*>(uPlane.addr(0, y/2));
+            auto* vRow = static_cast<const uint8_t*>(vPlane.addr(0, y/2));
+            // The image is opaque, so RGBA here is already premul.
+            SkOpts::yuv_to_rgba_row(fFlattened.getAddr32(0, y),
+                                    static_cast<const uint8_t*>(yPlane.addr(0, y)),
+                                    uRow, interleavedUV ? uRow + 1 : vRow,
+                                    chromaStep, info.width(), coeffs);
+        }
+        return true;
+    }
+
     SkYUVAPixmaps fPixmaps;
     SkBitmap      fFlattened;
 };